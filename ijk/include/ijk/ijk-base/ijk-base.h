@@ -28,8 +28,15 @@
 
 
 #include "ijk-utility/ijkTimer.h"
+#include "ijk-utility/ijkScheduler.h"
 #include "ijk-utility/ijkThread.h"
+#include "ijk-utility/ijkFiber.h"
+#include "ijk-utility/ijkJob.h"
+#include "ijk-utility/ijkQueue.h"
+#include "ijk-utility/ijkProfiler.h"
+#include "ijk-utility/ijkBenchmark.h"
 #include "ijk-utility/ijkStream.h"
+#include "ijk-utility/ijkCompress.h"
 #include "ijk-utility/ijkMemory.h"
 
 #include "ijk-input/ijkInput.h"
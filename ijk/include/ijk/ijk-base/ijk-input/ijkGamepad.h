@@ -115,7 +115,7 @@ struct ijkGamepadState
 //		param button: gamepad button
 //		return SUCCESS: ijk_success if retrieved state
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadGetButtonState(ijkGamepadState const* const gamepad, ibool state_out[1], ijkGamepadBtn const button);
+ijk_inl iret ijkGamepadGetButtonState(ijkGamepadState const* const gamepad, ibool state_out[1], ijkGamepadBtn const button);
 
 // ijkGamepadIsButtonDown
 //	Check whether gamepad button is down.
@@ -125,7 +125,7 @@ iret ijkGamepadGetButtonState(ijkGamepadState const* const gamepad, ibool state_
 //		return SUCCESS: ijk_true if button is down
 //		return SUCCESS: ijk_false if button is up
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadIsButtonDown(ijkGamepadState const* const gamepad, ijkGamepadBtn const button);
+ijk_inl iret ijkGamepadIsButtonDown(ijkGamepadState const* const gamepad, ijkGamepadBtn const button);
 
 // ijkGamepadIsButtonUp
 //	Check whether gamepad button is up.
@@ -135,7 +135,7 @@ iret ijkGamepadIsButtonDown(ijkGamepadState const* const gamepad, ijkGamepadBtn
 //		return SUCCESS: ijk_true if button is up
 //		return SUCCESS: ijk_false if button is down
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadIsButtonUp(ijkGamepadState const* const gamepad, ijkGamepadBtn const button);
+ijk_inl iret ijkGamepadIsButtonUp(ijkGamepadState const* const gamepad, ijkGamepadBtn const button);
 
 // ijkGamepadIsButtonDownAgain
 //	Check whether gamepad button is consistently down between updates.
@@ -145,7 +145,7 @@ iret ijkGamepadIsButtonUp(ijkGamepadState const* const gamepad, ijkGamepadBtn co
 //		return SUCCESS: ijk_true if button is consistently down
 //		return SUCCESS: ijk_false if button is not consistently down
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadIsButtonDownAgain(ijkGamepadState const* const gamepad, ijkGamepadBtn const button);
+ijk_inl iret ijkGamepadIsButtonDownAgain(ijkGamepadState const* const gamepad, ijkGamepadBtn const button);
 
 // ijkGamepadIsButtonUpAgain
 //	Check whether gamepad button is consistently up between updates.
@@ -155,7 +155,7 @@ iret ijkGamepadIsButtonDownAgain(ijkGamepadState const* const gamepad, ijkGamepa
 //		return SUCCESS: ijk_true if button is consistently up
 //		return SUCCESS: ijk_false if button is not consistently up
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadIsButtonUpAgain(ijkGamepadState const* const gamepad, ijkGamepadBtn const button);
+ijk_inl iret ijkGamepadIsButtonUpAgain(ijkGamepadState const* const gamepad, ijkGamepadBtn const button);
 
 // ijkGamepadIsButtonPressed
 //	Check whether gamepad button changed from up to down.
@@ -165,7 +165,7 @@ iret ijkGamepadIsButtonUpAgain(ijkGamepadState const* const gamepad, ijkGamepadB
 //		return SUCCESS: ijk_true if button changed from up to down
 //		return SUCCESS: ijk_false if button did not change from up to down
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadIsButtonPressed(ijkGamepadState const* const gamepad, ijkGamepadBtn const button);
+ijk_inl iret ijkGamepadIsButtonPressed(ijkGamepadState const* const gamepad, ijkGamepadBtn const button);
 
 // ijkGamepadIsButtonReleased
 //	Check whether gamepad button changed from down to up.
@@ -175,7 +175,7 @@ iret ijkGamepadIsButtonPressed(ijkGamepadState const* const gamepad, ijkGamepadB
 //		return SUCCESS: ijk_true if button changed from down to up
 //		return SUCCESS: ijk_false if button did not change from down to up
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadIsButtonReleased(ijkGamepadState const* const gamepad, ijkGamepadBtn const button);
+ijk_inl iret ijkGamepadIsButtonReleased(ijkGamepadState const* const gamepad, ijkGamepadBtn const button);
 
 // ijkGamepadGetConnectionState
 //	Get the connection state of a gamepad.
@@ -186,7 +186,7 @@ iret ijkGamepadIsButtonReleased(ijkGamepadState const* const gamepad, ijkGamepad
 //			note: upon successful return, points to boolean (true is pressed)
 //		return SUCCESS: ijk_success if retrieved state
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadGetConnectionState(ijkGamepadState const* const gamepad, ibool state_out[1]);
+ijk_inl iret ijkGamepadGetConnectionState(ijkGamepadState const* const gamepad, ibool state_out[1]);
 
 // ijkGamepadIsConnected
 //	Check whether gamepad is connected.
@@ -195,7 +195,7 @@ iret ijkGamepadGetConnectionState(ijkGamepadState const* const gamepad, ibool st
 //		return SUCCESS: ijk_true if gamepad is connected
 //		return SUCCESS: ijk_false if gamepad is not connected
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadIsConnected(ijkGamepadState const* const gamepad);
+ijk_inl iret ijkGamepadIsConnected(ijkGamepadState const* const gamepad);
 
 // ijkGamepadIsNotConnected
 //	Check whether gamepad is not connected.
@@ -204,7 +204,7 @@ iret ijkGamepadIsConnected(ijkGamepadState const* const gamepad);
 //		return SUCCESS: ijk_true if gamepad is not connected
 //		return SUCCESS: ijk_false if gamepad is connected
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadIsNotConnected(ijkGamepadState const* const gamepad);
+ijk_inl iret ijkGamepadIsNotConnected(ijkGamepadState const* const gamepad);
 
 // ijkGamepadIsConnectedAgain
 //	Check whether gamepad is consistently connected between updates.
@@ -213,7 +213,7 @@ iret ijkGamepadIsNotConnected(ijkGamepadState const* const gamepad);
 //		return SUCCESS: ijk_true if gamepad is consistently connected
 //		return SUCCESS: ijk_false if gamepad is not consistently connected
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadIsConnectedAgain(ijkGamepadState const* const gamepad);
+ijk_inl iret ijkGamepadIsConnectedAgain(ijkGamepadState const* const gamepad);
 
 // ijkGamepadIsNotConnectedAgain
 //	Check whether gamepad is consistently not connected between updates.
@@ -222,7 +222,7 @@ iret ijkGamepadIsConnectedAgain(ijkGamepadState const* const gamepad);
 //		return SUCCESS: ijk_true if gamepad is consistently not connected
 //		return SUCCESS: ijk_false if gamepad is not consistently not connected
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadIsNotConnectedAgain(ijkGamepadState const* const gamepad);
+ijk_inl iret ijkGamepadIsNotConnectedAgain(ijkGamepadState const* const gamepad);
 
 // ijkGamepadReconnected
 //	Check whether gamepad reconnected since last update.
@@ -231,7 +231,7 @@ iret ijkGamepadIsNotConnectedAgain(ijkGamepadState const* const gamepad);
 //		return SUCCESS: ijk_true if gamepad changed to connected
 //		return SUCCESS: ijk_false if gamepad did not change to connected
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadReconnected(ijkGamepadState const* const gamepad);
+ijk_inl iret ijkGamepadReconnected(ijkGamepadState const* const gamepad);
 
 // ijkGamepadDisconnected
 //	Check whether gamepad disconnected since last update.
@@ -240,7 +240,7 @@ iret ijkGamepadReconnected(ijkGamepadState const* const gamepad);
 //		return SUCCESS: ijk_true if gamepad changed to not connected
 //		return SUCCESS: ijk_false if gamepad did not change to not connected
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadDisconnected(ijkGamepadState const* const gamepad);
+ijk_inl iret ijkGamepadDisconnected(ijkGamepadState const* const gamepad);
 
 // ijkGamepadGetTriggerLeft
 //	Get the left trigger as a unit value.
@@ -250,7 +250,7 @@ iret ijkGamepadDisconnected(ijkGamepadState const* const gamepad);
 //			valid: non-null
 //		return SUCCESS: ijk_success if retrieved value
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadGetTriggerLeft(ijkGamepadState const* const gamepad, dbl v_out[1]);
+ijk_inl iret ijkGamepadGetTriggerLeft(ijkGamepadState const* const gamepad, dbl v_out[1]);
 
 // ijkGamepadGetTriggerRight
 //	Get the right trigger as a unit value.
@@ -260,7 +260,7 @@ iret ijkGamepadGetTriggerLeft(ijkGamepadState const* const gamepad, dbl v_out[1]
 //			valid: non-null
 //		return SUCCESS: ijk_success if retrieved value
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadGetTriggerRight(ijkGamepadState const* const gamepad, dbl v_out[1]);
+ijk_inl iret ijkGamepadGetTriggerRight(ijkGamepadState const* const gamepad, dbl v_out[1]);
 
 // ijkGamepadGetTriggers
 //	Get both triggers as unit values.
@@ -272,7 +272,7 @@ iret ijkGamepadGetTriggerRight(ijkGamepadState const* const gamepad, dbl v_out[1
 //			valid: non-null
 //		return SUCCESS: ijk_success if retrieved value
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadGetTriggers(ijkGamepadState const* const gamepad, dbl vl_out[1], dbl vr_out[1]);
+ijk_inl iret ijkGamepadGetTriggers(ijkGamepadState const* const gamepad, dbl vl_out[1], dbl vr_out[1]);
 
 // ijkGamepadGetTriggerLeftChange
 //	Get the left trigger value difference from the previous state.
@@ -282,7 +282,7 @@ iret ijkGamepadGetTriggers(ijkGamepadState const* const gamepad, dbl vl_out[1],
 //			valid: non-null
 //		return SUCCESS: ijk_success if retrieved value
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadGetTriggerLeftChange(ijkGamepadState const* const gamepad, dbl dv_out[1]);
+ijk_inl iret ijkGamepadGetTriggerLeftChange(ijkGamepadState const* const gamepad, dbl dv_out[1]);
 
 // ijkGamepadGetTriggerRightChange
 //	Get the right trigger value difference from the previous state.
@@ -292,7 +292,7 @@ iret ijkGamepadGetTriggerLeftChange(ijkGamepadState const* const gamepad, dbl dv
 //			valid: non-null
 //		return SUCCESS: ijk_success if retrieved value
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadGetTriggerRightChange(ijkGamepadState const* const gamepad, dbl dv_out[1]);
+ijk_inl iret ijkGamepadGetTriggerRightChange(ijkGamepadState const* const gamepad, dbl dv_out[1]);
 
 // ijkGamepadGetTriggersChange
 //	Get both trigger value differences from the previous state.
@@ -304,7 +304,7 @@ iret ijkGamepadGetTriggerRightChange(ijkGamepadState const* const gamepad, dbl d
 //			valid: non-null
 //		return SUCCESS: ijk_success if retrieved value
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadGetTriggersChange(ijkGamepadState const* const gamepad, dbl dvl_out[1], dbl dvr_out[1]);
+ijk_inl iret ijkGamepadGetTriggersChange(ijkGamepadState const* const gamepad, dbl dvl_out[1], dbl dvr_out[1]);
 
 // ijkGamepadGetThumbstickLeft
 //	Get the left thumbstick as a unit direction vector.
@@ -314,7 +314,7 @@ iret ijkGamepadGetTriggersChange(ijkGamepadState const* const gamepad, dbl dvl_o
 //			valid: non-null
 //		return SUCCESS: ijk_success if retrieved value
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadGetThumbstickLeft(ijkGamepadState const* const gamepad, dbl v_out[2]);
+ijk_inl iret ijkGamepadGetThumbstickLeft(ijkGamepadState const* const gamepad, dbl v_out[2]);
 
 // ijkGamepadGetThumbstickRight
 //	Get the right thumbstick as a unit direction vector.
@@ -324,7 +324,7 @@ iret ijkGamepadGetThumbstickLeft(ijkGamepadState const* const gamepad, dbl v_out
 //			valid: non-null
 //		return SUCCESS: ijk_success if retrieved value
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadGetThumbstickRight(ijkGamepadState const* const gamepad, dbl v_out[2]);
+ijk_inl iret ijkGamepadGetThumbstickRight(ijkGamepadState const* const gamepad, dbl v_out[2]);
 
 // ijkGamepadGetThumbsticks
 //	Get both thumbsticks as unit direction vectors.
@@ -336,7 +336,7 @@ iret ijkGamepadGetThumbstickRight(ijkGamepadState const* const gamepad, dbl v_ou
 //			valid: non-null
 //		return SUCCESS: ijk_success if retrieved value
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadGetThumbsticks(ijkGamepadState const* const gamepad, dbl vl_out[2], dbl vr_out[2]);
+ijk_inl iret ijkGamepadGetThumbsticks(ijkGamepadState const* const gamepad, dbl vl_out[2], dbl vr_out[2]);
 
 // ijkGamepadGetThumbstickLeftChange
 //	Get the left thumbstick vector difference from the previous state.
@@ -346,7 +346,7 @@ iret ijkGamepadGetThumbsticks(ijkGamepadState const* const gamepad, dbl vl_out[2
 //			valid: non-null
 //		return SUCCESS: ijk_success if retrieved value
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadGetThumbstickLeftChange(ijkGamepadState const* const gamepad, dbl dv_out[2]);
+ijk_inl iret ijkGamepadGetThumbstickLeftChange(ijkGamepadState const* const gamepad, dbl dv_out[2]);
 
 // ijkGamepadGetThumbstickRightChange
 //	Get the right thumbstick vector difference from the previous state.
@@ -356,7 +356,7 @@ iret ijkGamepadGetThumbstickLeftChange(ijkGamepadState const* const gamepad, dbl
 //			valid: non-null
 //		return SUCCESS: ijk_success if retrieved value
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadGetThumbstickRightChange(ijkGamepadState const* const gamepad, dbl dv_out[2]);
+ijk_inl iret ijkGamepadGetThumbstickRightChange(ijkGamepadState const* const gamepad, dbl dv_out[2]);
 
 // ijkGamepadGetThumbsticksChange
 //	Get both thumbstick vector differences from the previous state.
@@ -368,7 +368,7 @@ iret ijkGamepadGetThumbstickRightChange(ijkGamepadState const* const gamepad, db
 //			valid: non-null
 //		return SUCCESS: ijk_success if retrieved value
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadGetThumbsticksChange(ijkGamepadState const* const gamepad, dbl dvl_out[2], dbl dvt_out[2]);
+ijk_inl iret ijkGamepadGetThumbsticksChange(ijkGamepadState const* const gamepad, dbl dvl_out[2], dbl dvt_out[2]);
 
 // ijkGamepadSetID
 //	Initialize gamepad given ID and update.
@@ -378,7 +378,7 @@ iret ijkGamepadGetThumbsticksChange(ijkGamepadState const* const gamepad, dbl dv
 //		return SUCCESS: ijk_success if ID set and state updated
 //		return FAILURE: ijk_fail_operationfail if state not updated
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadSetID(ijkGamepadState* const gamepad, ijkGamepadID const gamepadID);
+ijk_inl iret ijkGamepadSetID(ijkGamepadState* const gamepad, ijkGamepadID const gamepadID);
 
 // ijkGamepadSetRumble
 //	Set gamepad rumble motors.
@@ -406,7 +406,7 @@ iret ijkGamepadUpdate(ijkGamepadState* const gamepad);
 //			valid: non-null
 //		return SUCCESS: ijk_success if state reset
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkGamepadReset(ijkGamepadState* const gamepad);
+ijk_inl iret ijkGamepadReset(ijkGamepadState* const gamepad);
 
 
 //-----------------------------------------------------------------------------
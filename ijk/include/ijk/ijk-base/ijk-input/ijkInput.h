@@ -458,7 +458,7 @@ struct ijkKeyboardState
 //		param button: button enumerator
 //		return SUCCESS: ijk_success if retrieved state
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseGetButtonState(ijkMouseState const* const mouse, ibool state_out[1], ijkMouseBtn const button);
+ijk_inl iret ijkMouseGetButtonState(ijkMouseState const* const mouse, ibool state_out[1], ijkMouseBtn const button);
 
 // ijkMouseSetButtonState
 //	Set the current state of a mouse button.
@@ -468,7 +468,7 @@ iret ijkMouseGetButtonState(ijkMouseState const* const mouse, ibool state_out[1]
 //		param button: button enumerator
 //		return SUCCESS: ijk_success if set state
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseSetButtonState(ijkMouseState* const mouse, ibool const state, ijkMouseBtn const button);
+ijk_inl iret ijkMouseSetButtonState(ijkMouseState* const mouse, ibool const state, ijkMouseBtn const button);
 
 // ijkMouseIsButtonDown
 //	Check whether a mouse button is down.
@@ -478,7 +478,7 @@ iret ijkMouseSetButtonState(ijkMouseState* const mouse, ibool const state, ijkMo
 //		return SUCCESS: ijk_true if button is down
 //		return SUCCESS: ijk_false if button is up
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseIsButtonDown(ijkMouseState const* const mouse, ijkMouseBtn const button);
+ijk_inl iret ijkMouseIsButtonDown(ijkMouseState const* const mouse, ijkMouseBtn const button);
 
 // ijkMouseIsButtonUp
 //	Check whether a mouse button is up.
@@ -488,7 +488,7 @@ iret ijkMouseIsButtonDown(ijkMouseState const* const mouse, ijkMouseBtn const bu
 //		return SUCCESS: ijk_true if button is up
 //		return SUCCESS: ijk_false if button is down
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseIsButtonUp(ijkMouseState const* const mouse, ijkMouseBtn const button);
+ijk_inl iret ijkMouseIsButtonUp(ijkMouseState const* const mouse, ijkMouseBtn const button);
 
 // ijkMouseIsButtonDownAgain
 //	Check whether a mouse button is consistently down between updates.
@@ -498,7 +498,7 @@ iret ijkMouseIsButtonUp(ijkMouseState const* const mouse, ijkMouseBtn const butt
 //		return SUCCESS: ijk_true if button is consistently down
 //		return SUCCESS: ijk_false if button is not consistently down
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseIsButtonDownAgain(ijkMouseState const* const mouse, ijkMouseBtn const button);
+ijk_inl iret ijkMouseIsButtonDownAgain(ijkMouseState const* const mouse, ijkMouseBtn const button);
 
 // ijkMouseIsButtonUpAgain
 //	Check whether a mouse button is consistently up between updates.
@@ -508,7 +508,7 @@ iret ijkMouseIsButtonDownAgain(ijkMouseState const* const mouse, ijkMouseBtn con
 //		return SUCCESS: ijk_true if button is consistently up
 //		return SUCCESS: ijk_false if button is not consistently up
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseIsButtonUpAgain(ijkMouseState const* const mouse, ijkMouseBtn const button);
+ijk_inl iret ijkMouseIsButtonUpAgain(ijkMouseState const* const mouse, ijkMouseBtn const button);
 
 // ijkMouseIsButtonPressed
 //	Check whether a mouse button changed from up to down.
@@ -518,7 +518,7 @@ iret ijkMouseIsButtonUpAgain(ijkMouseState const* const mouse, ijkMouseBtn const
 //		return SUCCESS: ijk_true if button changed from up to down
 //		return SUCCESS: ijk_false if button did not change from up to down
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseIsButtonPressed(ijkMouseState const* const mouse, ijkMouseBtn const button);
+ijk_inl iret ijkMouseIsButtonPressed(ijkMouseState const* const mouse, ijkMouseBtn const button);
 
 // ijkMouseIsButtonReleased
 //	Check whether a mouse button changed from down to up.
@@ -528,7 +528,7 @@ iret ijkMouseIsButtonPressed(ijkMouseState const* const mouse, ijkMouseBtn const
 //		return SUCCESS: ijk_true if button changed from down to up
 //		return SUCCESS: ijk_false if button did not change from down to up
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseIsButtonReleased(ijkMouseState const* const mouse, ijkMouseBtn const button);
+ijk_inl iret ijkMouseIsButtonReleased(ijkMouseState const* const mouse, ijkMouseBtn const button);
 
 // ijkMouseGetWheelState
 //	Get the current state of the mouse wheel.
@@ -539,7 +539,7 @@ iret ijkMouseIsButtonReleased(ijkMouseState const* const mouse, ijkMouseBtn cons
 //			note: upon successful return, points to wheel state value
 //		return SUCCESS: ijk_success if retrieved state
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseGetWheelState(ijkMouseState const* const mouse, istate state_out[1]);
+ijk_inl iret ijkMouseGetWheelState(ijkMouseState const* const mouse, istate state_out[1]);
 
 // ijkMouseSetWheelState
 //	Set the current state of the mouse wheel.
@@ -548,7 +548,7 @@ iret ijkMouseGetWheelState(ijkMouseState const* const mouse, istate state_out[1]
 //		param state: wheel state to set
 //		return SUCCESS: ijk_success if set state
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseSetWheelState(ijkMouseState* const mouse, istate const state);
+ijk_inl iret ijkMouseSetWheelState(ijkMouseState* const mouse, istate const state);
 
 // ijkMouseGetWheelChange
 //	Get the change in the mouse wheel state.
@@ -559,7 +559,7 @@ iret ijkMouseSetWheelState(ijkMouseState* const mouse, istate const state);
 //			note: upon successful return, points to wheel change value
 //		return SUCCESS: ijk_success if retrieved state
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseGetWheelChange(ijkMouseState const* const mouse, istate state_out[1]);
+ijk_inl iret ijkMouseGetWheelChange(ijkMouseState const* const mouse, istate state_out[1]);
 
 // ijkMouseGetPos
 //	Get the current position of the cursor.
@@ -573,7 +573,7 @@ iret ijkMouseGetWheelChange(ijkMouseState const* const mouse, istate state_out[1
 //			note: [0, h) = [top, bottom)
 //		return SUCCESS: ijk_success if cursor position retrieved
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseGetPos(ijkMouseState const* const mouse, i32 x_out[1], i32 y_out[1]);
+ijk_inl iret ijkMouseGetPos(ijkMouseState const* const mouse, i32 x_out[1], i32 y_out[1]);
 
 // ijkMouseSetPos
 //	Set the current position of the cursor.
@@ -585,7 +585,7 @@ iret ijkMouseGetPos(ijkMouseState const* const mouse, i32 x_out[1], i32 y_out[1]
 //			note: [0, h) = [top, bottom)
 //		return SUCCESS: ijk_success if cursor position set
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseSetPos(ijkMouseState* const mouse, i32 const x, i32 const y);
+ijk_inl iret ijkMouseSetPos(ijkMouseState* const mouse, i32 const x, i32 const y);
 
 // ijkMouseGetPosChange
 //	Get the change in position of the cursor.
@@ -597,7 +597,7 @@ iret ijkMouseSetPos(ijkMouseState* const mouse, i32 const x, i32 const y);
 //			valid: non-null
 //		return SUCCESS: ijk_success if cursor position retrieved
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseGetPosChange(ijkMouseState const* const mouse, i32 dx_out[1], i32 dy_out[1]);
+ijk_inl iret ijkMouseGetPosChange(ijkMouseState const* const mouse, i32 dx_out[1], i32 dy_out[1]);
 
 // ijkMouseUpdate
 //	Copy the current state to the previous state.
@@ -605,7 +605,7 @@ iret ijkMouseGetPosChange(ijkMouseState const* const mouse, i32 dx_out[1], i32 d
 //			valid: non-null
 //		return SUCCESS: ijk_success if state updated
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseUpdate(ijkMouseState* const mouse);
+ijk_inl iret ijkMouseUpdate(ijkMouseState* const mouse);
 
 // ijkMouseReset
 //	Reset the current state.
@@ -613,7 +613,7 @@ iret ijkMouseUpdate(ijkMouseState* const mouse);
 //			valid: non-null
 //		return SUCCESS: ijk_success if state reset
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMouseReset(ijkMouseState* const mouse);
+ijk_inl iret ijkMouseReset(ijkMouseState* const mouse);
 
 
 //-----------------------------------------------------------------------------
@@ -628,7 +628,7 @@ iret ijkMouseReset(ijkMouseState* const mouse);
 //		param keyVirt: virtual key code
 //		return SUCCESS: ijk_success if retrieved state
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardGetKeyState(ijkKeyboardState const* const keyboard, ibool state_out[1], ijkKeyVirt const keyVirt);
+ijk_inl iret ijkKeyboardGetKeyState(ijkKeyboardState const* const keyboard, ibool state_out[1], ijkKeyVirt const keyVirt);
 
 // ijkKeyboardSetKeyState
 //	Set the current state of a virtual key.
@@ -638,7 +638,7 @@ iret ijkKeyboardGetKeyState(ijkKeyboardState const* const keyboard, ibool state_
 //		param keyVirt: virtual key code
 //		return SUCCESS: ijk_success if set state
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardSetKeyState(ijkKeyboardState* const keyboard, ibool const state, ijkKeyVirt const keyVirt);
+ijk_inl iret ijkKeyboardSetKeyState(ijkKeyboardState* const keyboard, ibool const state, ijkKeyVirt const keyVirt);
 
 // ijkKeyboardIsKeyDown
 //	Check whether key is down.
@@ -648,7 +648,7 @@ iret ijkKeyboardSetKeyState(ijkKeyboardState* const keyboard, ibool const state,
 //		return SUCCESS: ijk_true if key is down
 //		return SUCCESS: ijk_false if key is up
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardIsKeyDown(ijkKeyboardState const* const keyboard, ijkKeyVirt const keyVirt);
+ijk_inl iret ijkKeyboardIsKeyDown(ijkKeyboardState const* const keyboard, ijkKeyVirt const keyVirt);
 
 // ijkKeyboardIsKeyUp
 //	Check whether key is up.
@@ -658,7 +658,7 @@ iret ijkKeyboardIsKeyDown(ijkKeyboardState const* const keyboard, ijkKeyVirt con
 //		return SUCCESS: ijk_true if key is up
 //		return SUCCESS: ijk_false if key is down
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardIsKeyUp(ijkKeyboardState const* const keyboard, ijkKeyVirt const keyVirt);
+ijk_inl iret ijkKeyboardIsKeyUp(ijkKeyboardState const* const keyboard, ijkKeyVirt const keyVirt);
 
 // ijkKeyboardIsKeyDownAgain
 //	Check whether key is consistently down between updates.
@@ -668,7 +668,7 @@ iret ijkKeyboardIsKeyUp(ijkKeyboardState const* const keyboard, ijkKeyVirt const
 //		return SUCCESS: ijk_true if key is consistently down
 //		return SUCCESS: ijk_false if key is not consistently down
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardIsKeyDownAgain(ijkKeyboardState const* const keyboard, ijkKeyVirt const keyVirt);
+ijk_inl iret ijkKeyboardIsKeyDownAgain(ijkKeyboardState const* const keyboard, ijkKeyVirt const keyVirt);
 
 // ijkKeyboardIsKeyUpAgain
 //	Check whether key is consistently up between updates.
@@ -678,7 +678,7 @@ iret ijkKeyboardIsKeyDownAgain(ijkKeyboardState const* const keyboard, ijkKeyVir
 //		return SUCCESS: ijk_true if key is consistently up
 //		return SUCCESS: ijk_false if key is not consistently up
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardIsKeyUpAgain(ijkKeyboardState const* const keyboard, ijkKeyVirt const keyVirt);
+ijk_inl iret ijkKeyboardIsKeyUpAgain(ijkKeyboardState const* const keyboard, ijkKeyVirt const keyVirt);
 
 // ijkKeyboardIsKeyPressed
 //	Check whether key changed from up to down.
@@ -688,7 +688,7 @@ iret ijkKeyboardIsKeyUpAgain(ijkKeyboardState const* const keyboard, ijkKeyVirt
 //		return SUCCESS: ijk_true if key changed from up to down
 //		return SUCCESS: ijk_false if key did not change from up to down
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardIsKeyPressed(ijkKeyboardState const* const keyboard, ijkKeyVirt const keyVirt);
+ijk_inl iret ijkKeyboardIsKeyPressed(ijkKeyboardState const* const keyboard, ijkKeyVirt const keyVirt);
 
 // ijkKeyboardIsKeyReleased
 //	Check whether key changed from down to up.
@@ -698,7 +698,7 @@ iret ijkKeyboardIsKeyPressed(ijkKeyboardState const* const keyboard, ijkKeyVirt
 //		return SUCCESS: ijk_true if key changed from down to up
 //		return SUCCESS: ijk_false if key did not change from down to up
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardIsKeyReleased(ijkKeyboardState const* const keyboard, ijkKeyVirt const keyVirt);
+ijk_inl iret ijkKeyboardIsKeyReleased(ijkKeyboardState const* const keyboard, ijkKeyVirt const keyVirt);
 
 // ijkKeyboardGetKeyCharState
 //	Get the current state of a character/ASCII key.
@@ -711,7 +711,7 @@ iret ijkKeyboardIsKeyReleased(ijkKeyboardState const* const keyboard, ijkKeyVirt
 //			valid: non-negative
 //		return SUCCESS: ijk_success if retrieved state
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardGetKeyCharState(ijkKeyboardState const* const keyboard, ibool state_out[1], sbyte const keyChar);
+ijk_inl iret ijkKeyboardGetKeyCharState(ijkKeyboardState const* const keyboard, ibool state_out[1], sbyte const keyChar);
 
 // ijkKeyboardSetKeyCharState
 //	Set the current state of a character/ASCII key.
@@ -722,7 +722,7 @@ iret ijkKeyboardGetKeyCharState(ijkKeyboardState const* const keyboard, ibool st
 //			valid: non-negative
 //		return SUCCESS: ijk_success if set state
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardSetKeyCharState(ijkKeyboardState* const keyboard, ibool const state, sbyte const keyChar);
+ijk_inl iret ijkKeyboardSetKeyCharState(ijkKeyboardState* const keyboard, ibool const state, sbyte const keyChar);
 
 // ijkKeyboardIsKeyCharDown
 //	Check whether character key is down.
@@ -733,7 +733,7 @@ iret ijkKeyboardSetKeyCharState(ijkKeyboardState* const keyboard, ibool const st
 //		return SUCCESS: ijk_true if key is down
 //		return SUCCESS: ijk_false if key is up
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardIsKeyCharDown(ijkKeyboardState const* const keyboard, sbyte const keyChar);
+ijk_inl iret ijkKeyboardIsKeyCharDown(ijkKeyboardState const* const keyboard, sbyte const keyChar);
 
 // ijkKeyboardIsKeyCharUp
 //	Check whether character key is up.
@@ -744,7 +744,7 @@ iret ijkKeyboardIsKeyCharDown(ijkKeyboardState const* const keyboard, sbyte cons
 //		return SUCCESS: ijk_true if key is up
 //		return SUCCESS: ijk_false if key is down
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardIsKeyCharUp(ijkKeyboardState const* const keyboard, sbyte const keyChar);
+ijk_inl iret ijkKeyboardIsKeyCharUp(ijkKeyboardState const* const keyboard, sbyte const keyChar);
 
 // ijkKeyboardIsKeyCharDownAgain
 //	Check whether character key is consistently down between updates.
@@ -755,7 +755,7 @@ iret ijkKeyboardIsKeyCharUp(ijkKeyboardState const* const keyboard, sbyte const
 //		return SUCCESS: ijk_true if key is consistently down
 //		return SUCCESS: ijk_false if key is not consistently down
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardIsKeyCharDownAgain(ijkKeyboardState const* const keyboard, sbyte const keyChar);
+ijk_inl iret ijkKeyboardIsKeyCharDownAgain(ijkKeyboardState const* const keyboard, sbyte const keyChar);
 
 // ijkKeyboardIsKeyCharUpAgain
 //	Check whether character key is consistently up between updates.
@@ -766,7 +766,7 @@ iret ijkKeyboardIsKeyCharDownAgain(ijkKeyboardState const* const keyboard, sbyte
 //		return SUCCESS: ijk_true if key is consistently up
 //		return SUCCESS: ijk_false if key is not consistently up
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardIsKeyCharUpAgain(ijkKeyboardState const* const keyboard, sbyte const keyChar);
+ijk_inl iret ijkKeyboardIsKeyCharUpAgain(ijkKeyboardState const* const keyboard, sbyte const keyChar);
 
 // ijkKeyboardIsKeyCharPressed
 //	Check whether character key changed from up to down.
@@ -777,7 +777,7 @@ iret ijkKeyboardIsKeyCharUpAgain(ijkKeyboardState const* const keyboard, sbyte c
 //		return SUCCESS: ijk_true if key changed from up to down
 //		return SUCCESS: ijk_false if key did not change from up to down
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardIsKeyCharPressed(ijkKeyboardState const* const keyboard, sbyte const keyChar);
+ijk_inl iret ijkKeyboardIsKeyCharPressed(ijkKeyboardState const* const keyboard, sbyte const keyChar);
 
 // ijkKeyboardIsKeyCharReleased
 //	Check whether character key changed from down to up.
@@ -788,7 +788,7 @@ iret ijkKeyboardIsKeyCharPressed(ijkKeyboardState const* const keyboard, sbyte c
 //		return SUCCESS: ijk_true if key changed from down to up
 //		return SUCCESS: ijk_false if key did not change from down to up
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardIsKeyCharReleased(ijkKeyboardState const* const keyboard, sbyte const keyChar);
+ijk_inl iret ijkKeyboardIsKeyCharReleased(ijkKeyboardState const* const keyboard, sbyte const keyChar);
 
 // ijkKeyboardUpdate
 //	Copy the current state to the previous state.
@@ -796,7 +796,7 @@ iret ijkKeyboardIsKeyCharReleased(ijkKeyboardState const* const keyboard, sbyte
 //			valid: non-null
 //		return SUCCESS: ijk_success if state updated
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardUpdate(ijkKeyboardState* const keyboard);
+ijk_inl iret ijkKeyboardUpdate(ijkKeyboardState* const keyboard);
 
 // ijkKeyboardReset
 //	Reset the current state.
@@ -804,7 +804,7 @@ iret ijkKeyboardUpdate(ijkKeyboardState* const keyboard);
 //			valid: non-null
 //		return SUCCESS: ijk_success if state reset
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkKeyboardReset(ijkKeyboardState* const keyboard);
+ijk_inl iret ijkKeyboardReset(ijkKeyboardState* const keyboard);
 
 
 //-----------------------------------------------------------------------------
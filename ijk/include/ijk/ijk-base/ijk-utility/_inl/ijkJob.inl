@@ -0,0 +1,47 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkJob.inl
+	Job system inline implementation.
+*/
+
+#ifdef _IJK_JOB_H_
+#ifndef _IJK_JOB_INL_
+#define _IJK_JOB_INL_
+
+
+//-----------------------------------------------------------------------------
+
+ijk_inl iret ijkJobCounterIsDone(ijkJobCounter const* const counter)
+{
+	if (counter)
+	{
+		return (ijkAtomicLoad(&counter->count) == 0);
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+#endif	// !_IJK_JOB_INL_
+#endif	// _IJK_JOB_H_
\ No newline at end of file
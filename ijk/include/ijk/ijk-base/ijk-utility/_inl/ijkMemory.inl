@@ -34,7 +34,13 @@
 ///
 #define ijk_memory_set(dst, end, value)		while (dst < end) (*(dst++) = value)
 #define ijk_memory_copy(dst, src, end)		while (dst < end) (*(dst++) = *(src++))
-#define ijk_memory_compare(dst, src, end)	while (dst < end) if (*(dst) == *(src++)) (++dst); else break
+#define ijk_memory_compare(dst, src, end)	while (dst < end) if (*(dst) == *(src)) (++dst, ++src); else break
+#define ijk_memory_aligned(p)				(((uitr)(p) & (szchomp - 1)) == 0)
+#define ijk_memory_align(dst, end, op)		while (dst < end && !ijk_memory_aligned(dst)) op
+
+// size in bytes at which operations are handed to vector implementations; 
+//	smaller blocks (e.g. tags) are done here without a call
+#define ijk_memory_wide						128
 
 
 //-----------------------------------------------------------------------------
@@ -43,14 +49,22 @@ ijk_inl ptr ijkMemorySet(ptr const dst, size const sz_bytes, byte const value)
 {
 	if (dst && sz_bytes)
 	{
-		byte const value2chomp[szqword] = { value, value, value, value, value, value, value, value };
-		chomp const value_chomp = *((pchomp)value2chomp);
-		pchomp dst_chomp = (pchomp)dst;
+		chomp const value_chomp = (chomp)value * ((chomp)(-1) / 0xFF);
+		pchomp dst_chomp;
 		pbyte dst_byte = (pbyte)dst;
-		kpchomp const end_chomp = dst_chomp + sz_bytes / szchomp;
+		kpchomp end_chomp;
 		kpbyte const end_byte = dst_byte + sz_bytes;
 
+		// large blocks
+		if (sz_bytes >= ijk_memory_wide)
+			return ijkMemorySetWide(dst, sz_bytes, value_chomp);
+
+		// set bytes until destination is aligned to an integer
+		ijk_memory_align(dst_byte, end_byte, *(dst_byte++) = value);
+
 		// set integers until the last integer can fit
+		dst_chomp = (pchomp)dst_byte;
+		end_chomp = dst_chomp + (size)(end_byte - dst_byte) / szchomp;
 		ijk_memory_set(dst_chomp, end_chomp, value_chomp);
 
 		// set the remaining bytes
@@ -74,19 +88,32 @@ ijk_inl ptr ijkMemoryCopy(ptr const dst, kptr const src, size const sz_bytes)
 {
 	if (dst && src && sz_bytes)
 	{
-		pchomp dst_chomp = (pchomp)dst;
-		kpchomp src_chomp = (pchomp)src;
+		pchomp dst_chomp;
+		kpchomp src_chomp;
 		pbyte dst_byte = (pbyte)dst;
 		kpbyte src_byte = (pbyte)src;
-		kpchomp const end_chomp = dst_chomp + sz_bytes / szchomp;
+		kpchomp end_chomp;
 		kpbyte const end_byte = dst_byte + sz_bytes;
 
-		// copy integers until the last integer can fit
-		ijk_memory_copy(dst_chomp, src_chomp, end_chomp);
+		// large blocks
+		if (sz_bytes >= ijk_memory_wide)
+			return ijkMemoryCopyWide(dst, src, sz_bytes);
+
+		// copy bytes until destination is aligned to an integer; integers 
+		//	are only moved if that aligns source too
+		ijk_memory_align(dst_byte, end_byte, *(dst_byte++) = *(src_byte++));
+		if (ijk_memory_aligned(src_byte))
+		{
+			// copy integers until the last integer can fit
+			dst_chomp = (pchomp)dst_byte;
+			src_chomp = (kpchomp)src_byte;
+			end_chomp = dst_chomp + (size)(end_byte - dst_byte) / szchomp;
+			ijk_memory_copy(dst_chomp, src_chomp, end_chomp);
+			dst_byte = (pbyte)dst_chomp;
+			src_byte = (kpbyte)src_chomp;
+		}
 
 		// copy the remaining bytes
-		dst_byte = (pbyte)dst_chomp;
-		src_byte = (pbyte)src_chomp;
 		ijk_memory_copy(dst_byte, src_byte, end_byte);
 
 		// done
@@ -100,19 +127,32 @@ ijk_inl ptrdiff ijkMemoryCompare(kptr const dst, kptr const src, size const sz_b
 {
 	if (dst && src && sz_bytes)
 	{
-		kpchomp dst_chomp = (pchomp)dst;
-		kpchomp src_chomp = (pchomp)src;
+		kpchomp dst_chomp;
+		kpchomp src_chomp;
 		kpbyte dst_byte = (pbyte)dst, base = dst_byte;
 		kpbyte src_byte = (pbyte)src;
-		kpchomp const end_chomp = dst_chomp + sz_bytes / szchomp;
+		kpchomp end_chomp;
 		kpbyte const end_byte = dst_byte + sz_bytes;
 
-		// compare integers until the last integer can be compared
-		ijk_memory_compare(dst_chomp, src_chomp, end_chomp);
+		// large blocks
+		if (sz_bytes >= ijk_memory_wide)
+			return ijkMemoryCompareWide(dst, src, sz_bytes);
+
+		// compare bytes until destination is aligned to an integer; 
+		//	integers are only compared if that aligns source too
+		ijk_memory_align(dst_byte, end_byte, if (*(dst_byte) == *(src_byte)) (++dst_byte, ++src_byte); else break);
+		if (ijk_memory_aligned(src_byte) && ijk_memory_aligned(dst_byte))
+		{
+			// compare integers until the last integer can be compared
+			dst_chomp = (kpchomp)dst_byte;
+			src_chomp = (kpchomp)src_byte;
+			end_chomp = dst_chomp + (size)(end_byte - dst_byte) / szchomp;
+			ijk_memory_compare(dst_chomp, src_chomp, end_chomp);
+			dst_byte = (kpbyte)dst_chomp;
+			src_byte = (kpbyte)src_chomp;
+		}
 
 		// compare the remaining bytes
-		dst_byte = (pbyte)dst_chomp;
-		src_byte = (pbyte)src_chomp;
 		ijk_memory_compare(dst_byte, src_byte, end_byte);
 
 		// done
@@ -128,6 +168,8 @@ ijk_inl ptr ijkMemorySetC(ptr const dst, size const sz_chomps, chomp const value
 	{
 		pchomp dst_chomp = (pchomp)dst;
 		kpchomp const end_chomp = dst_chomp + sz_chomps;
+		if (sz_chomps >= ijk_memory_wide / szchomp)
+			return ijkMemorySetWide(dst, sz_chomps * szchomp, value);
 		ijk_memory_set(dst_chomp, end_chomp, value);
 
 		// done
@@ -150,6 +192,8 @@ ijk_inl ptr ijkMemoryCopyC(ptr const dst, kptr const src, size const sz_chomps)
 		pchomp dst_chomp = (pchomp)dst;
 		kpchomp src_chomp = (pchomp)src;
 		kpchomp const end_chomp = dst_chomp + sz_chomps;
+		if (sz_chomps >= ijk_memory_wide / szchomp)
+			return ijkMemoryCopyWide(dst, src, sz_chomps * szchomp);
 		ijk_memory_copy(dst_chomp, src_chomp, end_chomp);
 
 		// done
@@ -166,6 +210,8 @@ ijk_inl ptrdiff ijkMemoryCompareC(kptr const dst, kptr const src, size const sz_
 		kpchomp dst_chomp = (pchomp)dst, base = dst_chomp;
 		kpchomp src_chomp = (pchomp)src;
 		kpchomp const end_chomp = dst_chomp + sz_chomps;
+		if (sz_chomps >= ijk_memory_wide / szchomp)
+			return (ijkMemoryCompareWide(dst, src, sz_chomps * szchomp) / szchomp);
 		ijk_memory_compare(dst_chomp, src_chomp, end_chomp);
 
 		// done
@@ -35,7 +35,7 @@ ijk_inl iret ijkStreamGetOffset(ijkStream const* const stream, size* const offse
 	if (stream && offset_out &&
 		stream->base)
 	{
-		*offset_out = (stream->isFile ? stream->length : (stream->head - stream->base));
+		*offset_out = (stream->isBuffered ? (stream->position + (size)(stream->head - stream->base)) : stream->isFile ? stream->length : (size)(stream->head - stream->base));
 		return ijk_success;
 	}
 	return ijk_fail_invalidparams;
@@ -45,10 +45,12 @@ ijk_inl iret ijkStreamGetOffset(ijkStream const* const stream, size* const offse
 ijk_inl iret ijkStreamBufferReset(ijkStream* const stream, ibool const readMode)
 {
 	if (stream &&
-		stream->base && ijk_isfalse(stream->isFile))
+		stream->base && ijk_isfalse(stream->isFile) && (readMode || ijk_isfalse(stream->isMapped)))
 	{
 		stream->head = stream->base;
 		stream->isRead = readMode;
+		if (stream->isGrowable && !readMode)
+			stream->length = 0;
 		return ijk_success;
 	}
 	return ijk_fail_invalidparams;
@@ -0,0 +1,183 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkBenchmark.h
+	Statistical benchmark interface.
+*/
+
+#ifndef _IJK_BENCHMARK_H_
+#define _IJK_BENCHMARK_H_
+
+
+#include "ijkStream.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#else	// !__cplusplus
+typedef enum		ijkBenchmarkFormat	ijkBenchmarkFormat;
+typedef struct		ijkBenchmarkResult	ijkBenchmarkResult;
+typedef struct		ijkBenchmark		ijkBenchmark;
+#endif	// __cplusplus
+
+
+//-----------------------------------------------------------------------------
+
+// ijkBenchmarkFunc
+//	Kernel function type for benchmark interface. Any function taking a 
+//	pointer parameter (any type) and an iteration count qualifies; it runs 
+//	the operation measured that many times, and should store its results 
+//	where the compiler cannot discard them (e.g. through the argument).
+//		param benchArg: pointer representing data to be passed to the function
+//		param iterations: number of times to run the operation
+typedef void(*ijkBenchmarkFunc)(ptr const benchArg, size const iterations);
+
+
+// ijkBenchmarkFormat
+//	Enumeration of output formats; times are in nanoseconds per iteration. 
+//		json: object with "context" (settings) and "benchmarks" (one object 
+//			per result) members
+//		csv: header row, then one row per result
+enum ijkBenchmarkFormat
+{
+	ijkBenchmarkFormat_json,
+	ijkBenchmarkFormat_csv,
+};
+
+
+// ijkBenchmarkResult
+//	Timing statistics of one kernel, in nanoseconds per iteration.
+//		member name: name of kernel
+//		member iterations: iterations per sample
+//		member sampleCount: number of samples
+//		member min, max: fastest and slowest samples
+//		member p10, median, p90, p99: percentiles of samples
+//		member mean, stddev: mean and standard deviation of samples
+struct ijkBenchmarkResult
+{
+	tag name;							// name
+	qword iterations;					// iterations per sample
+	size sampleCount;					// number of samples
+	dbl min, max;						// extremes
+	dbl p10, median, p90, p99;			// percentiles
+	dbl mean, stddev;					// moments
+};
+
+
+// ijkBenchmark
+//	Benchmark descriptor; times kernels and collects their results. Each 
+//	kernel is first calibrated: its iteration count grows until one call 
+//	takes the sample time, which amortizes the clock reads and the call. 
+//	Then it runs for the warmup time unmeasured, to settle caches, branch 
+//	predictors and clock speed, and then once per sample, measured.
+//		member result: results in order of runs
+//		member resultCount: number of results
+//		member resultMax: maximum number of results
+//		member sample: storage for samples of the current run
+//		member sampleCount: number of samples per kernel
+//		member warmupTime: unmeasured running time per kernel, in seconds
+//		member sampleTime: shortest time per sample, in seconds
+//		member rate: internal clock rate
+struct ijkBenchmark
+{
+	ijkBenchmarkResult* result;			// results
+	size resultCount, resultMax;		// number of results
+	dbl* sample;						// sample storage
+	size sampleCount;					// samples per kernel
+	dbl warmupTime, sampleTime;			// durations
+	qword rate[1];						// internal measurement
+};
+
+
+//-----------------------------------------------------------------------------
+
+// ijkBenchmarkCreate
+//	Initialize benchmark given pre-allocated (stack, heap or pool block) 
+//	memory, divided into sample storage and results.
+//		param bench_out: pointer to benchmark descriptor
+//			valid: non-null, uninitialized
+//		param bench_base: base pointer to pre-allocated block
+//			valid: non-null
+//		param baseSize: size of base block (pre-allocated) in bytes
+//			valid: non-zero
+//			note: samples take 8 bytes each, results the rest
+//		param sampleCount: number of samples per kernel
+//			valid: non-zero
+//			note: at least 100 for a meaningful 99th percentile
+//		param warmupTime: unmeasured running time per kernel, in seconds
+//			valid: non-negative
+//		param sampleTime: shortest time per sample, in seconds
+//			valid: positive
+//			note: long enough that clock resolution does not matter, short 
+//				enough that interruptions land in few samples (e.g. 0.001)
+//		return SUCCESS: ijk_success if benchmark initialized
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if block too small for 
+//			samples and one result
+iret ijkBenchmarkCreate(ijkBenchmark* const bench_out, ptr const bench_base, size const baseSize, size const sampleCount, dbl const warmupTime, dbl const sampleTime);
+
+// ijkBenchmarkRelease
+//	Release benchmark, leaving the contained memory unaffected.
+//		param bench: pointer to benchmark descriptor
+//			valid: non-null, initialized
+//		return SUCCESS: ijk_success if benchmark released
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkBenchmarkRelease(ijkBenchmark* const bench);
+
+// ijkBenchmarkRun
+//	Calibrate, warm up and sample kernel, and add its result.
+//		param bench: pointer to benchmark descriptor
+//			valid: non-null, initialized
+//		param name: c-string naming kernel
+//			valid: non-null
+//			note: copied; clamped to the size of a tag
+//		param func: kernel function
+//			valid: non-null
+//		param arg: argument pointer to pass to function
+//		param result_out_opt: optional pointer to storage for result pointer
+//		return SUCCESS: ijk_success if kernel measured
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if results are full
+iret ijkBenchmarkRun(ijkBenchmark* const bench, kcstr const name, ijkBenchmarkFunc const func, ptr const arg, ijkBenchmarkResult const** const result_out_opt);
+
+// ijkBenchmarkWrite
+//	Write all results to stream.
+//		param bench: pointer to benchmark descriptor
+//			valid: non-null, initialized
+//		param stream: pointer to stream descriptor
+//			valid: non-null, initialized, read flag disabled
+//		param format: output format
+//			valid: ijkBenchmarkFormat enumerator
+//		return SUCCESS: ijk_success if results written
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if stream write failed
+iret ijkBenchmarkWrite(ijkBenchmark const* const bench, ijkStream* const stream, ijkBenchmarkFormat const format);
+
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef __cplusplus
+}
+#endif	// __cplusplus
+
+
+#endif	// !_IJK_BENCHMARK_H_
\ No newline at end of file
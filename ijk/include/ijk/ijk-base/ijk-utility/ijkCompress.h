@@ -0,0 +1,245 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkCompress.h
+	Compressed block stream interface.
+*/
+
+#ifndef _IJK_COMPRESS_H_
+#define _IJK_COMPRESS_H_
+
+
+#include "ijkStream.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#else	// !__cplusplus
+typedef enum		ijkCompressCodec	ijkCompressCodec;
+typedef struct		ijkCompressStream	ijkCompressStream;
+#endif	// __cplusplus
+
+
+//-----------------------------------------------------------------------------
+
+// ijkCompressCodec
+//	Enumeration of block codecs. 
+//		store: blocks are stored as they are 
+//		lz: bundled LZ codec in LZ4 block format; fast to compress, 
+//			decompresses at memory speed
+//		zstd: zstd at its default level; smaller, slower to compress, only 
+//			available if built with __ijk_cfg_zstd
+enum ijkCompressCodec
+{
+	ijkCompressCodec_store,
+	ijkCompressCodec_lz,
+	ijkCompressCodec_zstd,
+};
+
+
+// ijkCompressStream
+//	Compressed stream descriptor; a layer over a stream that compresses the 
+//	bytes written to it in fixed-size blocks, and decompresses them again 
+//	when read. A block that does not shrink is stored as it is. An index of 
+//	blocks follows the last block, so a reader can seek to any offset and 
+//	decompress only the block holding it. The compressed stream starts 
+//	wherever the underlying stream's head is, so it may be embedded in 
+//	other contents.
+//		member stream: underlying stream
+//		member block: contents of current block
+//		member packed: compressed contents of current block
+//		member index: internal block index
+//		member blockSize: uncompressed size of all blocks but the last
+//		member blockCount: number of blocks in index
+//		member blockMax: number of blocks index can hold
+//		member current: index of block held (reading)
+//		member fill: bytes held in block
+//		member length: uncompressed length of contents
+//		member position: uncompressed offset of head
+//		member base: offset of compressed stream in underlying stream
+//		member codec: codec of blocks (writing)
+//		member isRead: flag whether stream is used for reading
+struct ijkCompressStream
+{
+	ijkStream* stream;					// underlying stream
+	pbyte block;						// block contents
+	pbyte packed;						// compressed block contents
+	ptr index;							// internal block index
+	size blockSize;						// block size
+	size blockCount, blockMax;			// number of blocks
+	size current;						// block held
+	size fill;							// bytes in block
+	size length;						// uncompressed length
+	size position;						// uncompressed head
+	size base;							// offset in underlying stream
+	ijkCompressCodec codec;				// block codec
+	ibool isRead;						// read flag
+};
+
+
+//-----------------------------------------------------------------------------
+
+// ijkCompressBlockEncode
+//	Compress a block of bytes.
+//		param codec: codec to use
+//			valid: ijkCompressCodec enumerator, zstd only if available
+//		param dst: pointer to storage for compressed bytes
+//			valid: non-null
+//		param dstCapacity: size of storage in bytes
+//			note: pass less than source size to only accept a block that 
+//				shrinks
+//		param src: pointer to bytes to compress
+//			valid: non-null
+//		param srcSize: number of bytes to compress
+//			valid: non-zero
+//		param dstSize_out: pointer to storage for compressed size
+//			valid: non-null
+//		return SUCCESS: ijk_success if block compressed
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if compressed block does not 
+//			fit storage
+iret ijkCompressBlockEncode(ijkCompressCodec const codec, ptr const dst, size const dstCapacity, kptr const src, size const srcSize, size* const dstSize_out);
+
+// ijkCompressBlockDecode
+//	Decompress a block of bytes; corrupt input is detected and never reads 
+//	or writes out of bounds.
+//		param codec: codec block was compressed with
+//			valid: ijkCompressCodec enumerator, zstd only if available
+//		param dst: pointer to storage for decompressed bytes
+//			valid: non-null
+//		param dstCapacity: size of storage in bytes
+//			valid: non-zero
+//		param src: pointer to compressed bytes
+//			valid: non-null
+//		param srcSize: number of compressed bytes
+//			valid: non-zero
+//		param dstSize_out: pointer to storage for decompressed size
+//			valid: non-null
+//		return SUCCESS: ijk_success if block decompressed
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if block is corrupt or does 
+//			not fit storage
+iret ijkCompressBlockDecode(ijkCompressCodec const codec, ptr const dst, size const dstCapacity, kptr const src, size const srcSize, size* const dstSize_out);
+
+
+//-----------------------------------------------------------------------------
+
+// ijkCompressStreamCreateWriter
+//	Start compressed stream at head of stream for writing.
+//		param cstream_out: pointer to compressed stream descriptor
+//			valid: non-null, uninitialized
+//		param stream: pointer to underlying stream descriptor
+//			valid: non-null, initialized, read flag disabled
+//			note: must stay open until compressed stream is released
+//		param codec: codec of blocks
+//			valid: ijkCompressCodec enumerator, zstd only if available
+//		param blockSize: uncompressed size of blocks
+//			valid: non-zero, at most 16 MiB
+//			note: larger blocks compress better, smaller ones cost less per 
+//				random access (e.g. 64 KiB)
+//		return SUCCESS: ijk_success if compressed stream started
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if buffers not allocated or 
+//			header not written
+iret ijkCompressStreamCreateWriter(ijkCompressStream* const cstream_out, ijkStream* const stream, ijkCompressCodec const codec, size const blockSize);
+
+// ijkCompressStreamCreateReader
+//	Open compressed stream at head of stream for reading; reads its header 
+//	and block index.
+//		param cstream_out: pointer to compressed stream descriptor
+//			valid: non-null, uninitialized
+//		param stream: pointer to underlying stream descriptor
+//			valid: non-null, initialized, read flag enabled
+//			note: must stay open until compressed stream is released
+//			note: blocks of buffer and mapped streams are decompressed 
+//				straight from their contents
+//		return SUCCESS: ijk_success if compressed stream opened
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if header or index is 
+//			missing or corrupt, or buffers not allocated
+iret ijkCompressStreamCreateReader(ijkCompressStream* const cstream_out, ijkStream* const stream);
+
+// ijkCompressStreamRelease
+//	Release compressed stream. Writers compress the last block and write 
+//	the block index and header, leaving the underlying head after the index.
+//		param cstream: pointer to compressed stream descriptor
+//			valid: non-null, initialized
+//		return SUCCESS: ijk_success if compressed stream released
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if last block, index or 
+//			header not written (compressed stream is released)
+iret ijkCompressStreamRelease(ijkCompressStream* const cstream);
+
+// ijkCompressStreamRead
+//	Read uncompressed bytes from compressed stream.
+//		param cstream: pointer to compressed stream descriptor
+//			valid: non-null, initialized, read flag enabled
+//		param data: pointer to storage for bytes
+//			valid: non-null
+//		param byteCount: number of bytes to read
+//			valid: non-zero
+//		param bytes_opt: optional pointer to value holding number of bytes 
+//			read; used for caller validation
+//		return SUCCESS: ijk_success if read expected number of bytes
+//		return WARNING: ijk_warn_stream_incomplete if did not read all bytes
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if nothing read (end of 
+//			contents, or block is corrupt)
+iret ijkCompressStreamRead(ijkCompressStream* const cstream, ptr const data, size const byteCount, size* const bytes_opt);
+
+// ijkCompressStreamWrite
+//	Write uncompressed bytes to compressed stream; each block is compressed 
+//	and written through as it fills.
+//		param cstream: pointer to compressed stream descriptor
+//			valid: non-null, initialized, read flag disabled
+//		param data: pointer to constant bytes
+//			valid: non-null
+//		param byteCount: number of bytes to write
+//			valid: non-zero
+//		param bytes_opt: optional pointer to value holding number of bytes 
+//			written; used for caller validation
+//		return SUCCESS: ijk_success if wrote expected number of bytes
+//		return WARNING: ijk_warn_stream_incomplete if did not write all bytes
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if nothing written
+iret ijkCompressStreamWrite(ijkCompressStream* const cstream, kptr const data, size const byteCount, size* const bytes_opt);
+
+// ijkCompressStreamSeek
+//	Move head to uncompressed offset; the block holding it is decompressed 
+//	on the next read.
+//		param cstream: pointer to compressed stream descriptor
+//			valid: non-null, initialized, read flag enabled
+//		param offset: uncompressed byte offset
+//			valid: no greater than uncompressed length
+//		return SUCCESS: ijk_success if head moved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkCompressStreamSeek(ijkCompressStream* const cstream, size const offset);
+
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef __cplusplus
+}
+#endif	// __cplusplus
+
+
+#endif	// !_IJK_COMPRESS_H_
\ No newline at end of file
@@ -0,0 +1,150 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkFiber.h
+	Fiber (user-mode context) interface.
+*/
+
+#ifndef _IJK_FIBER_H_
+#define _IJK_FIBER_H_
+
+
+#include "ijkThread.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#else	// !__cplusplus
+typedef struct		ijkFiber			ijkFiber;
+#endif	// __cplusplus
+
+
+//-----------------------------------------------------------------------------
+
+// ijkFiberEntryFunc
+//	Entry function type for fiber interface; same signature as thread entry 
+//	function.
+//		param entryArg: pointer representing data to be passed to the function
+//		return: any integer
+typedef ijkThreadEntryFunc ijkFiberEntryFunc;
+
+
+// ijkFiber
+//	Fiber descriptor; a fiber is an execution context with its own stack, 
+//	run cooperatively by switching to it from the running fiber of a thread. 
+//	Switching saves only the registers a function call preserves, so it 
+//	costs about as much as a call, with no system call. A fiber runs on 
+//	whichever thread switches to it; a thread must be converted to a fiber 
+//	before it can switch.
+//		member handle: internal context handles, not platform-specific
+//		member stack: base of stack allocation; null for converted thread
+//		member stackSize: size of stack allocation in bytes
+//		member entryFunc: function to call when fiber first runs
+//		member entryArg: argument pointer to pass to entry function
+//		member caller: fiber that last switched to this one, and to which 
+//			it switches back when entry function returns
+//		member result: integer return value from entry function
+//		member active: boolean flag describing whether entry function has 
+//			not yet returned
+//		member thread: boolean flag describing whether fiber was converted 
+//			from a thread (and must be reverted on the same thread)
+struct ijkFiber
+{
+	ptr handle[2];					// internal context
+	ptr stack;						// stack allocation
+	size stackSize;					// stack size
+	ijkFiberEntryFunc entryFunc;	// entry function
+	ptr entryArg;					// entry argument
+	ijkFiber* caller;				// fiber to return to
+	iret result;					// return value from entry function
+	ibool active;					// whether entry has not returned
+	ibool thread;					// whether converted from thread
+};
+
+
+//-----------------------------------------------------------------------------
+
+// ijkFiberConvertThread
+//	Convert calling thread to a fiber so it can switch to other fibers.
+//		param fiber_out: pointer to fiber descriptor representing thread
+//			valid: non-null, inactive
+//		return SUCCESS: ijk_success if thread converted
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if not converted
+iret ijkFiberConvertThread(ijkFiber* const fiber_out);
+
+// ijkFiberRevertThread
+//	Revert calling thread from a fiber.
+//		param fiber: pointer to fiber descriptor representing thread
+//			valid: non-null, converted on calling thread, currently running
+//		return SUCCESS: ijk_success if thread reverted
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkFiberRevertThread(ijkFiber* const fiber);
+
+// ijkFiberCreate
+//	Create fiber with its own stack; it does not run until switched to.
+//		param fiber_out: pointer to fiber descriptor
+//			valid: non-null, inactive
+//		param entryFunc: function to call when fiber first runs
+//			valid: non-null
+//			note: once it returns, fiber switches back to its caller and 
+//				cannot be switched to again
+//		param entryArg: argument pointer to pass to entry function
+//		param stackSize: size of stack in bytes
+//			note: pass zero for default (64 KiB); rounded up to whole pages, 
+//				with a guard page below on POSIX
+//		return SUCCESS: ijk_success if fiber created
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if not created
+iret ijkFiberCreate(ijkFiber* const fiber_out, ijkFiberEntryFunc const entryFunc, ptr const entryArg, size const stackSize);
+
+// ijkFiberRelease
+//	Release fiber and its stack; a fiber whose entry has not returned is 
+//	discarded without unwinding.
+//		param fiber: pointer to fiber descriptor
+//			valid: non-null, created, not running
+//		return SUCCESS: ijk_success if fiber released
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkFiberRelease(ijkFiber* const fiber);
+
+// ijkFiberSwitch
+//	Suspend the running fiber and run another on the calling thread; returns 
+//	when some fiber switches back to the suspended one, possibly on another 
+//	thread.
+//		param current: pointer to descriptor of fiber running on calling thread
+//			valid: non-null, running
+//		param fiber: pointer to descriptor of fiber to run
+//			valid: non-null, active, not running
+//			note: its caller is set to current
+//		return SUCCESS: ijk_success if switched to fiber and back
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkFiberSwitch(ijkFiber* const current, ijkFiber* const fiber);
+
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef __cplusplus
+}
+#endif	// __cplusplus
+
+
+#endif	// !_IJK_FIBER_H_
\ No newline at end of file
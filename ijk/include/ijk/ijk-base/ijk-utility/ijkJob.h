@@ -0,0 +1,340 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkJob.h
+	Job system interface.
+*/
+
+#ifndef _IJK_JOB_H_
+#define _IJK_JOB_H_
+
+
+#include "ijkFiber.h"
+#include "ijkStream.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#else	// !__cplusplus
+typedef struct		ijkJobCounter		ijkJobCounter;
+#endif	// __cplusplus
+
+
+//-----------------------------------------------------------------------------
+
+// ijk_warn_job_inline
+//	Job warning indicating that job was executed immediately by caller.
+#define ijk_warn_job_inline		ijk_warncode(0x1)
+
+
+// ijkJobFunc
+//	Job function type; same signature as thread entry function.
+//		param jobArg: pointer representing data to be passed to the function
+//		return: any integer (ignored)
+typedef ijkThreadEntryFunc ijkJobFunc;
+
+
+// ijkParallelFunc
+//	Range function type for parallel loops.
+//		param arg: pointer representing data shared by all ranges
+//		param first: index of first element in range
+//		param count: number of elements in range
+//		param result_out: storage for result of range; null in parallel for
+//		return: any integer (ignored)
+typedef iret(*ijkParallelFunc)(ptr arg, size first, size count, ptr result_out);
+
+
+// ijkParallelCombineFunc
+//	Function type combining the result of a range into the result of the 
+//	range that precedes it, for parallel reduce.
+//		param arg: pointer representing data shared by all ranges
+//		param result_inout: result of preceding range, updated to combined
+//		param result: result of following range
+//		return: any integer (ignored)
+typedef iret(*ijkParallelCombineFunc)(ptr arg, ptr result_inout, kptr result);
+
+
+// ijk_parallel_result_max
+//	Maximum size in bytes of parallel reduce results.
+#define ijk_parallel_result_max	256
+
+
+// ijkJobCounter
+//	Counter of unfinished jobs, used as a handle to wait on a group of jobs 
+//	or to hold back jobs that depend on them; zero-initialized is finished. 
+//	The last job to finish does not touch the counter after decrementing 
+//	it, so a counter may be discarded as soon as a wait on it returns.
+//		member count: number of jobs submitted with counter and not finished
+struct ijkJobCounter
+{
+	size volatile count;			// unfinished jobs
+};
+
+
+//-----------------------------------------------------------------------------
+
+// ijkJobSystemCreate
+//	Initialize job system given pre-allocated (stack, heap or pool block) 
+//	memory and launch its worker threads. Each worker, plus the creating 
+//	thread, owns a work-stealing deque: jobs are pushed and popped at one 
+//	end by the owner and stolen from the other end by idle workers. Idle 
+//	workers spin briefly, then sleep until jobs are submitted. Each job 
+//	runs on a fiber from a pool (32 per thread, 64 KiB stacks), so that a 
+//	job waiting on a counter is set aside instead of blocking its thread.
+//		param jobs_base: base pointer to pre-allocated block
+//			valid: non-null, uninitialized as job system
+//			note: must outlive the job system; may be a block reserved in a 
+//				managed pool
+//		param baseSize: size of base block (pre-allocated) in bytes
+//			valid: non-zero, large enough for sixteen jobs per thread
+//			note: remaining space is divided evenly between threads; the 
+//				per-thread job capacity is rounded down to a power of two
+//		param workerCount: number of worker threads to launch
+//			note: pass zero to launch one per core, less one for caller
+//		param pinned: whether to bind each worker to its own core
+//		param name: name of job system, given to worker threads
+//			valid: non-zero, non-empty c-string
+//		return SUCCESS: ijk_success if job system initialized
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if not initialized
+iret ijkJobSystemCreate(ptr const jobs_base, size const baseSize, size const workerCount, ibool const pinned, tag const name);
+
+// ijkJobSystemCreateExt
+//	Initialize job system as above, with a given fiber pool.
+//		param jobs_base: base pointer to pre-allocated block
+//			valid: non-null, uninitialized as job system
+//		param baseSize: size of base block (pre-allocated) in bytes
+//			valid: non-zero, large enough for fiber descriptors and sixteen 
+//				jobs per thread
+//		param workerCount: number of worker threads to launch
+//			note: pass zero to launch one per core, less one for caller
+//		param pinned: whether to bind each worker to its own core
+//		param name: name of job system, given to worker threads
+//			valid: non-zero, non-empty c-string
+//		param fiberCount: number of fibers per thread
+//			note: pass zero to run jobs on thread stacks only; jobs also 
+//				run there while a thread has no idle fiber, and waits on 
+//				thread stacks execute other jobs meanwhile (nested on the 
+//				waiting stack) instead of setting the waiting job aside
+//		param fiberStackSize: size of each fiber stack in bytes
+//			note: pass zero for default (64 KiB); stacks are allocated by 
+//				the system, not from the base block
+//		return SUCCESS: ijk_success if job system initialized
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if not initialized
+iret ijkJobSystemCreateExt(ptr const jobs_base, size const baseSize, size const workerCount, ibool const pinned, tag const name, size const fiberCount, size const fiberStackSize);
+
+// ijkJobSystemRelease
+//	Stop and join worker threads, leaving the contained memory unaffected.
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//			note: jobs not yet started are discarded; wait on counters 
+//				before releasing; release on creating thread
+//		return SUCCESS: ijk_success if job system terminated
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if a worker could not be joined
+iret ijkJobSystemRelease(ptr const jobs);
+
+// ijkJobSystemGetWorkerCount
+//	Get the number of threads executing jobs, including the creating thread.
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//		param count_out: pointer to storage for count
+//			valid: non-null
+//		return SUCCESS: ijk_success if count retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkJobSystemGetWorkerCount(kptr const jobs, size* const count_out);
+
+// ijkJobSystemGetWorkerIndex
+//	Get the index of the calling thread in the job system, e.g. to select 
+//	per-thread scratch space from within a job.
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//		param index_out: pointer to storage for index
+//			valid: non-null
+//			note: zero for creating thread
+//		return SUCCESS: ijk_success if index retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if caller is not in system
+iret ijkJobSystemGetWorkerIndex(kptr const jobs, size* const index_out);
+
+// ijkJobSystemGetCapacity
+//	Get the maximum number of unfinished jobs submitted from each thread.
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//		param count_out: pointer to storage for count
+//			valid: non-null
+//		return SUCCESS: ijk_success if count retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkJobSystemGetCapacity(kptr const jobs, size* const count_out);
+
+
+//-----------------------------------------------------------------------------
+
+// ijkJobSubmit
+//	Submit a job to the calling thread's deque.
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//		param jobFunc: function to call
+//			valid: non-null
+//		param jobArg: argument to pass to jobFunc when it is called
+//		param counter_opt: optional counter incremented now and decremented 
+//			when job finishes
+//		param dependency_opt: optional counter that must reach zero before 
+//			job may start
+//			note: job is held, not queued, until then; counter must stay 
+//				valid until job starts
+//		return SUCCESS: ijk_success if job submitted
+//		return WARNING: ijk_warn_job_inline if job could not be queued and 
+//			was run by caller instead (caller is not a thread of the 
+//			system, or its job capacity is exhausted); waits on dependency
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkJobSubmit(ptr const jobs, ijkJobFunc const jobFunc, ptr const jobArg, ijkJobCounter* const counter_opt, ijkJobCounter* const dependency_opt);
+
+// ijkJobWait
+//	Wait for a counter to reach zero without blocking a thread: a job 
+//	running on a fiber is set aside and resumed once the counter reaches 
+//	zero, while its thread moves on to other jobs; other callers in the 
+//	system execute queued jobs (their own first, then stolen) meanwhile.
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//		param counter: pointer to counter
+//			valid: non-null
+//			note: callers outside the system, and those with nothing left 
+//				to help with, spin briefly and then sleep until a counter 
+//				finishes
+//		return SUCCESS: ijk_success if counter reached zero
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		note: a job may resume on another thread than it waited on, so it 
+//			should not hold thread-specific state (e.g. worker index, a 
+//			mutex) across a wait
+iret ijkJobWait(ptr const jobs, ijkJobCounter* const counter);
+
+// ijkJobYield
+//	Set the calling job aside so that another queued job can run first, 
+//	e.g. while polling for a resource; it is queued again at once.
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//		return SUCCESS: ijk_success if job yielded and resumed
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if caller is not a job 
+//			running on a fiber
+iret ijkJobYield(ptr const jobs);
+
+// ijkJobSignal
+//	Count one unit of work as finished on a counter, from any thread; 
+//	pairs with waiting on a counter raised by hand, so a job can wait for 
+//	work done outside the system (e.g. a stream read on an I/O thread) 
+//	without blocking a worker.
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//		param counter: pointer to counter
+//			valid: non-null
+//			note: jobs held by or waiting on counter are released once it 
+//				reaches zero
+//		return SUCCESS: ijk_success if counter decremented
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if counter is already zero
+iret ijkJobSignal(ptr const jobs, ijkJobCounter* const counter);
+
+// ijkJobWaitStream
+//	Wait for an asynchronous stream request to complete without blocking a 
+//	thread: a job running on a fiber polls the stream system and yields to 
+//	other jobs in between; other callers sleep until the request is done.
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//		param async: pointer to asynchronous stream descriptor
+//			valid: non-null, initialized
+//			note: polled by one job at a time, as it would be by one thread
+//		param request: pointer to completion handle
+//			valid: non-null, in flight or done
+//		return SUCCESS: ijk_success if request is done
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if kernel ring failed
+iret ijkJobWaitStream(ptr const jobs, ijkStreamAsync* const async, ijkStreamRequest const* const request);
+
+// ijkParallelFor
+//	Call a function over a range of elements, split into ranges of up to 
+//	grain elements that are executed as jobs. Ranges are split in halves 
+//	recursively, so idle workers steal large ranges first.
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//		param count: number of elements
+//			note: nothing is called if zero
+//		param grain: maximum number of elements per call
+//			note: pass zero to make about four ranges per thread
+//		param func: range function
+//			valid: non-null
+//		param arg: argument to pass to func with each range
+//		return SUCCESS: ijk_success if all ranges finished
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if caller is not a thread of 
+//			the system, which could only run the ranges by itself
+iret ijkParallelFor(ptr const jobs, size const count, size const grain, ijkParallelFunc const func, ptr const arg);
+
+// ijkParallelReduce
+//	Call a function over a range of elements as in parallel for, each 
+//	range producing a result, and combine the results pairwise in element 
+//	order. Ranges are split the same way for a given count and grain, so 
+//	the result does not depend on which thread ran what.
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//		param count: number of elements
+//			note: result_out is not written if zero
+//		param grain: maximum number of elements per call
+//			note: pass zero to make about four ranges per thread
+//		param func: range function
+//			valid: non-null
+//		param combineFunc: result combine function
+//			valid: non-null
+//		param arg: argument to pass to func and combineFunc
+//		param result_out: pointer to storage for result
+//			valid: non-null
+//		param resultSize: size of result in bytes
+//			valid: non-zero, at most ijk_parallel_result_max
+//		return SUCCESS: ijk_success if result combined
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if caller is not a thread of 
+//			the system
+iret ijkParallelReduce(ptr const jobs, size const count, size const grain, ijkParallelFunc const func, ijkParallelCombineFunc const combineFunc, ptr const arg, ptr const result_out, size const resultSize);
+
+// ijkJobCounterIsDone
+//	Check if all jobs counted by a counter have finished.
+//		param counter: pointer to counter
+//			valid: non-null
+//		return SUCCESS: ijk_true if counter is zero
+//		return SUCCESS: ijk_false if jobs are unfinished
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+ijk_inl iret ijkJobCounterIsDone(ijkJobCounter const* const counter);
+
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef __cplusplus
+}
+#endif	// __cplusplus
+
+
+#include "_inl/ijkJob.inl"
+
+
+#endif	// !_IJK_JOB_H_
\ No newline at end of file
@@ -35,12 +35,32 @@
 #ifdef __cplusplus
 extern "C" {
 #else	// !__cplusplus
-
+typedef enum ijkMemoryVector	ijkMemoryVector;
+typedef struct ijkMemoryTraceRecord	ijkMemoryTraceRecord;
+typedef struct ijkMemoryTypeUsage	ijkMemoryTypeUsage;
 #endif	// __cplusplus
 
 
 //-----------------------------------------------------------------------------
 
+// ijk_warn_memory_incomplete
+//	Memory warning indicating that an operation stopped before completing.
+#define ijk_warn_memory_incomplete	ijk_warncode(0x1)
+
+
+// IJK_MEMORY_INSTRUMENT
+//	User-defined macro to build the library with instrumented pools: pools 
+//	with a trace record every reservation and release, keep usage and 
+//	high-water marks per block type and report leaks when released. If not 
+//	defined, traces cannot be created and pools pay nothing for them.
+
+
+// ijk_memory_site
+//	Location of the calling code, to pass as the site of a reservation or 
+//	release in instrumented pools.
+#define ijk_memory_site				((kcstr)(__FILE__ "(" ijk_tokenstr(__LINE__) ")"))
+
+
 // ijkMemoryCopyCallback
 //	Format of callback to use when copying; allows for user-managed copies.
 //		param dst: pointer to destination block
@@ -58,6 +78,75 @@ typedef	ptr(*ijkMemoryCopyCallback)(ptr dst, kptr src, size sz_chomps);
 typedef ptr(*ijkMemoryInitCallback)(ptr dst, size sz_chomps);
 
 
+// ijkMemoryRelocateCallback
+//	Format of callback to use when a reserved block has been moved; allows 
+//	user to patch any references to the block.
+//		param dst: pointer to new location of block
+//		param src: pointer to previous location of block (no longer valid)
+//		param type: user-defined data type of block
+//		return (recommended): dst
+typedef ptr(*ijkMemoryRelocateCallback)(ptr dst, kptr src, flag type);
+
+
+// ijkMemoryHandle
+//	Handle to object in object pool: slot index in the low half, generation 
+//	of slot in the high half; zero is never a valid handle.
+typedef size ijkMemoryHandle;
+
+
+// ijkMemoryVector
+//	Enumeration of instruction sets used for large set, copy and compare.
+enum ijkMemoryVector
+{
+	ijkMemoryVector_scalar,	// one chomp at a time
+	ijkMemoryVector_sse2,	// 16 bytes at a time
+	ijkMemoryVector_avx2,	// 32 bytes at a time
+};
+
+
+// ijkMemoryTraceRecord
+//	Reservation or release of a block in an instrumented pool.
+//		member time: seconds since trace was created
+//		member site: caller-supplied location, null if not given
+//		member chompOffset: offset of block descriptor from pool
+//		member chompSize: size of block in chomps
+//		member chompsFragmented: chomps fragmented in pool after event
+//		member type: user-defined data type of block
+//		member reserve: true if block was reserved, false if released
+//		member sequence: record number plus one; zero while being written
+//		member name: name of block
+struct ijkMemoryTraceRecord
+{
+	dbl time;							// time of event
+	kcstr site;							// location of event
+	size chompOffset;					// block location
+	size chompSize;						// block size
+	size chompsFragmented;				// pool fragmentation
+	flag type;							// block type
+	ibool reserve;						// reservation or release
+	size sequence;						// record number
+	tag name;							// block name
+};
+
+
+// ijkMemoryTypeUsage
+//	Pool usage by all blocks of one type in an instrumented pool; sizes 
+//	include block descriptors.
+//		member type: user-defined data type of blocks
+//		member count: number of blocks reserved
+//		member countPeak: highest number of blocks reserved at once
+//		member chomps: number of chomps reserved
+//		member chompsPeak: highest number of chomps reserved at once
+struct ijkMemoryTypeUsage
+{
+	flag type;							// block type
+	size count;							// blocks reserved
+	size countPeak;						// most blocks reserved
+	size chomps;						// space reserved
+	size chompsPeak;					// most space reserved
+};
+
+
 //-----------------------------------------------------------------------------
 
 // ijkMemorySet
@@ -69,7 +158,7 @@ typedef ptr(*ijkMemoryInitCallback)(ptr dst, size sz_chomps);
 //		param value: value used to set all bytes
 //		return SUCCESS: dst
 //		return FAILURE: null/zero
-ptr ijkMemorySet(ptr const dst, size const sz_bytes, byte const value);
+ijk_inl ptr ijkMemorySet(ptr const dst, size const sz_bytes, byte const value);
 
 // ijkMemorySetZero
 //	Set/format memory block such that all bytes are zero.
@@ -79,7 +168,7 @@ ptr ijkMemorySet(ptr const dst, size const sz_bytes, byte const value);
 //			valid: non-zero
 //		return SUCCESS: dst
 //		return FAILURE: null/zero
-ptr ijkMemorySetZero(ptr const dst, size const sz_bytes);
+ijk_inl ptr ijkMemorySetZero(ptr const dst, size const sz_bytes);
 
 // ijkMemoryCopy
 //	Copy memory block.
@@ -91,7 +180,7 @@ ptr ijkMemorySetZero(ptr const dst, size const sz_bytes);
 //			valid: non-zero
 //		return SUCCESS: dst
 //		return FAILURE: null/zero
-ptr ijkMemoryCopy(ptr const dst, kptr const src, size const sz_bytes);
+ijk_inl ptr ijkMemoryCopy(ptr const dst, kptr const src, size const sz_bytes);
 
 // ijkMemoryCompare
 //	Compare memory block.
@@ -103,7 +192,7 @@ ptr ijkMemoryCopy(ptr const dst, kptr const src, size const sz_bytes);
 //			valid: non-zero
 //		return SUCCESS: number of bytes before difference
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-ptrdiff ijkMemoryCompare(kptr const dst, kptr const src, size const sz_bytes);
+ijk_inl ptrdiff ijkMemoryCompare(kptr const dst, kptr const src, size const sz_bytes);
 
 // ijkMemoryCopyC
 //	Set/format memory block of chomps.
@@ -114,7 +203,7 @@ ptrdiff ijkMemoryCompare(kptr const dst, kptr const src, size const sz_bytes);
 //		param value: value used to set all chomps
 //		return SUCCESS: dst
 //		return FAILURE: null/zero
-ptr ijkMemorySetC(ptr const dst, size const sz_chomps, chomp const value);
+ijk_inl ptr ijkMemorySetC(ptr const dst, size const sz_chomps, chomp const value);
 
 // ijkMemorySetZeroC
 //	Set/format memory block of chomps such that all bytes are zero.
@@ -124,7 +213,7 @@ ptr ijkMemorySetC(ptr const dst, size const sz_chomps, chomp const value);
 //			valid: non-zero
 //		return SUCCESS: dst
 //		return FAILURE: null/zero
-ptr ijkMemorySetZeroC(ptr const dst, size const sz_chomps);
+ijk_inl ptr ijkMemorySetZeroC(ptr const dst, size const sz_chomps);
 
 // ijkMemoryCopyC
 //	Copy memory block of chomps.
@@ -136,7 +225,7 @@ ptr ijkMemorySetZeroC(ptr const dst, size const sz_chomps);
 //			valid: non-zero
 //		return SUCCESS: dst
 //		return FAILURE: null/zero
-ptr ijkMemoryCopyC(ptr const dst, kptr const src, size const sz_chomps);
+ijk_inl ptr ijkMemoryCopyC(ptr const dst, kptr const src, size const sz_chomps);
 
 // ijkMemoryCompareC
 //	Compare memory block of chomps.
@@ -148,7 +237,64 @@ ptr ijkMemoryCopyC(ptr const dst, kptr const src, size const sz_chomps);
 //			valid: non-zero
 //		return SUCCESS: number of chomps before difference
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-ptrdiff ijkMemoryCompareC(kptr const dst, kptr const src, size const sz_chomps);
+ijk_inl ptrdiff ijkMemoryCompareC(kptr const dst, kptr const src, size const sz_chomps);
+
+// ijkMemorySetWide
+//	Set/format memory block using the selected vector instruction set; 
+//	used by set functions above for large blocks.
+//		param dst: pointer to destination block
+//			valid: non-null
+//		param sz_bytes: size of block in bytes
+//			valid: non-zero
+//		param pattern: chomp repeated from start of block
+//		return SUCCESS: dst
+//		return FAILURE: null/zero
+ptr ijkMemorySetWide(ptr const dst, size const sz_bytes, chomp const pattern);
+
+// ijkMemoryCopyWide
+//	Copy memory block using the selected vector instruction set; used by 
+//	copy functions above for large blocks.
+//		param dst: pointer to destination block
+//			valid: non-null
+//			note: may overlap source if it precedes source
+//		param src: pointer to source block
+//			valid: non-null
+//		param sz_bytes: size of block in bytes
+//			valid: non-zero
+//		return SUCCESS: dst
+//		return FAILURE: null/zero
+ptr ijkMemoryCopyWide(ptr const dst, kptr const src, size const sz_bytes);
+
+// ijkMemoryCompareWide
+//	Compare memory block using the selected vector instruction set; used by 
+//	compare functions above for large blocks.
+//		param dst: pointer to destination block
+//			valid: non-null
+//		param src: pointer to source block
+//			valid: non-null
+//		param sz_bytes: size of block in bytes
+//			valid: non-zero
+//		return SUCCESS: number of bytes before difference
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+ptrdiff ijkMemoryCompareWide(kptr const dst, kptr const src, size const sz_bytes);
+
+// ijkMemoryGetVector
+//	Get vector instruction sets supported by processor and currently used.
+//		param supported_out_opt: optional pointer to best supported
+//		param selected_out_opt: optional pointer to selected
+//		return SUCCESS: ijk_success if values retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryGetVector(ijkMemoryVector* const supported_out_opt, ijkMemoryVector* const selected_out_opt);
+
+// ijkMemorySelectVector
+//	Select vector instruction set used for large blocks; the best supported 
+//	is selected by default.
+//		param vector: instruction set to use
+//			valid: supported by processor
+//		return SUCCESS: ijk_success if selected
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if not supported
+iret ijkMemorySelectVector(ijkMemoryVector const vector);
 
 
 //-----------------------------------------------------------------------------
@@ -161,7 +307,7 @@ ptrdiff ijkMemoryCompareC(kptr const dst, kptr const src, size const sz_chomps);
 //		param baseSize: size of base block (pre-allocated) in bytes
 //			valid: non-zero
 //		param poolSize: size of pool (managed) in bytes
-//			valid: non-zero
+//			valid: at least one chomp
 //		param name: name of pool
 //			valid: non-zero, non-empty c-string
 //		param initCallback_opt: optional initialization callback
@@ -182,48 +328,97 @@ iret ijkMemoryPoolCreate(ptr const pool_base, size const baseSize, size const po
 iret ijkMemoryPoolRelease(ptr const pool, ijkMemoryInitCallback const termCallback_opt);
 
 // ijkMemoryPoolLoad
-//	Load managed pool from an open stream.
+//	Load managed pool from an open stream; the image is read directly into 
+//	place in a single read and verified, with no per-block fix-up.
 //		param pool_base: base pointer to pre-allocated block
-//			valid: non-null, initialized
+//			valid: non-null, uninitialized
 //		param baseSize: size of base block in bytes
-//			valid: non-zero
+//			valid: non-zero, at least as large as saved pool
 //		param stream: pointer to stream descriptor
 //			valid: non-null, initialized, read mode enabled
-//		param loadCallback_opt: optional load callback
+//		param loadCallback_opt: optional load callback, called after image
 //		return SUCCESS: ijk_success if pool loaded
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-//		return FAILURE: ijk_fail_operationfail if pool not loaded
+//		return FAILURE: ijk_fail_operationfail if pool not loaded (image 
+//			invalid, corrupt, too large or saved with different chomp size)
 iret ijkMemoryPoolLoad(ptr const pool_base, size const baseSize, ijkStream* const stream, ijkStreamReadFunc const loadCallback_opt);
 
+// ijkMemoryPoolLoadInPlace
+//	Use a saved pool image already in memory (e.g. mapped file) as a pool 
+//	without copying; pool begins immediately after image header.
+//		param pool_out: pointer to pool base pointer
+//			valid: non-null, pointer to null
+//		param image_base: pointer to start of saved image
+//			valid: non-null, chomp-aligned, writable
+//		param imageSize: size of image in bytes
+//			valid: non-zero
+//		return SUCCESS: ijk_success if pool loaded
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if image invalid
+iret ijkMemoryPoolLoadInPlace(ptr* const pool_out, ptr const image_base, size const imageSize);
+
 // ijkMemoryPoolSave
-//	Save managed pool to an open stream.
+//	Save managed pool to an open stream as one contiguous image: header 
+//	(magic, version, chomp size, checksum) followed by the pool as-is.
 //		param pool: base pointer to pre-allocated block
 //			valid: non-null, initialized
 //		param baseSize: size of base block in bytes
 //			valid: non-zero
 //		param stream: pointer to stream descriptor
 //			valid: non-null, initialized, read mode disabled
-//		param saveCallback_opt: optional load callback
+//		param saveCallback_opt: optional save callback, called after image
 //		return SUCCESS: ijk_success if pool saved
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-//		return FAILURE: ijk_fail_operationfail if pool not saved
+//		return FAILURE: ijk_fail_operationfail if pool not saved or thread 
+//			caches are attached to pool
 iret ijkMemoryPoolSave(kptr const pool, size const baseSize, ijkStream* const stream, ijkStreamWriteFunc const saveCallback_opt);
 
 // ijkMemoryPoolDefragment
-//	Defragment pool.
+//	Defragment pool completely by moving all reserved blocks towards the 
+//	pool head, leaving a single open block at the tail.
 //		param pool: base pointer to pre-allocated block
 //			valid: non-null, initialized
+//			note: reserved blocks may move; use ijkMemoryPoolGetBlock or 
+//				ijkMemoryPoolDefragmentStep to track them
 //		param copyCallback_opt: optional callback to perform copying
 //			note: if null is passed, uses ijkMemoryCopyC
+//			note: destination and source may overlap, destination is lower
 //		return SUCCESS: ijk_success if defragmented
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
 //		return FAILURE: ijk_fail_operationfail if not defragmented
 iret ijkMemoryPoolDefragment(ptr const pool, ijkMemoryCopyCallback const copyCallback_opt);
 
+// ijkMemoryPoolDefragmentStep
+//	Defragment pool incrementally with a bounded amount of copying; each 
+//	step resumes where the previous one stopped.
+//		param pool: base pointer to pre-allocated block
+//			valid: non-null, initialized
+//		param chompBudget: maximum number of chomps to move in this step
+//			valid: non-zero
+//			note: blocks whose size with descriptor exceeds the budget are 
+//				never moved
+//		param copyCallback_opt: optional callback to perform copying
+//			note: if null is passed, uses ijkMemoryCopyC
+//			note: destination and source may overlap, destination is lower
+//		param relocateCallback_opt: optional callback called for each moved 
+//			block, after it has been moved
+//		param fragmentedBefore_opt: optional pointer to fragmented size
+//			note: upon function success, points to chomps fragmented 
+//				before the step
+//		param fragmentedAfter_opt: optional pointer to fragmented size
+//			note: upon function success, points to chomps fragmented 
+//				after the step
+//		return SUCCESS: ijk_success if pool fully defragmented
+//		return WARNING: ijk_warn_memory_incomplete if budget was spent
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryPoolDefragmentStep(ptr const pool, size const chompBudget, ijkMemoryCopyCallback const copyCallback_opt, ijkMemoryRelocateCallback const relocateCallback_opt, size* const fragmentedBefore_opt, size* const fragmentedAfter_opt);
+
 // ijkMemoryPoolGetBlock
 //	Find a reserved block by name within a pool.
 //		param pool: base pointer to pre-allocated block
 //			valid: non-null, initialized
+//			note: constant-time if pool has a name index (see 
+//				ijkMemoryPoolCreateIndex), otherwise searches all blocks
 //		param block_out: pointer to block pointer
 //			valid: non-null, points to null
 //			note: upon function success, points to non-null block address
@@ -234,6 +429,103 @@ iret ijkMemoryPoolDefragment(ptr const pool, ijkMemoryCopyCallback const copyCal
 //		return FAILURE: ijk_fail_operationfail if block not retrieved
 iret ijkMemoryPoolGetBlock(kptr const pool, kptr* const block_out, tag const name);
 
+// ijkMemoryPoolCreateIndex
+//	Reserve a hash index of block names inside a pool for fast lookups; the 
+//	index is kept current as blocks are reserved, released, renamed and 
+//	moved, and doubles in size when three-quarters full.
+//		param pool: base pointer to pre-allocated block
+//			valid: non-null, initialized, no existing index
+//			note: if there is no space to grow the index, it is released 
+//				and lookups fall back to searching all blocks
+//		param capacity: initial number of index slots
+//			valid: non-zero
+//			note: rounded up to a power of two with room for existing blocks
+//			note: each slot occupies two chomps of pool space
+//		return SUCCESS: ijk_success if index created
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if no space for index
+iret ijkMemoryPoolCreateIndex(ptr const pool, size const capacity);
+
+// ijkMemoryPoolReleaseIndex
+//	Release the hash index of block names and return its space to the pool.
+//		param pool: base pointer to pre-allocated block
+//			valid: non-null, initialized, has index
+//		return SUCCESS: ijk_success if index released
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryPoolReleaseIndex(ptr const pool);
+
+// ijkMemoryPoolCreateTrace
+//	Reserve a trace within a pool to record reservations and releases of 
+//	blocks, and usage by block type (instrumented builds only); blocks 
+//	already reserved are counted in usage. Blocks handed out by thread 
+//	caches are not traced.
+//		param pool: base pointer to pre-allocated block
+//			valid: non-null, initialized, no existing trace
+//		param recordCount: number of records kept; oldest are overwritten
+//			valid: non-zero
+//			note: rounded up to a power of two
+//		param typeCount: number of distinct block types tracked
+//			valid: non-zero
+//			note: rounded up to a power of two
+//		param report_opt: optional stream to which a leak report is written 
+//			if blocks remain reserved when the pool is released
+//			valid: initialized, read mode disabled
+//		return SUCCESS: ijk_success if trace created
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if no space for trace, or 
+//			library not built with IJK_MEMORY_INSTRUMENT
+iret ijkMemoryPoolCreateTrace(ptr const pool, size const recordCount, size const typeCount, ijkStream* const report_opt);
+
+// ijkMemoryPoolReleaseTrace
+//	Release the trace of a pool and return its space to the pool.
+//		param pool: base pointer to pre-allocated block
+//			valid: non-null, initialized, has trace
+//		return SUCCESS: ijk_success if trace released
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryPoolReleaseTrace(ptr const pool);
+
+// ijkMemoryPoolGetTrace
+//	Get the most recent records of a pool trace, oldest first.
+//		param pool: base pointer to pre-allocated block
+//			valid: non-null, initialized, has trace
+//		param records_out: array of records to fill
+//			valid: non-null
+//		param recordCount: number of records in array
+//			valid: non-zero
+//		param count_out: pointer to number of records filled
+//			valid: non-null
+//			note: records overwritten while being read are skipped
+//		return SUCCESS: ijk_success if records retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryPoolGetTrace(kptr const pool, ijkMemoryTraceRecord* const records_out, size const recordCount, size* const count_out);
+
+// ijkMemoryPoolGetTypeUsage
+//	Get usage and high-water marks by block type from a pool trace.
+//		param pool: base pointer to pre-allocated block
+//			valid: non-null, initialized, has trace
+//		param usage_out: array of usage to fill
+//			valid: non-null
+//		param usageCount: number of elements in array
+//			valid: non-zero
+//		param count_out: pointer to number of elements filled
+//			valid: non-null
+//		return SUCCESS: ijk_success if usage retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryPoolGetTypeUsage(kptr const pool, ijkMemoryTypeUsage* const usage_out, size const usageCount, size* const count_out);
+
+// ijkMemoryPoolReport
+//	Write a text report of a pool to a stream: totals, usage by type if 
+//	traced, and every reserved block with the site of its reservation if 
+//	still in the trace.
+//		param pool: base pointer to pre-allocated block
+//			valid: non-null, initialized
+//		param stream: pointer to stream descriptor
+//			valid: non-null, initialized, read mode disabled
+//		return SUCCESS: ijk_success if report written
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if report not written
+iret ijkMemoryPoolReport(kptr const pool, ijkStream* const stream);
+
 // ijkMemoryPoolGetName
 //	Get the name of a pool.
 //		param pool: base pointer to pre-allocated block
@@ -308,7 +600,9 @@ iret ijkMemoryPoolGetSize(kptr const pool, size* const size_out);
 //-----------------------------------------------------------------------------
 
 // ijkMemoryBlockCreate
-//	Reserve a block within a pool.
+//	Reserve a block within a pool. Small blocks are recycled from blocks of 
+//	the same size; others are taken from the smallest size class of open 
+//	space that fits, with the remainder returned to open space.
 //		param block_out: pointer to block pointer
 //			valid: non-null, points to null
 //		param blockSize: size of block in bytes
@@ -325,8 +619,17 @@ iret ijkMemoryPoolGetSize(kptr const pool, size* const size_out);
 //		return FAILURE: ijk_fail_operationfail if not reserved
 iret ijkMemoryBlockCreate(ptr* const block_out, size const blockSize, ptr const pool, tag const name, flag const type, ijkMemoryInitCallback const initCallback_opt);
 
+// ijkMemoryBlockCreateAt
+//	Reserve a block within a pool, recording the site of the reservation 
+//	if the pool is traced; see ijkMemoryBlockCreate.
+//		param site: location of calling code (e.g. ijk_memory_site)
+//			valid: null or c-string that outlives pool
+iret ijkMemoryBlockCreateAt(ptr* const block_out, size const blockSize, ptr const pool, tag const name, flag const type, ijkMemoryInitCallback const initCallback_opt, kcstr const site);
+
 // ijkMemoryBlockRelease
-//	Release a block back into a pool.
+//	Release a block back into a pool. Small blocks are kept for recycling and 
+//	only coalesced with neighbors when open space runs out; others are 
+//	coalesced immediately.
 //		param block: pointer to block
 //			valid: non-null, initialized
 //			note: does not format
@@ -338,25 +641,32 @@ iret ijkMemoryBlockCreate(ptr* const block_out, size const blockSize, ptr const
 //		return FAILURE: ijk_fail_operationfail if not released
 iret ijkMemoryBlockRelease(ptr const block, ptr const pool, ijkMemoryInitCallback const termCallback_opt);
 
+// ijkMemoryBlockReleaseAt
+//	Release a block back into a pool, recording the site of the release if 
+//	the pool is traced; see ijkMemoryBlockRelease.
+//		param site: location of calling code (e.g. ijk_memory_site)
+//			valid: null or c-string that outlives pool
+iret ijkMemoryBlockReleaseAt(ptr const block, ptr const pool, ijkMemoryInitCallback const termCallback_opt, kcstr const site);
+
 // ijkMemoryBlockLoad
-//	Load a block from an open stream.
+//	Load a block from an open stream; contents, type and name are restored.
 //		param block: pointer to block
-//			valid: non-null, initialized
+//			valid: non-null, initialized, at least as large as saved block
 //		param stream: pointer to stream descriptor
 //			valid: non-null, initialized, read mode enabled
-//		param loadCallback_opt: optional load callback
+//		param loadCallback_opt: optional load callback, called after block
 //		return SUCCESS: ijk_success if block loaded
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
 //		return FAILURE: ijk_fail_operationfail if block not loaded
 iret ijkMemoryBlockLoad(ptr const block, ijkStream* const stream, ijkStreamReadFunc const loadCallback_opt);
 
 // ijkMemoryBlockSave
-//	Save a block to an open stream.
+//	Save a block to an open stream with header and checksum.
 //		param block: pointer to block
 //			valid: non-null, initialized
 //		param stream: pointer to stream descriptor
 //			valid: non-null, initialized, read mode disabled
-//		param saveCallback_opt: optional load callback
+//		param saveCallback_opt: optional save callback, called after block
 //		return SUCCESS: ijk_success if block saved
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
 //		return FAILURE: ijk_fail_operationfail if block not saved
@@ -391,6 +701,7 @@ iret ijkMemoryBlockGetName(kptr const block, tag name_out);
 //	Set the name of a reserved block.
 //		param block: pointer to block
 //			valid: non-null, initialized
+//			note: block is re-filed in its pool's name index, if any
 //		param name: name of block to be set
 //			valid: non-null, non-empty c-string
 //		return SUCCESS: ijk_success if name set
@@ -434,6 +745,290 @@ iret ijkMemoryBlockSetType(ptr const block, flag const type);
 iret ijkMemoryBlockGetSize(kptr const block, size* const size_out);
 
 
+//-----------------------------------------------------------------------------
+
+// ijkMemoryArenaCreate
+//	Initialize linear arena given pre-allocated (stack, heap or pool block) 
+//	memory. Space is divided into equal buffers; the current buffer is 
+//	reserved from both ends by moving a marker, and is only ever released 
+//	as a whole or by rolling a marker back.
+//		param arena_base: base pointer to pre-allocated block
+//			valid: non-null, uninitialized as arena
+//			note: may be a block reserved in a managed pool
+//		param baseSize: size of base block (pre-allocated) in bytes
+//			valid: non-zero, large enough for one chomp per buffer
+//		param bufferCount: number of buffers to cycle through on reset
+//			valid: non-zero
+//			note: with two buffers, reservations stay valid through the 
+//				following reset (double-buffered frames)
+//		param name: name of arena
+//			valid: non-zero, non-empty c-string
+//		return SUCCESS: ijk_success if arena initialized
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if not initialized
+iret ijkMemoryArenaCreate(ptr const arena_base, size const baseSize, size const bufferCount, tag const name);
+
+// ijkMemoryArenaRelease
+//	Terminate linear arena, leaving the contained memory unaffected.
+//		param arena: base pointer to arena
+//			valid: non-null, initialized
+//		return SUCCESS: ijk_success if arena terminated
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryArenaRelease(ptr const arena);
+
+// ijkMemoryArenaReset
+//	Advance to the next buffer and release everything reserved in it.
+//		param arena: base pointer to arena
+//			valid: non-null, initialized
+//			note: with one buffer, releases all reservations
+//		return SUCCESS: ijk_success if arena reset
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryArenaReset(ptr const arena);
+
+// ijkMemoryArenaReserve
+//	Reserve space from the bottom of the current buffer.
+//		param arena: base pointer to arena
+//			valid: non-null, initialized
+//		param block_out: pointer to block pointer
+//			valid: non-null, points to null
+//			note: upon function success, points to chomp-aligned space
+//		param blockSize: size of block in bytes
+//			valid: non-zero
+//		return SUCCESS: ijk_success if space reserved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if buffer is full
+iret ijkMemoryArenaReserve(ptr const arena, ptr* const block_out, size const blockSize);
+
+// ijkMemoryArenaReserveTop
+//	Reserve space from the top of the current buffer.
+//		param arena: base pointer to arena
+//			valid: non-null, initialized
+//		param block_out: pointer to block pointer
+//			valid: non-null, points to null
+//			note: upon function success, points to chomp-aligned space
+//		param blockSize: size of block in bytes
+//			valid: non-zero
+//		return SUCCESS: ijk_success if space reserved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if buffer is full
+iret ijkMemoryArenaReserveTop(ptr const arena, ptr* const block_out, size const blockSize);
+
+// ijkMemoryArenaGetMarker
+//	Get marker at the bottom of open space in the current buffer.
+//		param arena: base pointer to arena
+//			valid: non-null, initialized
+//		param marker_out: pointer to marker
+//			valid: non-null
+//		return SUCCESS: ijk_success if marker retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryArenaGetMarker(kptr const arena, size* const marker_out);
+
+// ijkMemoryArenaGetMarkerTop
+//	Get marker at the top of open space in the current buffer.
+//		param arena: base pointer to arena
+//			valid: non-null, initialized
+//		param marker_out: pointer to marker
+//			valid: non-null
+//		return SUCCESS: ijk_success if marker retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryArenaGetMarkerTop(kptr const arena, size* const marker_out);
+
+// ijkMemoryArenaRollback
+//	Release everything reserved from the bottom since marker was taken.
+//		param arena: base pointer to arena
+//			valid: non-null, initialized
+//		param marker: marker from ijkMemoryArenaGetMarker
+//		return SUCCESS: ijk_success if rolled back
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if marker is not in the 
+//			reserved bottom of the current buffer (e.g. taken before reset)
+iret ijkMemoryArenaRollback(ptr const arena, size const marker);
+
+// ijkMemoryArenaRollbackTop
+//	Release everything reserved from the top since marker was taken.
+//		param arena: base pointer to arena
+//			valid: non-null, initialized
+//		param marker: marker from ijkMemoryArenaGetMarkerTop
+//		return SUCCESS: ijk_success if rolled back
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if marker is not in the 
+//			reserved top of the current buffer (e.g. taken before reset)
+iret ijkMemoryArenaRollbackTop(ptr const arena, size const marker);
+
+// ijkMemoryArenaGetReserved
+//	Get reserved size of current buffer in chomps.
+//		param arena: base pointer to arena
+//			valid: non-null, initialized
+//		param size_out: pointer to storage for size
+//			valid: non-null
+//		return SUCCESS: ijk_success if size retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryArenaGetReserved(kptr const arena, size* const size_out);
+
+// ijkMemoryArenaGetAvailable
+//	Get available size of current buffer in chomps.
+//		param arena: base pointer to arena
+//			valid: non-null, initialized
+//		param size_out: pointer to storage for size
+//			valid: non-null
+//		return SUCCESS: ijk_success if size retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryArenaGetAvailable(kptr const arena, size* const size_out);
+
+
+//-----------------------------------------------------------------------------
+
+// ijkMemoryObjectPoolCreate
+//	Initialize object pool given pre-allocated (stack, heap or pool block) 
+//	memory, divided into equal slots. Objects are referred to by handles 
+//	that expire when the object is released, so stale handles are detected.
+//		param objpool_base: base pointer to pre-allocated block
+//			valid: non-null, uninitialized as object pool
+//			note: may be a block reserved in a managed pool
+//		param baseSize: size of base block (pre-allocated) in bytes
+//			valid: non-zero, large enough for at least one object
+//		param objectSize: size of each object in bytes
+//			valid: non-zero
+//		param name: name of object pool
+//			valid: non-zero, non-empty c-string
+//		return SUCCESS: ijk_success if object pool initialized
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if not initialized
+iret ijkMemoryObjectPoolCreate(ptr const objpool_base, size const baseSize, size const objectSize, tag const name);
+
+// ijkMemoryObjectPoolRelease
+//	Terminate object pool, leaving the contained memory unaffected.
+//		param objpool: base pointer to object pool
+//			valid: non-null, initialized
+//			note: does not format; assumes objects within have been released
+//		return SUCCESS: ijk_success if object pool terminated
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryObjectPoolRelease(ptr const objpool);
+
+// ijkMemoryObjectPoolGetCount
+//	Get the number of objects reserved.
+//		param objpool: base pointer to object pool
+//			valid: non-null, initialized
+//		param count_out: pointer to storage for count
+//			valid: non-null
+//		return SUCCESS: ijk_success if count retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryObjectPoolGetCount(kptr const objpool, size* const count_out);
+
+// ijkMemoryObjectPoolGetCapacity
+//	Get the maximum number of objects.
+//		param objpool: base pointer to object pool
+//			valid: non-null, initialized
+//		param count_out: pointer to storage for count
+//			valid: non-null
+//		return SUCCESS: ijk_success if count retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryObjectPoolGetCapacity(kptr const objpool, size* const count_out);
+
+
+//-----------------------------------------------------------------------------
+
+// ijkMemoryObjectCreate
+//	Reserve an object in an object pool; the most recently released slot is 
+//	reused first.
+//		param handle_out: pointer to object handle
+//			valid: non-null
+//			note: upon function success, holds non-zero handle
+//		param object_out_opt: optional pointer to object pointer
+//			note: upon function success, points to chomp-aligned object
+//		param objpool: base pointer to object pool
+//			valid: non-null, initialized
+//		param initCallback_opt: optional initialization callback
+//		return SUCCESS: ijk_success if object reserved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if object pool is full
+iret ijkMemoryObjectCreate(ijkMemoryHandle* const handle_out, ptr* const object_out_opt, ptr const objpool, ijkMemoryInitCallback const initCallback_opt);
+
+// ijkMemoryObjectRelease
+//	Release an object back into an object pool, expiring its handle.
+//		param handle: handle of object
+//			valid: non-zero
+//		param objpool: base pointer to object pool
+//			valid: non-null, initialized
+//		param termCallback_opt: optional termination callback
+//		return SUCCESS: ijk_success if object released
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if handle is stale
+iret ijkMemoryObjectRelease(ijkMemoryHandle const handle, ptr const objpool, ijkMemoryInitCallback const termCallback_opt);
+
+// ijkMemoryObjectGet
+//	Get pointer to object from its handle.
+//		param object_out: pointer to object pointer
+//			valid: non-null
+//			note: upon function success, points to object
+//		param handle: handle of object
+//			valid: non-zero
+//		param objpool: base pointer to object pool
+//			valid: non-null, initialized
+//		return SUCCESS: ijk_success if object retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if handle is stale
+iret ijkMemoryObjectGet(ptr* const object_out, ijkMemoryHandle const handle, ptr const objpool);
+
+
+//-----------------------------------------------------------------------------
+
+// ijkMemoryCacheCreate
+//	Attach a thread cache to a pool. Each thread that reserves from a shared 
+//	pool should own one cache: small blocks are kept in per-thread stacks 
+//	(magazines) of blocks in power-of-two size classes, and whole magazines 
+//	are exchanged with a shared depot in the pool without locking. The pool 
+//	is only locked to reserve or release a batch of blocks.
+//		param cache_out: pointer to cache pointer
+//			valid: non-null, points to null
+//			note: upon function success, points to cache reserved in pool
+//		param pool: base pointer to managed pool
+//			valid: non-null, initialized
+//			note: once a cache is attached, pool functions that change the 
+//				pool lock it; attach caches before sharing pool with threads
+//		return SUCCESS: ijk_success if cache created
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if pool lacks space for cache
+iret ijkMemoryCacheCreate(ptr* const cache_out, ptr const pool);
+
+// ijkMemoryCacheRelease
+//	Return a thread cache and all blocks held in it to its pool.
+//		param cache: pointer to cache
+//			valid: non-null, initialized, owned by calling thread
+//			note: blocks reserved through cache and not yet released 
+//				remain reserved; release them to any cache of the same pool
+//		return SUCCESS: ijk_success if cache released
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkMemoryCacheRelease(ptr const cache);
+
+// ijkMemoryCacheBlockCreate
+//	Reserve a block through a thread cache; small blocks are rounded up to 
+//	their size class and taken from the cache, larger ones from the pool.
+//		param block_out: pointer to block pointer
+//			valid: non-null, points to null
+//		param blockSize: size of block in bytes
+//			valid: non-zero
+//		param cache: pointer to cache
+//			valid: non-null, initialized, owned by calling thread
+//		return SUCCESS: ijk_success if block reserved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if not reserved
+iret ijkMemoryCacheBlockCreate(ptr* const block_out, size const blockSize, ptr const cache);
+
+// ijkMemoryCacheBlockRelease
+//	Release a block reserved through any cache of the same pool.
+//		param block: pointer to block
+//			valid: non-null, reserved with ijkMemoryCacheBlockCreate
+//			note: such blocks are unnamed, cannot be found by name and are 
+//				not moved by defragmentation
+//		param cache: pointer to cache
+//			valid: non-null, initialized, owned by calling thread
+//		return SUCCESS: ijk_success if block released
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if not released
+iret ijkMemoryCacheBlockRelease(ptr const block, ptr const cache);
+
+
 //-----------------------------------------------------------------------------
 
 
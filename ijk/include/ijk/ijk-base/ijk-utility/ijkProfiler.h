@@ -0,0 +1,180 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkProfiler.h
+	Instrumentation profiler interface.
+*/
+
+#ifndef _IJK_PROFILER_H_
+#define _IJK_PROFILER_H_
+
+
+#include "ijkStream.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#else	// !__cplusplus
+typedef enum		ijkProfilerFormat	ijkProfilerFormat;
+#endif	// __cplusplus
+
+
+//-----------------------------------------------------------------------------
+
+// ijk_warn_profiler_dropped
+//	Profiler warning indicating that events were not recorded, because a 
+//	thread's buffer was full or every buffer was claimed.
+#define ijk_warn_profiler_dropped	ijk_warncode(0x1)
+
+
+// ijk_profile_begin, ijk_profile_end, ijk_profile_scope
+//	Instrumentation macros: record the start and finish of a named scope on 
+//	the calling thread; scopes nest, and appear as a hierarchy per thread. 
+//	The scope form wraps the statement or block that follows it; leaving it 
+//	with return, break or goto skips the end, so use begin and end there. 
+//	Names must outlive the profiler (string literals are ideal). All expand 
+//	to nothing when __ijk_cfg_profile is zero.
+//		param name: c-string naming scope
+#if (__ijk_cfg_profile)
+#define ijk_profile_begin(name)		ijkProfilerBegin((kcstr)(name))
+#define ijk_profile_end()			ijkProfilerEnd()
+#define ijk_profile_scope(name)		for (ibool ijk_tokencat(ijkProfileScope, __LINE__) = (ijkProfilerBegin((kcstr)(name)), ijk_true); ijk_tokencat(ijkProfileScope, __LINE__); ijk_tokencat(ijkProfileScope, __LINE__) = (ijkProfilerEnd(), ijk_false))
+#else	// !__ijk_cfg_profile
+#define ijk_profile_begin(name)		((void)0)
+#define ijk_profile_end()			((void)0)
+#define ijk_profile_scope(name)
+#endif	// __ijk_cfg_profile
+
+
+// ijkProfilerFormat
+//	Enumeration of flush output formats. 
+//		json: Chrome trace event JSON (array format), for chrome://tracing or 
+//			Perfetto; timestamps in microseconds
+//		binary: compact records, little-endian; header is "ijkProf1" and a 
+//			qword of ticks per second, then records by leading byte: 
+//			'T' thread (dword id, byte length, name) sets thread of records 
+//			that follow; 'N' name (dword index, byte length, name) defines or 
+//			redefines an index; 'B' begin (qword ticks, dword name index); 
+//			'E' end (qword ticks)
+enum ijkProfilerFormat
+{
+	ijkProfilerFormat_json,
+	ijkProfilerFormat_binary,
+};
+
+
+//-----------------------------------------------------------------------------
+
+// ijkProfilerCreate
+//	Initialize the profiler given pre-allocated (stack, heap or pool block) 
+//	memory; only one profiler is active at a time, and scopes record into it 
+//	from any thread. The block is divided into one event buffer per thread; 
+//	each thread claims one on its first scope, so recording never locks.
+//		param profiler_base: base pointer to pre-allocated block
+//			valid: non-null, uninitialized as profiler
+//		param baseSize: size of base block (pre-allocated) in bytes
+//			valid: non-zero
+//			note: each event takes 16 bytes; events per buffer are rounded 
+//				down to a power of two, so size for what accumulates between 
+//				flushes; the whole block is written once here, so that 
+//				recording never faults a page in
+//		param threadCount: maximum number of threads recording
+//			valid: non-zero
+//		return SUCCESS: ijk_success if profiler initialized
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if block too small or another 
+//			profiler is active
+iret ijkProfilerCreate(ptr const profiler_base, size const baseSize, size const threadCount);
+
+// ijkProfilerRelease
+//	Deactivate profiler, leaving the contained memory unaffected; events not 
+//	yet flushed are discarded.
+//		param profiler: base pointer to profiler
+//			valid: non-null, initialized, active
+//			note: no thread may be inside a scope
+//		return SUCCESS: ijk_success if profiler released
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkProfilerRelease(ptr const profiler);
+
+// ijkProfilerFlush
+//	Write events recorded since the last flush to stream, thread by thread, 
+//	freeing buffer space; threads keep recording meanwhile. The first flush 
+//	writes the format's header, and each thread's name is written with its 
+//	first events: the ijk thread name, else one set with 
+//	ijkProfilerSetThreadName, else "thread". JSON output is a valid trace 
+//	without a closing bracket, which viewers accept.
+//		param profiler: base pointer to profiler
+//			valid: non-null, initialized
+//			note: flushes from several threads are serialized
+//		param stream: pointer to stream descriptor
+//			valid: non-null, initialized, read flag disabled
+//		param format: output format; must be the same for every flush
+//			valid: ijkProfilerFormat enumerator
+//		return SUCCESS: ijk_success if all events written
+//		return WARNING: ijk_warn_profiler_dropped if events were dropped 
+//			since the last flush
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if stream write failed
+iret ijkProfilerFlush(ptr const profiler, ijkStream* const stream, ijkProfilerFormat const format);
+
+// ijkProfilerSetThreadName
+//	Name the calling thread in profiler output, e.g. the main thread, which 
+//	was not created by ijk; claims the thread's buffer if needed.
+//		param name: short name of thread
+//			valid: non-null
+//			note: call before the thread's first flush, which writes it
+//		return SUCCESS: ijk_success if name set
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if no profiler or buffer
+iret ijkProfilerSetThreadName(tag const name);
+
+
+//-----------------------------------------------------------------------------
+
+// ijkProfilerBegin
+//	Record the start of a named scope on the calling thread; prefer macros.
+//		param name: c-string naming scope
+//			valid: non-null, outlives profiler
+//		return SUCCESS: ijk_success if recorded
+//		return WARNING: ijk_warn_profiler_dropped if buffer was full; the 
+//			scope's end and any scopes nested in it are dropped too
+//		return FAILURE: ijk_fail_operationfail if no profiler or buffer
+iret ijkProfilerBegin(kcstr const name);
+
+// ijkProfilerEnd
+//	Record the finish of the innermost scope on the calling thread; a scope 
+//	around a job wait may end on another thread, since jobs migrate.
+//		return SUCCESS: ijk_success if recorded
+//		return WARNING: ijk_warn_profiler_dropped if buffer was full, or 
+//			scope's begin was dropped
+//		return FAILURE: ijk_fail_operationfail if no profiler or buffer
+iret ijkProfilerEnd();
+
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef __cplusplus
+}
+#endif	// __cplusplus
+
+
+#endif	// !_IJK_PROFILER_H_
\ No newline at end of file
@@ -0,0 +1,182 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkQueue.h
+	Lock-free queue interface.
+*/
+
+#ifndef _IJK_QUEUE_H_
+#define _IJK_QUEUE_H_
+
+
+#include "ijk/ijk/ijk-typedefs.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#else	// !__cplusplus
+typedef enum		ijkQueueMode		ijkQueueMode;
+#endif	// __cplusplus
+
+
+//-----------------------------------------------------------------------------
+
+// ijk_warn_queue_full
+//	Queue warning indicating that not all elements could be pushed.
+#define ijk_warn_queue_full		ijk_warncode(0x1)
+
+// ijk_warn_queue_empty
+//	Queue warning indicating that not all requested elements could be popped.
+#define ijk_warn_queue_empty	ijk_warncode(0x2)
+
+
+// ijkQueueMode
+//	Enumeration of queue modes by number of threads on each end; each mode 
+//	is only as safe as its name says, so pick the narrowest that applies.
+//		spsc: single producer, single consumer; no atomic read-modify-write
+//		mpsc: multiple producers, single consumer; pop never retries
+//		mpmc: multiple producers, multiple consumers (Vyukov bounded queue)
+enum ijkQueueMode
+{
+	ijkQueueMode_spsc,
+	ijkQueueMode_mpsc,
+	ijkQueueMode_mpmc,
+};
+
+
+//-----------------------------------------------------------------------------
+
+// ijkQueueCreate
+//	Initialize bounded lock-free ring queue given pre-allocated (stack, heap 
+//	or pool block) memory. Elements are copied in and out by value; each 
+//	slot is padded to a whole number of cache lines, so threads working on 
+//	neighbouring slots do not contend.
+//		param queue_base: base pointer to pre-allocated block
+//			valid: non-null, uninitialized as queue
+//		param baseSize: size of base block (pre-allocated) in bytes
+//			valid: non-zero, large enough for two slots
+//			note: slot count is rounded down to a power of two
+//		param elemSize: size of each element in bytes
+//			valid: non-zero
+//		param mode: number of producers and consumers
+//			valid: ijkQueueMode enumerator
+//		return SUCCESS: ijk_success if queue initialized
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if block too small
+iret ijkQueueCreate(ptr const queue_base, size const baseSize, size const elemSize, ijkQueueMode const mode);
+
+// ijkQueueRelease
+//	Invalidate queue, leaving the contained memory unaffected.
+//		param queue: base pointer to queue
+//			valid: non-null, initialized
+//			note: no thread may be using the queue
+//		return SUCCESS: ijk_success if queue invalidated
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkQueueRelease(ptr const queue);
+
+// ijkQueueGetCapacity
+//	Get the maximum number of elements in queue.
+//		param queue: base pointer to queue
+//			valid: non-null, initialized
+//		param count_out: pointer to storage for count
+//			valid: non-null
+//		return SUCCESS: ijk_success if count retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkQueueGetCapacity(kptr const queue, size* const count_out);
+
+// ijkQueueGetCount
+//	Get the number of elements in queue; may be outdated on return if other 
+//	threads are pushing or popping.
+//		param queue: base pointer to queue
+//			valid: non-null, initialized
+//		param count_out: pointer to storage for count
+//			valid: non-null
+//		return SUCCESS: ijk_success if count retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkQueueGetCount(kptr const queue, size* const count_out);
+
+
+//-----------------------------------------------------------------------------
+
+// ijkQueuePush
+//	Copy an element to the back of queue without blocking.
+//		param queue: base pointer to queue
+//			valid: non-null, initialized
+//		param elem: pointer to element to copy
+//			valid: non-null
+//		return SUCCESS: ijk_success if element pushed
+//		return WARNING: ijk_warn_queue_full if queue is full
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkQueuePush(ptr const queue, kptr const elem);
+
+// ijkQueuePop
+//	Copy the element at the front of queue out and remove it without 
+//	blocking.
+//		param queue: base pointer to queue
+//			valid: non-null, initialized
+//		param elem_out: pointer to storage for element
+//			valid: non-null
+//		return SUCCESS: ijk_success if element popped
+//		return WARNING: ijk_warn_queue_empty if queue is empty
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkQueuePop(ptr const queue, ptr const elem_out);
+
+// ijkQueuePushBatch
+//	Copy consecutive elements to the back of queue without blocking; the 
+//	elements pushed are claimed at once, so they stay consecutive in queue.
+//		param queue: base pointer to queue
+//			valid: non-null, initialized
+//		param elems: pointer to array of elements to copy
+//			valid: non-null
+//		param count: number of elements in array
+//			valid: non-zero
+//		param count_out_opt: optional pointer to storage for number pushed
+//			note: the first elements of array are the ones pushed
+//		return SUCCESS: ijk_success if all elements pushed
+//		return WARNING: ijk_warn_queue_full if some or no elements pushed
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkQueuePushBatch(ptr const queue, kptr const elems, size const count, size* const count_out_opt);
+
+// ijkQueuePopBatch
+//	Copy up to a number of elements at the front of queue out and remove 
+//	them without blocking.
+//		param queue: base pointer to queue
+//			valid: non-null, initialized
+//		param elems_out: pointer to array to store elements
+//			valid: non-null
+//		param count: number of elements array can hold
+//			valid: non-zero
+//		param count_out_opt: optional pointer to storage for number popped
+//		return SUCCESS: ijk_success if count elements popped
+//		return WARNING: ijk_warn_queue_empty if fewer elements popped
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkQueuePopBatch(ptr const queue, ptr const elems_out, size const count, size* const count_out_opt);
+
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef __cplusplus
+}
+#endif	// __cplusplus
+
+
+#endif	// !_IJK_QUEUE_H_
\ No newline at end of file
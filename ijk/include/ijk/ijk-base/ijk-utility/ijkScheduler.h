@@ -0,0 +1,193 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkScheduler.h
+	Fixed-rate scheduler interface.
+*/
+
+#ifndef _IJK_SCHEDULER_H_
+#define _IJK_SCHEDULER_H_
+
+
+#include "ijkTimer.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#else	// !__cplusplus
+typedef struct		ijkSchedulerTask	ijkSchedulerTask;
+typedef struct		ijkScheduler		ijkScheduler;
+#endif	// __cplusplus
+
+
+//-----------------------------------------------------------------------------
+
+// ijk_warn_scheduler_dropped
+//	Scheduler warning indicating that time owed was dropped instead of 
+//	caught up, because an update exceeded the catch-up budget.
+#define ijk_warn_scheduler_dropped	ijk_warncode(0x1)
+
+// ijk_scheduler_tasks
+//	Maximum number of tasks in a scheduler.
+#define ijk_scheduler_tasks			16
+
+
+// ijkSchedulerFunc
+//	Task function type for scheduler interface. Any function returning 
+//	integer and taking a pointer parameter (any type) and a time step 
+//	qualifies.
+//		param taskArg: pointer representing data to be passed to the function
+//		param dt: time step in seconds; the fixed interval for fixed-rate 
+//			tasks, the time since the last update for variable-rate tasks
+//		return: any integer
+typedef iret(*ijkSchedulerFunc)(ptr const taskArg, dbl const dt);
+
+
+// ijkSchedulerTask
+//	Scheduled task descriptor; a subsystem updated at its own rate.
+//		member func: function called each tick
+//		member arg: argument pointer to pass to function
+//		member interval: seconds per tick; zero for variable rate
+//		member owed: time accumulated but not yet ticked, in seconds
+//		member alpha: fraction of the next tick owed after an update, for 
+//			interpolating between the last two fixed states when rendering
+//		member tickLimit: maximum ticks per update; zero for no limit
+//		member tickCount: number of ticks run
+//		member result: integer return value from last call
+struct ijkSchedulerTask
+{
+	ijkSchedulerFunc func;				// task function
+	ptr arg;							// task argument
+	dbl interval;						// seconds per tick
+	dbl owed;							// time not yet ticked
+	dbl alpha;							// interpolation fraction
+	size tickLimit;						// ticks per update limit
+	qword tickCount;					// number of ticks
+	iret result;						// last return value
+};
+
+
+// ijkScheduler
+//	Scheduler descriptor; drives tasks at independent rates from one clock. 
+//	Each update measures the time since the last and runs every fixed-rate 
+//	task as many whole ticks as it is owed, then every variable-rate task 
+//	once; between updates, the calling thread can sleep until a tick is due.
+//		member task: tasks in order of addition, which is the order run
+//		member taskCount: number of tasks
+//		member budget: most time one update may catch up, in seconds; any 
+//			more is dropped, so that a stall does not cause a spiral of 
+//			catch-up ticks
+//		member totalTime: time scheduled since start, in seconds
+//		member droppedTime: time dropped by budget since start, in seconds
+//		member updateCount: number of updates
+//		member handle: internal wait handle, not platform-specific
+//		member rate: internal clock rate
+//		member t0: internal clock at last update
+struct ijkScheduler
+{
+	ijkSchedulerTask task[ijk_scheduler_tasks];	// tasks
+	size taskCount;						// number of tasks
+	dbl budget;							// catch-up budget
+	dbl totalTime;						// time scheduled
+	dbl droppedTime;					// time dropped
+	qword updateCount;					// number of updates
+	ptr handle[1];						// internal wait handle
+	qword rate[1], t0[1];				// internal measurement
+};
+
+
+//-----------------------------------------------------------------------------
+
+// ijkSchedulerCreate
+//	Initialize scheduler with no tasks; the clock starts now.
+//		param scheduler_out: pointer to scheduler descriptor
+//			valid: non-null, uninitialized
+//		param budget: most time one update may catch up, in seconds
+//			valid: positive
+//		return SUCCESS: ijk_success if scheduler initialized
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if wait handle not created
+iret ijkSchedulerCreate(ijkScheduler* const scheduler_out, dbl const budget);
+
+// ijkSchedulerRelease
+//	Release scheduler and its wait handle.
+//		param scheduler: pointer to scheduler descriptor
+//			valid: non-null, initialized
+//		return SUCCESS: ijk_success if scheduler released
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkSchedulerRelease(ijkScheduler* const scheduler);
+
+// ijkSchedulerAddTask
+//	Add task to scheduler; tasks run in the order added.
+//		param scheduler: pointer to scheduler descriptor
+//			valid: non-null, initialized
+//		param func: function to call each tick
+//			valid: non-null
+//		param arg: argument pointer to pass to function
+//		param ticksPerSecond: tick rate
+//			note: if rate > 0, task ticks at fixed interval, starting one 
+//				interval after it is added
+//			note: if rate <= 0, task ticks once per update ("variable")
+//		param tickLimit: maximum ticks per update, below what the budget 
+//			allows; time owed beyond it is dropped
+//			note: pass zero to be limited by budget only
+//		param index_out_opt: optional pointer to storage for task index
+//		return SUCCESS: ijk_success if task added
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if scheduler is full
+iret ijkSchedulerAddTask(ijkScheduler* const scheduler, ijkSchedulerFunc const func, ptr const arg, dbl const ticksPerSecond, size const tickLimit, size* const index_out_opt);
+
+// ijkSchedulerUpdate
+//	Measure time since the last update and run tasks: each fixed-rate task 
+//	as many ticks as it is owed, then each variable-rate task once.
+//		param scheduler: pointer to scheduler descriptor
+//			valid: non-null, initialized
+//		param ticks_out_opt: optional pointer to storage for number of ticks 
+//			run, variable-rate ones included
+//		return SUCCESS: ijk_success if all time owed was ticked or carried
+//		return WARNING: ijk_warn_scheduler_dropped if some time was dropped
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkSchedulerUpdate(ijkScheduler* const scheduler, size* const ticks_out_opt);
+
+// ijkSchedulerWait
+//	Put calling thread to sleep until the next fixed-rate tick is due; it 
+//	sleeps most of the time with a high-resolution timer and yields for the 
+//	remainder, so it wakes within a small fraction of a millisecond without 
+//	busy polling. Returns at once if a tick is already due, or if there 
+//	are no fixed-rate tasks and no limit.
+//		param scheduler: pointer to scheduler descriptor
+//			valid: non-null, initialized
+//		param limit: longest time to wait, in seconds
+//			note: pass zero for no limit
+//		return SUCCESS: ijk_success if a tick is due, or limit reached
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkSchedulerWait(ijkScheduler* const scheduler, dbl const limit);
+
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef __cplusplus
+}
+#endif	// __cplusplus
+
+
+#endif	// !_IJK_SCHEDULER_H_
\ No newline at end of file
@@ -34,6 +34,8 @@
 extern "C" {
 #else	// !__cplusplus
 typedef struct ijkStream				ijkStream;
+typedef struct ijkStreamRequest			ijkStreamRequest;
+typedef struct ijkStreamAsync			ijkStreamAsync;
 #endif	// __cplusplus
 
 
@@ -46,18 +48,85 @@ typedef struct ijkStream				ijkStream;
 
 // ijkStream
 //	Stream descriptor.
-//		member base: pointer to base of stream contents
+//		member base: pointer to base of stream contents; buffer of buffered 
+//			file streams
 //		member head: pointer to current content head
-//		member length: length of contents
+//		member length: length of contents; bytes written to growable 
+//			buffers; bytes of file held in buffer of buffered file streams 
+//			(reading only)
+//		member capacity: size of buffer of buffered file streams and growable 
+//			buffers
+//		member position: file offset of buffer of buffered file streams
+//		member handle: internal file handle of buffered file streams
+//		member event: internal completion event of buffered file streams 
+//			(Windows only)
 //		member isRead: flag whether interface is used for reading
 //		member isFile: flag whether interface is used for file streaming
+//		member isMapped: flag whether contents are a read-only file mapping
+//		member isBuffered: flag whether file streaming goes through buffer
+//		member isGrowable: flag whether buffer grows as it is written
 struct ijkStream
 {
 	pbyte base;							// stream contents
 	pbyte head;							// content head
 	size length;						// length of contents
+	size capacity;						// size of buffer
+	size position;						// file offset of buffer
+	ptr handle;							// internal file handle
+	ptr event;							// internal completion event
 	ibool isRead;						// read flag
 	ibool isFile;						// file flag
+	ibool isMapped;						// mapped flag
+	ibool isBuffered;					// buffered flag
+	ibool isGrowable;					// growable flag
+};
+
+
+// ijkStreamRequest
+//	Completion handle of an asynchronous read or write; owned by the caller, 
+//	it must stay in place until done. The system does not touch it after 
+//	raising the done flag, so it may be discarded or reused as soon as it is 
+//	seen to be done.
+//		member data: pointer to data read or written
+//		member byteCount: number of bytes requested
+//		member offset: byte offset in file
+//		member handle: internal file handle
+//		member bytes: number of bytes transferred, once done
+//		member result: ijk_success if all bytes transferred, 
+//			ijk_warn_stream_incomplete if fewer (e.g. end of file), or 
+//			ijk_fail_operationfail if none, once done
+//		member done: non-zero once request has completed
+//		member isRead: flag whether request is a read
+struct ijkStreamRequest
+{
+	pbyte data;							// data
+	size byteCount;						// bytes requested
+	size offset;						// file offset
+	ptr handle;							// internal file handle
+	size bytes;							// bytes transferred
+	iret result;						// outcome
+	size volatile done;					// completion flag
+	ibool isRead;						// read flag
+};
+
+
+// ijkStreamAsync
+//	Asynchronous stream descriptor; keeps many reads and writes in flight at 
+//	once and completes them in the background, so that the calling thread 
+//	only issues requests and polls for their completion (e.g. once a frame). 
+//	Requests are batched: issuing one only queues it, and all queued ones 
+//	go out together on submit or poll. On Linux they go to the kernel in a 
+//	single call through an io_uring; elsewhere, or where the kernel does not 
+//	support one, a pool of worker threads performs the blocking calls. 
+//	Requests and polling are made from one thread.
+//		member data: internal state
+//		member capacity: most requests in flight
+//		member workerCount: number of worker threads; zero if kernel ring
+struct ijkStreamAsync
+{
+	ptr data;							// internal state
+	size capacity;						// most requests in flight
+	size workerCount;					// worker threads
 };
 
 
@@ -95,6 +164,26 @@ typedef iret(*ijkStreamWriteFunc)(ijkStream* const stream, kptr streamArg);
 //		return FAILURE: ijk_fail_operationfail if file not opened
 iret ijkStreamCreateFile(ijkStream* const stream_out, kcstr const filePath, ibool const readMode);
 
+// ijkStreamCreateFileBuffered
+//	Open file for read/write through a buffer of the caller's size. The file 
+//	is accessed with raw system calls, only when the buffer runs empty (read) 
+//	or full (write), so element-at-a-time streaming costs a copy instead of 
+//	a locked library call; requests at least as large as the buffer bypass 
+//	it. Buffered writes reach the file on flush, seek or release.
+//		param stream_out: pointer to stream descriptor
+//			valid: non-null, uninitialized
+//		param filePath: relative or absolute path to file to open
+//			valid: non-null, non-empty c-string
+//		param readMode: open file for reading if true, otherwise for writing
+//		param buffSize: size of buffer in bytes
+//			valid: non-zero
+//			note: larger buffers mean fewer system calls (e.g. 64 KiB or more)
+//		return SUCCESS: ijk_success if file opened
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if file not opened or buffer 
+//			not allocated
+iret ijkStreamCreateFileBuffered(ijkStream* const stream_out, kcstr const filePath, ibool const readMode, size const buffSize);
+
 // ijkStreamCreateBuffer
 //	Allocate empty string for writing.
 //		param stream_out: pointer to stream descriptor
@@ -108,6 +197,20 @@ iret ijkStreamCreateFile(ijkStream* const stream_out, kcstr const filePath, iboo
 //		return FAILURE: ijk_fail_operationfail if buffer not allocated
 iret ijkStreamCreateBuffer(ijkStream* const stream_out, size const buffSize, kcstr const readSource);
 
+// ijkStreamCreateBufferGrowable
+//	Allocate empty string for writing that grows as it is written, so that 
+//	the size of the contents need not be known in advance. The buffer at 
+//	least doubles each time it grows, so writing n bytes moves fewer than 
+//	2n in total; the length of contents is the number of bytes written.
+//		param stream_out: pointer to stream descriptor
+//			valid: non-null, uninitialized
+//		param buffSize: initial size of buffer in bytes
+//			valid: non-zero
+//		return SUCCESS: ijk_success if buffer allocated
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if buffer not allocated
+iret ijkStreamCreateBufferGrowable(ijkStream* const stream_out, size const buffSize);
+
 // ijkStreamLoadBuffer
 //	Allocate buffer from file for reading.
 //		param stream_out: pointer to stream descriptor
@@ -119,6 +222,24 @@ iret ijkStreamCreateBuffer(ijkStream* const stream_out, size const buffSize, kcs
 //		return FAILURE: ijk_fail_operationfail if file not loaded
 iret ijkStreamLoadBuffer(ijkStream* const stream_out, kcstr const filePath);
 
+// ijkStreamCreateMapped
+//	Map file into memory for reading, without copying; contents are paged 
+//	in from the file as they are read, so peak memory does not double and 
+//	the system can drop clean pages under pressure. The stream behaves as a 
+//	read buffer, so all buffer readers work unchanged.
+//		param stream_out: pointer to stream descriptor
+//			valid: non-null, uninitialized
+//		param filePath: relative or absolute path to file to map
+//			valid: non-null, non-empty c-string
+//		param sequential: hint that contents will be read front to back: 
+//			reading ahead starts at once and is more aggressive; otherwise 
+//			pages are read on demand, which suits random access
+//		return SUCCESS: ijk_success if file mapped
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if file not mapped (e.g. 
+//			missing, empty or larger than the address space)
+iret ijkStreamCreateMapped(ijkStream* const stream_out, kcstr const filePath, ibool const sequential);
+
 // ijkStreamSaveBuffer
 //	Store buffer in file.
 //	Allocate buffer from file for reading.
@@ -132,7 +253,7 @@ iret ijkStreamLoadBuffer(ijkStream* const stream_out, kcstr const filePath);
 iret ijkStreamSaveBuffer(ijkStream const* const stream, kcstr const filePath);
 
 // ijkStreamGetOffset
-//	Get number of bytes streamed.
+//	Get number of bytes streamed; for files, the byte offset in the file.
 //		param stream: pointer to constant stream descriptor
 //			valid: non-null, initialized
 //		param offset_out: pointer to value representing offset
@@ -140,24 +261,79 @@ iret ijkStreamSaveBuffer(ijkStream const* const stream, kcstr const filePath);
 //		return SUCCESS: ijk_success if retrieved number of bytes streamed
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
 //		return FAILURE: ijk_fail_operationfail if did not get value
-iret ijkStreamGetOffset(ijkStream const* const stream, size* const offset_out);
+ijk_inl iret ijkStreamGetOffset(ijkStream const* const stream, size* const offset_out);
+
+// ijkStreamGetLength
+//	Get total number of bytes in stream: contents of buffers and mapped 
+//	files, or size of file on disk (bytes still held in a write buffer are 
+//	not counted).
+//		param stream: pointer to constant stream descriptor
+//			valid: non-null, initialized
+//		param length_out: pointer to value representing length
+//			valid: non-null
+//		return SUCCESS: ijk_success if retrieved length
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if file size is not known
+iret ijkStreamGetLength(ijkStream const* const stream, size* const length_out);
+
+// ijkStreamSeek
+//	Move head to absolute byte offset. Buffered file streams flush pending 
+//	writes first; reading, they keep the buffer if the offset lies in it.
+//		param stream: pointer to stream descriptor
+//			valid: non-null, initialized
+//		param offset: byte offset from start of stream
+//			valid: no greater than length of contents, for buffer streams
+//		return SUCCESS: ijk_success if head moved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if pending writes failed, or if 
+//			file seek failed
+iret ijkStreamSeek(ijkStream* const stream, size const offset);
+
+// ijkStreamFlush
+//	Pass pending writes to file.
+//		param stream: pointer to stream descriptor
+//			valid: non-null, initialized, read flag disabled, file mode 
+//				enabled
+//		return SUCCESS: ijk_success if pending writes passed to file
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if write failed
+iret ijkStreamFlush(ijkStream* const stream);
 
 // ijkStreamBufferReset
 //	Reset buffer head.
 //		param stream: pointer to stream descriptor
 //			valid: non-null, initialized, file mode disabled
+//			note: mapped streams can only be reset for reading
+//			note: growable buffers reset for writing are emptied, keeping 
+//				their storage
 //		param readMode: reset in read mode if true, otherwise write
 //		return SUCCESS: ijk_success if stream reset
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkStreamBufferReset(ijkStream* const stream, ibool const readMode);
+ijk_inl iret ijkStreamBufferReset(ijkStream* const stream, ibool const readMode);
+
+// ijkStreamDetach
+//	Hand contents of buffer over to caller without copying, leaving the 
+//	stream uninitialized (no release needed).
+//		param stream: pointer to stream descriptor
+//			valid: non-null, initialized, file mode disabled, not mapped
+//		param data_out: pointer to storage for pointer to contents
+//			valid: non-null
+//			note: caller owns contents and frees them with free
+//		param length_out_opt: optional pointer to storage for length of 
+//			contents
+//		return SUCCESS: ijk_success if contents handed over
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkStreamDetach(ijkStream* const stream, ptr* const data_out, size* const length_out_opt);
 
 // ijkStreamRelease
-//	Close file or release string contents.
+//	Close file, unmap file or release string contents; buffered file 
+//	streams flush pending writes first.
 //		param stream: pointer to stream descriptor
 //			valid: non-null, initialized
 //		return SUCCESS: ijk_success if stream released
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-//		return FAILURE: ijk_fail_operationfail if stream not released
+//		return FAILURE: ijk_fail_operationfail if stream not released, or if 
+//			pending writes failed (stream is released)
 iret ijkStreamRelease(ijkStream* const stream);
 
 // ijkStreamRead
@@ -173,7 +349,7 @@ iret ijkStreamRelease(ijkStream* const stream);
 //		return SUCCESS: ijk_success if read succeeded
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
 //		return FAILURE: ijk_fail_operationfail if read failed
-iret ijkStreamRead(ijkStream* const stream, ijkStreamReadFunc const streamFunc, ptr streamArg, size* const bytes_opt);
+ijk_inl iret ijkStreamRead(ijkStream* const stream, ijkStreamReadFunc const streamFunc, ptr streamArg, size* const bytes_opt);
 
 // ijkStreamWrite
 //	Write to stream using callback.
@@ -188,7 +364,7 @@ iret ijkStreamRead(ijkStream* const stream, ijkStreamReadFunc const streamFunc,
 //		return SUCCESS: ijk_success if write succeeded
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
 //		return FAILURE: ijk_fail_operationfail if write failed
-iret ijkStreamWrite(ijkStream* const stream, ijkStreamWriteFunc const streamFunc, kptr streamArg, size* const bytes_opt);
+ijk_inl iret ijkStreamWrite(ijkStream* const stream, ijkStreamWriteFunc const streamFunc, kptr streamArg, size* const bytes_opt);
 
 
 //-----------------------------------------------------------------------------
@@ -212,11 +388,32 @@ iret ijkStreamWrite(ijkStream* const stream, ijkStreamWriteFunc const streamFunc
 //		return FAILURE: ijk_fail_operationfail if read failed
 iret ijkStreamReadElement(ijkStream* const stream, ptr const elem, size const elemSize, size const elemCount, size* const bytes_opt);
 
+// ijkStreamPeek
+//	Get pointer to contents at head instead of copying them out; for 
+//	mapped streams this reads straight from the mapping.
+//		param stream: pointer to stream descriptor.
+//			valid: non-null, initialized, read flag enabled, file mode 
+//				disabled
+//		param data_out: pointer to storage for pointer to contents
+//			valid: non-null
+//			note: valid until stream is released
+//		param byteCount: number of bytes wanted
+//			valid: non-zero
+//		param advance: move head past bytes if true, as reading would
+//		param bytes_opt: optional pointer to value holding number of bytes 
+//			available; used for caller validation
+//		return SUCCESS: ijk_success if expected number of bytes available
+//		return WARNING: ijk_warn_stream_incomplete if fewer bytes available
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if no bytes available
+iret ijkStreamPeek(ijkStream* const stream, kptr* const data_out, size const byteCount, ibool const advance, size* const bytes_opt);
+
 // ijkStreamWriteElement
 //	Write single element to stream.
 //		param stream: pointer to stream descriptor.
 //			valid: non-null, initialized, read flag disabled
 //			note: writes to file if file flag is raised
+//			note: growable buffers grow to fit element
 //		param elem: pointer to constant element to write
 //			valid: non-null
 //		param elemSize: size of element
@@ -232,6 +429,123 @@ iret ijkStreamReadElement(ijkStream* const stream, ptr const elem, size const el
 iret ijkStreamWriteElement(ijkStream* const stream, kptr const elem, size const elemSize, size const elemCount, size* const bytes_opt);
 
 
+//-----------------------------------------------------------------------------
+
+// ijkStreamAsyncCreate
+//	Initialize asynchronous stream system.
+//		param async_out: pointer to asynchronous stream descriptor
+//			valid: non-null, uninitialized
+//		param capacity: most requests in flight, queued or submitted
+//			valid: non-zero, at most 4096
+//		param workerCount: number of worker threads if kernel ring is not 
+//			used
+//			valid: non-zero
+//			note: reads from storage rarely gain beyond a few (e.g. 4)
+//		param kernelRing: use kernel ring where available if true, otherwise 
+//			always use worker threads
+//		return SUCCESS: ijk_success if system initialized
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if system not initialized
+iret ijkStreamAsyncCreate(ijkStreamAsync* const async_out, size const capacity, size const workerCount, ibool const kernelRing);
+
+// ijkStreamAsyncRelease
+//	Wait for all requests to complete, then stop worker threads or close 
+//	kernel ring and release system.
+//		param async: pointer to asynchronous stream descriptor
+//			valid: non-null, initialized
+//		return SUCCESS: ijk_success if system released
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if worker not stopped
+iret ijkStreamAsyncRelease(ijkStreamAsync* const async);
+
+// ijkStreamReadAsync
+//	Queue read of bytes at file offset; the stream's own head and buffer are 
+//	neither used nor moved.
+//		param async: pointer to asynchronous stream descriptor
+//			valid: non-null, initialized
+//		param stream: pointer to constant stream descriptor
+//			valid: non-null, initialized, read flag enabled, buffered file 
+//				(ijkStreamCreateFileBuffered)
+//			note: must stay open until request is done
+//		param data: pointer to storage for bytes read
+//			valid: non-null
+//			note: must stay in place until request is done
+//		param byteCount: number of bytes to read
+//			valid: non-zero, at most 1 GiB
+//		param offset: byte offset in file
+//		param request_out: pointer to completion handle
+//			valid: non-null, not in flight
+//		return SUCCESS: ijk_success if request queued
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if capacity requests are in 
+//			flight; poll and retry
+iret ijkStreamReadAsync(ijkStreamAsync* const async, ijkStream const* const stream, ptr const data, size const byteCount, size const offset, ijkStreamRequest* const request_out);
+
+// ijkStreamWriteAsync
+//	Queue write of bytes at file offset; the stream's own head and buffer 
+//	are neither used nor moved.
+//		param async: pointer to asynchronous stream descriptor
+//			valid: non-null, initialized
+//		param stream: pointer to constant stream descriptor
+//			valid: non-null, initialized, read flag disabled, buffered file 
+//				(ijkStreamCreateFileBuffered)
+//			note: must stay open until request is done
+//		param data: pointer to constant bytes to write
+//			valid: non-null
+//			note: must stay in place and unchanged until request is done
+//		param byteCount: number of bytes to write
+//			valid: non-zero, at most 1 GiB
+//		param offset: byte offset in file
+//		param request_out: pointer to completion handle
+//			valid: non-null, not in flight
+//		return SUCCESS: ijk_success if request queued
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if capacity requests are in 
+//			flight; poll and retry
+iret ijkStreamWriteAsync(ijkStreamAsync* const async, ijkStream const* const stream, kptr const data, size const byteCount, size const offset, ijkStreamRequest* const request_out);
+
+// ijkStreamAsyncSubmit
+//	Send all queued requests on, without waiting; polling also does this.
+//		param async: pointer to asynchronous stream descriptor
+//			valid: non-null, initialized
+//		return SUCCESS: ijk_success if all queued requests sent
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if kernel took none; they 
+//			stay queued for the next submit
+iret ijkStreamAsyncSubmit(ijkStreamAsync* const async);
+
+// ijkStreamAsyncPoll
+//	Submit queued requests and mark completed ones done, without waiting.
+//		param async: pointer to asynchronous stream descriptor
+//			valid: non-null, initialized
+//		param count_out_opt: optional pointer to storage for number of 
+//			requests still in flight
+//		return SUCCESS: ijk_success if polled
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkStreamAsyncPoll(ijkStreamAsync* const async, size* const count_out_opt);
+
+// ijkStreamAsyncWait
+//	Submit queued requests and put calling thread to sleep until a request, 
+//	or all of them, are done.
+//		param async: pointer to asynchronous stream descriptor
+//			valid: non-null, initialized
+//		param request_opt: pointer to completion handle to wait for
+//			note: pass null to wait for all requests
+//		return SUCCESS: ijk_success if done
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if kernel ring failed
+iret ijkStreamAsyncWait(ijkStreamAsync* const async, ijkStreamRequest const* const request_opt);
+
+// ijkStreamRequestIsDone
+//	Check if a request has completed; its results are valid once it has.
+//		param request: pointer to completion handle
+//			valid: non-null
+//		return SUCCESS: ijk_true if request is done
+//		return SUCCESS: ijk_false if request is in flight
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkStreamRequestIsDone(ijkStreamRequest const* const request);
+
+
 //-----------------------------------------------------------------------------
 
 // ijkStreamMakeDirectory
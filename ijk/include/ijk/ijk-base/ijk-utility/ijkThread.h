@@ -33,8 +33,13 @@
 #ifdef __cplusplus
 extern "C" {
 #else	// !__cplusplus
+typedef enum		ijkThreadPriority	ijkThreadPriority;
 typedef struct		ijkThread			ijkThread;
 typedef struct		ijkMutex			ijkMutex;
+typedef struct		ijkEvent			ijkEvent;
+typedef struct		ijkSemaphore		ijkSemaphore;
+typedef struct		ijkRWLock			ijkRWLock;
+typedef struct		ijkBarrier			ijkBarrier;
 #endif	// __cplusplus
 
 
@@ -53,33 +58,114 @@ typedef struct		ijkMutex			ijkMutex;
 typedef iret(*ijkThreadEntryFunc)(ptr entryArg);
 
 
+// ijkThreadPriority
+//	Enumeration of thread scheduling priorities, relative to normal.
+enum ijkThreadPriority
+{
+	ijkThreadPriority_lowest = -2,
+	ijkThreadPriority_low,
+	ijkThreadPriority_normal,
+	ijkThreadPriority_high,
+	ijkThreadPriority_highest,
+};
+
+
 // ijkThread
 //	Thread descriptor.
 //		member handle: internal thread handle(s), not platform-specific
 //		member entryFunc: function to call for entry point
 //		member entryArg: argument pointer to pass to entry function
 //		member name: name of thread to appear in debugging interface
-//		member sysID: system ID number of thread, identifier for handle
+//		member sysID: system ID number of thread, identifier for handle; 
+//			valid from creation until thread is released
 //		member active: boolean flag describing whether thread is running
+//		member cancel: boolean flag raised to request thread to finish
 //		member result: integer return value from entry function
+//		member priority: scheduling priority of thread
+//		member affinity: mask of cores thread may run on; zero if any
 struct ijkThread
 {
 	ptr handle[2];					// internal handles
 	ijkThreadEntryFunc entryFunc;	// entry function
 	ptr entryArg;					// entry argument
 	tag name;						// name of thread
-	dword sysID;					// system ID of thread
-	ibool active;					// whether thread is still executing
+	dword volatile sysID;			// system ID of thread
+	ibool volatile active;			// whether thread is still executing
+	ibool volatile cancel;			// whether thread was asked to finish
 	iret result;					// return value from entry function
+	ijkThreadPriority priority;		// scheduling priority
+	size affinity;					// core mask
 };
 
 
 // ijkMutex
-//	Simple mutex (mutual exclusion) descriptor.
+//	Mutex (mutual exclusion) descriptor; zero-initialized is unlocked. 
+//	Waiting threads spin briefly, then sleep until woken by unlock.
 //		member sysID: system ID number of thread holding mutex
+//		member state: zero if unlocked, one if locked, two if locked and 
+//			other threads may be sleeping on it
 struct ijkMutex
 {
-	dword sysID;					// system ID of holding thread
+	dword volatile sysID;			// system ID of holding thread
+	dword volatile state;			// lock state
+};
+
+
+// ijkEvent
+//	Event descriptor; threads wait until it is signaled. An auto-reset 
+//	event lets one waiter through per signal; a manual-reset event stays 
+//	signaled, letting all through, until reset. Zero-initialized is an 
+//	unsignaled auto-reset event.
+//		member state: one if signaled, zero if not
+//		member waiting: number of threads sleeping or about to
+//		member manual: non-zero if manual-reset
+struct ijkEvent
+{
+	dword volatile state;			// signaled
+	dword volatile waiting;			// sleepers
+	dword manual;					// manual-reset
+};
+
+
+// ijkSemaphore
+//	Counting semaphore descriptor; threads acquire units of a count, 
+//	waiting while it is zero. Zero-initialized has no units.
+//		member count: number of units available
+//		member waiting: number of threads sleeping or about to
+struct ijkSemaphore
+{
+	dword volatile count;			// available units
+	dword volatile waiting;			// sleepers
+};
+
+
+// ijkRWLock
+//	Reader-writer lock descriptor; any number of readers or one writer may 
+//	hold it. Writers are preferred: once a writer waits, new readers wait 
+//	behind it, so frequent readers cannot starve writers. Zero-initialized 
+//	is unlocked.
+//		member state: number of readers holding lock, or high bit if a 
+//			writer holds it
+//		member writers: number of writers holding or waiting for lock
+struct ijkRWLock
+{
+	dword volatile state;			// readers or writer holding
+	dword volatile writers;			// writers holding or waiting
+};
+
+
+// ijkBarrier
+//	Reusable barrier descriptor; threads wait until a set number of them 
+//	have arrived, then all continue and the barrier resets for the next 
+//	phase.
+//		member count: number of threads per phase
+//		member arrived: number of threads arrived in current phase
+//		member phase: number of phases completed
+struct ijkBarrier
+{
+	dword count;					// threads per phase
+	dword volatile arrived;			// arrived this phase
+	dword volatile phase;			// phases completed
 };
 
 
@@ -100,6 +186,29 @@ struct ijkMutex
 //		return FAILURE: ijk_fail_operationfail if thread not created
 iret ijkThreadCreate(ijkThread* const thread_out, ijkThreadEntryFunc const entryFunc, ptr const entryArg, tag const name);
 
+// ijkThreadCreateExt
+//	Create and launch a thread with stack size, cores and priority; these 
+//	apply before the entry function is called.
+//		param thread_out: pointer to thread descriptor
+//			valid: non-null, uninitialized
+//		param entryFunc: function to call when thread initializes
+//			valid: non-null
+//		param entryArg: argument to pass to entryFunc when it is called
+//			note: pass null/zero if no argument to pass to entryFunc
+//		param name: short name of thread
+//			note: pass empty string "" to use default name; debuggers on 
+//				some platforms only show the first 15 characters
+//		param stackSize: size of thread's stack in bytes
+//			note: pass zero to use default size; may be rounded up
+//		param affinity: mask of cores thread may run on (bit 0 is core 0)
+//			note: pass zero to allow any core
+//		param priority: scheduling priority of thread
+//			note: raising priority may need elevated privileges
+//		return SUCCESS: ijk_success if thread created
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if thread not created
+iret ijkThreadCreateExt(ijkThread* const thread_out, ijkThreadEntryFunc const entryFunc, ptr const entryArg, tag const name, size const stackSize, size const affinity, ijkThreadPriority const priority);
+
 // ijkThreadRelease
 //	Wait indefinitely for a thread to safely finish.
 //		param thread: pointer to thread descriptor
@@ -110,7 +219,10 @@ iret ijkThreadCreate(ijkThread* const thread_out, ijkThreadEntryFunc const entry
 iret ijkThreadRelease(ijkThread* const thread);
 
 // ijkThreadReleaseUnsafe
-//	Terminate a thread.
+//	Terminate a thread without waiting for it to finish; it gets no chance 
+//	to clean up, so prefer ijkThreadCancel followed by ijkThreadRelease. 
+//	Where threads cannot be terminated outright, the thread is cancelled at 
+//	its next blocking system call.
 //		param thread: pointer to thread descriptor
 //			valid: non-null, initialized
 //		return SUCCESS: ijk_success if thread terminated
@@ -127,6 +239,63 @@ iret ijkThreadReleaseUnsafe(ijkThread* const thread);
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
 iret ijkThreadCheckActive(ijkThread const* const thread);
 
+// ijkThreadCancel
+//	Ask a thread to finish by raising its cancellation flag; the thread 
+//	stops when its entry function checks the flag (ijkThreadCheckCancel) 
+//	and returns. Does not wait; release the thread to wait.
+//		param thread: pointer to thread descriptor
+//			valid: non-null, initialized
+//		return SUCCESS: ijk_success if flag raised
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkThreadCancel(ijkThread* const thread);
+
+// ijkThreadCheckCancel
+//	Check whether the calling thread was asked to finish; entry functions 
+//	that loop should call this and return when it is raised.
+//		return SUCCESS: ijk_true if calling thread was cancelled
+//		return SUCCESS: ijk_false if not cancelled, or not created by ijk
+iret ijkThreadCheckCancel();
+
+// ijkThreadGetCurrent
+//	Get descriptor of calling thread, e.g. to read its name.
+//		param thread_out: pointer to storage for descriptor pointer
+//			valid: non-null
+//		return SUCCESS: ijk_success if calling thread was created by ijk
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if not created by ijk
+iret ijkThreadGetCurrent(ijkThread const** const thread_out);
+
+// ijkThreadSetAffinity
+//	Set the cores a thread may run on.
+//		param thread_opt: pointer to thread descriptor
+//			note: pass null to apply to calling thread
+//		param affinity: mask of cores thread may run on (bit 0 is core 0)
+//			note: pass zero to allow any core
+//		return SUCCESS: ijk_success if affinity changed
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if affinity not changed
+iret ijkThreadSetAffinity(ijkThread* const thread_opt, size const affinity);
+
+// ijkThreadSetPriority
+//	Set the scheduling priority of a thread.
+//		param thread_opt: pointer to thread descriptor
+//			note: pass null to apply to calling thread
+//		param priority: scheduling priority of thread
+//			valid: ijkThreadPriority enumerator
+//			note: raising priority may need elevated privileges
+//		return SUCCESS: ijk_success if priority changed
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if priority not changed
+iret ijkThreadSetPriority(ijkThread* const thread_opt, ijkThreadPriority const priority);
+
+// ijkThreadGetCoreCount
+//	Get the number of cores available to run threads.
+//		param count_out: pointer to storage for count
+//			valid: non-null
+//		return SUCCESS: ijk_success if count retrieved
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkThreadGetCoreCount(size* const count_out);
+
 
 //-----------------------------------------------------------------------------
 
@@ -141,7 +310,8 @@ iret ijkThreadCheckActive(ijkThread const* const thread);
 iret ijkMutexLock(ijkMutex* const mutex);
 
 // ijkMutexLockWait
-//	Perpetual attempt to lock mutex handle.
+//	Perpetual attempt to lock mutex handle; spins for a short while, then 
+//	sleeps until the mutex is unlocked.
 //		param mutex: pointer to mutex descriptor
 //			valid: non-null
 //		return SUCCESS: ijk_success if mutex successfully locked
@@ -151,7 +321,8 @@ iret ijkMutexLock(ijkMutex* const mutex);
 iret ijkMutexLockWait(ijkMutex* const mutex);
 
 // ijkMutexUnlock
-//	Unlock (release control of) mutex handle if calling thread holds it.
+//	Unlock (release control of) mutex handle if calling thread holds it, 
+//	waking one sleeping thread if any.
 //		param mutex: pointer to mutex descriptor
 //			valid: non-null
 //		return SUCCESS: ijk_success if mutex successfully unlocked
@@ -166,7 +337,7 @@ iret ijkMutexUnlock(ijkMutex* const mutex);
 //		return SUCCESS: ijk_true if mutex is locked
 //		return SUCCESS: ijk_false if mutex is unlocked
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMutexIsLocked(ijkMutex const* const mutex);
+ijk_inl iret ijkMutexIsLocked(ijkMutex const* const mutex);
 
 // ijkMutexIsLockedByCaller
 //	Check if mutex is locked by calling thread.
@@ -175,7 +346,7 @@ iret ijkMutexIsLocked(ijkMutex const* const mutex);
 //		return SUCCESS: ijk_true if mutex is locked by caller
 //		return SUCCESS: ijk_false if mutex is unlocked
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMutexIsLockedByCaller(ijkMutex const* const mutex);
+ijk_inl iret ijkMutexIsLockedByCaller(ijkMutex const* const mutex);
 
 // ijkMutexIsUnlocked
 //	Check if mutex is unlocked.
@@ -184,7 +355,311 @@ iret ijkMutexIsLockedByCaller(ijkMutex const* const mutex);
 //		return SUCCESS: ijk_true if mutex is unlocked
 //		return SUCCESS: ijk_false if mutex is locked
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkMutexIsUnlocked(ijkMutex const* const mutex);
+ijk_inl iret ijkMutexIsUnlocked(ijkMutex const* const mutex);
+
+
+//-----------------------------------------------------------------------------
+
+// ijkEventCreate
+//	Initialize event.
+//		param event_out: pointer to event descriptor
+//			valid: non-null
+//			note: no thread may be waiting on event
+//		param manual: whether event stays signaled until reset
+//		param signaled: whether event starts signaled
+//		return SUCCESS: ijk_success if event initialized
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkEventCreate(ijkEvent* const event_out, ibool const manual, ibool const signaled);
+
+// ijkEventSignal
+//	Signal event, waking one waiting thread if auto-reset, or all if manual.
+//		param event: pointer to event descriptor
+//			valid: non-null
+//		return SUCCESS: ijk_success if event signaled
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkEventSignal(ijkEvent* const event);
+
+// ijkEventReset
+//	Return event to unsignaled.
+//		param event: pointer to event descriptor
+//			valid: non-null
+//		return SUCCESS: ijk_success if event reset
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkEventReset(ijkEvent* const event);
+
+// ijkEventCheck
+//	Single check whether event is signaled; an auto-reset event is reset 
+//	if so, as if waited on.
+//		param event: pointer to event descriptor
+//			valid: non-null
+//		return SUCCESS: ijk_true if event was signaled
+//		return SUCCESS: ijk_false if event was not signaled
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkEventCheck(ijkEvent* const event);
+
+// ijkEventWait
+//	Wait for event to be signaled; spins for a short while, then sleeps. 
+//	An auto-reset event is reset on the way out.
+//		param event: pointer to event descriptor
+//			valid: non-null
+//		return SUCCESS: ijk_success if event was signaled
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkEventWait(ijkEvent* const event);
+
+
+//-----------------------------------------------------------------------------
+
+// ijkSemaphoreCreate
+//	Initialize semaphore.
+//		param semaphore_out: pointer to semaphore descriptor
+//			valid: non-null
+//			note: no thread may be waiting on semaphore
+//		param count: number of units initially available
+//		return SUCCESS: ijk_success if semaphore initialized
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkSemaphoreCreate(ijkSemaphore* const semaphore_out, dword const count);
+
+// ijkSemaphoreAcquire
+//	Single attempt to take one unit from semaphore.
+//		param semaphore: pointer to semaphore descriptor
+//			valid: non-null
+//		return SUCCESS: ijk_success if unit taken
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if no units available
+iret ijkSemaphoreAcquire(ijkSemaphore* const semaphore);
+
+// ijkSemaphoreAcquireWait
+//	Perpetual attempt to take one unit from semaphore; spins for a short 
+//	while, then sleeps until units are posted.
+//		param semaphore: pointer to semaphore descriptor
+//			valid: non-null
+//		return SUCCESS: ijk_success if unit taken
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkSemaphoreAcquireWait(ijkSemaphore* const semaphore);
+
+// ijkSemaphorePost
+//	Return units to semaphore, waking as many sleeping threads.
+//		param semaphore: pointer to semaphore descriptor
+//			valid: non-null
+//		param count: number of units to add
+//			valid: non-zero
+//		return SUCCESS: ijk_success if units added
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkSemaphorePost(ijkSemaphore* const semaphore, dword const count);
+
+
+//-----------------------------------------------------------------------------
+
+// ijkRWLockRead
+//	Single attempt to lock for reading; fails while a writer holds or waits.
+//		param lock: pointer to reader-writer lock descriptor
+//			valid: non-null
+//		return SUCCESS: ijk_success if locked for reading
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if not locked
+iret ijkRWLockRead(ijkRWLock* const lock);
+
+// ijkRWLockReadWait
+//	Perpetual attempt to lock for reading; spins for a short while, then 
+//	sleeps until no writer holds or waits.
+//		param lock: pointer to reader-writer lock descriptor
+//			valid: non-null
+//			note: do not lock for reading again while holding it; a writer 
+//				waiting in between would deadlock
+//		return SUCCESS: ijk_success if locked for reading
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkRWLockReadWait(ijkRWLock* const lock);
+
+// ijkRWLockReadUnlock
+//	Unlock from reading, waking a waiting writer if last reader.
+//		param lock: pointer to reader-writer lock descriptor
+//			valid: non-null
+//		return SUCCESS: ijk_success if unlocked
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if not locked for reading
+iret ijkRWLockReadUnlock(ijkRWLock* const lock);
+
+// ijkRWLockWrite
+//	Single attempt to lock for writing; fails while anyone holds lock.
+//		param lock: pointer to reader-writer lock descriptor
+//			valid: non-null
+//		return SUCCESS: ijk_success if locked for writing
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if not locked
+iret ijkRWLockWrite(ijkRWLock* const lock);
+
+// ijkRWLockWriteWait
+//	Perpetual attempt to lock for writing; holds back new readers, spins 
+//	for a short while, then sleeps until current holders unlock.
+//		param lock: pointer to reader-writer lock descriptor
+//			valid: non-null
+//		return SUCCESS: ijk_success if locked for writing
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkRWLockWriteWait(ijkRWLock* const lock);
+
+// ijkRWLockWriteUnlock
+//	Unlock from writing, waking the next writer if any, otherwise readers.
+//		param lock: pointer to reader-writer lock descriptor
+//			valid: non-null
+//		return SUCCESS: ijk_success if unlocked
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+//		return FAILURE: ijk_fail_operationfail if not locked for writing
+iret ijkRWLockWriteUnlock(ijkRWLock* const lock);
+
+
+//-----------------------------------------------------------------------------
+
+// ijkBarrierCreate
+//	Initialize barrier.
+//		param barrier_out: pointer to barrier descriptor
+//			valid: non-null
+//			note: no thread may be waiting on barrier
+//		param count: number of threads per phase
+//			valid: non-zero
+//		return SUCCESS: ijk_success if barrier initialized
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkBarrierCreate(ijkBarrier* const barrier_out, dword const count);
+
+// ijkBarrierWait
+//	Arrive at barrier and wait for the rest of the phase; spins for a short 
+//	while, then sleeps. The barrier is ready for the next phase on return.
+//		param barrier: pointer to barrier descriptor
+//			valid: non-null, initialized
+//		return SUCCESS: ijk_true for exactly one thread per phase (the last 
+//			to arrive), e.g. to do serial work between phases
+//		return SUCCESS: ijk_false for the other threads
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkBarrierWait(ijkBarrier* const barrier);
+
+
+//-----------------------------------------------------------------------------
+
+// ijkAtomicLoad
+//	Read a value shared between threads; reads and writes that follow cannot 
+//	be reordered before it (acquire).
+//		param value: pointer to shared value
+//			valid: non-null, aligned
+//		return: current value
+size ijkAtomicLoad(size volatile const* const value);
+
+// ijkAtomicStore
+//	Write a value shared between threads; reads and writes that precede 
+//	cannot be reordered after it (release).
+//		param value: pointer to shared value
+//			valid: non-null, aligned
+//		param desired: value to write
+//		return: desired
+size ijkAtomicStore(size volatile* const value, size const desired);
+
+// ijkAtomicExchange
+//	Replace a value shared between threads (full barrier).
+//		param value: pointer to shared value
+//			valid: non-null, aligned
+//		param desired: value to write
+//		return: previous value
+size ijkAtomicExchange(size volatile* const value, size const desired);
+
+// ijkAtomicCompareExchange
+//	Replace a value shared between threads only if it holds the expected 
+//	value (full barrier).
+//		param value: pointer to shared value
+//			valid: non-null, aligned
+//		param desired: value to write
+//		param expected: value that must be held for write to occur
+//		return: previous value; write occurred if equal to expected
+size ijkAtomicCompareExchange(size volatile* const value, size const desired, size const expected);
+
+// ijkAtomicAdd
+//	Add to a value shared between threads (full barrier).
+//		param value: pointer to shared value
+//			valid: non-null, aligned
+//		param delta: amount to add; wraps, so may be negated to subtract
+//		return: previous value
+size ijkAtomicAdd(size volatile* const value, size const delta);
+
+// ijkAtomicLoadQ
+//	Read a quad-word shared between threads (acquire).
+//		param value: pointer to shared value
+//			valid: non-null, aligned to eight bytes
+//		return: current value
+qword ijkAtomicLoadQ(qword volatile const* const value);
+
+// ijkAtomicCompareExchangeQ
+//	Replace a quad-word shared between threads only if it holds the 
+//	expected value (full barrier); available on all architectures, e.g. 
+//	for pairing a pointer-size value with a counter.
+//		param value: pointer to shared value
+//			valid: non-null, aligned to eight bytes
+//		param desired: value to write
+//		param expected: value that must be held for write to occur
+//		return: previous value; write occurred if equal to expected
+qword ijkAtomicCompareExchangeQ(qword volatile* const value, qword const desired, qword const expected);
+
+// ijkAtomicPause
+//	Hint to the processor that the calling thread is spinning on a shared 
+//	value, to save power and yield to a sibling hardware thread.
+void ijkAtomicPause();
+
+// ijkAtomicLoadD
+//	Read a double-word shared between threads (acquire).
+//		param value: pointer to shared value
+//			valid: non-null, aligned to four bytes
+//		return: current value
+dword ijkAtomicLoadD(dword volatile const* const value);
+
+// ijkAtomicStoreD
+//	Write a double-word shared between threads (release).
+//		param value: pointer to shared value
+//			valid: non-null, aligned to four bytes
+//		param desired: value to write
+//		return: desired
+dword ijkAtomicStoreD(dword volatile* const value, dword const desired);
+
+// ijkAtomicExchangeD
+//	Replace a double-word shared between threads (full barrier).
+//		param value: pointer to shared value
+//			valid: non-null, aligned to four bytes
+//		param desired: value to write
+//		return: previous value
+dword ijkAtomicExchangeD(dword volatile* const value, dword const desired);
+
+// ijkAtomicCompareExchangeD
+//	Replace a double-word shared between threads only if it holds the 
+//	expected value (full barrier).
+//		param value: pointer to shared value
+//			valid: non-null, aligned to four bytes
+//		param desired: value to write
+//		param expected: value that must be held for write to occur
+//		return: previous value; write occurred if equal to expected
+dword ijkAtomicCompareExchangeD(dword volatile* const value, dword const desired, dword const expected);
+
+// ijkAtomicAddD
+//	Add to a double-word shared between threads (full barrier).
+//		param value: pointer to shared value
+//			valid: non-null, aligned to four bytes
+//		param delta: amount to add; wraps, so may be negated to subtract
+//		return: previous value
+dword ijkAtomicAddD(dword volatile* const value, dword const delta);
+
+// ijkAtomicWaitD
+//	Put calling thread to sleep while a double-word shared between threads 
+//	holds the expected value (futex on Linux, address wait on Windows).
+//		param value: pointer to shared value
+//			valid: non-null, aligned to four bytes
+//		param expected: value for which to sleep; returns immediately if 
+//			value differs
+//		return: current value; may still be expected after a spurious wake, 
+//			so callers re-check their condition in a loop
+dword ijkAtomicWaitD(dword volatile* const value, dword const expected);
+
+// ijkAtomicWakeD
+//	Wake threads sleeping on a double-word shared between threads.
+//		param value: pointer to shared value
+//			valid: non-null, aligned to four bytes
+//		param count: maximum number of threads to wake; zero wakes all
+//		return: count
+dword ijkAtomicWakeD(dword volatile* const value, dword const count);
+
 
 
 //-----------------------------------------------------------------------------
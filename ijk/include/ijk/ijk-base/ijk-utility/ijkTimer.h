@@ -106,7 +106,7 @@ iret ijkTimerStop(ijkTimer* const timer);
 //			valid: non-null
 //		return SUCCESS: ijk_success if timer paused
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkTimerPause(ijkTimer* const timer);
+ijk_inl iret ijkTimerPause(ijkTimer* const timer);
 
 // ijkTimerResume
 //	Continue counting time; does not measure current tick.
@@ -114,7 +114,7 @@ iret ijkTimerPause(ijkTimer* const timer);
 //			valid: non-null
 //		return SUCCESS: ijk_success if timer resumed
 //		return FAILURE: ijk_fail_invalidparams if invalid parameters
-iret ijkTimerResume(ijkTimer* const timer);
+ijk_inl iret ijkTimerResume(ijkTimer* const timer);
 
 // ijkTimerCheckTick
 //	Measure current tick and accumulate time.
@@ -127,6 +127,24 @@ iret ijkTimerResume(ijkTimer* const timer);
 iret ijkTimerCheckTick(ijkTimer* const timer);
 
 
+//-----------------------------------------------------------------------------
+
+// ijkTimerNow
+//	Read the raw tick counter that timers use: the performance counter on 
+//	Windows, elsewhere the invariant time stamp counter if the processor 
+//	has one, else the raw monotonic clock. Ticks never go backwards or jump 
+//	with wall clock adjustments, and reading costs no system call where the 
+//	counter is available, so it suits timing many small scopes.
+//		return: current ticks
+qword ijkTimerNow();
+
+// ijkTimerNowRate
+//	Get the rate of the raw tick counter; the time stamp counter's is taken 
+//	from the processor or measured once at startup.
+//		return: ticks per second
+qword ijkTimerNowRate();
+
+
 //-----------------------------------------------------------------------------
 
 
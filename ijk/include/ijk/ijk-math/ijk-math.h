@@ -36,6 +36,7 @@
 #include "ijk-real/ijkVector.h"
 #include "ijk-real/ijkMatrix.h"
 #include "ijk-real/ijkQuaternion.h"
+#include "ijk-real/ijkParallel.h"
 
 
 #endif	// !_IJK_MATH_H_
\ No newline at end of file
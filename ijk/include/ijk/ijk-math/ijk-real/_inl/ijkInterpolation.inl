@@ -136,6 +136,7 @@ ijk_inl flt ijkInterpSmootherstep_flt(flt const t)
 ijk_inl flt ijkInterpBezier0_flt(flt const v0, flt const t)
 {
 	// base case: always return v0 regardless of parameter
+	ijk_unused(t);
 	return (v0);
 }
 
@@ -567,6 +568,7 @@ ijk_inl dbl ijkInterpSmootherstep_dbl(dbl const t)
 ijk_inl dbl ijkInterpBezier0_dbl(dbl const v0, dbl const t)
 {
 	// base case: always return v0 regardless of parameter
+	ijk_unused(t);
 	return (v0);
 }
 
@@ -72,8 +72,9 @@ ijk_inl flt ijkTrigValidateInverseRecip_flt(flt x)
 
 ijk_inl flt ijkTrigSinCos_deg_flt(flt const x, flt* const sinx_out, flt* const cosx_out)
 {
-	ijk_ext size const ijkTrigSubdivisionsPerDegree_flt;
-	ijk_ext flt const ijkTrigSubdivisionsPerDegreeInv_flt, * const ijkTrigTableSin_flt, * const ijkTrigTableCos_flt;
+	ijk_ext size ijkTrigSubdivisionsPerDegree_flt;
+	ijk_ext flt ijkTrigSubdivisionsPerDegreeInv_flt;
+	ijk_ext flt const* ijkTrigTableSin_flt, * ijkTrigTableCos_flt;
 	flt f = (x + flt_360) * (flt)ijkTrigSubdivisionsPerDegree_flt;
 	index const i = (index)f, j = i + 1;
 	f = (f - (flt)i) * ijkTrigSubdivisionsPerDegreeInv_flt;
@@ -85,8 +86,9 @@ ijk_inl flt ijkTrigSinCos_deg_flt(flt const x, flt* const sinx_out, flt* const c
 
 ijk_inl flt ijkTrigTanSinCos_deg_flt(flt const x, flt* const sinx_out, flt* const cosx_out)
 {
-	ijk_ext size const ijkTrigSubdivisionsPerDegree_flt;
-	ijk_ext flt const ijkTrigSubdivisionsPerDegreeInv_flt, * const ijkTrigTableSin_flt, * const ijkTrigTableCos_flt;
+	ijk_ext size ijkTrigSubdivisionsPerDegree_flt;
+	ijk_ext flt ijkTrigSubdivisionsPerDegreeInv_flt;
+	ijk_ext flt const* ijkTrigTableSin_flt, * ijkTrigTableCos_flt;
 	flt f = (x + flt_360) * (flt)ijkTrigSubdivisionsPerDegree_flt, s, c;
 	index const i = (index)f, j = i + 1;
 	f = (f - (flt)i) * ijkTrigSubdivisionsPerDegreeInv_flt;
@@ -98,8 +100,9 @@ ijk_inl flt ijkTrigTanSinCos_deg_flt(flt const x, flt* const sinx_out, flt* cons
 
 ijk_inl flt ijkTrigCotSinCos_deg_flt(flt const x, flt* const sinx_out, flt* const cosx_out)
 {
-	ijk_ext size const ijkTrigSubdivisionsPerDegree_flt;
-	ijk_ext flt const ijkTrigSubdivisionsPerDegreeInv_flt, * const ijkTrigTableSin_flt, * const ijkTrigTableCos_flt;
+	ijk_ext size ijkTrigSubdivisionsPerDegree_flt;
+	ijk_ext flt ijkTrigSubdivisionsPerDegreeInv_flt;
+	ijk_ext flt const* ijkTrigTableSin_flt, * ijkTrigTableCos_flt;
 	flt f = (x + flt_360) * (flt)ijkTrigSubdivisionsPerDegree_flt, s, c;
 	index const i = (index)f, j = i + 1;
 	f = (f - (flt)i) * ijkTrigSubdivisionsPerDegreeInv_flt;
@@ -111,8 +114,9 @@ ijk_inl flt ijkTrigCotSinCos_deg_flt(flt const x, flt* const sinx_out, flt* cons
 
 ijk_inl flt ijkTrigSin_deg_flt(flt const x)
 {
-	ijk_ext size const ijkTrigSubdivisionsPerDegree_flt;
-	ijk_ext flt const ijkTrigSubdivisionsPerDegreeInv_flt, * const ijkTrigTableSin_flt;
+	ijk_ext size ijkTrigSubdivisionsPerDegree_flt;
+	ijk_ext flt ijkTrigSubdivisionsPerDegreeInv_flt;
+	ijk_ext flt const* ijkTrigTableSin_flt;
 	flt f = (x + flt_360) * (flt)ijkTrigSubdivisionsPerDegree_flt;
 	index const i = (index)f;
 	f = (f - (flt)i) * ijkTrigSubdivisionsPerDegreeInv_flt;
@@ -122,8 +126,9 @@ ijk_inl flt ijkTrigSin_deg_flt(flt const x)
 
 ijk_inl flt ijkTrigCos_deg_flt(flt const x)
 {
-	ijk_ext size const ijkTrigSubdivisionsPerDegree_flt;
-	ijk_ext flt const ijkTrigSubdivisionsPerDegreeInv_flt, * const ijkTrigTableCos_flt;
+	ijk_ext size ijkTrigSubdivisionsPerDegree_flt;
+	ijk_ext flt ijkTrigSubdivisionsPerDegreeInv_flt;
+	ijk_ext flt const* ijkTrigTableCos_flt;
 	flt f = (x + flt_360) * (flt)ijkTrigSubdivisionsPerDegree_flt;
 	index const i = (index)f;
 	f = (f - (flt)i) * ijkTrigSubdivisionsPerDegreeInv_flt;
@@ -133,8 +138,9 @@ ijk_inl flt ijkTrigCos_deg_flt(flt const x)
 
 ijk_inl flt ijkTrigTan_deg_flt(flt const x)
 {
-	ijk_ext size const ijkTrigSubdivisionsPerDegree_flt;
-	ijk_ext flt const ijkTrigSubdivisionsPerDegreeInv_flt, * const ijkTrigTableSin_flt, * const ijkTrigTableCos_flt;
+	ijk_ext size ijkTrigSubdivisionsPerDegree_flt;
+	ijk_ext flt ijkTrigSubdivisionsPerDegreeInv_flt;
+	ijk_ext flt const* ijkTrigTableSin_flt, * ijkTrigTableCos_flt;
 	flt f = (x + flt_360) * (flt)ijkTrigSubdivisionsPerDegree_flt, s, c;
 	index const i = (index)f, j = i + 1;
 	f = (f - (flt)i) * ijkTrigSubdivisionsPerDegreeInv_flt;
@@ -158,8 +164,9 @@ ijk_inl flt ijkTrigSec_deg_flt(flt const x)
 
 ijk_inl flt ijkTrigCot_deg_flt(flt const x)
 {
-	ijk_ext size const ijkTrigSubdivisionsPerDegree_flt;
-	ijk_ext flt const ijkTrigSubdivisionsPerDegreeInv_flt, * const ijkTrigTableSin_flt, * const ijkTrigTableCos_flt;
+	ijk_ext size ijkTrigSubdivisionsPerDegree_flt;
+	ijk_ext flt ijkTrigSubdivisionsPerDegreeInv_flt;
+	ijk_ext flt const* ijkTrigTableSin_flt, * ijkTrigTableCos_flt;
 	flt f = (x + flt_360) * (flt)ijkTrigSubdivisionsPerDegree_flt, s, c;
 	index const i = (index)f, j = i + 1;
 	f = (f - (flt)i) * ijkTrigSubdivisionsPerDegreeInv_flt;
@@ -171,8 +178,8 @@ ijk_inl flt ijkTrigCot_deg_flt(flt const x)
 
 ijk_inl flt ijkTrigAsin_deg_flt(flt const x)
 {
-	ijk_ext flt const* const ijkTrigTableParam_flt, * const ijkTrigTableSin_flt;
-	ijk_ext index const* const ijkTrigTableIndexAsin_flt;
+	ijk_ext flt const* ijkTrigTableParam_flt, * ijkTrigTableSin_flt;
+	ijk_ext index const* ijkTrigTableIndexAsin_flt;
 	return ijkInterpSampleTableInc_flt(ijkTrigTableSin_flt, ijkTrigTableParam_flt,
 		*(ijkTrigTableIndexAsin_flt + (index)((x + 1.0) * 512.0)), 1, x);
 }
@@ -639,8 +646,9 @@ ijk_inl dbl ijkTrigValidateInverseRecip_dbl(dbl x)
 
 ijk_inl dbl ijkTrigSinCos_deg_dbl(dbl const x, dbl* const sinx_out, dbl* const cosx_out)
 {
-	ijk_ext size const ijkTrigSubdivisionsPerDegree_dbl;
-	ijk_ext dbl const ijkTrigSubdivisionsPerDegreeInv_dbl, * const ijkTrigTableSin_dbl, * const ijkTrigTableCos_dbl;
+	ijk_ext size ijkTrigSubdivisionsPerDegree_dbl;
+	ijk_ext dbl ijkTrigSubdivisionsPerDegreeInv_dbl;
+	ijk_ext dbl const* ijkTrigTableSin_dbl, * ijkTrigTableCos_dbl;
 	dbl f = (x + dbl_360) * (dbl)ijkTrigSubdivisionsPerDegree_dbl;
 	index const i = (index)f, j = i + 1;
 	f = (f - (dbl)i) * ijkTrigSubdivisionsPerDegreeInv_dbl;
@@ -652,8 +660,9 @@ ijk_inl dbl ijkTrigSinCos_deg_dbl(dbl const x, dbl* const sinx_out, dbl* const c
 
 ijk_inl dbl ijkTrigTanSinCos_deg_dbl(dbl const x, dbl* const sinx_out, dbl* const cosx_out)
 {
-	ijk_ext size const ijkTrigSubdivisionsPerDegree_dbl;
-	ijk_ext dbl const ijkTrigSubdivisionsPerDegreeInv_dbl, * const ijkTrigTableSin_dbl, * const ijkTrigTableCos_dbl;
+	ijk_ext size ijkTrigSubdivisionsPerDegree_dbl;
+	ijk_ext dbl ijkTrigSubdivisionsPerDegreeInv_dbl;
+	ijk_ext dbl const* ijkTrigTableSin_dbl, * ijkTrigTableCos_dbl;
 	dbl f = (x + dbl_360) * (dbl)ijkTrigSubdivisionsPerDegree_dbl, s, c;
 	index const i = (index)f, j = i + 1;
 	f = (f - (dbl)i) * ijkTrigSubdivisionsPerDegreeInv_dbl;
@@ -665,8 +674,9 @@ ijk_inl dbl ijkTrigTanSinCos_deg_dbl(dbl const x, dbl* const sinx_out, dbl* cons
 
 ijk_inl dbl ijkTrigCotSinCos_deg_dbl(dbl const x, dbl* const sinx_out, dbl* const cosx_out)
 {
-	ijk_ext size const ijkTrigSubdivisionsPerDegree_dbl;
-	ijk_ext dbl const ijkTrigSubdivisionsPerDegreeInv_dbl, * const ijkTrigTableSin_dbl, * const ijkTrigTableCos_dbl;
+	ijk_ext size ijkTrigSubdivisionsPerDegree_dbl;
+	ijk_ext dbl ijkTrigSubdivisionsPerDegreeInv_dbl;
+	ijk_ext dbl const* ijkTrigTableSin_dbl, * ijkTrigTableCos_dbl;
 	dbl f = (x + dbl_360) * (dbl)ijkTrigSubdivisionsPerDegree_dbl, s, c;
 	index const i = (index)f, j = i + 1;
 	f = (f - (dbl)i) * ijkTrigSubdivisionsPerDegreeInv_dbl;
@@ -678,8 +688,9 @@ ijk_inl dbl ijkTrigCotSinCos_deg_dbl(dbl const x, dbl* const sinx_out, dbl* cons
 
 ijk_inl dbl ijkTrigSin_deg_dbl(dbl const x)
 {
-	ijk_ext size const ijkTrigSubdivisionsPerDegree_dbl;
-	ijk_ext dbl const ijkTrigSubdivisionsPerDegreeInv_dbl, * const ijkTrigTableSin_dbl;
+	ijk_ext size ijkTrigSubdivisionsPerDegree_dbl;
+	ijk_ext dbl ijkTrigSubdivisionsPerDegreeInv_dbl;
+	ijk_ext dbl const* ijkTrigTableSin_dbl;
 	dbl f = (x + dbl_360) * (dbl)ijkTrigSubdivisionsPerDegree_dbl;
 	index const i = (index)f;
 	f = (f - (dbl)i) * ijkTrigSubdivisionsPerDegreeInv_dbl;
@@ -689,8 +700,9 @@ ijk_inl dbl ijkTrigSin_deg_dbl(dbl const x)
 
 ijk_inl dbl ijkTrigCos_deg_dbl(dbl const x)
 {
-	ijk_ext size const ijkTrigSubdivisionsPerDegree_dbl;
-	ijk_ext dbl const ijkTrigSubdivisionsPerDegreeInv_dbl, * const ijkTrigTableCos_dbl;
+	ijk_ext size ijkTrigSubdivisionsPerDegree_dbl;
+	ijk_ext dbl ijkTrigSubdivisionsPerDegreeInv_dbl;
+	ijk_ext dbl const* ijkTrigTableCos_dbl;
 	dbl f = (x + dbl_360) * (dbl)ijkTrigSubdivisionsPerDegree_dbl;
 	index const i = (index)f;
 	f = (f - (dbl)i) * ijkTrigSubdivisionsPerDegreeInv_dbl;
@@ -700,8 +712,9 @@ ijk_inl dbl ijkTrigCos_deg_dbl(dbl const x)
 
 ijk_inl dbl ijkTrigTan_deg_dbl(dbl const x)
 {
-	ijk_ext size const ijkTrigSubdivisionsPerDegree_dbl;
-	ijk_ext dbl const ijkTrigSubdivisionsPerDegreeInv_dbl, * const ijkTrigTableSin_dbl, * const ijkTrigTableCos_dbl;
+	ijk_ext size ijkTrigSubdivisionsPerDegree_dbl;
+	ijk_ext dbl ijkTrigSubdivisionsPerDegreeInv_dbl;
+	ijk_ext dbl const* ijkTrigTableSin_dbl, * ijkTrigTableCos_dbl;
 	dbl f = (x + dbl_360) * (dbl)ijkTrigSubdivisionsPerDegree_dbl, s, c;
 	index const i = (index)f, j = i + 1;
 	f = (f - (dbl)i) * ijkTrigSubdivisionsPerDegreeInv_dbl;
@@ -725,8 +738,9 @@ ijk_inl dbl ijkTrigSec_deg_dbl(dbl const x)
 
 ijk_inl dbl ijkTrigCot_deg_dbl(dbl const x)
 {
-	ijk_ext size const ijkTrigSubdivisionsPerDegree_dbl;
-	ijk_ext dbl const ijkTrigSubdivisionsPerDegreeInv_dbl, * const ijkTrigTableSin_dbl, * const ijkTrigTableCos_dbl;
+	ijk_ext size ijkTrigSubdivisionsPerDegree_dbl;
+	ijk_ext dbl ijkTrigSubdivisionsPerDegreeInv_dbl;
+	ijk_ext dbl const* ijkTrigTableSin_dbl, * ijkTrigTableCos_dbl;
 	dbl f = (x + dbl_360) * (dbl)ijkTrigSubdivisionsPerDegree_dbl, s, c;
 	index const i = (index)f, j = i + 1;
 	f = (f - (dbl)i) * ijkTrigSubdivisionsPerDegreeInv_dbl;
@@ -738,8 +752,8 @@ ijk_inl dbl ijkTrigCot_deg_dbl(dbl const x)
 
 ijk_inl dbl ijkTrigAsin_deg_dbl(dbl const x)
 {
-	ijk_ext dbl const* const ijkTrigTableParam_dbl, * const ijkTrigTableSin_dbl;
-	ijk_ext index const* const ijkTrigTableIndexAsin_dbl;
+	ijk_ext dbl const* ijkTrigTableParam_dbl, * ijkTrigTableSin_dbl;
+	ijk_ext index const* ijkTrigTableIndexAsin_dbl;
 	return ijkInterpSampleTableInc_dbl(ijkTrigTableSin_dbl, ijkTrigTableParam_dbl,
 		*(ijkTrigTableIndexAsin_dbl + (index)((x + 1.0) * 1024.0)), 1, x);
 }
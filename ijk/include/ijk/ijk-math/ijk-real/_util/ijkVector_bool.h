@@ -38,7 +38,7 @@ extern "C" {
 //	Pass-thru boolean vector.
 //		param v_out: output vector
 //		return: v_out
-boolv ijkVecP2bv(boolv v_out);
+ijk_inl boolv ijkVecP2bv(boolv v_out);
 
 
 //-----------------------------------------------------------------------------
@@ -48,21 +48,21 @@ boolv ijkVecP2bv(boolv v_out);
 //		param v_out: output vector
 //		params x, y: initialization values
 //		return: v_out
-boolv ijkVecInitElems2bv(bool2 v_out, bool const x, bool const y);
+ijk_inl boolv ijkVecInitElems2bv(bool2 v_out, bool const x, bool const y);
 
 // ijkVecCopy2bv
 //	Initialize 2D boolean vector.
 //		param v_out: output vector
 //		params v_in: input vector
 //		return: v_out
-boolv ijkVecCopy2bv(bool2 v_out, bool2 const v_in);
+ijk_inl boolv ijkVecCopy2bv(bool2 v_out, bool2 const v_in);
 
 // ijkVecNot2bv
 //	Logical 'not' for 2D boolean vector.
 //		param v_out: output vector holding boolean result of logical 'not'
 //		param v_in: input vector
 //		return: v_out
-boolv ijkVecNot2bv(bool2 v_out, bool2 const v_in);
+ijk_inl boolv ijkVecNot2bv(bool2 v_out, bool2 const v_in);
 
 // ijkVecEqual2bv
 //	Equality comparison for 2D boolean vector.
@@ -70,7 +70,7 @@ boolv ijkVecNot2bv(bool2 v_out, bool2 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecEqual2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
+ijk_inl boolv ijkVecEqual2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
 
 // ijkVecInequal2bv
 //	Inequality comparison for 2D boolean vector.
@@ -78,7 +78,7 @@ boolv ijkVecEqual2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecInequal2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
+ijk_inl boolv ijkVecInequal2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
 
 // ijkVecAnd2bv
 //	Component-wise logical 'and' comparison for 2D boolean vector.
@@ -86,7 +86,7 @@ boolv ijkVecInequal2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecAnd2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
+ijk_inl boolv ijkVecAnd2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
 
 // ijkVecNand2bv
 //	Component-wise logical 'nand' comparison for 2D boolean vector.
@@ -94,7 +94,7 @@ boolv ijkVecAnd2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecNand2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
+ijk_inl boolv ijkVecNand2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
 
 // ijkVecOr2bv
 //	Component-wise logical 'and' comparison for 2D boolean vector.
@@ -102,7 +102,7 @@ boolv ijkVecNand2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecOr2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
+ijk_inl boolv ijkVecOr2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
 
 // ijkVecNor2bv
 //	Component-wise logical 'and' comparison for 2D boolean vector.
@@ -110,21 +110,21 @@ boolv ijkVecOr2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecNor2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
+ijk_inl boolv ijkVecNor2bv(bool2 v_out, bool2 const v_lh, bool2 const v_rh);
 
 // ijkVecCopy2bvs
 //	Initialize 2D boolean vector.
 //		param v_out: output vector
 //		params s_in: input scalar
 //		return: v_out
-boolv ijkVecCopy2bvs(bool2 v_out, bool const s_in);
+ijk_inl boolv ijkVecCopy2bvs(bool2 v_out, bool const s_in);
 
 // ijkVecNot2bvs
 //	Logical 'not' for 2D boolean vector.
 //		param v_out: output vector holding boolean result of logical 'not'
 //		param s_in: input scalar
 //		return: v_out
-boolv ijkVecNot2bvs(bool2 v_out, bool const s_in);
+ijk_inl boolv ijkVecNot2bvs(bool2 v_out, bool const s_in);
 
 // ijkVecEqual2bvs
 //	Equality comparison for 2D boolean vector vs condition.
@@ -132,7 +132,7 @@ boolv ijkVecNot2bvs(bool2 v_out, bool const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand condition
 //		return: v_out
-boolv ijkVecEqual2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecEqual2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
 
 // ijkVecInequal2bvs
 //	Inequality comparison for 2D boolean vector vs condition.
@@ -140,7 +140,7 @@ boolv ijkVecEqual2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand condition
 //		return: v_out
-boolv ijkVecInequal2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecInequal2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
 
 // ijkVecAnd2bvs
 //	Component-wise logical 'and' comparison for 2D boolean vector.
@@ -148,7 +148,7 @@ boolv ijkVecInequal2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-boolv ijkVecAnd2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecAnd2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
 
 // ijkVecNand2bvs
 //	Component-wise logical 'nand' comparison for 2D boolean vector.
@@ -156,7 +156,7 @@ boolv ijkVecAnd2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-boolv ijkVecNand2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecNand2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
 
 // ijkVecOr2bvs
 //	Component-wise logical 'and' comparison for 2D boolean vector.
@@ -164,7 +164,7 @@ boolv ijkVecNand2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-boolv ijkVecOr2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecOr2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
 
 // ijkVecNor2bvs
 //	Component-wise logical 'and' comparison for 2D boolean vector.
@@ -172,7 +172,7 @@ boolv ijkVecOr2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-boolv ijkVecNor2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecNor2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
 
 // ijkVecEqual2bsv
 //	Equality comparison for 2D boolean vector vs condition.
@@ -180,7 +180,7 @@ boolv ijkVecNor2bvs(bool2 v_out, bool2 const v_lh, bool const s_rh);
 //		param s_lh: left-hand condition
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecEqual2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
+ijk_inl boolv ijkVecEqual2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
 
 // ijkVecInequal2bsv
 //	Inequality comparison for 2D boolean vector vs condition.
@@ -188,7 +188,7 @@ boolv ijkVecEqual2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
 //		param s_lh: left-hand condition
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecInequal2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
+ijk_inl boolv ijkVecInequal2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
 
 // ijkVecAnd2bsv
 //	Component-wise logical 'and' comparison for 2D boolean vector.
@@ -196,7 +196,7 @@ boolv ijkVecInequal2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecAnd2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
+ijk_inl boolv ijkVecAnd2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
 
 // ijkVecNand2bsv
 //	Component-wise logical 'nand' comparison for 2D boolean vector.
@@ -204,7 +204,7 @@ boolv ijkVecAnd2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecNand2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
+ijk_inl boolv ijkVecNand2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
 
 // ijkVecOr2bsv
 //	Component-wise logical 'and' comparison for 2D boolean vector.
@@ -212,7 +212,7 @@ boolv ijkVecNand2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecOr2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
+ijk_inl boolv ijkVecOr2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
 
 // ijkVecNor2bsv
 //	Component-wise logical 'and' comparison for 2D boolean vector.
@@ -220,7 +220,7 @@ boolv ijkVecOr2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecNor2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
+ijk_inl boolv ijkVecNor2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -230,21 +230,21 @@ boolv ijkVecNor2bsv(bool2 v_out, bool const s_lh, bool2 const v_rh);
 //		param v_out: output vector
 //		params x, y, z: initialization values
 //		return: v_out
-boolv ijkVecInitElems3bv(bool3 v_out, bool const x, bool const y, bool const z);
+ijk_inl boolv ijkVecInitElems3bv(bool3 v_out, bool const x, bool const y, bool const z);
 
 // ijkVecCopy3bv
 //	Initialize 3D boolean vector.
 //		param v_out: output vector
 //		params v_in: input vector
 //		return: v_out
-boolv ijkVecCopy3bv(bool3 v_out, bool3 const v_in);
+ijk_inl boolv ijkVecCopy3bv(bool3 v_out, bool3 const v_in);
 
 // ijkVecNot3bv
 //	Logical 'not' for 3D boolean vector.
 //		param v_out: output vector holding boolean result of logical 'not'
 //		param v_in: input vector
 //		return: v_out
-boolv ijkVecNot3bv(bool3 v_out, bool3 const v_in);
+ijk_inl boolv ijkVecNot3bv(bool3 v_out, bool3 const v_in);
 
 // ijkVecEqual3bv
 //	Equality comparison for 3D boolean vector.
@@ -252,7 +252,7 @@ boolv ijkVecNot3bv(bool3 v_out, bool3 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecEqual3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
+ijk_inl boolv ijkVecEqual3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
 
 // ijkVecInequal3bv
 //	Inequality comparison for 3D boolean vector.
@@ -260,7 +260,7 @@ boolv ijkVecEqual3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecInequal3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
+ijk_inl boolv ijkVecInequal3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
 
 // ijkVecAnd3bv
 //	Component-wise logical 'and' comparison for 3D boolean vector.
@@ -268,7 +268,7 @@ boolv ijkVecInequal3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecAnd3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
+ijk_inl boolv ijkVecAnd3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
 
 // ijkVecNand3bv
 //	Component-wise logical 'nand' comparison for 3D boolean vector.
@@ -276,7 +276,7 @@ boolv ijkVecAnd3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecNand3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
+ijk_inl boolv ijkVecNand3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
 
 // ijkVecOr3bv
 //	Component-wise logical 'and' comparison for 3D boolean vector.
@@ -284,7 +284,7 @@ boolv ijkVecNand3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecOr3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
+ijk_inl boolv ijkVecOr3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
 
 // ijkVecNor3bv
 //	Component-wise logical 'and' comparison for 3D boolean vector.
@@ -292,21 +292,21 @@ boolv ijkVecOr3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecNor3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
+ijk_inl boolv ijkVecNor3bv(bool3 v_out, bool3 const v_lh, bool3 const v_rh);
 
 // ijkVecCopy3bvs
 //	Initialize 3D boolean vector.
 //		param v_out: output vector
 //		params s_in: input scalar
 //		return: v_out
-boolv ijkVecCopy3bvs(bool3 v_out, bool const s_in);
+ijk_inl boolv ijkVecCopy3bvs(bool3 v_out, bool const s_in);
 
 // ijkVecNot3bvs
 //	Logical 'not' for 3D boolean vector.
 //		param v_out: output vector holding boolean result of logical 'not'
 //		param s_in: input scalar
 //		return: v_out
-boolv ijkVecNot3bvs(bool3 v_out, bool const s_in);
+ijk_inl boolv ijkVecNot3bvs(bool3 v_out, bool const s_in);
 
 // ijkVecEqual3bvs
 //	Equality comparison for 3D boolean vector vs condition.
@@ -314,7 +314,7 @@ boolv ijkVecNot3bvs(bool3 v_out, bool const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand condition
 //		return: v_out
-boolv ijkVecEqual3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecEqual3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
 
 // ijkVecInequal3bvs
 //	Inequality comparison for 3D boolean vector vs condition.
@@ -322,7 +322,7 @@ boolv ijkVecEqual3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand condition
 //		return: v_out
-boolv ijkVecInequal3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecInequal3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
 
 // ijkVecAnd3bvs
 //	Component-wise logical 'and' comparison for 3D boolean vector.
@@ -330,7 +330,7 @@ boolv ijkVecInequal3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-boolv ijkVecAnd3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecAnd3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
 
 // ijkVecNand3bvs
 //	Component-wise logical 'nand' comparison for 3D boolean vector.
@@ -338,7 +338,7 @@ boolv ijkVecAnd3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-boolv ijkVecNand3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecNand3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
 
 // ijkVecOr3bvs
 //	Component-wise logical 'and' comparison for 3D boolean vector.
@@ -346,7 +346,7 @@ boolv ijkVecNand3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-boolv ijkVecOr3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecOr3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
 
 // ijkVecNor3bvs
 //	Component-wise logical 'and' comparison for 3D boolean vector.
@@ -354,7 +354,7 @@ boolv ijkVecOr3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-boolv ijkVecNor3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecNor3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
 
 // ijkVecEqual3bsv
 //	Equality comparison for 3D boolean vector vs condition.
@@ -362,7 +362,7 @@ boolv ijkVecNor3bvs(bool3 v_out, bool3 const v_lh, bool const s_rh);
 //		param s_lh: left-hand condition
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecEqual3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
+ijk_inl boolv ijkVecEqual3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
 
 // ijkVecInequal3bsv
 //	Inequality comparison for 3D boolean vector vs condition.
@@ -370,7 +370,7 @@ boolv ijkVecEqual3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
 //		param s_lh: left-hand condition
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecInequal3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
+ijk_inl boolv ijkVecInequal3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
 
 // ijkVecAnd3bsv
 //	Component-wise logical 'and' comparison for 3D boolean vector.
@@ -378,7 +378,7 @@ boolv ijkVecInequal3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecAnd3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
+ijk_inl boolv ijkVecAnd3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
 
 // ijkVecNand3bsv
 //	Component-wise logical 'nand' comparison for 3D boolean vector.
@@ -386,7 +386,7 @@ boolv ijkVecAnd3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecNand3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
+ijk_inl boolv ijkVecNand3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
 
 // ijkVecOr3bsv
 //	Component-wise logical 'and' comparison for 3D boolean vector.
@@ -394,7 +394,7 @@ boolv ijkVecNand3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecOr3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
+ijk_inl boolv ijkVecOr3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
 
 // ijkVecNor3bsv
 //	Component-wise logical 'and' comparison for 3D boolean vector.
@@ -402,7 +402,7 @@ boolv ijkVecOr3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecNor3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
+ijk_inl boolv ijkVecNor3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -412,21 +412,21 @@ boolv ijkVecNor3bsv(bool3 v_out, bool const s_lh, bool3 const v_rh);
 //		param v_out: output vector
 //		params x, y, z, w: initialization values
 //		return: v_out
-boolv ijkVecInitElems4bv(bool4 v_out, bool const x, bool const y, bool const z, bool const w);
+ijk_inl boolv ijkVecInitElems4bv(bool4 v_out, bool const x, bool const y, bool const z, bool const w);
 
 // ijkVecCopy4bv
 //	Initialize 4D boolean vector.
 //		param v_out: output vector
 //		params v_in: input vector
 //		return: v_out
-boolv ijkVecCopy4bv(bool4 v_out, bool4 const v_in);
+ijk_inl boolv ijkVecCopy4bv(bool4 v_out, bool4 const v_in);
 
 // ijkVecNot4bv
 //	Logical 'not' for 4D boolean vector.
 //		param v_out: output vector holding boolean result of logical 'not'
 //		param v_in: input vector
 //		return: v_out
-boolv ijkVecNot4bv(bool4 v_out, bool4 const v_in);
+ijk_inl boolv ijkVecNot4bv(bool4 v_out, bool4 const v_in);
 
 // ijkVecEqual4bv
 //	Equality comparison for 4D boolean vector.
@@ -434,7 +434,7 @@ boolv ijkVecNot4bv(bool4 v_out, bool4 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecEqual4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
+ijk_inl boolv ijkVecEqual4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
 
 // ijkVecInequal4bv
 //	Inequality comparison for 4D boolean vector.
@@ -442,7 +442,7 @@ boolv ijkVecEqual4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecInequal4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
+ijk_inl boolv ijkVecInequal4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
 
 // ijkVecAnd4bv
 //	Component-wise logical 'and' comparison for 4D boolean vector.
@@ -450,7 +450,7 @@ boolv ijkVecInequal4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecAnd4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
+ijk_inl boolv ijkVecAnd4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
 
 // ijkVecNand4bv
 //	Component-wise logical 'nand' comparison for 4D boolean vector.
@@ -458,7 +458,7 @@ boolv ijkVecAnd4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecNand4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
+ijk_inl boolv ijkVecNand4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
 
 // ijkVecOr4bv
 //	Component-wise logical 'and' comparison for 4D boolean vector.
@@ -466,7 +466,7 @@ boolv ijkVecNand4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecOr4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
+ijk_inl boolv ijkVecOr4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
 
 // ijkVecNor4bv
 //	Component-wise logical 'and' comparison for 4D boolean vector.
@@ -474,21 +474,21 @@ boolv ijkVecOr4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecNor4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
+ijk_inl boolv ijkVecNor4bv(bool4 v_out, bool4 const v_lh, bool4 const v_rh);
 
 // ijkVecCopy4bvs
 //	Initialize 4D boolean vector.
 //		param v_out: output vector
 //		params s_in: input scalar
 //		return: v_out
-boolv ijkVecCopy4bvs(bool4 v_out, bool const s_in);
+ijk_inl boolv ijkVecCopy4bvs(bool4 v_out, bool const s_in);
 
 // ijkVecNot4bvs
 //	Logical 'not' for 4D boolean vector.
 //		param v_out: output vector holding boolean result of logical 'not'
 //		param s_in: input scalar
 //		return: v_out
-boolv ijkVecNot4bvs(bool4 v_out, bool const s_in);
+ijk_inl boolv ijkVecNot4bvs(bool4 v_out, bool const s_in);
 
 // ijkVecEqual4bvs
 //	Equality comparison for 4D boolean vector vs condition.
@@ -496,7 +496,7 @@ boolv ijkVecNot4bvs(bool4 v_out, bool const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand condition
 //		return: v_out
-boolv ijkVecEqual4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecEqual4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
 
 // ijkVecInequal4bvs
 //	Inequality comparison for 4D boolean vector vs condition.
@@ -504,7 +504,7 @@ boolv ijkVecEqual4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand condition
 //		return: v_out
-boolv ijkVecInequal4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecInequal4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
 
 // ijkVecAnd4bvs
 //	Component-wise logical 'and' comparison for 4D boolean vector.
@@ -512,7 +512,7 @@ boolv ijkVecInequal4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-boolv ijkVecAnd4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecAnd4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
 
 // ijkVecNand4bvs
 //	Component-wise logical 'nand' comparison for 4D boolean vector.
@@ -520,7 +520,7 @@ boolv ijkVecAnd4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-boolv ijkVecNand4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecNand4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
 
 // ijkVecOr4bvs
 //	Component-wise logical 'and' comparison for 4D boolean vector.
@@ -528,7 +528,7 @@ boolv ijkVecNand4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-boolv ijkVecOr4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecOr4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
 
 // ijkVecNor4bvs
 //	Component-wise logical 'and' comparison for 4D boolean vector.
@@ -536,7 +536,7 @@ boolv ijkVecOr4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-boolv ijkVecNor4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
+ijk_inl boolv ijkVecNor4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
 
 // ijkVecEqual4bsv
 //	Equality comparison for 4D boolean vector vs condition.
@@ -544,7 +544,7 @@ boolv ijkVecNor4bvs(bool4 v_out, bool4 const v_lh, bool const s_rh);
 //		param s_lh: left-hand condition
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecEqual4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
+ijk_inl boolv ijkVecEqual4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
 
 // ijkVecInequal4bsv
 //	Inequality comparison for 4D boolean vector vs condition.
@@ -552,7 +552,7 @@ boolv ijkVecEqual4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
 //		param s_lh: left-hand condition
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecInequal4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
+ijk_inl boolv ijkVecInequal4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
 
 // ijkVecAnd4bsv
 //	Component-wise logical 'and' comparison for 4D boolean vector.
@@ -560,7 +560,7 @@ boolv ijkVecInequal4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecAnd4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
+ijk_inl boolv ijkVecAnd4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
 
 // ijkVecNand4bsv
 //	Component-wise logical 'nand' comparison for 4D boolean vector.
@@ -568,7 +568,7 @@ boolv ijkVecAnd4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecNand4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
+ijk_inl boolv ijkVecNand4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
 
 // ijkVecOr4bsv
 //	Component-wise logical 'and' comparison for 4D boolean vector.
@@ -576,7 +576,7 @@ boolv ijkVecNand4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecOr4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
+ijk_inl boolv ijkVecOr4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
 
 // ijkVecNor4bsv
 //	Component-wise logical 'and' comparison for 4D boolean vector.
@@ -584,7 +584,7 @@ boolv ijkVecOr4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-boolv ijkVecNor4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
+ijk_inl boolv ijkVecNor4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -600,157 +600,157 @@ boolv ijkVecNor4bsv(bool4 v_out, bool const s_lh, bool4 const v_rh);
 //	Initialize 2D boolean vector.
 //		params x, y: initialization values
 //		return: output vector
-bvec2 ijkVecInitElems2b(bool const x, bool const y);
+ijk_inl bvec2 ijkVecInitElems2b(bool const x, bool const y);
 
 // ijkVecCopy2b
 //	Initialize 2D boolean vector.
 //		params v_in: input vector
 //		return: vector comparison
-bvec2 ijkVecCopy2b(bvec2 const v_in);
+ijk_inl bvec2 ijkVecCopy2b(bvec2 const v_in);
 
 // ijkVecNot2b
 //	Logical 'not' for 2D boolean vector.
 //		param v_in: input vector
 //		return: vector comparison
-bvec2 ijkVecNot2b(bvec2 const v_in);
+ijk_inl bvec2 ijkVecNot2b(bvec2 const v_in);
 
 // ijkVecEqual2b
 //	Equality comparison for 2D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec2 ijkVecEqual2b(bvec2 const v_lh, bvec2 const v_rh);
+ijk_inl bvec2 ijkVecEqual2b(bvec2 const v_lh, bvec2 const v_rh);
 
 // ijkVecInequal2b
 //	Inequality comparison for 2D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec2 ijkVecInequal2b(bvec2 const v_lh, bvec2 const v_rh);
+ijk_inl bvec2 ijkVecInequal2b(bvec2 const v_lh, bvec2 const v_rh);
 
 // ijkVecAnd2b
 //	Component-wise logical 'and' comparison for 2D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec2 ijkVecAnd2b(bvec2 const v_lh, bvec2 const v_rh);
+ijk_inl bvec2 ijkVecAnd2b(bvec2 const v_lh, bvec2 const v_rh);
 
 // ijkVecNand2b
 //	Component-wise logical 'nand' comparison for 2D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec2 ijkVecNand2b(bvec2 const v_lh, bvec2 const v_rh);
+ijk_inl bvec2 ijkVecNand2b(bvec2 const v_lh, bvec2 const v_rh);
 
 // ijkVecOr2b
 //	Component-wise logical 'and' comparison for 2D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec2 ijkVecOr2b(bvec2 const v_lh, bvec2 const v_rh);
+ijk_inl bvec2 ijkVecOr2b(bvec2 const v_lh, bvec2 const v_rh);
 
 // ijkVecNor2b
 //	Component-wise logical 'and' comparison for 2D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec2 ijkVecNor2b(bvec2 const v_lh, bvec2 const v_rh);
+ijk_inl bvec2 ijkVecNor2b(bvec2 const v_lh, bvec2 const v_rh);
 
 // ijkVecCopy2bs
 //	Initialize 2D boolean vector.
 //		params s_in: input scalar
 //		return: vector comparison
-bvec2 ijkVecCopy2bs(bool const s_in);
+ijk_inl bvec2 ijkVecCopy2bs(bool const s_in);
 
 // ijkVecNot2bs
 //	Logical 'not' for 2D boolean vector.
 //		param s_in: input scalar
 //		return: vector comparison
-bvec2 ijkVecNot2bs(bool const s_in);
+ijk_inl bvec2 ijkVecNot2bs(bool const s_in);
 
 // ijkVecEqual2bs
 //	Equality comparison for 2D boolean vector vs condition.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand condition
 //		return: vector comparison
-bvec2 ijkVecEqual2bs(bvec2 const v_lh, bool const s_rh);
+ijk_inl bvec2 ijkVecEqual2bs(bvec2 const v_lh, bool const s_rh);
 
 // ijkVecInequal2bs
 //	Inequality comparison for 2D boolean vector vs condition.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand condition
 //		return: vector comparison
-bvec2 ijkVecInequal2bs(bvec2 const v_lh, bool const s_rh);
+ijk_inl bvec2 ijkVecInequal2bs(bvec2 const v_lh, bool const s_rh);
 
 // ijkVecAnd2bs
 //	Component-wise logical 'and' comparison for 2D boolean vector.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: vector comparison
-bvec2 ijkVecAnd2bs(bvec2 const v_lh, bool const s_rh);
+ijk_inl bvec2 ijkVecAnd2bs(bvec2 const v_lh, bool const s_rh);
 
 // ijkVecNand2bs
 //	Component-wise logical 'nand' comparison for 2D boolean vector.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: vector comparison
-bvec2 ijkVecNand2bs(bvec2 const v_lh, bool const s_rh);
+ijk_inl bvec2 ijkVecNand2bs(bvec2 const v_lh, bool const s_rh);
 
 // ijkVecOr2bs
 //	Component-wise logical 'and' comparison for 2D boolean vector.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: vector comparison
-bvec2 ijkVecOr2bs(bvec2 const v_lh, bool const s_rh);
+ijk_inl bvec2 ijkVecOr2bs(bvec2 const v_lh, bool const s_rh);
 
 // ijkVecNor2bs
 //	Component-wise logical 'and' comparison for 2D boolean vector.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: vector comparison
-bvec2 ijkVecNor2bs(bvec2 const v_lh, bool const s_rh);
+ijk_inl bvec2 ijkVecNor2bs(bvec2 const v_lh, bool const s_rh);
 
 // ijkVecEqual2sb
 //	Equality comparison for 2D boolean vector vs condition.
 //		param s_lh: left-hand condition
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec2 ijkVecEqual2sb(bool const s_lh, bvec2 const v_rh);
+ijk_inl bvec2 ijkVecEqual2sb(bool const s_lh, bvec2 const v_rh);
 
 // ijkVecInequal2sb
 //	Inequality comparison for 2D boolean vector vs condition.
 //		param s_lh: left-hand condition
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec2 ijkVecInequal2sb(bool const s_lh, bvec2 const v_rh);
+ijk_inl bvec2 ijkVecInequal2sb(bool const s_lh, bvec2 const v_rh);
 
 // ijkVecAnd2sb
 //	Component-wise logical 'and' comparison for 2D boolean vector.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec2 ijkVecAnd2sb(bool const s_lh, bvec2 const v_rh);
+ijk_inl bvec2 ijkVecAnd2sb(bool const s_lh, bvec2 const v_rh);
 
 // ijkVecNand2sb
 //	Component-wise logical 'nand' comparison for 2D boolean vector.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec2 ijkVecNand2sb(bool const s_lh, bvec2 const v_rh);
+ijk_inl bvec2 ijkVecNand2sb(bool const s_lh, bvec2 const v_rh);
 
 // ijkVecOr2sb
 //	Component-wise logical 'and' comparison for 2D boolean vector.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec2 ijkVecOr2sb(bool const s_lh, bvec2 const v_rh);
+ijk_inl bvec2 ijkVecOr2sb(bool const s_lh, bvec2 const v_rh);
 
 // ijkVecNor2sb
 //	Component-wise logical 'and' comparison for 2D boolean vector.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec2 ijkVecNor2sb(bool const s_lh, bvec2 const v_rh);
+ijk_inl bvec2 ijkVecNor2sb(bool const s_lh, bvec2 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -759,157 +759,157 @@ bvec2 ijkVecNor2sb(bool const s_lh, bvec2 const v_rh);
 //	Initialize 3D boolean vector.
 //		params x, y, z: initialization values
 //		return: output vector
-bvec3 ijkVecInitElems3b(bool const x, bool const y, bool const z);
+ijk_inl bvec3 ijkVecInitElems3b(bool const x, bool const y, bool const z);
 
 // ijkVecCopy3b
 //	Initialize 3D boolean vector.
 //		params v_in: input vector
 //		return: vector comparison
-bvec3 ijkVecCopy3b(bvec3 const v_in);
+ijk_inl bvec3 ijkVecCopy3b(bvec3 const v_in);
 
 // ijkVecNot3b
 //	Logical 'not' for 3D boolean vector.
 //		param v_in: input vector
 //		return: vector comparison
-bvec3 ijkVecNot3b(bvec3 const v_in);
+ijk_inl bvec3 ijkVecNot3b(bvec3 const v_in);
 
 // ijkVecEqual3b
 //	Equality comparison for 3D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec3 ijkVecEqual3b(bvec3 const v_lh, bvec3 const v_rh);
+ijk_inl bvec3 ijkVecEqual3b(bvec3 const v_lh, bvec3 const v_rh);
 
 // ijkVecInequal3b
 //	Inequality comparison for 3D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec3 ijkVecInequal3b(bvec3 const v_lh, bvec3 const v_rh);
+ijk_inl bvec3 ijkVecInequal3b(bvec3 const v_lh, bvec3 const v_rh);
 
 // ijkVecAnd3b
 //	Component-wise logical 'and' comparison for 3D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec3 ijkVecAnd3b(bvec3 const v_lh, bvec3 const v_rh);
+ijk_inl bvec3 ijkVecAnd3b(bvec3 const v_lh, bvec3 const v_rh);
 
 // ijkVecNand3b
 //	Component-wise logical 'nand' comparison for 3D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec3 ijkVecNand3b(bvec3 const v_lh, bvec3 const v_rh);
+ijk_inl bvec3 ijkVecNand3b(bvec3 const v_lh, bvec3 const v_rh);
 
 // ijkVecOr3b
 //	Component-wise logical 'and' comparison for 3D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec3 ijkVecOr3b(bvec3 const v_lh, bvec3 const v_rh);
+ijk_inl bvec3 ijkVecOr3b(bvec3 const v_lh, bvec3 const v_rh);
 
 // ijkVecNor3b
 //	Component-wise logical 'and' comparison for 3D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec3 ijkVecNor3b(bvec3 const v_lh, bvec3 const v_rh);
+ijk_inl bvec3 ijkVecNor3b(bvec3 const v_lh, bvec3 const v_rh);
 
 // ijkVecCopy3bs
 //	Initialize 3D boolean vector.
 //		params s_in: input scalar
 //		return: vector comparison
-bvec3 ijkVecCopy3bs(bool const s_in);
+ijk_inl bvec3 ijkVecCopy3bs(bool const s_in);
 
 // ijkVecNot3bs
 //	Logical 'not' for 3D boolean vector.
 //		param s_in: input scalar
 //		return: vector comparison
-bvec3 ijkVecNot3bs(bool const s_in);
+ijk_inl bvec3 ijkVecNot3bs(bool const s_in);
 
 // ijkVecEqual3bs
 //	Equality comparison for 3D boolean vector vs condition.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand condition
 //		return: vector comparison
-bvec3 ijkVecEqual3bs(bvec3 const v_lh, bool const s_rh);
+ijk_inl bvec3 ijkVecEqual3bs(bvec3 const v_lh, bool const s_rh);
 
 // ijkVecInequal3bs
 //	Inequality comparison for 3D boolean vector vs condition.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand condition
 //		return: vector comparison
-bvec3 ijkVecInequal3bs(bvec3 const v_lh, bool const s_rh);
+ijk_inl bvec3 ijkVecInequal3bs(bvec3 const v_lh, bool const s_rh);
 
 // ijkVecAnd3bs
 //	Component-wise logical 'and' comparison for 3D boolean vector.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: vector comparison
-bvec3 ijkVecAnd3bs(bvec3 const v_lh, bool const s_rh);
+ijk_inl bvec3 ijkVecAnd3bs(bvec3 const v_lh, bool const s_rh);
 
 // ijkVecNand3bs
 //	Component-wise logical 'nand' comparison for 3D boolean vector.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: vector comparison
-bvec3 ijkVecNand3bs(bvec3 const v_lh, bool const s_rh);
+ijk_inl bvec3 ijkVecNand3bs(bvec3 const v_lh, bool const s_rh);
 
 // ijkVecOr3bs
 //	Component-wise logical 'and' comparison for 3D boolean vector.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: vector comparison
-bvec3 ijkVecOr3bs(bvec3 const v_lh, bool const s_rh);
+ijk_inl bvec3 ijkVecOr3bs(bvec3 const v_lh, bool const s_rh);
 
 // ijkVecNor3bs
 //	Component-wise logical 'and' comparison for 3D boolean vector.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: vector comparison
-bvec3 ijkVecNor3bs(bvec3 const v_lh, bool const s_rh);
+ijk_inl bvec3 ijkVecNor3bs(bvec3 const v_lh, bool const s_rh);
 
 // ijkVecEqual3sb
 //	Equality comparison for 3D boolean vector vs condition.
 //		param s_lh: left-hand condition
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec3 ijkVecEqual3sb(bool const s_lh, bvec3 const v_rh);
+ijk_inl bvec3 ijkVecEqual3sb(bool const s_lh, bvec3 const v_rh);
 
 // ijkVecInequal3sb
 //	Inequality comparison for 3D boolean vector vs condition.
 //		param s_lh: left-hand condition
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec3 ijkVecInequal3sb(bool const s_lh, bvec3 const v_rh);
+ijk_inl bvec3 ijkVecInequal3sb(bool const s_lh, bvec3 const v_rh);
 
 // ijkVecAnd3sb
 //	Component-wise logical 'and' comparison for 3D boolean vector.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec3 ijkVecAnd3sb(bool const s_lh, bvec3 const v_rh);
+ijk_inl bvec3 ijkVecAnd3sb(bool const s_lh, bvec3 const v_rh);
 
 // ijkVecNand3sb
 //	Component-wise logical 'nand' comparison for 3D boolean vector.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec3 ijkVecNand3sb(bool const s_lh, bvec3 const v_rh);
+ijk_inl bvec3 ijkVecNand3sb(bool const s_lh, bvec3 const v_rh);
 
 // ijkVecOr3sb
 //	Component-wise logical 'and' comparison for 3D boolean vector.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec3 ijkVecOr3sb(bool const s_lh, bvec3 const v_rh);
+ijk_inl bvec3 ijkVecOr3sb(bool const s_lh, bvec3 const v_rh);
 
 // ijkVecNor3sb
 //	Component-wise logical 'and' comparison for 3D boolean vector.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec3 ijkVecNor3sb(bool const s_lh, bvec3 const v_rh);
+ijk_inl bvec3 ijkVecNor3sb(bool const s_lh, bvec3 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -918,157 +918,157 @@ bvec3 ijkVecNor3sb(bool const s_lh, bvec3 const v_rh);
 //	Initialize 4D boolean vector.
 //		params x, y, z, w: initialization values
 //		return: output vector
-bvec4 ijkVecInitElems4b(bool const x, bool const y, bool const z, bool const w);
+ijk_inl bvec4 ijkVecInitElems4b(bool const x, bool const y, bool const z, bool const w);
 
 // ijkVecCopy4b
 //	Initialize 4D boolean vector.
 //		params v_in: input vector
 //		return: vector comparison
-bvec4 ijkVecCopy4b(bvec4 const v_in);
+ijk_inl bvec4 ijkVecCopy4b(bvec4 const v_in);
 
 // ijkVecNot4b
 //	Logical 'not' for 4D boolean vector.
 //		param v_in: input vector
 //		return: vector comparison
-bvec4 ijkVecNot4b(bvec4 const v_in);
+ijk_inl bvec4 ijkVecNot4b(bvec4 const v_in);
 
 // ijkVecEqual4b
 //	Equality comparison for 4D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec4 ijkVecEqual4b(bvec4 const v_lh, bvec4 const v_rh);
+ijk_inl bvec4 ijkVecEqual4b(bvec4 const v_lh, bvec4 const v_rh);
 
 // ijkVecInequal4b
 //	Inequality comparison for 4D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec4 ijkVecInequal4b(bvec4 const v_lh, bvec4 const v_rh);
+ijk_inl bvec4 ijkVecInequal4b(bvec4 const v_lh, bvec4 const v_rh);
 
 // ijkVecAnd4b
 //	Component-wise logical 'and' comparison for 4D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec4 ijkVecAnd4b(bvec4 const v_lh, bvec4 const v_rh);
+ijk_inl bvec4 ijkVecAnd4b(bvec4 const v_lh, bvec4 const v_rh);
 
 // ijkVecNand4b
 //	Component-wise logical 'nand' comparison for 4D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec4 ijkVecNand4b(bvec4 const v_lh, bvec4 const v_rh);
+ijk_inl bvec4 ijkVecNand4b(bvec4 const v_lh, bvec4 const v_rh);
 
 // ijkVecOr4b
 //	Component-wise logical 'and' comparison for 4D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec4 ijkVecOr4b(bvec4 const v_lh, bvec4 const v_rh);
+ijk_inl bvec4 ijkVecOr4b(bvec4 const v_lh, bvec4 const v_rh);
 
 // ijkVecNor4b
 //	Component-wise logical 'and' comparison for 4D boolean vector.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec4 ijkVecNor4b(bvec4 const v_lh, bvec4 const v_rh);
+ijk_inl bvec4 ijkVecNor4b(bvec4 const v_lh, bvec4 const v_rh);
 
 // ijkVecCopy4bs
 //	Initialize 4D boolean vector.
 //		params s_in: input scalar
 //		return: vector comparison
-bvec4 ijkVecCopy4bs(bool const s_in);
+ijk_inl bvec4 ijkVecCopy4bs(bool const s_in);
 
 // ijkVecNot4bs
 //	Logical 'not' for 4D boolean vector.
 //		param s_in: input scalar
 //		return: vector comparison
-bvec4 ijkVecNot4bs(bool const s_in);
+ijk_inl bvec4 ijkVecNot4bs(bool const s_in);
 
 // ijkVecEqual4bs
 //	Equality comparison for 4D boolean vector vs condition.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand condition
 //		return: vector comparison
-bvec4 ijkVecEqual4bs(bvec4 const v_lh, bool const s_rh);
+ijk_inl bvec4 ijkVecEqual4bs(bvec4 const v_lh, bool const s_rh);
 
 // ijkVecInequal4bs
 //	Inequality comparison for 4D boolean vector vs condition.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand condition
 //		return: vector comparison
-bvec4 ijkVecInequal4bs(bvec4 const v_lh, bool const s_rh);
+ijk_inl bvec4 ijkVecInequal4bs(bvec4 const v_lh, bool const s_rh);
 
 // ijkVecAnd4bs
 //	Component-wise logical 'and' comparison for 4D boolean vector.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: vector comparison
-bvec4 ijkVecAnd4bs(bvec4 const v_lh, bool const s_rh);
+ijk_inl bvec4 ijkVecAnd4bs(bvec4 const v_lh, bool const s_rh);
 
 // ijkVecNand4bs
 //	Component-wise logical 'nand' comparison for 4D boolean vector.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: vector comparison
-bvec4 ijkVecNand4bs(bvec4 const v_lh, bool const s_rh);
+ijk_inl bvec4 ijkVecNand4bs(bvec4 const v_lh, bool const s_rh);
 
 // ijkVecOr4bs
 //	Component-wise logical 'and' comparison for 4D boolean vector.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: vector comparison
-bvec4 ijkVecOr4bs(bvec4 const v_lh, bool const s_rh);
+ijk_inl bvec4 ijkVecOr4bs(bvec4 const v_lh, bool const s_rh);
 
 // ijkVecNor4bs
 //	Component-wise logical 'and' comparison for 4D boolean vector.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: vector comparison
-bvec4 ijkVecNor4bs(bvec4 const v_lh, bool const s_rh);
+ijk_inl bvec4 ijkVecNor4bs(bvec4 const v_lh, bool const s_rh);
 
 // ijkVecEqual4sb
 //	Equality comparison for 4D boolean vector vs condition.
 //		param s_lh: left-hand condition
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec4 ijkVecEqual4sb(bool const s_lh, bvec4 const v_rh);
+ijk_inl bvec4 ijkVecEqual4sb(bool const s_lh, bvec4 const v_rh);
 
 // ijkVecInequal4sb
 //	Inequality comparison for 4D boolean vector vs condition.
 //		param s_lh: left-hand condition
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec4 ijkVecInequal4sb(bool const s_lh, bvec4 const v_rh);
+ijk_inl bvec4 ijkVecInequal4sb(bool const s_lh, bvec4 const v_rh);
 
 // ijkVecAnd4sb
 //	Component-wise logical 'and' comparison for 4D boolean vector.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec4 ijkVecAnd4sb(bool const s_lh, bvec4 const v_rh);
+ijk_inl bvec4 ijkVecAnd4sb(bool const s_lh, bvec4 const v_rh);
 
 // ijkVecNand4sb
 //	Component-wise logical 'nand' comparison for 4D boolean vector.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec4 ijkVecNand4sb(bool const s_lh, bvec4 const v_rh);
+ijk_inl bvec4 ijkVecNand4sb(bool const s_lh, bvec4 const v_rh);
 
 // ijkVecOr4sb
 //	Component-wise logical 'and' comparison for 4D boolean vector.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec4 ijkVecOr4sb(bool const s_lh, bvec4 const v_rh);
+ijk_inl bvec4 ijkVecOr4sb(bool const s_lh, bvec4 const v_rh);
 
 // ijkVecNor4sb
 //	Component-wise logical 'and' comparison for 4D boolean vector.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: vector comparison
-bvec4 ijkVecNor4sb(bool const s_lh, bvec4 const v_rh);
+ijk_inl bvec4 ijkVecNor4sb(bool const s_lh, bvec4 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -38,50 +38,50 @@ extern "C" {
 //	Absolute value of scalar: (s >= 0 ? +s : -s).
 //		param s: scalar
 //		return: absolute value
-f64 ijkVecAbs1ds(f64 const s);
+ijk_inl f64 ijkVecAbs1ds(f64 const s);
 
 // ijkVecSgn1*s
 //	Sign of scalar: (s != 0 ? s > 0 ? +1 : -1).
 //		param s: scalar
 //		return: sign
-f64 ijkVecSgn1ds(f64 const s);
+ijk_inl f64 ijkVecSgn1ds(f64 const s);
 
 // ijkVecDot1*s
 //	Dot product of scalars, which is just their product.
 //		param s_lh: left-hand scalar
 //		param s_rh: right-hand scalar
 //		return: product
-f64 ijkVecDot1ds(f64 const s_lh, f64 const s_rh);
+ijk_inl f64 ijkVecDot1ds(f64 const s_lh, f64 const s_rh);
 
 // ijkVecLengthSq1*s
 //	Squared length of scalar.
 //		param s: scalar
 //		return: squared length
-f64 ijkVecLengthSq1ds(f64 const s);
+ijk_inl f64 ijkVecLengthSq1ds(f64 const s);
 
 // ijkVecLength1*s
 //	Length of scalar.
 //		param s: scalar
 //		return: length
-f64 ijkVecLength1ds(f64 const s);
+ijk_inl f64 ijkVecLength1ds(f64 const s);
 
 // ijkVecLengthSqInv1*s
 //	Inverse squared length of scalar.
 //		param s: scalar
 //		return: inverse squared length
-f64 ijkVecLengthSqInv1ds(f64 const s);
+ijk_inl f64 ijkVecLengthSqInv1ds(f64 const s);
 
 // ijkVecLengthSqInv1*s
 //	Inverse length of scalar.
 //		param s: scalar
 //		return: inverse length
-f64 ijkVecLengthInv1ds(f64 const s);
+ijk_inl f64 ijkVecLengthInv1ds(f64 const s);
 
 // ijkVecNormalize1*s
 //	Calculate unit scalar in same direction as input (sign).
 //		param s: scalar
 //		return: unit scalar (sign)
-f64 ijkVecNormalize1ds(f64 const s);
+ijk_inl f64 ijkVecNormalize1ds(f64 const s);
 
 // ijkVecNormalizeGetLength1*s
 //	Calculate unit scalar in same direction as input (sign).
@@ -89,7 +89,7 @@ f64 ijkVecNormalize1ds(f64 const s);
 //		param s: scalar
 //		param length_out: pointer to length storage
 //		return: unit scalar (sign)
-f64 ijkVecNormalizeGetLength1ds(f64 const s, f64* const length_out);
+ijk_inl f64 ijkVecNormalizeGetLength1ds(f64 const s, f64* const length_out);
 
 // ijkVecNormalizeGetLengthInv1*s
 //	Calculate unit scalar in same direction as input (sign).
@@ -97,7 +97,7 @@ f64 ijkVecNormalizeGetLength1ds(f64 const s, f64* const length_out);
 //		param s: scalar
 //		param lengthInv_out: pointer to length storage
 //		return: unit scalar (sign)
-f64 ijkVecNormalizeGetLengthInv1ds(f64 const s, f64* const lengthInv_out);
+ijk_inl f64 ijkVecNormalizeGetLengthInv1ds(f64 const s, f64* const lengthInv_out);
 
 
 //-----------------------------------------------------------------------------
@@ -106,7 +106,7 @@ f64 ijkVecNormalizeGetLengthInv1ds(f64 const s, f64* const lengthInv_out);
 //	Pass-thru array-based vector function (does nothing).
 //		param v_out: output vector
 //		return: v_out
-doublev ijkVecPdv(doublev v_out);
+ijk_inl doublev ijkVecPdv(doublev v_out);
 
 
 //-----------------------------------------------------------------------------
@@ -115,7 +115,7 @@ doublev ijkVecPdv(doublev v_out);
 //	Initialize 2D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-doublev ijkVecInit2dv(double2 v_out);
+ijk_inl doublev ijkVecInit2dv(double2 v_out);
 
 // ijkVecInitElems2*v
 //	Initialize 2D vector to specified individual elements.
@@ -123,28 +123,28 @@ doublev ijkVecInit2dv(double2 v_out);
 //		param x: first element
 //		param y: second element
 //		return: v_out
-doublev ijkVecInitElems2dv(double2 v_out, f64 const x, f64 const y);
+ijk_inl doublev ijkVecInitElems2dv(double2 v_out, f64 const x, f64 const y);
 
 // ijkVecCopy2*v
 //	Copy 2D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-doublev ijkVecCopy2dv(double2 v_out, double2 const v_in);
+ijk_inl doublev ijkVecCopy2dv(double2 v_out, double2 const v_in);
 
 // ijkVecNegate2*v
 //	Negate 2D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-doublev ijkVecNegate2dv(double2 v_out, double2 const v_in);
+ijk_inl doublev ijkVecNegate2dv(double2 v_out, double2 const v_in);
 
 // ijkVecNot2*v
 //	Calculate component-wise logical 'not' of 2D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot2dv(bool2 bv_out, double2 const v_in);
+ijk_inl boolv ijkVecNot2dv(bool2 bv_out, double2 const v_in);
 
 // ijkVecAdd2*v
 //	Calculate sum of 2D vectors.
@@ -152,7 +152,7 @@ boolv ijkVecNot2dv(bool2 bv_out, double2 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecAdd2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
+ijk_inl doublev ijkVecAdd2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecSub2*v
 //	Calculate difference of 2D vectors.
@@ -160,7 +160,7 @@ doublev ijkVecAdd2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecSub2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
+ijk_inl doublev ijkVecSub2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecMul2*v
 //	Calculate component-wise product of 2D vectors.
@@ -168,7 +168,7 @@ doublev ijkVecSub2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecMul2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
+ijk_inl doublev ijkVecMul2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecDiv2*v
 //	Calculate component-wise quotient of 2D vectors.
@@ -176,7 +176,7 @@ doublev ijkVecMul2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecDiv2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
+ijk_inl doublev ijkVecDiv2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecDivSafe2*v
 //	Calculate component-wise quotient of 2D vectors, division-by-zero safe.
@@ -184,7 +184,7 @@ doublev ijkVecDiv2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecDivSafe2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
+ijk_inl doublev ijkVecDivSafe2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecMod2*v
 //	Calculate component-wise remainder of 2D vectors.
@@ -192,7 +192,7 @@ doublev ijkVecDivSafe2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecMod2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
+ijk_inl doublev ijkVecMod2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecModSafe2*v
 //	Calculate component-wise remainder of 2D vectors, division-by-zero safe.
@@ -200,7 +200,7 @@ doublev ijkVecMod2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecModSafe2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
+ijk_inl doublev ijkVecModSafe2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecEqual2*v
 //	Equality comparison for 2D vectors.
@@ -208,7 +208,7 @@ doublev ijkVecModSafe2dv(double2 v_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
+ijk_inl boolv ijkVecEqual2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecInequal2*v
 //	Inequality comparison for 2D vectors.
@@ -216,7 +216,7 @@ boolv ijkVecEqual2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
+ijk_inl boolv ijkVecInequal2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecLessEqual2*v
 //	Less-than or equal comparison for 2D vectors.
@@ -224,7 +224,7 @@ boolv ijkVecInequal2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
+ijk_inl boolv ijkVecLessEqual2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecGreaterEqual2*v
 //	Greater-than or equal comparison for 2D vectors.
@@ -232,7 +232,7 @@ boolv ijkVecLessEqual2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecLess2*v
 //	Less-than comparison for 2D vectors.
@@ -240,7 +240,7 @@ boolv ijkVecGreaterEqual2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
+ijk_inl boolv ijkVecLess2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecGreater2*v
 //	Greater-than comparison for 2D vectors.
@@ -248,7 +248,7 @@ boolv ijkVecLess2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
+ijk_inl boolv ijkVecGreater2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecAnd2*v
 //	Component-wise logical 'and' of 2D vectors.
@@ -256,7 +256,7 @@ boolv ijkVecGreater2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
+ijk_inl boolv ijkVecAnd2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecNand2*v
 //	Component-wise logical 'nand' of 2D vectors.
@@ -264,7 +264,7 @@ boolv ijkVecAnd2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
+ijk_inl boolv ijkVecNand2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecOr2*v
 //	Component-wise logical 'or' of 2D vectors.
@@ -272,7 +272,7 @@ boolv ijkVecNand2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
+ijk_inl boolv ijkVecOr2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecNor2*v
 //	Component-wise logical 'nor' of 2D vectors.
@@ -280,28 +280,28 @@ boolv ijkVecOr2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
+ijk_inl boolv ijkVecNor2dv(bool2 bv_out, double2 const v_lh, double2 const v_rh);
 
 // ijkVecCopy2*vs
 //	Copy 2D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-doublev ijkVecCopy2dvs(double2 v_out, f64 const s_in);
+ijk_inl doublev ijkVecCopy2dvs(double2 v_out, f64 const s_in);
 
 // ijkVecNegate2*vs
 //	Negate scalar to 2D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-doublev ijkVecNegate2dvs(double2 v_out, f64 const s_in);
+ijk_inl doublev ijkVecNegate2dvs(double2 v_out, f64 const s_in);
 
 // ijkVecNot2*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot2dvs(bool2 bv_out, f64 const s_in);
+ijk_inl boolv ijkVecNot2dvs(bool2 bv_out, f64 const s_in);
 
 // ijkVecAdd2*vs
 //	Calculate sum of 2D vector components and scalar.
@@ -309,7 +309,7 @@ boolv ijkVecNot2dvs(bool2 bv_out, f64 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecAdd2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecAdd2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecSub2*vs
 //	Calculate difference of 2D vector components and scalar.
@@ -317,7 +317,7 @@ doublev ijkVecAdd2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecSub2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecSub2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecMul2*vs
 //	Calculate product of 2D vector components by scalar.
@@ -325,7 +325,7 @@ doublev ijkVecSub2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecMul2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecMul2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecDiv2*vs
 //	Calculate quotient of 2D vector components by scalar.
@@ -333,7 +333,7 @@ doublev ijkVecMul2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecDiv2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecDiv2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecDivSafe2*vs
 //	Calculate quotient of 2D vector components by scalar, division-by-zero safe.
@@ -341,7 +341,7 @@ doublev ijkVecDiv2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecDivSafe2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecDivSafe2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecMod2*vs
 //	Calculate remainder of 2D vector components by scalar.
@@ -349,7 +349,7 @@ doublev ijkVecDivSafe2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecMod2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecMod2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecModSafe2*vs
 //	Calculate remainder of 2D vector components by scalar, division-by-zero safe.
@@ -357,7 +357,7 @@ doublev ijkVecMod2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecModSafe2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecModSafe2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecEqual2*vs
 //	Equality comparison of 2D vector components and scalar.
@@ -365,7 +365,7 @@ doublev ijkVecModSafe2dvs(double2 v_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecEqual2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecInequal2*vs
 //	Inequality comparison of 2D vector components and scalar.
@@ -373,7 +373,7 @@ boolv ijkVecEqual2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecInequal2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecLessEqual2*vs
 //	Less-than or equal comparison of 2D vector components and scalar.
@@ -381,7 +381,7 @@ boolv ijkVecInequal2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecLessEqual2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecGreaterEqual2*vs
 //	Greater-than or equal comparison of 2D vector components and scalar.
@@ -389,7 +389,7 @@ boolv ijkVecLessEqual2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecLess2*vs
 //	Less-than comparison of 2D vector components and scalar.
@@ -397,7 +397,7 @@ boolv ijkVecGreaterEqual2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecLess2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecGreater2*vs
 //	Greater-than comparison of 2D vector components and scalar.
@@ -405,7 +405,7 @@ boolv ijkVecLess2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecGreater2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecAnd2*vs
 //	Component-wise logical 'and' of 2D vector and scalar.
@@ -413,7 +413,7 @@ boolv ijkVecGreater2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecAnd2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecNand2*vs
 //	Component-wise logical 'nand' of 2D vector and scalar.
@@ -421,7 +421,7 @@ boolv ijkVecAnd2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecNand2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecOr2*vs
 //	Component-wise logical 'or' of 2D vector and scalar.
@@ -429,7 +429,7 @@ boolv ijkVecNand2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecOr2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecNor2*vs
 //	Component-wise logical 'nor' of 2D vector and scalar.
@@ -437,7 +437,7 @@ boolv ijkVecOr2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecNor2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 
 // ijkVecAdd2*sv
 //	Calculate sum of scalar and 2D vector components.
@@ -445,7 +445,7 @@ boolv ijkVecNor2dvs(bool2 bv_out, double2 const v_lh, f64 const s_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecAdd2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
+ijk_inl doublev ijkVecAdd2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecSub2*sv
 //	Calculate difference of scalar and 2D vector components.
@@ -453,7 +453,7 @@ doublev ijkVecAdd2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecSub2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
+ijk_inl doublev ijkVecSub2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecMul2*sv
 //	Calculate product of scalar by 2D vector components.
@@ -461,7 +461,7 @@ doublev ijkVecSub2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecMul2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
+ijk_inl doublev ijkVecMul2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecDiv2*sv
 //	Calculate quotient of scalar by 2D vector components.
@@ -469,7 +469,7 @@ doublev ijkVecMul2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecDiv2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
+ijk_inl doublev ijkVecDiv2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecDivSafe2*sv
 //	Calculate quotient of scalar by 2D vector components, division-by-zero safe.
@@ -477,7 +477,7 @@ doublev ijkVecDiv2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecDivSafe2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
+ijk_inl doublev ijkVecDivSafe2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecMod2*sv
 //	Calculate remainder of scalar by 2D vector components.
@@ -485,7 +485,7 @@ doublev ijkVecDivSafe2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecMod2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
+ijk_inl doublev ijkVecMod2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecModSafe2*sv
 //	Calculate remainder of scalar by 2D vector components, division-by-zero safe.
@@ -493,7 +493,7 @@ doublev ijkVecMod2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecModSafe2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
+ijk_inl doublev ijkVecModSafe2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecEqual2*sv
 //	Equality comparison of scalar and 2D vector components.
@@ -501,7 +501,7 @@ doublev ijkVecModSafe2dsv(double2 v_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
+ijk_inl boolv ijkVecEqual2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecInequal2*sv
 //	Inequality comparison of scalar and 2D vector components.
@@ -509,7 +509,7 @@ boolv ijkVecEqual2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
+ijk_inl boolv ijkVecInequal2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecLessEqual2*sv
 //	Less-than or equal comparison of scalar and 2D vector components.
@@ -517,7 +517,7 @@ boolv ijkVecInequal2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
+ijk_inl boolv ijkVecLessEqual2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecGreaterEqual2*sv
 //	Greater-than or equal comparison of scalar and 2D vector components.
@@ -525,7 +525,7 @@ boolv ijkVecLessEqual2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecLess2*sv
 //	Less-than comparison of scalar and 2D vector components.
@@ -533,7 +533,7 @@ boolv ijkVecGreaterEqual2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
+ijk_inl boolv ijkVecLess2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecGreater2*sv
 //	Greater-than comparison of scalar and 2D vector components.
@@ -541,7 +541,7 @@ boolv ijkVecLess2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
+ijk_inl boolv ijkVecGreater2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecAnd2*sv
 //	Component-wise logical 'and' of 2D vector and scalar.
@@ -549,7 +549,7 @@ boolv ijkVecGreater2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
+ijk_inl boolv ijkVecAnd2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecNand2*sv
 //	Component-wise logical 'nand' of 2D vector and scalar.
@@ -557,7 +557,7 @@ boolv ijkVecAnd2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
+ijk_inl boolv ijkVecNand2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecOr2*sv
 //	Component-wise logical 'or' of 2D vector and scalar.
@@ -565,7 +565,7 @@ boolv ijkVecNand2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
+ijk_inl boolv ijkVecOr2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecNor2*sv
 //	Component-wise logical 'nor' of 2D vector and scalar.
@@ -573,21 +573,21 @@ boolv ijkVecOr2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
+ijk_inl boolv ijkVecNor2dsv(bool2 bv_out, f64 const s_lh, double2 const v_rh);
 
 // ijkVecDot2*v
 //	Dot product of 2D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-f64 ijkVecDot2dv(double2 const v_lh, double2 const v_rh);
+ijk_inl f64 ijkVecDot2dv(double2 const v_lh, double2 const v_rh);
 
 // ijkVecCross2*v
 //	Cross product scalar of 2D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar quantity of imaginary perpendicular axis
-f64 ijkVecCross2dv(double2 const v_lh, double2 const v_rh);
+ijk_inl f64 ijkVecCross2dv(double2 const v_lh, double2 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -596,7 +596,7 @@ f64 ijkVecCross2dv(double2 const v_lh, double2 const v_rh);
 //	Initialize 3D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-doublev ijkVecInit3dv(double3 v_out);
+ijk_inl doublev ijkVecInit3dv(double3 v_out);
 
 // ijkVecInitElems3*v
 //	Initialize 3D vector to specified individual elements.
@@ -605,28 +605,28 @@ doublev ijkVecInit3dv(double3 v_out);
 //		param y: second element
 //		param z: third element
 //		return: v_out
-doublev ijkVecInitElems3dv(double3 v_out, f64 const x, f64 const y, f64 const z);
+ijk_inl doublev ijkVecInitElems3dv(double3 v_out, f64 const x, f64 const y, f64 const z);
 
 // ijkVecCopy3*v
 //	Copy 3D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-doublev ijkVecCopy3dv(double3 v_out, double3 const v_in);
+ijk_inl doublev ijkVecCopy3dv(double3 v_out, double3 const v_in);
 
 // ijkVecNegate3*v
 //	Negate 3D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-doublev ijkVecNegate3dv(double3 v_out, double3 const v_in);
+ijk_inl doublev ijkVecNegate3dv(double3 v_out, double3 const v_in);
 
 // ijkVecNot3*v
 //	Calculate component-wise logical 'not' of 3D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot3dv(bool3 bv_out, double3 const v_in);
+ijk_inl boolv ijkVecNot3dv(bool3 bv_out, double3 const v_in);
 
 // ijkVecAdd3*v
 //	Calculate sum of 3D vectors.
@@ -634,7 +634,7 @@ boolv ijkVecNot3dv(bool3 bv_out, double3 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecAdd3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
+ijk_inl doublev ijkVecAdd3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecSub3*v
 //	Calculate difference of 3D vectors.
@@ -642,7 +642,7 @@ doublev ijkVecAdd3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecSub3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
+ijk_inl doublev ijkVecSub3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecMul3*v
 //	Calculate component-wise product of 3D vectors.
@@ -650,7 +650,7 @@ doublev ijkVecSub3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecMul3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
+ijk_inl doublev ijkVecMul3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecDiv3*v
 //	Calculate component-wise quotient of 3D vectors.
@@ -658,7 +658,7 @@ doublev ijkVecMul3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecDiv3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
+ijk_inl doublev ijkVecDiv3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecDivSafe3*v
 //	Calculate component-wise quotient of 3D vectors, division-by-zero safe.
@@ -666,7 +666,7 @@ doublev ijkVecDiv3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecDivSafe3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
+ijk_inl doublev ijkVecDivSafe3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecMod3*v
 //	Calculate component-wise remainder of 3D vectors.
@@ -674,7 +674,7 @@ doublev ijkVecDivSafe3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecMod3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
+ijk_inl doublev ijkVecMod3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecModSafe3*v
 //	Calculate component-wise remainder of 3D vectors, division-by-zero safe.
@@ -682,7 +682,7 @@ doublev ijkVecMod3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecModSafe3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
+ijk_inl doublev ijkVecModSafe3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecEqual3*v
 //	Equality comparison for 3D vectors.
@@ -690,7 +690,7 @@ doublev ijkVecModSafe3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
+ijk_inl boolv ijkVecEqual3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecInequal3*v
 //	Inequality comparison for 3D vectors.
@@ -698,7 +698,7 @@ boolv ijkVecEqual3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
+ijk_inl boolv ijkVecInequal3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecLessEqual3*v
 //	Less-than or equal comparison for 3D vectors.
@@ -706,7 +706,7 @@ boolv ijkVecInequal3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
+ijk_inl boolv ijkVecLessEqual3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecGreaterEqual3*v
 //	Greater-than or equal comparison for 3D vectors.
@@ -714,7 +714,7 @@ boolv ijkVecLessEqual3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecLess3*v
 //	Less-than comparison for 3D vectors.
@@ -722,7 +722,7 @@ boolv ijkVecGreaterEqual3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
+ijk_inl boolv ijkVecLess3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecGreater3*v
 //	Greater-than comparison for 3D vectors.
@@ -730,7 +730,7 @@ boolv ijkVecLess3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
+ijk_inl boolv ijkVecGreater3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecAnd3*v
 //	Component-wise logical 'and' of 3D vectors.
@@ -738,7 +738,7 @@ boolv ijkVecGreater3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
+ijk_inl boolv ijkVecAnd3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecNand3*v
 //	Component-wise logical 'nand' of 3D vectors.
@@ -746,7 +746,7 @@ boolv ijkVecAnd3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
+ijk_inl boolv ijkVecNand3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecOr3*v
 //	Component-wise logical 'or' of 3D vectors.
@@ -754,7 +754,7 @@ boolv ijkVecNand3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
+ijk_inl boolv ijkVecOr3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecNor3*v
 //	Component-wise logical 'nor' of 3D vectors.
@@ -762,7 +762,7 @@ boolv ijkVecOr3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
+ijk_inl boolv ijkVecNor3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecCopy3*vz
 //	Copy 3D vector from 2D vector and one scalar.
@@ -770,28 +770,28 @@ boolv ijkVecNor3dv(bool3 bv_out, double3 const v_lh, double3 const v_rh);
 //		param v_xy: input 2D vector holding first two components
 //		param z: third element
 //		return: v_out
-doublev ijkVecCopy3dvz(double3 v_out, double2 const v_xy, f64 const z);
+ijk_inl doublev ijkVecCopy3dvz(double3 v_out, double2 const v_xy, f64 const z);
 
 // ijkVecCopy3*vs
 //	Copy 3D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-doublev ijkVecCopy3dvs(double3 v_out, f64 const s_in);
+ijk_inl doublev ijkVecCopy3dvs(double3 v_out, f64 const s_in);
 
 // ijkVecNegate3*vs
 //	Negate scalar to 3D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-doublev ijkVecNegate3dvs(double3 v_out, f64 const s_in);
+ijk_inl doublev ijkVecNegate3dvs(double3 v_out, f64 const s_in);
 
 // ijkVecNot3*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot3dvs(bool3 bv_out, f64 const s_in);
+ijk_inl boolv ijkVecNot3dvs(bool3 bv_out, f64 const s_in);
 
 // ijkVecAdd3*vs
 //	Calculate sum of 3D vector components and scalar.
@@ -799,7 +799,7 @@ boolv ijkVecNot3dvs(bool3 bv_out, f64 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecAdd3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecAdd3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecSub3*vs
 //	Calculate difference of 3D vector components and scalar.
@@ -807,7 +807,7 @@ doublev ijkVecAdd3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecSub3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecSub3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecMul3*vs
 //	Calculate product of 3D vector components by scalar.
@@ -815,7 +815,7 @@ doublev ijkVecSub3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecMul3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecMul3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecDiv3*vs
 //	Calculate quotient of 3D vector components by scalar.
@@ -823,7 +823,7 @@ doublev ijkVecMul3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecDiv3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecDiv3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecDivSafe3*vs
 //	Calculate quotient of 3D vector components by scalar, division-by-zero safe.
@@ -831,7 +831,7 @@ doublev ijkVecDiv3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecDivSafe3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecDivSafe3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecMod3*vs
 //	Calculate remainder of 3D vector components by scalar.
@@ -839,7 +839,7 @@ doublev ijkVecDivSafe3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecMod3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecMod3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecModSafe3*vs
 //	Calculate remainder of 3D vector components by scalar, division-by-zero safe.
@@ -847,7 +847,7 @@ doublev ijkVecMod3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecModSafe3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecModSafe3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecEqual3*vs
 //	Equality comparison of 3D vector components and scalar.
@@ -855,7 +855,7 @@ doublev ijkVecModSafe3dvs(double3 v_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecEqual3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecInequal3*vs
 //	Inequality comparison of 3D vector components and scalar.
@@ -863,7 +863,7 @@ boolv ijkVecEqual3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecInequal3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecLessEqual3*vs
 //	Less-than or equal comparison of 3D vector components and scalar.
@@ -871,7 +871,7 @@ boolv ijkVecInequal3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecLessEqual3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecGreaterEqual3*vs
 //	Greater-than or equal comparison of 3D vector components and scalar.
@@ -879,7 +879,7 @@ boolv ijkVecLessEqual3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecLess3*vs
 //	Less-than comparison of 3D vector components and scalar.
@@ -887,7 +887,7 @@ boolv ijkVecGreaterEqual3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecLess3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecGreater3*vs
 //	Greater-than comparison of 3D vector components and scalar.
@@ -895,7 +895,7 @@ boolv ijkVecLess3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecGreater3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecAnd3*vs
 //	Component-wise logical 'and' of 3D vector and scalar.
@@ -903,7 +903,7 @@ boolv ijkVecGreater3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecAnd3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecNand3*vs
 //	Component-wise logical 'nand' of 3D vector and scalar.
@@ -911,7 +911,7 @@ boolv ijkVecAnd3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecNand3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecOr3*vs
 //	Component-wise logical 'or' of 3D vector and scalar.
@@ -919,7 +919,7 @@ boolv ijkVecNand3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecOr3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecNor3*vs
 //	Component-wise logical 'nor' of 3D vector and scalar.
@@ -927,7 +927,7 @@ boolv ijkVecOr3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecNor3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 
 // ijkVecCopy3*xv
 //	Copy 3D vector from 2D vector and one scalar.
@@ -935,7 +935,7 @@ boolv ijkVecNor3dvs(bool3 bv_out, double3 const v_lh, f64 const s_rh);
 //		param x: first element
 //		param v_yz: input 2D vector holding last two components
 //		return: v_out
-doublev ijkVecCopy3dxv(double3 v_out, f64 const x, double2 const v_yz);
+ijk_inl doublev ijkVecCopy3dxv(double3 v_out, f64 const x, double2 const v_yz);
 
 // ijkVecAdd3*sv
 //	Calculate sum of scalar and 3D vector components.
@@ -943,7 +943,7 @@ doublev ijkVecCopy3dxv(double3 v_out, f64 const x, double2 const v_yz);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecAdd3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
+ijk_inl doublev ijkVecAdd3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecSub3*sv
 //	Calculate difference of scalar and 3D vector components.
@@ -951,7 +951,7 @@ doublev ijkVecAdd3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecSub3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
+ijk_inl doublev ijkVecSub3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecMul3*sv
 //	Calculate product of scalar by 3D vector components.
@@ -959,7 +959,7 @@ doublev ijkVecSub3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecMul3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
+ijk_inl doublev ijkVecMul3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecDiv3*sv
 //	Calculate quotient of scalar by 3D vector components.
@@ -967,7 +967,7 @@ doublev ijkVecMul3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecDiv3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
+ijk_inl doublev ijkVecDiv3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecDivSafe3*sv
 //	Calculate quotient of scalar by 3D vector components, division-by-zero safe.
@@ -975,7 +975,7 @@ doublev ijkVecDiv3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecDivSafe3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
+ijk_inl doublev ijkVecDivSafe3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecMod3*sv
 //	Calculate remainder of scalar by 3D vector components.
@@ -983,7 +983,7 @@ doublev ijkVecDivSafe3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecMod3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
+ijk_inl doublev ijkVecMod3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecModSafe3*sv
 //	Calculate remainder of scalar by 3D vector components, division-by-zero safe.
@@ -991,7 +991,7 @@ doublev ijkVecMod3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecModSafe3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
+ijk_inl doublev ijkVecModSafe3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecEqual3*sv
 //	Equality comparison of scalar and 3D vector components.
@@ -999,7 +999,7 @@ doublev ijkVecModSafe3dsv(double3 v_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
+ijk_inl boolv ijkVecEqual3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecInequal3*sv
 //	Inequality comparison of scalar and 3D vector components.
@@ -1007,7 +1007,7 @@ boolv ijkVecEqual3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
+ijk_inl boolv ijkVecInequal3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecLessEqual3*sv
 //	Less-than or equal comparison of scalar and 3D vector components.
@@ -1015,7 +1015,7 @@ boolv ijkVecInequal3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
+ijk_inl boolv ijkVecLessEqual3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecGreaterEqual3*sv
 //	Greater-than or equal comparison of scalar and 3D vector components.
@@ -1023,7 +1023,7 @@ boolv ijkVecLessEqual3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecLess3*sv
 //	Less-than comparison of scalar and 3D vector components.
@@ -1031,7 +1031,7 @@ boolv ijkVecGreaterEqual3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
+ijk_inl boolv ijkVecLess3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecGreater3*sv
 //	Greater-than comparison of scalar and 3D vector components.
@@ -1039,7 +1039,7 @@ boolv ijkVecLess3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
+ijk_inl boolv ijkVecGreater3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecAnd3*sv
 //	Component-wise logical 'and' of 3D vector and scalar.
@@ -1047,7 +1047,7 @@ boolv ijkVecGreater3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
+ijk_inl boolv ijkVecAnd3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecNand3*sv
 //	Component-wise logical 'nand' of 3D vector and scalar.
@@ -1055,7 +1055,7 @@ boolv ijkVecAnd3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
+ijk_inl boolv ijkVecNand3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecOr3*sv
 //	Component-wise logical 'or' of 3D vector and scalar.
@@ -1063,7 +1063,7 @@ boolv ijkVecNand3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
+ijk_inl boolv ijkVecOr3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecNor3*sv
 //	Component-wise logical 'nor' of 3D vector and scalar.
@@ -1071,14 +1071,14 @@ boolv ijkVecOr3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
+ijk_inl boolv ijkVecNor3dsv(bool3 bv_out, f64 const s_lh, double3 const v_rh);
 
 // ijkVecDot3*v
 //	Dot product of 3D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-f64 ijkVecDot3dv(double3 const v_lh, double3 const v_rh);
+ijk_inl f64 ijkVecDot3dv(double3 const v_lh, double3 const v_rh);
 
 // ijkVecCross3*v
 //	Cross product of 3D array-based vectors.
@@ -1086,7 +1086,7 @@ f64 ijkVecDot3dv(double3 const v_lh, double3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecCross3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
+ijk_inl doublev ijkVecCross3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -1095,7 +1095,7 @@ doublev ijkVecCross3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 //	Initialize 4D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-doublev ijkVecInit4dv(double4 v_out);
+ijk_inl doublev ijkVecInit4dv(double4 v_out);
 
 // ijkVecInitElems4*v
 //	Initialize 4D vector to specified individual elements.
@@ -1105,7 +1105,7 @@ doublev ijkVecInit4dv(double4 v_out);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for podouble, 0 for vector)
 //		return: v_out
-doublev ijkVecInitElems4dv(double4 v_out, f64 const x, f64 const y, f64 const z, f64 const w);
+ijk_inl doublev ijkVecInitElems4dv(double4 v_out, f64 const x, f64 const y, f64 const z, f64 const w);
 
 // ijkVecCopy4*xvw
 //	Copy 4D vector from scalar, 2D vector and another scalar.
@@ -1114,7 +1114,7 @@ doublev ijkVecInitElems4dv(double4 v_out, f64 const x, f64 const y, f64 const z,
 //		param v_yz: input 2D vector holding middle two components
 //		param w: fourth element (in space, set as 1 for podouble, 0 for vector)
 //		return: v_out
-doublev ijkVecCopy4dxvw(double4 v_out, f64 const x, double2 const v_yz, f64 const w);
+ijk_inl doublev ijkVecCopy4dxvw(double4 v_out, f64 const x, double2 const v_yz, f64 const w);
 
 // ijkVecCopy4*v2
 //	Copy 4D vector from two 2D vectors.
@@ -1122,28 +1122,28 @@ doublev ijkVecCopy4dxvw(double4 v_out, f64 const x, double2 const v_yz, f64 cons
 //		param v_xy: input 2D vector holding first two components
 //		param v_zw: input 2D vector holding last two components
 //		return: v_out
-doublev ijkVecCopy4dv2(double4 v_out, double2 const v_xy, double2 const v_zw);
+ijk_inl doublev ijkVecCopy4dv2(double4 v_out, double2 const v_xy, double2 const v_zw);
 
 // ijkVecCopy4*v
 //	Copy 4D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-doublev ijkVecCopy4dv(double4 v_out, double4 const v_in);
+ijk_inl doublev ijkVecCopy4dv(double4 v_out, double4 const v_in);
 
 // ijkVecNegate4*v
 //	Negate 4D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-doublev ijkVecNegate4dv(double4 v_out, double4 const v_in);
+ijk_inl doublev ijkVecNegate4dv(double4 v_out, double4 const v_in);
 
 // ijkVecNot4*v
 //	Calculate component-wise logical 'not' of 4D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot4dv(bool4 bv_out, double4 const v_in);
+ijk_inl boolv ijkVecNot4dv(bool4 bv_out, double4 const v_in);
 
 // ijkVecAdd4*v
 //	Calculate sum of 4D vectors.
@@ -1151,7 +1151,7 @@ boolv ijkVecNot4dv(bool4 bv_out, double4 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecAdd4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
+ijk_inl doublev ijkVecAdd4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecSub4*v
 //	Calculate difference of 4D vectors.
@@ -1159,7 +1159,7 @@ doublev ijkVecAdd4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecSub4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
+ijk_inl doublev ijkVecSub4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecMul4*v
 //	Calculate component-wise product of 4D vectors.
@@ -1167,7 +1167,7 @@ doublev ijkVecSub4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecMul4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
+ijk_inl doublev ijkVecMul4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecDiv4*v
 //	Calculate component-wise quotient of 4D vectors.
@@ -1175,7 +1175,7 @@ doublev ijkVecMul4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecDiv4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
+ijk_inl doublev ijkVecDiv4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecDivSafe4*v
 //	Calculate component-wise quotient of 4D vectors, division-by-zero safe.
@@ -1183,7 +1183,7 @@ doublev ijkVecDiv4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecDivSafe4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
+ijk_inl doublev ijkVecDivSafe4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecMod4*v
 //	Calculate component-wise remainder of 4D vectors.
@@ -1191,7 +1191,7 @@ doublev ijkVecDivSafe4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecMod4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
+ijk_inl doublev ijkVecMod4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecModSafe4*v
 //	Calculate component-wise remainder of 4D vectors, division-by-zero safe.
@@ -1199,7 +1199,7 @@ doublev ijkVecMod4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecModSafe4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
+ijk_inl doublev ijkVecModSafe4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecEqual4*v
 //	Equality comparison for 4D vectors.
@@ -1207,7 +1207,7 @@ doublev ijkVecModSafe4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
+ijk_inl boolv ijkVecEqual4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecInequal4*v
 //	Inequality comparison for 4D vectors.
@@ -1215,7 +1215,7 @@ boolv ijkVecEqual4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
+ijk_inl boolv ijkVecInequal4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecLessEqual4*v
 //	Less-than or equal comparison for 4D vectors.
@@ -1223,7 +1223,7 @@ boolv ijkVecInequal4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
+ijk_inl boolv ijkVecLessEqual4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecGreaterEqual4*v
 //	Greater-than or equal comparison for 4D vectors.
@@ -1231,7 +1231,7 @@ boolv ijkVecLessEqual4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecLess4*v
 //	Less-than comparison for 4D vectors.
@@ -1239,7 +1239,7 @@ boolv ijkVecGreaterEqual4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
+ijk_inl boolv ijkVecLess4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecGreater4*v
 //	Greater-than comparison for 4D vectors.
@@ -1247,7 +1247,7 @@ boolv ijkVecLess4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
+ijk_inl boolv ijkVecGreater4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecAnd4*v
 //	Component-wise logical 'and' of 4D vectors.
@@ -1255,7 +1255,7 @@ boolv ijkVecGreater4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
+ijk_inl boolv ijkVecAnd4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecNand4*v
 //	Component-wise logical 'nand' of 4D vectors.
@@ -1263,7 +1263,7 @@ boolv ijkVecAnd4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
+ijk_inl boolv ijkVecNand4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecOr4*v
 //	Component-wise logical 'or' of 4D vectors.
@@ -1271,7 +1271,7 @@ boolv ijkVecNand4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
+ijk_inl boolv ijkVecOr4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecNor4*v
 //	Component-wise logical 'nor' of 4D vectors.
@@ -1279,7 +1279,7 @@ boolv ijkVecOr4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
+ijk_inl boolv ijkVecNor4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecCopy4*vzw
 //	Copy 4D vector from 2D vector and two scalars.
@@ -1288,7 +1288,7 @@ boolv ijkVecNor4dv(bool4 bv_out, double4 const v_lh, double4 const v_rh);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for podouble, 0 for vector)
 //		return: v_out
-doublev ijkVecCopy4dvzw(double4 v_out, double2 const v_xy, f64 const z, f64 const w);
+ijk_inl doublev ijkVecCopy4dvzw(double4 v_out, double2 const v_xy, f64 const z, f64 const w);
 
 // ijkVecCopy4*vw
 //	Copy 4D vector from 3D vector and one scalar.
@@ -1296,28 +1296,28 @@ doublev ijkVecCopy4dvzw(double4 v_out, double2 const v_xy, f64 const z, f64 cons
 //		param v_xyz: input 3D vector holding first three components
 //		param w: fourth element (in space, set as 1 for podouble, 0 for vector)
 //		return: v_out
-doublev ijkVecCopy4dvw(double4 v_out, double3 const v_xyz, f64 const w);
+ijk_inl doublev ijkVecCopy4dvw(double4 v_out, double3 const v_xyz, f64 const w);
 
 // ijkVecCopy4*vs
 //	Copy 4D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-doublev ijkVecCopy4dvs(double4 v_out, f64 const s_in);
+ijk_inl doublev ijkVecCopy4dvs(double4 v_out, f64 const s_in);
 
 // ijkVecNegate4*vs
 //	Negate scalar to 4D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-doublev ijkVecNegate4dvs(double4 v_out, f64 const s_in);
+ijk_inl doublev ijkVecNegate4dvs(double4 v_out, f64 const s_in);
 
 // ijkVecNot4*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot4dvs(bool4 bv_out, f64 const s_in);
+ijk_inl boolv ijkVecNot4dvs(bool4 bv_out, f64 const s_in);
 
 // ijkVecAdd4*vs
 //	Calculate sum of 4D vector components and scalar.
@@ -1325,7 +1325,7 @@ boolv ijkVecNot4dvs(bool4 bv_out, f64 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecAdd4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecAdd4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecSub4*vs
 //	Calculate difference of 4D vector components and scalar.
@@ -1333,7 +1333,7 @@ doublev ijkVecAdd4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecSub4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecSub4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecMul4*vs
 //	Calculate product of 4D vector components by scalar.
@@ -1341,7 +1341,7 @@ doublev ijkVecSub4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecMul4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecMul4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecDiv4*vs
 //	Calculate quotient of 4D vector components by scalar.
@@ -1349,7 +1349,7 @@ doublev ijkVecMul4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecDiv4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecDiv4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecDivSafe4*vs
 //	Calculate quotient of 4D vector components by scalar, division-by-zero safe.
@@ -1357,7 +1357,7 @@ doublev ijkVecDiv4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecDivSafe4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecDivSafe4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecMod4*vs
 //	Calculate remainder of 4D vector components by scalar.
@@ -1365,7 +1365,7 @@ doublev ijkVecDivSafe4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecMod4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecMod4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecModSafe4*vs
 //	Calculate remainder of 4D vector components by scalar, division-by-zero safe.
@@ -1373,7 +1373,7 @@ doublev ijkVecMod4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-doublev ijkVecModSafe4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
+ijk_inl doublev ijkVecModSafe4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecEqual4*vs
 //	Equality comparison of 4D vector components and scalar.
@@ -1381,7 +1381,7 @@ doublev ijkVecModSafe4dvs(double4 v_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecEqual4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecInequal4*vs
 //	Inequality comparison of 4D vector components and scalar.
@@ -1389,7 +1389,7 @@ boolv ijkVecEqual4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecInequal4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecLessEqual4*vs
 //	Less-than or equal comparison of 4D vector components and scalar.
@@ -1397,7 +1397,7 @@ boolv ijkVecInequal4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecLessEqual4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecGreaterEqual4*vs
 //	Greater-than or equal comparison of 4D vector components and scalar.
@@ -1405,7 +1405,7 @@ boolv ijkVecLessEqual4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecLess4*vs
 //	Less-than comparison of 4D vector components and scalar.
@@ -1413,7 +1413,7 @@ boolv ijkVecGreaterEqual4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecLess4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecGreater4*vs
 //	Greater-than comparison of 4D vector components and scalar.
@@ -1421,7 +1421,7 @@ boolv ijkVecLess4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecGreater4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecAnd4*vs
 //	Component-wise logical 'and' of 4D vector and scalar.
@@ -1429,7 +1429,7 @@ boolv ijkVecGreater4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecAnd4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecNand4*vs
 //	Component-wise logical 'nand' of 4D vector and scalar.
@@ -1437,7 +1437,7 @@ boolv ijkVecAnd4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecNand4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecOr4*vs
 //	Component-wise logical 'or' of 4D vector and scalar.
@@ -1445,7 +1445,7 @@ boolv ijkVecNand4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecOr4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecNor4*vs
 //	Component-wise logical 'nor' of 4D vector and scalar.
@@ -1453,7 +1453,7 @@ boolv ijkVecOr4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
+ijk_inl boolv ijkVecNor4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 
 // ijkVecCopy4*xyv
 //	Copy 4D vector from two scalars and 2D vector.
@@ -1462,7 +1462,7 @@ boolv ijkVecNor4dvs(bool4 bv_out, double4 const v_lh, f64 const s_rh);
 //		param y: second element
 //		param v_zw: input 2D vector holding last two components
 //		return: v_out
-doublev ijkVecCopy4dxyv(double4 v_out, f64 const x, f64 const y, double2 const v_zw);
+ijk_inl doublev ijkVecCopy4dxyv(double4 v_out, f64 const x, f64 const y, double2 const v_zw);
 
 // ijkVecCopy4*xv
 //	Copy 4D vector from one scalar and 3D vector.
@@ -1470,7 +1470,7 @@ doublev ijkVecCopy4dxyv(double4 v_out, f64 const x, f64 const y, double2 const v
 //		param x: first element
 //		param v_yzw: input 3D vector holding last three components
 //		return: v_out
-doublev ijkVecCopy4dxv(double4 v_out, f64 const x, double3 const v_yzw);
+ijk_inl doublev ijkVecCopy4dxv(double4 v_out, f64 const x, double3 const v_yzw);
 
 // ijkVecAdd4*sv
 //	Calculate sum of scalar and 4D vector components.
@@ -1478,7 +1478,7 @@ doublev ijkVecCopy4dxv(double4 v_out, f64 const x, double3 const v_yzw);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecAdd4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
+ijk_inl doublev ijkVecAdd4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecSub4*sv
 //	Calculate difference of scalar and 4D vector components.
@@ -1486,7 +1486,7 @@ doublev ijkVecAdd4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecSub4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
+ijk_inl doublev ijkVecSub4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecMul4*sv
 //	Calculate product of scalar by 4D vector components.
@@ -1494,7 +1494,7 @@ doublev ijkVecSub4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecMul4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
+ijk_inl doublev ijkVecMul4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecDiv4*sv
 //	Calculate quotient of scalar by 4D vector components.
@@ -1502,7 +1502,7 @@ doublev ijkVecMul4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecDiv4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
+ijk_inl doublev ijkVecDiv4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecDivSafe4*sv
 //	Calculate quotient of scalar by 4D vector components, division-by-zero safe.
@@ -1510,7 +1510,7 @@ doublev ijkVecDiv4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecDivSafe4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
+ijk_inl doublev ijkVecDivSafe4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecMod4*sv
 //	Calculate remainder of scalar by 4D vector components.
@@ -1518,7 +1518,7 @@ doublev ijkVecDivSafe4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecMod4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
+ijk_inl doublev ijkVecMod4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecModSafe4*sv
 //	Calculate remainder of scalar by 4D vector components, division-by-zero safe.
@@ -1526,7 +1526,7 @@ doublev ijkVecMod4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecModSafe4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
+ijk_inl doublev ijkVecModSafe4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecEqual4*sv
 //	Equality comparison of scalar and 4D vector components.
@@ -1534,7 +1534,7 @@ doublev ijkVecModSafe4dsv(double4 v_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
+ijk_inl boolv ijkVecEqual4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecInequal4*sv
 //	Inequality comparison of scalar and 4D vector components.
@@ -1542,7 +1542,7 @@ boolv ijkVecEqual4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
+ijk_inl boolv ijkVecInequal4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecLessEqual4*sv
 //	Less-than or equal comparison of scalar and 4D vector components.
@@ -1550,7 +1550,7 @@ boolv ijkVecInequal4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
+ijk_inl boolv ijkVecLessEqual4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecGreaterEqual4*sv
 //	Greater-than or equal comparison of scalar and 4D vector components.
@@ -1558,7 +1558,7 @@ boolv ijkVecLessEqual4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecLess4*sv
 //	Less-than comparison of scalar and 4D vector components.
@@ -1566,7 +1566,7 @@ boolv ijkVecGreaterEqual4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
+ijk_inl boolv ijkVecLess4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecGreater4*sv
 //	Greater-than comparison of scalar and 4D vector components.
@@ -1574,7 +1574,7 @@ boolv ijkVecLess4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
+ijk_inl boolv ijkVecGreater4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecAnd4*sv
 //	Component-wise logical 'and' of 4D vector and scalar.
@@ -1582,7 +1582,7 @@ boolv ijkVecGreater4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
+ijk_inl boolv ijkVecAnd4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecNand4*sv
 //	Component-wise logical 'nand' of 4D vector and scalar.
@@ -1590,7 +1590,7 @@ boolv ijkVecAnd4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
+ijk_inl boolv ijkVecNand4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecOr4*sv
 //	Component-wise logical 'or' of 4D vector and scalar.
@@ -1598,7 +1598,7 @@ boolv ijkVecNand4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
+ijk_inl boolv ijkVecOr4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecNor4*sv
 //	Component-wise logical 'nor' of 4D vector and scalar.
@@ -1606,14 +1606,14 @@ boolv ijkVecOr4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
+ijk_inl boolv ijkVecNor4dsv(bool4 bv_out, f64 const s_lh, double4 const v_rh);
 
 // ijkVecDot4*v
 //	Dot product of 4D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-f64 ijkVecDot4dv(double4 const v_lh, double4 const v_rh);
+ijk_inl f64 ijkVecDot4dv(double4 const v_lh, double4 const v_rh);
 
 // ijkVecCross4*v
 //	Cross product of 4D array-based vectors.
@@ -1621,7 +1621,7 @@ f64 ijkVecDot4dv(double4 const v_lh, double4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out (fourth element is zero)
-doublev ijkVecCross4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
+ijk_inl doublev ijkVecCross4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -1638,50 +1638,50 @@ doublev ijkVecCross4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 //	Absolute value of scalar: (s >= 0 ? +s : -s).
 //		param s: scalar
 //		return: absolute value
-double ijkVecAbs1d(double const s);
+ijk_inl double ijkVecAbs1d(double const s);
 
 // ijkVecSgn1*
 //	Sign of scalar: (s != 0 ? s > 0 ? +1 : -1).
 //		param s: scalar
 //		return: sign
-double ijkVecSgn1d(double const s);
+ijk_inl double ijkVecSgn1d(double const s);
 
 // ijkVecDot1*
 //	Dot product of scalars, which is just their product.
 //		param s_lh: left-hand scalar
 //		param s_rh: right-hand scalar
 //		return: product
-double ijkVecDot1d(double const s_lh, double const s_rh);
+ijk_inl double ijkVecDot1d(double const s_lh, double const s_rh);
 
 // ijkVecLengthSq1*
 //	Squared length of scalar.
 //		param s: scalar
 //		return: squared length
-double ijkVecLengthSq1d(double const s);
+ijk_inl double ijkVecLengthSq1d(double const s);
 
 // ijkVecLength1*
 //	Length of scalar.
 //		param s: scalar
 //		return: length
-double ijkVecLength1d(double const s);
+ijk_inl double ijkVecLength1d(double const s);
 
 // ijkVecLengthSqInv1*
 //	Inverse squared length of scalar.
 //		param s: scalar
 //		return: inverse squared length
-double ijkVecLengthSqInv1d(double const s);
+ijk_inl double ijkVecLengthSqInv1d(double const s);
 
 // ijkVecLengthSqInv1*
 //	Inverse length of scalar.
 //		param s: scalar
 //		return: inverse length
-double ijkVecLengthInv1d(double const s);
+ijk_inl double ijkVecLengthInv1d(double const s);
 
 // ijkVecNormalize1*
 //	Calculate unit scalar in same direction as input (sign).
 //		param s: scalar
 //		return: unit scalar (sign)
-double ijkVecNormalize1d(double const s);
+ijk_inl double ijkVecNormalize1d(double const s);
 
 // ijkVecNormalizeGetLength1*
 //	Calculate unit scalar in same direction as input (sign).
@@ -1689,7 +1689,7 @@ double ijkVecNormalize1d(double const s);
 //		param s: scalar
 //		param length_out: pointer to length storage
 //		return: unit scalar (sign)
-double ijkVecNormalizeGetLength1d(double const s, double* const length_out);
+ijk_inl double ijkVecNormalizeGetLength1d(double const s, double* const length_out);
 
 // ijkVecNormalizeGetLengthInv1*
 //	Calculate unit scalar in same direction as input (sign).
@@ -1697,7 +1697,7 @@ double ijkVecNormalizeGetLength1d(double const s, double* const length_out);
 //		param s: scalar
 //		param lengthInv_out: pointer to length storage
 //		return: unit scalar (sign)
-double ijkVecNormalizeGetLengthInv1d(double const s, double* const lengthInv_out);
+ijk_inl double ijkVecNormalizeGetLengthInv1d(double const s, double* const lengthInv_out);
 
 
 //-----------------------------------------------------------------------------
@@ -1705,421 +1705,421 @@ double ijkVecNormalizeGetLengthInv1d(double const s, double* const lengthInv_out
 // ijkVecInit2*
 //	Initialize 2D vector to default value (zero vector).
 //		return: default vector
-dvec2 ijkVecInit2d();
+ijk_inl dvec2 ijkVecInit2d();
 
 // ijkVecInitElems2*
 //	Initialize 2D vector to specified individual elements.
 //		param x: first element
 //		param y: second element
 //		return: result vector
-dvec2 ijkVecInitElems2d(double const x, double const y);
+ijk_inl dvec2 ijkVecInitElems2d(double const x, double const y);
 
 // ijkVecCopy2*
 //	Copy 2D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-dvec2 ijkVecCopy2d(dvec2 const v_in);
+ijk_inl dvec2 ijkVecCopy2d(dvec2 const v_in);
 
 // ijkVecNegate2*
 //	Negate 2D vector.
 //		param v_in: input vector
 //		return: result vector
-dvec2 ijkVecNegate2d(dvec2 const v_in);
+ijk_inl dvec2 ijkVecNegate2d(dvec2 const v_in);
 
 // ijkVecNot2*
 //	Calculate component-wise logical 'not' of 2D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec2 ijkVecNot2d(dvec2 const v_in);
+ijk_inl bvec2 ijkVecNot2d(dvec2 const v_in);
 
 // ijkVecAdd2*
 //	Calculate sum of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec2 ijkVecAdd2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl dvec2 ijkVecAdd2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecSub2*
 //	Calculate difference of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec2 ijkVecSub2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl dvec2 ijkVecSub2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecMul2*
 //	Calculate component-wise product of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec2 ijkVecMul2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl dvec2 ijkVecMul2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecDiv2*
 //	Calculate component-wise quotient of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec2 ijkVecDiv2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl dvec2 ijkVecDiv2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecDivSafe2*
 //	Calculate component-wise quotient of 2D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec2 ijkVecDivSafe2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl dvec2 ijkVecDivSafe2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecMod2*
 //	Calculate component-wise remainder of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec2 ijkVecMod2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl dvec2 ijkVecMod2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecModSafe2*
 //	Calculate component-wise remainder of 2D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec2 ijkVecModSafe2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl dvec2 ijkVecModSafe2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecEqual2*
 //	Equality comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecEqual2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecEqual2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecInequal2*
 //	Inequality comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecInequal2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecInequal2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecLessEqual2*
 //	Less-than or equal comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLessEqual2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecLessEqual2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecGreaterEqual2*
 //	Greater-than or equal comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecLess2*
 //	Less-than comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLess2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecLess2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecGreater2*
 //	Greater-than comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreater2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreater2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecAnd2*
 //	Component-wise logical 'and' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecAnd2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecAnd2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecNand2*
 //	Component-wise logical 'nand' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNand2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecNand2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecOr2*
 //	Component-wise logical 'or' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecOr2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecOr2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecNor2*
 //	Component-wise logical 'nor' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNor2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecNor2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecCopy2*s
 //	Copy 2D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-dvec2 ijkVecCopy2ds(double const s_in);
+ijk_inl dvec2 ijkVecCopy2ds(double const s_in);
 
 // ijkVecNegate2*s
 //	Negate scalar to 2D vector.
 //		param s_in: input scalar
 //		return: result vector
-dvec2 ijkVecNegate2ds(double const s_in);
+ijk_inl dvec2 ijkVecNegate2ds(double const s_in);
 
 // ijkVecNot2*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec2 ijkVecNot2ds(double const s_in);
+ijk_inl bvec2 ijkVecNot2ds(double const s_in);
 
 // ijkVecAdd2*s
 //	Calculate sum of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec2 ijkVecAdd2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl dvec2 ijkVecAdd2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecSub2*s
 //	Calculate difference of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec2 ijkVecSub2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl dvec2 ijkVecSub2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecMul2*s
 //	Calculate product of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec2 ijkVecMul2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl dvec2 ijkVecMul2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecDiv2*s
 //	Calculate quotient of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec2 ijkVecDiv2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl dvec2 ijkVecDiv2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecDivSafe2*s
 //	Calculate quotient of 2D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec2 ijkVecDivSafe2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl dvec2 ijkVecDivSafe2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecMod2*s
 //	Calculate remainder of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec2 ijkVecMod2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl dvec2 ijkVecMod2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecModSafe2*s
 //	Calculate remainder of 2D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec2 ijkVecModSafe2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl dvec2 ijkVecModSafe2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecEqual2*s
 //	Equality comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecEqual2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl bvec2 ijkVecEqual2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecInequal2*s
 //	Inequality comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecInequal2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl bvec2 ijkVecInequal2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecLessEqual2*s
 //	Less-than or equal comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecLessEqual2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl bvec2 ijkVecLessEqual2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecGreaterEqual2*s
 //	Greater-than or equal comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecLess2*s
 //	Less-than comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecLess2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl bvec2 ijkVecLess2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecGreater2*s
 //	Greater-than comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecGreater2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl bvec2 ijkVecGreater2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecAnd2*s
 //	Component-wise logical 'and' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecAnd2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl bvec2 ijkVecAnd2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecNand2*s
 //	Component-wise logical 'nand' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecNand2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl bvec2 ijkVecNand2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecOr2*s
 //	Component-wise logical 'or' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecOr2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl bvec2 ijkVecOr2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecNor2*s
 //	Component-wise logical 'nor' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecNor2ds(dvec2 const v_lh, double const s_rh);
+ijk_inl bvec2 ijkVecNor2ds(dvec2 const v_lh, double const s_rh);
 
 // ijkVecAdd2s*
 //	Calculate sum of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec2 ijkVecAdd2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl dvec2 ijkVecAdd2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecSub2s*
 //	Calculate difference of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec2 ijkVecSub2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl dvec2 ijkVecSub2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecMul2s*
 //	Calculate product of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec2 ijkVecMul2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl dvec2 ijkVecMul2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecDiv2s*
 //	Calculate quotient of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec2 ijkVecDiv2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl dvec2 ijkVecDiv2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecDivSafe2s*
 //	Calculate quotient of scalar by 2D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec2 ijkVecDivSafe2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl dvec2 ijkVecDivSafe2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecMod2s*
 //	Calculate remainder of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec2 ijkVecMod2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl dvec2 ijkVecMod2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecModSafe2s*
 //	Calculate remainder of scalar by 2D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec2 ijkVecModSafe2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl dvec2 ijkVecModSafe2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecEqual2s*
 //	Equality comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecEqual2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecEqual2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecInequal2s*
 //	Inequality comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecInequal2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecInequal2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecLessEqual2s*
 //	Less-than or equal comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLessEqual2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecLessEqual2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecGreaterEqual2s*
 //	Greater-than or equal comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecLess2s*
 //	Less-than comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLess2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecLess2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecGreater2s*
 //	Greater-than comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreater2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreater2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecAnd2s*
 //	Component-wise logical 'and' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecAnd2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecAnd2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecNand2s*
 //	Component-wise logical 'nand' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNand2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecNand2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecOr2s*
 //	Component-wise logical 'or' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecOr2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecOr2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecNor2s*
 //	Component-wise logical 'nor' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNor2sd(double const s_lh, dvec2 const v_rh);
+ijk_inl bvec2 ijkVecNor2sd(double const s_lh, dvec2 const v_rh);
 
 // ijkVecDot2*
 //	Dot product of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-double ijkVecDot2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl double ijkVecDot2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecCross2*
 //	Cross product scalar of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar quantity of imaginary perpendicular axis
-double ijkVecCross2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl double ijkVecCross2d(dvec2 const v_lh, dvec2 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -2127,7 +2127,7 @@ double ijkVecCross2d(dvec2 const v_lh, dvec2 const v_rh);
 // ijkVecInit3*
 //	Initialize 3D vector to default value (zero vector).
 //		return: default vector
-dvec3 ijkVecInit3d();
+ijk_inl dvec3 ijkVecInit3d();
 
 // ijkVecInitElems3*
 //	Initialize 3D vector to specified individual elements.
@@ -2135,428 +2135,428 @@ dvec3 ijkVecInit3d();
 //		param y: second element
 //		param z: third element
 //		return: result vector
-dvec3 ijkVecInitElems3d(double const x, double const y, double const z);
+ijk_inl dvec3 ijkVecInitElems3d(double const x, double const y, double const z);
 
 // ijkVecCopy3*
 //	Copy 3D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-dvec3 ijkVecCopy3d(dvec3 const v_in);
+ijk_inl dvec3 ijkVecCopy3d(dvec3 const v_in);
 
 // ijkVecNegate3*
 //	Negate 3D vector.
 //		param v_in: input vector
 //		return: result vector
-dvec3 ijkVecNegate3d(dvec3 const v_in);
+ijk_inl dvec3 ijkVecNegate3d(dvec3 const v_in);
 
 // ijkVecNot3*
 //	Calculate component-wise logical 'not' of 3D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec3 ijkVecNot3d(dvec3 const v_in);
+ijk_inl bvec3 ijkVecNot3d(dvec3 const v_in);
 
 // ijkVecAdd3*
 //	Calculate sum of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec3 ijkVecAdd3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecAdd3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecSub3*
 //	Calculate difference of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec3 ijkVecSub3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecSub3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecMul3*
 //	Calculate component-wise product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec3 ijkVecMul3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecMul3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecDiv3*
 //	Calculate component-wise quotient of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec3 ijkVecDiv3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecDiv3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecDivSafe3*
 //	Calculate component-wise quotient of 3D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec3 ijkVecDivSafe3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecDivSafe3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecMod3*
 //	Calculate component-wise remainder of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec3 ijkVecMod3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecMod3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecModSafe3*
 //	Calculate component-wise remainder of 3D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec3 ijkVecModSafe3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecModSafe3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecEqual3*
 //	Equality comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecEqual3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecEqual3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecInequal3*
 //	Inequality comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecInequal3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecInequal3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecLessEqual3*
 //	Less-than or equal comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLessEqual3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecLessEqual3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecGreaterEqual3*
 //	Greater-than or equal comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecLess3*
 //	Less-than comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLess3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecLess3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecGreater3*
 //	Greater-than comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreater3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreater3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecAnd3*
 //	Component-wise logical 'and' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecAnd3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecAnd3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecNand3*
 //	Component-wise logical 'nand' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNand3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecNand3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecOr3*
 //	Component-wise logical 'or' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecOr3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecOr3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecNor3*
 //	Component-wise logical 'nor' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNor3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecNor3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecCopy3*z
 //	Copy 3D vector from 2D vector and one scalar.
 //		param v_xy: input 2D vector holding first two components
 //		param z: third element
 //		return: result vector
-dvec3 ijkVecCopy3dz(dvec2 const v_xy, double const z);
+ijk_inl dvec3 ijkVecCopy3dz(dvec2 const v_xy, double const z);
 
 // ijkVecCopy3*s
 //	Copy 3D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-dvec3 ijkVecCopy3ds(double const s_in);
+ijk_inl dvec3 ijkVecCopy3ds(double const s_in);
 
 // ijkVecNegate3*s
 //	Negate scalar to 3D vector.
 //		param s_in: input scalar
 //		return: result vector
-dvec3 ijkVecNegate3ds(double const s_in);
+ijk_inl dvec3 ijkVecNegate3ds(double const s_in);
 
 // ijkVecNot3*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec3 ijkVecNot3ds(double const s_in);
+ijk_inl bvec3 ijkVecNot3ds(double const s_in);
 
 // ijkVecAdd3*s
 //	Calculate sum of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec3 ijkVecAdd3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl dvec3 ijkVecAdd3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecSub3*s
 //	Calculate difference of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec3 ijkVecSub3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl dvec3 ijkVecSub3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecMul3*s
 //	Calculate product of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec3 ijkVecMul3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl dvec3 ijkVecMul3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecDiv3*s
 //	Calculate quotient of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec3 ijkVecDiv3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl dvec3 ijkVecDiv3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecDivSafe3*s
 //	Calculate quotient of 3D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec3 ijkVecDivSafe3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl dvec3 ijkVecDivSafe3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecMod3*s
 //	Calculate remainder of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec3 ijkVecMod3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl dvec3 ijkVecMod3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecModSafe3*s
 //	Calculate remainder of 3D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec3 ijkVecModSafe3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl dvec3 ijkVecModSafe3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecEqual3*s
 //	Equality comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecEqual3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl bvec3 ijkVecEqual3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecInequal3*s
 //	Inequality comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecInequal3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl bvec3 ijkVecInequal3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecLessEqual3*s
 //	Less-than or equal comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecLessEqual3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl bvec3 ijkVecLessEqual3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecGreaterEqual3*s
 //	Greater-than or equal comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecLess3*s
 //	Less-than comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecLess3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl bvec3 ijkVecLess3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecGreater3*s
 //	Greater-than comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecGreater3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl bvec3 ijkVecGreater3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecAnd3*s
 //	Component-wise logical 'and' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecAnd3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl bvec3 ijkVecAnd3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecNand3*s
 //	Component-wise logical 'nand' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecNand3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl bvec3 ijkVecNand3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecOr3*s
 //	Component-wise logical 'or' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecOr3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl bvec3 ijkVecOr3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecNor3*s
 //	Component-wise logical 'nor' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecNor3ds(dvec3 const v_lh, double const s_rh);
+ijk_inl bvec3 ijkVecNor3ds(dvec3 const v_lh, double const s_rh);
 
 // ijkVecCopy3x*
 //	Copy 3D vector from 2D vector and one scalar.
 //		param x: first element
 //		param v_yz: input 2D vector holding last two components
 //		return: result vector
-dvec3 ijkVecCopy3xd(double const x, dvec2 const v_yz);
+ijk_inl dvec3 ijkVecCopy3xd(double const x, dvec2 const v_yz);
 
 // ijkVecAdd3s*
 //	Calculate sum of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec3 ijkVecAdd3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecAdd3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecSub3s*
 //	Calculate difference of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec3 ijkVecSub3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecSub3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecMul3s*
 //	Calculate product of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec3 ijkVecMul3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecMul3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecDiv3s*
 //	Calculate quotient of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec3 ijkVecDiv3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecDiv3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecDivSafe3s*
 //	Calculate quotient of scalar by 3D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec3 ijkVecDivSafe3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecDivSafe3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecMod3s*
 //	Calculate remainder of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec3 ijkVecMod3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecMod3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecModSafe3s*
 //	Calculate remainder of scalar by 3D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec3 ijkVecModSafe3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecModSafe3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecEqual3s*
 //	Equality comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecEqual3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecEqual3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecInequal3s*
 //	Inequality comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecInequal3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecInequal3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecLessEqual3s*
 //	Less-than or equal comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLessEqual3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecLessEqual3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecGreaterEqual3s*
 //	Greater-than or equal comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecLess3s*
 //	Less-than comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLess3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecLess3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecGreater3s*
 //	Greater-than comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreater3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreater3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecAnd3s*
 //	Component-wise logical 'and' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecAnd3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecAnd3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecNand3s*
 //	Component-wise logical 'nand' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNand3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecNand3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecOr3s*
 //	Component-wise logical 'or' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecOr3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecOr3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecNor3s*
 //	Component-wise logical 'nor' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNor3sd(double const s_lh, dvec3 const v_rh);
+ijk_inl bvec3 ijkVecNor3sd(double const s_lh, dvec3 const v_rh);
 
 // ijkVecDot3*
 //	Dot product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-double ijkVecDot3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl double ijkVecDot3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecCross3*
 //	Cross product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: cross product
-dvec3 ijkVecCross3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecCross3d(dvec3 const v_lh, dvec3 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -2564,7 +2564,7 @@ dvec3 ijkVecCross3d(dvec3 const v_lh, dvec3 const v_rh);
 // ijkVecInit4*
 //	Initialize 4D vector to default value (zero vector).
 //		return: default vector
-dvec4 ijkVecInit4d();
+ijk_inl dvec4 ijkVecInit4d();
 
 // ijkVecInitElems4*
 //	Initialize 4D vector to specified individual elements.
@@ -2573,7 +2573,7 @@ dvec4 ijkVecInit4d();
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for podouble, 0 for vector)
 //		return: result vector
-dvec4 ijkVecInitElems4d(double const x, double const y, double const z, double const w);
+ijk_inl dvec4 ijkVecInitElems4d(double const x, double const y, double const z, double const w);
 
 // ijkVecCopy4x*w
 //	Copy 4D vector from scalar, 2D vector and another scalar.
@@ -2581,151 +2581,151 @@ dvec4 ijkVecInitElems4d(double const x, double const y, double const z, double c
 //		param v_yz: input 2D vector holding middle two components
 //		param w: fourth element (in space, set as 1 for podouble, 0 for vector)
 //		return: result vector
-dvec4 ijkVecCopy4xdw(double const x, dvec2 const v_yz, double const w);
+ijk_inl dvec4 ijkVecCopy4xdw(double const x, dvec2 const v_yz, double const w);
 
 // ijkVecCopy4*2
 //	Copy 4D vector from two 2D vectors.
 //		param v_xy: input 2D vector holding first two components
 //		param v_zw: input 2D vector holding last two components
 //		return: result vector
-dvec4 ijkVecCopy4d2(dvec2 const v_xy, dvec2 const v_zw);
+ijk_inl dvec4 ijkVecCopy4d2(dvec2 const v_xy, dvec2 const v_zw);
 
 // ijkVecCopy4*
 //	Copy 4D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-dvec4 ijkVecCopy4d(dvec4 const v_in);
+ijk_inl dvec4 ijkVecCopy4d(dvec4 const v_in);
 
 // ijkVecNegate4*
 //	Negate 4D vector.
 //		param v_in: input vector
 //		return: result vector
-dvec4 ijkVecNegate4d(dvec4 const v_in);
+ijk_inl dvec4 ijkVecNegate4d(dvec4 const v_in);
 
 // ijkVecNot4*
 //	Calculate component-wise logical 'not' of 4D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec4 ijkVecNot4d(dvec4 const v_in);
+ijk_inl bvec4 ijkVecNot4d(dvec4 const v_in);
 
 // ijkVecAdd4*
 //	Calculate sum of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec4 ijkVecAdd4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecAdd4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecSub4*
 //	Calculate difference of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec4 ijkVecSub4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecSub4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecMul4*
 //	Calculate component-wise product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec4 ijkVecMul4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecMul4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecDiv4*
 //	Calculate component-wise quotient of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec4 ijkVecDiv4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecDiv4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecDivSafe4*
 //	Calculate component-wise quotient of 4D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec4 ijkVecDivSafe4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecDivSafe4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecMod4*
 //	Calculate component-wise remainder of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec4 ijkVecMod4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecMod4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecModSafe4*
 //	Calculate component-wise remainder of 4D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec4 ijkVecModSafe4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecModSafe4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecEqual4*
 //	Equality comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecEqual4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecEqual4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecInequal4*
 //	Inequality comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecInequal4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecInequal4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecLessEqual4*
 //	Less-than or equal comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLessEqual4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecLessEqual4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecGreaterEqual4*
 //	Greater-than or equal comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecLess4*
 //	Less-than comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLess4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecLess4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecGreater4*
 //	Greater-than comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreater4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreater4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecAnd4*
 //	Component-wise logical 'and' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecAnd4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecAnd4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecNand4*
 //	Component-wise logical 'nand' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNand4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecNand4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecOr4*
 //	Component-wise logical 'or' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecOr4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecOr4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecNor4*
 //	Component-wise logical 'nor' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNor4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecNor4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecCopy4*zw
 //	Copy 4D vector from 2D vector and two scalars.
@@ -2733,151 +2733,151 @@ bvec4 ijkVecNor4d(dvec4 const v_lh, dvec4 const v_rh);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for podouble, 0 for vector)
 //		return: result vector
-dvec4 ijkVecCopy4dzw(dvec2 const v_xy, double const z, double const w);
+ijk_inl dvec4 ijkVecCopy4dzw(dvec2 const v_xy, double const z, double const w);
 
 // ijkVecCopy4*w
 //	Copy 4D vector from 3D vector and one scalar.
 //		param v_xyz: input 3D vector holding first three components
 //		param w: fourth element (in space, set as 1 for podouble, 0 for vector)
 //		return: result vector
-dvec4 ijkVecCopy4dw(dvec3 const v_xyz, double const w);
+ijk_inl dvec4 ijkVecCopy4dw(dvec3 const v_xyz, double const w);
 
 // ijkVecCopy4*s
 //	Copy 4D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-dvec4 ijkVecCopy4ds(double const s_in);
+ijk_inl dvec4 ijkVecCopy4ds(double const s_in);
 
 // ijkVecNegate4*s
 //	Negate scalar to 4D vector.
 //		param s_in: input scalar
 //		return: result vector
-dvec4 ijkVecNegate4ds(double const s_in);
+ijk_inl dvec4 ijkVecNegate4ds(double const s_in);
 
 // ijkVecNot4*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec4 ijkVecNot4ds(double const s_in);
+ijk_inl bvec4 ijkVecNot4ds(double const s_in);
 
 // ijkVecAdd4*s
 //	Calculate sum of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec4 ijkVecAdd4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl dvec4 ijkVecAdd4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecSub4*s
 //	Calculate difference of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec4 ijkVecSub4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl dvec4 ijkVecSub4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecMul4*s
 //	Calculate product of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec4 ijkVecMul4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl dvec4 ijkVecMul4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecDiv4*s
 //	Calculate quotient of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec4 ijkVecDiv4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl dvec4 ijkVecDiv4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecDivSafe4*s
 //	Calculate quotient of 4D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec4 ijkVecDivSafe4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl dvec4 ijkVecDivSafe4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecMod4*s
 //	Calculate remainder of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec4 ijkVecMod4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl dvec4 ijkVecMod4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecModSafe4*s
 //	Calculate remainder of 4D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-dvec4 ijkVecModSafe4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl dvec4 ijkVecModSafe4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecEqual4*s
 //	Equality comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecEqual4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl bvec4 ijkVecEqual4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecInequal4*s
 //	Inequality comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecInequal4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl bvec4 ijkVecInequal4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecLessEqual4*s
 //	Less-than or equal comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecLessEqual4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl bvec4 ijkVecLessEqual4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecGreaterEqual4*s
 //	Greater-than or equal comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecLess4*s
 //	Less-than comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecLess4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl bvec4 ijkVecLess4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecGreater4*s
 //	Greater-than comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecGreater4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl bvec4 ijkVecGreater4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecAnd4*s
 //	Component-wise logical 'and' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecAnd4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl bvec4 ijkVecAnd4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecNand4*s
 //	Component-wise logical 'nand' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecNand4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl bvec4 ijkVecNand4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecOr4*s
 //	Component-wise logical 'or' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecOr4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl bvec4 ijkVecOr4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecNor4*s
 //	Component-wise logical 'nor' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecNor4ds(dvec4 const v_lh, double const s_rh);
+ijk_inl bvec4 ijkVecNor4ds(dvec4 const v_lh, double const s_rh);
 
 // ijkVecCopy4xy*
 //	Copy 4D vector from two scalars and 2D vector.
@@ -2885,147 +2885,147 @@ bvec4 ijkVecNor4ds(dvec4 const v_lh, double const s_rh);
 //		param y: second element
 //		param v_zw: input 2D vector holding last two components
 //		return: result vector
-dvec4 ijkVecCopy4xyd(double const x, double const y, dvec2 const v_zw);
+ijk_inl dvec4 ijkVecCopy4xyd(double const x, double const y, dvec2 const v_zw);
 
 // ijkVecCopy4x*
 //	Copy 4D vector from one scalar and 3D vector.
 //		param x: first element
 //		param v_yzw: input 3D vector holding last three components
 //		return: result vector
-dvec4 ijkVecCopy4xd(double const x, dvec3 const v_yzw);
+ijk_inl dvec4 ijkVecCopy4xd(double const x, dvec3 const v_yzw);
 
 // ijkVecAdd4s*
 //	Calculate sum of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec4 ijkVecAdd4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecAdd4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecSub4s*
 //	Calculate difference of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec4 ijkVecSub4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecSub4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecMul4s*
 //	Calculate product of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec4 ijkVecMul4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecMul4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecDiv4s*
 //	Calculate quotient of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec4 ijkVecDiv4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecDiv4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecDivSafe4s*
 //	Calculate quotient of scalar by 4D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec4 ijkVecDivSafe4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecDivSafe4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecMod4s*
 //	Calculate remainder of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec4 ijkVecMod4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecMod4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecModSafe4s*
 //	Calculate remainder of scalar by 4D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-dvec4 ijkVecModSafe4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecModSafe4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecEqual4s*
 //	Equality comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecEqual4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecEqual4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecInequal4s*
 //	Inequality comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecInequal4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecInequal4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecLessEqual4s*
 //	Less-than or equal comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLessEqual4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecLessEqual4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecGreaterEqual4s*
 //	Greater-than or equal comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecLess4s*
 //	Less-than comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLess4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecLess4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecGreater4s*
 //	Greater-than comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreater4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreater4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecAnd4s*
 //	Component-wise logical 'and' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecAnd4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecAnd4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecNand4s*
 //	Component-wise logical 'nand' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNand4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecNand4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecOr4s*
 //	Component-wise logical 'or' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecOr4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecOr4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecNor4s*
 //	Component-wise logical 'nor' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNor4sd(double const s_lh, dvec4 const v_rh);
+ijk_inl bvec4 ijkVecNor4sd(double const s_lh, dvec4 const v_rh);
 
 // ijkVecDot4*
 //	Dot product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-double ijkVecDot4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl double ijkVecDot4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecCross4*
 //	Cross product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: cross product (fourth component is zero)
-dvec4 ijkVecCross4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecCross4d(dvec4 const v_lh, dvec4 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -3040,51 +3040,51 @@ extern "C" {
 //	Calculate the squared length of a vector.
 //		param v_in: input vector
 //		return: squared length
-f64 ijkVecLengthSq2dv(double2 const v_in);
+ijk_inl f64 ijkVecLengthSq2dv(double2 const v_in);
 
 // ijkVecLength2*v
 //	Calculate the length of a vector.
 //		param v_in: input vector
 //		return: length
-f64 ijkVecLength2dv(double2 const v_in);
+ijk_inl f64 ijkVecLength2dv(double2 const v_in);
 
 // ijkVecLengthSqInv2*v
 //	Calculate the inverse squared length of a vector.
 //		param v_in: input vector
 //		return: inverse squared length
-f64 ijkVecLengthSqInv2dv(double2 const v_in);
+ijk_inl f64 ijkVecLengthSqInv2dv(double2 const v_in);
 
 // ijkVecLengthSqInvSafe2*v
 //	Calculate the inverse squared length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse squared length
-f64 ijkVecLengthSqInvSafe2dv(double2 const v_in);
+ijk_inl f64 ijkVecLengthSqInvSafe2dv(double2 const v_in);
 
 // ijkVecLengthInv2*v
 //	Calculate the inverse length of a vector.
 //		param v_in: input vector
 //		return: inverse length
-f64 ijkVecLengthInv2dv(double2 const v_in);
+ijk_inl f64 ijkVecLengthInv2dv(double2 const v_in);
 
 // ijkVecLengthInvSafe2*v
 //	Calculate the inverse length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse length
-f64 ijkVecLengthInvSafe2dv(double2 const v_in);
+ijk_inl f64 ijkVecLengthInvSafe2dv(double2 const v_in);
 
 // ijkVecNormalize2*v
 //	Calculate the unit-length direction of a vector.
 //		param v_out: output vector
 //		param v_in: input vector
 //		return: v_out
-doublev ijkVecNormalize2dv(double2 v_out, double2 const v_in);
+ijk_inl doublev ijkVecNormalize2dv(double2 v_out, double2 const v_in);
 
 // ijkVecNormalizeSafe2*v
 //	Calculate the unit-length direction of a vector; division-by-zero safe.
 //		param v_out: output vector
 //		param v_in: input vector
 //		return: v_out
-doublev ijkVecNormalizeSafe2dv(double2 v_out, double2 const v_in);
+ijk_inl doublev ijkVecNormalizeSafe2dv(double2 v_out, double2 const v_in);
 
 // ijkVecNormalizeGetLength2*v
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -3093,7 +3093,7 @@ doublev ijkVecNormalizeSafe2dv(double2 v_out, double2 const v_in);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecNormalizeGetLength2dv(double2 v_out, double2 const v_in, f64* const length_out);
+ijk_inl doublev ijkVecNormalizeGetLength2dv(double2 v_out, double2 const v_in, f64* const length_out);
 
 // ijkVecNormalizeSafeGetLength2*v
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -3102,7 +3102,7 @@ doublev ijkVecNormalizeGetLength2dv(double2 v_out, double2 const v_in, f64* cons
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecNormalizeSafeGetLength2dv(double2 v_out, double2 const v_in, f64* const length_out);
+ijk_inl doublev ijkVecNormalizeSafeGetLength2dv(double2 v_out, double2 const v_in, f64* const length_out);
 
 // ijkVecNormalizeGetLengthInv2*v
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -3111,7 +3111,7 @@ doublev ijkVecNormalizeSafeGetLength2dv(double2 v_out, double2 const v_in, f64*
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecNormalizeGetLengthInv2dv(double2 v_out, double2 const v_in, f64* const lengthInv_out);
+ijk_inl doublev ijkVecNormalizeGetLengthInv2dv(double2 v_out, double2 const v_in, f64* const lengthInv_out);
 
 // ijkVecNormalizeSafeGetLengthInv2*v
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -3120,21 +3120,21 @@ doublev ijkVecNormalizeGetLengthInv2dv(double2 v_out, double2 const v_in, f64* c
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecNormalizeSafeGetLengthInv2dv(double2 v_out, double2 const v_in, f64* const lengthInv_out);
+ijk_inl doublev ijkVecNormalizeSafeGetLengthInv2dv(double2 v_out, double2 const v_in, f64* const lengthInv_out);
 
 // ijkVecCrossNormalize2*v
 //	Calculate unit-length result of cross product.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar cross product sign
-f64 ijkVecCrossNormalize2dv(double2 const v_lh, double2 const v_rh);
+ijk_inl f64 ijkVecCrossNormalize2dv(double2 const v_lh, double2 const v_rh);
 
 // ijkVecCrossNormalizeSafe2*v
 //	Calculate unit-length result of cross product; division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar cross product sign
-f64 ijkVecCrossNormalizeSafe2dv(double2 const v_lh, double2 const v_rh);
+ijk_inl f64 ijkVecCrossNormalizeSafe2dv(double2 const v_lh, double2 const v_rh);
 
 // ijkVecCrossNormalizeGetLength2*v
 //	Calculate unit-length result of cross product; also capture length.
@@ -3142,7 +3142,7 @@ f64 ijkVecCrossNormalizeSafe2dv(double2 const v_lh, double2 const v_rh);
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: scalar cross product sign
-f64 ijkVecCrossNormalizeGetLength2dv(double2 const v_lh, double2 const v_rh, f64* const length_out);
+ijk_inl f64 ijkVecCrossNormalizeGetLength2dv(double2 const v_lh, double2 const v_rh, f64* const length_out);
 
 // ijkVecCrossNormalizeSafeGetLength2*v
 //	Calculate unit-length result of cross product; also capture length; 
@@ -3151,7 +3151,7 @@ f64 ijkVecCrossNormalizeGetLength2dv(double2 const v_lh, double2 const v_rh, f64
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: scalar cross product sign
-f64 ijkVecCrossNormalizeSafeGetLength2dv(double2 const v_lh, double2 const v_rh, f64* const length_out);
+ijk_inl f64 ijkVecCrossNormalizeSafeGetLength2dv(double2 const v_lh, double2 const v_rh, f64* const length_out);
 
 // ijkVecCrossNormalizeGetLengthInv2*v
 //	Calculate unit-length result of cross product; also capture inverse length.
@@ -3159,7 +3159,7 @@ f64 ijkVecCrossNormalizeSafeGetLength2dv(double2 const v_lh, double2 const v_rh,
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: scalar cross product sign
-f64 ijkVecCrossNormalizeGetLengthInv2dv(double2 const v_lh, double2 const v_rh, f64* const lengthInv_out);
+ijk_inl f64 ijkVecCrossNormalizeGetLengthInv2dv(double2 const v_lh, double2 const v_rh, f64* const lengthInv_out);
 
 // ijkVecCrossNormalizeSafeGetLengthInv2*v
 //	Calculate unit-length result of cross product; also capture inverse length;
@@ -3168,7 +3168,7 @@ f64 ijkVecCrossNormalizeGetLengthInv2dv(double2 const v_lh, double2 const v_rh,
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: scalar cross product sign
-f64 ijkVecCrossNormalizeSafeGetLengthInv2dv(double2 const v_lh, double2 const v_rh, f64* const lengthInv_out);
+ijk_inl f64 ijkVecCrossNormalizeSafeGetLengthInv2dv(double2 const v_lh, double2 const v_rh, f64* const lengthInv_out);
 
 // ijkVecLerp2*v
 //	Vector linear interpolation.
@@ -3178,7 +3178,7 @@ f64 ijkVecCrossNormalizeSafeGetLengthInv2dv(double2 const v_lh, double2 const v_
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-doublev ijkVecLerp2dv(double2 v_out, double2 const v0, double2 const v1, f64 const u);
+ijk_inl doublev ijkVecLerp2dv(double2 v_out, double2 const v0, double2 const v1, f64 const u);
 
 // ijkVecLerpInv2*v
 //	Vector linear interpolation inverse to calculate parameters given control .
@@ -3188,7 +3188,7 @@ doublev ijkVecLerp2dv(double2 v_out, double2 const v0, double2 const v1, f64 con
 //		param v_lerp: interpolated vector used to calculate parameters; params 
 //			in range [0,1] indicate interpolation, others for extrapolation
 //		return: v_out
-doublev ijkVecLerpInv2dv(double2 v_out, double2 const v0, double2 const v1, double2 const v_lerp);
+ijk_inl doublev ijkVecLerpInv2dv(double2 v_out, double2 const v0, double2 const v1, double2 const v_lerp);
 
 // ijkVecLerpRevInit2*v
 //	Vector linear interpolation reversal to calculate initial control.
@@ -3198,7 +3198,7 @@ doublev ijkVecLerpInv2dv(double2 v_out, double2 const v0, double2 const v1, doub
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v0_out
-doublev ijkVecLerpRevInit2dv(double2 v0_out, double2 const v_lerp, double2 const v1, f64 const u);
+ijk_inl doublev ijkVecLerpRevInit2dv(double2 v0_out, double2 const v_lerp, double2 const v1, f64 const u);
 
 // ijkVecLerpRevTerm2*v
 //	Vector linear interpolation reversal to calculate terminal control.
@@ -3208,14 +3208,14 @@ doublev ijkVecLerpRevInit2dv(double2 v0_out, double2 const v_lerp, double2 const
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v1_out
-doublev ijkVecLerpRevTerm2dv(double2 v1_out, double2 const v0, double2 const v_lerp, f64 const u);
+ijk_inl doublev ijkVecLerpRevTerm2dv(double2 v1_out, double2 const v0, double2 const v_lerp, f64 const u);
 
 // ijkVecProjRatio2*v
 //	Calculate projection length ratio.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: length ratio of projected vector to base
-f64 ijkVecProjRatio2dv(double2 const v_base, double2 const v_in);
+ijk_inl f64 ijkVecProjRatio2dv(double2 const v_base, double2 const v_in);
 
 // ijkVecProj2*v
 //	Vector projection.
@@ -3223,7 +3223,7 @@ f64 ijkVecProjRatio2dv(double2 const v_base, double2 const v_in);
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: v_out
-doublev ijkVecProj2dv(double2 v_out, double2 const v_base, double2 const v_in);
+ijk_inl doublev ijkVecProj2dv(double2 v_out, double2 const v_base, double2 const v_in);
 
 // ijkVecOrtho2*v
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -3232,7 +3232,7 @@ doublev ijkVecProj2dv(double2 v_out, double2 const v_base, double2 const v_in);
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be orthogonalized
 //		return: v_out
-doublev ijkVecOrtho2dv(double2 v_out, double2 const v_base, double2 const v_in);
+ijk_inl doublev ijkVecOrtho2dv(double2 v_out, double2 const v_base, double2 const v_in);
 
 // ijkVecOrthoNorm2*v
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -3242,7 +3242,7 @@ doublev ijkVecOrtho2dv(double2 v_out, double2 const v_base, double2 const v_in);
 //		param v_in: input vector to be orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: v_out
-doublev ijkVecOrthoNorm2dv(double2 v_out, double2 const v_base, double2 const v_in, double2 v_base_norm_out);
+ijk_inl doublev ijkVecOrthoNorm2dv(double2 v_out, double2 const v_base, double2 const v_in, double2 v_base_norm_out);
 
 // ijkVecOrthoList2*v
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -3251,7 +3251,7 @@ doublev ijkVecOrthoNorm2dv(double2 v_out, double2 const v_base, double2 const v_
 //		param vl_in: input list of vectors to be orthogonalized
 //		param n: number of vectors to orthogonalize
 //		return: vl_out
-double2* ijkVecOrthoList2dv(double2 vl_out[], double2 const v_base, double2 const vl_in[], size const n);
+ijk_inl double2* ijkVecOrthoList2dv(double2 vl_out[], double2 const v_base, double2 const vl_in[], size const n);
 
 // ijkVecOrthoNormList2*v
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -3261,7 +3261,7 @@ double2* ijkVecOrthoList2dv(double2 vl_out[], double2 const v_base, double2 cons
 //		param n: number of vectors to orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: vl_out
-double2* ijkVecOrthoNormList2dv(double2 vl_out[], double2 const v_base, double2 const vl_in[], size const n, double2 v_base_norm_out);
+ijk_inl double2* ijkVecOrthoNormList2dv(double2 vl_out[], double2 const v_base, double2 const vl_in[], size const n, double2 v_base_norm_out);
 
 // ijkVecNlerp2*v
 //	Calculate normalized linear interpolation between two 2D vectors; keeps
@@ -3272,7 +3272,7 @@ double2* ijkVecOrthoNormList2dv(double2 vl_out[], double2 const v_base, double2
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-doublev ijkVecNlerp2dv(double2 v_out, double2 const v0, double2 const v1, f64 const u);
+ijk_inl doublev ijkVecNlerp2dv(double2 v_out, double2 const v0, double2 const v1, f64 const u);
 
 // ijkVecSlerp2*v
 //	Calculate spherical linear interpolation between two unit 2D vectors; keeps
@@ -3283,7 +3283,7 @@ doublev ijkVecNlerp2dv(double2 v_out, double2 const v0, double2 const v1, f64 co
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-doublev ijkVecSlerp2dv(double2 v_out, double2 const v0, double2 const v1, f64 const u);
+ijk_inl doublev ijkVecSlerp2dv(double2 v_out, double2 const v0, double2 const v1, f64 const u);
 
 // ijkVecReflectScale2*v
 //	Reflect incident vector about normal, scaling to match normal size.
@@ -3291,7 +3291,7 @@ doublev ijkVecSlerp2dv(double2 v_out, double2 const v0, double2 const v1, f64 co
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-doublev ijkVecReflectScale2dv(double2 v_out, double2 const v_in, double2 const v_nrm);
+ijk_inl doublev ijkVecReflectScale2dv(double2 v_out, double2 const v_in, double2 const v_nrm);
 
 // ijkVecUnitReflect2*v
 //	Reflect incident vector about normal; optimized for unit normal vector.
@@ -3299,7 +3299,7 @@ doublev ijkVecReflectScale2dv(double2 v_out, double2 const v_in, double2 const v
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-doublev ijkVecUnitReflect2dv(double2 v_out, double2 const v_in, double2 const v_nrm);
+ijk_inl doublev ijkVecUnitReflect2dv(double2 v_out, double2 const v_in, double2 const v_nrm);
 
 // ijkVecReflect2*v
 //	Reflect incident vector about normal.
@@ -3307,14 +3307,14 @@ doublev ijkVecUnitReflect2dv(double2 v_out, double2 const v_in, double2 const v_
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-doublev ijkVecReflect2dv(double2 v_out, double2 const v_in, double2 const v_nrm);
+ijk_inl doublev ijkVecReflect2dv(double2 v_out, double2 const v_in, double2 const v_nrm);
 
 // ijkVecDistance2*v
 //	Calculate distance between two points.
 //		param v_lh: left-hand input
 //		param v_rh: right-hand input
 //		return: distance between inputs
-f64 ijkVecDistance2dv(double2 const v_lh, double2 const v_rh);
+ijk_inl f64 ijkVecDistance2dv(double2 const v_lh, double2 const v_rh);
 
 // ijkVecResize2*v
 //	Change length of vector, retaining direction.
@@ -3322,7 +3322,7 @@ f64 ijkVecDistance2dv(double2 const v_lh, double2 const v_rh);
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: v_out
-doublev ijkVecResize2dv(double2 v_out, double2 const v_in, f64 const length);
+ijk_inl doublev ijkVecResize2dv(double2 v_out, double2 const v_in, f64 const length);
 
 // ijkVecResizeSafe2*v
 //	Change length of vector, retaining direction; division-by-zero safe.
@@ -3330,7 +3330,7 @@ doublev ijkVecResize2dv(double2 v_out, double2 const v_in, f64 const length);
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: v_out
-doublev ijkVecResizeSafe2dv(double2 v_out, double2 const v_in, f64 const length);
+ijk_inl doublev ijkVecResizeSafe2dv(double2 v_out, double2 const v_in, f64 const length);
 
 // ijkVecCrossResize2*v
 //	Change length of cross product result, retaining direction.
@@ -3338,7 +3338,7 @@ doublev ijkVecResizeSafe2dv(double2 v_out, double2 const v_in, f64 const length)
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized scalar cross product
-f64 ijkVecCrossResize2dv(double2 const v_lh, double2 const v_rh, f64 const length);
+ijk_inl f64 ijkVecCrossResize2dv(double2 const v_lh, double2 const v_rh, f64 const length);
 
 // ijkVecCrossResizeSafe2*v
 //	Change length of cross product result, retaining direction; 
@@ -3347,7 +3347,7 @@ f64 ijkVecCrossResize2dv(double2 const v_lh, double2 const v_rh, f64 const lengt
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized scalar cross product
-f64 ijkVecCrossResizeSafe2dv(double2 const v_lh, double2 const v_rh, f64 const length);
+ijk_inl f64 ijkVecCrossResizeSafe2dv(double2 const v_lh, double2 const v_rh, f64 const length);
 
 // ijkVecNearest2*v
 //	Nearest-neighbor interpolation between two reference values.
@@ -3356,7 +3356,7 @@ f64 ijkVecCrossResizeSafe2dv(double2 const v_lh, double2 const v_rh, f64 const l
 //		param v1: terminal reference value/end point, result when t>=0.5
 //		param u: interpolation parameter
 //		return: v_out
-doublev ijkVecNearest2dv(double2 v_out, double2 const v0, double2 const v1, f64 const u);
+ijk_inl doublev ijkVecNearest2dv(double2 v_out, double2 const v0, double2 const v1, f64 const u);
 
 // ijkVecBinearest2*v
 //	Nearest-neighbor interpolation of nearest-neighbor interpolated values.
@@ -3373,7 +3373,7 @@ doublev ijkVecNearest2dv(double2 v_out, double2 const v0, double2 const v1, f64
 //		param u1: interpolation parameter for second pair
 //		param u: interpolation parameter for results
 //		return: v_out
-doublev ijkVecBinearest2dv(double2 v_out, double2 const v00, double2 const v01, double2 const v10, double2 const v11, f64 const u0, f64 const u1, f64 const u);
+ijk_inl doublev ijkVecBinearest2dv(double2 v_out, double2 const v00, double2 const v01, double2 const v10, double2 const v11, f64 const u0, f64 const u1, f64 const u);
 
 // ijkVecRemap2*v
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -3388,7 +3388,7 @@ doublev ijkVecBinearest2dv(double2 v_out, double2 const v00, double2 const v01,
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: v_out
-doublev ijkVecRemap2dv(double2 v_out, double2 const v0_dst, double2 const v1_dst, double2 const v0_src, double2 const v1_src, double2 const v_src);
+ijk_inl doublev ijkVecRemap2dv(double2 v_out, double2 const v0_dst, double2 const v1_dst, double2 const v0_src, double2 const v1_src, double2 const v_src);
 
 // ijkVecBezier0O2*v
 //	Perform order-0 (point) Bezier interpolation given one reference value.
@@ -3396,7 +3396,7 @@ doublev ijkVecRemap2dv(double2 v_out, double2 const v0_dst, double2 const v1_dst
 //		param v0: reference value, always returned
 //		param u: interpolation parameter; not used for order 0 interpolation
 //		return: v_out
-doublev ijkVecBezier0O2dv(double2 v_out, double2 const v0, f64 const u);
+ijk_inl doublev ijkVecBezier0O2dv(double2 v_out, double2 const v0, f64 const u);
 
 // ijkVecBezier1O2*v
 //	Perform order-1 (linear) Bezier interpolation given two reference values.
@@ -3406,7 +3406,7 @@ doublev ijkVecBezier0O2dv(double2 v_out, double2 const v0, f64 const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-doublev ijkVecBezier1O2dv(double2 v_out, double2 const v0, double2 const v1, f64 const u);
+ijk_inl doublev ijkVecBezier1O2dv(double2 v_out, double2 const v0, double2 const v1, f64 const u);
 
 // ijkVecBezier2O2*v
 //	Perform order-2 (quadratic) Bezier interpolation given three reference 
@@ -3418,7 +3418,7 @@ doublev ijkVecBezier1O2dv(double2 v_out, double2 const v0, double2 const v1, f64
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v2
 //		return: v_out
-doublev ijkVecBezier2O2dv(double2 v_out, double2 const v0, double2 const v1, double2 const v2, f64 const u);
+ijk_inl doublev ijkVecBezier2O2dv(double2 v_out, double2 const v0, double2 const v1, double2 const v2, f64 const u);
 
 // ijkVecBezier3O2*v
 //	Perform order-3 (cubic) Bezier interpolation given four reference values.
@@ -3430,7 +3430,7 @@ doublev ijkVecBezier2O2dv(double2 v_out, double2 const v0, double2 const v1, dou
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v3
 //		return: v_out
-doublev ijkVecBezier3O2dv(double2 v_out, double2 const v0, double2 const v1, double2 const v2, double2 const v3, f64 const u);
+ijk_inl doublev ijkVecBezier3O2dv(double2 v_out, double2 const v0, double2 const v1, double2 const v2, double2 const v3, f64 const u);
 
 // ijkVecBezierNO2*v
 //	Perform order-N (recursive) Bezier interpolation given an array of 
@@ -3444,7 +3444,7 @@ doublev ijkVecBezier3O2dv(double2 v_out, double2 const v0, double2 const v1, dou
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v[0] and v[order]
 //		return: v_out
-doublev ijkVecBezierNO2dv(double2 v_out, double2 const v[], size const order, f64 const u);
+ijk_inl doublev ijkVecBezierNO2dv(double2 v_out, double2 const v[], size const order, f64 const u);
 
 // ijkVecCubicHermite2*v
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -3457,7 +3457,7 @@ doublev ijkVecBezierNO2dv(double2 v_out, double2 const v[], size const order, f6
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-doublev ijkVecCubicHermite2dv(double2 v_out, double2 const v0, double2 const dv0, double2 const v1, double2 const dv1, f64 const u);
+ijk_inl doublev ijkVecCubicHermite2dv(double2 v_out, double2 const v0, double2 const dv0, double2 const v1, double2 const dv1, f64 const u);
 
 // ijkVecCubicHermiteHandles2*v
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -3472,7 +3472,7 @@ doublev ijkVecCubicHermite2dv(double2 v_out, double2 const v0, double2 const dv0
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-doublev ijkVecCubicHermiteHandles2dv(double2 v_out, double2 const v0, double2 const cv0, double2 const v1, double2 const cv1, f64 const u);
+ijk_inl doublev ijkVecCubicHermiteHandles2dv(double2 v_out, double2 const v0, double2 const cv0, double2 const v1, double2 const cv1, f64 const u);
 
 // ijkVecCubicCatmullRom2*v
 //	Catmull-Rom spline/curve interpolation between two reference values with 
@@ -3485,7 +3485,7 @@ doublev ijkVecCubicHermiteHandles2dv(double2 v_out, double2 const v0, double2 co
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-doublev ijkVecCubicCatmullRom2dv(double2 v_out, double2 const vp, double2 const v0, double2 const v1, double2 const v2, f64 const u);
+ijk_inl doublev ijkVecCubicCatmullRom2dv(double2 v_out, double2 const vp, double2 const v0, double2 const v1, double2 const v2, f64 const u);
 
 // ijkVecBicubicCatmullRom2*v
 //	Bi-cubic interpolation using Catmull-Rom interpolation for segments.
@@ -3520,7 +3520,7 @@ doublev ijkVecCubicCatmullRom2dv(double2 v_out, double2 const vp, double2 const
 //		param u2: interpolation parameter for terminal control curve
 //		param u: interpolation parameter for result
 //		return: v_out
-doublev ijkVecBicubicCatmullRom2dv(double2 v_out, double2 const vpp, double2 const vp0, double2 const vp1, double2 const vp2, double2 const v0p, double2 const v00, double2 const v01, double2 const v02, double2 const v1p, double2 const v10, double2 const v11, double2 const v12, double2 const v2p, double2 const v20, double2 const v21, double2 const v22, f64 const up, f64 const u0, f64 const u1, f64 const u2, f64 const u);
+ijk_inl doublev ijkVecBicubicCatmullRom2dv(double2 v_out, double2 const vpp, double2 const vp0, double2 const vp1, double2 const vp2, double2 const v0p, double2 const v00, double2 const v01, double2 const v02, double2 const v1p, double2 const v10, double2 const v11, double2 const v12, double2 const v2p, double2 const v20, double2 const v21, double2 const v22, f64 const up, f64 const u0, f64 const u1, f64 const u2, f64 const u);
 
 // ijkVecReparamCubicHermite2*v
 //	Reparameterize a cubic Hermite segment into sample table.
@@ -3540,7 +3540,7 @@ doublev ijkVecBicubicCatmullRom2dv(double2 v_out, double2 const vpp, double2 con
 //		param v1: terminal reference value/end point, result when t=1
 //		param dv1: terminal tangent/rate of change
 //		return: total arc length
-f64 ijkVecReparamCubicHermite2dv(f64 uTable_out[], f64 lTable_out[], double2 vTable_out[], size const numDivisions, ibool const lNormalize, double2 const v0, double2 const dv0, double2 const v1, double2 const dv1);
+ijk_inl f64 ijkVecReparamCubicHermite2dv(f64 uTable_out[], f64 lTable_out[], double2 vTable_out[], size const numDivisions, ibool const lNormalize, double2 const v0, double2 const dv0, double2 const v1, double2 const dv1);
 
 // ijkVecReparamCubicHermiteHandles2*v
 //	Reparameterize a cubic Hermite segment with handles into sample table.
@@ -3562,7 +3562,7 @@ f64 ijkVecReparamCubicHermite2dv(f64 uTable_out[], f64 lTable_out[], double2 vTa
 //		param cv1: terminal control handle value, should be greater than v1 
 //			for a positive rate of change
 //		return: total arc length
-f64 ijkVecReparamCubicHermiteHandles2dv(f64 uTable_out[], f64 lTable_out[], double2 vTable_out[], size const numDivisions, ibool const lNormalize, double2 const v0, double2 const cv0, double2 const v1, double2 const cv1);
+ijk_inl f64 ijkVecReparamCubicHermiteHandles2dv(f64 uTable_out[], f64 lTable_out[], double2 vTable_out[], size const numDivisions, ibool const lNormalize, double2 const v0, double2 const cv0, double2 const v1, double2 const cv1);
 
 // ijkVecReparamCubicCatmullRom2*v
 //	Reparameterize a cubic Catmull-Rom segment into sample table.
@@ -3582,7 +3582,7 @@ f64 ijkVecReparamCubicHermiteHandles2dv(f64 uTable_out[], f64 lTable_out[], doub
 //		param v1: terminal reference value/end point, result when t=1
 //		param v2: terminal control value
 //		return: total arc length
-f64 ijkVecReparamCubicCatmullRom2dv(f64 uTable_out[], f64 lTable_out[], double2 vTable_out[], size const numDivisions, ibool const lNormalize, double2 const vp, double2 const v0, double2 const v1, double2 const v2);
+ijk_inl f64 ijkVecReparamCubicCatmullRom2dv(f64 uTable_out[], f64 lTable_out[], double2 vTable_out[], size const numDivisions, ibool const lNormalize, double2 const vp, double2 const v0, double2 const v1, double2 const v2);
 
 // ijkVecReparamBicubicCatmullRom2*v
 //	Reparameterize a bi-cubic Catmull-Rom segment into sample table.
@@ -3626,7 +3626,7 @@ f64 ijkVecReparamCubicCatmullRom2dv(f64 uTable_out[], f64 lTable_out[], double2
 //		param u1: interpolation parameter for terminal value curve
 //		param u2: interpolation parameter for terminal control curve
 //		return: total arc length
-f64 ijkVecReparamBicubicCatmullRom2dv(f64 uTable_out[], f64 lTable_out[], double2 vTable_out[], size const numDivisions, ibool const lNormalize, double2 const vpp, double2 const vp0, double2 const vp1, double2 const vp2, double2 const v0p, double2 const v00, double2 const v01, double2 const v02, double2 const v1p, double2 const v10, double2 const v11, double2 const v12, double2 const v2p, double2 const v20, double2 const v21, double2 const v22, f64 const up, f64 const u0, f64 const u1, f64 const u2);
+ijk_inl f64 ijkVecReparamBicubicCatmullRom2dv(f64 uTable_out[], f64 lTable_out[], double2 vTable_out[], size const numDivisions, ibool const lNormalize, double2 const vpp, double2 const vp0, double2 const vp1, double2 const vp2, double2 const v0p, double2 const v00, double2 const v01, double2 const v02, double2 const v1p, double2 const v10, double2 const v11, double2 const v12, double2 const v2p, double2 const v20, double2 const v21, double2 const v22, f64 const up, f64 const u0, f64 const u1, f64 const u2);
 
 // ijkVecSampleTableInc2*v
 //	Find index of parameter in table and approximate value by interpolating 
@@ -3645,7 +3645,7 @@ f64 ijkVecReparamBicubicCatmullRom2dv(f64 uTable_out[], f64 lTable_out[], double
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: v_out
-doublev ijkVecSampleTableInc2dv(double2 v_out, f64 const uTable[], double2 const vTable[], index i, index di, f64 const u);
+ijk_inl doublev ijkVecSampleTableInc2dv(double2 v_out, f64 const uTable[], double2 const vTable[], index i, index di, f64 const u);
 
 // ijkVecSampleTableDec2*v
 //	Find index of parameter in table and approximate value by interpolating 
@@ -3664,7 +3664,7 @@ doublev ijkVecSampleTableInc2dv(double2 v_out, f64 const uTable[], double2 const
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: v_out
-doublev ijkVecSampleTableDec2dv(double2 v_out, f64 const uTable[], double2 const vTable[], index i, index di, f64 const u);
+ijk_inl doublev ijkVecSampleTableDec2dv(double2 v_out, f64 const uTable[], double2 const vTable[], index i, index di, f64 const u);
 
 
 //-----------------------------------------------------------------------------
@@ -3673,51 +3673,51 @@ doublev ijkVecSampleTableDec2dv(double2 v_out, f64 const uTable[], double2 const
 //	Calculate the squared length of a vector.
 //		param v_in: input vector
 //		return: squared length
-f64 ijkVecLengthSq3dv(double3 const v_in);
+ijk_inl f64 ijkVecLengthSq3dv(double3 const v_in);
 
 // ijkVecLength3*v
 //	Calculate the length of a vector.
 //		param v_in: input vector
 //		return: length
-f64 ijkVecLength3dv(double3 const v_in);
+ijk_inl f64 ijkVecLength3dv(double3 const v_in);
 
 // ijkVecLengthSqInv3*v
 //	Calculate the inverse squared length of a vector.
 //		param v_in: input vector
 //		return: inverse squared length
-f64 ijkVecLengthSqInv3dv(double3 const v_in);
+ijk_inl f64 ijkVecLengthSqInv3dv(double3 const v_in);
 
 // ijkVecLengthSqInvSafe3*v
 //	Calculate the inverse squared length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse squared length
-f64 ijkVecLengthSqInvSafe3dv(double3 const v_in);
+ijk_inl f64 ijkVecLengthSqInvSafe3dv(double3 const v_in);
 
 // ijkVecLengthInv3*v
 //	Calculate the inverse length of a vector.
 //		param v_in: input vector
 //		return: inverse length
-f64 ijkVecLengthInv3dv(double3 const v_in);
+ijk_inl f64 ijkVecLengthInv3dv(double3 const v_in);
 
 // ijkVecLengthInvSafe3*v
 //	Calculate the inverse length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse length
-f64 ijkVecLengthInvSafe3dv(double3 const v_in);
+ijk_inl f64 ijkVecLengthInvSafe3dv(double3 const v_in);
 
 // ijkVecNormalize3*v
 //	Calculate the unit-length direction of a vector.
 //		param v_out: output vector
 //		param v_in: input vector
 //		return: v_out
-doublev ijkVecNormalize3dv(double3 v_out, double3 const v_in);
+ijk_inl doublev ijkVecNormalize3dv(double3 v_out, double3 const v_in);
 
 // ijkVecNormalizeSafe3*v
 //	Calculate the unit-length direction of a vector; division-by-zero safe.
 //		param v_out: output vector
 //		param v_in: input vector
 //		return: v_out
-doublev ijkVecNormalizeSafe3dv(double3 v_out, double3 const v_in);
+ijk_inl doublev ijkVecNormalizeSafe3dv(double3 v_out, double3 const v_in);
 
 // ijkVecNormalizeGetLength3*v
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -3726,7 +3726,7 @@ doublev ijkVecNormalizeSafe3dv(double3 v_out, double3 const v_in);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecNormalizeGetLength3dv(double3 v_out, double3 const v_in, f64* const length_out);
+ijk_inl doublev ijkVecNormalizeGetLength3dv(double3 v_out, double3 const v_in, f64* const length_out);
 
 // ijkVecNormalizeSafeGetLength3*v
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -3735,7 +3735,7 @@ doublev ijkVecNormalizeGetLength3dv(double3 v_out, double3 const v_in, f64* cons
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecNormalizeSafeGetLength3dv(double3 v_out, double3 const v_in, f64* const length_out);
+ijk_inl doublev ijkVecNormalizeSafeGetLength3dv(double3 v_out, double3 const v_in, f64* const length_out);
 
 // ijkVecNormalizeGetLengthInv3*v
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -3744,7 +3744,7 @@ doublev ijkVecNormalizeSafeGetLength3dv(double3 v_out, double3 const v_in, f64*
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecNormalizeGetLengthInv3dv(double3 v_out, double3 const v_in, f64* const lengthInv_out);
+ijk_inl doublev ijkVecNormalizeGetLengthInv3dv(double3 v_out, double3 const v_in, f64* const lengthInv_out);
 
 // ijkVecNormalizeSafeGetLengthInv3*v
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -3753,7 +3753,7 @@ doublev ijkVecNormalizeGetLengthInv3dv(double3 v_out, double3 const v_in, f64* c
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecNormalizeSafeGetLengthInv3dv(double3 v_out, double3 const v_in, f64* const lengthInv_out);
+ijk_inl doublev ijkVecNormalizeSafeGetLengthInv3dv(double3 v_out, double3 const v_in, f64* const lengthInv_out);
 
 // ijkVecCrossNormalize3*v
 //	Calculate unit-length result of cross product.
@@ -3761,7 +3761,7 @@ doublev ijkVecNormalizeSafeGetLengthInv3dv(double3 v_out, double3 const v_in, f6
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecCrossNormalize3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
+ijk_inl doublev ijkVecCrossNormalize3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecCrossNormalizeSafe3*v
 //	Calculate unit-length result of cross product; division-by-zero safe.
@@ -3769,7 +3769,7 @@ doublev ijkVecCrossNormalize3dv(double3 v_out, double3 const v_lh, double3 const
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecCrossNormalizeSafe3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
+ijk_inl doublev ijkVecCrossNormalizeSafe3dv(double3 v_out, double3 const v_lh, double3 const v_rh);
 
 // ijkVecCrossNormalizeGetLength3*v
 //	Calculate unit-length result of cross product; also capture length.
@@ -3778,7 +3778,7 @@ doublev ijkVecCrossNormalizeSafe3dv(double3 v_out, double3 const v_lh, double3 c
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecCrossNormalizeGetLength3dv(double3 v_out, double3 const v_lh, double3 const v_rh, f64* const length_out);
+ijk_inl doublev ijkVecCrossNormalizeGetLength3dv(double3 v_out, double3 const v_lh, double3 const v_rh, f64* const length_out);
 
 // ijkVecCrossNormalizeSafeGetLength3*v
 //	Calculate unit-length result of cross product; also capture length; 
@@ -3788,7 +3788,7 @@ doublev ijkVecCrossNormalizeGetLength3dv(double3 v_out, double3 const v_lh, doub
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecCrossNormalizeSafeGetLength3dv(double3 v_out, double3 const v_lh, double3 const v_rh, f64* const length_out);
+ijk_inl doublev ijkVecCrossNormalizeSafeGetLength3dv(double3 v_out, double3 const v_lh, double3 const v_rh, f64* const length_out);
 
 // ijkVecCrossNormalizeGetLengthInv3*v
 //	Calculate unit-length result of cross product; also capture inverse length.
@@ -3797,7 +3797,7 @@ doublev ijkVecCrossNormalizeSafeGetLength3dv(double3 v_out, double3 const v_lh,
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: v_out
-doublev ijkVecCrossNormalizeGetLengthInv3dv(double3 v_out, double3 const v_lh, double3 const v_rh, f64* const lengthInv_out);
+ijk_inl doublev ijkVecCrossNormalizeGetLengthInv3dv(double3 v_out, double3 const v_lh, double3 const v_rh, f64* const lengthInv_out);
 
 // ijkVecCrossNormalizeSafeGetLengthInv3*v
 //	Calculate unit-length result of cross product; also capture inverse length;
@@ -3807,7 +3807,7 @@ doublev ijkVecCrossNormalizeGetLengthInv3dv(double3 v_out, double3 const v_lh, d
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: v_out
-doublev ijkVecCrossNormalizeSafeGetLengthInv3dv(double3 v_out, double3 const v_lh, double3 const v_rh, f64* const lengthInv_out);
+ijk_inl doublev ijkVecCrossNormalizeSafeGetLengthInv3dv(double3 v_out, double3 const v_lh, double3 const v_rh, f64* const lengthInv_out);
 
 // ijkVecLerp3*v
 //	Vector linear interpolation.
@@ -3817,7 +3817,7 @@ doublev ijkVecCrossNormalizeSafeGetLengthInv3dv(double3 v_out, double3 const v_l
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-doublev ijkVecLerp3dv(double3 v_out, double3 const v0, double3 const v1, f64 const u);
+ijk_inl doublev ijkVecLerp3dv(double3 v_out, double3 const v0, double3 const v1, f64 const u);
 
 // ijkVecLerpInv3*v
 //	Vector linear interpolation inverse to calculate parameters given control .
@@ -3827,7 +3827,7 @@ doublev ijkVecLerp3dv(double3 v_out, double3 const v0, double3 const v1, f64 con
 //		param v_lerp: interpolated vector used to calculate parameters; params 
 //			in range [0,1] indicate interpolation, others for extrapolation
 //		return: v_out
-doublev ijkVecLerpInv3dv(double3 v_out, double3 const v0, double3 const v1, double3 const v_lerp);
+ijk_inl doublev ijkVecLerpInv3dv(double3 v_out, double3 const v0, double3 const v1, double3 const v_lerp);
 
 // ijkVecLerpRevInit3*v
 //	Vector linear interpolation reversal to calculate initial control.
@@ -3837,7 +3837,7 @@ doublev ijkVecLerpInv3dv(double3 v_out, double3 const v0, double3 const v1, doub
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v0_out
-doublev ijkVecLerpRevInit3dv(double3 v0_out, double3 const v_lerp, double3 const v1, f64 const u);
+ijk_inl doublev ijkVecLerpRevInit3dv(double3 v0_out, double3 const v_lerp, double3 const v1, f64 const u);
 
 // ijkVecLerpRevTerm3*v
 //	Vector linear interpolation reversal to calculate terminal control.
@@ -3847,14 +3847,14 @@ doublev ijkVecLerpRevInit3dv(double3 v0_out, double3 const v_lerp, double3 const
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v1_out
-doublev ijkVecLerpRevTerm3dv(double3 v1_out, double3 const v0, double3 const v_lerp, f64 const u);
+ijk_inl doublev ijkVecLerpRevTerm3dv(double3 v1_out, double3 const v0, double3 const v_lerp, f64 const u);
 
 // ijkVecProjRatio3*v
 //	Calculate projection length ratio.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: length ratio of projected vector to base
-f64 ijkVecProjRatio3dv(double3 const v_base, double3 const v_in);
+ijk_inl f64 ijkVecProjRatio3dv(double3 const v_base, double3 const v_in);
 
 // ijkVecProj3*v
 //	Vector projection.
@@ -3862,7 +3862,7 @@ f64 ijkVecProjRatio3dv(double3 const v_base, double3 const v_in);
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: v_out
-doublev ijkVecProj3dv(double3 v_out, double3 const v_base, double3 const v_in);
+ijk_inl doublev ijkVecProj3dv(double3 v_out, double3 const v_base, double3 const v_in);
 
 // ijkVecOrtho3*v
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -3871,7 +3871,7 @@ doublev ijkVecProj3dv(double3 v_out, double3 const v_base, double3 const v_in);
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be orthogonalized
 //		return: v_out
-doublev ijkVecOrtho3dv(double3 v_out, double3 const v_base, double3 const v_in);
+ijk_inl doublev ijkVecOrtho3dv(double3 v_out, double3 const v_base, double3 const v_in);
 
 // ijkVecOrthoNorm3*v
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -3881,7 +3881,7 @@ doublev ijkVecOrtho3dv(double3 v_out, double3 const v_base, double3 const v_in);
 //		param v_in: input vector to be orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: v_out
-doublev ijkVecOrthoNorm3dv(double3 v_out, double3 const v_base, double3 const v_in, double3 v_base_norm_out);
+ijk_inl doublev ijkVecOrthoNorm3dv(double3 v_out, double3 const v_base, double3 const v_in, double3 v_base_norm_out);
 
 // ijkVecOrthoList3*v
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -3890,7 +3890,7 @@ doublev ijkVecOrthoNorm3dv(double3 v_out, double3 const v_base, double3 const v_
 //		param vl_in: input list of vectors to be orthogonalized
 //		param n: number of vectors to orthogonalize
 //		return: vl_out
-double3* ijkVecOrthoList3dv(double3 vl_out[], double3 const v_base, double3 const vl_in[], size const n);
+ijk_inl double3* ijkVecOrthoList3dv(double3 vl_out[], double3 const v_base, double3 const vl_in[], size const n);
 
 // ijkVecOrthoNormList3*v
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -3900,7 +3900,7 @@ double3* ijkVecOrthoList3dv(double3 vl_out[], double3 const v_base, double3 cons
 //		param n: number of vectors to orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: vl_out
-double3* ijkVecOrthoNormList3dv(double3 vl_out[], double3 const v_base, double3 const vl_in[], size const n, double3 v_base_norm_out);
+ijk_inl double3* ijkVecOrthoNormList3dv(double3 vl_out[], double3 const v_base, double3 const vl_in[], size const n, double3 v_base_norm_out);
 
 // ijkVecNlerp3*v
 //	Calculate normalized linear interpolation between two 3D vectors; keeps
@@ -3911,7 +3911,7 @@ double3* ijkVecOrthoNormList3dv(double3 vl_out[], double3 const v_base, double3
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-doublev ijkVecNlerp3dv(double3 v_out, double3 const v0, double3 const v1, f64 const u);
+ijk_inl doublev ijkVecNlerp3dv(double3 v_out, double3 const v0, double3 const v1, f64 const u);
 
 // ijkVecSlerp3*v
 //	Calculate spherical linear interpolation between two unit 3D vectors; keeps
@@ -3922,7 +3922,7 @@ doublev ijkVecNlerp3dv(double3 v_out, double3 const v0, double3 const v1, f64 co
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-doublev ijkVecSlerp3dv(double3 v_out, double3 const v0, double3 const v1, f64 const u);
+ijk_inl doublev ijkVecSlerp3dv(double3 v_out, double3 const v0, double3 const v1, f64 const u);
 
 // ijkVecReflectScale3*v
 //	Reflect incident vector about normal, scaling to match normal size.
@@ -3930,7 +3930,7 @@ doublev ijkVecSlerp3dv(double3 v_out, double3 const v0, double3 const v1, f64 co
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-doublev ijkVecReflectScale3dv(double3 v_out, double3 const v_in, double3 const v_nrm);
+ijk_inl doublev ijkVecReflectScale3dv(double3 v_out, double3 const v_in, double3 const v_nrm);
 
 // ijkVecUnitReflect3*v
 //	Reflect incident vector about normal; optimized for unit normal vector.
@@ -3938,7 +3938,7 @@ doublev ijkVecReflectScale3dv(double3 v_out, double3 const v_in, double3 const v
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-doublev ijkVecUnitReflect3dv(double3 v_out, double3 const v_in, double3 const v_nrm);
+ijk_inl doublev ijkVecUnitReflect3dv(double3 v_out, double3 const v_in, double3 const v_nrm);
 
 // ijkVecReflect3*v
 //	Reflect incident vector about normal.
@@ -3946,14 +3946,14 @@ doublev ijkVecUnitReflect3dv(double3 v_out, double3 const v_in, double3 const v_
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-doublev ijkVecReflect3dv(double3 v_out, double3 const v_in, double3 const v_nrm);
+ijk_inl doublev ijkVecReflect3dv(double3 v_out, double3 const v_in, double3 const v_nrm);
 
 // ijkVecDistance3*v
 //	Calculate distance between two points.
 //		param v_lh: left-hand input
 //		param v_rh: right-hand input
 //		return: distance between inputs
-f64 ijkVecDistance3dv(double3 const v_lh, double3 const v_rh);
+ijk_inl f64 ijkVecDistance3dv(double3 const v_lh, double3 const v_rh);
 
 // ijkVecResize3*v
 //	Change length of vector, retaining direction.
@@ -3961,7 +3961,7 @@ f64 ijkVecDistance3dv(double3 const v_lh, double3 const v_rh);
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: v_out
-doublev ijkVecResize3dv(double3 v_out, double3 const v_in, f64 const length);
+ijk_inl doublev ijkVecResize3dv(double3 v_out, double3 const v_in, f64 const length);
 
 // ijkVecResizeSafe3*v
 //	Change length of vector, retaining direction; division-by-zero safe.
@@ -3969,7 +3969,7 @@ doublev ijkVecResize3dv(double3 v_out, double3 const v_in, f64 const length);
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: v_out
-doublev ijkVecResizeSafe3dv(double3 v_out, double3 const v_in, f64 const length);
+ijk_inl doublev ijkVecResizeSafe3dv(double3 v_out, double3 const v_in, f64 const length);
 
 // ijkVecCrossResize3*v
 //	Change length of cross product result, retaining direction.
@@ -3978,7 +3978,7 @@ doublev ijkVecResizeSafe3dv(double3 v_out, double3 const v_in, f64 const length)
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: v_out
-doublev ijkVecCrossResize3dv(double3 v_out, double3 const v_lh, double3 const v_rh, f64 const length);
+ijk_inl doublev ijkVecCrossResize3dv(double3 v_out, double3 const v_lh, double3 const v_rh, f64 const length);
 
 // ijkVecCrossResizeSafe3*v
 //	Change length of cross product result, retaining direction; 
@@ -3988,7 +3988,7 @@ doublev ijkVecCrossResize3dv(double3 v_out, double3 const v_lh, double3 const v_
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: v_out
-doublev ijkVecCrossResizeSafe3dv(double3 v_out, double3 const v_lh, double3 const v_rh, f64 const length);
+ijk_inl doublev ijkVecCrossResizeSafe3dv(double3 v_out, double3 const v_lh, double3 const v_rh, f64 const length);
 
 // ijkVecNearest3*v
 //	Nearest-neighbor interpolation between two reference values.
@@ -3997,7 +3997,7 @@ doublev ijkVecCrossResizeSafe3dv(double3 v_out, double3 const v_lh, double3 cons
 //		param v1: terminal reference value/end point, result when t>=0.5
 //		param u: interpolation parameter
 //		return: v_out
-doublev ijkVecNearest3dv(double3 v_out, double3 const v0, double3 const v1, f64 const u);
+ijk_inl doublev ijkVecNearest3dv(double3 v_out, double3 const v0, double3 const v1, f64 const u);
 
 // ijkVecBinearest3*v
 //	Nearest-neighbor interpolation of nearest-neighbor interpolated values.
@@ -4014,7 +4014,7 @@ doublev ijkVecNearest3dv(double3 v_out, double3 const v0, double3 const v1, f64
 //		param u1: interpolation parameter for second pair
 //		param u: interpolation parameter for results
 //		return: v_out
-doublev ijkVecBinearest3dv(double3 v_out, double3 const v00, double3 const v01, double3 const v10, double3 const v11, f64 const u0, f64 const u1, f64 const u);
+ijk_inl doublev ijkVecBinearest3dv(double3 v_out, double3 const v00, double3 const v01, double3 const v10, double3 const v11, f64 const u0, f64 const u1, f64 const u);
 
 // ijkVecRemap3*v
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -4029,7 +4029,7 @@ doublev ijkVecBinearest3dv(double3 v_out, double3 const v00, double3 const v01,
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: v_out
-doublev ijkVecRemap3dv(double3 v_out, double3 const v0_dst, double3 const v1_dst, double3 const v0_src, double3 const v1_src, double3 const v_src);
+ijk_inl doublev ijkVecRemap3dv(double3 v_out, double3 const v0_dst, double3 const v1_dst, double3 const v0_src, double3 const v1_src, double3 const v_src);
 
 // ijkVecBezier0O3*v
 //	Perform order-0 (point) Bezier interpolation given one reference value.
@@ -4037,7 +4037,7 @@ doublev ijkVecRemap3dv(double3 v_out, double3 const v0_dst, double3 const v1_dst
 //		param v0: reference value, always returned
 //		param u: interpolation parameter; not used for order 0 interpolation
 //		return: v_out
-doublev ijkVecBezier0O3dv(double3 v_out, double3 const v0, f64 const u);
+ijk_inl doublev ijkVecBezier0O3dv(double3 v_out, double3 const v0, f64 const u);
 
 // ijkVecBezier1O3*v
 //	Perform order-1 (linear) Bezier interpolation given two reference values.
@@ -4047,7 +4047,7 @@ doublev ijkVecBezier0O3dv(double3 v_out, double3 const v0, f64 const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-doublev ijkVecBezier1O3dv(double3 v_out, double3 const v0, double3 const v1, f64 const u);
+ijk_inl doublev ijkVecBezier1O3dv(double3 v_out, double3 const v0, double3 const v1, f64 const u);
 
 // ijkVecBezier2O3*v
 //	Perform order-2 (quadratic) Bezier interpolation given three reference 
@@ -4059,7 +4059,7 @@ doublev ijkVecBezier1O3dv(double3 v_out, double3 const v0, double3 const v1, f64
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v2
 //		return: v_out
-doublev ijkVecBezier2O3dv(double3 v_out, double3 const v0, double3 const v1, double3 const v2, f64 const u);
+ijk_inl doublev ijkVecBezier2O3dv(double3 v_out, double3 const v0, double3 const v1, double3 const v2, f64 const u);
 
 // ijkVecBezier3O3*v
 //	Perform order-3 (cubic) Bezier interpolation given four reference values.
@@ -4071,7 +4071,7 @@ doublev ijkVecBezier2O3dv(double3 v_out, double3 const v0, double3 const v1, dou
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v3
 //		return: v_out
-doublev ijkVecBezier3O3dv(double3 v_out, double3 const v0, double3 const v1, double3 const v2, double3 const v3, f64 const u);
+ijk_inl doublev ijkVecBezier3O3dv(double3 v_out, double3 const v0, double3 const v1, double3 const v2, double3 const v3, f64 const u);
 
 // ijkVecBezierNO3*v
 //	Perform order-N (recursive) Bezier interpolation given an array of 
@@ -4085,7 +4085,7 @@ doublev ijkVecBezier3O3dv(double3 v_out, double3 const v0, double3 const v1, dou
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v[0] and v[order]
 //		return: v_out
-doublev ijkVecBezierNO3dv(double3 v_out, double3 const v[], size const order, f64 const u);
+ijk_inl doublev ijkVecBezierNO3dv(double3 v_out, double3 const v[], size const order, f64 const u);
 
 // ijkVecCubicHermite3*v
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -4098,7 +4098,7 @@ doublev ijkVecBezierNO3dv(double3 v_out, double3 const v[], size const order, f6
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-doublev ijkVecCubicHermite3dv(double3 v_out, double3 const v0, double3 const dv0, double3 const v1, double3 const dv1, f64 const u);
+ijk_inl doublev ijkVecCubicHermite3dv(double3 v_out, double3 const v0, double3 const dv0, double3 const v1, double3 const dv1, f64 const u);
 
 // ijkVecCubicHermiteHandles3*v
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -4113,7 +4113,7 @@ doublev ijkVecCubicHermite3dv(double3 v_out, double3 const v0, double3 const dv0
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-doublev ijkVecCubicHermiteHandles3dv(double3 v_out, double3 const v0, double3 const cv0, double3 const v1, double3 const cv1, f64 const u);
+ijk_inl doublev ijkVecCubicHermiteHandles3dv(double3 v_out, double3 const v0, double3 const cv0, double3 const v1, double3 const cv1, f64 const u);
 
 // ijkVecCubicCatmullRom3*v
 //	Catmull-Rom spline/curve interpolation between two reference values with 
@@ -4126,7 +4126,7 @@ doublev ijkVecCubicHermiteHandles3dv(double3 v_out, double3 const v0, double3 co
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-doublev ijkVecCubicCatmullRom3dv(double3 v_out, double3 const vp, double3 const v0, double3 const v1, double3 const v2, f64 const u);
+ijk_inl doublev ijkVecCubicCatmullRom3dv(double3 v_out, double3 const vp, double3 const v0, double3 const v1, double3 const v2, f64 const u);
 
 // ijkVecBicubicCatmullRom3*v
 //	Bi-cubic interpolation using Catmull-Rom interpolation for segments.
@@ -4161,7 +4161,7 @@ doublev ijkVecCubicCatmullRom3dv(double3 v_out, double3 const vp, double3 const
 //		param u2: interpolation parameter for terminal control curve
 //		param u: interpolation parameter for result
 //		return: v_out
-doublev ijkVecBicubicCatmullRom3dv(double3 v_out, double3 const vpp, double3 const vp0, double3 const vp1, double3 const vp2, double3 const v0p, double3 const v00, double3 const v01, double3 const v02, double3 const v1p, double3 const v10, double3 const v11, double3 const v12, double3 const v2p, double3 const v20, double3 const v21, double3 const v22, f64 const up, f64 const u0, f64 const u1, f64 const u2, f64 const u);
+ijk_inl doublev ijkVecBicubicCatmullRom3dv(double3 v_out, double3 const vpp, double3 const vp0, double3 const vp1, double3 const vp2, double3 const v0p, double3 const v00, double3 const v01, double3 const v02, double3 const v1p, double3 const v10, double3 const v11, double3 const v12, double3 const v2p, double3 const v20, double3 const v21, double3 const v22, f64 const up, f64 const u0, f64 const u1, f64 const u2, f64 const u);
 
 // ijkVecReparamCubicHermite3*v
 //	Reparameterize a cubic Hermite segment into sample table.
@@ -4181,7 +4181,7 @@ doublev ijkVecBicubicCatmullRom3dv(double3 v_out, double3 const vpp, double3 con
 //		param v1: terminal reference value/end point, result when t=1
 //		param dv1: terminal tangent/rate of change
 //		return: total arc length
-f64 ijkVecReparamCubicHermite3dv(f64 uTable_out[], f64 lTable_out[], double3 vTable_out[], size const numDivisions, ibool const lNormalize, double3 const v0, double3 const dv0, double3 const v1, double3 const dv1);
+ijk_inl f64 ijkVecReparamCubicHermite3dv(f64 uTable_out[], f64 lTable_out[], double3 vTable_out[], size const numDivisions, ibool const lNormalize, double3 const v0, double3 const dv0, double3 const v1, double3 const dv1);
 
 // ijkVecReparamCubicHermiteHandles3*v
 //	Reparameterize a cubic Hermite segment with handles into sample table.
@@ -4203,7 +4203,7 @@ f64 ijkVecReparamCubicHermite3dv(f64 uTable_out[], f64 lTable_out[], double3 vTa
 //		param cv1: terminal control handle value, should be greater than v1 
 //			for a positive rate of change
 //		return: total arc length
-f64 ijkVecReparamCubicHermiteHandles3dv(f64 uTable_out[], f64 lTable_out[], double3 vTable_out[], size const numDivisions, ibool const lNormalize, double3 const v0, double3 const cv0, double3 const v1, double3 const cv1);
+ijk_inl f64 ijkVecReparamCubicHermiteHandles3dv(f64 uTable_out[], f64 lTable_out[], double3 vTable_out[], size const numDivisions, ibool const lNormalize, double3 const v0, double3 const cv0, double3 const v1, double3 const cv1);
 
 // ijkVecReparamCubicCatmullRom3*v
 //	Reparameterize a cubic Catmull-Rom segment into sample table.
@@ -4223,7 +4223,7 @@ f64 ijkVecReparamCubicHermiteHandles3dv(f64 uTable_out[], f64 lTable_out[], doub
 //		param v1: terminal reference value/end point, result when t=1
 //		param v2: terminal control value
 //		return: total arc length
-f64 ijkVecReparamCubicCatmullRom3dv(f64 uTable_out[], f64 lTable_out[], double3 vTable_out[], size const numDivisions, ibool const lNormalize, double3 const vp, double3 const v0, double3 const v1, double3 const v2);
+ijk_inl f64 ijkVecReparamCubicCatmullRom3dv(f64 uTable_out[], f64 lTable_out[], double3 vTable_out[], size const numDivisions, ibool const lNormalize, double3 const vp, double3 const v0, double3 const v1, double3 const v2);
 
 // ijkVecReparamBicubicCatmullRom3*v
 //	Reparameterize a bi-cubic Catmull-Rom segment into sample table.
@@ -4267,7 +4267,7 @@ f64 ijkVecReparamCubicCatmullRom3dv(f64 uTable_out[], f64 lTable_out[], double3
 //		param u1: interpolation parameter for terminal value curve
 //		param u2: interpolation parameter for terminal control curve
 //		return: total arc length
-f64 ijkVecReparamBicubicCatmullRom3dv(f64 uTable_out[], f64 lTable_out[], double3 vTable_out[], size const numDivisions, ibool const lNormalize, double3 const vpp, double3 const vp0, double3 const vp1, double3 const vp2, double3 const v0p, double3 const v00, double3 const v01, double3 const v02, double3 const v1p, double3 const v10, double3 const v11, double3 const v12, double3 const v2p, double3 const v20, double3 const v21, double3 const v22, f64 const up, f64 const u0, f64 const u1, f64 const u2);
+ijk_inl f64 ijkVecReparamBicubicCatmullRom3dv(f64 uTable_out[], f64 lTable_out[], double3 vTable_out[], size const numDivisions, ibool const lNormalize, double3 const vpp, double3 const vp0, double3 const vp1, double3 const vp2, double3 const v0p, double3 const v00, double3 const v01, double3 const v02, double3 const v1p, double3 const v10, double3 const v11, double3 const v12, double3 const v2p, double3 const v20, double3 const v21, double3 const v22, f64 const up, f64 const u0, f64 const u1, f64 const u2);
 
 // ijkVecSampleTableInc3*v
 //	Find index of parameter in table and approximate value by interpolating 
@@ -4286,7 +4286,7 @@ f64 ijkVecReparamBicubicCatmullRom3dv(f64 uTable_out[], f64 lTable_out[], double
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: v_out
-doublev ijkVecSampleTableInc3dv(double3 v_out, f64 const uTable[], double3 const vTable[], index i, index di, f64 const u);
+ijk_inl doublev ijkVecSampleTableInc3dv(double3 v_out, f64 const uTable[], double3 const vTable[], index i, index di, f64 const u);
 
 // ijkVecSampleTableDec3*v
 //	Find index of parameter in table and approximate value by interpolating 
@@ -4305,7 +4305,7 @@ doublev ijkVecSampleTableInc3dv(double3 v_out, f64 const uTable[], double3 const
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: v_out
-doublev ijkVecSampleTableDec3dv(double3 v_out, f64 const uTable[], double3 const vTable[], index i, index di, f64 const u);
+ijk_inl doublev ijkVecSampleTableDec3dv(double3 v_out, f64 const uTable[], double3 const vTable[], index i, index di, f64 const u);
 
 
 //-----------------------------------------------------------------------------
@@ -4314,51 +4314,51 @@ doublev ijkVecSampleTableDec3dv(double3 v_out, f64 const uTable[], double3 const
 //	Calculate the squared length of a vector.
 //		param v_in: input vector
 //		return: squared length
-f64 ijkVecLengthSq4dv(double4 const v_in);
+ijk_inl f64 ijkVecLengthSq4dv(double4 const v_in);
 
 // ijkVecLength4*v
 //	Calculate the length of a vector.
 //		param v_in: input vector
 //		return: length
-f64 ijkVecLength4dv(double4 const v_in);
+ijk_inl f64 ijkVecLength4dv(double4 const v_in);
 
 // ijkVecLengthSqInv4*v
 //	Calculate the inverse squared length of a vector.
 //		param v_in: input vector
 //		return: inverse squared length
-f64 ijkVecLengthSqInv4dv(double4 const v_in);
+ijk_inl f64 ijkVecLengthSqInv4dv(double4 const v_in);
 
 // ijkVecLengthSqInvSafe4*v
 //	Calculate the inverse squared length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse squared length
-f64 ijkVecLengthSqInvSafe4dv(double4 const v_in);
+ijk_inl f64 ijkVecLengthSqInvSafe4dv(double4 const v_in);
 
 // ijkVecLengthInv4*v
 //	Calculate the inverse length of a vector.
 //		param v_in: input vector
 //		return: inverse length
-f64 ijkVecLengthInv4dv(double4 const v_in);
+ijk_inl f64 ijkVecLengthInv4dv(double4 const v_in);
 
 // ijkVecLengthInvSafe4*v
 //	Calculate the inverse length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse length
-f64 ijkVecLengthInvSafe4dv(double4 const v_in);
+ijk_inl f64 ijkVecLengthInvSafe4dv(double4 const v_in);
 
 // ijkVecNormalize4*v
 //	Calculate the unit-length direction of a vector.
 //		param v_out: output vector
 //		param v_in: input vector
 //		return: v_out
-doublev ijkVecNormalize4dv(double4 v_out, double4 const v_in);
+ijk_inl doublev ijkVecNormalize4dv(double4 v_out, double4 const v_in);
 
 // ijkVecNormalizeSafe4*v
 //	Calculate the unit-length direction of a vector; division-by-zero safe.
 //		param v_out: output vector
 //		param v_in: input vector
 //		return: v_out
-doublev ijkVecNormalizeSafe4dv(double4 v_out, double4 const v_in);
+ijk_inl doublev ijkVecNormalizeSafe4dv(double4 v_out, double4 const v_in);
 
 // ijkVecNormalizeGetLength4*v
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -4367,7 +4367,7 @@ doublev ijkVecNormalizeSafe4dv(double4 v_out, double4 const v_in);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecNormalizeGetLength4dv(double4 v_out, double4 const v_in, f64* const length_out);
+ijk_inl doublev ijkVecNormalizeGetLength4dv(double4 v_out, double4 const v_in, f64* const length_out);
 
 // ijkVecNormalizeSafeGetLength4*v
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -4376,7 +4376,7 @@ doublev ijkVecNormalizeGetLength4dv(double4 v_out, double4 const v_in, f64* cons
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecNormalizeSafeGetLength4dv(double4 v_out, double4 const v_in, f64* const length_out);
+ijk_inl doublev ijkVecNormalizeSafeGetLength4dv(double4 v_out, double4 const v_in, f64* const length_out);
 
 // ijkVecNormalizeGetLengthInv4*v
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -4385,7 +4385,7 @@ doublev ijkVecNormalizeSafeGetLength4dv(double4 v_out, double4 const v_in, f64*
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecNormalizeGetLengthInv4dv(double4 v_out, double4 const v_in, f64* const lengthInv_out);
+ijk_inl doublev ijkVecNormalizeGetLengthInv4dv(double4 v_out, double4 const v_in, f64* const lengthInv_out);
 
 // ijkVecNormalizeSafeGetLengthInv4*v
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -4394,7 +4394,7 @@ doublev ijkVecNormalizeGetLengthInv4dv(double4 v_out, double4 const v_in, f64* c
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecNormalizeSafeGetLengthInv4dv(double4 v_out, double4 const v_in, f64* const lengthInv_out);
+ijk_inl doublev ijkVecNormalizeSafeGetLengthInv4dv(double4 v_out, double4 const v_in, f64* const lengthInv_out);
 
 // ijkVecCrossNormalize4*v
 //	Calculate unit-length result of cross product.
@@ -4402,7 +4402,7 @@ doublev ijkVecNormalizeSafeGetLengthInv4dv(double4 v_out, double4 const v_in, f6
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecCrossNormalize4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
+ijk_inl doublev ijkVecCrossNormalize4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecCrossNormalizeSafe4*v
 //	Calculate unit-length result of cross product; division-by-zero safe.
@@ -4410,7 +4410,7 @@ doublev ijkVecCrossNormalize4dv(double4 v_out, double4 const v_lh, double4 const
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-doublev ijkVecCrossNormalizeSafe4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
+ijk_inl doublev ijkVecCrossNormalizeSafe4dv(double4 v_out, double4 const v_lh, double4 const v_rh);
 
 // ijkVecCrossNormalizeGetLength4*v
 //	Calculate unit-length result of cross product; also capture length.
@@ -4419,7 +4419,7 @@ doublev ijkVecCrossNormalizeSafe4dv(double4 v_out, double4 const v_lh, double4 c
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecCrossNormalizeGetLength4dv(double4 v_out, double4 const v_lh, double4 const v_rh, f64* const length_out);
+ijk_inl doublev ijkVecCrossNormalizeGetLength4dv(double4 v_out, double4 const v_lh, double4 const v_rh, f64* const length_out);
 
 // ijkVecCrossNormalizeSafeGetLength4*v
 //	Calculate unit-length result of cross product; also capture length; 
@@ -4429,7 +4429,7 @@ doublev ijkVecCrossNormalizeGetLength4dv(double4 v_out, double4 const v_lh, doub
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: v_out
-doublev ijkVecCrossNormalizeSafeGetLength4dv(double4 v_out, double4 const v_lh, double4 const v_rh, f64* const length_out);
+ijk_inl doublev ijkVecCrossNormalizeSafeGetLength4dv(double4 v_out, double4 const v_lh, double4 const v_rh, f64* const length_out);
 
 // ijkVecCrossNormalizeGetLengthInv4*v
 //	Calculate unit-length result of cross product; also capture inverse length.
@@ -4438,7 +4438,7 @@ doublev ijkVecCrossNormalizeSafeGetLength4dv(double4 v_out, double4 const v_lh,
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: v_out
-doublev ijkVecCrossNormalizeGetLengthInv4dv(double4 v_out, double4 const v_lh, double4 const v_rh, f64* const lengthInv_out);
+ijk_inl doublev ijkVecCrossNormalizeGetLengthInv4dv(double4 v_out, double4 const v_lh, double4 const v_rh, f64* const lengthInv_out);
 
 // ijkVecCrossNormalizeSafeGetLengthInv4*v
 //	Calculate unit-length result of cross product; also capture inverse length;
@@ -4448,7 +4448,7 @@ doublev ijkVecCrossNormalizeGetLengthInv4dv(double4 v_out, double4 const v_lh, d
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: v_out
-doublev ijkVecCrossNormalizeSafeGetLengthInv4dv(double4 v_out, double4 const v_lh, double4 const v_rh, f64* const lengthInv_out);
+ijk_inl doublev ijkVecCrossNormalizeSafeGetLengthInv4dv(double4 v_out, double4 const v_lh, double4 const v_rh, f64* const lengthInv_out);
 
 // ijkVecLerp4*v
 //	Vector linear interpolation.
@@ -4458,7 +4458,7 @@ doublev ijkVecCrossNormalizeSafeGetLengthInv4dv(double4 v_out, double4 const v_l
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-doublev ijkVecLerp4dv(double4 v_out, double4 const v0, double4 const v1, f64 const u);
+ijk_inl doublev ijkVecLerp4dv(double4 v_out, double4 const v0, double4 const v1, f64 const u);
 
 // ijkVecLerpInv4*v
 //	Vector linear interpolation inverse to calculate parameters given control .
@@ -4468,7 +4468,7 @@ doublev ijkVecLerp4dv(double4 v_out, double4 const v0, double4 const v1, f64 con
 //		param v_lerp: interpolated vector used to calculate parameters; params 
 //			in range [0,1] indicate interpolation, others for extrapolation
 //		return: v_out
-doublev ijkVecLerpInv4dv(double4 v_out, double4 const v0, double4 const v1, double4 const v_lerp);
+ijk_inl doublev ijkVecLerpInv4dv(double4 v_out, double4 const v0, double4 const v1, double4 const v_lerp);
 
 // ijkVecLerpRevInit4*v
 //	Vector linear interpolation reversal to calculate initial control.
@@ -4478,7 +4478,7 @@ doublev ijkVecLerpInv4dv(double4 v_out, double4 const v0, double4 const v1, doub
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v0_out
-doublev ijkVecLerpRevInit4dv(double4 v0_out, double4 const v_lerp, double4 const v1, f64 const u);
+ijk_inl doublev ijkVecLerpRevInit4dv(double4 v0_out, double4 const v_lerp, double4 const v1, f64 const u);
 
 // ijkVecLerpRevTerm4*v
 //	Vector linear interpolation reversal to calculate terminal control.
@@ -4488,14 +4488,14 @@ doublev ijkVecLerpRevInit4dv(double4 v0_out, double4 const v_lerp, double4 const
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v1_out
-doublev ijkVecLerpRevTerm4dv(double4 v1_out, double4 const v0, double4 const v_lerp, f64 const u);
+ijk_inl doublev ijkVecLerpRevTerm4dv(double4 v1_out, double4 const v0, double4 const v_lerp, f64 const u);
 
 // ijkVecProjRatio4*v
 //	Calculate projection length ratio.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: length ratio of projected vector to base
-f64 ijkVecProjRatio4dv(double4 const v_base, double4 const v_in);
+ijk_inl f64 ijkVecProjRatio4dv(double4 const v_base, double4 const v_in);
 
 // ijkVecProj4*v
 //	Vector projection.
@@ -4503,7 +4503,7 @@ f64 ijkVecProjRatio4dv(double4 const v_base, double4 const v_in);
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: v_out
-doublev ijkVecProj4dv(double4 v_out, double4 const v_base, double4 const v_in);
+ijk_inl doublev ijkVecProj4dv(double4 v_out, double4 const v_base, double4 const v_in);
 
 // ijkVecOrtho4*v
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -4512,7 +4512,7 @@ doublev ijkVecProj4dv(double4 v_out, double4 const v_base, double4 const v_in);
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be orthogonalized
 //		return: v_out
-doublev ijkVecOrtho4dv(double4 v_out, double4 const v_base, double4 const v_in);
+ijk_inl doublev ijkVecOrtho4dv(double4 v_out, double4 const v_base, double4 const v_in);
 
 // ijkVecOrthoNorm4*v
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -4522,7 +4522,7 @@ doublev ijkVecOrtho4dv(double4 v_out, double4 const v_base, double4 const v_in);
 //		param v_in: input vector to be orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: v_out
-doublev ijkVecOrthoNorm4dv(double4 v_out, double4 const v_base, double4 const v_in, double4 v_base_norm_out);
+ijk_inl doublev ijkVecOrthoNorm4dv(double4 v_out, double4 const v_base, double4 const v_in, double4 v_base_norm_out);
 
 // ijkVecOrthoList4*v
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -4531,7 +4531,7 @@ doublev ijkVecOrthoNorm4dv(double4 v_out, double4 const v_base, double4 const v_
 //		param vl_in: input list of vectors to be orthogonalized
 //		param n: number of vectors to orthogonalize
 //		return: vl_out
-double4* ijkVecOrthoList4dv(double4 vl_out[], double4 const v_base, double4 const vl_in[], size const n);
+ijk_inl double4* ijkVecOrthoList4dv(double4 vl_out[], double4 const v_base, double4 const vl_in[], size const n);
 
 // ijkVecOrthoNormList4*v
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -4541,7 +4541,7 @@ double4* ijkVecOrthoList4dv(double4 vl_out[], double4 const v_base, double4 cons
 //		param n: number of vectors to orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: vl_out
-double4* ijkVecOrthoNormList4dv(double4 vl_out[], double4 const v_base, double4 const vl_in[], size const n, double4 v_base_norm_out);
+ijk_inl double4* ijkVecOrthoNormList4dv(double4 vl_out[], double4 const v_base, double4 const vl_in[], size const n, double4 v_base_norm_out);
 
 // ijkVecNlerp4*v
 //	Calculate normalized linear interpolation between two 4D vectors; keeps
@@ -4552,7 +4552,7 @@ double4* ijkVecOrthoNormList4dv(double4 vl_out[], double4 const v_base, double4
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-doublev ijkVecNlerp4dv(double4 v_out, double4 const v0, double4 const v1, f64 const u);
+ijk_inl doublev ijkVecNlerp4dv(double4 v_out, double4 const v0, double4 const v1, f64 const u);
 
 // ijkVecSlerp4*v
 //	Calculate spherical linear interpolation between two unit 4D vectors; keeps
@@ -4563,7 +4563,7 @@ doublev ijkVecNlerp4dv(double4 v_out, double4 const v0, double4 const v1, f64 co
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-doublev ijkVecSlerp4dv(double4 v_out, double4 const v0, double4 const v1, f64 const u);
+ijk_inl doublev ijkVecSlerp4dv(double4 v_out, double4 const v0, double4 const v1, f64 const u);
 
 // ijkVecReflectScale4*v
 //	Reflect incident vector about normal, scaling to match normal size.
@@ -4571,7 +4571,7 @@ doublev ijkVecSlerp4dv(double4 v_out, double4 const v0, double4 const v1, f64 co
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-doublev ijkVecReflectScale4dv(double4 v_out, double4 const v_in, double4 const v_nrm);
+ijk_inl doublev ijkVecReflectScale4dv(double4 v_out, double4 const v_in, double4 const v_nrm);
 
 // ijkVecUnitReflect4*v
 //	Reflect incident vector about normal; optimized for unit normal vector.
@@ -4579,7 +4579,7 @@ doublev ijkVecReflectScale4dv(double4 v_out, double4 const v_in, double4 const v
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-doublev ijkVecUnitReflect4dv(double4 v_out, double4 const v_in, double4 const v_nrm);
+ijk_inl doublev ijkVecUnitReflect4dv(double4 v_out, double4 const v_in, double4 const v_nrm);
 
 // ijkVecReflect4*v
 //	Reflect incident vector about normal.
@@ -4587,14 +4587,14 @@ doublev ijkVecUnitReflect4dv(double4 v_out, double4 const v_in, double4 const v_
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-doublev ijkVecReflect4dv(double4 v_out, double4 const v_in, double4 const v_nrm);
+ijk_inl doublev ijkVecReflect4dv(double4 v_out, double4 const v_in, double4 const v_nrm);
 
 // ijkVecDistance4*v
 //	Calculate "distance" between two 4D vectors.
 //		param v_lh: left-hand input
 //		param v_rh: right-hand input
 //		return: distance between inputs
-f64 ijkVecDistance4dv(double4 const v_lh, double4 const v_rh);
+ijk_inl f64 ijkVecDistance4dv(double4 const v_lh, double4 const v_rh);
 
 // ijkVecResize4*v
 //	Change length of vector, retaining direction.
@@ -4602,7 +4602,7 @@ f64 ijkVecDistance4dv(double4 const v_lh, double4 const v_rh);
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: v_out
-doublev ijkVecResize4dv(double4 v_out, double4 const v_in, f64 const length);
+ijk_inl doublev ijkVecResize4dv(double4 v_out, double4 const v_in, f64 const length);
 
 // ijkVecResizeSafe4*v
 //	Change length of vector, retaining direction; division-by-zero safe.
@@ -4610,7 +4610,7 @@ doublev ijkVecResize4dv(double4 v_out, double4 const v_in, f64 const length);
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: v_out
-doublev ijkVecResizeSafe4dv(double4 v_out, double4 const v_in, f64 const length);
+ijk_inl doublev ijkVecResizeSafe4dv(double4 v_out, double4 const v_in, f64 const length);
 
 // ijkVecCrossResize4*v
 //	Change length of cross product result, retaining direction.
@@ -4619,7 +4619,7 @@ doublev ijkVecResizeSafe4dv(double4 v_out, double4 const v_in, f64 const length)
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: v_out
-doublev ijkVecCrossResize4dv(double4 v_out, double4 const v_lh, double4 const v_rh, f64 const length);
+ijk_inl doublev ijkVecCrossResize4dv(double4 v_out, double4 const v_lh, double4 const v_rh, f64 const length);
 
 // ijkVecCrossResizeSafe4*v
 //	Change length of cross product result, retaining direction; 
@@ -4629,7 +4629,7 @@ doublev ijkVecCrossResize4dv(double4 v_out, double4 const v_lh, double4 const v_
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: v_out
-doublev ijkVecCrossResizeSafe4dv(double4 v_out, double4 const v_lh, double4 const v_rh, f64 const length);
+ijk_inl doublev ijkVecCrossResizeSafe4dv(double4 v_out, double4 const v_lh, double4 const v_rh, f64 const length);
 
 // ijkVecNearest4*v
 //	Nearest-neighbor interpolation between two reference values.
@@ -4638,7 +4638,7 @@ doublev ijkVecCrossResizeSafe4dv(double4 v_out, double4 const v_lh, double4 cons
 //		param v1: terminal reference value/end point, result when t>=0.5
 //		param u: interpolation parameter
 //		return: v_out
-doublev ijkVecNearest4dv(double4 v_out, double4 const v0, double4 const v1, f64 const u);
+ijk_inl doublev ijkVecNearest4dv(double4 v_out, double4 const v0, double4 const v1, f64 const u);
 
 // ijkVecBinearest4*v
 //	Nearest-neighbor interpolation of nearest-neighbor interpolated values.
@@ -4655,7 +4655,7 @@ doublev ijkVecNearest4dv(double4 v_out, double4 const v0, double4 const v1, f64
 //		param u1: interpolation parameter for second pair
 //		param u: interpolation parameter for results
 //		return: v_out
-doublev ijkVecBinearest4dv(double4 v_out, double4 const v00, double4 const v01, double4 const v10, double4 const v11, f64 const u0, f64 const u1, f64 const u);
+ijk_inl doublev ijkVecBinearest4dv(double4 v_out, double4 const v00, double4 const v01, double4 const v10, double4 const v11, f64 const u0, f64 const u1, f64 const u);
 
 // ijkVecRemap4*v
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -4670,7 +4670,7 @@ doublev ijkVecBinearest4dv(double4 v_out, double4 const v00, double4 const v01,
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: v_out
-doublev ijkVecRemap4dv(double4 v_out, double4 const v0_dst, double4 const v1_dst, double4 const v0_src, double4 const v1_src, double4 const v_src);
+ijk_inl doublev ijkVecRemap4dv(double4 v_out, double4 const v0_dst, double4 const v1_dst, double4 const v0_src, double4 const v1_src, double4 const v_src);
 
 // ijkVecBezier0O4*v
 //	Perform order-0 (point) Bezier interpolation given one reference value.
@@ -4678,7 +4678,7 @@ doublev ijkVecRemap4dv(double4 v_out, double4 const v0_dst, double4 const v1_dst
 //		param v0: reference value, always returned
 //		param u: interpolation parameter; not used for order 0 interpolation
 //		return: v_out
-doublev ijkVecBezier0O4dv(double4 v_out, double4 const v0, f64 const u);
+ijk_inl doublev ijkVecBezier0O4dv(double4 v_out, double4 const v0, f64 const u);
 
 // ijkVecBezier1O4*v
 //	Perform order-1 (linear) Bezier interpolation given two reference values.
@@ -4688,7 +4688,7 @@ doublev ijkVecBezier0O4dv(double4 v_out, double4 const v0, f64 const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-doublev ijkVecBezier1O4dv(double4 v_out, double4 const v0, double4 const v1, f64 const u);
+ijk_inl doublev ijkVecBezier1O4dv(double4 v_out, double4 const v0, double4 const v1, f64 const u);
 
 // ijkVecBezier2O4*v
 //	Perform order-2 (quadratic) Bezier interpolation given three reference 
@@ -4700,7 +4700,7 @@ doublev ijkVecBezier1O4dv(double4 v_out, double4 const v0, double4 const v1, f64
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v2
 //		return: v_out
-doublev ijkVecBezier2O4dv(double4 v_out, double4 const v0, double4 const v1, double4 const v2, f64 const u);
+ijk_inl doublev ijkVecBezier2O4dv(double4 v_out, double4 const v0, double4 const v1, double4 const v2, f64 const u);
 
 // ijkVecBezier3O4*v
 //	Perform order-3 (cubic) Bezier interpolation given four reference values.
@@ -4712,7 +4712,7 @@ doublev ijkVecBezier2O4dv(double4 v_out, double4 const v0, double4 const v1, dou
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v3
 //		return: v_out
-doublev ijkVecBezier3O4dv(double4 v_out, double4 const v0, double4 const v1, double4 const v2, double4 const v3, f64 const u);
+ijk_inl doublev ijkVecBezier3O4dv(double4 v_out, double4 const v0, double4 const v1, double4 const v2, double4 const v3, f64 const u);
 
 // ijkVecBezierNO4*v
 //	Perform order-N (recursive) Bezier interpolation given an array of 
@@ -4726,7 +4726,7 @@ doublev ijkVecBezier3O4dv(double4 v_out, double4 const v0, double4 const v1, dou
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v[0] and v[order]
 //		return: v_out
-doublev ijkVecBezierNO4dv(double4 v_out, double4 const v[], size const order, f64 const u);
+ijk_inl doublev ijkVecBezierNO4dv(double4 v_out, double4 const v[], size const order, f64 const u);
 
 // ijkVecCubicHermite4*v
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -4739,7 +4739,7 @@ doublev ijkVecBezierNO4dv(double4 v_out, double4 const v[], size const order, f6
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-doublev ijkVecCubicHermite4dv(double4 v_out, double4 const v0, double4 const dv0, double4 const v1, double4 const dv1, f64 const u);
+ijk_inl doublev ijkVecCubicHermite4dv(double4 v_out, double4 const v0, double4 const dv0, double4 const v1, double4 const dv1, f64 const u);
 
 // ijkVecCubicHermiteHandles4*v
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -4754,7 +4754,7 @@ doublev ijkVecCubicHermite4dv(double4 v_out, double4 const v0, double4 const dv0
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-doublev ijkVecCubicHermiteHandles4dv(double4 v_out, double4 const v0, double4 const cv0, double4 const v1, double4 const cv1, f64 const u);
+ijk_inl doublev ijkVecCubicHermiteHandles4dv(double4 v_out, double4 const v0, double4 const cv0, double4 const v1, double4 const cv1, f64 const u);
 
 // ijkVecCubicCatmullRom4*v
 //	Catmull-Rom spline/curve interpolation between two reference values with 
@@ -4767,7 +4767,7 @@ doublev ijkVecCubicHermiteHandles4dv(double4 v_out, double4 const v0, double4 co
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-doublev ijkVecCubicCatmullRom4dv(double4 v_out, double4 const vp, double4 const v0, double4 const v1, double4 const v2, f64 const u);
+ijk_inl doublev ijkVecCubicCatmullRom4dv(double4 v_out, double4 const vp, double4 const v0, double4 const v1, double4 const v2, f64 const u);
 
 // ijkVecBicubicCatmullRom4*v
 //	Bi-cubic interpolation using Catmull-Rom interpolation for segments.
@@ -4802,7 +4802,7 @@ doublev ijkVecCubicCatmullRom4dv(double4 v_out, double4 const vp, double4 const
 //		param u2: interpolation parameter for terminal control curve
 //		param u: interpolation parameter for result
 //		return: v_out
-doublev ijkVecBicubicCatmullRom4dv(double4 v_out, double4 const vpp, double4 const vp0, double4 const vp1, double4 const vp2, double4 const v0p, double4 const v00, double4 const v01, double4 const v02, double4 const v1p, double4 const v10, double4 const v11, double4 const v12, double4 const v2p, double4 const v20, double4 const v21, double4 const v22, f64 const up, f64 const u0, f64 const u1, f64 const u2, f64 const u);
+ijk_inl doublev ijkVecBicubicCatmullRom4dv(double4 v_out, double4 const vpp, double4 const vp0, double4 const vp1, double4 const vp2, double4 const v0p, double4 const v00, double4 const v01, double4 const v02, double4 const v1p, double4 const v10, double4 const v11, double4 const v12, double4 const v2p, double4 const v20, double4 const v21, double4 const v22, f64 const up, f64 const u0, f64 const u1, f64 const u2, f64 const u);
 
 // ijkVecReparamCubicHermite4*v
 //	Reparameterize a cubic Hermite segment into sample table.
@@ -4822,7 +4822,7 @@ doublev ijkVecBicubicCatmullRom4dv(double4 v_out, double4 const vpp, double4 con
 //		param v1: terminal reference value/end point, result when t=1
 //		param dv1: terminal tangent/rate of change
 //		return: total arc length
-f64 ijkVecReparamCubicHermite4dv(f64 uTable_out[], f64 lTable_out[], double4 vTable_out[], size const numDivisions, ibool const lNormalize, double4 const v0, double4 const dv0, double4 const v1, double4 const dv1);
+ijk_inl f64 ijkVecReparamCubicHermite4dv(f64 uTable_out[], f64 lTable_out[], double4 vTable_out[], size const numDivisions, ibool const lNormalize, double4 const v0, double4 const dv0, double4 const v1, double4 const dv1);
 
 // ijkVecReparamCubicHermiteHandles4*v
 //	Reparameterize a cubic Hermite segment with handles into sample table.
@@ -4844,7 +4844,7 @@ f64 ijkVecReparamCubicHermite4dv(f64 uTable_out[], f64 lTable_out[], double4 vTa
 //		param cv1: terminal control handle value, should be greater than v1 
 //			for a positive rate of change
 //		return: total arc length
-f64 ijkVecReparamCubicHermiteHandles4dv(f64 uTable_out[], f64 lTable_out[], double4 vTable_out[], size const numDivisions, ibool const lNormalize, double4 const v0, double4 const cv0, double4 const v1, double4 const cv1);
+ijk_inl f64 ijkVecReparamCubicHermiteHandles4dv(f64 uTable_out[], f64 lTable_out[], double4 vTable_out[], size const numDivisions, ibool const lNormalize, double4 const v0, double4 const cv0, double4 const v1, double4 const cv1);
 
 // ijkVecReparamCubicCatmullRom4*v
 //	Reparameterize a cubic Catmull-Rom segment into sample table.
@@ -4864,7 +4864,7 @@ f64 ijkVecReparamCubicHermiteHandles4dv(f64 uTable_out[], f64 lTable_out[], doub
 //		param v1: terminal reference value/end point, result when t=1
 //		param v2: terminal control value
 //		return: total arc length
-f64 ijkVecReparamCubicCatmullRom4dv(f64 uTable_out[], f64 lTable_out[], double4 vTable_out[], size const numDivisions, ibool const lNormalize, double4 const vp, double4 const v0, double4 const v1, double4 const v2);
+ijk_inl f64 ijkVecReparamCubicCatmullRom4dv(f64 uTable_out[], f64 lTable_out[], double4 vTable_out[], size const numDivisions, ibool const lNormalize, double4 const vp, double4 const v0, double4 const v1, double4 const v2);
 
 // ijkVecReparamBicubicCatmullRom4*v
 //	Reparameterize a bi-cubic Catmull-Rom segment into sample table.
@@ -4908,7 +4908,7 @@ f64 ijkVecReparamCubicCatmullRom4dv(f64 uTable_out[], f64 lTable_out[], double4
 //		param u1: interpolation parameter for terminal value curve
 //		param u2: interpolation parameter for terminal control curve
 //		return: total arc length
-f64 ijkVecReparamBicubicCatmullRom4dv(f64 uTable_out[], f64 lTable_out[], double4 vTable_out[], size const numDivisions, ibool const lNormalize, double4 const vpp, double4 const vp0, double4 const vp1, double4 const vp2, double4 const v0p, double4 const v00, double4 const v01, double4 const v02, double4 const v1p, double4 const v10, double4 const v11, double4 const v12, double4 const v2p, double4 const v20, double4 const v21, double4 const v22, f64 const up, f64 const u0, f64 const u1, f64 const u2);
+ijk_inl f64 ijkVecReparamBicubicCatmullRom4dv(f64 uTable_out[], f64 lTable_out[], double4 vTable_out[], size const numDivisions, ibool const lNormalize, double4 const vpp, double4 const vp0, double4 const vp1, double4 const vp2, double4 const v0p, double4 const v00, double4 const v01, double4 const v02, double4 const v1p, double4 const v10, double4 const v11, double4 const v12, double4 const v2p, double4 const v20, double4 const v21, double4 const v22, f64 const up, f64 const u0, f64 const u1, f64 const u2);
 
 // ijkVecSampleTableInc4*v
 //	Find index of parameter in table and approximate value by interpolating 
@@ -4927,7 +4927,7 @@ f64 ijkVecReparamBicubicCatmullRom4dv(f64 uTable_out[], f64 lTable_out[], double
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: v_out
-doublev ijkVecSampleTableInc4dv(double4 v_out, f64 const uTable[], double4 const vTable[], index i, index di, f64 const u);
+ijk_inl doublev ijkVecSampleTableInc4dv(double4 v_out, f64 const uTable[], double4 const vTable[], index i, index di, f64 const u);
 
 // ijkVecSampleTableDec4*v
 //	Find index of parameter in table and approximate value by interpolating 
@@ -4946,7 +4946,7 @@ doublev ijkVecSampleTableInc4dv(double4 v_out, f64 const uTable[], double4 const
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: v_out
-doublev ijkVecSampleTableDec4dv(double4 v_out, f64 const uTable[], double4 const vTable[], index i, index di, f64 const u);
+ijk_inl doublev ijkVecSampleTableDec4dv(double4 v_out, f64 const uTable[], double4 const vTable[], index i, index di, f64 const u);
 
 
 //-----------------------------------------------------------------------------
@@ -4962,49 +4962,49 @@ doublev ijkVecSampleTableDec4dv(double4 v_out, f64 const uTable[], double4 const
 //	Calculate the squared length of a vector.
 //		param v_in: input vector
 //		return: squared length
-double ijkVecLengthSq2d(dvec2 const v_in);
+ijk_inl double ijkVecLengthSq2d(dvec2 const v_in);
 
 // ijkVecLength2*
 //	Calculate the length of a vector.
 //		param v_in: input vector
 //		return: length
-double ijkVecLength2d(dvec2 const v_in);
+ijk_inl double ijkVecLength2d(dvec2 const v_in);
 
 // ijkVecLengthSqInv2*
 //	Calculate the inverse squared length of a vector.
 //		param v_in: input vector
 //		return: inverse squared length
-double ijkVecLengthSqInv2d(dvec2 const v_in);
+ijk_inl double ijkVecLengthSqInv2d(dvec2 const v_in);
 
 // ijkVecLengthSqInvSafe2*
 //	Calculate the inverse squared length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse squared length
-double ijkVecLengthSqInvSafe2d(dvec2 const v_in);
+ijk_inl double ijkVecLengthSqInvSafe2d(dvec2 const v_in);
 
 // ijkVecLengthInv2*
 //	Calculate the inverse length of a vector.
 //		param v_in: input vector
 //		return: inverse length
-double ijkVecLengthInv2d(dvec2 const v_in);
+ijk_inl double ijkVecLengthInv2d(dvec2 const v_in);
 
 // ijkVecLengthInvSafe2*
 //	Calculate the inverse length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse length
-double ijkVecLengthInvSafe2d(dvec2 const v_in);
+ijk_inl double ijkVecLengthInvSafe2d(dvec2 const v_in);
 
 // ijkVecNormalize2*
 //	Calculate the unit-length direction of a vector.
 //		param v_in: input vector
 //		return: unit-length direction vector
-dvec2 ijkVecNormalize2d(dvec2 const v_in);
+ijk_inl dvec2 ijkVecNormalize2d(dvec2 const v_in);
 
 // ijkVecNormalizeSafe2*
 //	Calculate the unit-length direction of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: unit-length direction vector
-dvec2 ijkVecNormalizeSafe2d(dvec2 const v_in);
+ijk_inl dvec2 ijkVecNormalizeSafe2d(dvec2 const v_in);
 
 // ijkVecNormalizeGetLength2*
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -5012,7 +5012,7 @@ dvec2 ijkVecNormalizeSafe2d(dvec2 const v_in);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-dvec2 ijkVecNormalizeGetLength2d(dvec2 const v_in, double* const length_out);
+ijk_inl dvec2 ijkVecNormalizeGetLength2d(dvec2 const v_in, double* const length_out);
 
 // ijkVecNormalizeSafeGetLength2*
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -5020,7 +5020,7 @@ dvec2 ijkVecNormalizeGetLength2d(dvec2 const v_in, double* const length_out);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-dvec2 ijkVecNormalizeSafeGetLength2d(dvec2 const v_in, double* const length_out);
+ijk_inl dvec2 ijkVecNormalizeSafeGetLength2d(dvec2 const v_in, double* const length_out);
 
 // ijkVecNormalizeGetLengthInv2*
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -5028,7 +5028,7 @@ dvec2 ijkVecNormalizeSafeGetLength2d(dvec2 const v_in, double* const length_out)
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-dvec2 ijkVecNormalizeGetLengthInv2d(dvec2 const v_in, double* const lengthInv_out);
+ijk_inl dvec2 ijkVecNormalizeGetLengthInv2d(dvec2 const v_in, double* const lengthInv_out);
 
 // ijkVecNormalizeSafeGetLengthInv2*
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -5036,21 +5036,21 @@ dvec2 ijkVecNormalizeGetLengthInv2d(dvec2 const v_in, double* const lengthInv_ou
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-dvec2 ijkVecNormalizeSafeGetLengthInv2d(dvec2 const v_in, double* const lengthInv_out);
+ijk_inl dvec2 ijkVecNormalizeSafeGetLengthInv2d(dvec2 const v_in, double* const lengthInv_out);
 
 // ijkVecCrossNormalize2*
 //	Calculate unit-length result of cross product.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar cross product sign
-double ijkVecCrossNormalize2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl double ijkVecCrossNormalize2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecCrossNormalizeSafe2*
 //	Calculate unit-length result of cross product; division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar cross product sign
-double ijkVecCrossNormalizeSafe2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl double ijkVecCrossNormalizeSafe2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecCrossNormalizeGetLength2*
 //	Calculate unit-length result of cross product; also capture length.
@@ -5058,7 +5058,7 @@ double ijkVecCrossNormalizeSafe2d(dvec2 const v_lh, dvec2 const v_rh);
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: scalar cross product sign
-double ijkVecCrossNormalizeGetLength2d(dvec2 const v_lh, dvec2 const v_rh, double* const length_out);
+ijk_inl double ijkVecCrossNormalizeGetLength2d(dvec2 const v_lh, dvec2 const v_rh, double* const length_out);
 
 // ijkVecCrossNormalizeSafeGetLength2*
 //	Calculate unit-length result of cross product; also capture length; 
@@ -5067,7 +5067,7 @@ double ijkVecCrossNormalizeGetLength2d(dvec2 const v_lh, dvec2 const v_rh, doubl
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: scalar cross product sign
-double ijkVecCrossNormalizeSafeGetLength2d(dvec2 const v_lh, dvec2 const v_rh, double* const length_out);
+ijk_inl double ijkVecCrossNormalizeSafeGetLength2d(dvec2 const v_lh, dvec2 const v_rh, double* const length_out);
 
 // ijkVecCrossNormalizeGetLengthInv2*
 //	Calculate unit-length result of cross product; also capture inverse length.
@@ -5075,7 +5075,7 @@ double ijkVecCrossNormalizeSafeGetLength2d(dvec2 const v_lh, dvec2 const v_rh, d
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: scalar cross product sign
-double ijkVecCrossNormalizeGetLengthInv2d(dvec2 const v_lh, dvec2 const v_rh, double* const lengthInv_out);
+ijk_inl double ijkVecCrossNormalizeGetLengthInv2d(dvec2 const v_lh, dvec2 const v_rh, double* const lengthInv_out);
 
 // ijkVecCrossNormalizeSafeGetLengthInv2*
 //	Calculate unit-length result of cross product; also capture inverse length;
@@ -5084,7 +5084,7 @@ double ijkVecCrossNormalizeGetLengthInv2d(dvec2 const v_lh, dvec2 const v_rh, do
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: scalar cross product sign
-double ijkVecCrossNormalizeSafeGetLengthInv2d(dvec2 const v_lh, dvec2 const v_rh, double* const lengthInv_out);
+ijk_inl double ijkVecCrossNormalizeSafeGetLengthInv2d(dvec2 const v_lh, dvec2 const v_rh, double* const lengthInv_out);
 
 // ijkVecLerp2*
 //	Vector linear interpolation.
@@ -5093,7 +5093,7 @@ double ijkVecCrossNormalizeSafeGetLengthInv2d(dvec2 const v_lh, dvec2 const v_rh
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-dvec2 ijkVecLerp2d(dvec2 const v0, dvec2 const v1, double const u);
+ijk_inl dvec2 ijkVecLerp2d(dvec2 const v0, dvec2 const v1, double const u);
 
 // ijkVecLerpInv2*
 //	Vector linear interpolation inverse to calculate parameters given control .
@@ -5102,7 +5102,7 @@ dvec2 ijkVecLerp2d(dvec2 const v0, dvec2 const v1, double const u);
 //		param v_lerp: interpolated vector used to calculate parameters; params 
 //			in range [0,1] indicate interpolation, others for extrapolation
 //		return: interpolation parameter for each component
-dvec2 ijkVecLerpInv2d(dvec2 const v0, dvec2 const v1, dvec2 const v_lerp);
+ijk_inl dvec2 ijkVecLerpInv2d(dvec2 const v0, dvec2 const v1, dvec2 const v_lerp);
 
 // ijkVecLerpRevInit2*
 //	Vector linear interpolation reversal to calculate initial control.
@@ -5111,7 +5111,7 @@ dvec2 ijkVecLerpInv2d(dvec2 const v0, dvec2 const v1, dvec2 const v_lerp);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: initial control vector, result when param is 0
-dvec2 ijkVecLerpRevInit2d(dvec2 const v_lerp, dvec2 const v1, double const u);
+ijk_inl dvec2 ijkVecLerpRevInit2d(dvec2 const v_lerp, dvec2 const v1, double const u);
 
 // ijkVecLerpRevTerm2*
 //	Vector linear interpolation reversal to calculate terminal control.
@@ -5120,28 +5120,28 @@ dvec2 ijkVecLerpRevInit2d(dvec2 const v_lerp, dvec2 const v1, double const u);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: terminal control vector, result when param is 1
-dvec2 ijkVecLerpRevTerm2d(dvec2 const v0, dvec2 const v_lerp, double const u);
+ijk_inl dvec2 ijkVecLerpRevTerm2d(dvec2 const v0, dvec2 const v_lerp, double const u);
 
 // ijkVecProjRatio2*
 //	Calculate projection length ratio.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: length ratio of projected vector to base
-double ijkVecProjRatio2d(dvec2 const v_base, dvec2 const v_in);
+ijk_inl double ijkVecProjRatio2d(dvec2 const v_base, dvec2 const v_in);
 
 // ijkVecProj2*
 //	Vector projection.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: projected input onto base
-dvec2 ijkVecProj2d(dvec2 const v_base, dvec2 const v_in);
+ijk_inl dvec2 ijkVecProj2d(dvec2 const v_base, dvec2 const v_in);
 
 // ijkVecOrtho2*
 //	Vector orthogonalization using the Gram-Schmidt process.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be orthogonalized
 //		return: output orthogonalized vector
-dvec2 ijkVecOrtho2d(dvec2 const v_base, dvec2 const v_in);
+ijk_inl dvec2 ijkVecOrtho2d(dvec2 const v_base, dvec2 const v_in);
 
 // ijkVecOrthoNorm2*
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -5149,7 +5149,7 @@ dvec2 ijkVecOrtho2d(dvec2 const v_base, dvec2 const v_in);
 //		param v_in: input vector to be orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: output orthonormalized vector
-dvec2 ijkVecOrthoNorm2d(dvec2 const v_base, dvec2 const v_in, dvec2* const v_base_norm_out);
+ijk_inl dvec2 ijkVecOrthoNorm2d(dvec2 const v_base, dvec2 const v_in, dvec2* const v_base_norm_out);
 
 // ijkVecOrthoList2*
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -5158,7 +5158,7 @@ dvec2 ijkVecOrthoNorm2d(dvec2 const v_base, dvec2 const v_in, dvec2* const v_bas
 //		param vl_in: input list of vectors to be orthogonalized
 //		param n: number of vectors to orthogonalize
 //		return: vl_out
-dvec2* ijkVecOrthoList2d(dvec2 vl_out[], dvec2 const v_base, dvec2 const vl_in[], size const n);
+ijk_inl dvec2* ijkVecOrthoList2d(dvec2 vl_out[], dvec2 const v_base, dvec2 const vl_in[], size const n);
 
 // ijkVecOrthoNormList2*
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -5168,7 +5168,7 @@ dvec2* ijkVecOrthoList2d(dvec2 vl_out[], dvec2 const v_base, dvec2 const vl_in[]
 //		param n: number of vectors to orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: vl_out
-dvec2* ijkVecOrthoNormList2d(dvec2 vl_out[], dvec2 const v_base, dvec2 const vl_in[], size const n, dvec2* const v_base_norm_out);
+ijk_inl dvec2* ijkVecOrthoNormList2d(dvec2 vl_out[], dvec2 const v_base, dvec2 const vl_in[], size const n, dvec2* const v_base_norm_out);
 
 // ijkVecNlerp2*
 //	Calculate normalized linear interpolation between two 2D vectors; keeps
@@ -5178,7 +5178,7 @@ dvec2* ijkVecOrthoNormList2d(dvec2 vl_out[], dvec2 const v_base, dvec2 const vl_
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-dvec2 ijkVecNlerp2d(dvec2 const v0, dvec2 const v1, double const u);
+ijk_inl dvec2 ijkVecNlerp2d(dvec2 const v0, dvec2 const v1, double const u);
 
 // ijkVecSlerp2*
 //	Calculate spherical linear interpolation between two unit 2D vectors; keeps
@@ -5188,49 +5188,49 @@ dvec2 ijkVecNlerp2d(dvec2 const v0, dvec2 const v1, double const u);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-dvec2 ijkVecSlerp2d(dvec2 const v0, dvec2 const v1, double const u);
+ijk_inl dvec2 ijkVecSlerp2d(dvec2 const v0, dvec2 const v1, double const u);
 
 // ijkVecReflectScale2*
 //	Reflect incident vector about normal, scaling to match normal size.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-dvec2 ijkVecReflectScale2d(dvec2 const v_in, dvec2 const v_nrm);
+ijk_inl dvec2 ijkVecReflectScale2d(dvec2 const v_in, dvec2 const v_nrm);
 
 // ijkVecUnitReflect2*
 //	Reflect incident vector about normal; optimized for unit normal vector.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-dvec2 ijkVecUnitReflect2d(dvec2 const v_in, dvec2 const v_nrm);
+ijk_inl dvec2 ijkVecUnitReflect2d(dvec2 const v_in, dvec2 const v_nrm);
 
 // ijkVecReflect2*
 //	Reflect incident vector about normal.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-dvec2 ijkVecReflect2d(dvec2 const v_in, dvec2 const v_nrm);
+ijk_inl dvec2 ijkVecReflect2d(dvec2 const v_in, dvec2 const v_nrm);
 
 // ijkVecDistance2*
 //	Calculate distance between two points.
 //		param v_lh: left-hand input
 //		param v_rh: right-hand input
 //		return: distance between inputs
-double ijkVecDistance2d(dvec2 const v_lh, dvec2 const v_rh);
+ijk_inl double ijkVecDistance2d(dvec2 const v_lh, dvec2 const v_rh);
 
 // ijkVecResize2*
 //	Change length of vector, retaining direction.
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: resized vector
-dvec2 ijkVecResize2d(dvec2 const v_in, double const length);
+ijk_inl dvec2 ijkVecResize2d(dvec2 const v_in, double const length);
 
 // ijkVecResizeSafe2*
 //	Change length of vector, retaining direction; division-by-zero safe.
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: resized vector
-dvec2 ijkVecResizeSafe2d(dvec2 const v_in, double const length);
+ijk_inl dvec2 ijkVecResizeSafe2d(dvec2 const v_in, double const length);
 
 // ijkVecCrossResize2*
 //	Change length of cross product result, retaining direction.
@@ -5238,7 +5238,7 @@ dvec2 ijkVecResizeSafe2d(dvec2 const v_in, double const length);
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized scalar cross product
-double ijkVecCrossResize2d(dvec2 const v_lh, dvec2 const v_rh, double const length);
+ijk_inl double ijkVecCrossResize2d(dvec2 const v_lh, dvec2 const v_rh, double const length);
 
 // ijkVecCrossResizeSafe2*
 //	Change length of cross product result, retaining direction; 
@@ -5247,7 +5247,7 @@ double ijkVecCrossResize2d(dvec2 const v_lh, dvec2 const v_rh, double const leng
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized scalar cross product
-double ijkVecCrossResizeSafe2d(dvec2 const v_lh, dvec2 const v_rh, double const length);
+ijk_inl double ijkVecCrossResizeSafe2d(dvec2 const v_lh, dvec2 const v_rh, double const length);
 
 // ijkVecNearest2*
 //	Nearest-neighbor interpolation between two reference values.
@@ -5255,7 +5255,7 @@ double ijkVecCrossResizeSafe2d(dvec2 const v_lh, dvec2 const v_rh, double const
 //		param v1: terminal reference value/end point, result when t>=0.5
 //		param u: interpolation parameter
 //		return: nearest-neighbor interpolated vector, exactly v0 or v1
-dvec2 ijkVecNearest2d(dvec2 const v0, dvec2 const v1, double const u);
+ijk_inl dvec2 ijkVecNearest2d(dvec2 const v0, dvec2 const v1, double const u);
 
 // ijkVecBinearest2*
 //	Nearest-neighbor interpolation of nearest-neighbor interpolated values.
@@ -5271,7 +5271,7 @@ dvec2 ijkVecNearest2d(dvec2 const v0, dvec2 const v1, double const u);
 //		param u1: interpolation parameter for second pair
 //		param u: interpolation parameter for results
 //		return: bi-nearest-neighbor interpolated vector
-dvec2 ijkVecBinearest2d(dvec2 const v00, dvec2 const v01, dvec2 const v10, dvec2 const v11, double const u0, double const u1, double const u);
+ijk_inl dvec2 ijkVecBinearest2d(dvec2 const v00, dvec2 const v01, dvec2 const v10, dvec2 const v11, double const u0, double const u1, double const u);
 
 // ijkVecRemap2*
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -5285,14 +5285,14 @@ dvec2 ijkVecBinearest2d(dvec2 const v00, dvec2 const v01, dvec2 const v10, dvec2
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: vector in original range remapped to target range
-dvec2 ijkVecRemap2d(dvec2 const v0_dst, dvec2 const v1_dst, dvec2 const v0_src, dvec2 const v1_src, dvec2 const v_src);
+ijk_inl dvec2 ijkVecRemap2d(dvec2 const v0_dst, dvec2 const v1_dst, dvec2 const v0_src, dvec2 const v1_src, dvec2 const v_src);
 
 // ijkVecBezier0O2*
 //	Perform order-0 (point) Bezier interpolation given one reference value.
 //		param v0: reference value, always returned
 //		param u: interpolation parameter; not used for order 0 interpolation
 //		return: v0
-dvec2 ijkVecBezier0O2d(dvec2 const v0, double const u);
+ijk_inl dvec2 ijkVecBezier0O2d(dvec2 const v0, double const u);
 
 // ijkVecBezier1O2*
 //	Perform order-1 (linear) Bezier interpolation given two reference values.
@@ -5301,7 +5301,7 @@ dvec2 ijkVecBezier0O2d(dvec2 const v0, double const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: linear interpolation between v0 and v1
-dvec2 ijkVecBezier1O2d(dvec2 const v0, dvec2 const v1, double const u);
+ijk_inl dvec2 ijkVecBezier1O2d(dvec2 const v0, dvec2 const v1, double const u);
 
 // ijkVecBezier2O2*
 //	Perform order-2 (quadratic) Bezier interpolation given three reference 
@@ -5312,7 +5312,7 @@ dvec2 ijkVecBezier1O2d(dvec2 const v0, dvec2 const v1, double const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v2
 //		return: quadratic Bezier interpolation between v0 and v2
-dvec2 ijkVecBezier2O2d(dvec2 const v0, dvec2 const v1, dvec2 const v2, double const u);
+ijk_inl dvec2 ijkVecBezier2O2d(dvec2 const v0, dvec2 const v1, dvec2 const v2, double const u);
 
 // ijkVecBezier3O2*
 //	Perform order-3 (cubic) Bezier interpolation given four reference values.
@@ -5323,7 +5323,7 @@ dvec2 ijkVecBezier2O2d(dvec2 const v0, dvec2 const v1, dvec2 const v2, double co
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v3
 //		return: cubic Bezier interpolation between v0 and v3
-dvec2 ijkVecBezier3O2d(dvec2 const v0, dvec2 const v1, dvec2 const v2, dvec2 const v3, double const u);
+ijk_inl dvec2 ijkVecBezier3O2d(dvec2 const v0, dvec2 const v1, dvec2 const v2, dvec2 const v3, double const u);
 
 // ijkVecBezierNO2*
 //	Perform order-N (recursive) Bezier interpolation given an array of 
@@ -5336,7 +5336,7 @@ dvec2 ijkVecBezier3O2d(dvec2 const v0, dvec2 const v1, dvec2 const v2, dvec2 con
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v[0] and v[order]
 //		return: recursive Bezier interpolation between v[0] and v[order]
-dvec2 ijkVecBezierNO2d(dvec2 const v[], size const order, double const u);
+ijk_inl dvec2 ijkVecBezierNO2d(dvec2 const v[], size const order, double const u);
 
 // ijkVecCubicHermite2*
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -5348,7 +5348,7 @@ dvec2 ijkVecBezierNO2d(dvec2 const v[], size const order, double const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-dvec2 ijkVecCubicHermite2d(dvec2 const v0, dvec2 const dv0, dvec2 const v1, dvec2 const dv1, double const u);
+ijk_inl dvec2 ijkVecCubicHermite2d(dvec2 const v0, dvec2 const dv0, dvec2 const v1, dvec2 const dv1, double const u);
 
 // ijkVecCubicHermiteHandles2*
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -5362,7 +5362,7 @@ dvec2 ijkVecCubicHermite2d(dvec2 const v0, dvec2 const dv0, dvec2 const v1, dvec
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-dvec2 ijkVecCubicHermiteHandles2d(dvec2 const v0, dvec2 const cv0, dvec2 const v1, dvec2 const cv1, double const u);
+ijk_inl dvec2 ijkVecCubicHermiteHandles2d(dvec2 const v0, dvec2 const cv0, dvec2 const v1, dvec2 const cv1, double const u);
 
 // ijkVecCubicCatmullRom2*
 //	Catmull-Rom spline/curve interpolation between two reference values with 
@@ -5374,7 +5374,7 @@ dvec2 ijkVecCubicHermiteHandles2d(dvec2 const v0, dvec2 const cv0, dvec2 const v
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-dvec2 ijkVecCubicCatmullRom2d(dvec2 const vp, dvec2 const v0, dvec2 const v1, dvec2 const v2, double const u);
+ijk_inl dvec2 ijkVecCubicCatmullRom2d(dvec2 const vp, dvec2 const v0, dvec2 const v1, dvec2 const v2, double const u);
 
 // ijkVecBicubicCatmullRom2*
 //	Bi-cubic interpolation using Catmull-Rom interpolation for segments.
@@ -5408,7 +5408,7 @@ dvec2 ijkVecCubicCatmullRom2d(dvec2 const vp, dvec2 const v0, dvec2 const v1, dv
 //		param u2: interpolation parameter for terminal control curve
 //		param u: interpolation parameter for result
 //		return: interpolated vector
-dvec2 ijkVecBicubicCatmullRom2d(dvec2 const vpp, dvec2 const vp0, dvec2 const vp1, dvec2 const vp2, dvec2 const v0p, dvec2 const v00, dvec2 const v01, dvec2 const v02, dvec2 const v1p, dvec2 const v10, dvec2 const v11, dvec2 const v12, dvec2 const v2p, dvec2 const v20, dvec2 const v21, dvec2 const v22, double const up, double const u0, double const u1, double const u2, double const u);
+ijk_inl dvec2 ijkVecBicubicCatmullRom2d(dvec2 const vpp, dvec2 const vp0, dvec2 const vp1, dvec2 const vp2, dvec2 const v0p, dvec2 const v00, dvec2 const v01, dvec2 const v02, dvec2 const v1p, dvec2 const v10, dvec2 const v11, dvec2 const v12, dvec2 const v2p, dvec2 const v20, dvec2 const v21, dvec2 const v22, double const up, double const u0, double const u1, double const u2, double const u);
 
 // ijkVecReparamCubicHermite2*
 //	Reparameterize a cubic Hermite segment into sample table.
@@ -5428,7 +5428,7 @@ dvec2 ijkVecBicubicCatmullRom2d(dvec2 const vpp, dvec2 const vp0, dvec2 const vp
 //		param v1: terminal reference value/end point, result when t=1
 //		param dv1: terminal tangent/rate of change
 //		return: total arc length
-double ijkVecReparamCubicHermite2d(double uTable_out[], double lTable_out[], dvec2 vTable_out[], size const numDivisions, ibool const lNormalize, dvec2 const v0, dvec2 const dv0, dvec2 const v1, dvec2 const dv1);
+ijk_inl double ijkVecReparamCubicHermite2d(double uTable_out[], double lTable_out[], dvec2 vTable_out[], size const numDivisions, ibool const lNormalize, dvec2 const v0, dvec2 const dv0, dvec2 const v1, dvec2 const dv1);
 
 // ijkVecReparamCubicHermiteHandles2*
 //	Reparameterize a cubic Hermite segment with handles into sample table.
@@ -5450,7 +5450,7 @@ double ijkVecReparamCubicHermite2d(double uTable_out[], double lTable_out[], dve
 //		param cv1: terminal control handle value, should be greater than v1 
 //			for a positive rate of change
 //		return: total arc length
-double ijkVecReparamCubicHermiteHandles2d(double uTable_out[], double lTable_out[], dvec2 vTable_out[], size const numDivisions, ibool const lNormalize, dvec2 const v0, dvec2 const cv0, dvec2 const v1, dvec2 const cv1);
+ijk_inl double ijkVecReparamCubicHermiteHandles2d(double uTable_out[], double lTable_out[], dvec2 vTable_out[], size const numDivisions, ibool const lNormalize, dvec2 const v0, dvec2 const cv0, dvec2 const v1, dvec2 const cv1);
 
 // ijkVecReparamCubicCatmullRom2*
 //	Reparameterize a cubic Catmull-Rom segment into sample table.
@@ -5470,7 +5470,7 @@ double ijkVecReparamCubicHermiteHandles2d(double uTable_out[], double lTable_out
 //		param v1: terminal reference value/end point, result when t=1
 //		param v2: terminal control value
 //		return: total arc length
-double ijkVecReparamCubicCatmullRom2d(double uTable_out[], double lTable_out[], dvec2 vTable_out[], size const numDivisions, ibool const lNormalize, dvec2 const vp, dvec2 const v0, dvec2 const v1, dvec2 const v2);
+ijk_inl double ijkVecReparamCubicCatmullRom2d(double uTable_out[], double lTable_out[], dvec2 vTable_out[], size const numDivisions, ibool const lNormalize, dvec2 const vp, dvec2 const v0, dvec2 const v1, dvec2 const v2);
 
 // ijkVecReparamBicubicCatmullRom2*
 //	Reparameterize a bi-cubic Catmull-Rom segment into sample table.
@@ -5514,7 +5514,7 @@ double ijkVecReparamCubicCatmullRom2d(double uTable_out[], double lTable_out[],
 //		param u1: interpolation parameter for terminal value curve
 //		param u2: interpolation parameter for terminal control curve
 //		return: total arc length
-double ijkVecReparamBicubicCatmullRom2d(double uTable_out[], double lTable_out[], dvec2 vTable_out[], size const numDivisions, ibool const lNormalize, dvec2 const vpp, dvec2 const vp0, dvec2 const vp1, dvec2 const vp2, dvec2 const v0p, dvec2 const v00, dvec2 const v01, dvec2 const v02, dvec2 const v1p, dvec2 const v10, dvec2 const v11, dvec2 const v12, dvec2 const v2p, dvec2 const v20, dvec2 const v21, dvec2 const v22, double const up, double const u0, double const u1, double const u2);
+ijk_inl double ijkVecReparamBicubicCatmullRom2d(double uTable_out[], double lTable_out[], dvec2 vTable_out[], size const numDivisions, ibool const lNormalize, dvec2 const vpp, dvec2 const vp0, dvec2 const vp1, dvec2 const vp2, dvec2 const v0p, dvec2 const v00, dvec2 const v01, dvec2 const v02, dvec2 const v1p, dvec2 const v10, dvec2 const v11, dvec2 const v12, dvec2 const v2p, dvec2 const v20, dvec2 const v21, dvec2 const v22, double const up, double const u0, double const u1, double const u2);
 
 // ijkVecSampleTableInc2*
 //	Find index of parameter in table and approximate value by interpolating 
@@ -5531,7 +5531,7 @@ double ijkVecReparamBicubicCatmullRom2d(double uTable_out[], double lTable_out[]
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: interpolated vector in table that approximates input parameter
-dvec2 ijkVecSampleTableInc2d(double const uTable[], dvec2 const vTable[], index i, index di, double const u);
+ijk_inl dvec2 ijkVecSampleTableInc2d(double const uTable[], dvec2 const vTable[], index i, index di, double const u);
 
 // ijkVecSampleTableDec2*
 //	Find index of parameter in table and approximate value by interpolating 
@@ -5548,7 +5548,7 @@ dvec2 ijkVecSampleTableInc2d(double const uTable[], dvec2 const vTable[], index
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: interpolated vector in table that approximates input parameter
-dvec2 ijkVecSampleTableDec2d(double const uTable[], dvec2 const vTable[], index i, index di, double const u);
+ijk_inl dvec2 ijkVecSampleTableDec2d(double const uTable[], dvec2 const vTable[], index i, index di, double const u);
 
 
 //-----------------------------------------------------------------------------
@@ -5557,49 +5557,49 @@ dvec2 ijkVecSampleTableDec2d(double const uTable[], dvec2 const vTable[], index
 //	Calculate the squared length of a vector.
 //		param v_in: input vector
 //		return: squared length
-double ijkVecLengthSq3d(dvec3 const v_in);
+ijk_inl double ijkVecLengthSq3d(dvec3 const v_in);
 
 // ijkVecLength3*
 //	Calculate the length of a vector.
 //		param v_in: input vector
 //		return: length
-double ijkVecLength3d(dvec3 const v_in);
+ijk_inl double ijkVecLength3d(dvec3 const v_in);
 
 // ijkVecLengthSqInv3*
 //	Calculate the inverse squared length of a vector.
 //		param v_in: input vector
 //		return: inverse squared length
-double ijkVecLengthSqInv3d(dvec3 const v_in);
+ijk_inl double ijkVecLengthSqInv3d(dvec3 const v_in);
 
 // ijkVecLengthSqInvSafe3*
 //	Calculate the inverse squared length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse squared length
-double ijkVecLengthSqInvSafe3d(dvec3 const v_in);
+ijk_inl double ijkVecLengthSqInvSafe3d(dvec3 const v_in);
 
 // ijkVecLengthInv3*
 //	Calculate the inverse length of a vector.
 //		param v_in: input vector
 //		return: inverse length
-double ijkVecLengthInv3d(dvec3 const v_in);
+ijk_inl double ijkVecLengthInv3d(dvec3 const v_in);
 
 // ijkVecLengthInvSafe3*
 //	Calculate the inverse length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse length
-double ijkVecLengthInvSafe3d(dvec3 const v_in);
+ijk_inl double ijkVecLengthInvSafe3d(dvec3 const v_in);
 
 // ijkVecNormalize3*
 //	Calculate the unit-length direction of a vector.
 //		param v_in: input vector
 //		return: unit-length direction vector
-dvec3 ijkVecNormalize3d(dvec3 const v_in);
+ijk_inl dvec3 ijkVecNormalize3d(dvec3 const v_in);
 
 // ijkVecNormalizeSafe3*
 //	Calculate the unit-length direction of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: unit-length direction vector
-dvec3 ijkVecNormalizeSafe3d(dvec3 const v_in);
+ijk_inl dvec3 ijkVecNormalizeSafe3d(dvec3 const v_in);
 
 // ijkVecNormalizeGetLength3*
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -5607,7 +5607,7 @@ dvec3 ijkVecNormalizeSafe3d(dvec3 const v_in);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-dvec3 ijkVecNormalizeGetLength3d(dvec3 const v_in, double* const length_out);
+ijk_inl dvec3 ijkVecNormalizeGetLength3d(dvec3 const v_in, double* const length_out);
 
 // ijkVecNormalizeSafeGetLength3*
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -5615,7 +5615,7 @@ dvec3 ijkVecNormalizeGetLength3d(dvec3 const v_in, double* const length_out);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-dvec3 ijkVecNormalizeSafeGetLength3d(dvec3 const v_in, double* const length_out);
+ijk_inl dvec3 ijkVecNormalizeSafeGetLength3d(dvec3 const v_in, double* const length_out);
 
 // ijkVecNormalizeGetLengthInv3*
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -5623,7 +5623,7 @@ dvec3 ijkVecNormalizeSafeGetLength3d(dvec3 const v_in, double* const length_out)
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-dvec3 ijkVecNormalizeGetLengthInv3d(dvec3 const v_in, double* const lengthInv_out);
+ijk_inl dvec3 ijkVecNormalizeGetLengthInv3d(dvec3 const v_in, double* const lengthInv_out);
 
 // ijkVecNormalizeSafeGetLengthInv3*
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -5631,21 +5631,21 @@ dvec3 ijkVecNormalizeGetLengthInv3d(dvec3 const v_in, double* const lengthInv_ou
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-dvec3 ijkVecNormalizeSafeGetLengthInv3d(dvec3 const v_in, double* const lengthInv_out);
+ijk_inl dvec3 ijkVecNormalizeSafeGetLengthInv3d(dvec3 const v_in, double* const lengthInv_out);
 
 // ijkVecCrossNormalize3*
 //	Calculate unit-length result of cross product.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: unit cross product
-dvec3 ijkVecCrossNormalize3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecCrossNormalize3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecCrossNormalizeSafe3*
 //	Calculate unit-length result of cross product; division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: unit cross product
-dvec3 ijkVecCrossNormalizeSafe3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl dvec3 ijkVecCrossNormalizeSafe3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecCrossNormalizeGetLength3*
 //	Calculate unit-length result of cross product; also capture length.
@@ -5653,7 +5653,7 @@ dvec3 ijkVecCrossNormalizeSafe3d(dvec3 const v_lh, dvec3 const v_rh);
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: unit cross product
-dvec3 ijkVecCrossNormalizeGetLength3d(dvec3 const v_lh, dvec3 const v_rh, double* const length_out);
+ijk_inl dvec3 ijkVecCrossNormalizeGetLength3d(dvec3 const v_lh, dvec3 const v_rh, double* const length_out);
 
 // ijkVecCrossNormalizeSafeGetLength3*
 //	Calculate unit-length result of cross product; also capture length; 
@@ -5662,7 +5662,7 @@ dvec3 ijkVecCrossNormalizeGetLength3d(dvec3 const v_lh, dvec3 const v_rh, double
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: unit cross product
-dvec3 ijkVecCrossNormalizeSafeGetLength3d(dvec3 const v_lh, dvec3 const v_rh, double* const length_out);
+ijk_inl dvec3 ijkVecCrossNormalizeSafeGetLength3d(dvec3 const v_lh, dvec3 const v_rh, double* const length_out);
 
 // ijkVecCrossNormalizeGetLengthInv3*
 //	Calculate unit-length result of cross product; also capture inverse length.
@@ -5670,7 +5670,7 @@ dvec3 ijkVecCrossNormalizeSafeGetLength3d(dvec3 const v_lh, dvec3 const v_rh, do
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: unit cross product
-dvec3 ijkVecCrossNormalizeGetLengthInv3d(dvec3 const v_lh, dvec3 const v_rh, double* const lengthInv_out);
+ijk_inl dvec3 ijkVecCrossNormalizeGetLengthInv3d(dvec3 const v_lh, dvec3 const v_rh, double* const lengthInv_out);
 
 // ijkVecCrossNormalizeSafeGetLengthInv3*
 //	Calculate unit-length result of cross product; also capture inverse length;
@@ -5679,7 +5679,7 @@ dvec3 ijkVecCrossNormalizeGetLengthInv3d(dvec3 const v_lh, dvec3 const v_rh, dou
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: unit cross product
-dvec3 ijkVecCrossNormalizeSafeGetLengthInv3d(dvec3 const v_lh, dvec3 const v_rh, double* const lengthInv_out);
+ijk_inl dvec3 ijkVecCrossNormalizeSafeGetLengthInv3d(dvec3 const v_lh, dvec3 const v_rh, double* const lengthInv_out);
 
 // ijkVecLerp3*
 //	Vector linear interpolation.
@@ -5688,7 +5688,7 @@ dvec3 ijkVecCrossNormalizeSafeGetLengthInv3d(dvec3 const v_lh, dvec3 const v_rh,
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-dvec3 ijkVecLerp3d(dvec3 const v0, dvec3 const v1, double const u);
+ijk_inl dvec3 ijkVecLerp3d(dvec3 const v0, dvec3 const v1, double const u);
 
 // ijkVecLerpInv3*
 //	Vector linear interpolation inverse to calculate parameters given control .
@@ -5697,7 +5697,7 @@ dvec3 ijkVecLerp3d(dvec3 const v0, dvec3 const v1, double const u);
 //		param v_lerp: interpolated vector used to calculate parameters; params 
 //			in range [0,1] indicate interpolation, others for extrapolation
 //		return: interpolation parameter for each component
-dvec3 ijkVecLerpInv3d(dvec3 const v0, dvec3 const v1, dvec3 const v_lerp);
+ijk_inl dvec3 ijkVecLerpInv3d(dvec3 const v0, dvec3 const v1, dvec3 const v_lerp);
 
 // ijkVecLerpRevInit3*
 //	Vector linear interpolation reversal to calculate initial control.
@@ -5706,7 +5706,7 @@ dvec3 ijkVecLerpInv3d(dvec3 const v0, dvec3 const v1, dvec3 const v_lerp);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: initial control vector, result when param is 0
-dvec3 ijkVecLerpRevInit3d(dvec3 const v_lerp, dvec3 const v1, double const u);
+ijk_inl dvec3 ijkVecLerpRevInit3d(dvec3 const v_lerp, dvec3 const v1, double const u);
 
 // ijkVecLerpRevTerm3*
 //	Vector linear interpolation reversal to calculate terminal control.
@@ -5715,28 +5715,28 @@ dvec3 ijkVecLerpRevInit3d(dvec3 const v_lerp, dvec3 const v1, double const u);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: terminal control vector, result when param is 1
-dvec3 ijkVecLerpRevTerm3d(dvec3 const v0, dvec3 const v_lerp, double const u);
+ijk_inl dvec3 ijkVecLerpRevTerm3d(dvec3 const v0, dvec3 const v_lerp, double const u);
 
 // ijkVecProjRatio3*
 //	Calculate projection length ratio.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: length ratio of projected vector to base
-double ijkVecProjRatio3d(dvec3 const v_base, dvec3 const v_in);
+ijk_inl double ijkVecProjRatio3d(dvec3 const v_base, dvec3 const v_in);
 
 // ijkVecProj3*
 //	Vector projection.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: projected input onto base
-dvec3 ijkVecProj3d(dvec3 const v_base, dvec3 const v_in);
+ijk_inl dvec3 ijkVecProj3d(dvec3 const v_base, dvec3 const v_in);
 
 // ijkVecOrtho3*
 //	Vector orthogonalization using the Gram-Schmidt process.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be orthogonalized
 //		return: output orthogonalized vector
-dvec3 ijkVecOrtho3d(dvec3 const v_base, dvec3 const v_in);
+ijk_inl dvec3 ijkVecOrtho3d(dvec3 const v_base, dvec3 const v_in);
 
 // ijkVecOrthoNorm3*
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -5744,7 +5744,7 @@ dvec3 ijkVecOrtho3d(dvec3 const v_base, dvec3 const v_in);
 //		param v_in: input vector to be orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: output orthonormalized vector
-dvec3 ijkVecOrthoNorm3d(dvec3 const v_base, dvec3 const v_in, dvec3* const v_base_norm_out);
+ijk_inl dvec3 ijkVecOrthoNorm3d(dvec3 const v_base, dvec3 const v_in, dvec3* const v_base_norm_out);
 
 // ijkVecOrthoList3*
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -5753,7 +5753,7 @@ dvec3 ijkVecOrthoNorm3d(dvec3 const v_base, dvec3 const v_in, dvec3* const v_bas
 //		param vl_in: input list of vectors to be orthogonalized
 //		param n: number of vectors to orthogonalize
 //		return: vl_out
-dvec3* ijkVecOrthoList3d(dvec3 vl_out[], dvec3 const v_base, dvec3 const vl_in[], size const n);
+ijk_inl dvec3* ijkVecOrthoList3d(dvec3 vl_out[], dvec3 const v_base, dvec3 const vl_in[], size const n);
 
 // ijkVecOrthoNormList3*
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -5763,7 +5763,7 @@ dvec3* ijkVecOrthoList3d(dvec3 vl_out[], dvec3 const v_base, dvec3 const vl_in[]
 //		param n: number of vectors to orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: vl_out
-dvec3* ijkVecOrthoNormList3d(dvec3 vl_out[], dvec3 const v_base, dvec3 const vl_in[], size const n, dvec3* const v_base_norm_out);
+ijk_inl dvec3* ijkVecOrthoNormList3d(dvec3 vl_out[], dvec3 const v_base, dvec3 const vl_in[], size const n, dvec3* const v_base_norm_out);
 
 // ijkVecNlerp3*
 //	Calculate normalized linear interpolation between two 3D vectors; keeps
@@ -5773,7 +5773,7 @@ dvec3* ijkVecOrthoNormList3d(dvec3 vl_out[], dvec3 const v_base, dvec3 const vl_
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-dvec3 ijkVecNlerp3d(dvec3 const v0, dvec3 const v1, double const u);
+ijk_inl dvec3 ijkVecNlerp3d(dvec3 const v0, dvec3 const v1, double const u);
 
 // ijkVecSlerp3*
 //	Calculate spherical linear interpolation between two unit 3D vectors; keeps
@@ -5783,49 +5783,49 @@ dvec3 ijkVecNlerp3d(dvec3 const v0, dvec3 const v1, double const u);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-dvec3 ijkVecSlerp3d(dvec3 const v0, dvec3 const v1, double const u);
+ijk_inl dvec3 ijkVecSlerp3d(dvec3 const v0, dvec3 const v1, double const u);
 
 // ijkVecReflectScale3*
 //	Reflect incident vector about normal, scaling to match normal size.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-dvec3 ijkVecReflectScale3d(dvec3 const v_in, dvec3 const v_nrm);
+ijk_inl dvec3 ijkVecReflectScale3d(dvec3 const v_in, dvec3 const v_nrm);
 
 // ijkVecUnitReflect3*
 //	Reflect incident vector about normal; optimized for unit normal vector.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-dvec3 ijkVecUnitReflect3d(dvec3 const v_in, dvec3 const v_nrm);
+ijk_inl dvec3 ijkVecUnitReflect3d(dvec3 const v_in, dvec3 const v_nrm);
 
 // ijkVecReflect3*
 //	Reflect incident vector about normal.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-dvec3 ijkVecReflect3d(dvec3 const v_in, dvec3 const v_nrm);
+ijk_inl dvec3 ijkVecReflect3d(dvec3 const v_in, dvec3 const v_nrm);
 
 // ijkVecDistance3*
 //	Calculate distance between two points.
 //		param v_lh: left-hand input
 //		param v_rh: right-hand input
 //		return: distance between inputs
-double ijkVecDistance3d(dvec3 const v_lh, dvec3 const v_rh);
+ijk_inl double ijkVecDistance3d(dvec3 const v_lh, dvec3 const v_rh);
 
 // ijkVecResize3*
 //	Change length of vector, retaining direction.
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: resized vector
-dvec3 ijkVecResize3d(dvec3 const v_in, double const length);
+ijk_inl dvec3 ijkVecResize3d(dvec3 const v_in, double const length);
 
 // ijkVecResizeSafe3*
 //	Change length of vector, retaining direction; division-by-zero safe.
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: resized vector
-dvec3 ijkVecResizeSafe3d(dvec3 const v_in, double const length);
+ijk_inl dvec3 ijkVecResizeSafe3d(dvec3 const v_in, double const length);
 
 // ijkVecCrossResize3*
 //	Change length of cross product result, retaining direction.
@@ -5833,7 +5833,7 @@ dvec3 ijkVecResizeSafe3d(dvec3 const v_in, double const length);
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized cross product
-dvec3 ijkVecCrossResize3d(dvec3 const v_lh, dvec3 const v_rh, double const length);
+ijk_inl dvec3 ijkVecCrossResize3d(dvec3 const v_lh, dvec3 const v_rh, double const length);
 
 // ijkVecCrossResizeSafe3*
 //	Change length of cross product result, retaining direction; 
@@ -5842,7 +5842,7 @@ dvec3 ijkVecCrossResize3d(dvec3 const v_lh, dvec3 const v_rh, double const lengt
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized cross product
-dvec3 ijkVecCrossResizeSafe3d(dvec3 const v_lh, dvec3 const v_rh, double const length);
+ijk_inl dvec3 ijkVecCrossResizeSafe3d(dvec3 const v_lh, dvec3 const v_rh, double const length);
 
 // ijkVecNearest3*
 //	Nearest-neighbor interpolation between two reference values.
@@ -5850,7 +5850,7 @@ dvec3 ijkVecCrossResizeSafe3d(dvec3 const v_lh, dvec3 const v_rh, double const l
 //		param v1: terminal reference value/end point, result when t>=0.5
 //		param u: interpolation parameter
 //		return: nearest-neighbor interpolated vector, exactly v0 or v1
-dvec3 ijkVecNearest3d(dvec3 const v0, dvec3 const v1, double const u);
+ijk_inl dvec3 ijkVecNearest3d(dvec3 const v0, dvec3 const v1, double const u);
 
 // ijkVecBinearest3*
 //	Nearest-neighbor interpolation of nearest-neighbor interpolated values.
@@ -5866,7 +5866,7 @@ dvec3 ijkVecNearest3d(dvec3 const v0, dvec3 const v1, double const u);
 //		param u1: interpolation parameter for second pair
 //		param u: interpolation parameter for results
 //		return: bi-nearest-neighbor interpolated vector
-dvec3 ijkVecBinearest3d(dvec3 const v00, dvec3 const v01, dvec3 const v10, dvec3 const v11, double const u0, double const u1, double const u);
+ijk_inl dvec3 ijkVecBinearest3d(dvec3 const v00, dvec3 const v01, dvec3 const v10, dvec3 const v11, double const u0, double const u1, double const u);
 
 // ijkVecRemap3*
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -5880,14 +5880,14 @@ dvec3 ijkVecBinearest3d(dvec3 const v00, dvec3 const v01, dvec3 const v10, dvec3
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: vector in original range remapped to target range
-dvec3 ijkVecRemap3d(dvec3 const v0_dst, dvec3 const v1_dst, dvec3 const v0_src, dvec3 const v1_src, dvec3 const v_src);
+ijk_inl dvec3 ijkVecRemap3d(dvec3 const v0_dst, dvec3 const v1_dst, dvec3 const v0_src, dvec3 const v1_src, dvec3 const v_src);
 
 // ijkVecBezier0O3*
 //	Perform order-0 (point) Bezier interpolation given one reference value.
 //		param v0: reference value, always returned
 //		param u: interpolation parameter; not used for order 0 interpolation
 //		return: v0
-dvec3 ijkVecBezier0O3d(dvec3 const v0, double const u);
+ijk_inl dvec3 ijkVecBezier0O3d(dvec3 const v0, double const u);
 
 // ijkVecBezier1O3*
 //	Perform order-1 (linear) Bezier interpolation given two reference values.
@@ -5896,7 +5896,7 @@ dvec3 ijkVecBezier0O3d(dvec3 const v0, double const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: linear interpolation between v0 and v1
-dvec3 ijkVecBezier1O3d(dvec3 const v0, dvec3 const v1, double const u);
+ijk_inl dvec3 ijkVecBezier1O3d(dvec3 const v0, dvec3 const v1, double const u);
 
 // ijkVecBezier2O3*
 //	Perform order-2 (quadratic) Bezier interpolation given three reference 
@@ -5907,7 +5907,7 @@ dvec3 ijkVecBezier1O3d(dvec3 const v0, dvec3 const v1, double const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v2
 //		return: quadratic Bezier interpolation between v0 and v2
-dvec3 ijkVecBezier2O3d(dvec3 const v0, dvec3 const v1, dvec3 const v2, double const u);
+ijk_inl dvec3 ijkVecBezier2O3d(dvec3 const v0, dvec3 const v1, dvec3 const v2, double const u);
 
 // ijkVecBezier3O3*
 //	Perform order-3 (cubic) Bezier interpolation given four reference values.
@@ -5918,7 +5918,7 @@ dvec3 ijkVecBezier2O3d(dvec3 const v0, dvec3 const v1, dvec3 const v2, double co
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v3
 //		return: cubic Bezier interpolation between v0 and v3
-dvec3 ijkVecBezier3O3d(dvec3 const v0, dvec3 const v1, dvec3 const v2, dvec3 const v3, double const u);
+ijk_inl dvec3 ijkVecBezier3O3d(dvec3 const v0, dvec3 const v1, dvec3 const v2, dvec3 const v3, double const u);
 
 // ijkVecBezierNO3*
 //	Perform order-N (recursive) Bezier interpolation given an array of 
@@ -5931,7 +5931,7 @@ dvec3 ijkVecBezier3O3d(dvec3 const v0, dvec3 const v1, dvec3 const v2, dvec3 con
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v[0] and v[order]
 //		return: recursive Bezier interpolation between v[0] and v[order]
-dvec3 ijkVecBezierNO3d(dvec3 const v[], size const order, double const u);
+ijk_inl dvec3 ijkVecBezierNO3d(dvec3 const v[], size const order, double const u);
 
 // ijkVecCubicHermite3*
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -5943,7 +5943,7 @@ dvec3 ijkVecBezierNO3d(dvec3 const v[], size const order, double const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-dvec3 ijkVecCubicHermite3d(dvec3 const v0, dvec3 const dv0, dvec3 const v1, dvec3 const dv1, double const u);
+ijk_inl dvec3 ijkVecCubicHermite3d(dvec3 const v0, dvec3 const dv0, dvec3 const v1, dvec3 const dv1, double const u);
 
 // ijkVecCubicHermiteHandles3*
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -5957,7 +5957,7 @@ dvec3 ijkVecCubicHermite3d(dvec3 const v0, dvec3 const dv0, dvec3 const v1, dvec
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-dvec3 ijkVecCubicHermiteHandles3d(dvec3 const v0, dvec3 const cv0, dvec3 const v1, dvec3 const cv1, double const u);
+ijk_inl dvec3 ijkVecCubicHermiteHandles3d(dvec3 const v0, dvec3 const cv0, dvec3 const v1, dvec3 const cv1, double const u);
 
 // ijkVecCubicCatmullRom3*
 //	Catmull-Rom spline/curve interpolation between two reference values with 
@@ -5969,7 +5969,7 @@ dvec3 ijkVecCubicHermiteHandles3d(dvec3 const v0, dvec3 const cv0, dvec3 const v
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-dvec3 ijkVecCubicCatmullRom3d(dvec3 const vp, dvec3 const v0, dvec3 const v1, dvec3 const v2, double const u);
+ijk_inl dvec3 ijkVecCubicCatmullRom3d(dvec3 const vp, dvec3 const v0, dvec3 const v1, dvec3 const v2, double const u);
 
 // ijkVecBicubicCatmullRom3*
 //	Bi-cubic interpolation using Catmull-Rom interpolation for segments.
@@ -6003,7 +6003,7 @@ dvec3 ijkVecCubicCatmullRom3d(dvec3 const vp, dvec3 const v0, dvec3 const v1, dv
 //		param u2: interpolation parameter for terminal control curve
 //		param u: interpolation parameter for result
 //		return: interpolated vector
-dvec3 ijkVecBicubicCatmullRom3d(dvec3 const vpp, dvec3 const vp0, dvec3 const vp1, dvec3 const vp2, dvec3 const v0p, dvec3 const v00, dvec3 const v01, dvec3 const v02, dvec3 const v1p, dvec3 const v10, dvec3 const v11, dvec3 const v12, dvec3 const v2p, dvec3 const v20, dvec3 const v21, dvec3 const v22, double const up, double const u0, double const u1, double const u2, double const u);
+ijk_inl dvec3 ijkVecBicubicCatmullRom3d(dvec3 const vpp, dvec3 const vp0, dvec3 const vp1, dvec3 const vp2, dvec3 const v0p, dvec3 const v00, dvec3 const v01, dvec3 const v02, dvec3 const v1p, dvec3 const v10, dvec3 const v11, dvec3 const v12, dvec3 const v2p, dvec3 const v20, dvec3 const v21, dvec3 const v22, double const up, double const u0, double const u1, double const u2, double const u);
 
 // ijkVecReparamCubicHermite3*
 //	Reparameterize a cubic Hermite segment into sample table.
@@ -6023,7 +6023,7 @@ dvec3 ijkVecBicubicCatmullRom3d(dvec3 const vpp, dvec3 const vp0, dvec3 const vp
 //		param v1: terminal reference value/end point, result when t=1
 //		param dv1: terminal tangent/rate of change
 //		return: total arc length
-double ijkVecReparamCubicHermite3d(double uTable_out[], double lTable_out[], dvec3 vTable_out[], size const numDivisions, ibool const lNormalize, dvec3 const v0, dvec3 const dv0, dvec3 const v1, dvec3 const dv1);
+ijk_inl double ijkVecReparamCubicHermite3d(double uTable_out[], double lTable_out[], dvec3 vTable_out[], size const numDivisions, ibool const lNormalize, dvec3 const v0, dvec3 const dv0, dvec3 const v1, dvec3 const dv1);
 
 // ijkVecReparamCubicHermiteHandles3*
 //	Reparameterize a cubic Hermite segment with handles into sample table.
@@ -6045,7 +6045,7 @@ double ijkVecReparamCubicHermite3d(double uTable_out[], double lTable_out[], dve
 //		param cv1: terminal control handle value, should be greater than v1 
 //			for a positive rate of change
 //		return: total arc length
-double ijkVecReparamCubicHermiteHandles3d(double uTable_out[], double lTable_out[], dvec3 vTable_out[], size const numDivisions, ibool const lNormalize, dvec3 const v0, dvec3 const cv0, dvec3 const v1, dvec3 const cv1);
+ijk_inl double ijkVecReparamCubicHermiteHandles3d(double uTable_out[], double lTable_out[], dvec3 vTable_out[], size const numDivisions, ibool const lNormalize, dvec3 const v0, dvec3 const cv0, dvec3 const v1, dvec3 const cv1);
 
 // ijkVecReparamCubicCatmullRom3*
 //	Reparameterize a cubic Catmull-Rom segment into sample table.
@@ -6065,7 +6065,7 @@ double ijkVecReparamCubicHermiteHandles3d(double uTable_out[], double lTable_out
 //		param v1: terminal reference value/end point, result when t=1
 //		param v2: terminal control value
 //		return: total arc length
-double ijkVecReparamCubicCatmullRom3d(double uTable_out[], double lTable_out[], dvec3 vTable_out[], size const numDivisions, ibool const lNormalize, dvec3 const vp, dvec3 const v0, dvec3 const v1, dvec3 const v2);
+ijk_inl double ijkVecReparamCubicCatmullRom3d(double uTable_out[], double lTable_out[], dvec3 vTable_out[], size const numDivisions, ibool const lNormalize, dvec3 const vp, dvec3 const v0, dvec3 const v1, dvec3 const v2);
 
 // ijkVecReparamBicubicCatmullRom3*
 //	Reparameterize a bi-cubic Catmull-Rom segment into sample table.
@@ -6109,7 +6109,7 @@ double ijkVecReparamCubicCatmullRom3d(double uTable_out[], double lTable_out[],
 //		param u1: interpolation parameter for terminal value curve
 //		param u2: interpolation parameter for terminal control curve
 //		return: total arc length
-double ijkVecReparamBicubicCatmullRom3d(double uTable_out[], double lTable_out[], dvec3 vTable_out[], size const numDivisions, ibool const lNormalize, dvec3 const vpp, dvec3 const vp0, dvec3 const vp1, dvec3 const vp2, dvec3 const v0p, dvec3 const v00, dvec3 const v01, dvec3 const v02, dvec3 const v1p, dvec3 const v10, dvec3 const v11, dvec3 const v12, dvec3 const v2p, dvec3 const v20, dvec3 const v21, dvec3 const v22, double const up, double const u0, double const u1, double const u2);
+ijk_inl double ijkVecReparamBicubicCatmullRom3d(double uTable_out[], double lTable_out[], dvec3 vTable_out[], size const numDivisions, ibool const lNormalize, dvec3 const vpp, dvec3 const vp0, dvec3 const vp1, dvec3 const vp2, dvec3 const v0p, dvec3 const v00, dvec3 const v01, dvec3 const v02, dvec3 const v1p, dvec3 const v10, dvec3 const v11, dvec3 const v12, dvec3 const v2p, dvec3 const v20, dvec3 const v21, dvec3 const v22, double const up, double const u0, double const u1, double const u2);
 
 // ijkVecSampleTableInc3*
 //	Find index of parameter in table and approximate value by interpolating 
@@ -6126,7 +6126,7 @@ double ijkVecReparamBicubicCatmullRom3d(double uTable_out[], double lTable_out[]
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: interpolated vector in table that approximates input parameter
-dvec3 ijkVecSampleTableInc3d(double const uTable[], dvec3 const vTable[], index i, index di, double const u);
+ijk_inl dvec3 ijkVecSampleTableInc3d(double const uTable[], dvec3 const vTable[], index i, index di, double const u);
 
 // ijkVecSampleTableDec3*
 //	Find index of parameter in table and approximate value by interpolating 
@@ -6143,7 +6143,7 @@ dvec3 ijkVecSampleTableInc3d(double const uTable[], dvec3 const vTable[], index
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: interpolated vector in table that approximates input parameter
-dvec3 ijkVecSampleTableDec3d(double const uTable[], dvec3 const vTable[], index i, index di, double const u);
+ijk_inl dvec3 ijkVecSampleTableDec3d(double const uTable[], dvec3 const vTable[], index i, index di, double const u);
 
 
 //-----------------------------------------------------------------------------
@@ -6152,49 +6152,49 @@ dvec3 ijkVecSampleTableDec3d(double const uTable[], dvec3 const vTable[], index
 //	Calculate the squared length of a vector.
 //		param v_in: input vector
 //		return: squared length
-double ijkVecLengthSq4d(dvec4 const v_in);
+ijk_inl double ijkVecLengthSq4d(dvec4 const v_in);
 
 // ijkVecLength4*
 //	Calculate the length of a vector.
 //		param v_in: input vector
 //		return: length
-double ijkVecLength4d(dvec4 const v_in);
+ijk_inl double ijkVecLength4d(dvec4 const v_in);
 
 // ijkVecLengthSqInv4*
 //	Calculate the inverse squared length of a vector.
 //		param v_in: input vector
 //		return: inverse squared length
-double ijkVecLengthSqInv4d(dvec4 const v_in);
+ijk_inl double ijkVecLengthSqInv4d(dvec4 const v_in);
 
 // ijkVecLengthSqInvSafe4*
 //	Calculate the inverse squared length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse squared length
-double ijkVecLengthSqInvSafe4d(dvec4 const v_in);
+ijk_inl double ijkVecLengthSqInvSafe4d(dvec4 const v_in);
 
 // ijkVecLengthInv4*
 //	Calculate the inverse length of a vector.
 //		param v_in: input vector
 //		return: inverse length
-double ijkVecLengthInv4d(dvec4 const v_in);
+ijk_inl double ijkVecLengthInv4d(dvec4 const v_in);
 
 // ijkVecLengthInvSafe4*
 //	Calculate the inverse length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse length
-double ijkVecLengthInvSafe4d(dvec4 const v_in);
+ijk_inl double ijkVecLengthInvSafe4d(dvec4 const v_in);
 
 // ijkVecNormalize4*
 //	Calculate the unit-length direction of a vector.
 //		param v_in: input vector
 //		return: unit-length direction vector
-dvec4 ijkVecNormalize4d(dvec4 const v_in);
+ijk_inl dvec4 ijkVecNormalize4d(dvec4 const v_in);
 
 // ijkVecNormalizeSafe4*
 //	Calculate the unit-length direction of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: unit-length direction vector
-dvec4 ijkVecNormalizeSafe4d(dvec4 const v_in);
+ijk_inl dvec4 ijkVecNormalizeSafe4d(dvec4 const v_in);
 
 // ijkVecNormalizeGetLength4*
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -6202,7 +6202,7 @@ dvec4 ijkVecNormalizeSafe4d(dvec4 const v_in);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-dvec4 ijkVecNormalizeGetLength4d(dvec4 const v_in, double* const length_out);
+ijk_inl dvec4 ijkVecNormalizeGetLength4d(dvec4 const v_in, double* const length_out);
 
 // ijkVecNormalizeSafeGetLength4*
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -6210,7 +6210,7 @@ dvec4 ijkVecNormalizeGetLength4d(dvec4 const v_in, double* const length_out);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-dvec4 ijkVecNormalizeSafeGetLength4d(dvec4 const v_in, double* const length_out);
+ijk_inl dvec4 ijkVecNormalizeSafeGetLength4d(dvec4 const v_in, double* const length_out);
 
 // ijkVecNormalizeGetLengthInv4*
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -6218,7 +6218,7 @@ dvec4 ijkVecNormalizeSafeGetLength4d(dvec4 const v_in, double* const length_out)
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-dvec4 ijkVecNormalizeGetLengthInv4d(dvec4 const v_in, double* const lengthInv_out);
+ijk_inl dvec4 ijkVecNormalizeGetLengthInv4d(dvec4 const v_in, double* const lengthInv_out);
 
 // ijkVecNormalizeSafeGetLengthInv4*
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -6226,21 +6226,21 @@ dvec4 ijkVecNormalizeGetLengthInv4d(dvec4 const v_in, double* const lengthInv_ou
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-dvec4 ijkVecNormalizeSafeGetLengthInv4d(dvec4 const v_in, double* const lengthInv_out);
+ijk_inl dvec4 ijkVecNormalizeSafeGetLengthInv4d(dvec4 const v_in, double* const lengthInv_out);
 
 // ijkVecCrossNormalize4*
 //	Calculate unit-length result of cross product.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: unit cross product
-dvec4 ijkVecCrossNormalize4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecCrossNormalize4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecCrossNormalizeSafe4*
 //	Calculate unit-length result of cross product; division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: unit cross product
-dvec4 ijkVecCrossNormalizeSafe4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl dvec4 ijkVecCrossNormalizeSafe4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecCrossNormalizeGetLength4*
 //	Calculate unit-length result of cross product; also capture length.
@@ -6248,7 +6248,7 @@ dvec4 ijkVecCrossNormalizeSafe4d(dvec4 const v_lh, dvec4 const v_rh);
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: unit cross product
-dvec4 ijkVecCrossNormalizeGetLength4d(dvec4 const v_lh, dvec4 const v_rh, double* const length_out);
+ijk_inl dvec4 ijkVecCrossNormalizeGetLength4d(dvec4 const v_lh, dvec4 const v_rh, double* const length_out);
 
 // ijkVecCrossNormalizeSafeGetLength4*
 //	Calculate unit-length result of cross product; also capture length; 
@@ -6257,7 +6257,7 @@ dvec4 ijkVecCrossNormalizeGetLength4d(dvec4 const v_lh, dvec4 const v_rh, double
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: unit cross product
-dvec4 ijkVecCrossNormalizeSafeGetLength4d(dvec4 const v_lh, dvec4 const v_rh, double* const length_out);
+ijk_inl dvec4 ijkVecCrossNormalizeSafeGetLength4d(dvec4 const v_lh, dvec4 const v_rh, double* const length_out);
 
 // ijkVecCrossNormalizeGetLengthInv4*
 //	Calculate unit-length result of cross product; also capture inverse length.
@@ -6265,7 +6265,7 @@ dvec4 ijkVecCrossNormalizeSafeGetLength4d(dvec4 const v_lh, dvec4 const v_rh, do
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: unit cross product
-dvec4 ijkVecCrossNormalizeGetLengthInv4d(dvec4 const v_lh, dvec4 const v_rh, double* const lengthInv_out);
+ijk_inl dvec4 ijkVecCrossNormalizeGetLengthInv4d(dvec4 const v_lh, dvec4 const v_rh, double* const lengthInv_out);
 
 // ijkVecCrossNormalizeSafeGetLengthInv4*
 //	Calculate unit-length result of cross product; also capture inverse length;
@@ -6274,7 +6274,7 @@ dvec4 ijkVecCrossNormalizeGetLengthInv4d(dvec4 const v_lh, dvec4 const v_rh, dou
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: unit cross product
-dvec4 ijkVecCrossNormalizeSafeGetLengthInv4d(dvec4 const v_lh, dvec4 const v_rh, double* const lengthInv_out);
+ijk_inl dvec4 ijkVecCrossNormalizeSafeGetLengthInv4d(dvec4 const v_lh, dvec4 const v_rh, double* const lengthInv_out);
 
 // ijkVecLerp4*
 //	Vector linear interpolation.
@@ -6283,7 +6283,7 @@ dvec4 ijkVecCrossNormalizeSafeGetLengthInv4d(dvec4 const v_lh, dvec4 const v_rh,
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-dvec4 ijkVecLerp4d(dvec4 const v0, dvec4 const v1, double const u);
+ijk_inl dvec4 ijkVecLerp4d(dvec4 const v0, dvec4 const v1, double const u);
 
 // ijkVecLerpInv4*
 //	Vector linear interpolation inverse to calculate parameters given control .
@@ -6292,7 +6292,7 @@ dvec4 ijkVecLerp4d(dvec4 const v0, dvec4 const v1, double const u);
 //		param v_lerp: interpolated vector used to calculate parameters; params 
 //			in range [0,1] indicate interpolation, others for extrapolation
 //		return: interpolation parameter for each component
-dvec4 ijkVecLerpInv4d(dvec4 const v0, dvec4 const v1, dvec4 const v_lerp);
+ijk_inl dvec4 ijkVecLerpInv4d(dvec4 const v0, dvec4 const v1, dvec4 const v_lerp);
 
 // ijkVecLerpRevInit4*
 //	Vector linear interpolation reversal to calculate initial control.
@@ -6301,7 +6301,7 @@ dvec4 ijkVecLerpInv4d(dvec4 const v0, dvec4 const v1, dvec4 const v_lerp);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: initial control vector, result when param is 0
-dvec4 ijkVecLerpRevInit4d(dvec4 const v_lerp, dvec4 const v1, double const u);
+ijk_inl dvec4 ijkVecLerpRevInit4d(dvec4 const v_lerp, dvec4 const v1, double const u);
 
 // ijkVecLerpRevTerm4*
 //	Vector linear interpolation reversal to calculate terminal control.
@@ -6310,28 +6310,28 @@ dvec4 ijkVecLerpRevInit4d(dvec4 const v_lerp, dvec4 const v1, double const u);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: terminal control vector, result when param is 1
-dvec4 ijkVecLerpRevTerm4d(dvec4 const v0, dvec4 const v_lerp, double const u);
+ijk_inl dvec4 ijkVecLerpRevTerm4d(dvec4 const v0, dvec4 const v_lerp, double const u);
 
 // ijkVecProjRatio4*
 //	Calculate projection length ratio.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: length ratio of projected vector to base
-double ijkVecProjRatio4d(dvec4 const v_base, dvec4 const v_in);
+ijk_inl double ijkVecProjRatio4d(dvec4 const v_base, dvec4 const v_in);
 
 // ijkVecProj4*
 //	Vector projection.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: projected input onto base
-dvec4 ijkVecProj4d(dvec4 const v_base, dvec4 const v_in);
+ijk_inl dvec4 ijkVecProj4d(dvec4 const v_base, dvec4 const v_in);
 
 // ijkVecOrtho4*
 //	Vector orthogonalization using the Gram-Schmidt process.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be orthogonalized
 //		return: output orthogonalized vector
-dvec4 ijkVecOrtho4d(dvec4 const v_base, dvec4 const v_in);
+ijk_inl dvec4 ijkVecOrtho4d(dvec4 const v_base, dvec4 const v_in);
 
 // ijkVecOrthoNorm4*
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -6339,7 +6339,7 @@ dvec4 ijkVecOrtho4d(dvec4 const v_base, dvec4 const v_in);
 //		param v_in: input vector to be orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: output orthonormalized vector
-dvec4 ijkVecOrthoNorm4d(dvec4 const v_base, dvec4 const v_in, dvec4* const v_base_norm_out);
+ijk_inl dvec4 ijkVecOrthoNorm4d(dvec4 const v_base, dvec4 const v_in, dvec4* const v_base_norm_out);
 
 // ijkVecOrthoList4*
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -6348,7 +6348,7 @@ dvec4 ijkVecOrthoNorm4d(dvec4 const v_base, dvec4 const v_in, dvec4* const v_bas
 //		param vl_in: input list of vectors to be orthogonalized
 //		param n: number of vectors to orthogonalize
 //		return: vl_out
-dvec4* ijkVecOrthoList4d(dvec4 vl_out[], dvec4 const v_base, dvec4 const vl_in[], size const n);
+ijk_inl dvec4* ijkVecOrthoList4d(dvec4 vl_out[], dvec4 const v_base, dvec4 const vl_in[], size const n);
 
 // ijkVecOrthoNormList4*
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -6358,7 +6358,7 @@ dvec4* ijkVecOrthoList4d(dvec4 vl_out[], dvec4 const v_base, dvec4 const vl_in[]
 //		param n: number of vectors to orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: vl_out
-dvec4* ijkVecOrthoNormList4d(dvec4 vl_out[], dvec4 const v_base, dvec4 const vl_in[], size const n, dvec4* const v_base_norm_out);
+ijk_inl dvec4* ijkVecOrthoNormList4d(dvec4 vl_out[], dvec4 const v_base, dvec4 const vl_in[], size const n, dvec4* const v_base_norm_out);
 
 // ijkVecNlerp4*
 //	Calculate normalized linear interpolation between two 4D vectors; keeps
@@ -6368,7 +6368,7 @@ dvec4* ijkVecOrthoNormList4d(dvec4 vl_out[], dvec4 const v_base, dvec4 const vl_
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-dvec4 ijkVecNlerp4d(dvec4 const v0, dvec4 const v1, double const u);
+ijk_inl dvec4 ijkVecNlerp4d(dvec4 const v0, dvec4 const v1, double const u);
 
 // ijkVecSlerp4*
 //	Calculate spherical linear interpolation between two unit 4D vectors; keeps
@@ -6378,49 +6378,49 @@ dvec4 ijkVecNlerp4d(dvec4 const v0, dvec4 const v1, double const u);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-dvec4 ijkVecSlerp4d(dvec4 const v0, dvec4 const v1, double const u);
+ijk_inl dvec4 ijkVecSlerp4d(dvec4 const v0, dvec4 const v1, double const u);
 
 // ijkVecReflectScale4*
 //	Reflect incident vector about normal, scaling to match normal size.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-dvec4 ijkVecReflectScale4d(dvec4 const v_in, dvec4 const v_nrm);
+ijk_inl dvec4 ijkVecReflectScale4d(dvec4 const v_in, dvec4 const v_nrm);
 
 // ijkVecUnitReflect4*
 //	Reflect incident vector about normal; optimized for unit normal vector.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-dvec4 ijkVecUnitReflect4d(dvec4 const v_in, dvec4 const v_nrm);
+ijk_inl dvec4 ijkVecUnitReflect4d(dvec4 const v_in, dvec4 const v_nrm);
 
 // ijkVecReflect4*
 //	Reflect incident vector about normal.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-dvec4 ijkVecReflect4d(dvec4 const v_in, dvec4 const v_nrm);
+ijk_inl dvec4 ijkVecReflect4d(dvec4 const v_in, dvec4 const v_nrm);
 
 // ijkVecDistance4*
 //	Calculate "distance" between two 4D vectors.
 //		param v_lh: left-hand input
 //		param v_rh: right-hand input
 //		return: distance between inputs
-double ijkVecDistance4d(dvec4 const v_lh, dvec4 const v_rh);
+ijk_inl double ijkVecDistance4d(dvec4 const v_lh, dvec4 const v_rh);
 
 // ijkVecResize4*
 //	Change length of vector, retaining direction.
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: resized vector
-dvec4 ijkVecResize4d(dvec4 const v_in, double const length);
+ijk_inl dvec4 ijkVecResize4d(dvec4 const v_in, double const length);
 
 // ijkVecResizeSafe4*
 //	Change length of vector, retaining direction; division-by-zero safe.
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: resized vector
-dvec4 ijkVecResizeSafe4d(dvec4 const v_in, double const length);
+ijk_inl dvec4 ijkVecResizeSafe4d(dvec4 const v_in, double const length);
 
 // ijkVecCrossResize4*
 //	Change length of cross product result, retaining direction.
@@ -6428,7 +6428,7 @@ dvec4 ijkVecResizeSafe4d(dvec4 const v_in, double const length);
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized cross product
-dvec4 ijkVecCrossResize4d(dvec4 const v_lh, dvec4 const v_rh, double const length);
+ijk_inl dvec4 ijkVecCrossResize4d(dvec4 const v_lh, dvec4 const v_rh, double const length);
 
 // ijkVecCrossResizeSafe4*
 //	Change length of cross product result, retaining direction; 
@@ -6437,7 +6437,7 @@ dvec4 ijkVecCrossResize4d(dvec4 const v_lh, dvec4 const v_rh, double const lengt
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized cross product
-dvec4 ijkVecCrossResizeSafe4d(dvec4 const v_lh, dvec4 const v_rh, double const length);
+ijk_inl dvec4 ijkVecCrossResizeSafe4d(dvec4 const v_lh, dvec4 const v_rh, double const length);
 
 // ijkVecNearest4*
 //	Nearest-neighbor interpolation between two reference values.
@@ -6445,7 +6445,7 @@ dvec4 ijkVecCrossResizeSafe4d(dvec4 const v_lh, dvec4 const v_rh, double const l
 //		param v1: terminal reference value/end point, result when t>=0.5
 //		param u: interpolation parameter
 //		return: nearest-neighbor interpolated vector, exactly v0 or v1
-dvec4 ijkVecNearest4d(dvec4 const v0, dvec4 const v1, double const u);
+ijk_inl dvec4 ijkVecNearest4d(dvec4 const v0, dvec4 const v1, double const u);
 
 // ijkVecBinearest4*
 //	Nearest-neighbor interpolation of nearest-neighbor interpolated values.
@@ -6461,7 +6461,7 @@ dvec4 ijkVecNearest4d(dvec4 const v0, dvec4 const v1, double const u);
 //		param u1: interpolation parameter for second pair
 //		param u: interpolation parameter for results
 //		return: bi-nearest-neighbor interpolated vector
-dvec4 ijkVecBinearest4d(dvec4 const v00, dvec4 const v01, dvec4 const v10, dvec4 const v11, double const u0, double const u1, double const u);
+ijk_inl dvec4 ijkVecBinearest4d(dvec4 const v00, dvec4 const v01, dvec4 const v10, dvec4 const v11, double const u0, double const u1, double const u);
 
 // ijkVecRemap4*
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -6475,14 +6475,14 @@ dvec4 ijkVecBinearest4d(dvec4 const v00, dvec4 const v01, dvec4 const v10, dvec4
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: vector in original range remapped to target range
-dvec4 ijkVecRemap4d(dvec4 const v0_dst, dvec4 const v1_dst, dvec4 const v0_src, dvec4 const v1_src, dvec4 const v_src);
+ijk_inl dvec4 ijkVecRemap4d(dvec4 const v0_dst, dvec4 const v1_dst, dvec4 const v0_src, dvec4 const v1_src, dvec4 const v_src);
 
 // ijkVecBezier0O4*
 //	Perform order-0 (point) Bezier interpolation given one reference value.
 //		param v0: reference value, always returned
 //		param u: interpolation parameter; not used for order 0 interpolation
 //		return: v0
-dvec4 ijkVecBezier0O4d(dvec4 const v0, double const u);
+ijk_inl dvec4 ijkVecBezier0O4d(dvec4 const v0, double const u);
 
 // ijkVecBezier1O4*
 //	Perform order-1 (linear) Bezier interpolation given two reference values.
@@ -6491,7 +6491,7 @@ dvec4 ijkVecBezier0O4d(dvec4 const v0, double const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: linear interpolation between v0 and v1
-dvec4 ijkVecBezier1O4d(dvec4 const v0, dvec4 const v1, double const u);
+ijk_inl dvec4 ijkVecBezier1O4d(dvec4 const v0, dvec4 const v1, double const u);
 
 // ijkVecBezier2O4*
 //	Perform order-2 (quadratic) Bezier interpolation given three reference 
@@ -6502,7 +6502,7 @@ dvec4 ijkVecBezier1O4d(dvec4 const v0, dvec4 const v1, double const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v2
 //		return: quadratic Bezier interpolation between v0 and v2
-dvec4 ijkVecBezier2O4d(dvec4 const v0, dvec4 const v1, dvec4 const v2, double const u);
+ijk_inl dvec4 ijkVecBezier2O4d(dvec4 const v0, dvec4 const v1, dvec4 const v2, double const u);
 
 // ijkVecBezier3O4*
 //	Perform order-3 (cubic) Bezier interpolation given four reference values.
@@ -6513,7 +6513,7 @@ dvec4 ijkVecBezier2O4d(dvec4 const v0, dvec4 const v1, dvec4 const v2, double co
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v3
 //		return: cubic Bezier interpolation between v0 and v3
-dvec4 ijkVecBezier3O4d(dvec4 const v0, dvec4 const v1, dvec4 const v2, dvec4 const v3, double const u);
+ijk_inl dvec4 ijkVecBezier3O4d(dvec4 const v0, dvec4 const v1, dvec4 const v2, dvec4 const v3, double const u);
 
 // ijkVecBezierNO4*
 //	Perform order-N (recursive) Bezier interpolation given an array of 
@@ -6526,7 +6526,7 @@ dvec4 ijkVecBezier3O4d(dvec4 const v0, dvec4 const v1, dvec4 const v2, dvec4 con
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v[0] and v[order]
 //		return: recursive Bezier interpolation between v[0] and v[order]
-dvec4 ijkVecBezierNO4d(dvec4 const v[], size const order, double const u);
+ijk_inl dvec4 ijkVecBezierNO4d(dvec4 const v[], size const order, double const u);
 
 // ijkVecCubicHermite4*
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -6538,7 +6538,7 @@ dvec4 ijkVecBezierNO4d(dvec4 const v[], size const order, double const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-dvec4 ijkVecCubicHermite4d(dvec4 const v0, dvec4 const dv0, dvec4 const v1, dvec4 const dv1, double const u);
+ijk_inl dvec4 ijkVecCubicHermite4d(dvec4 const v0, dvec4 const dv0, dvec4 const v1, dvec4 const dv1, double const u);
 
 // ijkVecCubicHermiteHandles4*
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -6552,7 +6552,7 @@ dvec4 ijkVecCubicHermite4d(dvec4 const v0, dvec4 const dv0, dvec4 const v1, dvec
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-dvec4 ijkVecCubicHermiteHandles4d(dvec4 const v0, dvec4 const cv0, dvec4 const v1, dvec4 const cv1, double const u);
+ijk_inl dvec4 ijkVecCubicHermiteHandles4d(dvec4 const v0, dvec4 const cv0, dvec4 const v1, dvec4 const cv1, double const u);
 
 // ijkVecCubicCatmullRom4*
 //	Catmull-Rom spline/curve interpolation between two reference values with 
@@ -6564,7 +6564,7 @@ dvec4 ijkVecCubicHermiteHandles4d(dvec4 const v0, dvec4 const cv0, dvec4 const v
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-dvec4 ijkVecCubicCatmullRom4d(dvec4 const vp, dvec4 const v0, dvec4 const v1, dvec4 const v2, double const u);
+ijk_inl dvec4 ijkVecCubicCatmullRom4d(dvec4 const vp, dvec4 const v0, dvec4 const v1, dvec4 const v2, double const u);
 
 // ijkVecBicubicCatmullRom4*
 //	Bi-cubic interpolation using Catmull-Rom interpolation for segments.
@@ -6598,7 +6598,7 @@ dvec4 ijkVecCubicCatmullRom4d(dvec4 const vp, dvec4 const v0, dvec4 const v1, dv
 //		param u2: interpolation parameter for terminal control curve
 //		param u: interpolation parameter for result
 //		return: interpolated vector
-dvec4 ijkVecBicubicCatmullRom4d(dvec4 const vpp, dvec4 const vp0, dvec4 const vp1, dvec4 const vp2, dvec4 const v0p, dvec4 const v00, dvec4 const v01, dvec4 const v02, dvec4 const v1p, dvec4 const v10, dvec4 const v11, dvec4 const v12, dvec4 const v2p, dvec4 const v20, dvec4 const v21, dvec4 const v22, double const up, double const u0, double const u1, double const u2, double const u);
+ijk_inl dvec4 ijkVecBicubicCatmullRom4d(dvec4 const vpp, dvec4 const vp0, dvec4 const vp1, dvec4 const vp2, dvec4 const v0p, dvec4 const v00, dvec4 const v01, dvec4 const v02, dvec4 const v1p, dvec4 const v10, dvec4 const v11, dvec4 const v12, dvec4 const v2p, dvec4 const v20, dvec4 const v21, dvec4 const v22, double const up, double const u0, double const u1, double const u2, double const u);
 
 // ijkVecReparamCubicHermite4*
 //	Reparameterize a cubic Hermite segment into sample table.
@@ -6618,7 +6618,7 @@ dvec4 ijkVecBicubicCatmullRom4d(dvec4 const vpp, dvec4 const vp0, dvec4 const vp
 //		param v1: terminal reference value/end point, result when t=1
 //		param dv1: terminal tangent/rate of change
 //		return: total arc length
-double ijkVecReparamCubicHermite4d(double uTable_out[], double lTable_out[], dvec4 vTable_out[], size const numDivisions, ibool const lNormalize, dvec4 const v0, dvec4 const dv0, dvec4 const v1, dvec4 const dv1);
+ijk_inl double ijkVecReparamCubicHermite4d(double uTable_out[], double lTable_out[], dvec4 vTable_out[], size const numDivisions, ibool const lNormalize, dvec4 const v0, dvec4 const dv0, dvec4 const v1, dvec4 const dv1);
 
 // ijkVecReparamCubicHermiteHandles4*
 //	Reparameterize a cubic Hermite segment with handles into sample table.
@@ -6640,7 +6640,7 @@ double ijkVecReparamCubicHermite4d(double uTable_out[], double lTable_out[], dve
 //		param cv1: terminal control handle value, should be greater than v1 
 //			for a positive rate of change
 //		return: total arc length
-double ijkVecReparamCubicHermiteHandles4d(double uTable_out[], double lTable_out[], dvec4 vTable_out[], size const numDivisions, ibool const lNormalize, dvec4 const v0, dvec4 const cv0, dvec4 const v1, dvec4 const cv1);
+ijk_inl double ijkVecReparamCubicHermiteHandles4d(double uTable_out[], double lTable_out[], dvec4 vTable_out[], size const numDivisions, ibool const lNormalize, dvec4 const v0, dvec4 const cv0, dvec4 const v1, dvec4 const cv1);
 
 // ijkVecReparamCubicCatmullRom4*
 //	Reparameterize a cubic Catmull-Rom segment into sample table.
@@ -6660,7 +6660,7 @@ double ijkVecReparamCubicHermiteHandles4d(double uTable_out[], double lTable_out
 //		param v1: terminal reference value/end point, result when t=1
 //		param v2: terminal control value
 //		return: total arc length
-double ijkVecReparamCubicCatmullRom4d(double uTable_out[], double lTable_out[], dvec4 vTable_out[], size const numDivisions, ibool const lNormalize, dvec4 const vp, dvec4 const v0, dvec4 const v1, dvec4 const v2);
+ijk_inl double ijkVecReparamCubicCatmullRom4d(double uTable_out[], double lTable_out[], dvec4 vTable_out[], size const numDivisions, ibool const lNormalize, dvec4 const vp, dvec4 const v0, dvec4 const v1, dvec4 const v2);
 
 // ijkVecReparamBicubicCatmullRom4*
 //	Reparameterize a bi-cubic Catmull-Rom segment into sample table.
@@ -6704,7 +6704,7 @@ double ijkVecReparamCubicCatmullRom4d(double uTable_out[], double lTable_out[],
 //		param u1: interpolation parameter for terminal value curve
 //		param u2: interpolation parameter for terminal control curve
 //		return: total arc length
-double ijkVecReparamBicubicCatmullRom4d(double uTable_out[], double lTable_out[], dvec4 vTable_out[], size const numDivisions, ibool const lNormalize, dvec4 const vpp, dvec4 const vp0, dvec4 const vp1, dvec4 const vp2, dvec4 const v0p, dvec4 const v00, dvec4 const v01, dvec4 const v02, dvec4 const v1p, dvec4 const v10, dvec4 const v11, dvec4 const v12, dvec4 const v2p, dvec4 const v20, dvec4 const v21, dvec4 const v22, double const up, double const u0, double const u1, double const u2);
+ijk_inl double ijkVecReparamBicubicCatmullRom4d(double uTable_out[], double lTable_out[], dvec4 vTable_out[], size const numDivisions, ibool const lNormalize, dvec4 const vpp, dvec4 const vp0, dvec4 const vp1, dvec4 const vp2, dvec4 const v0p, dvec4 const v00, dvec4 const v01, dvec4 const v02, dvec4 const v1p, dvec4 const v10, dvec4 const v11, dvec4 const v12, dvec4 const v2p, dvec4 const v20, dvec4 const v21, dvec4 const v22, double const up, double const u0, double const u1, double const u2);
 
 // ijkVecSampleTableInc4*
 //	Find index of parameter in table and approximate value by interpolating 
@@ -6721,7 +6721,7 @@ double ijkVecReparamBicubicCatmullRom4d(double uTable_out[], double lTable_out[]
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: interpolated vector in table that approximates input parameter
-dvec4 ijkVecSampleTableInc4d(double const uTable[], dvec4 const vTable[], index i, index di, double const u);
+ijk_inl dvec4 ijkVecSampleTableInc4d(double const uTable[], dvec4 const vTable[], index i, index di, double const u);
 
 // ijkVecSampleTableDec4*
 //	Find index of parameter in table and approximate value by interpolating 
@@ -6738,7 +6738,7 @@ dvec4 ijkVecSampleTableInc4d(double const uTable[], dvec4 const vTable[], index
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: interpolated vector in table that approximates input parameter
-dvec4 ijkVecSampleTableDec4d(double const uTable[], dvec4 const vTable[], index i, index di, double const u);
+ijk_inl dvec4 ijkVecSampleTableDec4d(double const uTable[], dvec4 const vTable[], index i, index di, double const u);
 
 
 //-----------------------------------------------------------------------------
@@ -6755,91 +6755,91 @@ extern "C" {
 //	Compress decimal scalar into a single byte (8 bits).
 //		param v_in: symmetric-unit scalar to compress, in [-1,+1]
 //		return: byte encoding scalar
-i8 ijkVecPack1db(f64 const v_in);
+ijk_inl i8 ijkVecPack1db(f64 const v_in);
 
 // ijkVecUnpack1*b
 //	Decompress decimal scalar from a single byte (8 bits).
 //		param i_in: integer encoding scalar to decompress
 //		return: decoded scalar
-f64 ijkVecUnpack1db(i8 const i_in);
+ijk_inl f64 ijkVecUnpack1db(i8 const i_in);
 
 // ijkVecPack1*s
 //	Compress decimal scalar into a short integer (16 bits).
 //		param v_in: symmetric-unit scalar to compress, in [-1,+1]
 //		return: short integer encoding scalar
-i16 ijkVecPack1ds(f64 const v_in);
+ijk_inl i16 ijkVecPack1ds(f64 const v_in);
 
 // ijkVecUnpack1*s
 //	Decompress decimal scalar from a short integer (16 bits).
 //		param i_in: integer encoding scalar to decompress
 //		return: decoded scalar
-f64 ijkVecUnpack1ds(i16 const i_in);
+ijk_inl f64 ijkVecUnpack1ds(i16 const i_in);
 
 // ijkVecPack2*vs
 //	Compress 2D vector into a short integer (16 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i16 ijkVecPack2dvs(double2 const v_in);
+ijk_inl i16 ijkVecPack2dvs(double2 const v_in);
 
 // ijkVecUnpack2*vs
 //	Decompress 2D vector from a short integer (16 bits).
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-doublev ijkVecUnpack2dvs(double2 v_out, i16 const i_in);
+ijk_inl doublev ijkVecUnpack2dvs(double2 v_out, i16 const i_in);
 
 // ijkVecPack2*vl
 //	Compress 2D vector into a long integer (32 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPack2dvl(double2 const v_in);
+ijk_inl i32 ijkVecPack2dvl(double2 const v_in);
 
 // ijkVecUnpack2*vl
 //	Decompress 2D vector from a long integer (32 bits).
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-doublev ijkVecUnpack2dvl(double2 v_out, i32 const i_in);
+ijk_inl doublev ijkVecUnpack2dvl(double2 v_out, i32 const i_in);
 
 // ijkVecPack3*vl
 //	Compress 3D vector into a long integer (32 bits); components are encoded 
 //	into 10 bits each.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPack3dvl(double3 const v_in);
+ijk_inl i32 ijkVecPack3dvl(double3 const v_in);
 
 // ijkVecUnpack3*vl
 //	Decompress 3D vector from a long integer (32 bits).
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-doublev ijkVecUnpack3dvl(double3 v_out, i32 const i_in);
+ijk_inl doublev ijkVecUnpack3dvl(double3 v_out, i32 const i_in);
 
 // ijkVecPack4*vl
 //	Compress 4D vector into a long integer (32 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPack4dvl(double4 const v_in);
+ijk_inl i32 ijkVecPack4dvl(double4 const v_in);
 
 // ijkVecUnpack4*vl
 //	Decompress 4D vector from a long integer (32 bits).
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-doublev ijkVecUnpack4dvl(double4 v_out, i32 const i_in);
+ijk_inl doublev ijkVecUnpack4dvl(double4 v_out, i32 const i_in);
 
 // ijkVecPack4*vll
 //	Compress 4D vector into a long-long integer (64 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i64 ijkVecPack4dvll(double4 const v_in);
+ijk_inl i64 ijkVecPack4dvll(double4 const v_in);
 
 // ijkVecUnpack4*vll
 //	Decompress 4D vector from a long-long integer (64 bits).
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-doublev ijkVecUnpack4dvll(double4 v_out, i64 const i_in);
+ijk_inl doublev ijkVecUnpack4dvll(double4 v_out, i64 const i_in);
 
 // ijkVecPackUnitXYZ4*vl
 //	Compress three components of 4D unit vector into a long integer (32 bits); 
@@ -6847,7 +6847,7 @@ doublev ijkVecUnpack4dvll(double4 v_out, i64 const i_in);
 //	specifies the sign of the fourth element.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPackUnitXYZ4dvl(double4 const v_in);
+ijk_inl i32 ijkVecPackUnitXYZ4dvl(double4 const v_in);
 
 // ijkVecUnpackUnitXYZ4*vl
 //	Decompress 4D unit vector from a long integer (32 bits) encoding only 
@@ -6855,7 +6855,7 @@ i32 ijkVecPackUnitXYZ4dvl(double4 const v_in);
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-doublev ijkVecUnpackUnitXYZ4dvl(double4 v_out, i32 const i_in);
+ijk_inl doublev ijkVecUnpackUnitXYZ4dvl(double4 v_out, i32 const i_in);
 
 // ijkVecPackUnit3of4*vl
 //	Compress three components of 4D unit vector into a long integer (32 bits); 
@@ -6865,7 +6865,7 @@ doublev ijkVecUnpackUnitXYZ4dvl(double4 v_out, i32 const i_in);
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		param excl: index of excluded element, in [0,3]
 //		return: short integer encoding vector
-i32 ijkVecPackUnit3of4dvl(double4 const v_in, ui32 const excl);
+ijk_inl i32 ijkVecPackUnit3of4dvl(double4 const v_in, ui32 const excl);
 
 // ijkVecUnpackUnit3of4*vl
 //	Decompress 4D unit vector from a long integer (32 bits) encoding only 
@@ -6874,7 +6874,7 @@ i32 ijkVecPackUnit3of4dvl(double4 const v_in, ui32 const excl);
 //		param i_in: integer encoding vector to decompress
 //		param excl_out: pointer to storage for index of excluded element
 //		return: v_out
-doublev ijkVecUnpackUnit3of4dvl(double4 v_out, i32 const i_in, ui32* const excl_out);
+ijk_inl doublev ijkVecUnpackUnit3of4dvl(double4 v_out, i32 const i_in, ui32* const excl_out);
 
 // ijkVecPackQuant4*l
 //	Compress three components of 4D quantized unit vector into a long integer 
@@ -6885,7 +6885,7 @@ doublev ijkVecUnpackUnit3of4dvl(double4 v_out, i32 const i_in, ui32* const excl_
 //	component is negative, the entire vector is negated to make it positive.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPackQuant4dvl(double4 const v_in);
+ijk_inl i32 ijkVecPackQuant4dvl(double4 const v_in);
 
 // ijkVecUnpackQuant4*l
 //	Decompress 4D quantized unit vector from a long integer (32 bits) 
@@ -6893,7 +6893,7 @@ i32 ijkVecPackQuant4dvl(double4 const v_in);
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-doublev ijkVecUnpackQuant4dvl(double4 v_out, i32 const i_in);
+ijk_inl doublev ijkVecUnpackQuant4dvl(double4 v_out, i32 const i_in);
 
 // ijkVecPackUnitXYZ4*vll
 //	Compress three components of 4D unit vector into a long-long integer 
@@ -6901,7 +6901,7 @@ doublev ijkVecUnpackQuant4dvl(double4 v_out, i32 const i_in);
 //	bit specifies the sign of the excluded element.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i64 ijkVecPackUnitXYZ4dvll(double4 const v_in);
+ijk_inl i64 ijkVecPackUnitXYZ4dvll(double4 const v_in);
 
 // ijkVecUnpackUnitXYZ4*vll
 //	Decompress 4D unit vector from a long-long integer (64 bits) encoding 
@@ -6909,7 +6909,7 @@ i64 ijkVecPackUnitXYZ4dvll(double4 const v_in);
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-doublev ijkVecUnpackUnitXYZ4dvll(double4 v_out, i64 const i_in);
+ijk_inl doublev ijkVecUnpackUnitXYZ4dvll(double4 v_out, i64 const i_in);
 
 // ijkVecPackUnit3of4*vll
 //	Compress three components of 4D unit vector into a long-long integer 
@@ -6918,7 +6918,7 @@ doublev ijkVecUnpackUnitXYZ4dvll(double4 v_out, i64 const i_in);
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		param excl: index of excluded element, in [0,3]
 //		return: short integer encoding vector
-i64 ijkVecPackUnit3of4dvll(double4 const v_in, ui64 const excl);
+ijk_inl i64 ijkVecPackUnit3of4dvll(double4 const v_in, ui64 const excl);
 
 // ijkVecUnpackUnit3of4*vll
 //	Decompress 4D unit vector from a long-long integer (64 bits) encoding 
@@ -6927,7 +6927,7 @@ i64 ijkVecPackUnit3of4dvll(double4 const v_in, ui64 const excl);
 //		param i_in: integer encoding vector to decompress
 //		param excl_out: pointer to storage for index of excluded element
 //		return: v_out
-doublev ijkVecUnpackUnit3of4dvll(double4 v_out, i64 const i_in, ui64* const excl_out);
+ijk_inl doublev ijkVecUnpackUnit3of4dvll(double4 v_out, i64 const i_in, ui64* const excl_out);
 
 // ijkVecPackQuant4*vll
 //	Compress three components of 4D quantized unit vector into the 48 MOST 
@@ -6938,7 +6938,7 @@ doublev ijkVecUnpackUnit3of4dvll(double4 v_out, i64 const i_in, ui64* const excl
 //	for better precision when decoded.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i64 ijkVecPackQuant4dvll(double4 const v_in);
+ijk_inl i64 ijkVecPackQuant4dvll(double4 const v_in);
 
 // ijkVecUnpackQuant4*vll
 //	Decompress 4D quantized unit vector from a long-long integer (64 bits) 
@@ -6947,7 +6947,7 @@ i64 ijkVecPackQuant4dvll(double4 const v_in);
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-doublev ijkVecUnpackQuant4dvll(double4 v_out, i64 const i_in);
+ijk_inl doublev ijkVecUnpackQuant4dvll(double4 v_out, i64 const i_in);
 
 
 //-----------------------------------------------------------------------------
@@ -6964,62 +6964,62 @@ doublev ijkVecUnpackQuant4dvll(double4 v_out, i64 const i_in);
 //	Compress 2D vector into a short integer (16 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i16 ijkVecPack2ds(dvec2 const v_in);
+ijk_inl i16 ijkVecPack2ds(dvec2 const v_in);
 
 // ijkVecUnpack2*s
 //	Decompress 2D vector from a short integer (16 bits).
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-dvec2 ijkVecUnpack2ds(i16 const i_in);
+ijk_inl dvec2 ijkVecUnpack2ds(i16 const i_in);
 
 // ijkVecPack2*l
 //	Compress 2D vector into a long integer (32 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPack2dl(dvec2 const v_in);
+ijk_inl i32 ijkVecPack2dl(dvec2 const v_in);
 
 // ijkVecUnpack2*l
 //	Decompress 2D vector from a long integer (32 bits).
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-dvec2 ijkVecUnpack2dl(i32 const i_in);
+ijk_inl dvec2 ijkVecUnpack2dl(i32 const i_in);
 
 // ijkVecPack3*l
 //	Compress 3D vector into a long integer (32 bits); components are encoded 
 //	into 10 bits each.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPack3dl(dvec3 const v_in);
+ijk_inl i32 ijkVecPack3dl(dvec3 const v_in);
 
 // ijkVecUnpack3*l
 //	Decompress 3D vector from a long integer (32 bits).
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-dvec3 ijkVecUnpack3dl(i32 const i_in);
+ijk_inl dvec3 ijkVecUnpack3dl(i32 const i_in);
 
 // ijkVecPack4*l
 //	Compress 4D vector into a long integer (32 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPack4dl(dvec4 const v_in);
+ijk_inl i32 ijkVecPack4dl(dvec4 const v_in);
 
 // ijkVecUnpack4*l
 //	Decompress 4D vector from a long integer (32 bits).
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-dvec4 ijkVecUnpack4dl(i32 const i_in);
+ijk_inl dvec4 ijkVecUnpack4dl(i32 const i_in);
 
 // ijkVecPack4*ll
 //	Compress 4D vector into a long-long integer (64 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i64 ijkVecPack4dll(dvec4 const v_in);
+ijk_inl i64 ijkVecPack4dll(dvec4 const v_in);
 
 // ijkVecUnpack4*ll
 //	Decompress 4D vector from a long-long integer (64 bits).
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-dvec4 ijkVecUnpack4dll(i64 const i_in);
+ijk_inl dvec4 ijkVecUnpack4dll(i64 const i_in);
 
 // ijkVecPackUnitXYZ4*l
 //	Compress three components of 4D unit vector into a long integer (32 bits); 
@@ -7027,14 +7027,14 @@ dvec4 ijkVecUnpack4dll(i64 const i_in);
 //	specifies the sign of the fourth element.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPackUnitXYZ4dl(dvec4 const v_in);
+ijk_inl i32 ijkVecPackUnitXYZ4dl(dvec4 const v_in);
 
 // ijkVecUnpackUnitXYZ4*l
 //	Decompress 4D unit vector from a long integer (32 bits) encoding only 
 //	three components and the sign of the fourth.
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-dvec4 ijkVecUnpackUnitXYZ4dl(i32 const i_in);
+ijk_inl dvec4 ijkVecUnpackUnitXYZ4dl(i32 const i_in);
 
 // ijkVecPackUnit3of4*l
 //	Compress three components of 4D unit vector into a long integer (32 bits); 
@@ -7044,7 +7044,7 @@ dvec4 ijkVecUnpackUnitXYZ4dl(i32 const i_in);
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		param excl: index of excluded element, in [0,3]
 //		return: short integer encoding vector
-i32 ijkVecPackUnit3of4dl(dvec4 const v_in, ui32 const excl);
+ijk_inl i32 ijkVecPackUnit3of4dl(dvec4 const v_in, ui32 const excl);
 
 // ijkVecUnpackUnit3of4*l
 //	Decompress 4D unit vector from a long integer (32 bits) encoding only 
@@ -7052,7 +7052,7 @@ i32 ijkVecPackUnit3of4dl(dvec4 const v_in, ui32 const excl);
 //		param i_in: integer encoding vector to decompress
 //		param excl_out: pointer to storage for index of excluded element
 //		return: decoded vector
-dvec4 ijkVecUnpackUnit3of4dl(i32 const i_in, ui32* const excl_out);
+ijk_inl dvec4 ijkVecUnpackUnit3of4dl(i32 const i_in, ui32* const excl_out);
 
 // ijkVecPackQuant4*l
 //	Compress three components of 4D quantized unit vector into a long integer 
@@ -7063,14 +7063,14 @@ dvec4 ijkVecUnpackUnit3of4dl(i32 const i_in, ui32* const excl_out);
 //	component is negative, the entire vector is negated to make it positive.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPackQuant4dl(dvec4 const v_in);
+ijk_inl i32 ijkVecPackQuant4dl(dvec4 const v_in);
 
 // ijkVecUnpackQuant4*l
 //	Decompress 4D quantized unit vector from a long integer (32 bits) 
 //	encoding only three components and the index of the fourth.
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-dvec4 ijkVecUnpackQuant4dl(i32 const i_in);
+ijk_inl dvec4 ijkVecUnpackQuant4dl(i32 const i_in);
 
 // ijkVecPackUnitXYZ4*ll
 //	Compress three components of 4D unit vector into a long-long integer 
@@ -7078,14 +7078,14 @@ dvec4 ijkVecUnpackQuant4dl(i32 const i_in);
 //	bit specifies the sign of the excluded element.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i64 ijkVecPackUnitXYZ4dll(dvec4 const v_in);
+ijk_inl i64 ijkVecPackUnitXYZ4dll(dvec4 const v_in);
 
 // ijkVecUnpackUnitXYZ4*ll
 //	Decompress 4D unit vector from a long-long integer (64 bits) encoding 
 //	only three components and the sign of the fourth.
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-dvec4 ijkVecUnpackUnitXYZ4dll(i64 const i_in);
+ijk_inl dvec4 ijkVecUnpackUnitXYZ4dll(i64 const i_in);
 
 // ijkVecPackUnit3of4*ll
 //	Compress three components of 4D unit vector into a long-long integer 
@@ -7094,7 +7094,7 @@ dvec4 ijkVecUnpackUnitXYZ4dll(i64 const i_in);
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		param excl: index of excluded element, in [0,3]
 //		return: short integer encoding vector
-i64 ijkVecPackUnit3of4dll(dvec4 const v_in, ui64 const excl);
+ijk_inl i64 ijkVecPackUnit3of4dll(dvec4 const v_in, ui64 const excl);
 
 // ijkVecUnpackUnit3of4*ll
 //	Decompress 4D unit vector from a long-long integer (64 bits) encoding 
@@ -7102,7 +7102,7 @@ i64 ijkVecPackUnit3of4dll(dvec4 const v_in, ui64 const excl);
 //		param i_in: integer encoding vector to decompress
 //		param excl_out: pointer to storage for index of excluded element
 //		return: decoded vector
-dvec4 ijkVecUnpackUnit3of4dll(i64 const i_in, ui64* const excl_out);
+ijk_inl dvec4 ijkVecUnpackUnit3of4dll(i64 const i_in, ui64* const excl_out);
 
 // ijkVecPackQuant4*ll
 //	Compress three components of 4D quantized unit vector into the 48 MOST 
@@ -7113,7 +7113,7 @@ dvec4 ijkVecUnpackUnit3of4dll(i64 const i_in, ui64* const excl_out);
 //	for better precision when decoded.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i64 ijkVecPackQuant4dll(dvec4 const v_in);
+ijk_inl i64 ijkVecPackQuant4dll(dvec4 const v_in);
 
 // ijkVecUnpackQuant4*ll
 //	Decompress 4D quantized unit vector from a long-long integer (64 bits) 
@@ -7121,7 +7121,7 @@ i64 ijkVecPackQuant4dll(dvec4 const v_in);
 //	decoded elements are stored in the 48 MOST significant bits.
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-dvec4 ijkVecUnpackQuant4dll(i64 const i_in);
+ijk_inl dvec4 ijkVecUnpackQuant4dll(i64 const i_in);
 
 
 //-----------------------------------------------------------------------------
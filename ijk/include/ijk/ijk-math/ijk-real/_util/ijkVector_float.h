@@ -38,50 +38,50 @@ extern "C" {
 //	Absolute value of scalar: (s >= 0 ? +s : -s).
 //		param s: scalar
 //		return: absolute value
-f32 ijkVecAbs1fs(f32 const s);
+ijk_inl f32 ijkVecAbs1fs(f32 const s);
 
 // ijkVecSgn1*s
 //	Sign of scalar: (s != 0 ? s > 0 ? +1 : -1).
 //		param s: scalar
 //		return: sign
-f32 ijkVecSgn1fs(f32 const s);
+ijk_inl f32 ijkVecSgn1fs(f32 const s);
 
 // ijkVecDot1*s
 //	Dot product of scalars, which is just their product.
 //		param s_lh: left-hand scalar
 //		param s_rh: right-hand scalar
 //		return: product
-f32 ijkVecDot1fs(f32 const s_lh, f32 const s_rh);
+ijk_inl f32 ijkVecDot1fs(f32 const s_lh, f32 const s_rh);
 
 // ijkVecLengthSq1*s
 //	Squared length of scalar.
 //		param s: scalar
 //		return: squared length
-f32 ijkVecLengthSq1fs(f32 const s);
+ijk_inl f32 ijkVecLengthSq1fs(f32 const s);
 
 // ijkVecLength1*s
 //	Length of scalar.
 //		param s: scalar
 //		return: length
-f32 ijkVecLength1fs(f32 const s);
+ijk_inl f32 ijkVecLength1fs(f32 const s);
 
 // ijkVecLengthSqInv1*s
 //	Inverse squared length of scalar.
 //		param s: scalar
 //		return: inverse squared length
-f32 ijkVecLengthSqInv1fs(f32 const s);
+ijk_inl f32 ijkVecLengthSqInv1fs(f32 const s);
 
 // ijkVecLengthSqInv1*s
 //	Inverse length of scalar.
 //		param s: scalar
 //		return: inverse length
-f32 ijkVecLengthInv1fs(f32 const s);
+ijk_inl f32 ijkVecLengthInv1fs(f32 const s);
 
 // ijkVecNormalize1*s
 //	Calculate unit scalar in same direction as input (sign).
 //		param s: scalar
 //		return: unit scalar (sign)
-f32 ijkVecNormalize1fs(f32 const s);
+ijk_inl f32 ijkVecNormalize1fs(f32 const s);
 
 // ijkVecNormalizeGetLength1*s
 //	Calculate unit scalar in same direction as input (sign).
@@ -89,7 +89,7 @@ f32 ijkVecNormalize1fs(f32 const s);
 //		param s: scalar
 //		param length_out: pointer to length storage
 //		return: unit scalar (sign)
-f32 ijkVecNormalizeGetLength1fs(f32 const s, f32* const length_out);
+ijk_inl f32 ijkVecNormalizeGetLength1fs(f32 const s, f32* const length_out);
 
 // ijkVecNormalizeGetLengthInv1*s
 //	Calculate unit scalar in same direction as input (sign).
@@ -97,7 +97,7 @@ f32 ijkVecNormalizeGetLength1fs(f32 const s, f32* const length_out);
 //		param s: scalar
 //		param lengthInv_out: pointer to length storage
 //		return: unit scalar (sign)
-f32 ijkVecNormalizeGetLengthInv1fs(f32 const s, f32* const lengthInv_out);
+ijk_inl f32 ijkVecNormalizeGetLengthInv1fs(f32 const s, f32* const lengthInv_out);
 
 
 //-----------------------------------------------------------------------------
@@ -106,7 +106,7 @@ f32 ijkVecNormalizeGetLengthInv1fs(f32 const s, f32* const lengthInv_out);
 //	Pass-thru array-based vector function (does nothing).
 //		param v_out: output vector
 //		return: v_out
-floatv ijkVecPfv(floatv v_out);
+ijk_inl floatv ijkVecPfv(floatv v_out);
 
 
 //-----------------------------------------------------------------------------
@@ -115,7 +115,7 @@ floatv ijkVecPfv(floatv v_out);
 //	Initialize 2D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-floatv ijkVecInit2fv(float2 v_out);
+ijk_inl floatv ijkVecInit2fv(float2 v_out);
 
 // ijkVecInitElems2*v
 //	Initialize 2D vector to specified individual elements.
@@ -123,28 +123,28 @@ floatv ijkVecInit2fv(float2 v_out);
 //		param x: first element
 //		param y: second element
 //		return: v_out
-floatv ijkVecInitElems2fv(float2 v_out, f32 const x, f32 const y);
+ijk_inl floatv ijkVecInitElems2fv(float2 v_out, f32 const x, f32 const y);
 
 // ijkVecCopy2*v
 //	Copy 2D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-floatv ijkVecCopy2fv(float2 v_out, float2 const v_in);
+ijk_inl floatv ijkVecCopy2fv(float2 v_out, float2 const v_in);
 
 // ijkVecNegate2*v
 //	Negate 2D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-floatv ijkVecNegate2fv(float2 v_out, float2 const v_in);
+ijk_inl floatv ijkVecNegate2fv(float2 v_out, float2 const v_in);
 
 // ijkVecNot2*v
 //	Calculate component-wise logical 'not' of 2D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot2fv(bool2 bv_out, float2 const v_in);
+ijk_inl boolv ijkVecNot2fv(bool2 bv_out, float2 const v_in);
 
 // ijkVecAdd2*v
 //	Calculate sum of 2D vectors.
@@ -152,7 +152,7 @@ boolv ijkVecNot2fv(bool2 bv_out, float2 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecAdd2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
+ijk_inl floatv ijkVecAdd2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecSub2*v
 //	Calculate difference of 2D vectors.
@@ -160,7 +160,7 @@ floatv ijkVecAdd2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecSub2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
+ijk_inl floatv ijkVecSub2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecMul2*v
 //	Calculate component-wise product of 2D vectors.
@@ -168,7 +168,7 @@ floatv ijkVecSub2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecMul2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
+ijk_inl floatv ijkVecMul2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecDiv2*v
 //	Calculate component-wise quotient of 2D vectors.
@@ -176,7 +176,7 @@ floatv ijkVecMul2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecDiv2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
+ijk_inl floatv ijkVecDiv2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecDivSafe2*v
 //	Calculate component-wise quotient of 2D vectors, division-by-zero safe.
@@ -184,7 +184,7 @@ floatv ijkVecDiv2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecDivSafe2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
+ijk_inl floatv ijkVecDivSafe2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecMod2*v
 //	Calculate component-wise remainder of 2D vectors.
@@ -192,7 +192,7 @@ floatv ijkVecDivSafe2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecMod2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
+ijk_inl floatv ijkVecMod2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecModSafe2*v
 //	Calculate component-wise remainder of 2D vectors, division-by-zero safe.
@@ -200,7 +200,7 @@ floatv ijkVecMod2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecModSafe2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
+ijk_inl floatv ijkVecModSafe2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecEqual2*v
 //	Equality comparison for 2D vectors.
@@ -208,7 +208,7 @@ floatv ijkVecModSafe2fv(float2 v_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
+ijk_inl boolv ijkVecEqual2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecInequal2*v
 //	Inequality comparison for 2D vectors.
@@ -216,7 +216,7 @@ boolv ijkVecEqual2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
+ijk_inl boolv ijkVecInequal2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecLessEqual2*v
 //	Less-than or equal comparison for 2D vectors.
@@ -224,7 +224,7 @@ boolv ijkVecInequal2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
+ijk_inl boolv ijkVecLessEqual2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecGreaterEqual2*v
 //	Greater-than or equal comparison for 2D vectors.
@@ -232,7 +232,7 @@ boolv ijkVecLessEqual2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecLess2*v
 //	Less-than comparison for 2D vectors.
@@ -240,7 +240,7 @@ boolv ijkVecGreaterEqual2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
+ijk_inl boolv ijkVecLess2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecGreater2*v
 //	Greater-than comparison for 2D vectors.
@@ -248,7 +248,7 @@ boolv ijkVecLess2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
+ijk_inl boolv ijkVecGreater2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecAnd2*v
 //	Component-wise logical 'and' of 2D vectors.
@@ -256,7 +256,7 @@ boolv ijkVecGreater2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
+ijk_inl boolv ijkVecAnd2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecNand2*v
 //	Component-wise logical 'nand' of 2D vectors.
@@ -264,7 +264,7 @@ boolv ijkVecAnd2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
+ijk_inl boolv ijkVecNand2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecOr2*v
 //	Component-wise logical 'or' of 2D vectors.
@@ -272,7 +272,7 @@ boolv ijkVecNand2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
+ijk_inl boolv ijkVecOr2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecNor2*v
 //	Component-wise logical 'nor' of 2D vectors.
@@ -280,28 +280,28 @@ boolv ijkVecOr2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
+ijk_inl boolv ijkVecNor2fv(bool2 bv_out, float2 const v_lh, float2 const v_rh);
 
 // ijkVecCopy2*vs
 //	Copy 2D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-floatv ijkVecCopy2fvs(float2 v_out, f32 const s_in);
+ijk_inl floatv ijkVecCopy2fvs(float2 v_out, f32 const s_in);
 
 // ijkVecNegate2*vs
 //	Negate scalar to 2D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-floatv ijkVecNegate2fvs(float2 v_out, f32 const s_in);
+ijk_inl floatv ijkVecNegate2fvs(float2 v_out, f32 const s_in);
 
 // ijkVecNot2*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot2fvs(bool2 bv_out, f32 const s_in);
+ijk_inl boolv ijkVecNot2fvs(bool2 bv_out, f32 const s_in);
 
 // ijkVecAdd2*vs
 //	Calculate sum of 2D vector components and scalar.
@@ -309,7 +309,7 @@ boolv ijkVecNot2fvs(bool2 bv_out, f32 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecAdd2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecAdd2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecSub2*vs
 //	Calculate difference of 2D vector components and scalar.
@@ -317,7 +317,7 @@ floatv ijkVecAdd2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecSub2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecSub2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecMul2*vs
 //	Calculate product of 2D vector components by scalar.
@@ -325,7 +325,7 @@ floatv ijkVecSub2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecMul2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecMul2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecDiv2*vs
 //	Calculate quotient of 2D vector components by scalar.
@@ -333,7 +333,7 @@ floatv ijkVecMul2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecDiv2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecDiv2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecDivSafe2*vs
 //	Calculate quotient of 2D vector components by scalar, division-by-zero safe.
@@ -341,7 +341,7 @@ floatv ijkVecDiv2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecDivSafe2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecDivSafe2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecMod2*vs
 //	Calculate remainder of 2D vector components by scalar.
@@ -349,7 +349,7 @@ floatv ijkVecDivSafe2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecMod2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecMod2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecModSafe2*vs
 //	Calculate remainder of 2D vector components by scalar, division-by-zero safe.
@@ -357,7 +357,7 @@ floatv ijkVecMod2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecModSafe2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecModSafe2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecEqual2*vs
 //	Equality comparison of 2D vector components and scalar.
@@ -365,7 +365,7 @@ floatv ijkVecModSafe2fvs(float2 v_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecEqual2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecInequal2*vs
 //	Inequality comparison of 2D vector components and scalar.
@@ -373,7 +373,7 @@ boolv ijkVecEqual2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecInequal2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecLessEqual2*vs
 //	Less-than or equal comparison of 2D vector components and scalar.
@@ -381,7 +381,7 @@ boolv ijkVecInequal2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecLessEqual2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecGreaterEqual2*vs
 //	Greater-than or equal comparison of 2D vector components and scalar.
@@ -389,7 +389,7 @@ boolv ijkVecLessEqual2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecLess2*vs
 //	Less-than comparison of 2D vector components and scalar.
@@ -397,7 +397,7 @@ boolv ijkVecGreaterEqual2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecLess2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecGreater2*vs
 //	Greater-than comparison of 2D vector components and scalar.
@@ -405,7 +405,7 @@ boolv ijkVecLess2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecGreater2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecAnd2*vs
 //	Component-wise logical 'and' of 2D vector and scalar.
@@ -413,7 +413,7 @@ boolv ijkVecGreater2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecAnd2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecNand2*vs
 //	Component-wise logical 'nand' of 2D vector and scalar.
@@ -421,7 +421,7 @@ boolv ijkVecAnd2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecNand2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecOr2*vs
 //	Component-wise logical 'or' of 2D vector and scalar.
@@ -429,7 +429,7 @@ boolv ijkVecNand2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecOr2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecNor2*vs
 //	Component-wise logical 'nor' of 2D vector and scalar.
@@ -437,7 +437,7 @@ boolv ijkVecOr2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecNor2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 
 // ijkVecAdd2*sv
 //	Calculate sum of scalar and 2D vector components.
@@ -445,7 +445,7 @@ boolv ijkVecNor2fvs(bool2 bv_out, float2 const v_lh, f32 const s_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecAdd2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
+ijk_inl floatv ijkVecAdd2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecSub2*sv
 //	Calculate difference of scalar and 2D vector components.
@@ -453,7 +453,7 @@ floatv ijkVecAdd2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecSub2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
+ijk_inl floatv ijkVecSub2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecMul2*sv
 //	Calculate product of scalar by 2D vector components.
@@ -461,7 +461,7 @@ floatv ijkVecSub2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecMul2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
+ijk_inl floatv ijkVecMul2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecDiv2*sv
 //	Calculate quotient of scalar by 2D vector components.
@@ -469,7 +469,7 @@ floatv ijkVecMul2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecDiv2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
+ijk_inl floatv ijkVecDiv2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecDivSafe2*sv
 //	Calculate quotient of scalar by 2D vector components, division-by-zero safe.
@@ -477,7 +477,7 @@ floatv ijkVecDiv2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecDivSafe2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
+ijk_inl floatv ijkVecDivSafe2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecMod2*sv
 //	Calculate remainder of scalar by 2D vector components.
@@ -485,7 +485,7 @@ floatv ijkVecDivSafe2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecMod2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
+ijk_inl floatv ijkVecMod2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecModSafe2*sv
 //	Calculate remainder of scalar by 2D vector components, division-by-zero safe.
@@ -493,7 +493,7 @@ floatv ijkVecMod2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecModSafe2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
+ijk_inl floatv ijkVecModSafe2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecEqual2*sv
 //	Equality comparison of scalar and 2D vector components.
@@ -501,7 +501,7 @@ floatv ijkVecModSafe2fsv(float2 v_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
+ijk_inl boolv ijkVecEqual2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecInequal2*sv
 //	Inequality comparison of scalar and 2D vector components.
@@ -509,7 +509,7 @@ boolv ijkVecEqual2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
+ijk_inl boolv ijkVecInequal2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecLessEqual2*sv
 //	Less-than or equal comparison of scalar and 2D vector components.
@@ -517,7 +517,7 @@ boolv ijkVecInequal2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
+ijk_inl boolv ijkVecLessEqual2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecGreaterEqual2*sv
 //	Greater-than or equal comparison of scalar and 2D vector components.
@@ -525,7 +525,7 @@ boolv ijkVecLessEqual2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecLess2*sv
 //	Less-than comparison of scalar and 2D vector components.
@@ -533,7 +533,7 @@ boolv ijkVecGreaterEqual2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
+ijk_inl boolv ijkVecLess2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecGreater2*sv
 //	Greater-than comparison of scalar and 2D vector components.
@@ -541,7 +541,7 @@ boolv ijkVecLess2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
+ijk_inl boolv ijkVecGreater2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecAnd2*sv
 //	Component-wise logical 'and' of 2D vector and scalar.
@@ -549,7 +549,7 @@ boolv ijkVecGreater2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
+ijk_inl boolv ijkVecAnd2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecNand2*sv
 //	Component-wise logical 'nand' of 2D vector and scalar.
@@ -557,7 +557,7 @@ boolv ijkVecAnd2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
+ijk_inl boolv ijkVecNand2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecOr2*sv
 //	Component-wise logical 'or' of 2D vector and scalar.
@@ -565,7 +565,7 @@ boolv ijkVecNand2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
+ijk_inl boolv ijkVecOr2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecNor2*sv
 //	Component-wise logical 'nor' of 2D vector and scalar.
@@ -573,21 +573,21 @@ boolv ijkVecOr2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
+ijk_inl boolv ijkVecNor2fsv(bool2 bv_out, f32 const s_lh, float2 const v_rh);
 
 // ijkVecDot2*v
 //	Dot product of 2D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-f32 ijkVecDot2fv(float2 const v_lh, float2 const v_rh);
+ijk_inl f32 ijkVecDot2fv(float2 const v_lh, float2 const v_rh);
 
 // ijkVecCross2*v
 //	Cross product scalar of 2D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar quantity of imaginary perpendicular axis
-f32 ijkVecCross2fv(float2 const v_lh, float2 const v_rh);
+ijk_inl f32 ijkVecCross2fv(float2 const v_lh, float2 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -596,7 +596,7 @@ f32 ijkVecCross2fv(float2 const v_lh, float2 const v_rh);
 //	Initialize 3D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-floatv ijkVecInit3fv(float3 v_out);
+ijk_inl floatv ijkVecInit3fv(float3 v_out);
 
 // ijkVecInitElems3*v
 //	Initialize 3D vector to specified individual elements.
@@ -605,28 +605,28 @@ floatv ijkVecInit3fv(float3 v_out);
 //		param y: second element
 //		param z: third element
 //		return: v_out
-floatv ijkVecInitElems3fv(float3 v_out, f32 const x, f32 const y, f32 const z);
+ijk_inl floatv ijkVecInitElems3fv(float3 v_out, f32 const x, f32 const y, f32 const z);
 
 // ijkVecCopy3*v
 //	Copy 3D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-floatv ijkVecCopy3fv(float3 v_out, float3 const v_in);
+ijk_inl floatv ijkVecCopy3fv(float3 v_out, float3 const v_in);
 
 // ijkVecNegate3*v
 //	Negate 3D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-floatv ijkVecNegate3fv(float3 v_out, float3 const v_in);
+ijk_inl floatv ijkVecNegate3fv(float3 v_out, float3 const v_in);
 
 // ijkVecNot3*v
 //	Calculate component-wise logical 'not' of 3D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot3fv(bool3 bv_out, float3 const v_in);
+ijk_inl boolv ijkVecNot3fv(bool3 bv_out, float3 const v_in);
 
 // ijkVecAdd3*v
 //	Calculate sum of 3D vectors.
@@ -634,7 +634,7 @@ boolv ijkVecNot3fv(bool3 bv_out, float3 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecAdd3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
+ijk_inl floatv ijkVecAdd3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecSub3*v
 //	Calculate difference of 3D vectors.
@@ -642,7 +642,7 @@ floatv ijkVecAdd3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecSub3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
+ijk_inl floatv ijkVecSub3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecMul3*v
 //	Calculate component-wise product of 3D vectors.
@@ -650,7 +650,7 @@ floatv ijkVecSub3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecMul3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
+ijk_inl floatv ijkVecMul3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecDiv3*v
 //	Calculate component-wise quotient of 3D vectors.
@@ -658,7 +658,7 @@ floatv ijkVecMul3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecDiv3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
+ijk_inl floatv ijkVecDiv3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecDivSafe3*v
 //	Calculate component-wise quotient of 3D vectors, division-by-zero safe.
@@ -666,7 +666,7 @@ floatv ijkVecDiv3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecDivSafe3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
+ijk_inl floatv ijkVecDivSafe3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecMod3*v
 //	Calculate component-wise remainder of 3D vectors.
@@ -674,7 +674,7 @@ floatv ijkVecDivSafe3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecMod3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
+ijk_inl floatv ijkVecMod3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecModSafe3*v
 //	Calculate component-wise remainder of 3D vectors, division-by-zero safe.
@@ -682,7 +682,7 @@ floatv ijkVecMod3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecModSafe3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
+ijk_inl floatv ijkVecModSafe3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecEqual3*v
 //	Equality comparison for 3D vectors.
@@ -690,7 +690,7 @@ floatv ijkVecModSafe3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
+ijk_inl boolv ijkVecEqual3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecInequal3*v
 //	Inequality comparison for 3D vectors.
@@ -698,7 +698,7 @@ boolv ijkVecEqual3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
+ijk_inl boolv ijkVecInequal3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecLessEqual3*v
 //	Less-than or equal comparison for 3D vectors.
@@ -706,7 +706,7 @@ boolv ijkVecInequal3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
+ijk_inl boolv ijkVecLessEqual3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecGreaterEqual3*v
 //	Greater-than or equal comparison for 3D vectors.
@@ -714,7 +714,7 @@ boolv ijkVecLessEqual3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecLess3*v
 //	Less-than comparison for 3D vectors.
@@ -722,7 +722,7 @@ boolv ijkVecGreaterEqual3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
+ijk_inl boolv ijkVecLess3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecGreater3*v
 //	Greater-than comparison for 3D vectors.
@@ -730,7 +730,7 @@ boolv ijkVecLess3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
+ijk_inl boolv ijkVecGreater3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecAnd3*v
 //	Component-wise logical 'and' of 3D vectors.
@@ -738,7 +738,7 @@ boolv ijkVecGreater3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
+ijk_inl boolv ijkVecAnd3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecNand3*v
 //	Component-wise logical 'nand' of 3D vectors.
@@ -746,7 +746,7 @@ boolv ijkVecAnd3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
+ijk_inl boolv ijkVecNand3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecOr3*v
 //	Component-wise logical 'or' of 3D vectors.
@@ -754,7 +754,7 @@ boolv ijkVecNand3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
+ijk_inl boolv ijkVecOr3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecNor3*v
 //	Component-wise logical 'nor' of 3D vectors.
@@ -762,7 +762,7 @@ boolv ijkVecOr3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
+ijk_inl boolv ijkVecNor3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecCopy3*vz
 //	Copy 3D vector from 2D vector and one scalar.
@@ -770,28 +770,28 @@ boolv ijkVecNor3fv(bool3 bv_out, float3 const v_lh, float3 const v_rh);
 //		param v_xy: input 2D vector holding first two components
 //		param z: third element
 //		return: v_out
-floatv ijkVecCopy3fvz(float3 v_out, float2 const v_xy, f32 const z);
+ijk_inl floatv ijkVecCopy3fvz(float3 v_out, float2 const v_xy, f32 const z);
 
 // ijkVecCopy3*vs
 //	Copy 3D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-floatv ijkVecCopy3fvs(float3 v_out, f32 const s_in);
+ijk_inl floatv ijkVecCopy3fvs(float3 v_out, f32 const s_in);
 
 // ijkVecNegate3*vs
 //	Negate scalar to 3D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-floatv ijkVecNegate3fvs(float3 v_out, f32 const s_in);
+ijk_inl floatv ijkVecNegate3fvs(float3 v_out, f32 const s_in);
 
 // ijkVecNot3*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot3fvs(bool3 bv_out, f32 const s_in);
+ijk_inl boolv ijkVecNot3fvs(bool3 bv_out, f32 const s_in);
 
 // ijkVecAdd3*vs
 //	Calculate sum of 3D vector components and scalar.
@@ -799,7 +799,7 @@ boolv ijkVecNot3fvs(bool3 bv_out, f32 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecAdd3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecAdd3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecSub3*vs
 //	Calculate difference of 3D vector components and scalar.
@@ -807,7 +807,7 @@ floatv ijkVecAdd3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecSub3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecSub3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecMul3*vs
 //	Calculate product of 3D vector components by scalar.
@@ -815,7 +815,7 @@ floatv ijkVecSub3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecMul3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecMul3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecDiv3*vs
 //	Calculate quotient of 3D vector components by scalar.
@@ -823,7 +823,7 @@ floatv ijkVecMul3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecDiv3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecDiv3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecDivSafe3*vs
 //	Calculate quotient of 3D vector components by scalar, division-by-zero safe.
@@ -831,7 +831,7 @@ floatv ijkVecDiv3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecDivSafe3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecDivSafe3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecMod3*vs
 //	Calculate remainder of 3D vector components by scalar.
@@ -839,7 +839,7 @@ floatv ijkVecDivSafe3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecMod3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecMod3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecModSafe3*vs
 //	Calculate remainder of 3D vector components by scalar, division-by-zero safe.
@@ -847,7 +847,7 @@ floatv ijkVecMod3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecModSafe3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecModSafe3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecEqual3*vs
 //	Equality comparison of 3D vector components and scalar.
@@ -855,7 +855,7 @@ floatv ijkVecModSafe3fvs(float3 v_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecEqual3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecInequal3*vs
 //	Inequality comparison of 3D vector components and scalar.
@@ -863,7 +863,7 @@ boolv ijkVecEqual3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecInequal3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecLessEqual3*vs
 //	Less-than or equal comparison of 3D vector components and scalar.
@@ -871,7 +871,7 @@ boolv ijkVecInequal3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecLessEqual3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecGreaterEqual3*vs
 //	Greater-than or equal comparison of 3D vector components and scalar.
@@ -879,7 +879,7 @@ boolv ijkVecLessEqual3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecLess3*vs
 //	Less-than comparison of 3D vector components and scalar.
@@ -887,7 +887,7 @@ boolv ijkVecGreaterEqual3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecLess3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecGreater3*vs
 //	Greater-than comparison of 3D vector components and scalar.
@@ -895,7 +895,7 @@ boolv ijkVecLess3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecGreater3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecAnd3*vs
 //	Component-wise logical 'and' of 3D vector and scalar.
@@ -903,7 +903,7 @@ boolv ijkVecGreater3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecAnd3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecNand3*vs
 //	Component-wise logical 'nand' of 3D vector and scalar.
@@ -911,7 +911,7 @@ boolv ijkVecAnd3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecNand3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecOr3*vs
 //	Component-wise logical 'or' of 3D vector and scalar.
@@ -919,7 +919,7 @@ boolv ijkVecNand3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecOr3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecNor3*vs
 //	Component-wise logical 'nor' of 3D vector and scalar.
@@ -927,7 +927,7 @@ boolv ijkVecOr3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecNor3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 
 // ijkVecCopy3*xv
 //	Copy 3D vector from 2D vector and one scalar.
@@ -935,7 +935,7 @@ boolv ijkVecNor3fvs(bool3 bv_out, float3 const v_lh, f32 const s_rh);
 //		param x: first element
 //		param v_yz: input 2D vector holding last two components
 //		return: v_out
-floatv ijkVecCopy3fxv(float3 v_out, f32 const x, float2 const v_yz);
+ijk_inl floatv ijkVecCopy3fxv(float3 v_out, f32 const x, float2 const v_yz);
 
 // ijkVecAdd3*sv
 //	Calculate sum of scalar and 3D vector components.
@@ -943,7 +943,7 @@ floatv ijkVecCopy3fxv(float3 v_out, f32 const x, float2 const v_yz);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecAdd3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
+ijk_inl floatv ijkVecAdd3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecSub3*sv
 //	Calculate difference of scalar and 3D vector components.
@@ -951,7 +951,7 @@ floatv ijkVecAdd3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecSub3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
+ijk_inl floatv ijkVecSub3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecMul3*sv
 //	Calculate product of scalar by 3D vector components.
@@ -959,7 +959,7 @@ floatv ijkVecSub3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecMul3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
+ijk_inl floatv ijkVecMul3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecDiv3*sv
 //	Calculate quotient of scalar by 3D vector components.
@@ -967,7 +967,7 @@ floatv ijkVecMul3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecDiv3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
+ijk_inl floatv ijkVecDiv3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecDivSafe3*sv
 //	Calculate quotient of scalar by 3D vector components, division-by-zero safe.
@@ -975,7 +975,7 @@ floatv ijkVecDiv3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecDivSafe3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
+ijk_inl floatv ijkVecDivSafe3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecMod3*sv
 //	Calculate remainder of scalar by 3D vector components.
@@ -983,7 +983,7 @@ floatv ijkVecDivSafe3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecMod3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
+ijk_inl floatv ijkVecMod3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecModSafe3*sv
 //	Calculate remainder of scalar by 3D vector components, division-by-zero safe.
@@ -991,7 +991,7 @@ floatv ijkVecMod3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecModSafe3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
+ijk_inl floatv ijkVecModSafe3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecEqual3*sv
 //	Equality comparison of scalar and 3D vector components.
@@ -999,7 +999,7 @@ floatv ijkVecModSafe3fsv(float3 v_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
+ijk_inl boolv ijkVecEqual3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecInequal3*sv
 //	Inequality comparison of scalar and 3D vector components.
@@ -1007,7 +1007,7 @@ boolv ijkVecEqual3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
+ijk_inl boolv ijkVecInequal3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecLessEqual3*sv
 //	Less-than or equal comparison of scalar and 3D vector components.
@@ -1015,7 +1015,7 @@ boolv ijkVecInequal3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
+ijk_inl boolv ijkVecLessEqual3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecGreaterEqual3*sv
 //	Greater-than or equal comparison of scalar and 3D vector components.
@@ -1023,7 +1023,7 @@ boolv ijkVecLessEqual3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecLess3*sv
 //	Less-than comparison of scalar and 3D vector components.
@@ -1031,7 +1031,7 @@ boolv ijkVecGreaterEqual3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
+ijk_inl boolv ijkVecLess3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecGreater3*sv
 //	Greater-than comparison of scalar and 3D vector components.
@@ -1039,7 +1039,7 @@ boolv ijkVecLess3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
+ijk_inl boolv ijkVecGreater3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecAnd3*sv
 //	Component-wise logical 'and' of 3D vector and scalar.
@@ -1047,7 +1047,7 @@ boolv ijkVecGreater3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
+ijk_inl boolv ijkVecAnd3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecNand3*sv
 //	Component-wise logical 'nand' of 3D vector and scalar.
@@ -1055,7 +1055,7 @@ boolv ijkVecAnd3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
+ijk_inl boolv ijkVecNand3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecOr3*sv
 //	Component-wise logical 'or' of 3D vector and scalar.
@@ -1063,7 +1063,7 @@ boolv ijkVecNand3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
+ijk_inl boolv ijkVecOr3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecNor3*sv
 //	Component-wise logical 'nor' of 3D vector and scalar.
@@ -1071,14 +1071,14 @@ boolv ijkVecOr3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
+ijk_inl boolv ijkVecNor3fsv(bool3 bv_out, f32 const s_lh, float3 const v_rh);
 
 // ijkVecDot3*v
 //	Dot product of 3D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-f32 ijkVecDot3fv(float3 const v_lh, float3 const v_rh);
+ijk_inl f32 ijkVecDot3fv(float3 const v_lh, float3 const v_rh);
 
 // ijkVecCross3*v
 //	Cross product of 3D array-based vectors.
@@ -1086,7 +1086,7 @@ f32 ijkVecDot3fv(float3 const v_lh, float3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecCross3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
+ijk_inl floatv ijkVecCross3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -1095,7 +1095,7 @@ floatv ijkVecCross3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 //	Initialize 4D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-floatv ijkVecInit4fv(float4 v_out);
+ijk_inl floatv ijkVecInit4fv(float4 v_out);
 
 // ijkVecInitElems4*v
 //	Initialize 4D vector to specified individual elements.
@@ -1105,7 +1105,7 @@ floatv ijkVecInit4fv(float4 v_out);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for pofloat, 0 for vector)
 //		return: v_out
-floatv ijkVecInitElems4fv(float4 v_out, f32 const x, f32 const y, f32 const z, f32 const w);
+ijk_inl floatv ijkVecInitElems4fv(float4 v_out, f32 const x, f32 const y, f32 const z, f32 const w);
 
 // ijkVecCopy4*xvw
 //	Copy 4D vector from scalar, 2D vector and another scalar.
@@ -1114,7 +1114,7 @@ floatv ijkVecInitElems4fv(float4 v_out, f32 const x, f32 const y, f32 const z, f
 //		param v_yz: input 2D vector holding middle two components
 //		param w: fourth element (in space, set as 1 for pofloat, 0 for vector)
 //		return: v_out
-floatv ijkVecCopy4fxvw(float4 v_out, f32 const x, float2 const v_yz, f32 const w);
+ijk_inl floatv ijkVecCopy4fxvw(float4 v_out, f32 const x, float2 const v_yz, f32 const w);
 
 // ijkVecCopy4*v2
 //	Copy 4D vector from two 2D vectors.
@@ -1122,28 +1122,28 @@ floatv ijkVecCopy4fxvw(float4 v_out, f32 const x, float2 const v_yz, f32 const w
 //		param v_xy: input 2D vector holding first two components
 //		param v_zw: input 2D vector holding last two components
 //		return: v_out
-floatv ijkVecCopy4fv2(float4 v_out, float2 const v_xy, float2 const v_zw);
+ijk_inl floatv ijkVecCopy4fv2(float4 v_out, float2 const v_xy, float2 const v_zw);
 
 // ijkVecCopy4*v
 //	Copy 4D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-floatv ijkVecCopy4fv(float4 v_out, float4 const v_in);
+ijk_inl floatv ijkVecCopy4fv(float4 v_out, float4 const v_in);
 
 // ijkVecNegate4*v
 //	Negate 4D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-floatv ijkVecNegate4fv(float4 v_out, float4 const v_in);
+ijk_inl floatv ijkVecNegate4fv(float4 v_out, float4 const v_in);
 
 // ijkVecNot4*v
 //	Calculate component-wise logical 'not' of 4D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot4fv(bool4 bv_out, float4 const v_in);
+ijk_inl boolv ijkVecNot4fv(bool4 bv_out, float4 const v_in);
 
 // ijkVecAdd4*v
 //	Calculate sum of 4D vectors.
@@ -1151,7 +1151,7 @@ boolv ijkVecNot4fv(bool4 bv_out, float4 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecAdd4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
+ijk_inl floatv ijkVecAdd4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecSub4*v
 //	Calculate difference of 4D vectors.
@@ -1159,7 +1159,7 @@ floatv ijkVecAdd4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecSub4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
+ijk_inl floatv ijkVecSub4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecMul4*v
 //	Calculate component-wise product of 4D vectors.
@@ -1167,7 +1167,7 @@ floatv ijkVecSub4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecMul4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
+ijk_inl floatv ijkVecMul4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecDiv4*v
 //	Calculate component-wise quotient of 4D vectors.
@@ -1175,7 +1175,7 @@ floatv ijkVecMul4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecDiv4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
+ijk_inl floatv ijkVecDiv4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecDivSafe4*v
 //	Calculate component-wise quotient of 4D vectors, division-by-zero safe.
@@ -1183,7 +1183,7 @@ floatv ijkVecDiv4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecDivSafe4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
+ijk_inl floatv ijkVecDivSafe4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecMod4*v
 //	Calculate component-wise remainder of 4D vectors.
@@ -1191,7 +1191,7 @@ floatv ijkVecDivSafe4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecMod4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
+ijk_inl floatv ijkVecMod4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecModSafe4*v
 //	Calculate component-wise remainder of 4D vectors, division-by-zero safe.
@@ -1199,7 +1199,7 @@ floatv ijkVecMod4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecModSafe4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
+ijk_inl floatv ijkVecModSafe4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecEqual4*v
 //	Equality comparison for 4D vectors.
@@ -1207,7 +1207,7 @@ floatv ijkVecModSafe4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
+ijk_inl boolv ijkVecEqual4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecInequal4*v
 //	Inequality comparison for 4D vectors.
@@ -1215,7 +1215,7 @@ boolv ijkVecEqual4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
+ijk_inl boolv ijkVecInequal4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecLessEqual4*v
 //	Less-than or equal comparison for 4D vectors.
@@ -1223,7 +1223,7 @@ boolv ijkVecInequal4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
+ijk_inl boolv ijkVecLessEqual4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecGreaterEqual4*v
 //	Greater-than or equal comparison for 4D vectors.
@@ -1231,7 +1231,7 @@ boolv ijkVecLessEqual4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecLess4*v
 //	Less-than comparison for 4D vectors.
@@ -1239,7 +1239,7 @@ boolv ijkVecGreaterEqual4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
+ijk_inl boolv ijkVecLess4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecGreater4*v
 //	Greater-than comparison for 4D vectors.
@@ -1247,7 +1247,7 @@ boolv ijkVecLess4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
+ijk_inl boolv ijkVecGreater4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecAnd4*v
 //	Component-wise logical 'and' of 4D vectors.
@@ -1255,7 +1255,7 @@ boolv ijkVecGreater4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
+ijk_inl boolv ijkVecAnd4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecNand4*v
 //	Component-wise logical 'nand' of 4D vectors.
@@ -1263,7 +1263,7 @@ boolv ijkVecAnd4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
+ijk_inl boolv ijkVecNand4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecOr4*v
 //	Component-wise logical 'or' of 4D vectors.
@@ -1271,7 +1271,7 @@ boolv ijkVecNand4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
+ijk_inl boolv ijkVecOr4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecNor4*v
 //	Component-wise logical 'nor' of 4D vectors.
@@ -1279,7 +1279,7 @@ boolv ijkVecOr4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
+ijk_inl boolv ijkVecNor4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecCopy4*vzw
 //	Copy 4D vector from 2D vector and two scalars.
@@ -1288,7 +1288,7 @@ boolv ijkVecNor4fv(bool4 bv_out, float4 const v_lh, float4 const v_rh);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for pofloat, 0 for vector)
 //		return: v_out
-floatv ijkVecCopy4fvzw(float4 v_out, float2 const v_xy, f32 const z, f32 const w);
+ijk_inl floatv ijkVecCopy4fvzw(float4 v_out, float2 const v_xy, f32 const z, f32 const w);
 
 // ijkVecCopy4*vw
 //	Copy 4D vector from 3D vector and one scalar.
@@ -1296,28 +1296,28 @@ floatv ijkVecCopy4fvzw(float4 v_out, float2 const v_xy, f32 const z, f32 const w
 //		param v_xyz: input 3D vector holding first three components
 //		param w: fourth element (in space, set as 1 for pofloat, 0 for vector)
 //		return: v_out
-floatv ijkVecCopy4fvw(float4 v_out, float3 const v_xyz, f32 const w);
+ijk_inl floatv ijkVecCopy4fvw(float4 v_out, float3 const v_xyz, f32 const w);
 
 // ijkVecCopy4*vs
 //	Copy 4D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-floatv ijkVecCopy4fvs(float4 v_out, f32 const s_in);
+ijk_inl floatv ijkVecCopy4fvs(float4 v_out, f32 const s_in);
 
 // ijkVecNegate4*vs
 //	Negate scalar to 4D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-floatv ijkVecNegate4fvs(float4 v_out, f32 const s_in);
+ijk_inl floatv ijkVecNegate4fvs(float4 v_out, f32 const s_in);
 
 // ijkVecNot4*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot4fvs(bool4 bv_out, f32 const s_in);
+ijk_inl boolv ijkVecNot4fvs(bool4 bv_out, f32 const s_in);
 
 // ijkVecAdd4*vs
 //	Calculate sum of 4D vector components and scalar.
@@ -1325,7 +1325,7 @@ boolv ijkVecNot4fvs(bool4 bv_out, f32 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecAdd4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecAdd4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecSub4*vs
 //	Calculate difference of 4D vector components and scalar.
@@ -1333,7 +1333,7 @@ floatv ijkVecAdd4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecSub4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecSub4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecMul4*vs
 //	Calculate product of 4D vector components by scalar.
@@ -1341,7 +1341,7 @@ floatv ijkVecSub4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecMul4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecMul4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecDiv4*vs
 //	Calculate quotient of 4D vector components by scalar.
@@ -1349,7 +1349,7 @@ floatv ijkVecMul4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecDiv4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecDiv4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecDivSafe4*vs
 //	Calculate quotient of 4D vector components by scalar, division-by-zero safe.
@@ -1357,7 +1357,7 @@ floatv ijkVecDiv4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecDivSafe4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecDivSafe4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecMod4*vs
 //	Calculate remainder of 4D vector components by scalar.
@@ -1365,7 +1365,7 @@ floatv ijkVecDivSafe4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecMod4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecMod4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecModSafe4*vs
 //	Calculate remainder of 4D vector components by scalar, division-by-zero safe.
@@ -1373,7 +1373,7 @@ floatv ijkVecMod4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-floatv ijkVecModSafe4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
+ijk_inl floatv ijkVecModSafe4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecEqual4*vs
 //	Equality comparison of 4D vector components and scalar.
@@ -1381,7 +1381,7 @@ floatv ijkVecModSafe4fvs(float4 v_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecEqual4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecInequal4*vs
 //	Inequality comparison of 4D vector components and scalar.
@@ -1389,7 +1389,7 @@ boolv ijkVecEqual4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecInequal4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecLessEqual4*vs
 //	Less-than or equal comparison of 4D vector components and scalar.
@@ -1397,7 +1397,7 @@ boolv ijkVecInequal4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecLessEqual4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecGreaterEqual4*vs
 //	Greater-than or equal comparison of 4D vector components and scalar.
@@ -1405,7 +1405,7 @@ boolv ijkVecLessEqual4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecLess4*vs
 //	Less-than comparison of 4D vector components and scalar.
@@ -1413,7 +1413,7 @@ boolv ijkVecGreaterEqual4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecLess4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecGreater4*vs
 //	Greater-than comparison of 4D vector components and scalar.
@@ -1421,7 +1421,7 @@ boolv ijkVecLess4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecGreater4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecAnd4*vs
 //	Component-wise logical 'and' of 4D vector and scalar.
@@ -1429,7 +1429,7 @@ boolv ijkVecGreater4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecAnd4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecNand4*vs
 //	Component-wise logical 'nand' of 4D vector and scalar.
@@ -1437,7 +1437,7 @@ boolv ijkVecAnd4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecNand4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecOr4*vs
 //	Component-wise logical 'or' of 4D vector and scalar.
@@ -1445,7 +1445,7 @@ boolv ijkVecNand4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecOr4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecNor4*vs
 //	Component-wise logical 'nor' of 4D vector and scalar.
@@ -1453,7 +1453,7 @@ boolv ijkVecOr4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
+ijk_inl boolv ijkVecNor4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 
 // ijkVecCopy4*xyv
 //	Copy 4D vector from two scalars and 2D vector.
@@ -1462,7 +1462,7 @@ boolv ijkVecNor4fvs(bool4 bv_out, float4 const v_lh, f32 const s_rh);
 //		param y: second element
 //		param v_zw: input 2D vector holding last two components
 //		return: v_out
-floatv ijkVecCopy4fxyv(float4 v_out, f32 const x, f32 const y, float2 const v_zw);
+ijk_inl floatv ijkVecCopy4fxyv(float4 v_out, f32 const x, f32 const y, float2 const v_zw);
 
 // ijkVecCopy4*xv
 //	Copy 4D vector from one scalar and 3D vector.
@@ -1470,7 +1470,7 @@ floatv ijkVecCopy4fxyv(float4 v_out, f32 const x, f32 const y, float2 const v_zw
 //		param x: first element
 //		param v_yzw: input 3D vector holding last three components
 //		return: v_out
-floatv ijkVecCopy4fxv(float4 v_out, f32 const x, float3 const v_yzw);
+ijk_inl floatv ijkVecCopy4fxv(float4 v_out, f32 const x, float3 const v_yzw);
 
 // ijkVecAdd4*sv
 //	Calculate sum of scalar and 4D vector components.
@@ -1478,7 +1478,7 @@ floatv ijkVecCopy4fxv(float4 v_out, f32 const x, float3 const v_yzw);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecAdd4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
+ijk_inl floatv ijkVecAdd4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecSub4*sv
 //	Calculate difference of scalar and 4D vector components.
@@ -1486,7 +1486,7 @@ floatv ijkVecAdd4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecSub4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
+ijk_inl floatv ijkVecSub4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecMul4*sv
 //	Calculate product of scalar by 4D vector components.
@@ -1494,7 +1494,7 @@ floatv ijkVecSub4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecMul4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
+ijk_inl floatv ijkVecMul4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecDiv4*sv
 //	Calculate quotient of scalar by 4D vector components.
@@ -1502,7 +1502,7 @@ floatv ijkVecMul4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecDiv4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
+ijk_inl floatv ijkVecDiv4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecDivSafe4*sv
 //	Calculate quotient of scalar by 4D vector components, division-by-zero safe.
@@ -1510,7 +1510,7 @@ floatv ijkVecDiv4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecDivSafe4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
+ijk_inl floatv ijkVecDivSafe4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecMod4*sv
 //	Calculate remainder of scalar by 4D vector components.
@@ -1518,7 +1518,7 @@ floatv ijkVecDivSafe4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecMod4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
+ijk_inl floatv ijkVecMod4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecModSafe4*sv
 //	Calculate remainder of scalar by 4D vector components, division-by-zero safe.
@@ -1526,7 +1526,7 @@ floatv ijkVecMod4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecModSafe4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
+ijk_inl floatv ijkVecModSafe4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecEqual4*sv
 //	Equality comparison of scalar and 4D vector components.
@@ -1534,7 +1534,7 @@ floatv ijkVecModSafe4fsv(float4 v_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
+ijk_inl boolv ijkVecEqual4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecInequal4*sv
 //	Inequality comparison of scalar and 4D vector components.
@@ -1542,7 +1542,7 @@ boolv ijkVecEqual4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
+ijk_inl boolv ijkVecInequal4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecLessEqual4*sv
 //	Less-than or equal comparison of scalar and 4D vector components.
@@ -1550,7 +1550,7 @@ boolv ijkVecInequal4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
+ijk_inl boolv ijkVecLessEqual4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecGreaterEqual4*sv
 //	Greater-than or equal comparison of scalar and 4D vector components.
@@ -1558,7 +1558,7 @@ boolv ijkVecLessEqual4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecLess4*sv
 //	Less-than comparison of scalar and 4D vector components.
@@ -1566,7 +1566,7 @@ boolv ijkVecGreaterEqual4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
+ijk_inl boolv ijkVecLess4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecGreater4*sv
 //	Greater-than comparison of scalar and 4D vector components.
@@ -1574,7 +1574,7 @@ boolv ijkVecLess4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
+ijk_inl boolv ijkVecGreater4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecAnd4*sv
 //	Component-wise logical 'and' of 4D vector and scalar.
@@ -1582,7 +1582,7 @@ boolv ijkVecGreater4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
+ijk_inl boolv ijkVecAnd4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecNand4*sv
 //	Component-wise logical 'nand' of 4D vector and scalar.
@@ -1590,7 +1590,7 @@ boolv ijkVecAnd4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
+ijk_inl boolv ijkVecNand4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecOr4*sv
 //	Component-wise logical 'or' of 4D vector and scalar.
@@ -1598,7 +1598,7 @@ boolv ijkVecNand4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
+ijk_inl boolv ijkVecOr4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecNor4*sv
 //	Component-wise logical 'nor' of 4D vector and scalar.
@@ -1606,14 +1606,14 @@ boolv ijkVecOr4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
+ijk_inl boolv ijkVecNor4fsv(bool4 bv_out, f32 const s_lh, float4 const v_rh);
 
 // ijkVecDot4*v
 //	Dot product of 4D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-f32 ijkVecDot4fv(float4 const v_lh, float4 const v_rh);
+ijk_inl f32 ijkVecDot4fv(float4 const v_lh, float4 const v_rh);
 
 // ijkVecCross4*v
 //	Cross product of 4D array-based vectors.
@@ -1621,7 +1621,7 @@ f32 ijkVecDot4fv(float4 const v_lh, float4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out (fourth element is zero)
-floatv ijkVecCross4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
+ijk_inl floatv ijkVecCross4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -1638,50 +1638,50 @@ floatv ijkVecCross4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 //	Absolute value of scalar: (s >= 0 ? +s : -s).
 //		param s: scalar
 //		return: absolute value
-float ijkVecAbs1f(float const s);
+ijk_inl float ijkVecAbs1f(float const s);
 
 // ijkVecSgn1*
 //	Sign of scalar: (s != 0 ? s > 0 ? +1 : -1).
 //		param s: scalar
 //		return: sign
-float ijkVecSgn1f(float const s);
+ijk_inl float ijkVecSgn1f(float const s);
 
 // ijkVecDot1*
 //	Dot product of scalars, which is just their product.
 //		param s_lh: left-hand scalar
 //		param s_rh: right-hand scalar
 //		return: product
-float ijkVecDot1f(float const s_lh, float const s_rh);
+ijk_inl float ijkVecDot1f(float const s_lh, float const s_rh);
 
 // ijkVecLengthSq1*
 //	Squared length of scalar.
 //		param s: scalar
 //		return: squared length
-float ijkVecLengthSq1f(float const s);
+ijk_inl float ijkVecLengthSq1f(float const s);
 
 // ijkVecLength1*
 //	Length of scalar.
 //		param s: scalar
 //		return: length
-float ijkVecLength1f(float const s);
+ijk_inl float ijkVecLength1f(float const s);
 
 // ijkVecLengthSqInv1*
 //	Inverse squared length of scalar.
 //		param s: scalar
 //		return: inverse squared length
-float ijkVecLengthSqInv1f(float const s);
+ijk_inl float ijkVecLengthSqInv1f(float const s);
 
 // ijkVecLengthSqInv1*
 //	Inverse length of scalar.
 //		param s: scalar
 //		return: inverse length
-float ijkVecLengthInv1f(float const s);
+ijk_inl float ijkVecLengthInv1f(float const s);
 
 // ijkVecNormalize1*
 //	Calculate unit scalar in same direction as input (sign).
 //		param s: scalar
 //		return: unit scalar (sign)
-float ijkVecNormalize1f(float const s);
+ijk_inl float ijkVecNormalize1f(float const s);
 
 // ijkVecNormalizeGetLength1*
 //	Calculate unit scalar in same direction as input (sign).
@@ -1689,7 +1689,7 @@ float ijkVecNormalize1f(float const s);
 //		param s: scalar
 //		param length_out: pointer to length storage
 //		return: unit scalar (sign)
-float ijkVecNormalizeGetLength1f(float const s, float* const length_out);
+ijk_inl float ijkVecNormalizeGetLength1f(float const s, float* const length_out);
 
 // ijkVecNormalizeGetLengthInv1*
 //	Calculate unit scalar in same direction as input (sign).
@@ -1697,7 +1697,7 @@ float ijkVecNormalizeGetLength1f(float const s, float* const length_out);
 //		param s: scalar
 //		param lengthInv_out: pointer to length storage
 //		return: unit scalar (sign)
-float ijkVecNormalizeGetLengthInv1f(float const s, float* const lengthInv_out);
+ijk_inl float ijkVecNormalizeGetLengthInv1f(float const s, float* const lengthInv_out);
 
 
 //-----------------------------------------------------------------------------
@@ -1705,421 +1705,421 @@ float ijkVecNormalizeGetLengthInv1f(float const s, float* const lengthInv_out);
 // ijkVecInit2*
 //	Initialize 2D vector to default value (zero vector).
 //		return: default vector
-fvec2 ijkVecInit2f();
+ijk_inl fvec2 ijkVecInit2f();
 
 // ijkVecInitElems2*
 //	Initialize 2D vector to specified individual elements.
 //		param x: first element
 //		param y: second element
 //		return: result vector
-fvec2 ijkVecInitElems2f(float const x, float const y);
+ijk_inl fvec2 ijkVecInitElems2f(float const x, float const y);
 
 // ijkVecCopy2*
 //	Copy 2D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-fvec2 ijkVecCopy2f(fvec2 const v_in);
+ijk_inl fvec2 ijkVecCopy2f(fvec2 const v_in);
 
 // ijkVecNegate2*
 //	Negate 2D vector.
 //		param v_in: input vector
 //		return: result vector
-fvec2 ijkVecNegate2f(fvec2 const v_in);
+ijk_inl fvec2 ijkVecNegate2f(fvec2 const v_in);
 
 // ijkVecNot2*
 //	Calculate component-wise logical 'not' of 2D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec2 ijkVecNot2f(fvec2 const v_in);
+ijk_inl bvec2 ijkVecNot2f(fvec2 const v_in);
 
 // ijkVecAdd2*
 //	Calculate sum of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec2 ijkVecAdd2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl fvec2 ijkVecAdd2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecSub2*
 //	Calculate difference of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec2 ijkVecSub2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl fvec2 ijkVecSub2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecMul2*
 //	Calculate component-wise product of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec2 ijkVecMul2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl fvec2 ijkVecMul2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecDiv2*
 //	Calculate component-wise quotient of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec2 ijkVecDiv2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl fvec2 ijkVecDiv2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecDivSafe2*
 //	Calculate component-wise quotient of 2D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec2 ijkVecDivSafe2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl fvec2 ijkVecDivSafe2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecMod2*
 //	Calculate component-wise remainder of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec2 ijkVecMod2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl fvec2 ijkVecMod2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecModSafe2*
 //	Calculate component-wise remainder of 2D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec2 ijkVecModSafe2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl fvec2 ijkVecModSafe2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecEqual2*
 //	Equality comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecEqual2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecEqual2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecInequal2*
 //	Inequality comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecInequal2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecInequal2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecLessEqual2*
 //	Less-than or equal comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLessEqual2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecLessEqual2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecGreaterEqual2*
 //	Greater-than or equal comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecLess2*
 //	Less-than comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLess2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecLess2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecGreater2*
 //	Greater-than comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreater2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreater2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecAnd2*
 //	Component-wise logical 'and' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecAnd2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecAnd2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecNand2*
 //	Component-wise logical 'nand' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNand2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecNand2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecOr2*
 //	Component-wise logical 'or' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecOr2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecOr2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecNor2*
 //	Component-wise logical 'nor' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNor2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecNor2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecCopy2*s
 //	Copy 2D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-fvec2 ijkVecCopy2fs(float const s_in);
+ijk_inl fvec2 ijkVecCopy2fs(float const s_in);
 
 // ijkVecNegate2*s
 //	Negate scalar to 2D vector.
 //		param s_in: input scalar
 //		return: result vector
-fvec2 ijkVecNegate2fs(float const s_in);
+ijk_inl fvec2 ijkVecNegate2fs(float const s_in);
 
 // ijkVecNot2*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec2 ijkVecNot2fs(float const s_in);
+ijk_inl bvec2 ijkVecNot2fs(float const s_in);
 
 // ijkVecAdd2*s
 //	Calculate sum of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec2 ijkVecAdd2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl fvec2 ijkVecAdd2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecSub2*s
 //	Calculate difference of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec2 ijkVecSub2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl fvec2 ijkVecSub2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecMul2*s
 //	Calculate product of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec2 ijkVecMul2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl fvec2 ijkVecMul2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecDiv2*s
 //	Calculate quotient of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec2 ijkVecDiv2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl fvec2 ijkVecDiv2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecDivSafe2*s
 //	Calculate quotient of 2D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec2 ijkVecDivSafe2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl fvec2 ijkVecDivSafe2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecMod2*s
 //	Calculate remainder of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec2 ijkVecMod2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl fvec2 ijkVecMod2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecModSafe2*s
 //	Calculate remainder of 2D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec2 ijkVecModSafe2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl fvec2 ijkVecModSafe2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecEqual2*s
 //	Equality comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecEqual2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl bvec2 ijkVecEqual2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecInequal2*s
 //	Inequality comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecInequal2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl bvec2 ijkVecInequal2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecLessEqual2*s
 //	Less-than or equal comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecLessEqual2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl bvec2 ijkVecLessEqual2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecGreaterEqual2*s
 //	Greater-than or equal comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecLess2*s
 //	Less-than comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecLess2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl bvec2 ijkVecLess2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecGreater2*s
 //	Greater-than comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecGreater2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl bvec2 ijkVecGreater2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecAnd2*s
 //	Component-wise logical 'and' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecAnd2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl bvec2 ijkVecAnd2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecNand2*s
 //	Component-wise logical 'nand' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecNand2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl bvec2 ijkVecNand2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecOr2*s
 //	Component-wise logical 'or' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecOr2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl bvec2 ijkVecOr2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecNor2*s
 //	Component-wise logical 'nor' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecNor2fs(fvec2 const v_lh, float const s_rh);
+ijk_inl bvec2 ijkVecNor2fs(fvec2 const v_lh, float const s_rh);
 
 // ijkVecAdd2s*
 //	Calculate sum of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec2 ijkVecAdd2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl fvec2 ijkVecAdd2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecSub2s*
 //	Calculate difference of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec2 ijkVecSub2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl fvec2 ijkVecSub2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecMul2s*
 //	Calculate product of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec2 ijkVecMul2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl fvec2 ijkVecMul2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecDiv2s*
 //	Calculate quotient of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec2 ijkVecDiv2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl fvec2 ijkVecDiv2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecDivSafe2s*
 //	Calculate quotient of scalar by 2D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec2 ijkVecDivSafe2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl fvec2 ijkVecDivSafe2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecMod2s*
 //	Calculate remainder of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec2 ijkVecMod2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl fvec2 ijkVecMod2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecModSafe2s*
 //	Calculate remainder of scalar by 2D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec2 ijkVecModSafe2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl fvec2 ijkVecModSafe2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecEqual2s*
 //	Equality comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecEqual2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecEqual2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecInequal2s*
 //	Inequality comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecInequal2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecInequal2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecLessEqual2s*
 //	Less-than or equal comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLessEqual2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecLessEqual2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecGreaterEqual2s*
 //	Greater-than or equal comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecLess2s*
 //	Less-than comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLess2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecLess2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecGreater2s*
 //	Greater-than comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreater2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreater2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecAnd2s*
 //	Component-wise logical 'and' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecAnd2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecAnd2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecNand2s*
 //	Component-wise logical 'nand' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNand2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecNand2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecOr2s*
 //	Component-wise logical 'or' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecOr2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecOr2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecNor2s*
 //	Component-wise logical 'nor' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNor2sf(float const s_lh, fvec2 const v_rh);
+ijk_inl bvec2 ijkVecNor2sf(float const s_lh, fvec2 const v_rh);
 
 // ijkVecDot2*
 //	Dot product of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-float ijkVecDot2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl float ijkVecDot2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecCross2*
 //	Cross product scalar of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar quantity of imaginary perpendicular axis
-float ijkVecCross2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl float ijkVecCross2f(fvec2 const v_lh, fvec2 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -2127,7 +2127,7 @@ float ijkVecCross2f(fvec2 const v_lh, fvec2 const v_rh);
 // ijkVecInit3*
 //	Initialize 3D vector to default value (zero vector).
 //		return: default vector
-fvec3 ijkVecInit3f();
+ijk_inl fvec3 ijkVecInit3f();
 
 // ijkVecInitElems3*
 //	Initialize 3D vector to specified individual elements.
@@ -2135,428 +2135,428 @@ fvec3 ijkVecInit3f();
 //		param y: second element
 //		param z: third element
 //		return: result vector
-fvec3 ijkVecInitElems3f(float const x, float const y, float const z);
+ijk_inl fvec3 ijkVecInitElems3f(float const x, float const y, float const z);
 
 // ijkVecCopy3*
 //	Copy 3D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-fvec3 ijkVecCopy3f(fvec3 const v_in);
+ijk_inl fvec3 ijkVecCopy3f(fvec3 const v_in);
 
 // ijkVecNegate3*
 //	Negate 3D vector.
 //		param v_in: input vector
 //		return: result vector
-fvec3 ijkVecNegate3f(fvec3 const v_in);
+ijk_inl fvec3 ijkVecNegate3f(fvec3 const v_in);
 
 // ijkVecNot3*
 //	Calculate component-wise logical 'not' of 3D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec3 ijkVecNot3f(fvec3 const v_in);
+ijk_inl bvec3 ijkVecNot3f(fvec3 const v_in);
 
 // ijkVecAdd3*
 //	Calculate sum of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec3 ijkVecAdd3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecAdd3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecSub3*
 //	Calculate difference of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec3 ijkVecSub3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecSub3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecMul3*
 //	Calculate component-wise product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec3 ijkVecMul3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecMul3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecDiv3*
 //	Calculate component-wise quotient of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec3 ijkVecDiv3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecDiv3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecDivSafe3*
 //	Calculate component-wise quotient of 3D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec3 ijkVecDivSafe3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecDivSafe3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecMod3*
 //	Calculate component-wise remainder of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec3 ijkVecMod3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecMod3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecModSafe3*
 //	Calculate component-wise remainder of 3D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec3 ijkVecModSafe3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecModSafe3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecEqual3*
 //	Equality comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecEqual3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecEqual3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecInequal3*
 //	Inequality comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecInequal3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecInequal3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecLessEqual3*
 //	Less-than or equal comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLessEqual3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecLessEqual3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecGreaterEqual3*
 //	Greater-than or equal comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecLess3*
 //	Less-than comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLess3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecLess3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecGreater3*
 //	Greater-than comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreater3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreater3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecAnd3*
 //	Component-wise logical 'and' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecAnd3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecAnd3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecNand3*
 //	Component-wise logical 'nand' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNand3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecNand3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecOr3*
 //	Component-wise logical 'or' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecOr3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecOr3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecNor3*
 //	Component-wise logical 'nor' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNor3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecNor3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecCopy3*z
 //	Copy 3D vector from 2D vector and one scalar.
 //		param v_xy: input 2D vector holding first two components
 //		param z: third element
 //		return: result vector
-fvec3 ijkVecCopy3fz(fvec2 const v_xy, float const z);
+ijk_inl fvec3 ijkVecCopy3fz(fvec2 const v_xy, float const z);
 
 // ijkVecCopy3*s
 //	Copy 3D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-fvec3 ijkVecCopy3fs(float const s_in);
+ijk_inl fvec3 ijkVecCopy3fs(float const s_in);
 
 // ijkVecNegate3*s
 //	Negate scalar to 3D vector.
 //		param s_in: input scalar
 //		return: result vector
-fvec3 ijkVecNegate3fs(float const s_in);
+ijk_inl fvec3 ijkVecNegate3fs(float const s_in);
 
 // ijkVecNot3*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec3 ijkVecNot3fs(float const s_in);
+ijk_inl bvec3 ijkVecNot3fs(float const s_in);
 
 // ijkVecAdd3*s
 //	Calculate sum of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec3 ijkVecAdd3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl fvec3 ijkVecAdd3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecSub3*s
 //	Calculate difference of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec3 ijkVecSub3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl fvec3 ijkVecSub3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecMul3*s
 //	Calculate product of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec3 ijkVecMul3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl fvec3 ijkVecMul3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecDiv3*s
 //	Calculate quotient of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec3 ijkVecDiv3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl fvec3 ijkVecDiv3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecDivSafe3*s
 //	Calculate quotient of 3D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec3 ijkVecDivSafe3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl fvec3 ijkVecDivSafe3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecMod3*s
 //	Calculate remainder of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec3 ijkVecMod3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl fvec3 ijkVecMod3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecModSafe3*s
 //	Calculate remainder of 3D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec3 ijkVecModSafe3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl fvec3 ijkVecModSafe3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecEqual3*s
 //	Equality comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecEqual3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl bvec3 ijkVecEqual3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecInequal3*s
 //	Inequality comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecInequal3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl bvec3 ijkVecInequal3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecLessEqual3*s
 //	Less-than or equal comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecLessEqual3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl bvec3 ijkVecLessEqual3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecGreaterEqual3*s
 //	Greater-than or equal comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecLess3*s
 //	Less-than comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecLess3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl bvec3 ijkVecLess3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecGreater3*s
 //	Greater-than comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecGreater3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl bvec3 ijkVecGreater3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecAnd3*s
 //	Component-wise logical 'and' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecAnd3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl bvec3 ijkVecAnd3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecNand3*s
 //	Component-wise logical 'nand' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecNand3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl bvec3 ijkVecNand3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecOr3*s
 //	Component-wise logical 'or' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecOr3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl bvec3 ijkVecOr3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecNor3*s
 //	Component-wise logical 'nor' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecNor3fs(fvec3 const v_lh, float const s_rh);
+ijk_inl bvec3 ijkVecNor3fs(fvec3 const v_lh, float const s_rh);
 
 // ijkVecCopy3x*
 //	Copy 3D vector from 2D vector and one scalar.
 //		param x: first element
 //		param v_yz: input 2D vector holding last two components
 //		return: result vector
-fvec3 ijkVecCopy3xf(float const x, fvec2 const v_yz);
+ijk_inl fvec3 ijkVecCopy3xf(float const x, fvec2 const v_yz);
 
 // ijkVecAdd3s*
 //	Calculate sum of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec3 ijkVecAdd3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecAdd3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecSub3s*
 //	Calculate difference of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec3 ijkVecSub3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecSub3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecMul3s*
 //	Calculate product of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec3 ijkVecMul3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecMul3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecDiv3s*
 //	Calculate quotient of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec3 ijkVecDiv3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecDiv3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecDivSafe3s*
 //	Calculate quotient of scalar by 3D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec3 ijkVecDivSafe3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecDivSafe3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecMod3s*
 //	Calculate remainder of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec3 ijkVecMod3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecMod3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecModSafe3s*
 //	Calculate remainder of scalar by 3D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec3 ijkVecModSafe3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecModSafe3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecEqual3s*
 //	Equality comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecEqual3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecEqual3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecInequal3s*
 //	Inequality comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecInequal3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecInequal3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecLessEqual3s*
 //	Less-than or equal comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLessEqual3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecLessEqual3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecGreaterEqual3s*
 //	Greater-than or equal comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecLess3s*
 //	Less-than comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLess3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecLess3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecGreater3s*
 //	Greater-than comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreater3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreater3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecAnd3s*
 //	Component-wise logical 'and' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecAnd3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecAnd3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecNand3s*
 //	Component-wise logical 'nand' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNand3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecNand3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecOr3s*
 //	Component-wise logical 'or' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecOr3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecOr3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecNor3s*
 //	Component-wise logical 'nor' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNor3sf(float const s_lh, fvec3 const v_rh);
+ijk_inl bvec3 ijkVecNor3sf(float const s_lh, fvec3 const v_rh);
 
 // ijkVecDot3*
 //	Dot product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-float ijkVecDot3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl float ijkVecDot3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecCross3*
 //	Cross product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: cross product
-fvec3 ijkVecCross3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecCross3f(fvec3 const v_lh, fvec3 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -2564,7 +2564,7 @@ fvec3 ijkVecCross3f(fvec3 const v_lh, fvec3 const v_rh);
 // ijkVecInit4*
 //	Initialize 4D vector to default value (zero vector).
 //		return: default vector
-fvec4 ijkVecInit4f();
+ijk_inl fvec4 ijkVecInit4f();
 
 // ijkVecInitElems4*
 //	Initialize 4D vector to specified individual elements.
@@ -2573,7 +2573,7 @@ fvec4 ijkVecInit4f();
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for pofloat, 0 for vector)
 //		return: result vector
-fvec4 ijkVecInitElems4f(float const x, float const y, float const z, float const w);
+ijk_inl fvec4 ijkVecInitElems4f(float const x, float const y, float const z, float const w);
 
 // ijkVecCopy4x*w
 //	Copy 4D vector from scalar, 2D vector and another scalar.
@@ -2581,151 +2581,151 @@ fvec4 ijkVecInitElems4f(float const x, float const y, float const z, float const
 //		param v_yz: input 2D vector holding middle two components
 //		param w: fourth element (in space, set as 1 for pofloat, 0 for vector)
 //		return: result vector
-fvec4 ijkVecCopy4xfw(float const x, fvec2 const v_yz, float const w);
+ijk_inl fvec4 ijkVecCopy4xfw(float const x, fvec2 const v_yz, float const w);
 
 // ijkVecCopy4*2
 //	Copy 4D vector from two 2D vectors.
 //		param v_xy: input 2D vector holding first two components
 //		param v_zw: input 2D vector holding last two components
 //		return: result vector
-fvec4 ijkVecCopy4f2(fvec2 const v_xy, fvec2 const v_zw);
+ijk_inl fvec4 ijkVecCopy4f2(fvec2 const v_xy, fvec2 const v_zw);
 
 // ijkVecCopy4*
 //	Copy 4D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-fvec4 ijkVecCopy4f(fvec4 const v_in);
+ijk_inl fvec4 ijkVecCopy4f(fvec4 const v_in);
 
 // ijkVecNegate4*
 //	Negate 4D vector.
 //		param v_in: input vector
 //		return: result vector
-fvec4 ijkVecNegate4f(fvec4 const v_in);
+ijk_inl fvec4 ijkVecNegate4f(fvec4 const v_in);
 
 // ijkVecNot4*
 //	Calculate component-wise logical 'not' of 4D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec4 ijkVecNot4f(fvec4 const v_in);
+ijk_inl bvec4 ijkVecNot4f(fvec4 const v_in);
 
 // ijkVecAdd4*
 //	Calculate sum of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec4 ijkVecAdd4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecAdd4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecSub4*
 //	Calculate difference of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec4 ijkVecSub4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecSub4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecMul4*
 //	Calculate component-wise product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec4 ijkVecMul4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecMul4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecDiv4*
 //	Calculate component-wise quotient of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec4 ijkVecDiv4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecDiv4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecDivSafe4*
 //	Calculate component-wise quotient of 4D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec4 ijkVecDivSafe4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecDivSafe4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecMod4*
 //	Calculate component-wise remainder of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec4 ijkVecMod4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecMod4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecModSafe4*
 //	Calculate component-wise remainder of 4D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec4 ijkVecModSafe4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecModSafe4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecEqual4*
 //	Equality comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecEqual4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecEqual4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecInequal4*
 //	Inequality comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecInequal4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecInequal4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecLessEqual4*
 //	Less-than or equal comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLessEqual4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecLessEqual4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecGreaterEqual4*
 //	Greater-than or equal comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecLess4*
 //	Less-than comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLess4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecLess4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecGreater4*
 //	Greater-than comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreater4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreater4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecAnd4*
 //	Component-wise logical 'and' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecAnd4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecAnd4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecNand4*
 //	Component-wise logical 'nand' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNand4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecNand4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecOr4*
 //	Component-wise logical 'or' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecOr4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecOr4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecNor4*
 //	Component-wise logical 'nor' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNor4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecNor4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecCopy4*zw
 //	Copy 4D vector from 2D vector and two scalars.
@@ -2733,151 +2733,151 @@ bvec4 ijkVecNor4f(fvec4 const v_lh, fvec4 const v_rh);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for pofloat, 0 for vector)
 //		return: result vector
-fvec4 ijkVecCopy4fzw(fvec2 const v_xy, float const z, float const w);
+ijk_inl fvec4 ijkVecCopy4fzw(fvec2 const v_xy, float const z, float const w);
 
 // ijkVecCopy4*w
 //	Copy 4D vector from 3D vector and one scalar.
 //		param v_xyz: input 3D vector holding first three components
 //		param w: fourth element (in space, set as 1 for pofloat, 0 for vector)
 //		return: result vector
-fvec4 ijkVecCopy4fw(fvec3 const v_xyz, float const w);
+ijk_inl fvec4 ijkVecCopy4fw(fvec3 const v_xyz, float const w);
 
 // ijkVecCopy4*s
 //	Copy 4D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-fvec4 ijkVecCopy4fs(float const s_in);
+ijk_inl fvec4 ijkVecCopy4fs(float const s_in);
 
 // ijkVecNegate4*s
 //	Negate scalar to 4D vector.
 //		param s_in: input scalar
 //		return: result vector
-fvec4 ijkVecNegate4fs(float const s_in);
+ijk_inl fvec4 ijkVecNegate4fs(float const s_in);
 
 // ijkVecNot4*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec4 ijkVecNot4fs(float const s_in);
+ijk_inl bvec4 ijkVecNot4fs(float const s_in);
 
 // ijkVecAdd4*s
 //	Calculate sum of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec4 ijkVecAdd4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl fvec4 ijkVecAdd4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecSub4*s
 //	Calculate difference of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec4 ijkVecSub4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl fvec4 ijkVecSub4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecMul4*s
 //	Calculate product of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec4 ijkVecMul4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl fvec4 ijkVecMul4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecDiv4*s
 //	Calculate quotient of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec4 ijkVecDiv4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl fvec4 ijkVecDiv4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecDivSafe4*s
 //	Calculate quotient of 4D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec4 ijkVecDivSafe4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl fvec4 ijkVecDivSafe4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecMod4*s
 //	Calculate remainder of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec4 ijkVecMod4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl fvec4 ijkVecMod4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecModSafe4*s
 //	Calculate remainder of 4D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-fvec4 ijkVecModSafe4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl fvec4 ijkVecModSafe4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecEqual4*s
 //	Equality comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecEqual4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl bvec4 ijkVecEqual4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecInequal4*s
 //	Inequality comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecInequal4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl bvec4 ijkVecInequal4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecLessEqual4*s
 //	Less-than or equal comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecLessEqual4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl bvec4 ijkVecLessEqual4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecGreaterEqual4*s
 //	Greater-than or equal comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecLess4*s
 //	Less-than comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecLess4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl bvec4 ijkVecLess4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecGreater4*s
 //	Greater-than comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecGreater4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl bvec4 ijkVecGreater4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecAnd4*s
 //	Component-wise logical 'and' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecAnd4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl bvec4 ijkVecAnd4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecNand4*s
 //	Component-wise logical 'nand' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecNand4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl bvec4 ijkVecNand4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecOr4*s
 //	Component-wise logical 'or' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecOr4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl bvec4 ijkVecOr4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecNor4*s
 //	Component-wise logical 'nor' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecNor4fs(fvec4 const v_lh, float const s_rh);
+ijk_inl bvec4 ijkVecNor4fs(fvec4 const v_lh, float const s_rh);
 
 // ijkVecCopy4xy*
 //	Copy 4D vector from two scalars and 2D vector.
@@ -2885,147 +2885,147 @@ bvec4 ijkVecNor4fs(fvec4 const v_lh, float const s_rh);
 //		param y: second element
 //		param v_zw: input 2D vector holding last two components
 //		return: result vector
-fvec4 ijkVecCopy4xyf(float const x, float const y, fvec2 const v_zw);
+ijk_inl fvec4 ijkVecCopy4xyf(float const x, float const y, fvec2 const v_zw);
 
 // ijkVecCopy4x*
 //	Copy 4D vector from one scalar and 3D vector.
 //		param x: first element
 //		param v_yzw: input 3D vector holding last three components
 //		return: result vector
-fvec4 ijkVecCopy4xf(float const x, fvec3 const v_yzw);
+ijk_inl fvec4 ijkVecCopy4xf(float const x, fvec3 const v_yzw);
 
 // ijkVecAdd4s*
 //	Calculate sum of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec4 ijkVecAdd4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecAdd4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecSub4s*
 //	Calculate difference of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec4 ijkVecSub4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecSub4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecMul4s*
 //	Calculate product of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec4 ijkVecMul4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecMul4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecDiv4s*
 //	Calculate quotient of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec4 ijkVecDiv4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecDiv4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecDivSafe4s*
 //	Calculate quotient of scalar by 4D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec4 ijkVecDivSafe4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecDivSafe4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecMod4s*
 //	Calculate remainder of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec4 ijkVecMod4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecMod4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecModSafe4s*
 //	Calculate remainder of scalar by 4D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-fvec4 ijkVecModSafe4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecModSafe4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecEqual4s*
 //	Equality comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecEqual4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecEqual4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecInequal4s*
 //	Inequality comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecInequal4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecInequal4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecLessEqual4s*
 //	Less-than or equal comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLessEqual4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecLessEqual4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecGreaterEqual4s*
 //	Greater-than or equal comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecLess4s*
 //	Less-than comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLess4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecLess4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecGreater4s*
 //	Greater-than comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreater4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreater4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecAnd4s*
 //	Component-wise logical 'and' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecAnd4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecAnd4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecNand4s*
 //	Component-wise logical 'nand' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNand4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecNand4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecOr4s*
 //	Component-wise logical 'or' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecOr4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecOr4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecNor4s*
 //	Component-wise logical 'nor' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNor4sf(float const s_lh, fvec4 const v_rh);
+ijk_inl bvec4 ijkVecNor4sf(float const s_lh, fvec4 const v_rh);
 
 // ijkVecDot4*
 //	Dot product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-float ijkVecDot4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl float ijkVecDot4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecCross4*
 //	Cross product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: cross product (fourth component is zero)
-fvec4 ijkVecCross4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecCross4f(fvec4 const v_lh, fvec4 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -3040,51 +3040,51 @@ extern "C" {
 //	Calculate the squared length of a vector.
 //		param v_in: input vector
 //		return: squared length
-f32 ijkVecLengthSq2fv(float2 const v_in);
+ijk_inl f32 ijkVecLengthSq2fv(float2 const v_in);
 
 // ijkVecLength2*v
 //	Calculate the length of a vector.
 //		param v_in: input vector
 //		return: length
-f32 ijkVecLength2fv(float2 const v_in);
+ijk_inl f32 ijkVecLength2fv(float2 const v_in);
 
 // ijkVecLengthSqInv2*v
 //	Calculate the inverse squared length of a vector.
 //		param v_in: input vector
 //		return: inverse squared length
-f32 ijkVecLengthSqInv2fv(float2 const v_in);
+ijk_inl f32 ijkVecLengthSqInv2fv(float2 const v_in);
 
 // ijkVecLengthSqInvSafe2*v
 //	Calculate the inverse squared length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse squared length
-f32 ijkVecLengthSqInvSafe2fv(float2 const v_in);
+ijk_inl f32 ijkVecLengthSqInvSafe2fv(float2 const v_in);
 
 // ijkVecLengthInv2*v
 //	Calculate the inverse length of a vector.
 //		param v_in: input vector
 //		return: inverse length
-f32 ijkVecLengthInv2fv(float2 const v_in);
+ijk_inl f32 ijkVecLengthInv2fv(float2 const v_in);
 
 // ijkVecLengthInvSafe2*v
 //	Calculate the inverse length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse length
-f32 ijkVecLengthInvSafe2fv(float2 const v_in);
+ijk_inl f32 ijkVecLengthInvSafe2fv(float2 const v_in);
 
 // ijkVecNormalize2*v
 //	Calculate the unit-length direction of a vector.
 //		param v_out: output vector
 //		param v_in: input vector
 //		return: v_out
-floatv ijkVecNormalize2fv(float2 v_out, float2 const v_in);
+ijk_inl floatv ijkVecNormalize2fv(float2 v_out, float2 const v_in);
 
 // ijkVecNormalizeSafe2*v
 //	Calculate the unit-length direction of a vector; division-by-zero safe.
 //		param v_out: output vector
 //		param v_in: input vector
 //		return: v_out
-floatv ijkVecNormalizeSafe2fv(float2 v_out, float2 const v_in);
+ijk_inl floatv ijkVecNormalizeSafe2fv(float2 v_out, float2 const v_in);
 
 // ijkVecNormalizeGetLength2*v
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -3093,7 +3093,7 @@ floatv ijkVecNormalizeSafe2fv(float2 v_out, float2 const v_in);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecNormalizeGetLength2fv(float2 v_out, float2 const v_in, f32* const length_out);
+ijk_inl floatv ijkVecNormalizeGetLength2fv(float2 v_out, float2 const v_in, f32* const length_out);
 
 // ijkVecNormalizeSafeGetLength2*v
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -3102,7 +3102,7 @@ floatv ijkVecNormalizeGetLength2fv(float2 v_out, float2 const v_in, f32* const l
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecNormalizeSafeGetLength2fv(float2 v_out, float2 const v_in, f32* const length_out);
+ijk_inl floatv ijkVecNormalizeSafeGetLength2fv(float2 v_out, float2 const v_in, f32* const length_out);
 
 // ijkVecNormalizeGetLengthInv2*v
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -3111,7 +3111,7 @@ floatv ijkVecNormalizeSafeGetLength2fv(float2 v_out, float2 const v_in, f32* con
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecNormalizeGetLengthInv2fv(float2 v_out, float2 const v_in, f32* const lengthInv_out);
+ijk_inl floatv ijkVecNormalizeGetLengthInv2fv(float2 v_out, float2 const v_in, f32* const lengthInv_out);
 
 // ijkVecNormalizeSafeGetLengthInv2*v
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -3120,21 +3120,21 @@ floatv ijkVecNormalizeGetLengthInv2fv(float2 v_out, float2 const v_in, f32* cons
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecNormalizeSafeGetLengthInv2fv(float2 v_out, float2 const v_in, f32* const lengthInv_out);
+ijk_inl floatv ijkVecNormalizeSafeGetLengthInv2fv(float2 v_out, float2 const v_in, f32* const lengthInv_out);
 
 // ijkVecCrossNormalize2*v
 //	Calculate unit-length result of cross product.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar cross product sign
-f32 ijkVecCrossNormalize2fv(float2 const v_lh, float2 const v_rh);
+ijk_inl f32 ijkVecCrossNormalize2fv(float2 const v_lh, float2 const v_rh);
 
 // ijkVecCrossNormalizeSafe2*v
 //	Calculate unit-length result of cross product; division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar cross product sign
-f32 ijkVecCrossNormalizeSafe2fv(float2 const v_lh, float2 const v_rh);
+ijk_inl f32 ijkVecCrossNormalizeSafe2fv(float2 const v_lh, float2 const v_rh);
 
 // ijkVecCrossNormalizeGetLength2*v
 //	Calculate unit-length result of cross product; also capture length.
@@ -3142,7 +3142,7 @@ f32 ijkVecCrossNormalizeSafe2fv(float2 const v_lh, float2 const v_rh);
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: scalar cross product sign
-f32 ijkVecCrossNormalizeGetLength2fv(float2 const v_lh, float2 const v_rh, f32* const length_out);
+ijk_inl f32 ijkVecCrossNormalizeGetLength2fv(float2 const v_lh, float2 const v_rh, f32* const length_out);
 
 // ijkVecCrossNormalizeSafeGetLength2*v
 //	Calculate unit-length result of cross product; also capture length; 
@@ -3151,7 +3151,7 @@ f32 ijkVecCrossNormalizeGetLength2fv(float2 const v_lh, float2 const v_rh, f32*
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: scalar cross product sign
-f32 ijkVecCrossNormalizeSafeGetLength2fv(float2 const v_lh, float2 const v_rh, f32* const length_out);
+ijk_inl f32 ijkVecCrossNormalizeSafeGetLength2fv(float2 const v_lh, float2 const v_rh, f32* const length_out);
 
 // ijkVecCrossNormalizeGetLengthInv2*v
 //	Calculate unit-length result of cross product; also capture inverse length.
@@ -3159,7 +3159,7 @@ f32 ijkVecCrossNormalizeSafeGetLength2fv(float2 const v_lh, float2 const v_rh, f
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: scalar cross product sign
-f32 ijkVecCrossNormalizeGetLengthInv2fv(float2 const v_lh, float2 const v_rh, f32* const lengthInv_out);
+ijk_inl f32 ijkVecCrossNormalizeGetLengthInv2fv(float2 const v_lh, float2 const v_rh, f32* const lengthInv_out);
 
 // ijkVecCrossNormalizeSafeGetLengthInv2*v
 //	Calculate unit-length result of cross product; also capture inverse length;
@@ -3168,7 +3168,7 @@ f32 ijkVecCrossNormalizeGetLengthInv2fv(float2 const v_lh, float2 const v_rh, f3
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: scalar cross product sign
-f32 ijkVecCrossNormalizeSafeGetLengthInv2fv(float2 const v_lh, float2 const v_rh, f32* const lengthInv_out);
+ijk_inl f32 ijkVecCrossNormalizeSafeGetLengthInv2fv(float2 const v_lh, float2 const v_rh, f32* const lengthInv_out);
 
 // ijkVecLerp2*v
 //	Vector linear interpolation.
@@ -3178,7 +3178,7 @@ f32 ijkVecCrossNormalizeSafeGetLengthInv2fv(float2 const v_lh, float2 const v_rh
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-floatv ijkVecLerp2fv(float2 v_out, float2 const v0, float2 const v1, f32 const u);
+ijk_inl floatv ijkVecLerp2fv(float2 v_out, float2 const v0, float2 const v1, f32 const u);
 
 // ijkVecLerpInv2*v
 //	Vector linear interpolation inverse to calculate parameters given control .
@@ -3188,7 +3188,7 @@ floatv ijkVecLerp2fv(float2 v_out, float2 const v0, float2 const v1, f32 const u
 //		param v_lerp: interpolated vector used to calculate parameters; params 
 //			in range [0,1] indicate interpolation, others for extrapolation
 //		return: v_out
-floatv ijkVecLerpInv2fv(float2 v_out, float2 const v0, float2 const v1, float2 const v_lerp);
+ijk_inl floatv ijkVecLerpInv2fv(float2 v_out, float2 const v0, float2 const v1, float2 const v_lerp);
 
 // ijkVecLerpRevInit2*v
 //	Vector linear interpolation reversal to calculate initial control.
@@ -3198,7 +3198,7 @@ floatv ijkVecLerpInv2fv(float2 v_out, float2 const v0, float2 const v1, float2 c
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v0_out
-floatv ijkVecLerpRevInit2fv(float2 v0_out, float2 const v_lerp, float2 const v1, f32 const u);
+ijk_inl floatv ijkVecLerpRevInit2fv(float2 v0_out, float2 const v_lerp, float2 const v1, f32 const u);
 
 // ijkVecLerpRevTerm2*v
 //	Vector linear interpolation reversal to calculate terminal control.
@@ -3208,14 +3208,14 @@ floatv ijkVecLerpRevInit2fv(float2 v0_out, float2 const v_lerp, float2 const v1,
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v1_out
-floatv ijkVecLerpRevTerm2fv(float2 v1_out, float2 const v0, float2 const v_lerp, f32 const u);
+ijk_inl floatv ijkVecLerpRevTerm2fv(float2 v1_out, float2 const v0, float2 const v_lerp, f32 const u);
 
 // ijkVecProjRatio2*v
 //	Calculate projection length ratio.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: length ratio of projected vector to base
-f32 ijkVecProjRatio2fv(float2 const v_base, float2 const v_in);
+ijk_inl f32 ijkVecProjRatio2fv(float2 const v_base, float2 const v_in);
 
 // ijkVecProj2*v
 //	Vector projection.
@@ -3223,7 +3223,7 @@ f32 ijkVecProjRatio2fv(float2 const v_base, float2 const v_in);
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: v_out
-floatv ijkVecProj2fv(float2 v_out, float2 const v_base, float2 const v_in);
+ijk_inl floatv ijkVecProj2fv(float2 v_out, float2 const v_base, float2 const v_in);
 
 // ijkVecOrtho2*v
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -3232,7 +3232,7 @@ floatv ijkVecProj2fv(float2 v_out, float2 const v_base, float2 const v_in);
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be orthogonalized
 //		return: v_out
-floatv ijkVecOrtho2fv(float2 v_out, float2 const v_base, float2 const v_in);
+ijk_inl floatv ijkVecOrtho2fv(float2 v_out, float2 const v_base, float2 const v_in);
 
 // ijkVecOrthoNorm2*v
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -3242,7 +3242,7 @@ floatv ijkVecOrtho2fv(float2 v_out, float2 const v_base, float2 const v_in);
 //		param v_in: input vector to be orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: v_out
-floatv ijkVecOrthoNorm2fv(float2 v_out, float2 const v_base, float2 const v_in, float2 v_base_norm_out);
+ijk_inl floatv ijkVecOrthoNorm2fv(float2 v_out, float2 const v_base, float2 const v_in, float2 v_base_norm_out);
 
 // ijkVecOrthoList2*v
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -3251,7 +3251,7 @@ floatv ijkVecOrthoNorm2fv(float2 v_out, float2 const v_base, float2 const v_in,
 //		param vl_in: input list of vectors to be orthogonalized
 //		param n: number of vectors to orthogonalize
 //		return: vl_out
-float2* ijkVecOrthoList2fv(float2 vl_out[], float2 const v_base, float2 const vl_in[], size const n);
+ijk_inl float2* ijkVecOrthoList2fv(float2 vl_out[], float2 const v_base, float2 const vl_in[], size const n);
 
 // ijkVecOrthoNormList2*v
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -3261,7 +3261,7 @@ float2* ijkVecOrthoList2fv(float2 vl_out[], float2 const v_base, float2 const vl
 //		param n: number of vectors to orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: vl_out
-float2* ijkVecOrthoNormList2fv(float2 vl_out[], float2 const v_base, float2 const vl_in[], size const n, float2 v_base_norm_out);
+ijk_inl float2* ijkVecOrthoNormList2fv(float2 vl_out[], float2 const v_base, float2 const vl_in[], size const n, float2 v_base_norm_out);
 
 // ijkVecNlerp2*v
 //	Calculate normalized linear interpolation between two 2D vectors; keeps
@@ -3272,7 +3272,7 @@ float2* ijkVecOrthoNormList2fv(float2 vl_out[], float2 const v_base, float2 cons
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-floatv ijkVecNlerp2fv(float2 v_out, float2 const v0, float2 const v1, f32 const u);
+ijk_inl floatv ijkVecNlerp2fv(float2 v_out, float2 const v0, float2 const v1, f32 const u);
 
 // ijkVecSlerp2*v
 //	Calculate spherical linear interpolation between two unit 2D vectors; keeps
@@ -3283,7 +3283,7 @@ floatv ijkVecNlerp2fv(float2 v_out, float2 const v0, float2 const v1, f32 const
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-floatv ijkVecSlerp2fv(float2 v_out, float2 const v0, float2 const v1, f32 const u);
+ijk_inl floatv ijkVecSlerp2fv(float2 v_out, float2 const v0, float2 const v1, f32 const u);
 
 // ijkVecReflectScale2*v
 //	Reflect incident vector about normal, scaling to match normal size.
@@ -3291,7 +3291,7 @@ floatv ijkVecSlerp2fv(float2 v_out, float2 const v0, float2 const v1, f32 const
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-floatv ijkVecReflectScale2fv(float2 v_out, float2 const v_in, float2 const v_nrm);
+ijk_inl floatv ijkVecReflectScale2fv(float2 v_out, float2 const v_in, float2 const v_nrm);
 
 // ijkVecUnitReflect2*v
 //	Reflect incident vector about normal; optimized for unit normal vector.
@@ -3299,7 +3299,7 @@ floatv ijkVecReflectScale2fv(float2 v_out, float2 const v_in, float2 const v_nrm
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-floatv ijkVecUnitReflect2fv(float2 v_out, float2 const v_in, float2 const v_nrm);
+ijk_inl floatv ijkVecUnitReflect2fv(float2 v_out, float2 const v_in, float2 const v_nrm);
 
 // ijkVecReflect2*v
 //	Reflect incident vector about normal.
@@ -3307,14 +3307,14 @@ floatv ijkVecUnitReflect2fv(float2 v_out, float2 const v_in, float2 const v_nrm)
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-floatv ijkVecReflect2fv(float2 v_out, float2 const v_in, float2 const v_nrm);
+ijk_inl floatv ijkVecReflect2fv(float2 v_out, float2 const v_in, float2 const v_nrm);
 
 // ijkVecDistance2*v
 //	Calculate distance between two points.
 //		param v_lh: left-hand input
 //		param v_rh: right-hand input
 //		return: distance between inputs
-f32 ijkVecDistance2fv(float2 const v_lh, float2 const v_rh);
+ijk_inl f32 ijkVecDistance2fv(float2 const v_lh, float2 const v_rh);
 
 // ijkVecResize2*v
 //	Change length of vector, retaining direction.
@@ -3322,7 +3322,7 @@ f32 ijkVecDistance2fv(float2 const v_lh, float2 const v_rh);
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: v_out
-floatv ijkVecResize2fv(float2 v_out, float2 const v_in, f32 const length);
+ijk_inl floatv ijkVecResize2fv(float2 v_out, float2 const v_in, f32 const length);
 
 // ijkVecResizeSafe2*v
 //	Change length of vector, retaining direction; division-by-zero safe.
@@ -3330,7 +3330,7 @@ floatv ijkVecResize2fv(float2 v_out, float2 const v_in, f32 const length);
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: v_out
-floatv ijkVecResizeSafe2fv(float2 v_out, float2 const v_in, f32 const length);
+ijk_inl floatv ijkVecResizeSafe2fv(float2 v_out, float2 const v_in, f32 const length);
 
 // ijkVecCrossResize2*v
 //	Change length of cross product result, retaining direction.
@@ -3338,7 +3338,7 @@ floatv ijkVecResizeSafe2fv(float2 v_out, float2 const v_in, f32 const length);
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized scalar cross product
-f32 ijkVecCrossResize2fv(float2 const v_lh, float2 const v_rh, f32 const length);
+ijk_inl f32 ijkVecCrossResize2fv(float2 const v_lh, float2 const v_rh, f32 const length);
 
 // ijkVecCrossResizeSafe2*v
 //	Change length of cross product result, retaining direction; 
@@ -3347,7 +3347,7 @@ f32 ijkVecCrossResize2fv(float2 const v_lh, float2 const v_rh, f32 const length)
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized scalar cross product
-f32 ijkVecCrossResizeSafe2fv(float2 const v_lh, float2 const v_rh, f32 const length);
+ijk_inl f32 ijkVecCrossResizeSafe2fv(float2 const v_lh, float2 const v_rh, f32 const length);
 
 // ijkVecNearest2*v
 //	Nearest-neighbor interpolation between two reference values.
@@ -3356,7 +3356,7 @@ f32 ijkVecCrossResizeSafe2fv(float2 const v_lh, float2 const v_rh, f32 const len
 //		param v1: terminal reference value/end point, result when t>=0.5
 //		param u: interpolation parameter
 //		return: v_out
-floatv ijkVecNearest2fv(float2 v_out, float2 const v0, float2 const v1, f32 const u);
+ijk_inl floatv ijkVecNearest2fv(float2 v_out, float2 const v0, float2 const v1, f32 const u);
 
 // ijkVecBinearest2*v
 //	Nearest-neighbor interpolation of nearest-neighbor interpolated values.
@@ -3373,7 +3373,7 @@ floatv ijkVecNearest2fv(float2 v_out, float2 const v0, float2 const v1, f32 cons
 //		param u1: interpolation parameter for second pair
 //		param u: interpolation parameter for results
 //		return: v_out
-floatv ijkVecBinearest2fv(float2 v_out, float2 const v00, float2 const v01, float2 const v10, float2 const v11, f32 const u0, f32 const u1, f32 const u);
+ijk_inl floatv ijkVecBinearest2fv(float2 v_out, float2 const v00, float2 const v01, float2 const v10, float2 const v11, f32 const u0, f32 const u1, f32 const u);
 
 // ijkVecRemap2*v
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -3388,7 +3388,7 @@ floatv ijkVecBinearest2fv(float2 v_out, float2 const v00, float2 const v01, floa
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: v_out
-floatv ijkVecRemap2fv(float2 v_out, float2 const v0_dst, float2 const v1_dst, float2 const v0_src, float2 const v1_src, float2 const v_src);
+ijk_inl floatv ijkVecRemap2fv(float2 v_out, float2 const v0_dst, float2 const v1_dst, float2 const v0_src, float2 const v1_src, float2 const v_src);
 
 // ijkVecBezier0O2*v
 //	Perform order-0 (point) Bezier interpolation given one reference value.
@@ -3396,7 +3396,7 @@ floatv ijkVecRemap2fv(float2 v_out, float2 const v0_dst, float2 const v1_dst, fl
 //		param v0: reference value, always returned
 //		param u: interpolation parameter; not used for order 0 interpolation
 //		return: v_out
-floatv ijkVecBezier0O2fv(float2 v_out, float2 const v0, f32 const u);
+ijk_inl floatv ijkVecBezier0O2fv(float2 v_out, float2 const v0, f32 const u);
 
 // ijkVecBezier1O2*v
 //	Perform order-1 (linear) Bezier interpolation given two reference values.
@@ -3406,7 +3406,7 @@ floatv ijkVecBezier0O2fv(float2 v_out, float2 const v0, f32 const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-floatv ijkVecBezier1O2fv(float2 v_out, float2 const v0, float2 const v1, f32 const u);
+ijk_inl floatv ijkVecBezier1O2fv(float2 v_out, float2 const v0, float2 const v1, f32 const u);
 
 // ijkVecBezier2O2*v
 //	Perform order-2 (quadratic) Bezier interpolation given three reference 
@@ -3418,7 +3418,7 @@ floatv ijkVecBezier1O2fv(float2 v_out, float2 const v0, float2 const v1, f32 con
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v2
 //		return: v_out
-floatv ijkVecBezier2O2fv(float2 v_out, float2 const v0, float2 const v1, float2 const v2, f32 const u);
+ijk_inl floatv ijkVecBezier2O2fv(float2 v_out, float2 const v0, float2 const v1, float2 const v2, f32 const u);
 
 // ijkVecBezier3O2*v
 //	Perform order-3 (cubic) Bezier interpolation given four reference values.
@@ -3430,7 +3430,7 @@ floatv ijkVecBezier2O2fv(float2 v_out, float2 const v0, float2 const v1, float2
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v3
 //		return: v_out
-floatv ijkVecBezier3O2fv(float2 v_out, float2 const v0, float2 const v1, float2 const v2, float2 const v3, f32 const u);
+ijk_inl floatv ijkVecBezier3O2fv(float2 v_out, float2 const v0, float2 const v1, float2 const v2, float2 const v3, f32 const u);
 
 // ijkVecBezierNO2*v
 //	Perform order-N (recursive) Bezier interpolation given an array of 
@@ -3444,7 +3444,7 @@ floatv ijkVecBezier3O2fv(float2 v_out, float2 const v0, float2 const v1, float2
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v[0] and v[order]
 //		return: v_out
-floatv ijkVecBezierNO2fv(float2 v_out, float2 const v[], size const order, f32 const u);
+ijk_inl floatv ijkVecBezierNO2fv(float2 v_out, float2 const v[], size const order, f32 const u);
 
 // ijkVecCubicHermite2*v
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -3457,7 +3457,7 @@ floatv ijkVecBezierNO2fv(float2 v_out, float2 const v[], size const order, f32 c
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-floatv ijkVecCubicHermite2fv(float2 v_out, float2 const v0, float2 const dv0, float2 const v1, float2 const dv1, f32 const u);
+ijk_inl floatv ijkVecCubicHermite2fv(float2 v_out, float2 const v0, float2 const dv0, float2 const v1, float2 const dv1, f32 const u);
 
 // ijkVecCubicHermiteHandles2*v
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -3472,7 +3472,7 @@ floatv ijkVecCubicHermite2fv(float2 v_out, float2 const v0, float2 const dv0, fl
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-floatv ijkVecCubicHermiteHandles2fv(float2 v_out, float2 const v0, float2 const cv0, float2 const v1, float2 const cv1, f32 const u);
+ijk_inl floatv ijkVecCubicHermiteHandles2fv(float2 v_out, float2 const v0, float2 const cv0, float2 const v1, float2 const cv1, f32 const u);
 
 // ijkVecCubicCatmullRom2*v
 //	Catmull-Rom spline/curve interpolation between two reference values with 
@@ -3485,7 +3485,7 @@ floatv ijkVecCubicHermiteHandles2fv(float2 v_out, float2 const v0, float2 const
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-floatv ijkVecCubicCatmullRom2fv(float2 v_out, float2 const vp, float2 const v0, float2 const v1, float2 const v2, f32 const u);
+ijk_inl floatv ijkVecCubicCatmullRom2fv(float2 v_out, float2 const vp, float2 const v0, float2 const v1, float2 const v2, f32 const u);
 
 // ijkVecBicubicCatmullRom2*v
 //	Bi-cubic interpolation using Catmull-Rom interpolation for segments.
@@ -3520,7 +3520,7 @@ floatv ijkVecCubicCatmullRom2fv(float2 v_out, float2 const vp, float2 const v0,
 //		param u2: interpolation parameter for terminal control curve
 //		param u: interpolation parameter for result
 //		return: v_out
-floatv ijkVecBicubicCatmullRom2fv(float2 v_out, float2 const vpp, float2 const vp0, float2 const vp1, float2 const vp2, float2 const v0p, float2 const v00, float2 const v01, float2 const v02, float2 const v1p, float2 const v10, float2 const v11, float2 const v12, float2 const v2p, float2 const v20, float2 const v21, float2 const v22, f32 const up, f32 const u0, f32 const u1, f32 const u2, f32 const u);
+ijk_inl floatv ijkVecBicubicCatmullRom2fv(float2 v_out, float2 const vpp, float2 const vp0, float2 const vp1, float2 const vp2, float2 const v0p, float2 const v00, float2 const v01, float2 const v02, float2 const v1p, float2 const v10, float2 const v11, float2 const v12, float2 const v2p, float2 const v20, float2 const v21, float2 const v22, f32 const up, f32 const u0, f32 const u1, f32 const u2, f32 const u);
 
 // ijkVecReparamCubicHermite2*v
 //	Reparameterize a cubic Hermite segment into sample table.
@@ -3540,7 +3540,7 @@ floatv ijkVecBicubicCatmullRom2fv(float2 v_out, float2 const vpp, float2 const v
 //		param v1: terminal reference value/end point, result when t=1
 //		param dv1: terminal tangent/rate of change
 //		return: total arc length
-f32 ijkVecReparamCubicHermite2fv(f32 uTable_out[], f32 lTable_out[], float2 vTable_out[], size const numDivisions, ibool const lNormalize, float2 const v0, float2 const dv0, float2 const v1, float2 const dv1);
+ijk_inl f32 ijkVecReparamCubicHermite2fv(f32 uTable_out[], f32 lTable_out[], float2 vTable_out[], size const numDivisions, ibool const lNormalize, float2 const v0, float2 const dv0, float2 const v1, float2 const dv1);
 
 // ijkVecReparamCubicHermiteHandles2*v
 //	Reparameterize a cubic Hermite segment with handles into sample table.
@@ -3562,7 +3562,7 @@ f32 ijkVecReparamCubicHermite2fv(f32 uTable_out[], f32 lTable_out[], float2 vTab
 //		param cv1: terminal control handle value, should be greater than v1 
 //			for a positive rate of change
 //		return: total arc length
-f32 ijkVecReparamCubicHermiteHandles2fv(f32 uTable_out[], f32 lTable_out[], float2 vTable_out[], size const numDivisions, ibool const lNormalize, float2 const v0, float2 const cv0, float2 const v1, float2 const cv1);
+ijk_inl f32 ijkVecReparamCubicHermiteHandles2fv(f32 uTable_out[], f32 lTable_out[], float2 vTable_out[], size const numDivisions, ibool const lNormalize, float2 const v0, float2 const cv0, float2 const v1, float2 const cv1);
 
 // ijkVecReparamCubicCatmullRom2*v
 //	Reparameterize a cubic Catmull-Rom segment into sample table.
@@ -3582,7 +3582,7 @@ f32 ijkVecReparamCubicHermiteHandles2fv(f32 uTable_out[], f32 lTable_out[], floa
 //		param v1: terminal reference value/end point, result when t=1
 //		param v2: terminal control value
 //		return: total arc length
-f32 ijkVecReparamCubicCatmullRom2fv(f32 uTable_out[], f32 lTable_out[], float2 vTable_out[], size const numDivisions, ibool const lNormalize, float2 const vp, float2 const v0, float2 const v1, float2 const v2);
+ijk_inl f32 ijkVecReparamCubicCatmullRom2fv(f32 uTable_out[], f32 lTable_out[], float2 vTable_out[], size const numDivisions, ibool const lNormalize, float2 const vp, float2 const v0, float2 const v1, float2 const v2);
 
 // ijkVecReparamBicubicCatmullRom2*v
 //	Reparameterize a bi-cubic Catmull-Rom segment into sample table.
@@ -3626,7 +3626,7 @@ f32 ijkVecReparamCubicCatmullRom2fv(f32 uTable_out[], f32 lTable_out[], float2 v
 //		param u1: interpolation parameter for terminal value curve
 //		param u2: interpolation parameter for terminal control curve
 //		return: total arc length
-f32 ijkVecReparamBicubicCatmullRom2fv(f32 uTable_out[], f32 lTable_out[], float2 vTable_out[], size const numDivisions, ibool const lNormalize, float2 const vpp, float2 const vp0, float2 const vp1, float2 const vp2, float2 const v0p, float2 const v00, float2 const v01, float2 const v02, float2 const v1p, float2 const v10, float2 const v11, float2 const v12, float2 const v2p, float2 const v20, float2 const v21, float2 const v22, f32 const up, f32 const u0, f32 const u1, f32 const u2);
+ijk_inl f32 ijkVecReparamBicubicCatmullRom2fv(f32 uTable_out[], f32 lTable_out[], float2 vTable_out[], size const numDivisions, ibool const lNormalize, float2 const vpp, float2 const vp0, float2 const vp1, float2 const vp2, float2 const v0p, float2 const v00, float2 const v01, float2 const v02, float2 const v1p, float2 const v10, float2 const v11, float2 const v12, float2 const v2p, float2 const v20, float2 const v21, float2 const v22, f32 const up, f32 const u0, f32 const u1, f32 const u2);
 
 // ijkVecSampleTableInc2*v
 //	Find index of parameter in table and approximate value by interpolating 
@@ -3645,7 +3645,7 @@ f32 ijkVecReparamBicubicCatmullRom2fv(f32 uTable_out[], f32 lTable_out[], float2
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: v_out
-floatv ijkVecSampleTableInc2fv(float2 v_out, f32 const uTable[], float2 const vTable[], index i, index di, f32 const u);
+ijk_inl floatv ijkVecSampleTableInc2fv(float2 v_out, f32 const uTable[], float2 const vTable[], index i, index di, f32 const u);
 
 // ijkVecSampleTableDec2*v
 //	Find index of parameter in table and approximate value by interpolating 
@@ -3664,7 +3664,7 @@ floatv ijkVecSampleTableInc2fv(float2 v_out, f32 const uTable[], float2 const vT
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: v_out
-floatv ijkVecSampleTableDec2fv(float2 v_out, f32 const uTable[], float2 const vTable[], index i, index di, f32 const u);
+ijk_inl floatv ijkVecSampleTableDec2fv(float2 v_out, f32 const uTable[], float2 const vTable[], index i, index di, f32 const u);
 
 
 //-----------------------------------------------------------------------------
@@ -3673,51 +3673,51 @@ floatv ijkVecSampleTableDec2fv(float2 v_out, f32 const uTable[], float2 const vT
 //	Calculate the squared length of a vector.
 //		param v_in: input vector
 //		return: squared length
-f32 ijkVecLengthSq3fv(float3 const v_in);
+ijk_inl f32 ijkVecLengthSq3fv(float3 const v_in);
 
 // ijkVecLength3*v
 //	Calculate the length of a vector.
 //		param v_in: input vector
 //		return: length
-f32 ijkVecLength3fv(float3 const v_in);
+ijk_inl f32 ijkVecLength3fv(float3 const v_in);
 
 // ijkVecLengthSqInv3*v
 //	Calculate the inverse squared length of a vector.
 //		param v_in: input vector
 //		return: inverse squared length
-f32 ijkVecLengthSqInv3fv(float3 const v_in);
+ijk_inl f32 ijkVecLengthSqInv3fv(float3 const v_in);
 
 // ijkVecLengthSqInvSafe3*v
 //	Calculate the inverse squared length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse squared length
-f32 ijkVecLengthSqInvSafe3fv(float3 const v_in);
+ijk_inl f32 ijkVecLengthSqInvSafe3fv(float3 const v_in);
 
 // ijkVecLengthInv3*v
 //	Calculate the inverse length of a vector.
 //		param v_in: input vector
 //		return: inverse length
-f32 ijkVecLengthInv3fv(float3 const v_in);
+ijk_inl f32 ijkVecLengthInv3fv(float3 const v_in);
 
 // ijkVecLengthInvSafe3*v
 //	Calculate the inverse length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse length
-f32 ijkVecLengthInvSafe3fv(float3 const v_in);
+ijk_inl f32 ijkVecLengthInvSafe3fv(float3 const v_in);
 
 // ijkVecNormalize3*v
 //	Calculate the unit-length direction of a vector.
 //		param v_out: output vector
 //		param v_in: input vector
 //		return: v_out
-floatv ijkVecNormalize3fv(float3 v_out, float3 const v_in);
+ijk_inl floatv ijkVecNormalize3fv(float3 v_out, float3 const v_in);
 
 // ijkVecNormalizeSafe3*v
 //	Calculate the unit-length direction of a vector; division-by-zero safe.
 //		param v_out: output vector
 //		param v_in: input vector
 //		return: v_out
-floatv ijkVecNormalizeSafe3fv(float3 v_out, float3 const v_in);
+ijk_inl floatv ijkVecNormalizeSafe3fv(float3 v_out, float3 const v_in);
 
 // ijkVecNormalizeGetLength3*v
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -3726,7 +3726,7 @@ floatv ijkVecNormalizeSafe3fv(float3 v_out, float3 const v_in);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecNormalizeGetLength3fv(float3 v_out, float3 const v_in, f32* const length_out);
+ijk_inl floatv ijkVecNormalizeGetLength3fv(float3 v_out, float3 const v_in, f32* const length_out);
 
 // ijkVecNormalizeSafeGetLength3*v
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -3735,7 +3735,7 @@ floatv ijkVecNormalizeGetLength3fv(float3 v_out, float3 const v_in, f32* const l
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecNormalizeSafeGetLength3fv(float3 v_out, float3 const v_in, f32* const length_out);
+ijk_inl floatv ijkVecNormalizeSafeGetLength3fv(float3 v_out, float3 const v_in, f32* const length_out);
 
 // ijkVecNormalizeGetLengthInv3*v
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -3744,7 +3744,7 @@ floatv ijkVecNormalizeSafeGetLength3fv(float3 v_out, float3 const v_in, f32* con
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecNormalizeGetLengthInv3fv(float3 v_out, float3 const v_in, f32* const lengthInv_out);
+ijk_inl floatv ijkVecNormalizeGetLengthInv3fv(float3 v_out, float3 const v_in, f32* const lengthInv_out);
 
 // ijkVecNormalizeSafeGetLengthInv3*v
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -3753,7 +3753,7 @@ floatv ijkVecNormalizeGetLengthInv3fv(float3 v_out, float3 const v_in, f32* cons
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecNormalizeSafeGetLengthInv3fv(float3 v_out, float3 const v_in, f32* const lengthInv_out);
+ijk_inl floatv ijkVecNormalizeSafeGetLengthInv3fv(float3 v_out, float3 const v_in, f32* const lengthInv_out);
 
 // ijkVecCrossNormalize3*v
 //	Calculate unit-length result of cross product.
@@ -3761,7 +3761,7 @@ floatv ijkVecNormalizeSafeGetLengthInv3fv(float3 v_out, float3 const v_in, f32*
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecCrossNormalize3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
+ijk_inl floatv ijkVecCrossNormalize3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecCrossNormalizeSafe3*v
 //	Calculate unit-length result of cross product; division-by-zero safe.
@@ -3769,7 +3769,7 @@ floatv ijkVecCrossNormalize3fv(float3 v_out, float3 const v_lh, float3 const v_r
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecCrossNormalizeSafe3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
+ijk_inl floatv ijkVecCrossNormalizeSafe3fv(float3 v_out, float3 const v_lh, float3 const v_rh);
 
 // ijkVecCrossNormalizeGetLength3*v
 //	Calculate unit-length result of cross product; also capture length.
@@ -3778,7 +3778,7 @@ floatv ijkVecCrossNormalizeSafe3fv(float3 v_out, float3 const v_lh, float3 const
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecCrossNormalizeGetLength3fv(float3 v_out, float3 const v_lh, float3 const v_rh, f32* const length_out);
+ijk_inl floatv ijkVecCrossNormalizeGetLength3fv(float3 v_out, float3 const v_lh, float3 const v_rh, f32* const length_out);
 
 // ijkVecCrossNormalizeSafeGetLength3*v
 //	Calculate unit-length result of cross product; also capture length; 
@@ -3788,7 +3788,7 @@ floatv ijkVecCrossNormalizeGetLength3fv(float3 v_out, float3 const v_lh, float3
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecCrossNormalizeSafeGetLength3fv(float3 v_out, float3 const v_lh, float3 const v_rh, f32* const length_out);
+ijk_inl floatv ijkVecCrossNormalizeSafeGetLength3fv(float3 v_out, float3 const v_lh, float3 const v_rh, f32* const length_out);
 
 // ijkVecCrossNormalizeGetLengthInv3*v
 //	Calculate unit-length result of cross product; also capture inverse length.
@@ -3797,7 +3797,7 @@ floatv ijkVecCrossNormalizeSafeGetLength3fv(float3 v_out, float3 const v_lh, flo
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: v_out
-floatv ijkVecCrossNormalizeGetLengthInv3fv(float3 v_out, float3 const v_lh, float3 const v_rh, f32* const lengthInv_out);
+ijk_inl floatv ijkVecCrossNormalizeGetLengthInv3fv(float3 v_out, float3 const v_lh, float3 const v_rh, f32* const lengthInv_out);
 
 // ijkVecCrossNormalizeSafeGetLengthInv3*v
 //	Calculate unit-length result of cross product; also capture inverse length;
@@ -3807,7 +3807,7 @@ floatv ijkVecCrossNormalizeGetLengthInv3fv(float3 v_out, float3 const v_lh, floa
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: v_out
-floatv ijkVecCrossNormalizeSafeGetLengthInv3fv(float3 v_out, float3 const v_lh, float3 const v_rh, f32* const lengthInv_out);
+ijk_inl floatv ijkVecCrossNormalizeSafeGetLengthInv3fv(float3 v_out, float3 const v_lh, float3 const v_rh, f32* const lengthInv_out);
 
 // ijkVecLerp3*v
 //	Vector linear interpolation.
@@ -3817,7 +3817,7 @@ floatv ijkVecCrossNormalizeSafeGetLengthInv3fv(float3 v_out, float3 const v_lh,
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-floatv ijkVecLerp3fv(float3 v_out, float3 const v0, float3 const v1, f32 const u);
+ijk_inl floatv ijkVecLerp3fv(float3 v_out, float3 const v0, float3 const v1, f32 const u);
 
 // ijkVecLerpInv3*v
 //	Vector linear interpolation inverse to calculate parameters given control .
@@ -3827,7 +3827,7 @@ floatv ijkVecLerp3fv(float3 v_out, float3 const v0, float3 const v1, f32 const u
 //		param v_lerp: interpolated vector used to calculate parameters; params 
 //			in range [0,1] indicate interpolation, others for extrapolation
 //		return: v_out
-floatv ijkVecLerpInv3fv(float3 v_out, float3 const v0, float3 const v1, float3 const v_lerp);
+ijk_inl floatv ijkVecLerpInv3fv(float3 v_out, float3 const v0, float3 const v1, float3 const v_lerp);
 
 // ijkVecLerpRevInit3*v
 //	Vector linear interpolation reversal to calculate initial control.
@@ -3837,7 +3837,7 @@ floatv ijkVecLerpInv3fv(float3 v_out, float3 const v0, float3 const v1, float3 c
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v0_out
-floatv ijkVecLerpRevInit3fv(float3 v0_out, float3 const v_lerp, float3 const v1, f32 const u);
+ijk_inl floatv ijkVecLerpRevInit3fv(float3 v0_out, float3 const v_lerp, float3 const v1, f32 const u);
 
 // ijkVecLerpRevTerm3*v
 //	Vector linear interpolation reversal to calculate terminal control.
@@ -3847,14 +3847,14 @@ floatv ijkVecLerpRevInit3fv(float3 v0_out, float3 const v_lerp, float3 const v1,
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v1_out
-floatv ijkVecLerpRevTerm3fv(float3 v1_out, float3 const v0, float3 const v_lerp, f32 const u);
+ijk_inl floatv ijkVecLerpRevTerm3fv(float3 v1_out, float3 const v0, float3 const v_lerp, f32 const u);
 
 // ijkVecProjRatio3*v
 //	Calculate projection length ratio.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: length ratio of projected vector to base
-f32 ijkVecProjRatio3fv(float3 const v_base, float3 const v_in);
+ijk_inl f32 ijkVecProjRatio3fv(float3 const v_base, float3 const v_in);
 
 // ijkVecProj3*v
 //	Vector projection.
@@ -3862,7 +3862,7 @@ f32 ijkVecProjRatio3fv(float3 const v_base, float3 const v_in);
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: v_out
-floatv ijkVecProj3fv(float3 v_out, float3 const v_base, float3 const v_in);
+ijk_inl floatv ijkVecProj3fv(float3 v_out, float3 const v_base, float3 const v_in);
 
 // ijkVecOrtho3*v
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -3871,7 +3871,7 @@ floatv ijkVecProj3fv(float3 v_out, float3 const v_base, float3 const v_in);
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be orthogonalized
 //		return: v_out
-floatv ijkVecOrtho3fv(float3 v_out, float3 const v_base, float3 const v_in);
+ijk_inl floatv ijkVecOrtho3fv(float3 v_out, float3 const v_base, float3 const v_in);
 
 // ijkVecOrthoNorm3*v
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -3881,7 +3881,7 @@ floatv ijkVecOrtho3fv(float3 v_out, float3 const v_base, float3 const v_in);
 //		param v_in: input vector to be orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: v_out
-floatv ijkVecOrthoNorm3fv(float3 v_out, float3 const v_base, float3 const v_in, float3 v_base_norm_out);
+ijk_inl floatv ijkVecOrthoNorm3fv(float3 v_out, float3 const v_base, float3 const v_in, float3 v_base_norm_out);
 
 // ijkVecOrthoList3*v
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -3890,7 +3890,7 @@ floatv ijkVecOrthoNorm3fv(float3 v_out, float3 const v_base, float3 const v_in,
 //		param vl_in: input list of vectors to be orthogonalized
 //		param n: number of vectors to orthogonalize
 //		return: vl_out
-float3* ijkVecOrthoList3fv(float3 vl_out[], float3 const v_base, float3 const vl_in[], size const n);
+ijk_inl float3* ijkVecOrthoList3fv(float3 vl_out[], float3 const v_base, float3 const vl_in[], size const n);
 
 // ijkVecOrthoNormList3*v
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -3900,7 +3900,7 @@ float3* ijkVecOrthoList3fv(float3 vl_out[], float3 const v_base, float3 const vl
 //		param n: number of vectors to orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: vl_out
-float3* ijkVecOrthoNormList3fv(float3 vl_out[], float3 const v_base, float3 const vl_in[], size const n, float3 v_base_norm_out);
+ijk_inl float3* ijkVecOrthoNormList3fv(float3 vl_out[], float3 const v_base, float3 const vl_in[], size const n, float3 v_base_norm_out);
 
 // ijkVecNlerp3*v
 //	Calculate normalized linear interpolation between two 3D vectors; keeps
@@ -3911,7 +3911,7 @@ float3* ijkVecOrthoNormList3fv(float3 vl_out[], float3 const v_base, float3 cons
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-floatv ijkVecNlerp3fv(float3 v_out, float3 const v0, float3 const v1, f32 const u);
+ijk_inl floatv ijkVecNlerp3fv(float3 v_out, float3 const v0, float3 const v1, f32 const u);
 
 // ijkVecSlerp3*v
 //	Calculate spherical linear interpolation between two unit 3D vectors; keeps
@@ -3922,7 +3922,7 @@ floatv ijkVecNlerp3fv(float3 v_out, float3 const v0, float3 const v1, f32 const
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-floatv ijkVecSlerp3fv(float3 v_out, float3 const v0, float3 const v1, f32 const u);
+ijk_inl floatv ijkVecSlerp3fv(float3 v_out, float3 const v0, float3 const v1, f32 const u);
 
 // ijkVecReflectScale3*v
 //	Reflect incident vector about normal, scaling to match normal size.
@@ -3930,7 +3930,7 @@ floatv ijkVecSlerp3fv(float3 v_out, float3 const v0, float3 const v1, f32 const
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-floatv ijkVecReflectScale3fv(float3 v_out, float3 const v_in, float3 const v_nrm);
+ijk_inl floatv ijkVecReflectScale3fv(float3 v_out, float3 const v_in, float3 const v_nrm);
 
 // ijkVecUnitReflect3*v
 //	Reflect incident vector about normal; optimized for unit normal vector.
@@ -3938,7 +3938,7 @@ floatv ijkVecReflectScale3fv(float3 v_out, float3 const v_in, float3 const v_nrm
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-floatv ijkVecUnitReflect3fv(float3 v_out, float3 const v_in, float3 const v_nrm);
+ijk_inl floatv ijkVecUnitReflect3fv(float3 v_out, float3 const v_in, float3 const v_nrm);
 
 // ijkVecReflect3*v
 //	Reflect incident vector about normal.
@@ -3946,14 +3946,14 @@ floatv ijkVecUnitReflect3fv(float3 v_out, float3 const v_in, float3 const v_nrm)
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-floatv ijkVecReflect3fv(float3 v_out, float3 const v_in, float3 const v_nrm);
+ijk_inl floatv ijkVecReflect3fv(float3 v_out, float3 const v_in, float3 const v_nrm);
 
 // ijkVecDistance3*v
 //	Calculate distance between two points.
 //		param v_lh: left-hand input
 //		param v_rh: right-hand input
 //		return: distance between inputs
-f32 ijkVecDistance3fv(float3 const v_lh, float3 const v_rh);
+ijk_inl f32 ijkVecDistance3fv(float3 const v_lh, float3 const v_rh);
 
 // ijkVecResize3*v
 //	Change length of vector, retaining direction.
@@ -3961,7 +3961,7 @@ f32 ijkVecDistance3fv(float3 const v_lh, float3 const v_rh);
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: v_out
-floatv ijkVecResize3fv(float3 v_out, float3 const v_in, f32 const length);
+ijk_inl floatv ijkVecResize3fv(float3 v_out, float3 const v_in, f32 const length);
 
 // ijkVecResizeSafe3*v
 //	Change length of vector, retaining direction; division-by-zero safe.
@@ -3969,7 +3969,7 @@ floatv ijkVecResize3fv(float3 v_out, float3 const v_in, f32 const length);
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: v_out
-floatv ijkVecResizeSafe3fv(float3 v_out, float3 const v_in, f32 const length);
+ijk_inl floatv ijkVecResizeSafe3fv(float3 v_out, float3 const v_in, f32 const length);
 
 // ijkVecCrossResize3*v
 //	Change length of cross product result, retaining direction.
@@ -3978,7 +3978,7 @@ floatv ijkVecResizeSafe3fv(float3 v_out, float3 const v_in, f32 const length);
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: v_out
-floatv ijkVecCrossResize3fv(float3 v_out, float3 const v_lh, float3 const v_rh, f32 const length);
+ijk_inl floatv ijkVecCrossResize3fv(float3 v_out, float3 const v_lh, float3 const v_rh, f32 const length);
 
 // ijkVecCrossResizeSafe3*v
 //	Change length of cross product result, retaining direction; 
@@ -3988,7 +3988,7 @@ floatv ijkVecCrossResize3fv(float3 v_out, float3 const v_lh, float3 const v_rh,
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: v_out
-floatv ijkVecCrossResizeSafe3fv(float3 v_out, float3 const v_lh, float3 const v_rh, f32 const length);
+ijk_inl floatv ijkVecCrossResizeSafe3fv(float3 v_out, float3 const v_lh, float3 const v_rh, f32 const length);
 
 // ijkVecNearest3*v
 //	Nearest-neighbor interpolation between two reference values.
@@ -3997,7 +3997,7 @@ floatv ijkVecCrossResizeSafe3fv(float3 v_out, float3 const v_lh, float3 const v_
 //		param v1: terminal reference value/end point, result when t>=0.5
 //		param u: interpolation parameter
 //		return: v_out
-floatv ijkVecNearest3fv(float3 v_out, float3 const v0, float3 const v1, f32 const u);
+ijk_inl floatv ijkVecNearest3fv(float3 v_out, float3 const v0, float3 const v1, f32 const u);
 
 // ijkVecBinearest3*v
 //	Nearest-neighbor interpolation of nearest-neighbor interpolated values.
@@ -4014,7 +4014,7 @@ floatv ijkVecNearest3fv(float3 v_out, float3 const v0, float3 const v1, f32 cons
 //		param u1: interpolation parameter for second pair
 //		param u: interpolation parameter for results
 //		return: v_out
-floatv ijkVecBinearest3fv(float3 v_out, float3 const v00, float3 const v01, float3 const v10, float3 const v11, f32 const u0, f32 const u1, f32 const u);
+ijk_inl floatv ijkVecBinearest3fv(float3 v_out, float3 const v00, float3 const v01, float3 const v10, float3 const v11, f32 const u0, f32 const u1, f32 const u);
 
 // ijkVecRemap3*v
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -4029,7 +4029,7 @@ floatv ijkVecBinearest3fv(float3 v_out, float3 const v00, float3 const v01, floa
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: v_out
-floatv ijkVecRemap3fv(float3 v_out, float3 const v0_dst, float3 const v1_dst, float3 const v0_src, float3 const v1_src, float3 const v_src);
+ijk_inl floatv ijkVecRemap3fv(float3 v_out, float3 const v0_dst, float3 const v1_dst, float3 const v0_src, float3 const v1_src, float3 const v_src);
 
 // ijkVecBezier0O3*v
 //	Perform order-0 (point) Bezier interpolation given one reference value.
@@ -4037,7 +4037,7 @@ floatv ijkVecRemap3fv(float3 v_out, float3 const v0_dst, float3 const v1_dst, fl
 //		param v0: reference value, always returned
 //		param u: interpolation parameter; not used for order 0 interpolation
 //		return: v_out
-floatv ijkVecBezier0O3fv(float3 v_out, float3 const v0, f32 const u);
+ijk_inl floatv ijkVecBezier0O3fv(float3 v_out, float3 const v0, f32 const u);
 
 // ijkVecBezier1O3*v
 //	Perform order-1 (linear) Bezier interpolation given two reference values.
@@ -4047,7 +4047,7 @@ floatv ijkVecBezier0O3fv(float3 v_out, float3 const v0, f32 const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-floatv ijkVecBezier1O3fv(float3 v_out, float3 const v0, float3 const v1, f32 const u);
+ijk_inl floatv ijkVecBezier1O3fv(float3 v_out, float3 const v0, float3 const v1, f32 const u);
 
 // ijkVecBezier2O3*v
 //	Perform order-2 (quadratic) Bezier interpolation given three reference 
@@ -4059,7 +4059,7 @@ floatv ijkVecBezier1O3fv(float3 v_out, float3 const v0, float3 const v1, f32 con
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v2
 //		return: v_out
-floatv ijkVecBezier2O3fv(float3 v_out, float3 const v0, float3 const v1, float3 const v2, f32 const u);
+ijk_inl floatv ijkVecBezier2O3fv(float3 v_out, float3 const v0, float3 const v1, float3 const v2, f32 const u);
 
 // ijkVecBezier3O3*v
 //	Perform order-3 (cubic) Bezier interpolation given four reference values.
@@ -4071,7 +4071,7 @@ floatv ijkVecBezier2O3fv(float3 v_out, float3 const v0, float3 const v1, float3
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v3
 //		return: v_out
-floatv ijkVecBezier3O3fv(float3 v_out, float3 const v0, float3 const v1, float3 const v2, float3 const v3, f32 const u);
+ijk_inl floatv ijkVecBezier3O3fv(float3 v_out, float3 const v0, float3 const v1, float3 const v2, float3 const v3, f32 const u);
 
 // ijkVecBezierNO3*v
 //	Perform order-N (recursive) Bezier interpolation given an array of 
@@ -4085,7 +4085,7 @@ floatv ijkVecBezier3O3fv(float3 v_out, float3 const v0, float3 const v1, float3
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v[0] and v[order]
 //		return: v_out
-floatv ijkVecBezierNO3fv(float3 v_out, float3 const v[], size const order, f32 const u);
+ijk_inl floatv ijkVecBezierNO3fv(float3 v_out, float3 const v[], size const order, f32 const u);
 
 // ijkVecCubicHermite3*v
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -4098,7 +4098,7 @@ floatv ijkVecBezierNO3fv(float3 v_out, float3 const v[], size const order, f32 c
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-floatv ijkVecCubicHermite3fv(float3 v_out, float3 const v0, float3 const dv0, float3 const v1, float3 const dv1, f32 const u);
+ijk_inl floatv ijkVecCubicHermite3fv(float3 v_out, float3 const v0, float3 const dv0, float3 const v1, float3 const dv1, f32 const u);
 
 // ijkVecCubicHermiteHandles3*v
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -4113,7 +4113,7 @@ floatv ijkVecCubicHermite3fv(float3 v_out, float3 const v0, float3 const dv0, fl
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-floatv ijkVecCubicHermiteHandles3fv(float3 v_out, float3 const v0, float3 const cv0, float3 const v1, float3 const cv1, f32 const u);
+ijk_inl floatv ijkVecCubicHermiteHandles3fv(float3 v_out, float3 const v0, float3 const cv0, float3 const v1, float3 const cv1, f32 const u);
 
 // ijkVecCubicCatmullRom3*v
 //	Catmull-Rom spline/curve interpolation between two reference values with 
@@ -4126,7 +4126,7 @@ floatv ijkVecCubicHermiteHandles3fv(float3 v_out, float3 const v0, float3 const
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-floatv ijkVecCubicCatmullRom3fv(float3 v_out, float3 const vp, float3 const v0, float3 const v1, float3 const v2, f32 const u);
+ijk_inl floatv ijkVecCubicCatmullRom3fv(float3 v_out, float3 const vp, float3 const v0, float3 const v1, float3 const v2, f32 const u);
 
 // ijkVecBicubicCatmullRom3*v
 //	Bi-cubic interpolation using Catmull-Rom interpolation for segments.
@@ -4161,7 +4161,7 @@ floatv ijkVecCubicCatmullRom3fv(float3 v_out, float3 const vp, float3 const v0,
 //		param u2: interpolation parameter for terminal control curve
 //		param u: interpolation parameter for result
 //		return: v_out
-floatv ijkVecBicubicCatmullRom3fv(float3 v_out, float3 const vpp, float3 const vp0, float3 const vp1, float3 const vp2, float3 const v0p, float3 const v00, float3 const v01, float3 const v02, float3 const v1p, float3 const v10, float3 const v11, float3 const v12, float3 const v2p, float3 const v20, float3 const v21, float3 const v22, f32 const up, f32 const u0, f32 const u1, f32 const u2, f32 const u);
+ijk_inl floatv ijkVecBicubicCatmullRom3fv(float3 v_out, float3 const vpp, float3 const vp0, float3 const vp1, float3 const vp2, float3 const v0p, float3 const v00, float3 const v01, float3 const v02, float3 const v1p, float3 const v10, float3 const v11, float3 const v12, float3 const v2p, float3 const v20, float3 const v21, float3 const v22, f32 const up, f32 const u0, f32 const u1, f32 const u2, f32 const u);
 
 // ijkVecReparamCubicHermite3*v
 //	Reparameterize a cubic Hermite segment into sample table.
@@ -4181,7 +4181,7 @@ floatv ijkVecBicubicCatmullRom3fv(float3 v_out, float3 const vpp, float3 const v
 //		param v1: terminal reference value/end point, result when t=1
 //		param dv1: terminal tangent/rate of change
 //		return: total arc length
-f32 ijkVecReparamCubicHermite3fv(f32 uTable_out[], f32 lTable_out[], float3 vTable_out[], size const numDivisions, ibool const lNormalize, float3 const v0, float3 const dv0, float3 const v1, float3 const dv1);
+ijk_inl f32 ijkVecReparamCubicHermite3fv(f32 uTable_out[], f32 lTable_out[], float3 vTable_out[], size const numDivisions, ibool const lNormalize, float3 const v0, float3 const dv0, float3 const v1, float3 const dv1);
 
 // ijkVecReparamCubicHermiteHandles3*v
 //	Reparameterize a cubic Hermite segment with handles into sample table.
@@ -4203,7 +4203,7 @@ f32 ijkVecReparamCubicHermite3fv(f32 uTable_out[], f32 lTable_out[], float3 vTab
 //		param cv1: terminal control handle value, should be greater than v1 
 //			for a positive rate of change
 //		return: total arc length
-f32 ijkVecReparamCubicHermiteHandles3fv(f32 uTable_out[], f32 lTable_out[], float3 vTable_out[], size const numDivisions, ibool const lNormalize, float3 const v0, float3 const cv0, float3 const v1, float3 const cv1);
+ijk_inl f32 ijkVecReparamCubicHermiteHandles3fv(f32 uTable_out[], f32 lTable_out[], float3 vTable_out[], size const numDivisions, ibool const lNormalize, float3 const v0, float3 const cv0, float3 const v1, float3 const cv1);
 
 // ijkVecReparamCubicCatmullRom3*v
 //	Reparameterize a cubic Catmull-Rom segment into sample table.
@@ -4223,7 +4223,7 @@ f32 ijkVecReparamCubicHermiteHandles3fv(f32 uTable_out[], f32 lTable_out[], floa
 //		param v1: terminal reference value/end point, result when t=1
 //		param v2: terminal control value
 //		return: total arc length
-f32 ijkVecReparamCubicCatmullRom3fv(f32 uTable_out[], f32 lTable_out[], float3 vTable_out[], size const numDivisions, ibool const lNormalize, float3 const vp, float3 const v0, float3 const v1, float3 const v2);
+ijk_inl f32 ijkVecReparamCubicCatmullRom3fv(f32 uTable_out[], f32 lTable_out[], float3 vTable_out[], size const numDivisions, ibool const lNormalize, float3 const vp, float3 const v0, float3 const v1, float3 const v2);
 
 // ijkVecReparamBicubicCatmullRom3*v
 //	Reparameterize a bi-cubic Catmull-Rom segment into sample table.
@@ -4267,7 +4267,7 @@ f32 ijkVecReparamCubicCatmullRom3fv(f32 uTable_out[], f32 lTable_out[], float3 v
 //		param u1: interpolation parameter for terminal value curve
 //		param u2: interpolation parameter for terminal control curve
 //		return: total arc length
-f32 ijkVecReparamBicubicCatmullRom3fv(f32 uTable_out[], f32 lTable_out[], float3 vTable_out[], size const numDivisions, ibool const lNormalize, float3 const vpp, float3 const vp0, float3 const vp1, float3 const vp2, float3 const v0p, float3 const v00, float3 const v01, float3 const v02, float3 const v1p, float3 const v10, float3 const v11, float3 const v12, float3 const v2p, float3 const v20, float3 const v21, float3 const v22, f32 const up, f32 const u0, f32 const u1, f32 const u2);
+ijk_inl f32 ijkVecReparamBicubicCatmullRom3fv(f32 uTable_out[], f32 lTable_out[], float3 vTable_out[], size const numDivisions, ibool const lNormalize, float3 const vpp, float3 const vp0, float3 const vp1, float3 const vp2, float3 const v0p, float3 const v00, float3 const v01, float3 const v02, float3 const v1p, float3 const v10, float3 const v11, float3 const v12, float3 const v2p, float3 const v20, float3 const v21, float3 const v22, f32 const up, f32 const u0, f32 const u1, f32 const u2);
 
 // ijkVecSampleTableInc3*v
 //	Find index of parameter in table and approximate value by interpolating 
@@ -4286,7 +4286,7 @@ f32 ijkVecReparamBicubicCatmullRom3fv(f32 uTable_out[], f32 lTable_out[], float3
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: v_out
-floatv ijkVecSampleTableInc3fv(float3 v_out, f32 const uTable[], float3 const vTable[], index i, index di, f32 const u);
+ijk_inl floatv ijkVecSampleTableInc3fv(float3 v_out, f32 const uTable[], float3 const vTable[], index i, index di, f32 const u);
 
 // ijkVecSampleTableDec3*v
 //	Find index of parameter in table and approximate value by interpolating 
@@ -4305,7 +4305,7 @@ floatv ijkVecSampleTableInc3fv(float3 v_out, f32 const uTable[], float3 const vT
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: v_out
-floatv ijkVecSampleTableDec3fv(float3 v_out, f32 const uTable[], float3 const vTable[], index i, index di, f32 const u);
+ijk_inl floatv ijkVecSampleTableDec3fv(float3 v_out, f32 const uTable[], float3 const vTable[], index i, index di, f32 const u);
 
 
 //-----------------------------------------------------------------------------
@@ -4314,51 +4314,51 @@ floatv ijkVecSampleTableDec3fv(float3 v_out, f32 const uTable[], float3 const vT
 //	Calculate the squared length of a vector.
 //		param v_in: input vector
 //		return: squared length
-f32 ijkVecLengthSq4fv(float4 const v_in);
+ijk_inl f32 ijkVecLengthSq4fv(float4 const v_in);
 
 // ijkVecLength4*v
 //	Calculate the length of a vector.
 //		param v_in: input vector
 //		return: length
-f32 ijkVecLength4fv(float4 const v_in);
+ijk_inl f32 ijkVecLength4fv(float4 const v_in);
 
 // ijkVecLengthSqInv4*v
 //	Calculate the inverse squared length of a vector.
 //		param v_in: input vector
 //		return: inverse squared length
-f32 ijkVecLengthSqInv4fv(float4 const v_in);
+ijk_inl f32 ijkVecLengthSqInv4fv(float4 const v_in);
 
 // ijkVecLengthSqInvSafe4*v
 //	Calculate the inverse squared length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse squared length
-f32 ijkVecLengthSqInvSafe4fv(float4 const v_in);
+ijk_inl f32 ijkVecLengthSqInvSafe4fv(float4 const v_in);
 
 // ijkVecLengthInv4*v
 //	Calculate the inverse length of a vector.
 //		param v_in: input vector
 //		return: inverse length
-f32 ijkVecLengthInv4fv(float4 const v_in);
+ijk_inl f32 ijkVecLengthInv4fv(float4 const v_in);
 
 // ijkVecLengthInvSafe4*v
 //	Calculate the inverse length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse length
-f32 ijkVecLengthInvSafe4fv(float4 const v_in);
+ijk_inl f32 ijkVecLengthInvSafe4fv(float4 const v_in);
 
 // ijkVecNormalize4*v
 //	Calculate the unit-length direction of a vector.
 //		param v_out: output vector
 //		param v_in: input vector
 //		return: v_out
-floatv ijkVecNormalize4fv(float4 v_out, float4 const v_in);
+ijk_inl floatv ijkVecNormalize4fv(float4 v_out, float4 const v_in);
 
 // ijkVecNormalizeSafe4*v
 //	Calculate the unit-length direction of a vector; division-by-zero safe.
 //		param v_out: output vector
 //		param v_in: input vector
 //		return: v_out
-floatv ijkVecNormalizeSafe4fv(float4 v_out, float4 const v_in);
+ijk_inl floatv ijkVecNormalizeSafe4fv(float4 v_out, float4 const v_in);
 
 // ijkVecNormalizeGetLength4*v
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -4367,7 +4367,7 @@ floatv ijkVecNormalizeSafe4fv(float4 v_out, float4 const v_in);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecNormalizeGetLength4fv(float4 v_out, float4 const v_in, f32* const length_out);
+ijk_inl floatv ijkVecNormalizeGetLength4fv(float4 v_out, float4 const v_in, f32* const length_out);
 
 // ijkVecNormalizeSafeGetLength4*v
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -4376,7 +4376,7 @@ floatv ijkVecNormalizeGetLength4fv(float4 v_out, float4 const v_in, f32* const l
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecNormalizeSafeGetLength4fv(float4 v_out, float4 const v_in, f32* const length_out);
+ijk_inl floatv ijkVecNormalizeSafeGetLength4fv(float4 v_out, float4 const v_in, f32* const length_out);
 
 // ijkVecNormalizeGetLengthInv4*v
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -4385,7 +4385,7 @@ floatv ijkVecNormalizeSafeGetLength4fv(float4 v_out, float4 const v_in, f32* con
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecNormalizeGetLengthInv4fv(float4 v_out, float4 const v_in, f32* const lengthInv_out);
+ijk_inl floatv ijkVecNormalizeGetLengthInv4fv(float4 v_out, float4 const v_in, f32* const lengthInv_out);
 
 // ijkVecNormalizeSafeGetLengthInv4*v
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -4394,7 +4394,7 @@ floatv ijkVecNormalizeGetLengthInv4fv(float4 v_out, float4 const v_in, f32* cons
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecNormalizeSafeGetLengthInv4fv(float4 v_out, float4 const v_in, f32* const lengthInv_out);
+ijk_inl floatv ijkVecNormalizeSafeGetLengthInv4fv(float4 v_out, float4 const v_in, f32* const lengthInv_out);
 
 // ijkVecCrossNormalize4*v
 //	Calculate unit-length result of cross product.
@@ -4402,7 +4402,7 @@ floatv ijkVecNormalizeSafeGetLengthInv4fv(float4 v_out, float4 const v_in, f32*
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecCrossNormalize4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
+ijk_inl floatv ijkVecCrossNormalize4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecCrossNormalizeSafe4*v
 //	Calculate unit-length result of cross product; division-by-zero safe.
@@ -4410,7 +4410,7 @@ floatv ijkVecCrossNormalize4fv(float4 v_out, float4 const v_lh, float4 const v_r
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-floatv ijkVecCrossNormalizeSafe4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
+ijk_inl floatv ijkVecCrossNormalizeSafe4fv(float4 v_out, float4 const v_lh, float4 const v_rh);
 
 // ijkVecCrossNormalizeGetLength4*v
 //	Calculate unit-length result of cross product; also capture length.
@@ -4419,7 +4419,7 @@ floatv ijkVecCrossNormalizeSafe4fv(float4 v_out, float4 const v_lh, float4 const
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecCrossNormalizeGetLength4fv(float4 v_out, float4 const v_lh, float4 const v_rh, f32* const length_out);
+ijk_inl floatv ijkVecCrossNormalizeGetLength4fv(float4 v_out, float4 const v_lh, float4 const v_rh, f32* const length_out);
 
 // ijkVecCrossNormalizeSafeGetLength4*v
 //	Calculate unit-length result of cross product; also capture length; 
@@ -4429,7 +4429,7 @@ floatv ijkVecCrossNormalizeGetLength4fv(float4 v_out, float4 const v_lh, float4
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: v_out
-floatv ijkVecCrossNormalizeSafeGetLength4fv(float4 v_out, float4 const v_lh, float4 const v_rh, f32* const length_out);
+ijk_inl floatv ijkVecCrossNormalizeSafeGetLength4fv(float4 v_out, float4 const v_lh, float4 const v_rh, f32* const length_out);
 
 // ijkVecCrossNormalizeGetLengthInv4*v
 //	Calculate unit-length result of cross product; also capture inverse length.
@@ -4438,7 +4438,7 @@ floatv ijkVecCrossNormalizeSafeGetLength4fv(float4 v_out, float4 const v_lh, flo
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: v_out
-floatv ijkVecCrossNormalizeGetLengthInv4fv(float4 v_out, float4 const v_lh, float4 const v_rh, f32* const lengthInv_out);
+ijk_inl floatv ijkVecCrossNormalizeGetLengthInv4fv(float4 v_out, float4 const v_lh, float4 const v_rh, f32* const lengthInv_out);
 
 // ijkVecCrossNormalizeSafeGetLengthInv4*v
 //	Calculate unit-length result of cross product; also capture inverse length;
@@ -4448,7 +4448,7 @@ floatv ijkVecCrossNormalizeGetLengthInv4fv(float4 v_out, float4 const v_lh, floa
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: v_out
-floatv ijkVecCrossNormalizeSafeGetLengthInv4fv(float4 v_out, float4 const v_lh, float4 const v_rh, f32* const lengthInv_out);
+ijk_inl floatv ijkVecCrossNormalizeSafeGetLengthInv4fv(float4 v_out, float4 const v_lh, float4 const v_rh, f32* const lengthInv_out);
 
 // ijkVecLerp4*v
 //	Vector linear interpolation.
@@ -4458,7 +4458,7 @@ floatv ijkVecCrossNormalizeSafeGetLengthInv4fv(float4 v_out, float4 const v_lh,
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-floatv ijkVecLerp4fv(float4 v_out, float4 const v0, float4 const v1, f32 const u);
+ijk_inl floatv ijkVecLerp4fv(float4 v_out, float4 const v0, float4 const v1, f32 const u);
 
 // ijkVecLerpInv4*v
 //	Vector linear interpolation inverse to calculate parameters given control .
@@ -4468,7 +4468,7 @@ floatv ijkVecLerp4fv(float4 v_out, float4 const v0, float4 const v1, f32 const u
 //		param v_lerp: interpolated vector used to calculate parameters; params 
 //			in range [0,1] indicate interpolation, others for extrapolation
 //		return: v_out
-floatv ijkVecLerpInv4fv(float4 v_out, float4 const v0, float4 const v1, float4 const v_lerp);
+ijk_inl floatv ijkVecLerpInv4fv(float4 v_out, float4 const v0, float4 const v1, float4 const v_lerp);
 
 // ijkVecLerpRevInit4*v
 //	Vector linear interpolation reversal to calculate initial control.
@@ -4478,7 +4478,7 @@ floatv ijkVecLerpInv4fv(float4 v_out, float4 const v0, float4 const v1, float4 c
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v0_out
-floatv ijkVecLerpRevInit4fv(float4 v0_out, float4 const v_lerp, float4 const v1, f32 const u);
+ijk_inl floatv ijkVecLerpRevInit4fv(float4 v0_out, float4 const v_lerp, float4 const v1, f32 const u);
 
 // ijkVecLerpRevTerm4*v
 //	Vector linear interpolation reversal to calculate terminal control.
@@ -4488,14 +4488,14 @@ floatv ijkVecLerpRevInit4fv(float4 v0_out, float4 const v_lerp, float4 const v1,
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v1_out
-floatv ijkVecLerpRevTerm4fv(float4 v1_out, float4 const v0, float4 const v_lerp, f32 const u);
+ijk_inl floatv ijkVecLerpRevTerm4fv(float4 v1_out, float4 const v0, float4 const v_lerp, f32 const u);
 
 // ijkVecProjRatio4*v
 //	Calculate projection length ratio.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: length ratio of projected vector to base
-f32 ijkVecProjRatio4fv(float4 const v_base, float4 const v_in);
+ijk_inl f32 ijkVecProjRatio4fv(float4 const v_base, float4 const v_in);
 
 // ijkVecProj4*v
 //	Vector projection.
@@ -4503,7 +4503,7 @@ f32 ijkVecProjRatio4fv(float4 const v_base, float4 const v_in);
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: v_out
-floatv ijkVecProj4fv(float4 v_out, float4 const v_base, float4 const v_in);
+ijk_inl floatv ijkVecProj4fv(float4 v_out, float4 const v_base, float4 const v_in);
 
 // ijkVecOrtho4*v
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -4512,7 +4512,7 @@ floatv ijkVecProj4fv(float4 v_out, float4 const v_base, float4 const v_in);
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be orthogonalized
 //		return: v_out
-floatv ijkVecOrtho4fv(float4 v_out, float4 const v_base, float4 const v_in);
+ijk_inl floatv ijkVecOrtho4fv(float4 v_out, float4 const v_base, float4 const v_in);
 
 // ijkVecOrthoNorm4*v
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -4522,7 +4522,7 @@ floatv ijkVecOrtho4fv(float4 v_out, float4 const v_base, float4 const v_in);
 //		param v_in: input vector to be orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: v_out
-floatv ijkVecOrthoNorm4fv(float4 v_out, float4 const v_base, float4 const v_in, float4 v_base_norm_out);
+ijk_inl floatv ijkVecOrthoNorm4fv(float4 v_out, float4 const v_base, float4 const v_in, float4 v_base_norm_out);
 
 // ijkVecOrthoList4*v
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -4531,7 +4531,7 @@ floatv ijkVecOrthoNorm4fv(float4 v_out, float4 const v_base, float4 const v_in,
 //		param vl_in: input list of vectors to be orthogonalized
 //		param n: number of vectors to orthogonalize
 //		return: vl_out
-float4* ijkVecOrthoList4fv(float4 vl_out[], float4 const v_base, float4 const vl_in[], size const n);
+ijk_inl float4* ijkVecOrthoList4fv(float4 vl_out[], float4 const v_base, float4 const vl_in[], size const n);
 
 // ijkVecOrthoNormList4*v
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -4541,7 +4541,7 @@ float4* ijkVecOrthoList4fv(float4 vl_out[], float4 const v_base, float4 const vl
 //		param n: number of vectors to orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: vl_out
-float4* ijkVecOrthoNormList4fv(float4 vl_out[], float4 const v_base, float4 const vl_in[], size const n, float4 v_base_norm_out);
+ijk_inl float4* ijkVecOrthoNormList4fv(float4 vl_out[], float4 const v_base, float4 const vl_in[], size const n, float4 v_base_norm_out);
 
 // ijkVecNlerp4*v
 //	Calculate normalized linear interpolation between two 4D vectors; keeps
@@ -4552,7 +4552,7 @@ float4* ijkVecOrthoNormList4fv(float4 vl_out[], float4 const v_base, float4 cons
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-floatv ijkVecNlerp4fv(float4 v_out, float4 const v0, float4 const v1, f32 const u);
+ijk_inl floatv ijkVecNlerp4fv(float4 v_out, float4 const v0, float4 const v1, f32 const u);
 
 // ijkVecSlerp4*v
 //	Calculate spherical linear interpolation between two unit 4D vectors; keeps
@@ -4563,7 +4563,7 @@ floatv ijkVecNlerp4fv(float4 v_out, float4 const v0, float4 const v1, f32 const
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: v_out
-floatv ijkVecSlerp4fv(float4 v_out, float4 const v0, float4 const v1, f32 const u);
+ijk_inl floatv ijkVecSlerp4fv(float4 v_out, float4 const v0, float4 const v1, f32 const u);
 
 // ijkVecReflectScale4*v
 //	Reflect incident vector about normal, scaling to match normal size.
@@ -4571,7 +4571,7 @@ floatv ijkVecSlerp4fv(float4 v_out, float4 const v0, float4 const v1, f32 const
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-floatv ijkVecReflectScale4fv(float4 v_out, float4 const v_in, float4 const v_nrm);
+ijk_inl floatv ijkVecReflectScale4fv(float4 v_out, float4 const v_in, float4 const v_nrm);
 
 // ijkVecUnitReflect4*v
 //	Reflect incident vector about normal; optimized for unit normal vector.
@@ -4579,7 +4579,7 @@ floatv ijkVecReflectScale4fv(float4 v_out, float4 const v_in, float4 const v_nrm
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-floatv ijkVecUnitReflect4fv(float4 v_out, float4 const v_in, float4 const v_nrm);
+ijk_inl floatv ijkVecUnitReflect4fv(float4 v_out, float4 const v_in, float4 const v_nrm);
 
 // ijkVecReflect4*v
 //	Reflect incident vector about normal.
@@ -4587,14 +4587,14 @@ floatv ijkVecUnitReflect4fv(float4 v_out, float4 const v_in, float4 const v_nrm)
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: v_out
-floatv ijkVecReflect4fv(float4 v_out, float4 const v_in, float4 const v_nrm);
+ijk_inl floatv ijkVecReflect4fv(float4 v_out, float4 const v_in, float4 const v_nrm);
 
 // ijkVecDistance4*v
 //	Calculate "distance" between two 4D vectors.
 //		param v_lh: left-hand input
 //		param v_rh: right-hand input
 //		return: distance between inputs
-f32 ijkVecDistance4fv(float4 const v_lh, float4 const v_rh);
+ijk_inl f32 ijkVecDistance4fv(float4 const v_lh, float4 const v_rh);
 
 // ijkVecResize4*v
 //	Change length of vector, retaining direction.
@@ -4602,7 +4602,7 @@ f32 ijkVecDistance4fv(float4 const v_lh, float4 const v_rh);
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: v_out
-floatv ijkVecResize4fv(float4 v_out, float4 const v_in, f32 const length);
+ijk_inl floatv ijkVecResize4fv(float4 v_out, float4 const v_in, f32 const length);
 
 // ijkVecResizeSafe4*v
 //	Change length of vector, retaining direction; division-by-zero safe.
@@ -4610,7 +4610,7 @@ floatv ijkVecResize4fv(float4 v_out, float4 const v_in, f32 const length);
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: v_out
-floatv ijkVecResizeSafe4fv(float4 v_out, float4 const v_in, f32 const length);
+ijk_inl floatv ijkVecResizeSafe4fv(float4 v_out, float4 const v_in, f32 const length);
 
 // ijkVecCrossResize4*v
 //	Change length of cross product result, retaining direction.
@@ -4619,7 +4619,7 @@ floatv ijkVecResizeSafe4fv(float4 v_out, float4 const v_in, f32 const length);
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: v_out
-floatv ijkVecCrossResize4fv(float4 v_out, float4 const v_lh, float4 const v_rh, f32 const length);
+ijk_inl floatv ijkVecCrossResize4fv(float4 v_out, float4 const v_lh, float4 const v_rh, f32 const length);
 
 // ijkVecCrossResizeSafe4*v
 //	Change length of cross product result, retaining direction; 
@@ -4629,7 +4629,7 @@ floatv ijkVecCrossResize4fv(float4 v_out, float4 const v_lh, float4 const v_rh,
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: v_out
-floatv ijkVecCrossResizeSafe4fv(float4 v_out, float4 const v_lh, float4 const v_rh, f32 const length);
+ijk_inl floatv ijkVecCrossResizeSafe4fv(float4 v_out, float4 const v_lh, float4 const v_rh, f32 const length);
 
 // ijkVecNearest4*v
 //	Nearest-neighbor interpolation between two reference values.
@@ -4638,7 +4638,7 @@ floatv ijkVecCrossResizeSafe4fv(float4 v_out, float4 const v_lh, float4 const v_
 //		param v1: terminal reference value/end point, result when t>=0.5
 //		param u: interpolation parameter
 //		return: v_out
-floatv ijkVecNearest4fv(float4 v_out, float4 const v0, float4 const v1, f32 const u);
+ijk_inl floatv ijkVecNearest4fv(float4 v_out, float4 const v0, float4 const v1, f32 const u);
 
 // ijkVecBinearest4*v
 //	Nearest-neighbor interpolation of nearest-neighbor interpolated values.
@@ -4655,7 +4655,7 @@ floatv ijkVecNearest4fv(float4 v_out, float4 const v0, float4 const v1, f32 cons
 //		param u1: interpolation parameter for second pair
 //		param u: interpolation parameter for results
 //		return: v_out
-floatv ijkVecBinearest4fv(float4 v_out, float4 const v00, float4 const v01, float4 const v10, float4 const v11, f32 const u0, f32 const u1, f32 const u);
+ijk_inl floatv ijkVecBinearest4fv(float4 v_out, float4 const v00, float4 const v01, float4 const v10, float4 const v11, f32 const u0, f32 const u1, f32 const u);
 
 // ijkVecRemap4*v
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -4670,7 +4670,7 @@ floatv ijkVecBinearest4fv(float4 v_out, float4 const v00, float4 const v01, floa
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: v_out
-floatv ijkVecRemap4fv(float4 v_out, float4 const v0_dst, float4 const v1_dst, float4 const v0_src, float4 const v1_src, float4 const v_src);
+ijk_inl floatv ijkVecRemap4fv(float4 v_out, float4 const v0_dst, float4 const v1_dst, float4 const v0_src, float4 const v1_src, float4 const v_src);
 
 // ijkVecBezier0O4*v
 //	Perform order-0 (point) Bezier interpolation given one reference value.
@@ -4678,7 +4678,7 @@ floatv ijkVecRemap4fv(float4 v_out, float4 const v0_dst, float4 const v1_dst, fl
 //		param v0: reference value, always returned
 //		param u: interpolation parameter; not used for order 0 interpolation
 //		return: v_out
-floatv ijkVecBezier0O4fv(float4 v_out, float4 const v0, f32 const u);
+ijk_inl floatv ijkVecBezier0O4fv(float4 v_out, float4 const v0, f32 const u);
 
 // ijkVecBezier1O4*v
 //	Perform order-1 (linear) Bezier interpolation given two reference values.
@@ -4688,7 +4688,7 @@ floatv ijkVecBezier0O4fv(float4 v_out, float4 const v0, f32 const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-floatv ijkVecBezier1O4fv(float4 v_out, float4 const v0, float4 const v1, f32 const u);
+ijk_inl floatv ijkVecBezier1O4fv(float4 v_out, float4 const v0, float4 const v1, f32 const u);
 
 // ijkVecBezier2O4*v
 //	Perform order-2 (quadratic) Bezier interpolation given three reference 
@@ -4700,7 +4700,7 @@ floatv ijkVecBezier1O4fv(float4 v_out, float4 const v0, float4 const v1, f32 con
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v2
 //		return: v_out
-floatv ijkVecBezier2O4fv(float4 v_out, float4 const v0, float4 const v1, float4 const v2, f32 const u);
+ijk_inl floatv ijkVecBezier2O4fv(float4 v_out, float4 const v0, float4 const v1, float4 const v2, f32 const u);
 
 // ijkVecBezier3O4*v
 //	Perform order-3 (cubic) Bezier interpolation given four reference values.
@@ -4712,7 +4712,7 @@ floatv ijkVecBezier2O4fv(float4 v_out, float4 const v0, float4 const v1, float4
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v3
 //		return: v_out
-floatv ijkVecBezier3O4fv(float4 v_out, float4 const v0, float4 const v1, float4 const v2, float4 const v3, f32 const u);
+ijk_inl floatv ijkVecBezier3O4fv(float4 v_out, float4 const v0, float4 const v1, float4 const v2, float4 const v3, f32 const u);
 
 // ijkVecBezierNO4*v
 //	Perform order-N (recursive) Bezier interpolation given an array of 
@@ -4726,7 +4726,7 @@ floatv ijkVecBezier3O4fv(float4 v_out, float4 const v0, float4 const v1, float4
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v[0] and v[order]
 //		return: v_out
-floatv ijkVecBezierNO4fv(float4 v_out, float4 const v[], size const order, f32 const u);
+ijk_inl floatv ijkVecBezierNO4fv(float4 v_out, float4 const v[], size const order, f32 const u);
 
 // ijkVecCubicHermite4*v
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -4739,7 +4739,7 @@ floatv ijkVecBezierNO4fv(float4 v_out, float4 const v[], size const order, f32 c
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-floatv ijkVecCubicHermite4fv(float4 v_out, float4 const v0, float4 const dv0, float4 const v1, float4 const dv1, f32 const u);
+ijk_inl floatv ijkVecCubicHermite4fv(float4 v_out, float4 const v0, float4 const dv0, float4 const v1, float4 const dv1, f32 const u);
 
 // ijkVecCubicHermiteHandles4*v
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -4754,7 +4754,7 @@ floatv ijkVecCubicHermite4fv(float4 v_out, float4 const v0, float4 const dv0, fl
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-floatv ijkVecCubicHermiteHandles4fv(float4 v_out, float4 const v0, float4 const cv0, float4 const v1, float4 const cv1, f32 const u);
+ijk_inl floatv ijkVecCubicHermiteHandles4fv(float4 v_out, float4 const v0, float4 const cv0, float4 const v1, float4 const cv1, f32 const u);
 
 // ijkVecCubicCatmullRom4*v
 //	Catmull-Rom spline/curve interpolation between two reference values with 
@@ -4767,7 +4767,7 @@ floatv ijkVecCubicHermiteHandles4fv(float4 v_out, float4 const v0, float4 const
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: v_out
-floatv ijkVecCubicCatmullRom4fv(float4 v_out, float4 const vp, float4 const v0, float4 const v1, float4 const v2, f32 const u);
+ijk_inl floatv ijkVecCubicCatmullRom4fv(float4 v_out, float4 const vp, float4 const v0, float4 const v1, float4 const v2, f32 const u);
 
 // ijkVecBicubicCatmullRom4*v
 //	Bi-cubic interpolation using Catmull-Rom interpolation for segments.
@@ -4802,7 +4802,7 @@ floatv ijkVecCubicCatmullRom4fv(float4 v_out, float4 const vp, float4 const v0,
 //		param u2: interpolation parameter for terminal control curve
 //		param u: interpolation parameter for result
 //		return: v_out
-floatv ijkVecBicubicCatmullRom4fv(float4 v_out, float4 const vpp, float4 const vp0, float4 const vp1, float4 const vp2, float4 const v0p, float4 const v00, float4 const v01, float4 const v02, float4 const v1p, float4 const v10, float4 const v11, float4 const v12, float4 const v2p, float4 const v20, float4 const v21, float4 const v22, f32 const up, f32 const u0, f32 const u1, f32 const u2, f32 const u);
+ijk_inl floatv ijkVecBicubicCatmullRom4fv(float4 v_out, float4 const vpp, float4 const vp0, float4 const vp1, float4 const vp2, float4 const v0p, float4 const v00, float4 const v01, float4 const v02, float4 const v1p, float4 const v10, float4 const v11, float4 const v12, float4 const v2p, float4 const v20, float4 const v21, float4 const v22, f32 const up, f32 const u0, f32 const u1, f32 const u2, f32 const u);
 
 // ijkVecReparamCubicHermite4*v
 //	Reparameterize a cubic Hermite segment into sample table.
@@ -4822,7 +4822,7 @@ floatv ijkVecBicubicCatmullRom4fv(float4 v_out, float4 const vpp, float4 const v
 //		param v1: terminal reference value/end point, result when t=1
 //		param dv1: terminal tangent/rate of change
 //		return: total arc length
-f32 ijkVecReparamCubicHermite4fv(f32 uTable_out[], f32 lTable_out[], float4 vTable_out[], size const numDivisions, ibool const lNormalize, float4 const v0, float4 const dv0, float4 const v1, float4 const dv1);
+ijk_inl f32 ijkVecReparamCubicHermite4fv(f32 uTable_out[], f32 lTable_out[], float4 vTable_out[], size const numDivisions, ibool const lNormalize, float4 const v0, float4 const dv0, float4 const v1, float4 const dv1);
 
 // ijkVecReparamCubicHermiteHandles4*v
 //	Reparameterize a cubic Hermite segment with handles into sample table.
@@ -4844,7 +4844,7 @@ f32 ijkVecReparamCubicHermite4fv(f32 uTable_out[], f32 lTable_out[], float4 vTab
 //		param cv1: terminal control handle value, should be greater than v1 
 //			for a positive rate of change
 //		return: total arc length
-f32 ijkVecReparamCubicHermiteHandles4fv(f32 uTable_out[], f32 lTable_out[], float4 vTable_out[], size const numDivisions, ibool const lNormalize, float4 const v0, float4 const cv0, float4 const v1, float4 const cv1);
+ijk_inl f32 ijkVecReparamCubicHermiteHandles4fv(f32 uTable_out[], f32 lTable_out[], float4 vTable_out[], size const numDivisions, ibool const lNormalize, float4 const v0, float4 const cv0, float4 const v1, float4 const cv1);
 
 // ijkVecReparamCubicCatmullRom4*v
 //	Reparameterize a cubic Catmull-Rom segment into sample table.
@@ -4864,7 +4864,7 @@ f32 ijkVecReparamCubicHermiteHandles4fv(f32 uTable_out[], f32 lTable_out[], floa
 //		param v1: terminal reference value/end point, result when t=1
 //		param v2: terminal control value
 //		return: total arc length
-f32 ijkVecReparamCubicCatmullRom4fv(f32 uTable_out[], f32 lTable_out[], float4 vTable_out[], size const numDivisions, ibool const lNormalize, float4 const vp, float4 const v0, float4 const v1, float4 const v2);
+ijk_inl f32 ijkVecReparamCubicCatmullRom4fv(f32 uTable_out[], f32 lTable_out[], float4 vTable_out[], size const numDivisions, ibool const lNormalize, float4 const vp, float4 const v0, float4 const v1, float4 const v2);
 
 // ijkVecReparamBicubicCatmullRom4*v
 //	Reparameterize a bi-cubic Catmull-Rom segment into sample table.
@@ -4908,7 +4908,7 @@ f32 ijkVecReparamCubicCatmullRom4fv(f32 uTable_out[], f32 lTable_out[], float4 v
 //		param u1: interpolation parameter for terminal value curve
 //		param u2: interpolation parameter for terminal control curve
 //		return: total arc length
-f32 ijkVecReparamBicubicCatmullRom4fv(f32 uTable_out[], f32 lTable_out[], float4 vTable_out[], size const numDivisions, ibool const lNormalize, float4 const vpp, float4 const vp0, float4 const vp1, float4 const vp2, float4 const v0p, float4 const v00, float4 const v01, float4 const v02, float4 const v1p, float4 const v10, float4 const v11, float4 const v12, float4 const v2p, float4 const v20, float4 const v21, float4 const v22, f32 const up, f32 const u0, f32 const u1, f32 const u2);
+ijk_inl f32 ijkVecReparamBicubicCatmullRom4fv(f32 uTable_out[], f32 lTable_out[], float4 vTable_out[], size const numDivisions, ibool const lNormalize, float4 const vpp, float4 const vp0, float4 const vp1, float4 const vp2, float4 const v0p, float4 const v00, float4 const v01, float4 const v02, float4 const v1p, float4 const v10, float4 const v11, float4 const v12, float4 const v2p, float4 const v20, float4 const v21, float4 const v22, f32 const up, f32 const u0, f32 const u1, f32 const u2);
 
 // ijkVecSampleTableInc4*v
 //	Find index of parameter in table and approximate value by interpolating 
@@ -4927,7 +4927,7 @@ f32 ijkVecReparamBicubicCatmullRom4fv(f32 uTable_out[], f32 lTable_out[], float4
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: v_out
-floatv ijkVecSampleTableInc4fv(float4 v_out, f32 const uTable[], float4 const vTable[], index i, index di, f32 const u);
+ijk_inl floatv ijkVecSampleTableInc4fv(float4 v_out, f32 const uTable[], float4 const vTable[], index i, index di, f32 const u);
 
 // ijkVecSampleTableDec4*v
 //	Find index of parameter in table and approximate value by interpolating 
@@ -4946,7 +4946,7 @@ floatv ijkVecSampleTableInc4fv(float4 v_out, f32 const uTable[], float4 const vT
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: v_out
-floatv ijkVecSampleTableDec4fv(float4 v_out, f32 const uTable[], float4 const vTable[], index i, index di, f32 const u);
+ijk_inl floatv ijkVecSampleTableDec4fv(float4 v_out, f32 const uTable[], float4 const vTable[], index i, index di, f32 const u);
 
 
 //-----------------------------------------------------------------------------
@@ -4962,49 +4962,49 @@ floatv ijkVecSampleTableDec4fv(float4 v_out, f32 const uTable[], float4 const vT
 //	Calculate the squared length of a vector.
 //		param v_in: input vector
 //		return: squared length
-float ijkVecLengthSq2f(fvec2 const v_in);
+ijk_inl float ijkVecLengthSq2f(fvec2 const v_in);
 
 // ijkVecLength2*
 //	Calculate the length of a vector.
 //		param v_in: input vector
 //		return: length
-float ijkVecLength2f(fvec2 const v_in);
+ijk_inl float ijkVecLength2f(fvec2 const v_in);
 
 // ijkVecLengthSqInv2*
 //	Calculate the inverse squared length of a vector.
 //		param v_in: input vector
 //		return: inverse squared length
-float ijkVecLengthSqInv2f(fvec2 const v_in);
+ijk_inl float ijkVecLengthSqInv2f(fvec2 const v_in);
 
 // ijkVecLengthSqInvSafe2*
 //	Calculate the inverse squared length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse squared length
-float ijkVecLengthSqInvSafe2f(fvec2 const v_in);
+ijk_inl float ijkVecLengthSqInvSafe2f(fvec2 const v_in);
 
 // ijkVecLengthInv2*
 //	Calculate the inverse length of a vector.
 //		param v_in: input vector
 //		return: inverse length
-float ijkVecLengthInv2f(fvec2 const v_in);
+ijk_inl float ijkVecLengthInv2f(fvec2 const v_in);
 
 // ijkVecLengthInvSafe2*
 //	Calculate the inverse length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse length
-float ijkVecLengthInvSafe2f(fvec2 const v_in);
+ijk_inl float ijkVecLengthInvSafe2f(fvec2 const v_in);
 
 // ijkVecNormalize2*
 //	Calculate the unit-length direction of a vector.
 //		param v_in: input vector
 //		return: unit-length direction vector
-fvec2 ijkVecNormalize2f(fvec2 const v_in);
+ijk_inl fvec2 ijkVecNormalize2f(fvec2 const v_in);
 
 // ijkVecNormalizeSafe2*
 //	Calculate the unit-length direction of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: unit-length direction vector
-fvec2 ijkVecNormalizeSafe2f(fvec2 const v_in);
+ijk_inl fvec2 ijkVecNormalizeSafe2f(fvec2 const v_in);
 
 // ijkVecNormalizeGetLength2*
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -5012,7 +5012,7 @@ fvec2 ijkVecNormalizeSafe2f(fvec2 const v_in);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-fvec2 ijkVecNormalizeGetLength2f(fvec2 const v_in, float* const length_out);
+ijk_inl fvec2 ijkVecNormalizeGetLength2f(fvec2 const v_in, float* const length_out);
 
 // ijkVecNormalizeSafeGetLength2*
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -5020,7 +5020,7 @@ fvec2 ijkVecNormalizeGetLength2f(fvec2 const v_in, float* const length_out);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-fvec2 ijkVecNormalizeSafeGetLength2f(fvec2 const v_in, float* const length_out);
+ijk_inl fvec2 ijkVecNormalizeSafeGetLength2f(fvec2 const v_in, float* const length_out);
 
 // ijkVecNormalizeGetLengthInv2*
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -5028,7 +5028,7 @@ fvec2 ijkVecNormalizeSafeGetLength2f(fvec2 const v_in, float* const length_out);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-fvec2 ijkVecNormalizeGetLengthInv2f(fvec2 const v_in, float* const lengthInv_out);
+ijk_inl fvec2 ijkVecNormalizeGetLengthInv2f(fvec2 const v_in, float* const lengthInv_out);
 
 // ijkVecNormalizeSafeGetLengthInv2*
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -5036,21 +5036,21 @@ fvec2 ijkVecNormalizeGetLengthInv2f(fvec2 const v_in, float* const lengthInv_out
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-fvec2 ijkVecNormalizeSafeGetLengthInv2f(fvec2 const v_in, float* const lengthInv_out);
+ijk_inl fvec2 ijkVecNormalizeSafeGetLengthInv2f(fvec2 const v_in, float* const lengthInv_out);
 
 // ijkVecCrossNormalize2*
 //	Calculate unit-length result of cross product.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar cross product sign
-float ijkVecCrossNormalize2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl float ijkVecCrossNormalize2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecCrossNormalizeSafe2*
 //	Calculate unit-length result of cross product; division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar cross product sign
-float ijkVecCrossNormalizeSafe2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl float ijkVecCrossNormalizeSafe2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecCrossNormalizeGetLength2*
 //	Calculate unit-length result of cross product; also capture length.
@@ -5058,7 +5058,7 @@ float ijkVecCrossNormalizeSafe2f(fvec2 const v_lh, fvec2 const v_rh);
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: scalar cross product sign
-float ijkVecCrossNormalizeGetLength2f(fvec2 const v_lh, fvec2 const v_rh, float* const length_out);
+ijk_inl float ijkVecCrossNormalizeGetLength2f(fvec2 const v_lh, fvec2 const v_rh, float* const length_out);
 
 // ijkVecCrossNormalizeSafeGetLength2*
 //	Calculate unit-length result of cross product; also capture length; 
@@ -5067,7 +5067,7 @@ float ijkVecCrossNormalizeGetLength2f(fvec2 const v_lh, fvec2 const v_rh, float*
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: scalar cross product sign
-float ijkVecCrossNormalizeSafeGetLength2f(fvec2 const v_lh, fvec2 const v_rh, float* const length_out);
+ijk_inl float ijkVecCrossNormalizeSafeGetLength2f(fvec2 const v_lh, fvec2 const v_rh, float* const length_out);
 
 // ijkVecCrossNormalizeGetLengthInv2*
 //	Calculate unit-length result of cross product; also capture inverse length.
@@ -5075,7 +5075,7 @@ float ijkVecCrossNormalizeSafeGetLength2f(fvec2 const v_lh, fvec2 const v_rh, fl
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: scalar cross product sign
-float ijkVecCrossNormalizeGetLengthInv2f(fvec2 const v_lh, fvec2 const v_rh, float* const lengthInv_out);
+ijk_inl float ijkVecCrossNormalizeGetLengthInv2f(fvec2 const v_lh, fvec2 const v_rh, float* const lengthInv_out);
 
 // ijkVecCrossNormalizeSafeGetLengthInv2*
 //	Calculate unit-length result of cross product; also capture inverse length;
@@ -5084,7 +5084,7 @@ float ijkVecCrossNormalizeGetLengthInv2f(fvec2 const v_lh, fvec2 const v_rh, flo
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: scalar cross product sign
-float ijkVecCrossNormalizeSafeGetLengthInv2f(fvec2 const v_lh, fvec2 const v_rh, float* const lengthInv_out);
+ijk_inl float ijkVecCrossNormalizeSafeGetLengthInv2f(fvec2 const v_lh, fvec2 const v_rh, float* const lengthInv_out);
 
 // ijkVecLerp2*
 //	Vector linear interpolation.
@@ -5093,7 +5093,7 @@ float ijkVecCrossNormalizeSafeGetLengthInv2f(fvec2 const v_lh, fvec2 const v_rh,
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-fvec2 ijkVecLerp2f(fvec2 const v0, fvec2 const v1, float const u);
+ijk_inl fvec2 ijkVecLerp2f(fvec2 const v0, fvec2 const v1, float const u);
 
 // ijkVecLerpInv2*
 //	Vector linear interpolation inverse to calculate parameters given control .
@@ -5102,7 +5102,7 @@ fvec2 ijkVecLerp2f(fvec2 const v0, fvec2 const v1, float const u);
 //		param v_lerp: interpolated vector used to calculate parameters; params 
 //			in range [0,1] indicate interpolation, others for extrapolation
 //		return: interpolation parameter for each component
-fvec2 ijkVecLerpInv2f(fvec2 const v0, fvec2 const v1, fvec2 const v_lerp);
+ijk_inl fvec2 ijkVecLerpInv2f(fvec2 const v0, fvec2 const v1, fvec2 const v_lerp);
 
 // ijkVecLerpRevInit2*
 //	Vector linear interpolation reversal to calculate initial control.
@@ -5111,7 +5111,7 @@ fvec2 ijkVecLerpInv2f(fvec2 const v0, fvec2 const v1, fvec2 const v_lerp);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: initial control vector, result when param is 0
-fvec2 ijkVecLerpRevInit2f(fvec2 const v_lerp, fvec2 const v1, float const u);
+ijk_inl fvec2 ijkVecLerpRevInit2f(fvec2 const v_lerp, fvec2 const v1, float const u);
 
 // ijkVecLerpRevTerm2*
 //	Vector linear interpolation reversal to calculate terminal control.
@@ -5120,28 +5120,28 @@ fvec2 ijkVecLerpRevInit2f(fvec2 const v_lerp, fvec2 const v1, float const u);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: terminal control vector, result when param is 1
-fvec2 ijkVecLerpRevTerm2f(fvec2 const v0, fvec2 const v_lerp, float const u);
+ijk_inl fvec2 ijkVecLerpRevTerm2f(fvec2 const v0, fvec2 const v_lerp, float const u);
 
 // ijkVecProjRatio2*
 //	Calculate projection length ratio.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: length ratio of projected vector to base
-float ijkVecProjRatio2f(fvec2 const v_base, fvec2 const v_in);
+ijk_inl float ijkVecProjRatio2f(fvec2 const v_base, fvec2 const v_in);
 
 // ijkVecProj2*
 //	Vector projection.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: projected input onto base
-fvec2 ijkVecProj2f(fvec2 const v_base, fvec2 const v_in);
+ijk_inl fvec2 ijkVecProj2f(fvec2 const v_base, fvec2 const v_in);
 
 // ijkVecOrtho2*
 //	Vector orthogonalization using the Gram-Schmidt process.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be orthogonalized
 //		return: output orthogonalized vector
-fvec2 ijkVecOrtho2f(fvec2 const v_base, fvec2 const v_in);
+ijk_inl fvec2 ijkVecOrtho2f(fvec2 const v_base, fvec2 const v_in);
 
 // ijkVecOrthoNorm2*
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -5149,7 +5149,7 @@ fvec2 ijkVecOrtho2f(fvec2 const v_base, fvec2 const v_in);
 //		param v_in: input vector to be orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: output orthonormalized vector
-fvec2 ijkVecOrthoNorm2f(fvec2 const v_base, fvec2 const v_in, fvec2* const v_base_norm_out);
+ijk_inl fvec2 ijkVecOrthoNorm2f(fvec2 const v_base, fvec2 const v_in, fvec2* const v_base_norm_out);
 
 // ijkVecOrthoList2*
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -5158,7 +5158,7 @@ fvec2 ijkVecOrthoNorm2f(fvec2 const v_base, fvec2 const v_in, fvec2* const v_bas
 //		param vl_in: input list of vectors to be orthogonalized
 //		param n: number of vectors to orthogonalize
 //		return: vl_out
-fvec2* ijkVecOrthoList2f(fvec2 vl_out[], fvec2 const v_base, fvec2 const vl_in[], size const n);
+ijk_inl fvec2* ijkVecOrthoList2f(fvec2 vl_out[], fvec2 const v_base, fvec2 const vl_in[], size const n);
 
 // ijkVecOrthoNormList2*
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -5168,7 +5168,7 @@ fvec2* ijkVecOrthoList2f(fvec2 vl_out[], fvec2 const v_base, fvec2 const vl_in[]
 //		param n: number of vectors to orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: vl_out
-fvec2* ijkVecOrthoNormList2f(fvec2 vl_out[], fvec2 const v_base, fvec2 const vl_in[], size const n, fvec2* const v_base_norm_out);
+ijk_inl fvec2* ijkVecOrthoNormList2f(fvec2 vl_out[], fvec2 const v_base, fvec2 const vl_in[], size const n, fvec2* const v_base_norm_out);
 
 // ijkVecNlerp2*
 //	Calculate normalized linear interpolation between two 2D vectors; keeps
@@ -5178,7 +5178,7 @@ fvec2* ijkVecOrthoNormList2f(fvec2 vl_out[], fvec2 const v_base, fvec2 const vl_
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-fvec2 ijkVecNlerp2f(fvec2 const v0, fvec2 const v1, float const u);
+ijk_inl fvec2 ijkVecNlerp2f(fvec2 const v0, fvec2 const v1, float const u);
 
 // ijkVecSlerp2*
 //	Calculate spherical linear interpolation between two unit 2D vectors; keeps
@@ -5188,49 +5188,49 @@ fvec2 ijkVecNlerp2f(fvec2 const v0, fvec2 const v1, float const u);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-fvec2 ijkVecSlerp2f(fvec2 const v0, fvec2 const v1, float const u);
+ijk_inl fvec2 ijkVecSlerp2f(fvec2 const v0, fvec2 const v1, float const u);
 
 // ijkVecReflectScale2*
 //	Reflect incident vector about normal, scaling to match normal size.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-fvec2 ijkVecReflectScale2f(fvec2 const v_in, fvec2 const v_nrm);
+ijk_inl fvec2 ijkVecReflectScale2f(fvec2 const v_in, fvec2 const v_nrm);
 
 // ijkVecUnitReflect2*
 //	Reflect incident vector about normal; optimized for unit normal vector.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-fvec2 ijkVecUnitReflect2f(fvec2 const v_in, fvec2 const v_nrm);
+ijk_inl fvec2 ijkVecUnitReflect2f(fvec2 const v_in, fvec2 const v_nrm);
 
 // ijkVecReflect2*
 //	Reflect incident vector about normal.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-fvec2 ijkVecReflect2f(fvec2 const v_in, fvec2 const v_nrm);
+ijk_inl fvec2 ijkVecReflect2f(fvec2 const v_in, fvec2 const v_nrm);
 
 // ijkVecDistance2*
 //	Calculate distance between two points.
 //		param v_lh: left-hand input
 //		param v_rh: right-hand input
 //		return: distance between inputs
-float ijkVecDistance2f(fvec2 const v_lh, fvec2 const v_rh);
+ijk_inl float ijkVecDistance2f(fvec2 const v_lh, fvec2 const v_rh);
 
 // ijkVecResize2*
 //	Change length of vector, retaining direction.
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: resized vector
-fvec2 ijkVecResize2f(fvec2 const v_in, float const length);
+ijk_inl fvec2 ijkVecResize2f(fvec2 const v_in, float const length);
 
 // ijkVecResizeSafe2*
 //	Change length of vector, retaining direction; division-by-zero safe.
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: resized vector
-fvec2 ijkVecResizeSafe2f(fvec2 const v_in, float const length);
+ijk_inl fvec2 ijkVecResizeSafe2f(fvec2 const v_in, float const length);
 
 // ijkVecCrossResize2*
 //	Change length of cross product result, retaining direction.
@@ -5238,7 +5238,7 @@ fvec2 ijkVecResizeSafe2f(fvec2 const v_in, float const length);
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized scalar cross product
-float ijkVecCrossResize2f(fvec2 const v_lh, fvec2 const v_rh, float const length);
+ijk_inl float ijkVecCrossResize2f(fvec2 const v_lh, fvec2 const v_rh, float const length);
 
 // ijkVecCrossResizeSafe2*
 //	Change length of cross product result, retaining direction; 
@@ -5247,7 +5247,7 @@ float ijkVecCrossResize2f(fvec2 const v_lh, fvec2 const v_rh, float const length
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized scalar cross product
-float ijkVecCrossResizeSafe2f(fvec2 const v_lh, fvec2 const v_rh, float const length);
+ijk_inl float ijkVecCrossResizeSafe2f(fvec2 const v_lh, fvec2 const v_rh, float const length);
 
 // ijkVecNearest2*
 //	Nearest-neighbor interpolation between two reference values.
@@ -5255,7 +5255,7 @@ float ijkVecCrossResizeSafe2f(fvec2 const v_lh, fvec2 const v_rh, float const le
 //		param v1: terminal reference value/end point, result when t>=0.5
 //		param u: interpolation parameter
 //		return: nearest-neighbor interpolated vector, exactly v0 or v1
-fvec2 ijkVecNearest2f(fvec2 const v0, fvec2 const v1, float const u);
+ijk_inl fvec2 ijkVecNearest2f(fvec2 const v0, fvec2 const v1, float const u);
 
 // ijkVecBinearest2*
 //	Nearest-neighbor interpolation of nearest-neighbor interpolated values.
@@ -5271,7 +5271,7 @@ fvec2 ijkVecNearest2f(fvec2 const v0, fvec2 const v1, float const u);
 //		param u1: interpolation parameter for second pair
 //		param u: interpolation parameter for results
 //		return: bi-nearest-neighbor interpolated vector
-fvec2 ijkVecBinearest2f(fvec2 const v00, fvec2 const v01, fvec2 const v10, fvec2 const v11, float const u0, float const u1, float const u);
+ijk_inl fvec2 ijkVecBinearest2f(fvec2 const v00, fvec2 const v01, fvec2 const v10, fvec2 const v11, float const u0, float const u1, float const u);
 
 // ijkVecRemap2*
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -5285,14 +5285,14 @@ fvec2 ijkVecBinearest2f(fvec2 const v00, fvec2 const v01, fvec2 const v10, fvec2
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: vector in original range remapped to target range
-fvec2 ijkVecRemap2f(fvec2 const v0_dst, fvec2 const v1_dst, fvec2 const v0_src, fvec2 const v1_src, fvec2 const v_src);
+ijk_inl fvec2 ijkVecRemap2f(fvec2 const v0_dst, fvec2 const v1_dst, fvec2 const v0_src, fvec2 const v1_src, fvec2 const v_src);
 
 // ijkVecBezier0O2*
 //	Perform order-0 (point) Bezier interpolation given one reference value.
 //		param v0: reference value, always returned
 //		param u: interpolation parameter; not used for order 0 interpolation
 //		return: v0
-fvec2 ijkVecBezier0O2f(fvec2 const v0, float const u);
+ijk_inl fvec2 ijkVecBezier0O2f(fvec2 const v0, float const u);
 
 // ijkVecBezier1O2*
 //	Perform order-1 (linear) Bezier interpolation given two reference values.
@@ -5301,7 +5301,7 @@ fvec2 ijkVecBezier0O2f(fvec2 const v0, float const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: linear interpolation between v0 and v1
-fvec2 ijkVecBezier1O2f(fvec2 const v0, fvec2 const v1, float const u);
+ijk_inl fvec2 ijkVecBezier1O2f(fvec2 const v0, fvec2 const v1, float const u);
 
 // ijkVecBezier2O2*
 //	Perform order-2 (quadratic) Bezier interpolation given three reference 
@@ -5312,7 +5312,7 @@ fvec2 ijkVecBezier1O2f(fvec2 const v0, fvec2 const v1, float const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v2
 //		return: quadratic Bezier interpolation between v0 and v2
-fvec2 ijkVecBezier2O2f(fvec2 const v0, fvec2 const v1, fvec2 const v2, float const u);
+ijk_inl fvec2 ijkVecBezier2O2f(fvec2 const v0, fvec2 const v1, fvec2 const v2, float const u);
 
 // ijkVecBezier3O2*
 //	Perform order-3 (cubic) Bezier interpolation given four reference values.
@@ -5323,7 +5323,7 @@ fvec2 ijkVecBezier2O2f(fvec2 const v0, fvec2 const v1, fvec2 const v2, float con
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v3
 //		return: cubic Bezier interpolation between v0 and v3
-fvec2 ijkVecBezier3O2f(fvec2 const v0, fvec2 const v1, fvec2 const v2, fvec2 const v3, float const u);
+ijk_inl fvec2 ijkVecBezier3O2f(fvec2 const v0, fvec2 const v1, fvec2 const v2, fvec2 const v3, float const u);
 
 // ijkVecBezierNO2*
 //	Perform order-N (recursive) Bezier interpolation given an array of 
@@ -5336,7 +5336,7 @@ fvec2 ijkVecBezier3O2f(fvec2 const v0, fvec2 const v1, fvec2 const v2, fvec2 con
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v[0] and v[order]
 //		return: recursive Bezier interpolation between v[0] and v[order]
-fvec2 ijkVecBezierNO2f(fvec2 const v[], size const order, float const u);
+ijk_inl fvec2 ijkVecBezierNO2f(fvec2 const v[], size const order, float const u);
 
 // ijkVecCubicHermite2*
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -5348,7 +5348,7 @@ fvec2 ijkVecBezierNO2f(fvec2 const v[], size const order, float const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-fvec2 ijkVecCubicHermite2f(fvec2 const v0, fvec2 const dv0, fvec2 const v1, fvec2 const dv1, float const u);
+ijk_inl fvec2 ijkVecCubicHermite2f(fvec2 const v0, fvec2 const dv0, fvec2 const v1, fvec2 const dv1, float const u);
 
 // ijkVecCubicHermiteHandles2*
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -5362,7 +5362,7 @@ fvec2 ijkVecCubicHermite2f(fvec2 const v0, fvec2 const dv0, fvec2 const v1, fvec
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-fvec2 ijkVecCubicHermiteHandles2f(fvec2 const v0, fvec2 const cv0, fvec2 const v1, fvec2 const cv1, float const u);
+ijk_inl fvec2 ijkVecCubicHermiteHandles2f(fvec2 const v0, fvec2 const cv0, fvec2 const v1, fvec2 const cv1, float const u);
 
 // ijkVecCubicCatmullRom2*
 //	Catmull-Rom spline/curve interpolation between two reference values with 
@@ -5374,7 +5374,7 @@ fvec2 ijkVecCubicHermiteHandles2f(fvec2 const v0, fvec2 const cv0, fvec2 const v
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-fvec2 ijkVecCubicCatmullRom2f(fvec2 const vp, fvec2 const v0, fvec2 const v1, fvec2 const v2, float const u);
+ijk_inl fvec2 ijkVecCubicCatmullRom2f(fvec2 const vp, fvec2 const v0, fvec2 const v1, fvec2 const v2, float const u);
 
 // ijkVecBicubicCatmullRom2*
 //	Bi-cubic interpolation using Catmull-Rom interpolation for segments.
@@ -5408,7 +5408,7 @@ fvec2 ijkVecCubicCatmullRom2f(fvec2 const vp, fvec2 const v0, fvec2 const v1, fv
 //		param u2: interpolation parameter for terminal control curve
 //		param u: interpolation parameter for result
 //		return: interpolated vector
-fvec2 ijkVecBicubicCatmullRom2f(fvec2 const vpp, fvec2 const vp0, fvec2 const vp1, fvec2 const vp2, fvec2 const v0p, fvec2 const v00, fvec2 const v01, fvec2 const v02, fvec2 const v1p, fvec2 const v10, fvec2 const v11, fvec2 const v12, fvec2 const v2p, fvec2 const v20, fvec2 const v21, fvec2 const v22, float const up, float const u0, float const u1, float const u2, float const u);
+ijk_inl fvec2 ijkVecBicubicCatmullRom2f(fvec2 const vpp, fvec2 const vp0, fvec2 const vp1, fvec2 const vp2, fvec2 const v0p, fvec2 const v00, fvec2 const v01, fvec2 const v02, fvec2 const v1p, fvec2 const v10, fvec2 const v11, fvec2 const v12, fvec2 const v2p, fvec2 const v20, fvec2 const v21, fvec2 const v22, float const up, float const u0, float const u1, float const u2, float const u);
 
 // ijkVecReparamCubicHermite2*
 //	Reparameterize a cubic Hermite segment into sample table.
@@ -5428,7 +5428,7 @@ fvec2 ijkVecBicubicCatmullRom2f(fvec2 const vpp, fvec2 const vp0, fvec2 const vp
 //		param v1: terminal reference value/end point, result when t=1
 //		param dv1: terminal tangent/rate of change
 //		return: total arc length
-float ijkVecReparamCubicHermite2f(float uTable_out[], float lTable_out[], fvec2 vTable_out[], size const numDivisions, ibool const lNormalize, fvec2 const v0, fvec2 const dv0, fvec2 const v1, fvec2 const dv1);
+ijk_inl float ijkVecReparamCubicHermite2f(float uTable_out[], float lTable_out[], fvec2 vTable_out[], size const numDivisions, ibool const lNormalize, fvec2 const v0, fvec2 const dv0, fvec2 const v1, fvec2 const dv1);
 
 // ijkVecReparamCubicHermiteHandles2*
 //	Reparameterize a cubic Hermite segment with handles into sample table.
@@ -5450,7 +5450,7 @@ float ijkVecReparamCubicHermite2f(float uTable_out[], float lTable_out[], fvec2
 //		param cv1: terminal control handle value, should be greater than v1 
 //			for a positive rate of change
 //		return: total arc length
-float ijkVecReparamCubicHermiteHandles2f(float uTable_out[], float lTable_out[], fvec2 vTable_out[], size const numDivisions, ibool const lNormalize, fvec2 const v0, fvec2 const cv0, fvec2 const v1, fvec2 const cv1);
+ijk_inl float ijkVecReparamCubicHermiteHandles2f(float uTable_out[], float lTable_out[], fvec2 vTable_out[], size const numDivisions, ibool const lNormalize, fvec2 const v0, fvec2 const cv0, fvec2 const v1, fvec2 const cv1);
 
 // ijkVecReparamCubicCatmullRom2*
 //	Reparameterize a cubic Catmull-Rom segment into sample table.
@@ -5470,7 +5470,7 @@ float ijkVecReparamCubicHermiteHandles2f(float uTable_out[], float lTable_out[],
 //		param v1: terminal reference value/end point, result when t=1
 //		param v2: terminal control value
 //		return: total arc length
-float ijkVecReparamCubicCatmullRom2f(float uTable_out[], float lTable_out[], fvec2 vTable_out[], size const numDivisions, ibool const lNormalize, fvec2 const vp, fvec2 const v0, fvec2 const v1, fvec2 const v2);
+ijk_inl float ijkVecReparamCubicCatmullRom2f(float uTable_out[], float lTable_out[], fvec2 vTable_out[], size const numDivisions, ibool const lNormalize, fvec2 const vp, fvec2 const v0, fvec2 const v1, fvec2 const v2);
 
 // ijkVecReparamBicubicCatmullRom2*
 //	Reparameterize a bi-cubic Catmull-Rom segment into sample table.
@@ -5514,7 +5514,7 @@ float ijkVecReparamCubicCatmullRom2f(float uTable_out[], float lTable_out[], fve
 //		param u1: interpolation parameter for terminal value curve
 //		param u2: interpolation parameter for terminal control curve
 //		return: total arc length
-float ijkVecReparamBicubicCatmullRom2f(float uTable_out[], float lTable_out[], fvec2 vTable_out[], size const numDivisions, ibool const lNormalize, fvec2 const vpp, fvec2 const vp0, fvec2 const vp1, fvec2 const vp2, fvec2 const v0p, fvec2 const v00, fvec2 const v01, fvec2 const v02, fvec2 const v1p, fvec2 const v10, fvec2 const v11, fvec2 const v12, fvec2 const v2p, fvec2 const v20, fvec2 const v21, fvec2 const v22, float const up, float const u0, float const u1, float const u2);
+ijk_inl float ijkVecReparamBicubicCatmullRom2f(float uTable_out[], float lTable_out[], fvec2 vTable_out[], size const numDivisions, ibool const lNormalize, fvec2 const vpp, fvec2 const vp0, fvec2 const vp1, fvec2 const vp2, fvec2 const v0p, fvec2 const v00, fvec2 const v01, fvec2 const v02, fvec2 const v1p, fvec2 const v10, fvec2 const v11, fvec2 const v12, fvec2 const v2p, fvec2 const v20, fvec2 const v21, fvec2 const v22, float const up, float const u0, float const u1, float const u2);
 
 // ijkVecSampleTableInc2*
 //	Find index of parameter in table and approximate value by interpolating 
@@ -5531,7 +5531,7 @@ float ijkVecReparamBicubicCatmullRom2f(float uTable_out[], float lTable_out[], f
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: interpolated vector in table that approximates input parameter
-fvec2 ijkVecSampleTableInc2f(float const uTable[], fvec2 const vTable[], index i, index di, float const u);
+ijk_inl fvec2 ijkVecSampleTableInc2f(float const uTable[], fvec2 const vTable[], index i, index di, float const u);
 
 // ijkVecSampleTableDec2*
 //	Find index of parameter in table and approximate value by interpolating 
@@ -5548,7 +5548,7 @@ fvec2 ijkVecSampleTableInc2f(float const uTable[], fvec2 const vTable[], index i
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: interpolated vector in table that approximates input parameter
-fvec2 ijkVecSampleTableDec2f(float const uTable[], fvec2 const vTable[], index i, index di, float const u);
+ijk_inl fvec2 ijkVecSampleTableDec2f(float const uTable[], fvec2 const vTable[], index i, index di, float const u);
 
 
 //-----------------------------------------------------------------------------
@@ -5557,49 +5557,49 @@ fvec2 ijkVecSampleTableDec2f(float const uTable[], fvec2 const vTable[], index i
 //	Calculate the squared length of a vector.
 //		param v_in: input vector
 //		return: squared length
-float ijkVecLengthSq3f(fvec3 const v_in);
+ijk_inl float ijkVecLengthSq3f(fvec3 const v_in);
 
 // ijkVecLength3*
 //	Calculate the length of a vector.
 //		param v_in: input vector
 //		return: length
-float ijkVecLength3f(fvec3 const v_in);
+ijk_inl float ijkVecLength3f(fvec3 const v_in);
 
 // ijkVecLengthSqInv3*
 //	Calculate the inverse squared length of a vector.
 //		param v_in: input vector
 //		return: inverse squared length
-float ijkVecLengthSqInv3f(fvec3 const v_in);
+ijk_inl float ijkVecLengthSqInv3f(fvec3 const v_in);
 
 // ijkVecLengthSqInvSafe3*
 //	Calculate the inverse squared length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse squared length
-float ijkVecLengthSqInvSafe3f(fvec3 const v_in);
+ijk_inl float ijkVecLengthSqInvSafe3f(fvec3 const v_in);
 
 // ijkVecLengthInv3*
 //	Calculate the inverse length of a vector.
 //		param v_in: input vector
 //		return: inverse length
-float ijkVecLengthInv3f(fvec3 const v_in);
+ijk_inl float ijkVecLengthInv3f(fvec3 const v_in);
 
 // ijkVecLengthInvSafe3*
 //	Calculate the inverse length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse length
-float ijkVecLengthInvSafe3f(fvec3 const v_in);
+ijk_inl float ijkVecLengthInvSafe3f(fvec3 const v_in);
 
 // ijkVecNormalize3*
 //	Calculate the unit-length direction of a vector.
 //		param v_in: input vector
 //		return: unit-length direction vector
-fvec3 ijkVecNormalize3f(fvec3 const v_in);
+ijk_inl fvec3 ijkVecNormalize3f(fvec3 const v_in);
 
 // ijkVecNormalizeSafe3*
 //	Calculate the unit-length direction of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: unit-length direction vector
-fvec3 ijkVecNormalizeSafe3f(fvec3 const v_in);
+ijk_inl fvec3 ijkVecNormalizeSafe3f(fvec3 const v_in);
 
 // ijkVecNormalizeGetLength3*
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -5607,7 +5607,7 @@ fvec3 ijkVecNormalizeSafe3f(fvec3 const v_in);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-fvec3 ijkVecNormalizeGetLength3f(fvec3 const v_in, float* const length_out);
+ijk_inl fvec3 ijkVecNormalizeGetLength3f(fvec3 const v_in, float* const length_out);
 
 // ijkVecNormalizeSafeGetLength3*
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -5615,7 +5615,7 @@ fvec3 ijkVecNormalizeGetLength3f(fvec3 const v_in, float* const length_out);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-fvec3 ijkVecNormalizeSafeGetLength3f(fvec3 const v_in, float* const length_out);
+ijk_inl fvec3 ijkVecNormalizeSafeGetLength3f(fvec3 const v_in, float* const length_out);
 
 // ijkVecNormalizeGetLengthInv3*
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -5623,7 +5623,7 @@ fvec3 ijkVecNormalizeSafeGetLength3f(fvec3 const v_in, float* const length_out);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-fvec3 ijkVecNormalizeGetLengthInv3f(fvec3 const v_in, float* const lengthInv_out);
+ijk_inl fvec3 ijkVecNormalizeGetLengthInv3f(fvec3 const v_in, float* const lengthInv_out);
 
 // ijkVecNormalizeSafeGetLengthInv3*
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -5631,21 +5631,21 @@ fvec3 ijkVecNormalizeGetLengthInv3f(fvec3 const v_in, float* const lengthInv_out
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-fvec3 ijkVecNormalizeSafeGetLengthInv3f(fvec3 const v_in, float* const lengthInv_out);
+ijk_inl fvec3 ijkVecNormalizeSafeGetLengthInv3f(fvec3 const v_in, float* const lengthInv_out);
 
 // ijkVecCrossNormalize3*
 //	Calculate unit-length result of cross product.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: unit cross product
-fvec3 ijkVecCrossNormalize3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecCrossNormalize3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecCrossNormalizeSafe3*
 //	Calculate unit-length result of cross product; division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: unit cross product
-fvec3 ijkVecCrossNormalizeSafe3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl fvec3 ijkVecCrossNormalizeSafe3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecCrossNormalizeGetLength3*
 //	Calculate unit-length result of cross product; also capture length.
@@ -5653,7 +5653,7 @@ fvec3 ijkVecCrossNormalizeSafe3f(fvec3 const v_lh, fvec3 const v_rh);
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: unit cross product
-fvec3 ijkVecCrossNormalizeGetLength3f(fvec3 const v_lh, fvec3 const v_rh, float* const length_out);
+ijk_inl fvec3 ijkVecCrossNormalizeGetLength3f(fvec3 const v_lh, fvec3 const v_rh, float* const length_out);
 
 // ijkVecCrossNormalizeSafeGetLength3*
 //	Calculate unit-length result of cross product; also capture length; 
@@ -5662,7 +5662,7 @@ fvec3 ijkVecCrossNormalizeGetLength3f(fvec3 const v_lh, fvec3 const v_rh, float*
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: unit cross product
-fvec3 ijkVecCrossNormalizeSafeGetLength3f(fvec3 const v_lh, fvec3 const v_rh, float* const length_out);
+ijk_inl fvec3 ijkVecCrossNormalizeSafeGetLength3f(fvec3 const v_lh, fvec3 const v_rh, float* const length_out);
 
 // ijkVecCrossNormalizeGetLengthInv3*
 //	Calculate unit-length result of cross product; also capture inverse length.
@@ -5670,7 +5670,7 @@ fvec3 ijkVecCrossNormalizeSafeGetLength3f(fvec3 const v_lh, fvec3 const v_rh, fl
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: unit cross product
-fvec3 ijkVecCrossNormalizeGetLengthInv3f(fvec3 const v_lh, fvec3 const v_rh, float* const lengthInv_out);
+ijk_inl fvec3 ijkVecCrossNormalizeGetLengthInv3f(fvec3 const v_lh, fvec3 const v_rh, float* const lengthInv_out);
 
 // ijkVecCrossNormalizeSafeGetLengthInv3*
 //	Calculate unit-length result of cross product; also capture inverse length;
@@ -5679,7 +5679,7 @@ fvec3 ijkVecCrossNormalizeGetLengthInv3f(fvec3 const v_lh, fvec3 const v_rh, flo
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: unit cross product
-fvec3 ijkVecCrossNormalizeSafeGetLengthInv3f(fvec3 const v_lh, fvec3 const v_rh, float* const lengthInv_out);
+ijk_inl fvec3 ijkVecCrossNormalizeSafeGetLengthInv3f(fvec3 const v_lh, fvec3 const v_rh, float* const lengthInv_out);
 
 // ijkVecLerp3*
 //	Vector linear interpolation.
@@ -5688,7 +5688,7 @@ fvec3 ijkVecCrossNormalizeSafeGetLengthInv3f(fvec3 const v_lh, fvec3 const v_rh,
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-fvec3 ijkVecLerp3f(fvec3 const v0, fvec3 const v1, float const u);
+ijk_inl fvec3 ijkVecLerp3f(fvec3 const v0, fvec3 const v1, float const u);
 
 // ijkVecLerpInv3*
 //	Vector linear interpolation inverse to calculate parameters given control .
@@ -5697,7 +5697,7 @@ fvec3 ijkVecLerp3f(fvec3 const v0, fvec3 const v1, float const u);
 //		param v_lerp: interpolated vector used to calculate parameters; params 
 //			in range [0,1] indicate interpolation, others for extrapolation
 //		return: interpolation parameter for each component
-fvec3 ijkVecLerpInv3f(fvec3 const v0, fvec3 const v1, fvec3 const v_lerp);
+ijk_inl fvec3 ijkVecLerpInv3f(fvec3 const v0, fvec3 const v1, fvec3 const v_lerp);
 
 // ijkVecLerpRevInit3*
 //	Vector linear interpolation reversal to calculate initial control.
@@ -5706,7 +5706,7 @@ fvec3 ijkVecLerpInv3f(fvec3 const v0, fvec3 const v1, fvec3 const v_lerp);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: initial control vector, result when param is 0
-fvec3 ijkVecLerpRevInit3f(fvec3 const v_lerp, fvec3 const v1, float const u);
+ijk_inl fvec3 ijkVecLerpRevInit3f(fvec3 const v_lerp, fvec3 const v1, float const u);
 
 // ijkVecLerpRevTerm3*
 //	Vector linear interpolation reversal to calculate terminal control.
@@ -5715,28 +5715,28 @@ fvec3 ijkVecLerpRevInit3f(fvec3 const v_lerp, fvec3 const v1, float const u);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: terminal control vector, result when param is 1
-fvec3 ijkVecLerpRevTerm3f(fvec3 const v0, fvec3 const v_lerp, float const u);
+ijk_inl fvec3 ijkVecLerpRevTerm3f(fvec3 const v0, fvec3 const v_lerp, float const u);
 
 // ijkVecProjRatio3*
 //	Calculate projection length ratio.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: length ratio of projected vector to base
-float ijkVecProjRatio3f(fvec3 const v_base, fvec3 const v_in);
+ijk_inl float ijkVecProjRatio3f(fvec3 const v_base, fvec3 const v_in);
 
 // ijkVecProj3*
 //	Vector projection.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: projected input onto base
-fvec3 ijkVecProj3f(fvec3 const v_base, fvec3 const v_in);
+ijk_inl fvec3 ijkVecProj3f(fvec3 const v_base, fvec3 const v_in);
 
 // ijkVecOrtho3*
 //	Vector orthogonalization using the Gram-Schmidt process.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be orthogonalized
 //		return: output orthogonalized vector
-fvec3 ijkVecOrtho3f(fvec3 const v_base, fvec3 const v_in);
+ijk_inl fvec3 ijkVecOrtho3f(fvec3 const v_base, fvec3 const v_in);
 
 // ijkVecOrthoNorm3*
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -5744,7 +5744,7 @@ fvec3 ijkVecOrtho3f(fvec3 const v_base, fvec3 const v_in);
 //		param v_in: input vector to be orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: output orthonormalized vector
-fvec3 ijkVecOrthoNorm3f(fvec3 const v_base, fvec3 const v_in, fvec3* const v_base_norm_out);
+ijk_inl fvec3 ijkVecOrthoNorm3f(fvec3 const v_base, fvec3 const v_in, fvec3* const v_base_norm_out);
 
 // ijkVecOrthoList3*
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -5753,7 +5753,7 @@ fvec3 ijkVecOrthoNorm3f(fvec3 const v_base, fvec3 const v_in, fvec3* const v_bas
 //		param vl_in: input list of vectors to be orthogonalized
 //		param n: number of vectors to orthogonalize
 //		return: vl_out
-fvec3* ijkVecOrthoList3f(fvec3 vl_out[], fvec3 const v_base, fvec3 const vl_in[], size const n);
+ijk_inl fvec3* ijkVecOrthoList3f(fvec3 vl_out[], fvec3 const v_base, fvec3 const vl_in[], size const n);
 
 // ijkVecOrthoNormList3*
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -5763,7 +5763,7 @@ fvec3* ijkVecOrthoList3f(fvec3 vl_out[], fvec3 const v_base, fvec3 const vl_in[]
 //		param n: number of vectors to orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: vl_out
-fvec3* ijkVecOrthoNormList3f(fvec3 vl_out[], fvec3 const v_base, fvec3 const vl_in[], size const n, fvec3* const v_base_norm_out);
+ijk_inl fvec3* ijkVecOrthoNormList3f(fvec3 vl_out[], fvec3 const v_base, fvec3 const vl_in[], size const n, fvec3* const v_base_norm_out);
 
 // ijkVecNlerp3*
 //	Calculate normalized linear interpolation between two 3D vectors; keeps
@@ -5773,7 +5773,7 @@ fvec3* ijkVecOrthoNormList3f(fvec3 vl_out[], fvec3 const v_base, fvec3 const vl_
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-fvec3 ijkVecNlerp3f(fvec3 const v0, fvec3 const v1, float const u);
+ijk_inl fvec3 ijkVecNlerp3f(fvec3 const v0, fvec3 const v1, float const u);
 
 // ijkVecSlerp3*
 //	Calculate spherical linear interpolation between two unit 3D vectors; keeps
@@ -5783,49 +5783,49 @@ fvec3 ijkVecNlerp3f(fvec3 const v0, fvec3 const v1, float const u);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-fvec3 ijkVecSlerp3f(fvec3 const v0, fvec3 const v1, float const u);
+ijk_inl fvec3 ijkVecSlerp3f(fvec3 const v0, fvec3 const v1, float const u);
 
 // ijkVecReflectScale3*
 //	Reflect incident vector about normal, scaling to match normal size.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-fvec3 ijkVecReflectScale3f(fvec3 const v_in, fvec3 const v_nrm);
+ijk_inl fvec3 ijkVecReflectScale3f(fvec3 const v_in, fvec3 const v_nrm);
 
 // ijkVecUnitReflect3*
 //	Reflect incident vector about normal; optimized for unit normal vector.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-fvec3 ijkVecUnitReflect3f(fvec3 const v_in, fvec3 const v_nrm);
+ijk_inl fvec3 ijkVecUnitReflect3f(fvec3 const v_in, fvec3 const v_nrm);
 
 // ijkVecReflect3*
 //	Reflect incident vector about normal.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-fvec3 ijkVecReflect3f(fvec3 const v_in, fvec3 const v_nrm);
+ijk_inl fvec3 ijkVecReflect3f(fvec3 const v_in, fvec3 const v_nrm);
 
 // ijkVecDistance3*
 //	Calculate distance between two points.
 //		param v_lh: left-hand input
 //		param v_rh: right-hand input
 //		return: distance between inputs
-float ijkVecDistance3f(fvec3 const v_lh, fvec3 const v_rh);
+ijk_inl float ijkVecDistance3f(fvec3 const v_lh, fvec3 const v_rh);
 
 // ijkVecResize3*
 //	Change length of vector, retaining direction.
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: resized vector
-fvec3 ijkVecResize3f(fvec3 const v_in, float const length);
+ijk_inl fvec3 ijkVecResize3f(fvec3 const v_in, float const length);
 
 // ijkVecResizeSafe3*
 //	Change length of vector, retaining direction; division-by-zero safe.
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: resized vector
-fvec3 ijkVecResizeSafe3f(fvec3 const v_in, float const length);
+ijk_inl fvec3 ijkVecResizeSafe3f(fvec3 const v_in, float const length);
 
 // ijkVecCrossResize3*
 //	Change length of cross product result, retaining direction.
@@ -5833,7 +5833,7 @@ fvec3 ijkVecResizeSafe3f(fvec3 const v_in, float const length);
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized cross product
-fvec3 ijkVecCrossResize3f(fvec3 const v_lh, fvec3 const v_rh, float const length);
+ijk_inl fvec3 ijkVecCrossResize3f(fvec3 const v_lh, fvec3 const v_rh, float const length);
 
 // ijkVecCrossResizeSafe3*
 //	Change length of cross product result, retaining direction; 
@@ -5842,7 +5842,7 @@ fvec3 ijkVecCrossResize3f(fvec3 const v_lh, fvec3 const v_rh, float const length
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized cross product
-fvec3 ijkVecCrossResizeSafe3f(fvec3 const v_lh, fvec3 const v_rh, float const length);
+ijk_inl fvec3 ijkVecCrossResizeSafe3f(fvec3 const v_lh, fvec3 const v_rh, float const length);
 
 // ijkVecNearest3*
 //	Nearest-neighbor interpolation between two reference values.
@@ -5850,7 +5850,7 @@ fvec3 ijkVecCrossResizeSafe3f(fvec3 const v_lh, fvec3 const v_rh, float const le
 //		param v1: terminal reference value/end point, result when t>=0.5
 //		param u: interpolation parameter
 //		return: nearest-neighbor interpolated vector, exactly v0 or v1
-fvec3 ijkVecNearest3f(fvec3 const v0, fvec3 const v1, float const u);
+ijk_inl fvec3 ijkVecNearest3f(fvec3 const v0, fvec3 const v1, float const u);
 
 // ijkVecBinearest3*
 //	Nearest-neighbor interpolation of nearest-neighbor interpolated values.
@@ -5866,7 +5866,7 @@ fvec3 ijkVecNearest3f(fvec3 const v0, fvec3 const v1, float const u);
 //		param u1: interpolation parameter for second pair
 //		param u: interpolation parameter for results
 //		return: bi-nearest-neighbor interpolated vector
-fvec3 ijkVecBinearest3f(fvec3 const v00, fvec3 const v01, fvec3 const v10, fvec3 const v11, float const u0, float const u1, float const u);
+ijk_inl fvec3 ijkVecBinearest3f(fvec3 const v00, fvec3 const v01, fvec3 const v10, fvec3 const v11, float const u0, float const u1, float const u);
 
 // ijkVecRemap3*
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -5880,14 +5880,14 @@ fvec3 ijkVecBinearest3f(fvec3 const v00, fvec3 const v01, fvec3 const v10, fvec3
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: vector in original range remapped to target range
-fvec3 ijkVecRemap3f(fvec3 const v0_dst, fvec3 const v1_dst, fvec3 const v0_src, fvec3 const v1_src, fvec3 const v_src);
+ijk_inl fvec3 ijkVecRemap3f(fvec3 const v0_dst, fvec3 const v1_dst, fvec3 const v0_src, fvec3 const v1_src, fvec3 const v_src);
 
 // ijkVecBezier0O3*
 //	Perform order-0 (point) Bezier interpolation given one reference value.
 //		param v0: reference value, always returned
 //		param u: interpolation parameter; not used for order 0 interpolation
 //		return: v0
-fvec3 ijkVecBezier0O3f(fvec3 const v0, float const u);
+ijk_inl fvec3 ijkVecBezier0O3f(fvec3 const v0, float const u);
 
 // ijkVecBezier1O3*
 //	Perform order-1 (linear) Bezier interpolation given two reference values.
@@ -5896,7 +5896,7 @@ fvec3 ijkVecBezier0O3f(fvec3 const v0, float const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: linear interpolation between v0 and v1
-fvec3 ijkVecBezier1O3f(fvec3 const v0, fvec3 const v1, float const u);
+ijk_inl fvec3 ijkVecBezier1O3f(fvec3 const v0, fvec3 const v1, float const u);
 
 // ijkVecBezier2O3*
 //	Perform order-2 (quadratic) Bezier interpolation given three reference 
@@ -5907,7 +5907,7 @@ fvec3 ijkVecBezier1O3f(fvec3 const v0, fvec3 const v1, float const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v2
 //		return: quadratic Bezier interpolation between v0 and v2
-fvec3 ijkVecBezier2O3f(fvec3 const v0, fvec3 const v1, fvec3 const v2, float const u);
+ijk_inl fvec3 ijkVecBezier2O3f(fvec3 const v0, fvec3 const v1, fvec3 const v2, float const u);
 
 // ijkVecBezier3O3*
 //	Perform order-3 (cubic) Bezier interpolation given four reference values.
@@ -5918,7 +5918,7 @@ fvec3 ijkVecBezier2O3f(fvec3 const v0, fvec3 const v1, fvec3 const v2, float con
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v3
 //		return: cubic Bezier interpolation between v0 and v3
-fvec3 ijkVecBezier3O3f(fvec3 const v0, fvec3 const v1, fvec3 const v2, fvec3 const v3, float const u);
+ijk_inl fvec3 ijkVecBezier3O3f(fvec3 const v0, fvec3 const v1, fvec3 const v2, fvec3 const v3, float const u);
 
 // ijkVecBezierNO3*
 //	Perform order-N (recursive) Bezier interpolation given an array of 
@@ -5931,7 +5931,7 @@ fvec3 ijkVecBezier3O3f(fvec3 const v0, fvec3 const v1, fvec3 const v2, fvec3 con
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v[0] and v[order]
 //		return: recursive Bezier interpolation between v[0] and v[order]
-fvec3 ijkVecBezierNO3f(fvec3 const v[], size const order, float const u);
+ijk_inl fvec3 ijkVecBezierNO3f(fvec3 const v[], size const order, float const u);
 
 // ijkVecCubicHermite3*
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -5943,7 +5943,7 @@ fvec3 ijkVecBezierNO3f(fvec3 const v[], size const order, float const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-fvec3 ijkVecCubicHermite3f(fvec3 const v0, fvec3 const dv0, fvec3 const v1, fvec3 const dv1, float const u);
+ijk_inl fvec3 ijkVecCubicHermite3f(fvec3 const v0, fvec3 const dv0, fvec3 const v1, fvec3 const dv1, float const u);
 
 // ijkVecCubicHermiteHandles3*
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -5957,7 +5957,7 @@ fvec3 ijkVecCubicHermite3f(fvec3 const v0, fvec3 const dv0, fvec3 const v1, fvec
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-fvec3 ijkVecCubicHermiteHandles3f(fvec3 const v0, fvec3 const cv0, fvec3 const v1, fvec3 const cv1, float const u);
+ijk_inl fvec3 ijkVecCubicHermiteHandles3f(fvec3 const v0, fvec3 const cv0, fvec3 const v1, fvec3 const cv1, float const u);
 
 // ijkVecCubicCatmullRom3*
 //	Catmull-Rom spline/curve interpolation between two reference values with 
@@ -5969,7 +5969,7 @@ fvec3 ijkVecCubicHermiteHandles3f(fvec3 const v0, fvec3 const cv0, fvec3 const v
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-fvec3 ijkVecCubicCatmullRom3f(fvec3 const vp, fvec3 const v0, fvec3 const v1, fvec3 const v2, float const u);
+ijk_inl fvec3 ijkVecCubicCatmullRom3f(fvec3 const vp, fvec3 const v0, fvec3 const v1, fvec3 const v2, float const u);
 
 // ijkVecBicubicCatmullRom3*
 //	Bi-cubic interpolation using Catmull-Rom interpolation for segments.
@@ -6003,7 +6003,7 @@ fvec3 ijkVecCubicCatmullRom3f(fvec3 const vp, fvec3 const v0, fvec3 const v1, fv
 //		param u2: interpolation parameter for terminal control curve
 //		param u: interpolation parameter for result
 //		return: interpolated vector
-fvec3 ijkVecBicubicCatmullRom3f(fvec3 const vpp, fvec3 const vp0, fvec3 const vp1, fvec3 const vp2, fvec3 const v0p, fvec3 const v00, fvec3 const v01, fvec3 const v02, fvec3 const v1p, fvec3 const v10, fvec3 const v11, fvec3 const v12, fvec3 const v2p, fvec3 const v20, fvec3 const v21, fvec3 const v22, float const up, float const u0, float const u1, float const u2, float const u);
+ijk_inl fvec3 ijkVecBicubicCatmullRom3f(fvec3 const vpp, fvec3 const vp0, fvec3 const vp1, fvec3 const vp2, fvec3 const v0p, fvec3 const v00, fvec3 const v01, fvec3 const v02, fvec3 const v1p, fvec3 const v10, fvec3 const v11, fvec3 const v12, fvec3 const v2p, fvec3 const v20, fvec3 const v21, fvec3 const v22, float const up, float const u0, float const u1, float const u2, float const u);
 
 // ijkVecReparamCubicHermite3*
 //	Reparameterize a cubic Hermite segment into sample table.
@@ -6023,7 +6023,7 @@ fvec3 ijkVecBicubicCatmullRom3f(fvec3 const vpp, fvec3 const vp0, fvec3 const vp
 //		param v1: terminal reference value/end point, result when t=1
 //		param dv1: terminal tangent/rate of change
 //		return: total arc length
-float ijkVecReparamCubicHermite3f(float uTable_out[], float lTable_out[], fvec3 vTable_out[], size const numDivisions, ibool const lNormalize, fvec3 const v0, fvec3 const dv0, fvec3 const v1, fvec3 const dv1);
+ijk_inl float ijkVecReparamCubicHermite3f(float uTable_out[], float lTable_out[], fvec3 vTable_out[], size const numDivisions, ibool const lNormalize, fvec3 const v0, fvec3 const dv0, fvec3 const v1, fvec3 const dv1);
 
 // ijkVecReparamCubicHermiteHandles3*
 //	Reparameterize a cubic Hermite segment with handles into sample table.
@@ -6045,7 +6045,7 @@ float ijkVecReparamCubicHermite3f(float uTable_out[], float lTable_out[], fvec3
 //		param cv1: terminal control handle value, should be greater than v1 
 //			for a positive rate of change
 //		return: total arc length
-float ijkVecReparamCubicHermiteHandles3f(float uTable_out[], float lTable_out[], fvec3 vTable_out[], size const numDivisions, ibool const lNormalize, fvec3 const v0, fvec3 const cv0, fvec3 const v1, fvec3 const cv1);
+ijk_inl float ijkVecReparamCubicHermiteHandles3f(float uTable_out[], float lTable_out[], fvec3 vTable_out[], size const numDivisions, ibool const lNormalize, fvec3 const v0, fvec3 const cv0, fvec3 const v1, fvec3 const cv1);
 
 // ijkVecReparamCubicCatmullRom3*
 //	Reparameterize a cubic Catmull-Rom segment into sample table.
@@ -6065,7 +6065,7 @@ float ijkVecReparamCubicHermiteHandles3f(float uTable_out[], float lTable_out[],
 //		param v1: terminal reference value/end point, result when t=1
 //		param v2: terminal control value
 //		return: total arc length
-float ijkVecReparamCubicCatmullRom3f(float uTable_out[], float lTable_out[], fvec3 vTable_out[], size const numDivisions, ibool const lNormalize, fvec3 const vp, fvec3 const v0, fvec3 const v1, fvec3 const v2);
+ijk_inl float ijkVecReparamCubicCatmullRom3f(float uTable_out[], float lTable_out[], fvec3 vTable_out[], size const numDivisions, ibool const lNormalize, fvec3 const vp, fvec3 const v0, fvec3 const v1, fvec3 const v2);
 
 // ijkVecReparamBicubicCatmullRom3*
 //	Reparameterize a bi-cubic Catmull-Rom segment into sample table.
@@ -6109,7 +6109,7 @@ float ijkVecReparamCubicCatmullRom3f(float uTable_out[], float lTable_out[], fve
 //		param u1: interpolation parameter for terminal value curve
 //		param u2: interpolation parameter for terminal control curve
 //		return: total arc length
-float ijkVecReparamBicubicCatmullRom3f(float uTable_out[], float lTable_out[], fvec3 vTable_out[], size const numDivisions, ibool const lNormalize, fvec3 const vpp, fvec3 const vp0, fvec3 const vp1, fvec3 const vp2, fvec3 const v0p, fvec3 const v00, fvec3 const v01, fvec3 const v02, fvec3 const v1p, fvec3 const v10, fvec3 const v11, fvec3 const v12, fvec3 const v2p, fvec3 const v20, fvec3 const v21, fvec3 const v22, float const up, float const u0, float const u1, float const u2);
+ijk_inl float ijkVecReparamBicubicCatmullRom3f(float uTable_out[], float lTable_out[], fvec3 vTable_out[], size const numDivisions, ibool const lNormalize, fvec3 const vpp, fvec3 const vp0, fvec3 const vp1, fvec3 const vp2, fvec3 const v0p, fvec3 const v00, fvec3 const v01, fvec3 const v02, fvec3 const v1p, fvec3 const v10, fvec3 const v11, fvec3 const v12, fvec3 const v2p, fvec3 const v20, fvec3 const v21, fvec3 const v22, float const up, float const u0, float const u1, float const u2);
 
 // ijkVecSampleTableInc3*
 //	Find index of parameter in table and approximate value by interpolating 
@@ -6126,7 +6126,7 @@ float ijkVecReparamBicubicCatmullRom3f(float uTable_out[], float lTable_out[], f
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: interpolated vector in table that approximates input parameter
-fvec3 ijkVecSampleTableInc3f(float const uTable[], fvec3 const vTable[], index i, index di, float const u);
+ijk_inl fvec3 ijkVecSampleTableInc3f(float const uTable[], fvec3 const vTable[], index i, index di, float const u);
 
 // ijkVecSampleTableDec3*
 //	Find index of parameter in table and approximate value by interpolating 
@@ -6143,7 +6143,7 @@ fvec3 ijkVecSampleTableInc3f(float const uTable[], fvec3 const vTable[], index i
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: interpolated vector in table that approximates input parameter
-fvec3 ijkVecSampleTableDec3f(float const uTable[], fvec3 const vTable[], index i, index di, float const u);
+ijk_inl fvec3 ijkVecSampleTableDec3f(float const uTable[], fvec3 const vTable[], index i, index di, float const u);
 
 
 //-----------------------------------------------------------------------------
@@ -6152,49 +6152,49 @@ fvec3 ijkVecSampleTableDec3f(float const uTable[], fvec3 const vTable[], index i
 //	Calculate the squared length of a vector.
 //		param v_in: input vector
 //		return: squared length
-float ijkVecLengthSq4f(fvec4 const v_in);
+ijk_inl float ijkVecLengthSq4f(fvec4 const v_in);
 
 // ijkVecLength4*
 //	Calculate the length of a vector.
 //		param v_in: input vector
 //		return: length
-float ijkVecLength4f(fvec4 const v_in);
+ijk_inl float ijkVecLength4f(fvec4 const v_in);
 
 // ijkVecLengthSqInv4*
 //	Calculate the inverse squared length of a vector.
 //		param v_in: input vector
 //		return: inverse squared length
-float ijkVecLengthSqInv4f(fvec4 const v_in);
+ijk_inl float ijkVecLengthSqInv4f(fvec4 const v_in);
 
 // ijkVecLengthSqInvSafe4*
 //	Calculate the inverse squared length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse squared length
-float ijkVecLengthSqInvSafe4f(fvec4 const v_in);
+ijk_inl float ijkVecLengthSqInvSafe4f(fvec4 const v_in);
 
 // ijkVecLengthInv4*
 //	Calculate the inverse length of a vector.
 //		param v_in: input vector
 //		return: inverse length
-float ijkVecLengthInv4f(fvec4 const v_in);
+ijk_inl float ijkVecLengthInv4f(fvec4 const v_in);
 
 // ijkVecLengthInvSafe4*
 //	Calculate the inverse length of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: inverse length
-float ijkVecLengthInvSafe4f(fvec4 const v_in);
+ijk_inl float ijkVecLengthInvSafe4f(fvec4 const v_in);
 
 // ijkVecNormalize4*
 //	Calculate the unit-length direction of a vector.
 //		param v_in: input vector
 //		return: unit-length direction vector
-fvec4 ijkVecNormalize4f(fvec4 const v_in);
+ijk_inl fvec4 ijkVecNormalize4f(fvec4 const v_in);
 
 // ijkVecNormalizeSafe4*
 //	Calculate the unit-length direction of a vector; division-by-zero safe.
 //		param v_in: input vector
 //		return: unit-length direction vector
-fvec4 ijkVecNormalizeSafe4f(fvec4 const v_in);
+ijk_inl fvec4 ijkVecNormalizeSafe4f(fvec4 const v_in);
 
 // ijkVecNormalizeGetLength4*
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -6202,7 +6202,7 @@ fvec4 ijkVecNormalizeSafe4f(fvec4 const v_in);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-fvec4 ijkVecNormalizeGetLength4f(fvec4 const v_in, float* const length_out);
+ijk_inl fvec4 ijkVecNormalizeGetLength4f(fvec4 const v_in, float* const length_out);
 
 // ijkVecNormalizeSafeGetLength4*
 //	Calculate the unit-length direction of a vector; also capture the length 
@@ -6210,7 +6210,7 @@ fvec4 ijkVecNormalizeGetLength4f(fvec4 const v_in, float* const length_out);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-fvec4 ijkVecNormalizeSafeGetLength4f(fvec4 const v_in, float* const length_out);
+ijk_inl fvec4 ijkVecNormalizeSafeGetLength4f(fvec4 const v_in, float* const length_out);
 
 // ijkVecNormalizeGetLengthInv4*
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -6218,7 +6218,7 @@ fvec4 ijkVecNormalizeSafeGetLength4f(fvec4 const v_in, float* const length_out);
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-fvec4 ijkVecNormalizeGetLengthInv4f(fvec4 const v_in, float* const lengthInv_out);
+ijk_inl fvec4 ijkVecNormalizeGetLengthInv4f(fvec4 const v_in, float* const lengthInv_out);
 
 // ijkVecNormalizeSafeGetLengthInv4*
 //	Calculate the unit-length direction of a vector; also capture the inverse 
@@ -6226,21 +6226,21 @@ fvec4 ijkVecNormalizeGetLengthInv4f(fvec4 const v_in, float* const lengthInv_out
 //		param v_in: input vector
 //		param length_out: pointer to length storage
 //		return: unit-length direction vector
-fvec4 ijkVecNormalizeSafeGetLengthInv4f(fvec4 const v_in, float* const lengthInv_out);
+ijk_inl fvec4 ijkVecNormalizeSafeGetLengthInv4f(fvec4 const v_in, float* const lengthInv_out);
 
 // ijkVecCrossNormalize4*
 //	Calculate unit-length result of cross product.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: unit cross product
-fvec4 ijkVecCrossNormalize4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecCrossNormalize4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecCrossNormalizeSafe4*
 //	Calculate unit-length result of cross product; division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: unit cross product
-fvec4 ijkVecCrossNormalizeSafe4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl fvec4 ijkVecCrossNormalizeSafe4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecCrossNormalizeGetLength4*
 //	Calculate unit-length result of cross product; also capture length.
@@ -6248,7 +6248,7 @@ fvec4 ijkVecCrossNormalizeSafe4f(fvec4 const v_lh, fvec4 const v_rh);
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: unit cross product
-fvec4 ijkVecCrossNormalizeGetLength4f(fvec4 const v_lh, fvec4 const v_rh, float* const length_out);
+ijk_inl fvec4 ijkVecCrossNormalizeGetLength4f(fvec4 const v_lh, fvec4 const v_rh, float* const length_out);
 
 // ijkVecCrossNormalizeSafeGetLength4*
 //	Calculate unit-length result of cross product; also capture length; 
@@ -6257,7 +6257,7 @@ fvec4 ijkVecCrossNormalizeGetLength4f(fvec4 const v_lh, fvec4 const v_rh, float*
 //		param v_rh: right-hand vector
 //		param length_out: pointer to length storage
 //		return: unit cross product
-fvec4 ijkVecCrossNormalizeSafeGetLength4f(fvec4 const v_lh, fvec4 const v_rh, float* const length_out);
+ijk_inl fvec4 ijkVecCrossNormalizeSafeGetLength4f(fvec4 const v_lh, fvec4 const v_rh, float* const length_out);
 
 // ijkVecCrossNormalizeGetLengthInv4*
 //	Calculate unit-length result of cross product; also capture inverse length.
@@ -6265,7 +6265,7 @@ fvec4 ijkVecCrossNormalizeSafeGetLength4f(fvec4 const v_lh, fvec4 const v_rh, fl
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: unit cross product
-fvec4 ijkVecCrossNormalizeGetLengthInv4f(fvec4 const v_lh, fvec4 const v_rh, float* const lengthInv_out);
+ijk_inl fvec4 ijkVecCrossNormalizeGetLengthInv4f(fvec4 const v_lh, fvec4 const v_rh, float* const lengthInv_out);
 
 // ijkVecCrossNormalizeSafeGetLengthInv4*
 //	Calculate unit-length result of cross product; also capture inverse length;
@@ -6274,7 +6274,7 @@ fvec4 ijkVecCrossNormalizeGetLengthInv4f(fvec4 const v_lh, fvec4 const v_rh, flo
 //		param v_rh: right-hand vector
 //		param lengthInv_out: pointer to length storage
 //		return: unit cross product
-fvec4 ijkVecCrossNormalizeSafeGetLengthInv4f(fvec4 const v_lh, fvec4 const v_rh, float* const lengthInv_out);
+ijk_inl fvec4 ijkVecCrossNormalizeSafeGetLengthInv4f(fvec4 const v_lh, fvec4 const v_rh, float* const lengthInv_out);
 
 // ijkVecLerp4*
 //	Vector linear interpolation.
@@ -6283,7 +6283,7 @@ fvec4 ijkVecCrossNormalizeSafeGetLengthInv4f(fvec4 const v_lh, fvec4 const v_rh,
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-fvec4 ijkVecLerp4f(fvec4 const v0, fvec4 const v1, float const u);
+ijk_inl fvec4 ijkVecLerp4f(fvec4 const v0, fvec4 const v1, float const u);
 
 // ijkVecLerpInv4*
 //	Vector linear interpolation inverse to calculate parameters given control .
@@ -6292,7 +6292,7 @@ fvec4 ijkVecLerp4f(fvec4 const v0, fvec4 const v1, float const u);
 //		param v_lerp: interpolated vector used to calculate parameters; params 
 //			in range [0,1] indicate interpolation, others for extrapolation
 //		return: interpolation parameter for each component
-fvec4 ijkVecLerpInv4f(fvec4 const v0, fvec4 const v1, fvec4 const v_lerp);
+ijk_inl fvec4 ijkVecLerpInv4f(fvec4 const v0, fvec4 const v1, fvec4 const v_lerp);
 
 // ijkVecLerpRevInit4*
 //	Vector linear interpolation reversal to calculate initial control.
@@ -6301,7 +6301,7 @@ fvec4 ijkVecLerpInv4f(fvec4 const v0, fvec4 const v1, fvec4 const v_lerp);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: initial control vector, result when param is 0
-fvec4 ijkVecLerpRevInit4f(fvec4 const v_lerp, fvec4 const v1, float const u);
+ijk_inl fvec4 ijkVecLerpRevInit4f(fvec4 const v_lerp, fvec4 const v1, float const u);
 
 // ijkVecLerpRevTerm4*
 //	Vector linear interpolation reversal to calculate terminal control.
@@ -6310,28 +6310,28 @@ fvec4 ijkVecLerpRevInit4f(fvec4 const v_lerp, fvec4 const v1, float const u);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: terminal control vector, result when param is 1
-fvec4 ijkVecLerpRevTerm4f(fvec4 const v0, fvec4 const v_lerp, float const u);
+ijk_inl fvec4 ijkVecLerpRevTerm4f(fvec4 const v0, fvec4 const v_lerp, float const u);
 
 // ijkVecProjRatio4*
 //	Calculate projection length ratio.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: length ratio of projected vector to base
-float ijkVecProjRatio4f(fvec4 const v_base, fvec4 const v_in);
+ijk_inl float ijkVecProjRatio4f(fvec4 const v_base, fvec4 const v_in);
 
 // ijkVecProj4*
 //	Vector projection.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be projected
 //		return: projected input onto base
-fvec4 ijkVecProj4f(fvec4 const v_base, fvec4 const v_in);
+ijk_inl fvec4 ijkVecProj4f(fvec4 const v_base, fvec4 const v_in);
 
 // ijkVecOrtho4*
 //	Vector orthogonalization using the Gram-Schmidt process.
 //		param v_base: fixed base vector onto which input is projected
 //		param v_in: input vector to be orthogonalized
 //		return: output orthogonalized vector
-fvec4 ijkVecOrtho4f(fvec4 const v_base, fvec4 const v_in);
+ijk_inl fvec4 ijkVecOrtho4f(fvec4 const v_base, fvec4 const v_in);
 
 // ijkVecOrthoNorm4*
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -6339,7 +6339,7 @@ fvec4 ijkVecOrtho4f(fvec4 const v_base, fvec4 const v_in);
 //		param v_in: input vector to be orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: output orthonormalized vector
-fvec4 ijkVecOrthoNorm4f(fvec4 const v_base, fvec4 const v_in, fvec4* const v_base_norm_out);
+ijk_inl fvec4 ijkVecOrthoNorm4f(fvec4 const v_base, fvec4 const v_in, fvec4* const v_base_norm_out);
 
 // ijkVecOrthoList4*
 //	Vector orthogonalization using the Gram-Schmidt process.
@@ -6348,7 +6348,7 @@ fvec4 ijkVecOrthoNorm4f(fvec4 const v_base, fvec4 const v_in, fvec4* const v_bas
 //		param vl_in: input list of vectors to be orthogonalized
 //		param n: number of vectors to orthogonalize
 //		return: vl_out
-fvec4* ijkVecOrthoList4f(fvec4 vl_out[], fvec4 const v_base, fvec4 const vl_in[], size const n);
+ijk_inl fvec4* ijkVecOrthoList4f(fvec4 vl_out[], fvec4 const v_base, fvec4 const vl_in[], size const n);
 
 // ijkVecOrthoNormList4*
 //	Vector orthonormalization using the Gram-Schmidt process.
@@ -6358,7 +6358,7 @@ fvec4* ijkVecOrthoList4f(fvec4 vl_out[], fvec4 const v_base, fvec4 const vl_in[]
 //		param n: number of vectors to orthonormalized
 //		param v_base_norm_out: normalized base vector
 //		return: vl_out
-fvec4* ijkVecOrthoNormList4f(fvec4 vl_out[], fvec4 const v_base, fvec4 const vl_in[], size const n, fvec4* const v_base_norm_out);
+ijk_inl fvec4* ijkVecOrthoNormList4f(fvec4 vl_out[], fvec4 const v_base, fvec4 const vl_in[], size const n, fvec4* const v_base_norm_out);
 
 // ijkVecNlerp4*
 //	Calculate normalized linear interpolation between two 4D vectors; keeps
@@ -6368,7 +6368,7 @@ fvec4* ijkVecOrthoNormList4f(fvec4 vl_out[], fvec4 const v_base, fvec4 const vl_
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-fvec4 ijkVecNlerp4f(fvec4 const v0, fvec4 const v1, float const u);
+ijk_inl fvec4 ijkVecNlerp4f(fvec4 const v0, fvec4 const v1, float const u);
 
 // ijkVecSlerp4*
 //	Calculate spherical linear interpolation between two unit 4D vectors; keeps
@@ -6378,49 +6378,49 @@ fvec4 ijkVecNlerp4f(fvec4 const v0, fvec4 const v1, float const u);
 //		param u: interpolation parameter; values in domain [0,1] result in 
 //			interpolation in range [v0,v1], others result in extrapolation
 //		return: interpolated vector
-fvec4 ijkVecSlerp4f(fvec4 const v0, fvec4 const v1, float const u);
+ijk_inl fvec4 ijkVecSlerp4f(fvec4 const v0, fvec4 const v1, float const u);
 
 // ijkVecReflectScale4*
 //	Reflect incident vector about normal, scaling to match normal size.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-fvec4 ijkVecReflectScale4f(fvec4 const v_in, fvec4 const v_nrm);
+ijk_inl fvec4 ijkVecReflectScale4f(fvec4 const v_in, fvec4 const v_nrm);
 
 // ijkVecUnitReflect4*
 //	Reflect incident vector about normal; optimized for unit normal vector.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-fvec4 ijkVecUnitReflect4f(fvec4 const v_in, fvec4 const v_nrm);
+ijk_inl fvec4 ijkVecUnitReflect4f(fvec4 const v_in, fvec4 const v_nrm);
 
 // ijkVecReflect4*
 //	Reflect incident vector about normal.
 //		param v_in: input vector, incident vector
 //		param v_nrm: normal vector
 //		return: reflected vector
-fvec4 ijkVecReflect4f(fvec4 const v_in, fvec4 const v_nrm);
+ijk_inl fvec4 ijkVecReflect4f(fvec4 const v_in, fvec4 const v_nrm);
 
 // ijkVecDistance4*
 //	Calculate "distance" between two 4D vectors.
 //		param v_lh: left-hand input
 //		param v_rh: right-hand input
 //		return: distance between inputs
-float ijkVecDistance4f(fvec4 const v_lh, fvec4 const v_rh);
+ijk_inl float ijkVecDistance4f(fvec4 const v_lh, fvec4 const v_rh);
 
 // ijkVecResize4*
 //	Change length of vector, retaining direction.
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: resized vector
-fvec4 ijkVecResize4f(fvec4 const v_in, float const length);
+ijk_inl fvec4 ijkVecResize4f(fvec4 const v_in, float const length);
 
 // ijkVecResizeSafe4*
 //	Change length of vector, retaining direction; division-by-zero safe.
 //		param v_in: input vector
 //		param length: new length of vector
 //		return: resized vector
-fvec4 ijkVecResizeSafe4f(fvec4 const v_in, float const length);
+ijk_inl fvec4 ijkVecResizeSafe4f(fvec4 const v_in, float const length);
 
 // ijkVecCrossResize4*
 //	Change length of cross product result, retaining direction.
@@ -6428,7 +6428,7 @@ fvec4 ijkVecResizeSafe4f(fvec4 const v_in, float const length);
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized cross product
-fvec4 ijkVecCrossResize4f(fvec4 const v_lh, fvec4 const v_rh, float const length);
+ijk_inl fvec4 ijkVecCrossResize4f(fvec4 const v_lh, fvec4 const v_rh, float const length);
 
 // ijkVecCrossResizeSafe4*
 //	Change length of cross product result, retaining direction; 
@@ -6437,7 +6437,7 @@ fvec4 ijkVecCrossResize4f(fvec4 const v_lh, fvec4 const v_rh, float const length
 //		param v_lh: right-hand vector
 //		param length: new length of vector
 //		return: resized cross product
-fvec4 ijkVecCrossResizeSafe4f(fvec4 const v_lh, fvec4 const v_rh, float const length);
+ijk_inl fvec4 ijkVecCrossResizeSafe4f(fvec4 const v_lh, fvec4 const v_rh, float const length);
 
 // ijkVecNearest4*
 //	Nearest-neighbor interpolation between two reference values.
@@ -6445,7 +6445,7 @@ fvec4 ijkVecCrossResizeSafe4f(fvec4 const v_lh, fvec4 const v_rh, float const le
 //		param v1: terminal reference value/end point, result when t>=0.5
 //		param u: interpolation parameter
 //		return: nearest-neighbor interpolated vector, exactly v0 or v1
-fvec4 ijkVecNearest4f(fvec4 const v0, fvec4 const v1, float const u);
+ijk_inl fvec4 ijkVecNearest4f(fvec4 const v0, fvec4 const v1, float const u);
 
 // ijkVecBinearest4*
 //	Nearest-neighbor interpolation of nearest-neighbor interpolated values.
@@ -6461,7 +6461,7 @@ fvec4 ijkVecNearest4f(fvec4 const v0, fvec4 const v1, float const u);
 //		param u1: interpolation parameter for second pair
 //		param u: interpolation parameter for results
 //		return: bi-nearest-neighbor interpolated vector
-fvec4 ijkVecBinearest4f(fvec4 const v00, fvec4 const v01, fvec4 const v10, fvec4 const v11, float const u0, float const u1, float const u);
+ijk_inl fvec4 ijkVecBinearest4f(fvec4 const v00, fvec4 const v01, fvec4 const v10, fvec4 const v11, float const u0, float const u1, float const u);
 
 // ijkVecRemap4*
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -6475,14 +6475,14 @@ fvec4 ijkVecBinearest4f(fvec4 const v00, fvec4 const v01, fvec4 const v10, fvec4
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: vector in original range remapped to target range
-fvec4 ijkVecRemap4f(fvec4 const v0_dst, fvec4 const v1_dst, fvec4 const v0_src, fvec4 const v1_src, fvec4 const v_src);
+ijk_inl fvec4 ijkVecRemap4f(fvec4 const v0_dst, fvec4 const v1_dst, fvec4 const v0_src, fvec4 const v1_src, fvec4 const v_src);
 
 // ijkVecBezier0O4*
 //	Perform order-0 (point) Bezier interpolation given one reference value.
 //		param v0: reference value, always returned
 //		param u: interpolation parameter; not used for order 0 interpolation
 //		return: v0
-fvec4 ijkVecBezier0O4f(fvec4 const v0, float const u);
+ijk_inl fvec4 ijkVecBezier0O4f(fvec4 const v0, float const u);
 
 // ijkVecBezier1O4*
 //	Perform order-1 (linear) Bezier interpolation given two reference values.
@@ -6491,7 +6491,7 @@ fvec4 ijkVecBezier0O4f(fvec4 const v0, float const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: linear interpolation between v0 and v1
-fvec4 ijkVecBezier1O4f(fvec4 const v0, fvec4 const v1, float const u);
+ijk_inl fvec4 ijkVecBezier1O4f(fvec4 const v0, fvec4 const v1, float const u);
 
 // ijkVecBezier2O4*
 //	Perform order-2 (quadratic) Bezier interpolation given three reference 
@@ -6502,7 +6502,7 @@ fvec4 ijkVecBezier1O4f(fvec4 const v0, fvec4 const v1, float const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v2
 //		return: quadratic Bezier interpolation between v0 and v2
-fvec4 ijkVecBezier2O4f(fvec4 const v0, fvec4 const v1, fvec4 const v2, float const u);
+ijk_inl fvec4 ijkVecBezier2O4f(fvec4 const v0, fvec4 const v1, fvec4 const v2, float const u);
 
 // ijkVecBezier3O4*
 //	Perform order-3 (cubic) Bezier interpolation given four reference values.
@@ -6513,7 +6513,7 @@ fvec4 ijkVecBezier2O4f(fvec4 const v0, fvec4 const v1, fvec4 const v2, float con
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v3
 //		return: cubic Bezier interpolation between v0 and v3
-fvec4 ijkVecBezier3O4f(fvec4 const v0, fvec4 const v1, fvec4 const v2, fvec4 const v3, float const u);
+ijk_inl fvec4 ijkVecBezier3O4f(fvec4 const v0, fvec4 const v1, fvec4 const v2, fvec4 const v3, float const u);
 
 // ijkVecBezierNO4*
 //	Perform order-N (recursive) Bezier interpolation given an array of 
@@ -6526,7 +6526,7 @@ fvec4 ijkVecBezier3O4f(fvec4 const v0, fvec4 const v1, fvec4 const v2, fvec4 con
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v[0] and v[order]
 //		return: recursive Bezier interpolation between v[0] and v[order]
-fvec4 ijkVecBezierNO4f(fvec4 const v[], size const order, float const u);
+ijk_inl fvec4 ijkVecBezierNO4f(fvec4 const v[], size const order, float const u);
 
 // ijkVecCubicHermite4*
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -6538,7 +6538,7 @@ fvec4 ijkVecBezierNO4f(fvec4 const v[], size const order, float const u);
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-fvec4 ijkVecCubicHermite4f(fvec4 const v0, fvec4 const dv0, fvec4 const v1, fvec4 const dv1, float const u);
+ijk_inl fvec4 ijkVecCubicHermite4f(fvec4 const v0, fvec4 const dv0, fvec4 const v1, fvec4 const dv1, float const u);
 
 // ijkVecCubicHermiteHandles4*
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -6552,7 +6552,7 @@ fvec4 ijkVecCubicHermite4f(fvec4 const v0, fvec4 const dv0, fvec4 const v1, fvec
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-fvec4 ijkVecCubicHermiteHandles4f(fvec4 const v0, fvec4 const cv0, fvec4 const v1, fvec4 const cv1, float const u);
+ijk_inl fvec4 ijkVecCubicHermiteHandles4f(fvec4 const v0, fvec4 const cv0, fvec4 const v1, fvec4 const cv1, float const u);
 
 // ijkVecCubicCatmullRom4*
 //	Catmull-Rom spline/curve interpolation between two reference values with 
@@ -6564,7 +6564,7 @@ fvec4 ijkVecCubicHermiteHandles4f(fvec4 const v0, fvec4 const cv0, fvec4 const v
 //		param u: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated vector on spline/curve segment
-fvec4 ijkVecCubicCatmullRom4f(fvec4 const vp, fvec4 const v0, fvec4 const v1, fvec4 const v2, float const u);
+ijk_inl fvec4 ijkVecCubicCatmullRom4f(fvec4 const vp, fvec4 const v0, fvec4 const v1, fvec4 const v2, float const u);
 
 // ijkVecBicubicCatmullRom4*
 //	Bi-cubic interpolation using Catmull-Rom interpolation for segments.
@@ -6598,7 +6598,7 @@ fvec4 ijkVecCubicCatmullRom4f(fvec4 const vp, fvec4 const v0, fvec4 const v1, fv
 //		param u2: interpolation parameter for terminal control curve
 //		param u: interpolation parameter for result
 //		return: interpolated vector
-fvec4 ijkVecBicubicCatmullRom4f(fvec4 const vpp, fvec4 const vp0, fvec4 const vp1, fvec4 const vp2, fvec4 const v0p, fvec4 const v00, fvec4 const v01, fvec4 const v02, fvec4 const v1p, fvec4 const v10, fvec4 const v11, fvec4 const v12, fvec4 const v2p, fvec4 const v20, fvec4 const v21, fvec4 const v22, float const up, float const u0, float const u1, float const u2, float const u);
+ijk_inl fvec4 ijkVecBicubicCatmullRom4f(fvec4 const vpp, fvec4 const vp0, fvec4 const vp1, fvec4 const vp2, fvec4 const v0p, fvec4 const v00, fvec4 const v01, fvec4 const v02, fvec4 const v1p, fvec4 const v10, fvec4 const v11, fvec4 const v12, fvec4 const v2p, fvec4 const v20, fvec4 const v21, fvec4 const v22, float const up, float const u0, float const u1, float const u2, float const u);
 
 // ijkVecReparamCubicHermite4*
 //	Reparameterize a cubic Hermite segment into sample table.
@@ -6618,7 +6618,7 @@ fvec4 ijkVecBicubicCatmullRom4f(fvec4 const vpp, fvec4 const vp0, fvec4 const vp
 //		param v1: terminal reference value/end point, result when t=1
 //		param dv1: terminal tangent/rate of change
 //		return: total arc length
-float ijkVecReparamCubicHermite4f(float uTable_out[], float lTable_out[], fvec4 vTable_out[], size const numDivisions, ibool const lNormalize, fvec4 const v0, fvec4 const dv0, fvec4 const v1, fvec4 const dv1);
+ijk_inl float ijkVecReparamCubicHermite4f(float uTable_out[], float lTable_out[], fvec4 vTable_out[], size const numDivisions, ibool const lNormalize, fvec4 const v0, fvec4 const dv0, fvec4 const v1, fvec4 const dv1);
 
 // ijkVecReparamCubicHermiteHandles4*
 //	Reparameterize a cubic Hermite segment with handles into sample table.
@@ -6640,7 +6640,7 @@ float ijkVecReparamCubicHermite4f(float uTable_out[], float lTable_out[], fvec4
 //		param cv1: terminal control handle value, should be greater than v1 
 //			for a positive rate of change
 //		return: total arc length
-float ijkVecReparamCubicHermiteHandles4f(float uTable_out[], float lTable_out[], fvec4 vTable_out[], size const numDivisions, ibool const lNormalize, fvec4 const v0, fvec4 const cv0, fvec4 const v1, fvec4 const cv1);
+ijk_inl float ijkVecReparamCubicHermiteHandles4f(float uTable_out[], float lTable_out[], fvec4 vTable_out[], size const numDivisions, ibool const lNormalize, fvec4 const v0, fvec4 const cv0, fvec4 const v1, fvec4 const cv1);
 
 // ijkVecReparamCubicCatmullRom4*
 //	Reparameterize a cubic Catmull-Rom segment into sample table.
@@ -6660,7 +6660,7 @@ float ijkVecReparamCubicHermiteHandles4f(float uTable_out[], float lTable_out[],
 //		param v1: terminal reference value/end point, result when t=1
 //		param v2: terminal control value
 //		return: total arc length
-float ijkVecReparamCubicCatmullRom4f(float uTable_out[], float lTable_out[], fvec4 vTable_out[], size const numDivisions, ibool const lNormalize, fvec4 const vp, fvec4 const v0, fvec4 const v1, fvec4 const v2);
+ijk_inl float ijkVecReparamCubicCatmullRom4f(float uTable_out[], float lTable_out[], fvec4 vTable_out[], size const numDivisions, ibool const lNormalize, fvec4 const vp, fvec4 const v0, fvec4 const v1, fvec4 const v2);
 
 // ijkVecReparamBicubicCatmullRom4*
 //	Reparameterize a bi-cubic Catmull-Rom segment into sample table.
@@ -6704,7 +6704,7 @@ float ijkVecReparamCubicCatmullRom4f(float uTable_out[], float lTable_out[], fve
 //		param u1: interpolation parameter for terminal value curve
 //		param u2: interpolation parameter for terminal control curve
 //		return: total arc length
-float ijkVecReparamBicubicCatmullRom4f(float uTable_out[], float lTable_out[], fvec4 vTable_out[], size const numDivisions, ibool const lNormalize, fvec4 const vpp, fvec4 const vp0, fvec4 const vp1, fvec4 const vp2, fvec4 const v0p, fvec4 const v00, fvec4 const v01, fvec4 const v02, fvec4 const v1p, fvec4 const v10, fvec4 const v11, fvec4 const v12, fvec4 const v2p, fvec4 const v20, fvec4 const v21, fvec4 const v22, float const up, float const u0, float const u1, float const u2);
+ijk_inl float ijkVecReparamBicubicCatmullRom4f(float uTable_out[], float lTable_out[], fvec4 vTable_out[], size const numDivisions, ibool const lNormalize, fvec4 const vpp, fvec4 const vp0, fvec4 const vp1, fvec4 const vp2, fvec4 const v0p, fvec4 const v00, fvec4 const v01, fvec4 const v02, fvec4 const v1p, fvec4 const v10, fvec4 const v11, fvec4 const v12, fvec4 const v2p, fvec4 const v20, fvec4 const v21, fvec4 const v22, float const up, float const u0, float const u1, float const u2);
 
 // ijkVecSampleTableInc4*
 //	Find index of parameter in table and approximate value by interpolating 
@@ -6721,7 +6721,7 @@ float ijkVecReparamBicubicCatmullRom4f(float uTable_out[], float lTable_out[], f
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: interpolated vector in table that approximates input parameter
-fvec4 ijkVecSampleTableInc4f(float const uTable[], fvec4 const vTable[], index i, index di, float const u);
+ijk_inl fvec4 ijkVecSampleTableInc4f(float const uTable[], fvec4 const vTable[], index i, index di, float const u);
 
 // ijkVecSampleTableDec4*
 //	Find index of parameter in table and approximate value by interpolating 
@@ -6738,7 +6738,7 @@ fvec4 ijkVecSampleTableInc4f(float const uTable[], fvec4 const vTable[], index i
 //			note: defaults to 1 if passed 0
 //		param u: input parameter to find in search table
 //		return: interpolated vector in table that approximates input parameter
-fvec4 ijkVecSampleTableDec4f(float const uTable[], fvec4 const vTable[], index i, index di, float const u);
+ijk_inl fvec4 ijkVecSampleTableDec4f(float const uTable[], fvec4 const vTable[], index i, index di, float const u);
 
 
 //-----------------------------------------------------------------------------
@@ -6755,91 +6755,91 @@ extern "C" {
 //	Compress decimal scalar into a single byte (8 bits).
 //		param v_in: symmetric-unit scalar to compress, in [-1,+1]
 //		return: byte encoding scalar
-i8 ijkVecPack1fb(f32 const v_in);
+ijk_inl i8 ijkVecPack1fb(f32 const v_in);
 
 // ijkVecUnpack1*b
 //	Decompress decimal scalar from a single byte (8 bits).
 //		param i_in: integer encoding scalar to decompress
 //		return: decoded scalar
-f32 ijkVecUnpack1fb(i8 const i_in);
+ijk_inl f32 ijkVecUnpack1fb(i8 const i_in);
 
 // ijkVecPack1*s
 //	Compress decimal scalar into a short integer (16 bits).
 //		param v_in: symmetric-unit scalar to compress, in [-1,+1]
 //		return: short integer encoding scalar
-i16 ijkVecPack1fs(f32 const v_in);
+ijk_inl i16 ijkVecPack1fs(f32 const v_in);
 
 // ijkVecUnpack1*s
 //	Decompress decimal scalar from a short integer (16 bits).
 //		param i_in: integer encoding scalar to decompress
 //		return: decoded scalar
-f32 ijkVecUnpack1fs(i16 const i_in);
+ijk_inl f32 ijkVecUnpack1fs(i16 const i_in);
 
 // ijkVecPack2*vs
 //	Compress 2D vector into a short integer (16 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i16 ijkVecPack2fvs(float2 const v_in);
+ijk_inl i16 ijkVecPack2fvs(float2 const v_in);
 
 // ijkVecUnpack2*vs
 //	Decompress 2D vector from a short integer (16 bits).
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-floatv ijkVecUnpack2fvs(float2 v_out, i16 const i_in);
+ijk_inl floatv ijkVecUnpack2fvs(float2 v_out, i16 const i_in);
 
 // ijkVecPack2*vl
 //	Compress 2D vector into a long integer (32 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPack2fvl(float2 const v_in);
+ijk_inl i32 ijkVecPack2fvl(float2 const v_in);
 
 // ijkVecUnpack2*vl
 //	Decompress 2D vector from a long integer (32 bits).
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-floatv ijkVecUnpack2fvl(float2 v_out, i32 const i_in);
+ijk_inl floatv ijkVecUnpack2fvl(float2 v_out, i32 const i_in);
 
 // ijkVecPack3*vl
 //	Compress 3D vector into a long integer (32 bits); components are encoded 
 //	into 10 bits each.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPack3fvl(float3 const v_in);
+ijk_inl i32 ijkVecPack3fvl(float3 const v_in);
 
 // ijkVecUnpack3*vl
 //	Decompress 3D vector from a long integer (32 bits).
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-floatv ijkVecUnpack3fvl(float3 v_out, i32 const i_in);
+ijk_inl floatv ijkVecUnpack3fvl(float3 v_out, i32 const i_in);
 
 // ijkVecPack4*vl
 //	Compress 4D vector into a long integer (32 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPack4fvl(float4 const v_in);
+ijk_inl i32 ijkVecPack4fvl(float4 const v_in);
 
 // ijkVecUnpack4*vl
 //	Decompress 4D vector from a long integer (32 bits).
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-floatv ijkVecUnpack4fvl(float4 v_out, i32 const i_in);
+ijk_inl floatv ijkVecUnpack4fvl(float4 v_out, i32 const i_in);
 
 // ijkVecPack4*vll
 //	Compress 4D vector into a long-long integer (64 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i64 ijkVecPack4fvll(float4 const v_in);
+ijk_inl i64 ijkVecPack4fvll(float4 const v_in);
 
 // ijkVecUnpack4*vll
 //	Decompress 4D vector from a long-long integer (64 bits).
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-floatv ijkVecUnpack4fvll(float4 v_out, i64 const i_in);
+ijk_inl floatv ijkVecUnpack4fvll(float4 v_out, i64 const i_in);
 
 // ijkVecPackUnitXYZ4*vl
 //	Compress three components of 4D unit vector into a long integer (32 bits); 
@@ -6847,7 +6847,7 @@ floatv ijkVecUnpack4fvll(float4 v_out, i64 const i_in);
 //	specifies the sign of the fourth element.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPackUnitXYZ4fvl(float4 const v_in);
+ijk_inl i32 ijkVecPackUnitXYZ4fvl(float4 const v_in);
 
 // ijkVecUnpackUnitXYZ4*vl
 //	Decompress 4D unit vector from a long integer (32 bits) encoding only 
@@ -6855,7 +6855,7 @@ i32 ijkVecPackUnitXYZ4fvl(float4 const v_in);
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-floatv ijkVecUnpackUnitXYZ4fvl(float4 v_out, i32 const i_in);
+ijk_inl floatv ijkVecUnpackUnitXYZ4fvl(float4 v_out, i32 const i_in);
 
 // ijkVecPackUnit3of4*vl
 //	Compress three components of 4D unit vector into a long integer (32 bits); 
@@ -6865,7 +6865,7 @@ floatv ijkVecUnpackUnitXYZ4fvl(float4 v_out, i32 const i_in);
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		param excl: index of excluded element, in [0,3]
 //		return: short integer encoding vector
-i32 ijkVecPackUnit3of4fvl(float4 const v_in, ui32 const excl);
+ijk_inl i32 ijkVecPackUnit3of4fvl(float4 const v_in, ui32 const excl);
 
 // ijkVecUnpackUnit3of4*vl
 //	Decompress 4D unit vector from a long integer (32 bits) encoding only 
@@ -6874,7 +6874,7 @@ i32 ijkVecPackUnit3of4fvl(float4 const v_in, ui32 const excl);
 //		param i_in: integer encoding vector to decompress
 //		param excl_out: pointer to storage for index of excluded element
 //		return: v_out
-floatv ijkVecUnpackUnit3of4fvl(float4 v_out, i32 const i_in, ui32* const excl_out);
+ijk_inl floatv ijkVecUnpackUnit3of4fvl(float4 v_out, i32 const i_in, ui32* const excl_out);
 
 // ijkVecPackQuant4*l
 //	Compress three components of 4D quantized unit vector into a long integer 
@@ -6885,7 +6885,7 @@ floatv ijkVecUnpackUnit3of4fvl(float4 v_out, i32 const i_in, ui32* const excl_ou
 //	component is negative, the entire vector is negated to make it positive.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPackQuant4fvl(float4 const v_in);
+ijk_inl i32 ijkVecPackQuant4fvl(float4 const v_in);
 
 // ijkVecUnpackQuant4*l
 //	Decompress 4D quantized unit vector from a long integer (32 bits) 
@@ -6893,7 +6893,7 @@ i32 ijkVecPackQuant4fvl(float4 const v_in);
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-floatv ijkVecUnpackQuant4fvl(float4 v_out, i32 const i_in);
+ijk_inl floatv ijkVecUnpackQuant4fvl(float4 v_out, i32 const i_in);
 
 // ijkVecPackUnitXYZ4*vll
 //	Compress three components of 4D unit vector into a long-long integer 
@@ -6901,7 +6901,7 @@ floatv ijkVecUnpackQuant4fvl(float4 v_out, i32 const i_in);
 //	bit specifies the sign of the excluded element.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i64 ijkVecPackUnitXYZ4fvll(float4 const v_in);
+ijk_inl i64 ijkVecPackUnitXYZ4fvll(float4 const v_in);
 
 // ijkVecUnpackUnitXYZ4*vll
 //	Decompress 4D unit vector from a long-long integer (64 bits) encoding 
@@ -6909,7 +6909,7 @@ i64 ijkVecPackUnitXYZ4fvll(float4 const v_in);
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-floatv ijkVecUnpackUnitXYZ4fvll(float4 v_out, i64 const i_in);
+ijk_inl floatv ijkVecUnpackUnitXYZ4fvll(float4 v_out, i64 const i_in);
 
 // ijkVecPackUnit3of4*vll
 //	Compress three components of 4D unit vector into a long-long integer 
@@ -6918,7 +6918,7 @@ floatv ijkVecUnpackUnitXYZ4fvll(float4 v_out, i64 const i_in);
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		param excl: index of excluded element, in [0,3]
 //		return: short integer encoding vector
-i64 ijkVecPackUnit3of4fvll(float4 const v_in, ui64 const excl);
+ijk_inl i64 ijkVecPackUnit3of4fvll(float4 const v_in, ui64 const excl);
 
 // ijkVecUnpackUnit3of4*vll
 //	Decompress 4D unit vector from a long-long integer (64 bits) encoding 
@@ -6927,7 +6927,7 @@ i64 ijkVecPackUnit3of4fvll(float4 const v_in, ui64 const excl);
 //		param i_in: integer encoding vector to decompress
 //		param excl_out: pointer to storage for index of excluded element
 //		return: v_out
-floatv ijkVecUnpackUnit3of4fvll(float4 v_out, i64 const i_in, ui64* const excl_out);
+ijk_inl floatv ijkVecUnpackUnit3of4fvll(float4 v_out, i64 const i_in, ui64* const excl_out);
 
 // ijkVecPackQuant4*vll
 //	Compress three components of 4D quantized unit vector into the 48 MOST 
@@ -6938,7 +6938,7 @@ floatv ijkVecUnpackUnit3of4fvll(float4 v_out, i64 const i_in, ui64* const excl_o
 //	for better precision when decoded.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i64 ijkVecPackQuant4fvll(float4 const v_in);
+ijk_inl i64 ijkVecPackQuant4fvll(float4 const v_in);
 
 // ijkVecUnpackQuant4*vll
 //	Decompress 4D quantized unit vector from a long-long integer (64 bits) 
@@ -6947,7 +6947,7 @@ i64 ijkVecPackQuant4fvll(float4 const v_in);
 //		param v_out: output vector, decoded vector
 //		param i_in: integer encoding vector to decompress
 //		return: v_out
-floatv ijkVecUnpackQuant4fvll(float4 v_out, i64 const i_in);
+ijk_inl floatv ijkVecUnpackQuant4fvll(float4 v_out, i64 const i_in);
 
 
 //-----------------------------------------------------------------------------
@@ -6964,62 +6964,62 @@ floatv ijkVecUnpackQuant4fvll(float4 v_out, i64 const i_in);
 //	Compress 2D vector into a short integer (16 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i16 ijkVecPack2fs(fvec2 const v_in);
+ijk_inl i16 ijkVecPack2fs(fvec2 const v_in);
 
 // ijkVecUnpack2*s
 //	Decompress 2D vector from a short integer (16 bits).
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-fvec2 ijkVecUnpack2fs(i16 const i_in);
+ijk_inl fvec2 ijkVecUnpack2fs(i16 const i_in);
 
 // ijkVecPack2*l
 //	Compress 2D vector into a long integer (32 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPack2fl(fvec2 const v_in);
+ijk_inl i32 ijkVecPack2fl(fvec2 const v_in);
 
 // ijkVecUnpack2*l
 //	Decompress 2D vector from a long integer (32 bits).
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-fvec2 ijkVecUnpack2fl(i32 const i_in);
+ijk_inl fvec2 ijkVecUnpack2fl(i32 const i_in);
 
 // ijkVecPack3*l
 //	Compress 3D vector into a long integer (32 bits); components are encoded 
 //	into 10 bits each.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPack3fl(fvec3 const v_in);
+ijk_inl i32 ijkVecPack3fl(fvec3 const v_in);
 
 // ijkVecUnpack3*l
 //	Decompress 3D vector from a long integer (32 bits).
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-fvec3 ijkVecUnpack3fl(i32 const i_in);
+ijk_inl fvec3 ijkVecUnpack3fl(i32 const i_in);
 
 // ijkVecPack4*l
 //	Compress 4D vector into a long integer (32 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPack4fl(fvec4 const v_in);
+ijk_inl i32 ijkVecPack4fl(fvec4 const v_in);
 
 // ijkVecUnpack4*l
 //	Decompress 4D vector from a long integer (32 bits).
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-fvec4 ijkVecUnpack4fl(i32 const i_in);
+ijk_inl fvec4 ijkVecUnpack4fl(i32 const i_in);
 
 // ijkVecPack4*ll
 //	Compress 4D vector into a long-long integer (64 bits).
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i64 ijkVecPack4fll(fvec4 const v_in);
+ijk_inl i64 ijkVecPack4fll(fvec4 const v_in);
 
 // ijkVecUnpack4*ll
 //	Decompress 4D vector from a long-long integer (64 bits).
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-fvec4 ijkVecUnpack4fll(i64 const i_in);
+ijk_inl fvec4 ijkVecUnpack4fll(i64 const i_in);
 
 // ijkVecPackUnitXYZ4*l
 //	Compress three components of 4D unit vector into a long integer (32 bits); 
@@ -7027,14 +7027,14 @@ fvec4 ijkVecUnpack4fll(i64 const i_in);
 //	specifies the sign of the fourth element.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPackUnitXYZ4fl(fvec4 const v_in);
+ijk_inl i32 ijkVecPackUnitXYZ4fl(fvec4 const v_in);
 
 // ijkVecUnpackUnitXYZ4*l
 //	Decompress 4D unit vector from a long integer (32 bits) encoding only 
 //	three components and the sign of the fourth.
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-fvec4 ijkVecUnpackUnitXYZ4fl(i32 const i_in);
+ijk_inl fvec4 ijkVecUnpackUnitXYZ4fl(i32 const i_in);
 
 // ijkVecPackUnit3of4*l
 //	Compress three components of 4D unit vector into a long integer (32 bits); 
@@ -7044,7 +7044,7 @@ fvec4 ijkVecUnpackUnitXYZ4fl(i32 const i_in);
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		param excl: index of excluded element, in [0,3]
 //		return: short integer encoding vector
-i32 ijkVecPackUnit3of4fl(fvec4 const v_in, ui32 const excl);
+ijk_inl i32 ijkVecPackUnit3of4fl(fvec4 const v_in, ui32 const excl);
 
 // ijkVecUnpackUnit3of4*l
 //	Decompress 4D unit vector from a long integer (32 bits) encoding only 
@@ -7052,7 +7052,7 @@ i32 ijkVecPackUnit3of4fl(fvec4 const v_in, ui32 const excl);
 //		param i_in: integer encoding vector to decompress
 //		param excl_out: pointer to storage for index of excluded element
 //		return: decoded vector
-fvec4 ijkVecUnpackUnit3of4fl(i32 const i_in, ui32* const excl_out);
+ijk_inl fvec4 ijkVecUnpackUnit3of4fl(i32 const i_in, ui32* const excl_out);
 
 // ijkVecPackQuant4*l
 //	Compress three components of 4D quantized unit vector into a long integer 
@@ -7063,14 +7063,14 @@ fvec4 ijkVecUnpackUnit3of4fl(i32 const i_in, ui32* const excl_out);
 //	component is negative, the entire vector is negated to make it positive.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i32 ijkVecPackQuant4fl(fvec4 const v_in);
+ijk_inl i32 ijkVecPackQuant4fl(fvec4 const v_in);
 
 // ijkVecUnpackQuant4*l
 //	Decompress 4D quantized unit vector from a long integer (32 bits) 
 //	encoding only three components and the index of the fourth.
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-fvec4 ijkVecUnpackQuant4fl(i32 const i_in);
+ijk_inl fvec4 ijkVecUnpackQuant4fl(i32 const i_in);
 
 // ijkVecPackUnitXYZ4*ll
 //	Compress three components of 4D unit vector into a long-long integer 
@@ -7078,14 +7078,14 @@ fvec4 ijkVecUnpackQuant4fl(i32 const i_in);
 //	bit specifies the sign of the excluded element.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i64 ijkVecPackUnitXYZ4fll(fvec4 const v_in);
+ijk_inl i64 ijkVecPackUnitXYZ4fll(fvec4 const v_in);
 
 // ijkVecUnpackUnitXYZ4*ll
 //	Decompress 4D unit vector from a long-long integer (64 bits) encoding 
 //	only three components and the sign of the fourth.
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-fvec4 ijkVecUnpackUnitXYZ4fll(i64 const i_in);
+ijk_inl fvec4 ijkVecUnpackUnitXYZ4fll(i64 const i_in);
 
 // ijkVecPackUnit3of4*ll
 //	Compress three components of 4D unit vector into a long-long integer 
@@ -7094,7 +7094,7 @@ fvec4 ijkVecUnpackUnitXYZ4fll(i64 const i_in);
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		param excl: index of excluded element, in [0,3]
 //		return: short integer encoding vector
-i64 ijkVecPackUnit3of4fll(fvec4 const v_in, ui64 const excl);
+ijk_inl i64 ijkVecPackUnit3of4fll(fvec4 const v_in, ui64 const excl);
 
 // ijkVecUnpackUnit3of4*ll
 //	Decompress 4D unit vector from a long-long integer (64 bits) encoding 
@@ -7102,7 +7102,7 @@ i64 ijkVecPackUnit3of4fll(fvec4 const v_in, ui64 const excl);
 //		param i_in: integer encoding vector to decompress
 //		param excl_out: pointer to storage for index of excluded element
 //		return: decoded vector
-fvec4 ijkVecUnpackUnit3of4fll(i64 const i_in, ui64* const excl_out);
+ijk_inl fvec4 ijkVecUnpackUnit3of4fll(i64 const i_in, ui64* const excl_out);
 
 // ijkVecPackQuant4*ll
 //	Compress three components of 4D quantized unit vector into the 48 MOST 
@@ -7113,7 +7113,7 @@ fvec4 ijkVecUnpackUnit3of4fll(i64 const i_in, ui64* const excl_out);
 //	for better precision when decoded.
 //		param v_in: symmetric-unit vector to compress, elements in [-1,+1]
 //		return: short integer encoding vector
-i64 ijkVecPackQuant4fll(fvec4 const v_in);
+ijk_inl i64 ijkVecPackQuant4fll(fvec4 const v_in);
 
 // ijkVecUnpackQuant4*ll
 //	Decompress 4D quantized unit vector from a long-long integer (64 bits) 
@@ -7121,7 +7121,7 @@ i64 ijkVecPackQuant4fll(fvec4 const v_in);
 //	decoded elements are stored in the 48 MOST significant bits.
 //		param i_in: integer encoding vector to decompress
 //		return: decoded vector
-fvec4 ijkVecUnpackQuant4fll(i64 const i_in);
+ijk_inl fvec4 ijkVecUnpackQuant4fll(i64 const i_in);
 
 
 //-----------------------------------------------------------------------------
@@ -38,50 +38,50 @@ extern "C" {
 //	Absolute value of scalar: (s >= 0 ? +s : -s).
 //		param s: scalar
 //		return: absolute value
-i32 ijkVecAbs1is(i32 const s);
+ijk_inl i32 ijkVecAbs1is(i32 const s);
 
 // ijkVecSgn1*s
 //	Sign of scalar: (s != 0 ? s > 0 ? +1 : -1).
 //		param s: scalar
 //		return: sign
-i32 ijkVecSgn1is(i32 const s);
+ijk_inl i32 ijkVecSgn1is(i32 const s);
 
 // ijkVecDot1*s
 //	Dot product of scalars, which is just their product.
 //		param s_lh: left-hand scalar
 //		param s_rh: right-hand scalar
 //		return: product
-i32 ijkVecDot1is(i32 const s_lh, i32 const s_rh);
+ijk_inl i32 ijkVecDot1is(i32 const s_lh, i32 const s_rh);
 
 // ijkVecLengthSq1*s
 //	Squared length of scalar.
 //		param s: scalar
 //		return: squared length
-i32 ijkVecLengthSq1is(i32 const s);
+ijk_inl i32 ijkVecLengthSq1is(i32 const s);
 
 // ijkVecLength1*s
 //	Length of scalar.
 //		param s: scalar
 //		return: length
-i32 ijkVecLength1is(i32 const s);
+ijk_inl i32 ijkVecLength1is(i32 const s);
 
 // ijkVecLengthSqInv1*s
 //	Inverse squared length of scalar.
 //		param s: scalar
 //		return: inverse squared length
-f32 ijkVecLengthSqInv1is(i32 const s);
+ijk_inl f32 ijkVecLengthSqInv1is(i32 const s);
 
 // ijkVecLengthSqInv1*s
 //	Inverse length of scalar.
 //		param s: scalar
 //		return: inverse length
-f32 ijkVecLengthInv1is(i32 const s);
+ijk_inl f32 ijkVecLengthInv1is(i32 const s);
 
 // ijkVecNormalize1*s
 //	Calculate unit scalar in same direction as input (sign).
 //		param s: scalar
 //		return: unit scalar (sign)
-i32 ijkVecNormalize1is(i32 const s);
+ijk_inl i32 ijkVecNormalize1is(i32 const s);
 
 // ijkVecNormalizeGetLength1*s
 //	Calculate unit scalar in same direction as input (sign).
@@ -89,7 +89,7 @@ i32 ijkVecNormalize1is(i32 const s);
 //		param s: scalar
 //		param length_out: pointer to length storage
 //		return: unit scalar (sign)
-i32 ijkVecNormalizeGetLength1is(i32 const s, i32* const length_out);
+ijk_inl i32 ijkVecNormalizeGetLength1is(i32 const s, i32* const length_out);
 
 // ijkVecNormalizeGetLengthInv1*s
 //	Calculate unit scalar in same direction as input (sign).
@@ -97,7 +97,7 @@ i32 ijkVecNormalizeGetLength1is(i32 const s, i32* const length_out);
 //		param s: scalar
 //		param lengthInv_out: pointer to length storage
 //		return: unit scalar (sign)
-i32 ijkVecNormalizeGetLengthInv1is(i32 const s, f32* const lengthInv_out);
+ijk_inl i32 ijkVecNormalizeGetLengthInv1is(i32 const s, f32* const lengthInv_out);
 
 
 //-----------------------------------------------------------------------------
@@ -106,7 +106,7 @@ i32 ijkVecNormalizeGetLengthInv1is(i32 const s, f32* const lengthInv_out);
 //	Pass-thru array-based vector function (does nothing).
 //		param v_out: output vector
 //		return: v_out
-intv ijkVecPiv(intv v_out);
+ijk_inl intv ijkVecPiv(intv v_out);
 
 
 //-----------------------------------------------------------------------------
@@ -115,7 +115,7 @@ intv ijkVecPiv(intv v_out);
 //	Initialize 2D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-intv ijkVecInit2iv(int2 v_out);
+ijk_inl intv ijkVecInit2iv(int2 v_out);
 
 // ijkVecInitElems2*v
 //	Initialize 2D vector to specified individual elements.
@@ -123,35 +123,35 @@ intv ijkVecInit2iv(int2 v_out);
 //		param x: first element
 //		param y: second element
 //		return: v_out
-intv ijkVecInitElems2iv(int2 v_out, i32 const x, i32 const y);
+ijk_inl intv ijkVecInitElems2iv(int2 v_out, i32 const x, i32 const y);
 
 // ijkVecCopy2*v
 //	Copy 2D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-intv ijkVecCopy2iv(int2 v_out, int2 const v_in);
+ijk_inl intv ijkVecCopy2iv(int2 v_out, int2 const v_in);
 
 // ijkVecNegate2*v
 //	Negate 2D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-intv ijkVecNegate2iv(int2 v_out, int2 const v_in);
+ijk_inl intv ijkVecNegate2iv(int2 v_out, int2 const v_in);
 
 // ijkVecBitNot2*v
 //	Calculate component-wise bitwise 'not' of 2D vector.
 //		param v_out: output vector to hold component-wise bitwise 'not'
 //		param v_in: input vector
 //		return: v_out
-intv ijkVecBitNot2iv(int2 v_out, int2 const v_in);
+ijk_inl intv ijkVecBitNot2iv(int2 v_out, int2 const v_in);
 
 // ijkVecNot2*v
 //	Calculate component-wise logical 'not' of 2D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot2iv(bool2 bv_out, int2 const v_in);
+ijk_inl boolv ijkVecNot2iv(bool2 bv_out, int2 const v_in);
 
 // ijkVecAdd2*v
 //	Calculate sum of 2D vectors.
@@ -159,7 +159,7 @@ boolv ijkVecNot2iv(bool2 bv_out, int2 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecAdd2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecAdd2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecSub2*v
 //	Calculate difference of 2D vectors.
@@ -167,7 +167,7 @@ intv ijkVecAdd2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecSub2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecSub2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecMul2*v
 //	Calculate component-wise product of 2D vectors.
@@ -175,7 +175,7 @@ intv ijkVecSub2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecMul2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecMul2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecDiv2*v
 //	Calculate component-wise quotient of 2D vectors.
@@ -183,7 +183,7 @@ intv ijkVecMul2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecDiv2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecDiv2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecDivSafe2*v
 //	Calculate component-wise quotient of 2D vectors, division-by-zero safe.
@@ -191,7 +191,7 @@ intv ijkVecDiv2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecDivSafe2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecDivSafe2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecMod2*v
 //	Calculate component-wise remainder of 2D vectors.
@@ -199,7 +199,7 @@ intv ijkVecDivSafe2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecMod2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecMod2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecModSafe2*v
 //	Calculate component-wise remainder of 2D vectors, division-by-zero safe.
@@ -207,7 +207,7 @@ intv ijkVecMod2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecModSafe2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecModSafe2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecBitAnd2*v
 //	Calculate component-wise bitwise 'and' of 2D vectors.
@@ -215,7 +215,7 @@ intv ijkVecModSafe2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitAnd2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitAnd2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecBitNand2*v
 //	Calculate component-wise bitwise 'not and' of 2D vectors.
@@ -223,7 +223,7 @@ intv ijkVecBitAnd2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitNand2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitNand2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecBitOr2*v
 //	Calculate component-wise bitwise 'or' of 2D vectors.
@@ -231,7 +231,7 @@ intv ijkVecBitNand2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitOr2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitOr2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecBitNor2*v
 //	Calculate component-wise bitwise 'not or' of 2D vectors.
@@ -239,7 +239,7 @@ intv ijkVecBitOr2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitNor2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitNor2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecBitXor2*v
 //	Calculate component-wise bitwise 'exclusive or' of 2D vectors.
@@ -247,7 +247,7 @@ intv ijkVecBitNor2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitXor2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitXor2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecBitXnor2*v
 //	Calculate component-wise bitwise 'not exclusive or' of 2D vectors.
@@ -255,7 +255,7 @@ intv ijkVecBitXor2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitXnor2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitXnor2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecBitShiftLeft2*v
 //	Calculate component-wise bit shift left of 2D vectors.
@@ -263,7 +263,7 @@ intv ijkVecBitXnor2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitShiftLeft2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitShiftLeft2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecBitShiftRight2*v
 //	Calculate component-wise bit shift right of 2D vectors.
@@ -271,7 +271,7 @@ intv ijkVecBitShiftLeft2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitShiftRight2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitShiftRight2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecEqual2*v
 //	Equality comparison for 2D vectors.
@@ -279,7 +279,7 @@ intv ijkVecBitShiftRight2iv(int2 v_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
+ijk_inl boolv ijkVecEqual2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecInequal2*v
 //	Inequality comparison for 2D vectors.
@@ -287,7 +287,7 @@ boolv ijkVecEqual2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
+ijk_inl boolv ijkVecInequal2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecLessEqual2*v
 //	Less-than or equal comparison for 2D vectors.
@@ -295,7 +295,7 @@ boolv ijkVecInequal2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
+ijk_inl boolv ijkVecLessEqual2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecGreaterEqual2*v
 //	Greater-than or equal comparison for 2D vectors.
@@ -303,7 +303,7 @@ boolv ijkVecLessEqual2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecLess2*v
 //	Less-than comparison for 2D vectors.
@@ -311,7 +311,7 @@ boolv ijkVecGreaterEqual2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
+ijk_inl boolv ijkVecLess2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecGreater2*v
 //	Greater-than comparison for 2D vectors.
@@ -319,7 +319,7 @@ boolv ijkVecLess2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
+ijk_inl boolv ijkVecGreater2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecAnd2*v
 //	Component-wise logical 'and' of 2D vectors.
@@ -327,7 +327,7 @@ boolv ijkVecGreater2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
+ijk_inl boolv ijkVecAnd2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecNand2*v
 //	Component-wise logical 'nand' of 2D vectors.
@@ -335,7 +335,7 @@ boolv ijkVecAnd2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
+ijk_inl boolv ijkVecNand2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecOr2*v
 //	Component-wise logical 'or' of 2D vectors.
@@ -343,7 +343,7 @@ boolv ijkVecNand2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
+ijk_inl boolv ijkVecOr2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecNor2*v
 //	Component-wise logical 'nor' of 2D vectors.
@@ -351,35 +351,35 @@ boolv ijkVecOr2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
+ijk_inl boolv ijkVecNor2iv(bool2 bv_out, int2 const v_lh, int2 const v_rh);
 
 // ijkVecCopy2*vs
 //	Copy 2D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-intv ijkVecCopy2ivs(int2 v_out, i32 const s_in);
+ijk_inl intv ijkVecCopy2ivs(int2 v_out, i32 const s_in);
 
 // ijkVecNegate2*vs
 //	Negate scalar to 2D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-intv ijkVecNegate2ivs(int2 v_out, i32 const s_in);
+ijk_inl intv ijkVecNegate2ivs(int2 v_out, i32 const s_in);
 
 // ijkVecBitNot2*vs
 //	Calculate bitwise 'not' of 2D vector.
 //		param v_out: output vector to hold bitwise 'not'
 //		param s_in: input scalar
 //		return: v_out
-intv ijkVecBitNot2ivs(int2 v_out, i32 const s_in);
+ijk_inl intv ijkVecBitNot2ivs(int2 v_out, i32 const s_in);
 
 // ijkVecNot2*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot2ivs(bool2 bv_out, i32 const s_in);
+ijk_inl boolv ijkVecNot2ivs(bool2 bv_out, i32 const s_in);
 
 // ijkVecAdd2*vs
 //	Calculate sum of 2D vector components and scalar.
@@ -387,7 +387,7 @@ boolv ijkVecNot2ivs(bool2 bv_out, i32 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecAdd2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecAdd2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecSub2*vs
 //	Calculate difference of 2D vector components and scalar.
@@ -395,7 +395,7 @@ intv ijkVecAdd2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecSub2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecSub2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecMul2*vs
 //	Calculate product of 2D vector components by scalar.
@@ -403,7 +403,7 @@ intv ijkVecSub2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecMul2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecMul2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecDiv2*vs
 //	Calculate quotient of 2D vector components by scalar.
@@ -411,7 +411,7 @@ intv ijkVecMul2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecDiv2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecDiv2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecDivSafe2*vs
 //	Calculate quotient of 2D vector components by scalar, division-by-zero safe.
@@ -419,7 +419,7 @@ intv ijkVecDiv2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecDivSafe2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecDivSafe2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecMod2*vs
 //	Calculate remainder of 2D vector components by scalar.
@@ -427,7 +427,7 @@ intv ijkVecDivSafe2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecMod2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecMod2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecModSafe2*vs
 //	Calculate remainder of 2D vector components by scalar, division-by-zero safe.
@@ -435,7 +435,7 @@ intv ijkVecMod2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecModSafe2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecModSafe2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecBitAnd2*vs
 //	Calculate bitwise 'and' of 2D vector components and scalar.
@@ -443,7 +443,7 @@ intv ijkVecModSafe2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitAnd2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitAnd2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecBitNand2*vs
 //	Calculate bitwise 'not and' of 2D vector components and scalar.
@@ -451,7 +451,7 @@ intv ijkVecBitAnd2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitNand2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitNand2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecBitOr2*vs
 //	Calculate bitwise 'or' of 2D vector components and scalar.
@@ -459,7 +459,7 @@ intv ijkVecBitNand2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitOr2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitOr2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecBitNor2*vs
 //	Calculate bitwise 'not or' of 2D vector components and scalar.
@@ -467,7 +467,7 @@ intv ijkVecBitOr2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitNor2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitNor2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecBitXor2*vs
 //	Calculate bitwise 'exclusive or' of 2D vector components and scalar.
@@ -475,7 +475,7 @@ intv ijkVecBitNor2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitXor2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitXor2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecBitXnor2*vs
 //	Calculate bitwise 'not exclusive or' of 2D vector components and scalar.
@@ -483,7 +483,7 @@ intv ijkVecBitXor2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitXnor2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitXnor2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecBitShiftLeft2*vs
 //	Calculate bit shift left of 2D vector components and scalar.
@@ -491,7 +491,7 @@ intv ijkVecBitXnor2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitShiftLeft2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitShiftLeft2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecBitShiftRight2*vs
 //	Calculate bit shift right of 2D vector components and scalar.
@@ -499,7 +499,7 @@ intv ijkVecBitShiftLeft2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitShiftRight2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitShiftRight2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecEqual2*vs
 //	Equality comparison of 2D vector components and scalar.
@@ -507,7 +507,7 @@ intv ijkVecBitShiftRight2ivs(int2 v_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecEqual2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecInequal2*vs
 //	Inequality comparison of 2D vector components and scalar.
@@ -515,7 +515,7 @@ boolv ijkVecEqual2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecInequal2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecLessEqual2*vs
 //	Less-than or equal comparison of 2D vector components and scalar.
@@ -523,7 +523,7 @@ boolv ijkVecInequal2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecLessEqual2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecGreaterEqual2*vs
 //	Greater-than or equal comparison of 2D vector components and scalar.
@@ -531,7 +531,7 @@ boolv ijkVecLessEqual2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecLess2*vs
 //	Less-than comparison of 2D vector components and scalar.
@@ -539,7 +539,7 @@ boolv ijkVecGreaterEqual2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecLess2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecGreater2*vs
 //	Greater-than comparison of 2D vector components and scalar.
@@ -547,7 +547,7 @@ boolv ijkVecLess2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecGreater2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecAnd2*vs
 //	Component-wise logical 'and' of 2D vector and scalar.
@@ -555,7 +555,7 @@ boolv ijkVecGreater2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecAnd2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecNand2*vs
 //	Component-wise logical 'nand' of 2D vector and scalar.
@@ -563,7 +563,7 @@ boolv ijkVecAnd2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecNand2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecOr2*vs
 //	Component-wise logical 'or' of 2D vector and scalar.
@@ -571,7 +571,7 @@ boolv ijkVecNand2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecOr2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecNor2*vs
 //	Component-wise logical 'nor' of 2D vector and scalar.
@@ -579,7 +579,7 @@ boolv ijkVecOr2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecNor2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 
 // ijkVecAdd2*sv
 //	Calculate sum of scalar and 2D vector components.
@@ -587,7 +587,7 @@ boolv ijkVecNor2ivs(bool2 bv_out, int2 const v_lh, i32 const s_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecAdd2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecAdd2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecSub2*sv
 //	Calculate difference of scalar and 2D vector components.
@@ -595,7 +595,7 @@ intv ijkVecAdd2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecSub2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecSub2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecMul2*sv
 //	Calculate product of scalar by 2D vector components.
@@ -603,7 +603,7 @@ intv ijkVecSub2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecMul2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecMul2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecDiv2*sv
 //	Calculate quotient of scalar by 2D vector components.
@@ -611,7 +611,7 @@ intv ijkVecMul2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecDiv2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecDiv2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecDivSafe2*sv
 //	Calculate quotient of scalar by 2D vector components, division-by-zero safe.
@@ -619,7 +619,7 @@ intv ijkVecDiv2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecDivSafe2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecDivSafe2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecMod2*sv
 //	Calculate remainder of scalar by 2D vector components.
@@ -627,7 +627,7 @@ intv ijkVecDivSafe2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecMod2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecMod2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecModSafe2*sv
 //	Calculate remainder of scalar by 2D vector components, division-by-zero safe.
@@ -635,7 +635,7 @@ intv ijkVecMod2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecModSafe2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecModSafe2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecBitAnd2*sv
 //	Calculate bitwise 'and' of scalar and 2D vector components.
@@ -643,7 +643,7 @@ intv ijkVecModSafe2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitAnd2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitAnd2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecBitNand2*sv
 //	Calculate bitwise 'not and' of scalar and 2D vector components.
@@ -651,7 +651,7 @@ intv ijkVecBitAnd2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitNand2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitNand2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecBitOr2*sv
 //	Calculate bitwise 'or' of scalar and 2D vector components.
@@ -659,7 +659,7 @@ intv ijkVecBitNand2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitOr2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitOr2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecBitNor2*sv
 //	Calculate bitwise 'not or' of scalar and 2D vector components.
@@ -667,7 +667,7 @@ intv ijkVecBitOr2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitNor2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitNor2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecBitXor2*sv
 //	Calculate bitwise 'exclusive or' of scalar and 2D vector components.
@@ -675,7 +675,7 @@ intv ijkVecBitNor2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitXor2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitXor2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecBitXnor2*sv
 //	Calculate bitwise 'not exclusive or' of scalar and 2D vector components.
@@ -683,7 +683,7 @@ intv ijkVecBitXor2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitXnor2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitXnor2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecBitShiftLeft2*sv
 //	Calculate bit shift left of scalar by 2D vector components.
@@ -691,7 +691,7 @@ intv ijkVecBitXnor2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitShiftLeft2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitShiftLeft2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecBitShiftRight2*sv
 //	Calculate bit shift right of scalar by 2D vector components.
@@ -699,7 +699,7 @@ intv ijkVecBitShiftLeft2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitShiftRight2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
+ijk_inl intv ijkVecBitShiftRight2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecEqual2*sv
 //	Equality comparison of scalar and 2D vector components.
@@ -707,7 +707,7 @@ intv ijkVecBitShiftRight2isv(int2 v_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
+ijk_inl boolv ijkVecEqual2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecInequal2*sv
 //	Inequality comparison of scalar and 2D vector components.
@@ -715,7 +715,7 @@ boolv ijkVecEqual2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
+ijk_inl boolv ijkVecInequal2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecLessEqual2*sv
 //	Less-than or equal comparison of scalar and 2D vector components.
@@ -723,7 +723,7 @@ boolv ijkVecInequal2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
+ijk_inl boolv ijkVecLessEqual2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecGreaterEqual2*sv
 //	Greater-than or equal comparison of scalar and 2D vector components.
@@ -731,7 +731,7 @@ boolv ijkVecLessEqual2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecLess2*sv
 //	Less-than comparison of scalar and 2D vector components.
@@ -739,7 +739,7 @@ boolv ijkVecGreaterEqual2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
+ijk_inl boolv ijkVecLess2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecGreater2*sv
 //	Greater-than comparison of scalar and 2D vector components.
@@ -747,7 +747,7 @@ boolv ijkVecLess2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
+ijk_inl boolv ijkVecGreater2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecAnd2*sv
 //	Component-wise logical 'and' of 2D vector and scalar.
@@ -755,7 +755,7 @@ boolv ijkVecGreater2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
+ijk_inl boolv ijkVecAnd2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecNand2*sv
 //	Component-wise logical 'nand' of 2D vector and scalar.
@@ -763,7 +763,7 @@ boolv ijkVecAnd2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
+ijk_inl boolv ijkVecNand2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecOr2*sv
 //	Component-wise logical 'or' of 2D vector and scalar.
@@ -771,7 +771,7 @@ boolv ijkVecNand2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
+ijk_inl boolv ijkVecOr2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecNor2*sv
 //	Component-wise logical 'nor' of 2D vector and scalar.
@@ -779,21 +779,21 @@ boolv ijkVecOr2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
+ijk_inl boolv ijkVecNor2isv(bool2 bv_out, i32 const s_lh, int2 const v_rh);
 
 // ijkVecDot2*v
 //	Dot product of 2D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-i32 ijkVecDot2iv(int2 const v_lh, int2 const v_rh);
+ijk_inl i32 ijkVecDot2iv(int2 const v_lh, int2 const v_rh);
 
 // ijkVecCross2*v
 //	Cross product scalar of 2D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar quantity of imaginary perpendicular axis
-i32 ijkVecCross2iv(int2 const v_lh, int2 const v_rh);
+ijk_inl i32 ijkVecCross2iv(int2 const v_lh, int2 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -802,7 +802,7 @@ i32 ijkVecCross2iv(int2 const v_lh, int2 const v_rh);
 //	Initialize 3D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-intv ijkVecInit3iv(int3 v_out);
+ijk_inl intv ijkVecInit3iv(int3 v_out);
 
 // ijkVecInitElems3*v
 //	Initialize 3D vector to specified individual elements.
@@ -811,35 +811,35 @@ intv ijkVecInit3iv(int3 v_out);
 //		param y: second element
 //		param z: third element
 //		return: v_out
-intv ijkVecInitElems3iv(int3 v_out, i32 const x, i32 const y, i32 const z);
+ijk_inl intv ijkVecInitElems3iv(int3 v_out, i32 const x, i32 const y, i32 const z);
 
 // ijkVecCopy3*v
 //	Copy 3D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-intv ijkVecCopy3iv(int3 v_out, int3 const v_in);
+ijk_inl intv ijkVecCopy3iv(int3 v_out, int3 const v_in);
 
 // ijkVecNegate3*v
 //	Negate 3D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-intv ijkVecNegate3iv(int3 v_out, int3 const v_in);
+ijk_inl intv ijkVecNegate3iv(int3 v_out, int3 const v_in);
 
 // ijkVecBitNot3*v
 //	Calculate component-wise bitwise 'not' of 3D vector.
 //		param v_out: output vector to hold component-wise bitwise 'not'
 //		param v_in: input vector
 //		return: v_out
-intv ijkVecBitNot3iv(int3 v_out, int3 const v_in);
+ijk_inl intv ijkVecBitNot3iv(int3 v_out, int3 const v_in);
 
 // ijkVecNot3*v
 //	Calculate component-wise logical 'not' of 3D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot3iv(bool3 bv_out, int3 const v_in);
+ijk_inl boolv ijkVecNot3iv(bool3 bv_out, int3 const v_in);
 
 // ijkVecAdd3*v
 //	Calculate sum of 3D vectors.
@@ -847,7 +847,7 @@ boolv ijkVecNot3iv(bool3 bv_out, int3 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecAdd3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecAdd3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecSub3*v
 //	Calculate difference of 3D vectors.
@@ -855,7 +855,7 @@ intv ijkVecAdd3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecSub3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecSub3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecMul3*v
 //	Calculate component-wise product of 3D vectors.
@@ -863,7 +863,7 @@ intv ijkVecSub3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecMul3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecMul3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecDiv3*v
 //	Calculate component-wise quotient of 3D vectors.
@@ -871,7 +871,7 @@ intv ijkVecMul3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecDiv3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecDiv3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecDivSafe3*v
 //	Calculate component-wise quotient of 3D vectors, division-by-zero safe.
@@ -879,7 +879,7 @@ intv ijkVecDiv3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecDivSafe3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecDivSafe3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecMod3*v
 //	Calculate component-wise remainder of 3D vectors.
@@ -887,7 +887,7 @@ intv ijkVecDivSafe3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecMod3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecMod3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecModSafe3*v
 //	Calculate component-wise remainder of 3D vectors, division-by-zero safe.
@@ -895,7 +895,7 @@ intv ijkVecMod3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecModSafe3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecModSafe3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecBitAnd3*v
 //	Calculate component-wise bitwise 'and' of 3D vectors.
@@ -903,7 +903,7 @@ intv ijkVecModSafe3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitAnd3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitAnd3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecBitNand3*v
 //	Calculate component-wise bitwise 'not and' of 3D vectors.
@@ -911,7 +911,7 @@ intv ijkVecBitAnd3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitNand3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitNand3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecBitOr3*v
 //	Calculate component-wise bitwise 'or' of 3D vectors.
@@ -919,7 +919,7 @@ intv ijkVecBitNand3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitOr3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitOr3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecBitNor3*v
 //	Calculate component-wise bitwise 'not or' of 3D vectors.
@@ -927,7 +927,7 @@ intv ijkVecBitOr3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitNor3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitNor3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecBitXor3*v
 //	Calculate component-wise bitwise 'exclusive or' of 3D vectors.
@@ -935,7 +935,7 @@ intv ijkVecBitNor3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitXor3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitXor3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecBitXnor3*v
 //	Calculate component-wise bitwise 'not exclusive or' of 3D vectors.
@@ -943,7 +943,7 @@ intv ijkVecBitXor3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitXnor3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitXnor3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecBitShiftLeft3*v
 //	Calculate component-wise bit shift left of 3D vectors.
@@ -951,7 +951,7 @@ intv ijkVecBitXnor3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitShiftLeft3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitShiftLeft3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecBitShiftRight3*v
 //	Calculate component-wise bit shift right of 3D vectors.
@@ -959,7 +959,7 @@ intv ijkVecBitShiftLeft3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitShiftRight3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitShiftRight3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecEqual3*v
 //	Equality comparison for 3D vectors.
@@ -967,7 +967,7 @@ intv ijkVecBitShiftRight3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
+ijk_inl boolv ijkVecEqual3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecInequal3*v
 //	Inequality comparison for 3D vectors.
@@ -975,7 +975,7 @@ boolv ijkVecEqual3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
+ijk_inl boolv ijkVecInequal3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecLessEqual3*v
 //	Less-than or equal comparison for 3D vectors.
@@ -983,7 +983,7 @@ boolv ijkVecInequal3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
+ijk_inl boolv ijkVecLessEqual3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecGreaterEqual3*v
 //	Greater-than or equal comparison for 3D vectors.
@@ -991,7 +991,7 @@ boolv ijkVecLessEqual3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecLess3*v
 //	Less-than comparison for 3D vectors.
@@ -999,7 +999,7 @@ boolv ijkVecGreaterEqual3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
+ijk_inl boolv ijkVecLess3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecGreater3*v
 //	Greater-than comparison for 3D vectors.
@@ -1007,7 +1007,7 @@ boolv ijkVecLess3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
+ijk_inl boolv ijkVecGreater3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecAnd3*v
 //	Component-wise logical 'and' of 3D vectors.
@@ -1015,7 +1015,7 @@ boolv ijkVecGreater3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
+ijk_inl boolv ijkVecAnd3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecNand3*v
 //	Component-wise logical 'nand' of 3D vectors.
@@ -1023,7 +1023,7 @@ boolv ijkVecAnd3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
+ijk_inl boolv ijkVecNand3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecOr3*v
 //	Component-wise logical 'or' of 3D vectors.
@@ -1031,7 +1031,7 @@ boolv ijkVecNand3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
+ijk_inl boolv ijkVecOr3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecNor3*v
 //	Component-wise logical 'nor' of 3D vectors.
@@ -1039,7 +1039,7 @@ boolv ijkVecOr3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
+ijk_inl boolv ijkVecNor3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 
 // ijkVecCopy3*vz
 //	Copy 3D vector from 2D vector and one scalar.
@@ -1047,35 +1047,35 @@ boolv ijkVecNor3iv(bool3 bv_out, int3 const v_lh, int3 const v_rh);
 //		param v_xy: input 2D vector holding first two components
 //		param z: third element
 //		return: v_out
-intv ijkVecCopy3ivz(int3 v_out, int2 const v_xy, i32 const z);
+ijk_inl intv ijkVecCopy3ivz(int3 v_out, int2 const v_xy, i32 const z);
 
 // ijkVecCopy3*vs
 //	Copy 3D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-intv ijkVecCopy3ivs(int3 v_out, i32 const s_in);
+ijk_inl intv ijkVecCopy3ivs(int3 v_out, i32 const s_in);
 
 // ijkVecNegate3*vs
 //	Negate scalar to 3D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-intv ijkVecNegate3ivs(int3 v_out, i32 const s_in);
+ijk_inl intv ijkVecNegate3ivs(int3 v_out, i32 const s_in);
 
 // ijkVecBitNot3*vs
 //	Calculate bitwise 'not' of 3D vector.
 //		param v_out: output vector to hold bitwise 'not'
 //		param s_in: input scalar
 //		return: v_out
-intv ijkVecBitNot3ivs(int3 v_out, i32 const s_in);
+ijk_inl intv ijkVecBitNot3ivs(int3 v_out, i32 const s_in);
 
 // ijkVecNot3*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot3ivs(bool3 bv_out, i32 const s_in);
+ijk_inl boolv ijkVecNot3ivs(bool3 bv_out, i32 const s_in);
 
 // ijkVecAdd3*vs
 //	Calculate sum of 3D vector components and scalar.
@@ -1083,7 +1083,7 @@ boolv ijkVecNot3ivs(bool3 bv_out, i32 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecAdd3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecAdd3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecSub3*vs
 //	Calculate difference of 3D vector components and scalar.
@@ -1091,7 +1091,7 @@ intv ijkVecAdd3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecSub3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecSub3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecMul3*vs
 //	Calculate product of 3D vector components by scalar.
@@ -1099,7 +1099,7 @@ intv ijkVecSub3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecMul3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecMul3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecDiv3*vs
 //	Calculate quotient of 3D vector components by scalar.
@@ -1107,7 +1107,7 @@ intv ijkVecMul3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecDiv3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecDiv3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecDivSafe3*vs
 //	Calculate quotient of 3D vector components by scalar, division-by-zero safe.
@@ -1115,7 +1115,7 @@ intv ijkVecDiv3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecDivSafe3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecDivSafe3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecMod3*vs
 //	Calculate remainder of 3D vector components by scalar.
@@ -1123,7 +1123,7 @@ intv ijkVecDivSafe3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecMod3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecMod3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecModSafe3*vs
 //	Calculate remainder of 3D vector components by scalar, division-by-zero safe.
@@ -1131,7 +1131,7 @@ intv ijkVecMod3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecModSafe3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecModSafe3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecBitAnd3*vs
 //	Calculate bitwise 'and' of 3D vector components and scalar.
@@ -1139,7 +1139,7 @@ intv ijkVecModSafe3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitAnd3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitAnd3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecBitNand3*vs
 //	Calculate bitwise 'not and' of 3D vector components and scalar.
@@ -1147,7 +1147,7 @@ intv ijkVecBitAnd3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitNand3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitNand3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecBitOr3*vs
 //	Calculate bitwise 'or' of 3D vector components and scalar.
@@ -1155,7 +1155,7 @@ intv ijkVecBitNand3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitOr3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitOr3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecBitNor3*vs
 //	Calculate bitwise 'not or' of 3D vector components and scalar.
@@ -1163,7 +1163,7 @@ intv ijkVecBitOr3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitNor3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitNor3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecBitXor3*vs
 //	Calculate bitwise 'exclusive or' of 3D vector components and scalar.
@@ -1171,7 +1171,7 @@ intv ijkVecBitNor3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitXor3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitXor3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecBitXnor3*vs
 //	Calculate bitwise 'not exclusive or' of 3D vector components and scalar.
@@ -1179,7 +1179,7 @@ intv ijkVecBitXor3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitXnor3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitXnor3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecBitShiftLeft3*vs
 //	Calculate bit shift left of 3D vector components and scalar.
@@ -1187,7 +1187,7 @@ intv ijkVecBitXnor3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitShiftLeft3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitShiftLeft3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecBitShiftRight3*vs
 //	Calculate bit shift right of 3D vector components and scalar.
@@ -1195,7 +1195,7 @@ intv ijkVecBitShiftLeft3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitShiftRight3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitShiftRight3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecEqual3*vs
 //	Equality comparison of 3D vector components and scalar.
@@ -1203,7 +1203,7 @@ intv ijkVecBitShiftRight3ivs(int3 v_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecEqual3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecInequal3*vs
 //	Inequality comparison of 3D vector components and scalar.
@@ -1211,7 +1211,7 @@ boolv ijkVecEqual3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecInequal3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecLessEqual3*vs
 //	Less-than or equal comparison of 3D vector components and scalar.
@@ -1219,7 +1219,7 @@ boolv ijkVecInequal3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecLessEqual3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecGreaterEqual3*vs
 //	Greater-than or equal comparison of 3D vector components and scalar.
@@ -1227,7 +1227,7 @@ boolv ijkVecLessEqual3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecLess3*vs
 //	Less-than comparison of 3D vector components and scalar.
@@ -1235,7 +1235,7 @@ boolv ijkVecGreaterEqual3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecLess3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecGreater3*vs
 //	Greater-than comparison of 3D vector components and scalar.
@@ -1243,7 +1243,7 @@ boolv ijkVecLess3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecGreater3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecAnd3*vs
 //	Component-wise logical 'and' of 3D vector and scalar.
@@ -1251,7 +1251,7 @@ boolv ijkVecGreater3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecAnd3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecNand3*vs
 //	Component-wise logical 'nand' of 3D vector and scalar.
@@ -1259,7 +1259,7 @@ boolv ijkVecAnd3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecNand3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecOr3*vs
 //	Component-wise logical 'or' of 3D vector and scalar.
@@ -1267,7 +1267,7 @@ boolv ijkVecNand3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecOr3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecNor3*vs
 //	Component-wise logical 'nor' of 3D vector and scalar.
@@ -1275,7 +1275,7 @@ boolv ijkVecOr3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecNor3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 
 // ijkVecCopy3*xv
 //	Copy 3D vector from 2D vector and one scalar.
@@ -1283,7 +1283,7 @@ boolv ijkVecNor3ivs(bool3 bv_out, int3 const v_lh, i32 const s_rh);
 //		param x: first element
 //		param v_yz: input 2D vector holding last two components
 //		return: v_out
-intv ijkVecCopy3ixv(int3 v_out, i32 const x, int2 const v_yz);
+ijk_inl intv ijkVecCopy3ixv(int3 v_out, i32 const x, int2 const v_yz);
 
 // ijkVecAdd3*sv
 //	Calculate sum of scalar and 3D vector components.
@@ -1291,7 +1291,7 @@ intv ijkVecCopy3ixv(int3 v_out, i32 const x, int2 const v_yz);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecAdd3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecAdd3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecSub3*sv
 //	Calculate difference of scalar and 3D vector components.
@@ -1299,7 +1299,7 @@ intv ijkVecAdd3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecSub3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecSub3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecMul3*sv
 //	Calculate product of scalar by 3D vector components.
@@ -1307,7 +1307,7 @@ intv ijkVecSub3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecMul3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecMul3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecDiv3*sv
 //	Calculate quotient of scalar by 3D vector components.
@@ -1315,7 +1315,7 @@ intv ijkVecMul3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecDiv3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecDiv3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecDivSafe3*sv
 //	Calculate quotient of scalar by 3D vector components, division-by-zero safe.
@@ -1323,7 +1323,7 @@ intv ijkVecDiv3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecDivSafe3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecDivSafe3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecMod3*sv
 //	Calculate remainder of scalar by 3D vector components.
@@ -1331,7 +1331,7 @@ intv ijkVecDivSafe3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecMod3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecMod3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecModSafe3*sv
 //	Calculate remainder of scalar by 3D vector components, division-by-zero safe.
@@ -1339,7 +1339,7 @@ intv ijkVecMod3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecModSafe3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecModSafe3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecBitAnd3*sv
 //	Calculate bitwise 'and' of scalar and 3D vector components.
@@ -1347,7 +1347,7 @@ intv ijkVecModSafe3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitAnd3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitAnd3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecBitNand3*sv
 //	Calculate bitwise 'not and' of scalar and 3D vector components.
@@ -1355,7 +1355,7 @@ intv ijkVecBitAnd3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitNand3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitNand3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecBitOr3*sv
 //	Calculate bitwise 'or' of scalar and 3D vector components.
@@ -1363,7 +1363,7 @@ intv ijkVecBitNand3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitOr3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitOr3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecBitNor3*sv
 //	Calculate bitwise 'not or' of scalar and 3D vector components.
@@ -1371,7 +1371,7 @@ intv ijkVecBitOr3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitNor3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitNor3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecBitXor3*sv
 //	Calculate bitwise 'exclusive or' of scalar and 3D vector components.
@@ -1379,7 +1379,7 @@ intv ijkVecBitNor3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitXor3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitXor3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecBitXnor3*sv
 //	Calculate bitwise 'not exclusive or' of scalar and 3D vector components.
@@ -1387,7 +1387,7 @@ intv ijkVecBitXor3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitXnor3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitXnor3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecBitShiftLeft3*sv
 //	Calculate bit shift left of scalar by 3D vector components.
@@ -1395,7 +1395,7 @@ intv ijkVecBitXnor3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitShiftLeft3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitShiftLeft3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecBitShiftRight3*sv
 //	Calculate bit shift right of scalar by 3D vector components.
@@ -1403,7 +1403,7 @@ intv ijkVecBitShiftLeft3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitShiftRight3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
+ijk_inl intv ijkVecBitShiftRight3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecEqual3*sv
 //	Equality comparison of scalar and 3D vector components.
@@ -1411,7 +1411,7 @@ intv ijkVecBitShiftRight3isv(int3 v_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
+ijk_inl boolv ijkVecEqual3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecInequal3*sv
 //	Inequality comparison of scalar and 3D vector components.
@@ -1419,7 +1419,7 @@ boolv ijkVecEqual3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
+ijk_inl boolv ijkVecInequal3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecLessEqual3*sv
 //	Less-than or equal comparison of scalar and 3D vector components.
@@ -1427,7 +1427,7 @@ boolv ijkVecInequal3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
+ijk_inl boolv ijkVecLessEqual3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecGreaterEqual3*sv
 //	Greater-than or equal comparison of scalar and 3D vector components.
@@ -1435,7 +1435,7 @@ boolv ijkVecLessEqual3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecLess3*sv
 //	Less-than comparison of scalar and 3D vector components.
@@ -1443,7 +1443,7 @@ boolv ijkVecGreaterEqual3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
+ijk_inl boolv ijkVecLess3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecGreater3*sv
 //	Greater-than comparison of scalar and 3D vector components.
@@ -1451,7 +1451,7 @@ boolv ijkVecLess3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
+ijk_inl boolv ijkVecGreater3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecAnd3*sv
 //	Component-wise logical 'and' of 3D vector and scalar.
@@ -1459,7 +1459,7 @@ boolv ijkVecGreater3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
+ijk_inl boolv ijkVecAnd3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecNand3*sv
 //	Component-wise logical 'nand' of 3D vector and scalar.
@@ -1467,7 +1467,7 @@ boolv ijkVecAnd3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
+ijk_inl boolv ijkVecNand3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecOr3*sv
 //	Component-wise logical 'or' of 3D vector and scalar.
@@ -1475,7 +1475,7 @@ boolv ijkVecNand3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
+ijk_inl boolv ijkVecOr3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecNor3*sv
 //	Component-wise logical 'nor' of 3D vector and scalar.
@@ -1483,14 +1483,14 @@ boolv ijkVecOr3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
+ijk_inl boolv ijkVecNor3isv(bool3 bv_out, i32 const s_lh, int3 const v_rh);
 
 // ijkVecDot3*v
 //	Dot product of 3D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-i32 ijkVecDot3iv(int3 const v_lh, int3 const v_rh);
+ijk_inl i32 ijkVecDot3iv(int3 const v_lh, int3 const v_rh);
 
 // ijkVecCross3*v
 //	Cross product of 3D array-based vectors.
@@ -1498,7 +1498,7 @@ i32 ijkVecDot3iv(int3 const v_lh, int3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecCross3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
+ijk_inl intv ijkVecCross3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -1507,7 +1507,7 @@ intv ijkVecCross3iv(int3 v_out, int3 const v_lh, int3 const v_rh);
 //	Initialize 4D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-intv ijkVecInit4iv(int4 v_out);
+ijk_inl intv ijkVecInit4iv(int4 v_out);
 
 // ijkVecInitElems4*v
 //	Initialize 4D vector to specified individual elements.
@@ -1517,7 +1517,7 @@ intv ijkVecInit4iv(int4 v_out);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for point, 0 for vector)
 //		return: v_out
-intv ijkVecInitElems4iv(int4 v_out, i32 const x, i32 const y, i32 const z, i32 const w);
+ijk_inl intv ijkVecInitElems4iv(int4 v_out, i32 const x, i32 const y, i32 const z, i32 const w);
 
 // ijkVecCopy4*xvw
 //	Copy 4D vector from scalar, 2D vector and another scalar.
@@ -1526,7 +1526,7 @@ intv ijkVecInitElems4iv(int4 v_out, i32 const x, i32 const y, i32 const z, i32 c
 //		param v_yz: input 2D vector holding middle two components
 //		param w: fourth element (in space, set as 1 for point, 0 for vector)
 //		return: v_out
-intv ijkVecCopy4ixvw(int4 v_out, i32 const x, int2 const v_yz, i32 const w);
+ijk_inl intv ijkVecCopy4ixvw(int4 v_out, i32 const x, int2 const v_yz, i32 const w);
 
 // ijkVecCopy4*v2
 //	Copy 4D vector from two 2D vectors.
@@ -1534,35 +1534,35 @@ intv ijkVecCopy4ixvw(int4 v_out, i32 const x, int2 const v_yz, i32 const w);
 //		param v_xy: input 2D vector holding first two components
 //		param v_zw: input 2D vector holding last two components
 //		return: v_out
-intv ijkVecCopy4iv2(int4 v_out, int2 const v_xy, int2 const v_zw);
+ijk_inl intv ijkVecCopy4iv2(int4 v_out, int2 const v_xy, int2 const v_zw);
 
 // ijkVecCopy4*v
 //	Copy 4D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-intv ijkVecCopy4iv(int4 v_out, int4 const v_in);
+ijk_inl intv ijkVecCopy4iv(int4 v_out, int4 const v_in);
 
 // ijkVecNegate4*v
 //	Negate 4D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-intv ijkVecNegate4iv(int4 v_out, int4 const v_in);
+ijk_inl intv ijkVecNegate4iv(int4 v_out, int4 const v_in);
 
 // ijkVecBitNot4*v
 //	Calculate component-wise bitwise 'not' of 4D vector.
 //		param v_out: output vector to hold component-wise bitwise 'not'
 //		param v_in: input vector
 //		return: v_out
-intv ijkVecBitNot4iv(int4 v_out, int4 const v_in);
+ijk_inl intv ijkVecBitNot4iv(int4 v_out, int4 const v_in);
 
 // ijkVecNot4*v
 //	Calculate component-wise logical 'not' of 4D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot4iv(bool4 bv_out, int4 const v_in);
+ijk_inl boolv ijkVecNot4iv(bool4 bv_out, int4 const v_in);
 
 // ijkVecAdd4*v
 //	Calculate sum of 4D vectors.
@@ -1570,7 +1570,7 @@ boolv ijkVecNot4iv(bool4 bv_out, int4 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecAdd4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecAdd4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecSub4*v
 //	Calculate difference of 4D vectors.
@@ -1578,7 +1578,7 @@ intv ijkVecAdd4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecSub4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecSub4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecMul4*v
 //	Calculate component-wise product of 4D vectors.
@@ -1586,7 +1586,7 @@ intv ijkVecSub4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecMul4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecMul4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecDiv4*v
 //	Calculate component-wise quotient of 4D vectors.
@@ -1594,7 +1594,7 @@ intv ijkVecMul4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecDiv4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecDiv4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecDivSafe4*v
 //	Calculate component-wise quotient of 4D vectors, division-by-zero safe.
@@ -1602,7 +1602,7 @@ intv ijkVecDiv4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecDivSafe4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecDivSafe4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecMod4*v
 //	Calculate component-wise remainder of 4D vectors.
@@ -1610,7 +1610,7 @@ intv ijkVecDivSafe4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecMod4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecMod4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecModSafe4*v
 //	Calculate component-wise remainder of 4D vectors, division-by-zero safe.
@@ -1618,7 +1618,7 @@ intv ijkVecMod4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecModSafe4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecModSafe4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecBitAnd4*v
 //	Calculate component-wise bitwise 'and' of 4D vectors.
@@ -1626,7 +1626,7 @@ intv ijkVecModSafe4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitAnd4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitAnd4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecBitNand4*v
 //	Calculate component-wise bitwise 'not and' of 4D vectors.
@@ -1634,7 +1634,7 @@ intv ijkVecBitAnd4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitNand4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitNand4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecBitOr4*v
 //	Calculate component-wise bitwise 'or' of 4D vectors.
@@ -1642,7 +1642,7 @@ intv ijkVecBitNand4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitOr4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitOr4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecBitNor4*v
 //	Calculate component-wise bitwise 'not or' of 4D vectors.
@@ -1650,7 +1650,7 @@ intv ijkVecBitOr4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitNor4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitNor4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecBitXor4*v
 //	Calculate component-wise bitwise 'exclusive or' of 4D vectors.
@@ -1658,7 +1658,7 @@ intv ijkVecBitNor4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitXor4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitXor4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecBitXnor4*v
 //	Calculate component-wise bitwise 'not exclusive or' of 4D vectors.
@@ -1666,7 +1666,7 @@ intv ijkVecBitXor4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitXnor4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitXnor4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecBitShiftLeft4*v
 //	Calculate component-wise bit shift left of 4D vectors.
@@ -1674,7 +1674,7 @@ intv ijkVecBitXnor4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitShiftLeft4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitShiftLeft4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecBitShiftRight4*v
 //	Calculate component-wise bit shift right of 4D vectors.
@@ -1682,7 +1682,7 @@ intv ijkVecBitShiftLeft4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitShiftRight4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitShiftRight4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecEqual4*v
 //	Equality comparison for 4D vectors.
@@ -1690,7 +1690,7 @@ intv ijkVecBitShiftRight4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
+ijk_inl boolv ijkVecEqual4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecInequal4*v
 //	Inequality comparison for 4D vectors.
@@ -1698,7 +1698,7 @@ boolv ijkVecEqual4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
+ijk_inl boolv ijkVecInequal4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecLessEqual4*v
 //	Less-than or equal comparison for 4D vectors.
@@ -1706,7 +1706,7 @@ boolv ijkVecInequal4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
+ijk_inl boolv ijkVecLessEqual4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecGreaterEqual4*v
 //	Greater-than or equal comparison for 4D vectors.
@@ -1714,7 +1714,7 @@ boolv ijkVecLessEqual4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecLess4*v
 //	Less-than comparison for 4D vectors.
@@ -1722,7 +1722,7 @@ boolv ijkVecGreaterEqual4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
+ijk_inl boolv ijkVecLess4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecGreater4*v
 //	Greater-than comparison for 4D vectors.
@@ -1730,7 +1730,7 @@ boolv ijkVecLess4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
+ijk_inl boolv ijkVecGreater4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecAnd4*v
 //	Component-wise logical 'and' of 4D vectors.
@@ -1738,7 +1738,7 @@ boolv ijkVecGreater4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
+ijk_inl boolv ijkVecAnd4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecNand4*v
 //	Component-wise logical 'nand' of 4D vectors.
@@ -1746,7 +1746,7 @@ boolv ijkVecAnd4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
+ijk_inl boolv ijkVecNand4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecOr4*v
 //	Component-wise logical 'or' of 4D vectors.
@@ -1754,7 +1754,7 @@ boolv ijkVecNand4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
+ijk_inl boolv ijkVecOr4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecNor4*v
 //	Component-wise logical 'nor' of 4D vectors.
@@ -1762,7 +1762,7 @@ boolv ijkVecOr4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
+ijk_inl boolv ijkVecNor4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 
 // ijkVecCopy4*vzw
 //	Copy 4D vector from 2D vector and two scalars.
@@ -1771,7 +1771,7 @@ boolv ijkVecNor4iv(bool4 bv_out, int4 const v_lh, int4 const v_rh);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for point, 0 for vector)
 //		return: v_out
-intv ijkVecCopy4ivzw(int4 v_out, int2 const v_xy, i32 const z, i32 const w);
+ijk_inl intv ijkVecCopy4ivzw(int4 v_out, int2 const v_xy, i32 const z, i32 const w);
 
 // ijkVecCopy4*vw
 //	Copy 4D vector from 3D vector and one scalar.
@@ -1779,35 +1779,35 @@ intv ijkVecCopy4ivzw(int4 v_out, int2 const v_xy, i32 const z, i32 const w);
 //		param v_xyz: input 3D vector holding first three components
 //		param w: fourth element (in space, set as 1 for point, 0 for vector)
 //		return: v_out
-intv ijkVecCopy4ivw(int4 v_out, int3 const v_xyz, i32 const w);
+ijk_inl intv ijkVecCopy4ivw(int4 v_out, int3 const v_xyz, i32 const w);
 
 // ijkVecCopy4*vs
 //	Copy 4D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-intv ijkVecCopy4ivs(int4 v_out, i32 const s_in);
+ijk_inl intv ijkVecCopy4ivs(int4 v_out, i32 const s_in);
 
 // ijkVecNegate4*vs
 //	Negate scalar to 4D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-intv ijkVecNegate4ivs(int4 v_out, i32 const s_in);
+ijk_inl intv ijkVecNegate4ivs(int4 v_out, i32 const s_in);
 
 // ijkVecBitNot4*vs
 //	Calculate bitwise 'not' of 4D vector.
 //		param v_out: output vector to hold bitwise 'not'
 //		param s_in: input scalar
 //		return: v_out
-intv ijkVecBitNot4ivs(int4 v_out, i32 const s_in);
+ijk_inl intv ijkVecBitNot4ivs(int4 v_out, i32 const s_in);
 
 // ijkVecNot4*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot4ivs(bool4 bv_out, i32 const s_in);
+ijk_inl boolv ijkVecNot4ivs(bool4 bv_out, i32 const s_in);
 
 // ijkVecAdd4*vs
 //	Calculate sum of 4D vector components and scalar.
@@ -1815,7 +1815,7 @@ boolv ijkVecNot4ivs(bool4 bv_out, i32 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecAdd4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecAdd4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecSub4*vs
 //	Calculate difference of 4D vector components and scalar.
@@ -1823,7 +1823,7 @@ intv ijkVecAdd4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecSub4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecSub4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecMul4*vs
 //	Calculate product of 4D vector components by scalar.
@@ -1831,7 +1831,7 @@ intv ijkVecSub4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecMul4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecMul4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecDiv4*vs
 //	Calculate quotient of 4D vector components by scalar.
@@ -1839,7 +1839,7 @@ intv ijkVecMul4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecDiv4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecDiv4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecDivSafe4*vs
 //	Calculate quotient of 4D vector components by scalar, division-by-zero safe.
@@ -1847,7 +1847,7 @@ intv ijkVecDiv4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecDivSafe4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecDivSafe4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecMod4*vs
 //	Calculate remainder of 4D vector components by scalar.
@@ -1855,7 +1855,7 @@ intv ijkVecDivSafe4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecMod4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecMod4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecModSafe4*vs
 //	Calculate remainder of 4D vector components by scalar, division-by-zero safe.
@@ -1863,7 +1863,7 @@ intv ijkVecMod4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecModSafe4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecModSafe4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecBitAnd4*vs
 //	Calculate bitwise 'and' of 4D vector components and scalar.
@@ -1871,7 +1871,7 @@ intv ijkVecModSafe4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitAnd4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitAnd4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecBitNand4*vs
 //	Calculate bitwise 'not and' of 4D vector components and scalar.
@@ -1879,7 +1879,7 @@ intv ijkVecBitAnd4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitNand4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitNand4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecBitOr4*vs
 //	Calculate bitwise 'or' of 4D vector components and scalar.
@@ -1887,7 +1887,7 @@ intv ijkVecBitNand4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitOr4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitOr4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecBitNor4*vs
 //	Calculate bitwise 'not or' of 4D vector components and scalar.
@@ -1895,7 +1895,7 @@ intv ijkVecBitOr4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitNor4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitNor4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecBitXor4*vs
 //	Calculate bitwise 'exclusive or' of 4D vector components and scalar.
@@ -1903,7 +1903,7 @@ intv ijkVecBitNor4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitXor4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitXor4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecBitXnor4*vs
 //	Calculate bitwise 'not exclusive or' of 4D vector components and scalar.
@@ -1911,7 +1911,7 @@ intv ijkVecBitXor4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitXnor4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitXnor4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecBitShiftLeft4*vs
 //	Calculate bit shift left of 4D vector components and scalar.
@@ -1919,7 +1919,7 @@ intv ijkVecBitXnor4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitShiftLeft4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitShiftLeft4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecBitShiftRight4*vs
 //	Calculate bit shift right of 4D vector components and scalar.
@@ -1927,7 +1927,7 @@ intv ijkVecBitShiftLeft4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-intv ijkVecBitShiftRight4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
+ijk_inl intv ijkVecBitShiftRight4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecEqual4*vs
 //	Equality comparison of 4D vector components and scalar.
@@ -1935,7 +1935,7 @@ intv ijkVecBitShiftRight4ivs(int4 v_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecEqual4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecInequal4*vs
 //	Inequality comparison of 4D vector components and scalar.
@@ -1943,7 +1943,7 @@ boolv ijkVecEqual4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecInequal4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecLessEqual4*vs
 //	Less-than or equal comparison of 4D vector components and scalar.
@@ -1951,7 +1951,7 @@ boolv ijkVecInequal4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecLessEqual4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecGreaterEqual4*vs
 //	Greater-than or equal comparison of 4D vector components and scalar.
@@ -1959,7 +1959,7 @@ boolv ijkVecLessEqual4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecLess4*vs
 //	Less-than comparison of 4D vector components and scalar.
@@ -1967,7 +1967,7 @@ boolv ijkVecGreaterEqual4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecLess4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecGreater4*vs
 //	Greater-than comparison of 4D vector components and scalar.
@@ -1975,7 +1975,7 @@ boolv ijkVecLess4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecGreater4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecAnd4*vs
 //	Component-wise logical 'and' of 4D vector and scalar.
@@ -1983,7 +1983,7 @@ boolv ijkVecGreater4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecAnd4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecNand4*vs
 //	Component-wise logical 'nand' of 4D vector and scalar.
@@ -1991,7 +1991,7 @@ boolv ijkVecAnd4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecNand4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecOr4*vs
 //	Component-wise logical 'or' of 4D vector and scalar.
@@ -1999,7 +1999,7 @@ boolv ijkVecNand4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecOr4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecNor4*vs
 //	Component-wise logical 'nor' of 4D vector and scalar.
@@ -2007,7 +2007,7 @@ boolv ijkVecOr4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
+ijk_inl boolv ijkVecNor4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 
 // ijkVecCopy4*xyv
 //	Copy 4D vector from two scalars and 2D vector.
@@ -2016,7 +2016,7 @@ boolv ijkVecNor4ivs(bool4 bv_out, int4 const v_lh, i32 const s_rh);
 //		param y: second element
 //		param v_zw: input 2D vector holding last two components
 //		return: v_out
-intv ijkVecCopy4ixyv(int4 v_out, i32 const x, i32 const y, int2 const v_zw);
+ijk_inl intv ijkVecCopy4ixyv(int4 v_out, i32 const x, i32 const y, int2 const v_zw);
 
 // ijkVecCopy4*xv
 //	Copy 4D vector from one scalar and 3D vector.
@@ -2024,7 +2024,7 @@ intv ijkVecCopy4ixyv(int4 v_out, i32 const x, i32 const y, int2 const v_zw);
 //		param x: first element
 //		param v_yzw: input 3D vector holding last three components
 //		return: v_out
-intv ijkVecCopy4ixv(int4 v_out, i32 const x, int3 const v_yzw);
+ijk_inl intv ijkVecCopy4ixv(int4 v_out, i32 const x, int3 const v_yzw);
 
 // ijkVecAdd4*sv
 //	Calculate sum of scalar and 4D vector components.
@@ -2032,7 +2032,7 @@ intv ijkVecCopy4ixv(int4 v_out, i32 const x, int3 const v_yzw);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecAdd4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecAdd4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecSub4*sv
 //	Calculate difference of scalar and 4D vector components.
@@ -2040,7 +2040,7 @@ intv ijkVecAdd4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecSub4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecSub4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecMul4*sv
 //	Calculate product of scalar by 4D vector components.
@@ -2048,7 +2048,7 @@ intv ijkVecSub4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecMul4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecMul4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecDiv4*sv
 //	Calculate quotient of scalar by 4D vector components.
@@ -2056,7 +2056,7 @@ intv ijkVecMul4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecDiv4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecDiv4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecDivSafe4*sv
 //	Calculate quotient of scalar by 4D vector components, division-by-zero safe.
@@ -2064,7 +2064,7 @@ intv ijkVecDiv4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecDivSafe4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecDivSafe4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecMod4*sv
 //	Calculate remainder of scalar by 4D vector components.
@@ -2072,7 +2072,7 @@ intv ijkVecDivSafe4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecMod4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecMod4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecModSafe4*sv
 //	Calculate remainder of scalar by 4D vector components, division-by-zero safe.
@@ -2080,7 +2080,7 @@ intv ijkVecMod4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecModSafe4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecModSafe4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecBitAnd4*sv
 //	Calculate bitwise 'and' of scalar and 4D vector components.
@@ -2088,7 +2088,7 @@ intv ijkVecModSafe4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitAnd4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitAnd4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecBitNand4*sv
 //	Calculate bitwise 'not and' of scalar and 4D vector components.
@@ -2096,7 +2096,7 @@ intv ijkVecBitAnd4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitNand4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitNand4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecBitOr4*sv
 //	Calculate bitwise 'or' of scalar and 4D vector components.
@@ -2104,7 +2104,7 @@ intv ijkVecBitNand4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitOr4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitOr4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecBitNor4*sv
 //	Calculate bitwise 'not or' of scalar and 4D vector components.
@@ -2112,7 +2112,7 @@ intv ijkVecBitOr4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitNor4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitNor4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecBitXor4*sv
 //	Calculate bitwise 'exclusive or' of scalar and 4D vector components.
@@ -2120,7 +2120,7 @@ intv ijkVecBitNor4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitXor4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitXor4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecBitXnor4*sv
 //	Calculate bitwise 'not exclusive or' of scalar and 4D vector components.
@@ -2128,7 +2128,7 @@ intv ijkVecBitXor4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitXnor4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitXnor4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecBitShiftLeft4*sv
 //	Calculate bit shift left of scalar by 4D vector components.
@@ -2136,7 +2136,7 @@ intv ijkVecBitXnor4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitShiftLeft4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitShiftLeft4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecBitShiftRight4*sv
 //	Calculate bit shift right of scalar by 4D vector components.
@@ -2144,7 +2144,7 @@ intv ijkVecBitShiftLeft4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-intv ijkVecBitShiftRight4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
+ijk_inl intv ijkVecBitShiftRight4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecEqual4*sv
 //	Equality comparison of scalar and 4D vector components.
@@ -2152,7 +2152,7 @@ intv ijkVecBitShiftRight4isv(int4 v_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
+ijk_inl boolv ijkVecEqual4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecInequal4*sv
 //	Inequality comparison of scalar and 4D vector components.
@@ -2160,7 +2160,7 @@ boolv ijkVecEqual4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
+ijk_inl boolv ijkVecInequal4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecLessEqual4*sv
 //	Less-than or equal comparison of scalar and 4D vector components.
@@ -2168,7 +2168,7 @@ boolv ijkVecInequal4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
+ijk_inl boolv ijkVecLessEqual4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecGreaterEqual4*sv
 //	Greater-than or equal comparison of scalar and 4D vector components.
@@ -2176,7 +2176,7 @@ boolv ijkVecLessEqual4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecLess4*sv
 //	Less-than comparison of scalar and 4D vector components.
@@ -2184,7 +2184,7 @@ boolv ijkVecGreaterEqual4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
+ijk_inl boolv ijkVecLess4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecGreater4*sv
 //	Greater-than comparison of scalar and 4D vector components.
@@ -2192,7 +2192,7 @@ boolv ijkVecLess4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
+ijk_inl boolv ijkVecGreater4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecAnd4*sv
 //	Component-wise logical 'and' of 4D vector and scalar.
@@ -2200,7 +2200,7 @@ boolv ijkVecGreater4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
+ijk_inl boolv ijkVecAnd4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecNand4*sv
 //	Component-wise logical 'nand' of 4D vector and scalar.
@@ -2208,7 +2208,7 @@ boolv ijkVecAnd4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
+ijk_inl boolv ijkVecNand4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecOr4*sv
 //	Component-wise logical 'or' of 4D vector and scalar.
@@ -2216,7 +2216,7 @@ boolv ijkVecNand4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
+ijk_inl boolv ijkVecOr4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecNor4*sv
 //	Component-wise logical 'nor' of 4D vector and scalar.
@@ -2224,14 +2224,14 @@ boolv ijkVecOr4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
+ijk_inl boolv ijkVecNor4isv(bool4 bv_out, i32 const s_lh, int4 const v_rh);
 
 // ijkVecDot4*v
 //	Dot product of 4D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-i32 ijkVecDot4iv(int4 const v_lh, int4 const v_rh);
+ijk_inl i32 ijkVecDot4iv(int4 const v_lh, int4 const v_rh);
 
 // ijkVecCross4*v
 //	Cross product of 4D array-based vectors.
@@ -2239,7 +2239,7 @@ i32 ijkVecDot4iv(int4 const v_lh, int4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out (fourth element is zero)
-intv ijkVecCross4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
+ijk_inl intv ijkVecCross4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -2256,50 +2256,50 @@ intv ijkVecCross4iv(int4 v_out, int4 const v_lh, int4 const v_rh);
 //	Absolute value of scalar: (s >= 0 ? +s : -s).
 //		param s: scalar
 //		return: absolute value
-int ijkVecAbs1i(int const s);
+ijk_inl int ijkVecAbs1i(int const s);
 
 // ijkVecSgn1*
 //	Sign of scalar: (s != 0 ? s > 0 ? +1 : -1).
 //		param s: scalar
 //		return: sign
-int ijkVecSgn1i(int const s);
+ijk_inl int ijkVecSgn1i(int const s);
 
 // ijkVecDot1*
 //	Dot product of scalars, which is just their product.
 //		param s_lh: left-hand scalar
 //		param s_rh: right-hand scalar
 //		return: product
-int ijkVecDot1i(int const s_lh, int const s_rh);
+ijk_inl int ijkVecDot1i(int const s_lh, int const s_rh);
 
 // ijkVecLengthSq1*
 //	Squared length of scalar.
 //		param s: scalar
 //		return: squared length
-int ijkVecLengthSq1i(int const s);
+ijk_inl int ijkVecLengthSq1i(int const s);
 
 // ijkVecLength1*
 //	Length of scalar.
 //		param s: scalar
 //		return: length
-int ijkVecLength1i(int const s);
+ijk_inl int ijkVecLength1i(int const s);
 
 // ijkVecLengthSqInv1*
 //	Inverse squared length of scalar.
 //		param s: scalar
 //		return: inverse squared length
-float ijkVecLengthSqInv1i(int const s);
+ijk_inl float ijkVecLengthSqInv1i(int const s);
 
 // ijkVecLengthSqInv1*
 //	Inverse length of scalar.
 //		param s: scalar
 //		return: inverse length
-float ijkVecLengthInv1i(int const s);
+ijk_inl float ijkVecLengthInv1i(int const s);
 
 // ijkVecNormalize1*
 //	Calculate unit scalar in same direction as input (sign).
 //		param s: scalar
 //		return: unit scalar (sign)
-int ijkVecNormalize1i(int const s);
+ijk_inl int ijkVecNormalize1i(int const s);
 
 // ijkVecNormalizeGetLength1*
 //	Calculate unit scalar in same direction as input (sign).
@@ -2307,7 +2307,7 @@ int ijkVecNormalize1i(int const s);
 //		param s: scalar
 //		param length_out: pointer to length storage
 //		return: unit scalar (sign)
-int ijkVecNormalizeGetLength1i(int const s, int* const length_out);
+ijk_inl int ijkVecNormalizeGetLength1i(int const s, int* const length_out);
 
 // ijkVecNormalizeGetLengthInv1*
 //	Calculate unit scalar in same direction as input (sign).
@@ -2315,7 +2315,7 @@ int ijkVecNormalizeGetLength1i(int const s, int* const length_out);
 //		param s: scalar
 //		param lengthInv_out: pointer to length storage
 //		return: unit scalar (sign)
-int ijkVecNormalizeGetLengthInv1i(int const s, float* const lengthInv_out);
+ijk_inl int ijkVecNormalizeGetLengthInv1i(int const s, float* const lengthInv_out);
 
 
 //-----------------------------------------------------------------------------
@@ -2323,601 +2323,601 @@ int ijkVecNormalizeGetLengthInv1i(int const s, float* const lengthInv_out);
 // ijkVecInit2*
 //	Initialize 2D vector to default value (zero vector).
 //		return: default vector
-ivec2 ijkVecInit2i();
+ijk_inl ivec2 ijkVecInit2i();
 
 // ijkVecInitElems2*
 //	Initialize 2D vector to specified individual elements.
 //		param x: first element
 //		param y: second element
 //		return: result vector
-ivec2 ijkVecInitElems2i(int const x, int const y);
+ijk_inl ivec2 ijkVecInitElems2i(int const x, int const y);
 
 // ijkVecCopy2*
 //	Copy 2D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-ivec2 ijkVecCopy2i(ivec2 const v_in);
+ijk_inl ivec2 ijkVecCopy2i(ivec2 const v_in);
 
 // ijkVecNegate2*
 //	Negate 2D vector.
 //		param v_in: input vector
 //		return: result vector
-ivec2 ijkVecNegate2i(ivec2 const v_in);
+ijk_inl ivec2 ijkVecNegate2i(ivec2 const v_in);
 
 // ijkVecBitNot2*
 //	Calculate component-wise bitwise 'not' of 2D vector.
 //		param v_in: input vector
 //		return: result vector
-ivec2 ijkVecBitNot2i(ivec2 const v_in);
+ijk_inl ivec2 ijkVecBitNot2i(ivec2 const v_in);
 
 // ijkVecNot2*
 //	Calculate component-wise logical 'not' of 2D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec2 ijkVecNot2i(ivec2 const v_in);
+ijk_inl bvec2 ijkVecNot2i(ivec2 const v_in);
 
 // ijkVecAdd2*
 //	Calculate sum of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecAdd2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecAdd2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecSub2*
 //	Calculate difference of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecSub2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecSub2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecMul2*
 //	Calculate component-wise product of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecMul2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecMul2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecDiv2*
 //	Calculate component-wise quotient of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecDiv2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecDiv2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecDivSafe2*
 //	Calculate component-wise quotient of 2D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecDivSafe2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecDivSafe2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecMod2*
 //	Calculate component-wise remainder of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecMod2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecMod2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecModSafe2*
 //	Calculate component-wise remainder of 2D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecModSafe2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecModSafe2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecBitAnd2*
 //	Calculate component-wise bitwise 'and' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitAnd2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitAnd2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecBitNand2*
 //	Calculate component-wise bitwise 'not and' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitNand2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitNand2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecBitOr2*
 //	Calculate component-wise bitwise 'or' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitOr2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitOr2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecBitNor2*
 //	Calculate component-wise bitwise 'not or' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitNor2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitNor2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecBitXor2*
 //	Calculate component-wise bitwise 'exclusive or' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitXor2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitXor2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecBitXnor2*
 //	Calculate component-wise bitwise 'not exclusive or' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitXnor2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitXnor2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecBitShiftLeft2*
 //	Calculate component-wise bit shift left of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitShiftLeft2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitShiftLeft2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecBitShiftRight2*
 //	Calculate component-wise bit shift right of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitShiftRight2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitShiftRight2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecEqual2*
 //	Equality comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecEqual2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecEqual2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecInequal2*
 //	Inequality comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecInequal2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecInequal2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecLessEqual2*
 //	Less-than or equal comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLessEqual2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecLessEqual2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecGreaterEqual2*
 //	Greater-than or equal comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecLess2*
 //	Less-than comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLess2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecLess2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecGreater2*
 //	Greater-than comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreater2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecGreater2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecAnd2*
 //	Component-wise logical 'and' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecAnd2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecAnd2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecNand2*
 //	Component-wise logical 'nand' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNand2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecNand2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecOr2*
 //	Component-wise logical 'or' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecOr2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecOr2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecNor2*
 //	Component-wise logical 'nor' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNor2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecNor2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecCopy2*s
 //	Copy 2D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-ivec2 ijkVecCopy2is(int const s_in);
+ijk_inl ivec2 ijkVecCopy2is(int const s_in);
 
 // ijkVecNegate2*s
 //	Negate scalar to 2D vector.
 //		param s_in: input scalar
 //		return: result vector
-ivec2 ijkVecNegate2is(int const s_in);
+ijk_inl ivec2 ijkVecNegate2is(int const s_in);
 
 // ijkVecBitNot2*s
 //	Calculate bitwise 'not' of 2D vector.
 //		param s_in: input scalar
 //		return: result vector
-ivec2 ijkVecBitNot2is(int const s_in);
+ijk_inl ivec2 ijkVecBitNot2is(int const s_in);
 
 // ijkVecNot2*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec2 ijkVecNot2is(int const s_in);
+ijk_inl bvec2 ijkVecNot2is(int const s_in);
 
 // ijkVecAdd2*s
 //	Calculate sum of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecAdd2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecAdd2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecSub2*s
 //	Calculate difference of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecSub2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecSub2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecMul2*s
 //	Calculate product of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecMul2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecMul2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecDiv2*s
 //	Calculate quotient of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecDiv2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecDiv2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecDivSafe2*s
 //	Calculate quotient of 2D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecDivSafe2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecDivSafe2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecMod2*s
 //	Calculate remainder of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecMod2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecMod2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecModSafe2*s
 //	Calculate remainder of 2D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecModSafe2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecModSafe2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecBitAnd2*s
 //	Calculate bitwise 'and' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecBitAnd2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecBitAnd2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecBitNand2*s
 //	Calculate bitwise 'not and' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecBitNand2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecBitNand2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecBitOr2*s
 //	Calculate bitwise 'or' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecBitOr2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecBitOr2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecBitNor2*s
 //	Calculate bitwise 'not or' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecBitNor2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecBitNor2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecBitXor2*s
 //	Calculate bitwise 'exclusive or' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecBitXor2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecBitXor2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecBitXnor2*s
 //	Calculate bitwise 'not exclusive or' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecBitXnor2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecBitXnor2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecBitShiftLeft2*s
 //	Calculate bit shift left of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecBitShiftLeft2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecBitShiftLeft2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecBitShiftRight2*s
 //	Calculate bit shift right of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec2 ijkVecBitShiftRight2is(ivec2 const v_lh, int const s_rh);
+ijk_inl ivec2 ijkVecBitShiftRight2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecEqual2*s
 //	Equality comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecEqual2is(ivec2 const v_lh, int const s_rh);
+ijk_inl bvec2 ijkVecEqual2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecInequal2*s
 //	Inequality comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecInequal2is(ivec2 const v_lh, int const s_rh);
+ijk_inl bvec2 ijkVecInequal2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecLessEqual2*s
 //	Less-than or equal comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecLessEqual2is(ivec2 const v_lh, int const s_rh);
+ijk_inl bvec2 ijkVecLessEqual2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecGreaterEqual2*s
 //	Greater-than or equal comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2is(ivec2 const v_lh, int const s_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecLess2*s
 //	Less-than comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecLess2is(ivec2 const v_lh, int const s_rh);
+ijk_inl bvec2 ijkVecLess2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecGreater2*s
 //	Greater-than comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecGreater2is(ivec2 const v_lh, int const s_rh);
+ijk_inl bvec2 ijkVecGreater2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecAnd2*s
 //	Component-wise logical 'and' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecAnd2is(ivec2 const v_lh, int const s_rh);
+ijk_inl bvec2 ijkVecAnd2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecNand2*s
 //	Component-wise logical 'nand' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecNand2is(ivec2 const v_lh, int const s_rh);
+ijk_inl bvec2 ijkVecNand2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecOr2*s
 //	Component-wise logical 'or' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecOr2is(ivec2 const v_lh, int const s_rh);
+ijk_inl bvec2 ijkVecOr2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecNor2*s
 //	Component-wise logical 'nor' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecNor2is(ivec2 const v_lh, int const s_rh);
+ijk_inl bvec2 ijkVecNor2is(ivec2 const v_lh, int const s_rh);
 
 // ijkVecAdd2s*
 //	Calculate sum of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecAdd2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecAdd2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecSub2s*
 //	Calculate difference of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecSub2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecSub2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecMul2s*
 //	Calculate product of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecMul2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecMul2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecDiv2s*
 //	Calculate quotient of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecDiv2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecDiv2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecDivSafe2s*
 //	Calculate quotient of scalar by 2D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecDivSafe2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecDivSafe2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecMod2s*
 //	Calculate remainder of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecMod2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecMod2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecModSafe2s*
 //	Calculate remainder of scalar by 2D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecModSafe2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecModSafe2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecBitAnd2s*
 //	Calculate bitwise 'and' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitAnd2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitAnd2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecBitNand2s*
 //	Calculate bitwise 'not and' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitNand2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitNand2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecBitOr2s*
 //	Calculate bitwise 'or' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitOr2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitOr2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecBitNor2s*
 //	Calculate bitwise 'not or' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitNor2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitNor2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecBitXor2s*
 //	Calculate bitwise 'exclusive or' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitXor2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitXor2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecBitXnor2s*
 //	Calculate bitwise 'not exclusive or' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitXnor2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitXnor2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecBitShiftLeft2s*
 //	Calculate bit shift left of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitShiftLeft2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitShiftLeft2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecBitShiftRight2s*
 //	Calculate bit shift right of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec2 ijkVecBitShiftRight2si(int const s_lh, ivec2 const v_rh);
+ijk_inl ivec2 ijkVecBitShiftRight2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecEqual2s*
 //	Equality comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecEqual2si(int const s_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecEqual2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecInequal2s*
 //	Inequality comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecInequal2si(int const s_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecInequal2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecLessEqual2s*
 //	Less-than or equal comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLessEqual2si(int const s_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecLessEqual2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecGreaterEqual2s*
 //	Greater-than or equal comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2si(int const s_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecLess2s*
 //	Less-than comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLess2si(int const s_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecLess2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecGreater2s*
 //	Greater-than comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreater2si(int const s_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecGreater2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecAnd2s*
 //	Component-wise logical 'and' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecAnd2si(int const s_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecAnd2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecNand2s*
 //	Component-wise logical 'nand' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNand2si(int const s_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecNand2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecOr2s*
 //	Component-wise logical 'or' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecOr2si(int const s_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecOr2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecNor2s*
 //	Component-wise logical 'nor' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNor2si(int const s_lh, ivec2 const v_rh);
+ijk_inl bvec2 ijkVecNor2si(int const s_lh, ivec2 const v_rh);
 
 // ijkVecDot2*
 //	Dot product of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-int ijkVecDot2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl int ijkVecDot2i(ivec2 const v_lh, ivec2 const v_rh);
 
 // ijkVecCross2*
 //	Cross product scalar of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar quantity of imaginary perpendicular axis
-int ijkVecCross2i(ivec2 const v_lh, ivec2 const v_rh);
+ijk_inl int ijkVecCross2i(ivec2 const v_lh, ivec2 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -2925,7 +2925,7 @@ int ijkVecCross2i(ivec2 const v_lh, ivec2 const v_rh);
 // ijkVecInit3*
 //	Initialize 3D vector to default value (zero vector).
 //		return: default vector
-ivec3 ijkVecInit3i();
+ijk_inl ivec3 ijkVecInit3i();
 
 // ijkVecInitElems3*
 //	Initialize 3D vector to specified individual elements.
@@ -2933,608 +2933,608 @@ ivec3 ijkVecInit3i();
 //		param y: second element
 //		param z: third element
 //		return: result vector
-ivec3 ijkVecInitElems3i(int const x, int const y, int const z);
+ijk_inl ivec3 ijkVecInitElems3i(int const x, int const y, int const z);
 
 // ijkVecCopy3*
 //	Copy 3D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-ivec3 ijkVecCopy3i(ivec3 const v_in);
+ijk_inl ivec3 ijkVecCopy3i(ivec3 const v_in);
 
 // ijkVecNegate3*
 //	Negate 3D vector.
 //		param v_in: input vector
 //		return: result vector
-ivec3 ijkVecNegate3i(ivec3 const v_in);
+ijk_inl ivec3 ijkVecNegate3i(ivec3 const v_in);
 
 // ijkVecBitNot3*
 //	Calculate component-wise bitwise 'not' of 3D vector.
 //		param v_in: input vector
 //		return: result vector
-ivec3 ijkVecBitNot3i(ivec3 const v_in);
+ijk_inl ivec3 ijkVecBitNot3i(ivec3 const v_in);
 
 // ijkVecNot3*
 //	Calculate component-wise logical 'not' of 3D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec3 ijkVecNot3i(ivec3 const v_in);
+ijk_inl bvec3 ijkVecNot3i(ivec3 const v_in);
 
 // ijkVecAdd3*
 //	Calculate sum of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecAdd3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecAdd3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecSub3*
 //	Calculate difference of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecSub3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecSub3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecMul3*
 //	Calculate component-wise product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecMul3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecMul3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecDiv3*
 //	Calculate component-wise quotient of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecDiv3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecDiv3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecDivSafe3*
 //	Calculate component-wise quotient of 3D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecDivSafe3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecDivSafe3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecMod3*
 //	Calculate component-wise remainder of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecMod3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecMod3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecModSafe3*
 //	Calculate component-wise remainder of 3D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecModSafe3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecModSafe3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecBitAnd3*
 //	Calculate component-wise bitwise 'and' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitAnd3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitAnd3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecBitNand3*
 //	Calculate component-wise bitwise 'not and' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitNand3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitNand3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecBitOr3*
 //	Calculate component-wise bitwise 'or' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitOr3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitOr3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecBitNor3*
 //	Calculate component-wise bitwise 'not or' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitNor3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitNor3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecBitXor3*
 //	Calculate component-wise bitwise 'exclusive or' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitXor3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitXor3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecBitXnor3*
 //	Calculate component-wise bitwise 'not exclusive or' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitXnor3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitXnor3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecBitShiftLeft3*
 //	Calculate component-wise bit shift left of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitShiftLeft3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitShiftLeft3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecBitShiftRight3*
 //	Calculate component-wise bit shift right of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitShiftRight3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitShiftRight3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecEqual3*
 //	Equality comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecEqual3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecEqual3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecInequal3*
 //	Inequality comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecInequal3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecInequal3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecLessEqual3*
 //	Less-than or equal comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLessEqual3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecLessEqual3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecGreaterEqual3*
 //	Greater-than or equal comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecLess3*
 //	Less-than comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLess3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecLess3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecGreater3*
 //	Greater-than comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreater3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecGreater3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecAnd3*
 //	Component-wise logical 'and' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecAnd3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecAnd3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecNand3*
 //	Component-wise logical 'nand' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNand3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecNand3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecOr3*
 //	Component-wise logical 'or' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecOr3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecOr3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecNor3*
 //	Component-wise logical 'nor' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNor3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecNor3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecCopy3*z
 //	Copy 3D vector from 2D vector and one scalar.
 //		param v_xy: input 2D vector holding first two components
 //		param z: third element
 //		return: result vector
-ivec3 ijkVecCopy3iz(ivec2 const v_xy, int const z);
+ijk_inl ivec3 ijkVecCopy3iz(ivec2 const v_xy, int const z);
 
 // ijkVecCopy3*s
 //	Copy 3D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-ivec3 ijkVecCopy3is(int const s_in);
+ijk_inl ivec3 ijkVecCopy3is(int const s_in);
 
 // ijkVecNegate3*s
 //	Negate scalar to 3D vector.
 //		param s_in: input scalar
 //		return: result vector
-ivec3 ijkVecNegate3is(int const s_in);
+ijk_inl ivec3 ijkVecNegate3is(int const s_in);
 
 // ijkVecBitNot3*s
 //	Calculate bitwise 'not' of 3D vector.
 //		param s_in: input scalar
 //		return: result vector
-ivec3 ijkVecBitNot3is(int const s_in);
+ijk_inl ivec3 ijkVecBitNot3is(int const s_in);
 
 // ijkVecNot3*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec3 ijkVecNot3is(int const s_in);
+ijk_inl bvec3 ijkVecNot3is(int const s_in);
 
 // ijkVecAdd3*s
 //	Calculate sum of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecAdd3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecAdd3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecSub3*s
 //	Calculate difference of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecSub3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecSub3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecMul3*s
 //	Calculate product of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecMul3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecMul3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecDiv3*s
 //	Calculate quotient of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecDiv3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecDiv3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecDivSafe3*s
 //	Calculate quotient of 3D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecDivSafe3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecDivSafe3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecMod3*s
 //	Calculate remainder of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecMod3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecMod3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecModSafe3*s
 //	Calculate remainder of 3D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecModSafe3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecModSafe3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecBitAnd3*s
 //	Calculate bitwise 'and' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecBitAnd3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecBitAnd3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecBitNand3*s
 //	Calculate bitwise 'not and' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecBitNand3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecBitNand3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecBitOr3*s
 //	Calculate bitwise 'or' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecBitOr3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecBitOr3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecBitNor3*s
 //	Calculate bitwise 'not or' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecBitNor3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecBitNor3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecBitXor3*s
 //	Calculate bitwise 'exclusive or' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecBitXor3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecBitXor3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecBitXnor3*s
 //	Calculate bitwise 'not exclusive or' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecBitXnor3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecBitXnor3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecBitShiftLeft3*s
 //	Calculate bit shift left of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecBitShiftLeft3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecBitShiftLeft3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecBitShiftRight3*s
 //	Calculate bit shift right of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec3 ijkVecBitShiftRight3is(ivec3 const v_lh, int const s_rh);
+ijk_inl ivec3 ijkVecBitShiftRight3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecEqual3*s
 //	Equality comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecEqual3is(ivec3 const v_lh, int const s_rh);
+ijk_inl bvec3 ijkVecEqual3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecInequal3*s
 //	Inequality comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecInequal3is(ivec3 const v_lh, int const s_rh);
+ijk_inl bvec3 ijkVecInequal3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecLessEqual3*s
 //	Less-than or equal comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecLessEqual3is(ivec3 const v_lh, int const s_rh);
+ijk_inl bvec3 ijkVecLessEqual3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecGreaterEqual3*s
 //	Greater-than or equal comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3is(ivec3 const v_lh, int const s_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecLess3*s
 //	Less-than comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecLess3is(ivec3 const v_lh, int const s_rh);
+ijk_inl bvec3 ijkVecLess3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecGreater3*s
 //	Greater-than comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecGreater3is(ivec3 const v_lh, int const s_rh);
+ijk_inl bvec3 ijkVecGreater3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecAnd3*s
 //	Component-wise logical 'and' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecAnd3is(ivec3 const v_lh, int const s_rh);
+ijk_inl bvec3 ijkVecAnd3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecNand3*s
 //	Component-wise logical 'nand' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecNand3is(ivec3 const v_lh, int const s_rh);
+ijk_inl bvec3 ijkVecNand3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecOr3*s
 //	Component-wise logical 'or' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecOr3is(ivec3 const v_lh, int const s_rh);
+ijk_inl bvec3 ijkVecOr3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecNor3*s
 //	Component-wise logical 'nor' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecNor3is(ivec3 const v_lh, int const s_rh);
+ijk_inl bvec3 ijkVecNor3is(ivec3 const v_lh, int const s_rh);
 
 // ijkVecCopy3x*
 //	Copy 3D vector from 2D vector and one scalar.
 //		param x: first element
 //		param v_yz: input 2D vector holding last two components
 //		return: result vector
-ivec3 ijkVecCopy3xi(int const x, ivec2 const v_yz);
+ijk_inl ivec3 ijkVecCopy3xi(int const x, ivec2 const v_yz);
 
 // ijkVecAdd3s*
 //	Calculate sum of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecAdd3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecAdd3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecSub3s*
 //	Calculate difference of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecSub3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecSub3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecMul3s*
 //	Calculate product of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecMul3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecMul3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecDiv3s*
 //	Calculate quotient of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecDiv3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecDiv3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecDivSafe3s*
 //	Calculate quotient of scalar by 3D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecDivSafe3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecDivSafe3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecMod3s*
 //	Calculate remainder of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecMod3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecMod3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecModSafe3s*
 //	Calculate remainder of scalar by 3D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecModSafe3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecModSafe3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecBitAnd3s*
 //	Calculate bitwise 'and' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitAnd3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitAnd3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecBitNand3s*
 //	Calculate bitwise 'not and' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitNand3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitNand3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecBitOr3s*
 //	Calculate bitwise 'or' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitOr3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitOr3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecBitNor3s*
 //	Calculate bitwise 'not or' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitNor3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitNor3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecBitXor3s*
 //	Calculate bitwise 'exclusive or' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitXor3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitXor3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecBitXnor3s*
 //	Calculate bitwise 'not exclusive or' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitXnor3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitXnor3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecBitShiftLeft3s*
 //	Calculate bit shift left of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitShiftLeft3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitShiftLeft3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecBitShiftRight3s*
 //	Calculate bit shift right of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec3 ijkVecBitShiftRight3si(int const s_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecBitShiftRight3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecEqual3s*
 //	Equality comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecEqual3si(int const s_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecEqual3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecInequal3s*
 //	Inequality comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecInequal3si(int const s_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecInequal3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecLessEqual3s*
 //	Less-than or equal comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLessEqual3si(int const s_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecLessEqual3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecGreaterEqual3s*
 //	Greater-than or equal comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3si(int const s_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecLess3s*
 //	Less-than comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLess3si(int const s_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecLess3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecGreater3s*
 //	Greater-than comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreater3si(int const s_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecGreater3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecAnd3s*
 //	Component-wise logical 'and' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecAnd3si(int const s_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecAnd3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecNand3s*
 //	Component-wise logical 'nand' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNand3si(int const s_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecNand3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecOr3s*
 //	Component-wise logical 'or' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecOr3si(int const s_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecOr3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecNor3s*
 //	Component-wise logical 'nor' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNor3si(int const s_lh, ivec3 const v_rh);
+ijk_inl bvec3 ijkVecNor3si(int const s_lh, ivec3 const v_rh);
 
 // ijkVecDot3*
 //	Dot product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-int ijkVecDot3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl int ijkVecDot3i(ivec3 const v_lh, ivec3 const v_rh);
 
 // ijkVecCross3*
 //	Cross product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: cross product
-ivec3 ijkVecCross3i(ivec3 const v_lh, ivec3 const v_rh);
+ijk_inl ivec3 ijkVecCross3i(ivec3 const v_lh, ivec3 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -3542,7 +3542,7 @@ ivec3 ijkVecCross3i(ivec3 const v_lh, ivec3 const v_rh);
 // ijkVecInit4*
 //	Initialize 4D vector to default value (zero vector).
 //		return: default vector
-ivec4 ijkVecInit4i();
+ijk_inl ivec4 ijkVecInit4i();
 
 // ijkVecInitElems4*
 //	Initialize 4D vector to specified individual elements.
@@ -3551,7 +3551,7 @@ ivec4 ijkVecInit4i();
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for point, 0 for vector)
 //		return: result vector
-ivec4 ijkVecInitElems4i(int const x, int const y, int const z, int const w);
+ijk_inl ivec4 ijkVecInitElems4i(int const x, int const y, int const z, int const w);
 
 // ijkVecCopy4x*w
 //	Copy 4D vector from scalar, 2D vector and another scalar.
@@ -3559,213 +3559,213 @@ ivec4 ijkVecInitElems4i(int const x, int const y, int const z, int const w);
 //		param v_yz: input 2D vector holding middle two components
 //		param w: fourth element (in space, set as 1 for point, 0 for vector)
 //		return: result vector
-ivec4 ijkVecCopy4xiw(int const x, ivec2 const v_yz, int const w);
+ijk_inl ivec4 ijkVecCopy4xiw(int const x, ivec2 const v_yz, int const w);
 
 // ijkVecCopy4*2
 //	Copy 4D vector from two 2D vectors.
 //		param v_xy: input 2D vector holding first two components
 //		param v_zw: input 2D vector holding last two components
 //		return: result vector
-ivec4 ijkVecCopy4i2(ivec2 const v_xy, ivec2 const v_zw);
+ijk_inl ivec4 ijkVecCopy4i2(ivec2 const v_xy, ivec2 const v_zw);
 
 // ijkVecCopy4*
 //	Copy 4D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-ivec4 ijkVecCopy4i(ivec4 const v_in);
+ijk_inl ivec4 ijkVecCopy4i(ivec4 const v_in);
 
 // ijkVecNegate4*
 //	Negate 4D vector.
 //		param v_in: input vector
 //		return: result vector
-ivec4 ijkVecNegate4i(ivec4 const v_in);
+ijk_inl ivec4 ijkVecNegate4i(ivec4 const v_in);
 
 // ijkVecBitNot4*
 //	Calculate component-wise bitwise 'not' of 4D vector.
 //		param v_in: input vector
 //		return: result vector
-ivec4 ijkVecBitNot4i(ivec4 const v_in);
+ijk_inl ivec4 ijkVecBitNot4i(ivec4 const v_in);
 
 // ijkVecNot4*
 //	Calculate component-wise logical 'not' of 4D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec4 ijkVecNot4i(ivec4 const v_in);
+ijk_inl bvec4 ijkVecNot4i(ivec4 const v_in);
 
 // ijkVecAdd4*
 //	Calculate sum of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecAdd4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecAdd4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecSub4*
 //	Calculate difference of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecSub4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecSub4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecMul4*
 //	Calculate component-wise product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecMul4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecMul4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecDiv4*
 //	Calculate component-wise quotient of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecDiv4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecDiv4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecDivSafe4*
 //	Calculate component-wise quotient of 4D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecDivSafe4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecDivSafe4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecMod4*
 //	Calculate component-wise remainder of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecMod4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecMod4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecModSafe4*
 //	Calculate component-wise remainder of 4D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecModSafe4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecModSafe4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecBitAnd4*
 //	Calculate component-wise bitwise 'and' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitAnd4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitAnd4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecBitNand4*
 //	Calculate component-wise bitwise 'not and' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitNand4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitNand4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecBitOr4*
 //	Calculate component-wise bitwise 'or' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitOr4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitOr4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecBitNor4*
 //	Calculate component-wise bitwise 'not or' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitNor4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitNor4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecBitXor4*
 //	Calculate component-wise bitwise 'exclusive or' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitXor4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitXor4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecBitXnor4*
 //	Calculate component-wise bitwise 'not exclusive or' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitXnor4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitXnor4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecBitShiftLeft4*
 //	Calculate component-wise bit shift left of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitShiftLeft4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitShiftLeft4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecBitShiftRight4*
 //	Calculate component-wise bit shift right of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitShiftRight4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitShiftRight4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecEqual4*
 //	Equality comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecEqual4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecEqual4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecInequal4*
 //	Inequality comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecInequal4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecInequal4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecLessEqual4*
 //	Less-than or equal comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLessEqual4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecLessEqual4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecGreaterEqual4*
 //	Greater-than or equal comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecLess4*
 //	Less-than comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLess4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecLess4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecGreater4*
 //	Greater-than comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreater4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecGreater4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecAnd4*
 //	Component-wise logical 'and' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecAnd4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecAnd4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecNand4*
 //	Component-wise logical 'nand' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNand4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecNand4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecOr4*
 //	Component-wise logical 'or' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecOr4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecOr4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecNor4*
 //	Component-wise logical 'nor' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNor4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecNor4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecCopy4*zw
 //	Copy 4D vector from 2D vector and two scalars.
@@ -3773,213 +3773,213 @@ bvec4 ijkVecNor4i(ivec4 const v_lh, ivec4 const v_rh);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for point, 0 for vector)
 //		return: result vector
-ivec4 ijkVecCopy4izw(ivec2 const v_xy, int const z, int const w);
+ijk_inl ivec4 ijkVecCopy4izw(ivec2 const v_xy, int const z, int const w);
 
 // ijkVecCopy4*w
 //	Copy 4D vector from 3D vector and one scalar.
 //		param v_xyz: input 3D vector holding first three components
 //		param w: fourth element (in space, set as 1 for point, 0 for vector)
 //		return: result vector
-ivec4 ijkVecCopy4iw(ivec3 const v_xyz, int const w);
+ijk_inl ivec4 ijkVecCopy4iw(ivec3 const v_xyz, int const w);
 
 // ijkVecCopy4*s
 //	Copy 4D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-ivec4 ijkVecCopy4is(int const s_in);
+ijk_inl ivec4 ijkVecCopy4is(int const s_in);
 
 // ijkVecNegate4*s
 //	Negate scalar to 4D vector.
 //		param s_in: input scalar
 //		return: result vector
-ivec4 ijkVecNegate4is(int const s_in);
+ijk_inl ivec4 ijkVecNegate4is(int const s_in);
 
 // ijkVecBitNot4*s
 //	Calculate bitwise 'not' of 4D vector.
 //		param s_in: input scalar
 //		return: result vector
-ivec4 ijkVecBitNot4is(int const s_in);
+ijk_inl ivec4 ijkVecBitNot4is(int const s_in);
 
 // ijkVecNot4*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec4 ijkVecNot4is(int const s_in);
+ijk_inl bvec4 ijkVecNot4is(int const s_in);
 
 // ijkVecAdd4*s
 //	Calculate sum of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecAdd4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecAdd4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecSub4*s
 //	Calculate difference of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecSub4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecSub4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecMul4*s
 //	Calculate product of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecMul4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecMul4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecDiv4*s
 //	Calculate quotient of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecDiv4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecDiv4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecDivSafe4*s
 //	Calculate quotient of 4D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecDivSafe4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecDivSafe4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecMod4*s
 //	Calculate remainder of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecMod4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecMod4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecModSafe4*s
 //	Calculate remainder of 4D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecModSafe4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecModSafe4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecBitAnd4*s
 //	Calculate bitwise 'and' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecBitAnd4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecBitAnd4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecBitNand4*s
 //	Calculate bitwise 'not and' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecBitNand4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecBitNand4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecBitOr4*s
 //	Calculate bitwise 'or' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecBitOr4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecBitOr4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecBitNor4*s
 //	Calculate bitwise 'not or' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecBitNor4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecBitNor4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecBitXor4*s
 //	Calculate bitwise 'exclusive or' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecBitXor4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecBitXor4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecBitXnor4*s
 //	Calculate bitwise 'not exclusive or' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecBitXnor4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecBitXnor4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecBitShiftLeft4*s
 //	Calculate bit shift left of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecBitShiftLeft4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecBitShiftLeft4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecBitShiftRight4*s
 //	Calculate bit shift right of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ivec4 ijkVecBitShiftRight4is(ivec4 const v_lh, int const s_rh);
+ijk_inl ivec4 ijkVecBitShiftRight4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecEqual4*s
 //	Equality comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecEqual4is(ivec4 const v_lh, int const s_rh);
+ijk_inl bvec4 ijkVecEqual4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecInequal4*s
 //	Inequality comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecInequal4is(ivec4 const v_lh, int const s_rh);
+ijk_inl bvec4 ijkVecInequal4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecLessEqual4*s
 //	Less-than or equal comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecLessEqual4is(ivec4 const v_lh, int const s_rh);
+ijk_inl bvec4 ijkVecLessEqual4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecGreaterEqual4*s
 //	Greater-than or equal comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4is(ivec4 const v_lh, int const s_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecLess4*s
 //	Less-than comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecLess4is(ivec4 const v_lh, int const s_rh);
+ijk_inl bvec4 ijkVecLess4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecGreater4*s
 //	Greater-than comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecGreater4is(ivec4 const v_lh, int const s_rh);
+ijk_inl bvec4 ijkVecGreater4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecAnd4*s
 //	Component-wise logical 'and' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecAnd4is(ivec4 const v_lh, int const s_rh);
+ijk_inl bvec4 ijkVecAnd4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecNand4*s
 //	Component-wise logical 'nand' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecNand4is(ivec4 const v_lh, int const s_rh);
+ijk_inl bvec4 ijkVecNand4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecOr4*s
 //	Component-wise logical 'or' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecOr4is(ivec4 const v_lh, int const s_rh);
+ijk_inl bvec4 ijkVecOr4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecNor4*s
 //	Component-wise logical 'nor' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecNor4is(ivec4 const v_lh, int const s_rh);
+ijk_inl bvec4 ijkVecNor4is(ivec4 const v_lh, int const s_rh);
 
 // ijkVecCopy4xy*
 //	Copy 4D vector from two scalars and 2D vector.
@@ -3987,203 +3987,203 @@ bvec4 ijkVecNor4is(ivec4 const v_lh, int const s_rh);
 //		param y: second element
 //		param v_zw: input 2D vector holding last two components
 //		return: result vector
-ivec4 ijkVecCopy4xyi(int const x, int const y, ivec2 const v_zw);
+ijk_inl ivec4 ijkVecCopy4xyi(int const x, int const y, ivec2 const v_zw);
 
 // ijkVecCopy4x*
 //	Copy 4D vector from one scalar and 3D vector.
 //		param x: first element
 //		param v_yzw: input 3D vector holding last three components
 //		return: result vector
-ivec4 ijkVecCopy4xi(int const x, ivec3 const v_yzw);
+ijk_inl ivec4 ijkVecCopy4xi(int const x, ivec3 const v_yzw);
 
 // ijkVecAdd4s*
 //	Calculate sum of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecAdd4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecAdd4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecSub4s*
 //	Calculate difference of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecSub4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecSub4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecMul4s*
 //	Calculate product of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecMul4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecMul4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecDiv4s*
 //	Calculate quotient of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecDiv4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecDiv4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecDivSafe4s*
 //	Calculate quotient of scalar by 4D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecDivSafe4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecDivSafe4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecMod4s*
 //	Calculate remainder of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecMod4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecMod4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecModSafe4s*
 //	Calculate remainder of scalar by 4D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecModSafe4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecModSafe4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecBitAnd4s*
 //	Calculate bitwise 'and' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitAnd4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitAnd4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecBitNand4s*
 //	Calculate bitwise 'not and' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitNand4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitNand4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecBitOr4s*
 //	Calculate bitwise 'or' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitOr4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitOr4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecBitNor4s*
 //	Calculate bitwise 'not or' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitNor4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitNor4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecBitXor4s*
 //	Calculate bitwise 'exclusive or' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitXor4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitXor4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecBitXnor4s*
 //	Calculate bitwise 'not exclusive or' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitXnor4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitXnor4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecBitShiftLeft4s*
 //	Calculate bit shift left of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitShiftLeft4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitShiftLeft4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecBitShiftRight4s*
 //	Calculate bit shift right of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ivec4 ijkVecBitShiftRight4si(int const s_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecBitShiftRight4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecEqual4s*
 //	Equality comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecEqual4si(int const s_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecEqual4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecInequal4s*
 //	Inequality comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecInequal4si(int const s_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecInequal4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecLessEqual4s*
 //	Less-than or equal comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLessEqual4si(int const s_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecLessEqual4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecGreaterEqual4s*
 //	Greater-than or equal comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4si(int const s_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecLess4s*
 //	Less-than comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLess4si(int const s_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecLess4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecGreater4s*
 //	Greater-than comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreater4si(int const s_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecGreater4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecAnd4s*
 //	Component-wise logical 'and' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecAnd4si(int const s_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecAnd4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecNand4s*
 //	Component-wise logical 'nand' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNand4si(int const s_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecNand4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecOr4s*
 //	Component-wise logical 'or' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecOr4si(int const s_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecOr4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecNor4s*
 //	Component-wise logical 'nor' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNor4si(int const s_lh, ivec4 const v_rh);
+ijk_inl bvec4 ijkVecNor4si(int const s_lh, ivec4 const v_rh);
 
 // ijkVecDot4*
 //	Dot product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-int ijkVecDot4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl int ijkVecDot4i(ivec4 const v_lh, ivec4 const v_rh);
 
 // ijkVecCross4*
 //	Cross product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: cross product (fourth component is zero)
-ivec4 ijkVecCross4i(ivec4 const v_lh, ivec4 const v_rh);
+ijk_inl ivec4 ijkVecCross4i(ivec4 const v_lh, ivec4 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -38,50 +38,50 @@ extern "C" {
 //	Absolute value of scalar: (s >= 0 ? +s : -s).
 //		param s: scalar
 //		return: absolute value
-ui32 ijkVecAbs1us(ui32 const s);
+ijk_inl ui32 ijkVecAbs1us(ui32 const s);
 
 // ijkVecSgn1*s
 //	Sign of scalar: (s != 0 ? s > 0 ? +1 : -1).
 //		param s: scalar
 //		return: sign
-ui32 ijkVecSgn1us(ui32 const s);
+ijk_inl ui32 ijkVecSgn1us(ui32 const s);
 
 // ijkVecDot1*s
 //	Dot product of scalars, which is just their product.
 //		param s_lh: left-hand scalar
 //		param s_rh: right-hand scalar
 //		return: product
-ui32 ijkVecDot1us(ui32 const s_lh, ui32 const s_rh);
+ijk_inl ui32 ijkVecDot1us(ui32 const s_lh, ui32 const s_rh);
 
 // ijkVecLengthSq1*s
 //	Squared length of scalar.
 //		param s: scalar
 //		return: squared length
-ui32 ijkVecLengthSq1us(ui32 const s);
+ijk_inl ui32 ijkVecLengthSq1us(ui32 const s);
 
 // ijkVecLength1*s
 //	Length of scalar.
 //		param s: scalar
 //		return: length
-ui32 ijkVecLength1us(ui32 const s);
+ijk_inl ui32 ijkVecLength1us(ui32 const s);
 
 // ijkVecLengthSqInv1*s
 //	Inverse squared length of scalar.
 //		param s: scalar
 //		return: inverse squared length
-f32 ijkVecLengthSqInv1us(ui32 const s);
+ijk_inl f32 ijkVecLengthSqInv1us(ui32 const s);
 
 // ijkVecLengthSqInv1*s
 //	Inverse length of scalar.
 //		param s: scalar
 //		return: inverse length
-f32 ijkVecLengthInv1us(ui32 const s);
+ijk_inl f32 ijkVecLengthInv1us(ui32 const s);
 
 // ijkVecNormalize1*s
 //	Calculate unit scalar in same direction as input (sign).
 //		param s: scalar
 //		return: unit scalar (sign)
-ui32 ijkVecNormalize1us(ui32 const s);
+ijk_inl ui32 ijkVecNormalize1us(ui32 const s);
 
 // ijkVecNormalizeGetLength1*s
 //	Calculate unit scalar in same direction as input (sign).
@@ -89,7 +89,7 @@ ui32 ijkVecNormalize1us(ui32 const s);
 //		param s: scalar
 //		param length_out: pointer to length storage
 //		return: unit scalar (sign)
-ui32 ijkVecNormalizeGetLength1us(ui32 const s, ui32* const length_out);
+ijk_inl ui32 ijkVecNormalizeGetLength1us(ui32 const s, ui32* const length_out);
 
 // ijkVecNormalizeGetLengthInv1*s
 //	Calculate unit scalar in same direction as input (sign).
@@ -97,7 +97,7 @@ ui32 ijkVecNormalizeGetLength1us(ui32 const s, ui32* const length_out);
 //		param s: scalar
 //		param lengthInv_out: pointer to length storage
 //		return: unit scalar (sign)
-ui32 ijkVecNormalizeGetLengthInv1us(ui32 const s, f32* const lengthInv_out);
+ijk_inl ui32 ijkVecNormalizeGetLengthInv1us(ui32 const s, f32* const lengthInv_out);
 
 
 //-----------------------------------------------------------------------------
@@ -106,7 +106,7 @@ ui32 ijkVecNormalizeGetLengthInv1us(ui32 const s, f32* const lengthInv_out);
 //	Pass-thru array-based vector function (does nothing).
 //		param v_out: output vector
 //		return: v_out
-uintv ijkVecPuv(uintv v_out);
+ijk_inl uintv ijkVecPuv(uintv v_out);
 
 
 //-----------------------------------------------------------------------------
@@ -115,7 +115,7 @@ uintv ijkVecPuv(uintv v_out);
 //	Initialize 2D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-uintv ijkVecInit2uv(uint2 v_out);
+ijk_inl uintv ijkVecInit2uv(uint2 v_out);
 
 // ijkVecInitElems2*v
 //	Initialize 2D vector to specified individual elements.
@@ -123,35 +123,35 @@ uintv ijkVecInit2uv(uint2 v_out);
 //		param x: first element
 //		param y: second element
 //		return: v_out
-uintv ijkVecInitElems2uv(uint2 v_out, ui32 const x, ui32 const y);
+ijk_inl uintv ijkVecInitElems2uv(uint2 v_out, ui32 const x, ui32 const y);
 
 // ijkVecCopy2*v
 //	Copy 2D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-uintv ijkVecCopy2uv(uint2 v_out, uint2 const v_in);
+ijk_inl uintv ijkVecCopy2uv(uint2 v_out, uint2 const v_in);
 
 // ijkVecNegate2*v
 //	Negate 2D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-intv ijkVecNegate2uv(int2 v_out, uint2 const v_in);
+ijk_inl intv ijkVecNegate2uv(int2 v_out, uint2 const v_in);
 
 // ijkVecBitNot2*v
 //	Calculate component-wise bitwise 'not' of 2D vector.
 //		param v_out: output vector to hold component-wise bitwise 'not'
 //		param v_in: input vector
 //		return: v_out
-uintv ijkVecBitNot2uv(uint2 v_out, uint2 const v_in);
+ijk_inl uintv ijkVecBitNot2uv(uint2 v_out, uint2 const v_in);
 
 // ijkVecNot2*v
 //	Calculate component-wise logical 'not' of 2D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot2uv(bool2 bv_out, uint2 const v_in);
+ijk_inl boolv ijkVecNot2uv(bool2 bv_out, uint2 const v_in);
 
 // ijkVecAdd2*v
 //	Calculate sum of 2D vectors.
@@ -159,7 +159,7 @@ boolv ijkVecNot2uv(bool2 bv_out, uint2 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecAdd2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecAdd2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecSub2*v
 //	Calculate difference of 2D vectors.
@@ -167,7 +167,7 @@ uintv ijkVecAdd2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecSub2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecSub2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecMul2*v
 //	Calculate component-wise product of 2D vectors.
@@ -175,7 +175,7 @@ uintv ijkVecSub2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecMul2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecMul2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecDiv2*v
 //	Calculate component-wise quotient of 2D vectors.
@@ -183,7 +183,7 @@ uintv ijkVecMul2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecDiv2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecDiv2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecDivSafe2*v
 //	Calculate component-wise quotient of 2D vectors, division-by-zero safe.
@@ -191,7 +191,7 @@ uintv ijkVecDiv2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecDivSafe2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecDivSafe2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecMod2*v
 //	Calculate component-wise remainder of 2D vectors.
@@ -199,7 +199,7 @@ uintv ijkVecDivSafe2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecMod2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecMod2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecModSafe2*v
 //	Calculate component-wise remainder of 2D vectors, division-by-zero safe.
@@ -207,7 +207,7 @@ uintv ijkVecMod2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecModSafe2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecModSafe2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecBitAnd2*v
 //	Calculate component-wise bitwise 'and' of 2D vectors.
@@ -215,7 +215,7 @@ uintv ijkVecModSafe2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitAnd2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitAnd2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecBitNand2*v
 //	Calculate component-wise bitwise 'not and' of 2D vectors.
@@ -223,7 +223,7 @@ uintv ijkVecBitAnd2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitNand2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitNand2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecBitOr2*v
 //	Calculate component-wise bitwise 'or' of 2D vectors.
@@ -231,7 +231,7 @@ uintv ijkVecBitNand2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitOr2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitOr2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecBitNor2*v
 //	Calculate component-wise bitwise 'not or' of 2D vectors.
@@ -239,7 +239,7 @@ uintv ijkVecBitOr2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitNor2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitNor2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecBitXor2*v
 //	Calculate component-wise bitwise 'exclusive or' of 2D vectors.
@@ -247,7 +247,7 @@ uintv ijkVecBitNor2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitXor2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitXor2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecBitXnor2*v
 //	Calculate component-wise bitwise 'not exclusive or' of 2D vectors.
@@ -255,7 +255,7 @@ uintv ijkVecBitXor2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitXnor2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitXnor2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecBitShiftLeft2*v
 //	Calculate component-wise bit shift left of 2D vectors.
@@ -263,7 +263,7 @@ uintv ijkVecBitXnor2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitShiftLeft2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitShiftLeft2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecBitShiftRight2*v
 //	Calculate component-wise bit shift right of 2D vectors.
@@ -271,7 +271,7 @@ uintv ijkVecBitShiftLeft2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitShiftRight2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitShiftRight2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecEqual2*v
 //	Equality comparison for 2D vectors.
@@ -279,7 +279,7 @@ uintv ijkVecBitShiftRight2uv(uint2 v_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecEqual2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecInequal2*v
 //	Inequality comparison for 2D vectors.
@@ -287,7 +287,7 @@ boolv ijkVecEqual2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecInequal2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecLessEqual2*v
 //	Less-than or equal comparison for 2D vectors.
@@ -295,7 +295,7 @@ boolv ijkVecInequal2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecLessEqual2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecGreaterEqual2*v
 //	Greater-than or equal comparison for 2D vectors.
@@ -303,7 +303,7 @@ boolv ijkVecLessEqual2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecLess2*v
 //	Less-than comparison for 2D vectors.
@@ -311,7 +311,7 @@ boolv ijkVecGreaterEqual2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecLess2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecGreater2*v
 //	Greater-than comparison for 2D vectors.
@@ -319,7 +319,7 @@ boolv ijkVecLess2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecGreater2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecAnd2*v
 //	Component-wise logical 'and' of 2D vectors.
@@ -327,7 +327,7 @@ boolv ijkVecGreater2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecAnd2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecNand2*v
 //	Component-wise logical 'nand' of 2D vectors.
@@ -335,7 +335,7 @@ boolv ijkVecAnd2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecNand2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecOr2*v
 //	Component-wise logical 'or' of 2D vectors.
@@ -343,7 +343,7 @@ boolv ijkVecNand2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecOr2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecNor2*v
 //	Component-wise logical 'nor' of 2D vectors.
@@ -351,35 +351,35 @@ boolv ijkVecOr2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecNor2uv(bool2 bv_out, uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecCopy2*vs
 //	Copy 2D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-uintv ijkVecCopy2uvs(uint2 v_out, ui32 const s_in);
+ijk_inl uintv ijkVecCopy2uvs(uint2 v_out, ui32 const s_in);
 
 // ijkVecNegate2*vs
 //	Negate scalar to 2D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-intv ijkVecNegate2uvs(int2 v_out, ui32 const s_in);
+ijk_inl intv ijkVecNegate2uvs(int2 v_out, ui32 const s_in);
 
 // ijkVecBitNot2*vs
 //	Calculate bitwise 'not' of 2D vector.
 //		param v_out: output vector to hold bitwise 'not'
 //		param s_in: input scalar
 //		return: v_out
-uintv ijkVecBitNot2uvs(uint2 v_out, ui32 const s_in);
+ijk_inl uintv ijkVecBitNot2uvs(uint2 v_out, ui32 const s_in);
 
 // ijkVecNot2*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot2uvs(bool2 bv_out, ui32 const s_in);
+ijk_inl boolv ijkVecNot2uvs(bool2 bv_out, ui32 const s_in);
 
 // ijkVecAdd2*vs
 //	Calculate sum of 2D vector components and scalar.
@@ -387,7 +387,7 @@ boolv ijkVecNot2uvs(bool2 bv_out, ui32 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecAdd2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecAdd2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecSub2*vs
 //	Calculate difference of 2D vector components and scalar.
@@ -395,7 +395,7 @@ uintv ijkVecAdd2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecSub2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecSub2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecMul2*vs
 //	Calculate product of 2D vector components by scalar.
@@ -403,7 +403,7 @@ uintv ijkVecSub2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecMul2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecMul2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecDiv2*vs
 //	Calculate quotient of 2D vector components by scalar.
@@ -411,7 +411,7 @@ uintv ijkVecMul2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecDiv2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecDiv2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecDivSafe2*vs
 //	Calculate quotient of 2D vector components by scalar, division-by-zero safe.
@@ -419,7 +419,7 @@ uintv ijkVecDiv2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecDivSafe2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecDivSafe2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecMod2*vs
 //	Calculate remainder of 2D vector components by scalar.
@@ -427,7 +427,7 @@ uintv ijkVecDivSafe2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecMod2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecMod2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecModSafe2*vs
 //	Calculate remainder of 2D vector components by scalar, division-by-zero safe.
@@ -435,7 +435,7 @@ uintv ijkVecMod2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecModSafe2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecModSafe2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecBitAnd2*vs
 //	Calculate bitwise 'and' of 2D vector components and scalar.
@@ -443,7 +443,7 @@ uintv ijkVecModSafe2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitAnd2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitAnd2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecBitNand2*vs
 //	Calculate bitwise 'not and' of 2D vector components and scalar.
@@ -451,7 +451,7 @@ uintv ijkVecBitAnd2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitNand2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitNand2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecBitOr2*vs
 //	Calculate bitwise 'or' of 2D vector components and scalar.
@@ -459,7 +459,7 @@ uintv ijkVecBitNand2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitOr2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitOr2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecBitNor2*vs
 //	Calculate bitwise 'not or' of 2D vector components and scalar.
@@ -467,7 +467,7 @@ uintv ijkVecBitOr2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitNor2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitNor2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecBitXor2*vs
 //	Calculate bitwise 'exclusive or' of 2D vector components and scalar.
@@ -475,7 +475,7 @@ uintv ijkVecBitNor2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitXor2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitXor2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecBitXnor2*vs
 //	Calculate bitwise 'not exclusive or' of 2D vector components and scalar.
@@ -483,7 +483,7 @@ uintv ijkVecBitXor2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitXnor2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitXnor2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecBitShiftLeft2*vs
 //	Calculate bit shift left of 2D vector components and scalar.
@@ -491,7 +491,7 @@ uintv ijkVecBitXnor2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitShiftLeft2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitShiftLeft2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecBitShiftRight2*vs
 //	Calculate bit shift right of 2D vector components and scalar.
@@ -499,7 +499,7 @@ uintv ijkVecBitShiftLeft2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitShiftRight2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitShiftRight2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecEqual2*vs
 //	Equality comparison of 2D vector components and scalar.
@@ -507,7 +507,7 @@ uintv ijkVecBitShiftRight2uvs(uint2 v_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecEqual2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecInequal2*vs
 //	Inequality comparison of 2D vector components and scalar.
@@ -515,7 +515,7 @@ boolv ijkVecEqual2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecInequal2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecLessEqual2*vs
 //	Less-than or equal comparison of 2D vector components and scalar.
@@ -523,7 +523,7 @@ boolv ijkVecInequal2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecLessEqual2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecGreaterEqual2*vs
 //	Greater-than or equal comparison of 2D vector components and scalar.
@@ -531,7 +531,7 @@ boolv ijkVecLessEqual2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecLess2*vs
 //	Less-than comparison of 2D vector components and scalar.
@@ -539,7 +539,7 @@ boolv ijkVecGreaterEqual2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecLess2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecGreater2*vs
 //	Greater-than comparison of 2D vector components and scalar.
@@ -547,7 +547,7 @@ boolv ijkVecLess2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecGreater2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecAnd2*vs
 //	Component-wise logical 'and' of 2D vector and scalar.
@@ -555,7 +555,7 @@ boolv ijkVecGreater2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecAnd2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecNand2*vs
 //	Component-wise logical 'nand' of 2D vector and scalar.
@@ -563,7 +563,7 @@ boolv ijkVecAnd2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecNand2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecOr2*vs
 //	Component-wise logical 'or' of 2D vector and scalar.
@@ -571,7 +571,7 @@ boolv ijkVecNand2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecOr2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecNor2*vs
 //	Component-wise logical 'nor' of 2D vector and scalar.
@@ -579,7 +579,7 @@ boolv ijkVecOr2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecNor2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 
 // ijkVecAdd2*sv
 //	Calculate sum of scalar and 2D vector components.
@@ -587,7 +587,7 @@ boolv ijkVecNor2uvs(bool2 bv_out, uint2 const v_lh, ui32 const s_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecAdd2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecAdd2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecSub2*sv
 //	Calculate difference of scalar and 2D vector components.
@@ -595,7 +595,7 @@ uintv ijkVecAdd2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecSub2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecSub2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecMul2*sv
 //	Calculate product of scalar by 2D vector components.
@@ -603,7 +603,7 @@ uintv ijkVecSub2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecMul2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecMul2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecDiv2*sv
 //	Calculate quotient of scalar by 2D vector components.
@@ -611,7 +611,7 @@ uintv ijkVecMul2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecDiv2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecDiv2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecDivSafe2*sv
 //	Calculate quotient of scalar by 2D vector components, division-by-zero safe.
@@ -619,7 +619,7 @@ uintv ijkVecDiv2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecDivSafe2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecDivSafe2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecMod2*sv
 //	Calculate remainder of scalar by 2D vector components.
@@ -627,7 +627,7 @@ uintv ijkVecDivSafe2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecMod2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecMod2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecModSafe2*sv
 //	Calculate remainder of scalar by 2D vector components, division-by-zero safe.
@@ -635,7 +635,7 @@ uintv ijkVecMod2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecModSafe2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecModSafe2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecBitAnd2*sv
 //	Calculate bitwise 'and' of scalar and 2D vector components.
@@ -643,7 +643,7 @@ uintv ijkVecModSafe2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitAnd2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitAnd2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecBitNand2*sv
 //	Calculate bitwise 'not and' of scalar and 2D vector components.
@@ -651,7 +651,7 @@ uintv ijkVecBitAnd2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitNand2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitNand2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecBitOr2*sv
 //	Calculate bitwise 'or' of scalar and 2D vector components.
@@ -659,7 +659,7 @@ uintv ijkVecBitNand2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitOr2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitOr2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecBitNor2*sv
 //	Calculate bitwise 'not or' of scalar and 2D vector components.
@@ -667,7 +667,7 @@ uintv ijkVecBitOr2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitNor2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitNor2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecBitXor2*sv
 //	Calculate bitwise 'exclusive or' of scalar and 2D vector components.
@@ -675,7 +675,7 @@ uintv ijkVecBitNor2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitXor2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitXor2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecBitXnor2*sv
 //	Calculate bitwise 'not exclusive or' of scalar and 2D vector components.
@@ -683,7 +683,7 @@ uintv ijkVecBitXor2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitXnor2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitXnor2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecBitShiftLeft2*sv
 //	Calculate bit shift left of scalar by 2D vector components.
@@ -691,7 +691,7 @@ uintv ijkVecBitXnor2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitShiftLeft2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitShiftLeft2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecBitShiftRight2*sv
 //	Calculate bit shift right of scalar by 2D vector components.
@@ -699,7 +699,7 @@ uintv ijkVecBitShiftLeft2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitShiftRight2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl uintv ijkVecBitShiftRight2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecEqual2*sv
 //	Equality comparison of scalar and 2D vector components.
@@ -707,7 +707,7 @@ uintv ijkVecBitShiftRight2usv(uint2 v_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecEqual2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecInequal2*sv
 //	Inequality comparison of scalar and 2D vector components.
@@ -715,7 +715,7 @@ boolv ijkVecEqual2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecInequal2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecLessEqual2*sv
 //	Less-than or equal comparison of scalar and 2D vector components.
@@ -723,7 +723,7 @@ boolv ijkVecInequal2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecLessEqual2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecGreaterEqual2*sv
 //	Greater-than or equal comparison of scalar and 2D vector components.
@@ -731,7 +731,7 @@ boolv ijkVecLessEqual2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecLess2*sv
 //	Less-than comparison of scalar and 2D vector components.
@@ -739,7 +739,7 @@ boolv ijkVecGreaterEqual2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecLess2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecGreater2*sv
 //	Greater-than comparison of scalar and 2D vector components.
@@ -747,7 +747,7 @@ boolv ijkVecLess2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecGreater2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecAnd2*sv
 //	Component-wise logical 'and' of 2D vector and scalar.
@@ -755,7 +755,7 @@ boolv ijkVecGreater2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecAnd2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecNand2*sv
 //	Component-wise logical 'nand' of 2D vector and scalar.
@@ -763,7 +763,7 @@ boolv ijkVecAnd2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecNand2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecOr2*sv
 //	Component-wise logical 'or' of 2D vector and scalar.
@@ -771,7 +771,7 @@ boolv ijkVecNand2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecOr2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecNor2*sv
 //	Component-wise logical 'nor' of 2D vector and scalar.
@@ -779,21 +779,21 @@ boolv ijkVecOr2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
+ijk_inl boolv ijkVecNor2usv(bool2 bv_out, ui32 const s_lh, uint2 const v_rh);
 
 // ijkVecDot2*v
 //	Dot product of 2D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-ui32 ijkVecDot2uv(uint2 const v_lh, uint2 const v_rh);
+ijk_inl ui32 ijkVecDot2uv(uint2 const v_lh, uint2 const v_rh);
 
 // ijkVecCross2*v
 //	Cross product scalar of 2D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar quantity of imaginary perpendicular axis
-ui32 ijkVecCross2uv(uint2 const v_lh, uint2 const v_rh);
+ijk_inl ui32 ijkVecCross2uv(uint2 const v_lh, uint2 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -802,7 +802,7 @@ ui32 ijkVecCross2uv(uint2 const v_lh, uint2 const v_rh);
 //	Initialize 3D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-uintv ijkVecInit3uv(uint3 v_out);
+ijk_inl uintv ijkVecInit3uv(uint3 v_out);
 
 // ijkVecInitElems3*v
 //	Initialize 3D vector to specified individual elements.
@@ -811,35 +811,35 @@ uintv ijkVecInit3uv(uint3 v_out);
 //		param y: second element
 //		param z: third element
 //		return: v_out
-uintv ijkVecInitElems3uv(uint3 v_out, ui32 const x, ui32 const y, ui32 const z);
+ijk_inl uintv ijkVecInitElems3uv(uint3 v_out, ui32 const x, ui32 const y, ui32 const z);
 
 // ijkVecCopy3*v
 //	Copy 3D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-uintv ijkVecCopy3uv(uint3 v_out, uint3 const v_in);
+ijk_inl uintv ijkVecCopy3uv(uint3 v_out, uint3 const v_in);
 
 // ijkVecNegate3*v
 //	Negate 3D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-intv ijkVecNegate3uv(int3 v_out, uint3 const v_in);
+ijk_inl intv ijkVecNegate3uv(int3 v_out, uint3 const v_in);
 
 // ijkVecBitNot3*v
 //	Calculate component-wise bitwise 'not' of 3D vector.
 //		param v_out: output vector to hold component-wise bitwise 'not'
 //		param v_in: input vector
 //		return: v_out
-uintv ijkVecBitNot3uv(uint3 v_out, uint3 const v_in);
+ijk_inl uintv ijkVecBitNot3uv(uint3 v_out, uint3 const v_in);
 
 // ijkVecNot3*v
 //	Calculate component-wise logical 'not' of 3D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot3uv(bool3 bv_out, uint3 const v_in);
+ijk_inl boolv ijkVecNot3uv(bool3 bv_out, uint3 const v_in);
 
 // ijkVecAdd3*v
 //	Calculate sum of 3D vectors.
@@ -847,7 +847,7 @@ boolv ijkVecNot3uv(bool3 bv_out, uint3 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecAdd3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecAdd3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecSub3*v
 //	Calculate difference of 3D vectors.
@@ -855,7 +855,7 @@ uintv ijkVecAdd3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecSub3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecSub3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecMul3*v
 //	Calculate component-wise product of 3D vectors.
@@ -863,7 +863,7 @@ uintv ijkVecSub3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecMul3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecMul3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecDiv3*v
 //	Calculate component-wise quotient of 3D vectors.
@@ -871,7 +871,7 @@ uintv ijkVecMul3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecDiv3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecDiv3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecDivSafe3*v
 //	Calculate component-wise quotient of 3D vectors, division-by-zero safe.
@@ -879,7 +879,7 @@ uintv ijkVecDiv3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecDivSafe3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecDivSafe3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecMod3*v
 //	Calculate component-wise remainder of 3D vectors.
@@ -887,7 +887,7 @@ uintv ijkVecDivSafe3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecMod3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecMod3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecModSafe3*v
 //	Calculate component-wise remainder of 3D vectors, division-by-zero safe.
@@ -895,7 +895,7 @@ uintv ijkVecMod3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecModSafe3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecModSafe3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecBitAnd3*v
 //	Calculate component-wise bitwise 'and' of 3D vectors.
@@ -903,7 +903,7 @@ uintv ijkVecModSafe3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitAnd3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitAnd3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecBitNand3*v
 //	Calculate component-wise bitwise 'not and' of 3D vectors.
@@ -911,7 +911,7 @@ uintv ijkVecBitAnd3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitNand3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitNand3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecBitOr3*v
 //	Calculate component-wise bitwise 'or' of 3D vectors.
@@ -919,7 +919,7 @@ uintv ijkVecBitNand3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitOr3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitOr3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecBitNor3*v
 //	Calculate component-wise bitwise 'not or' of 3D vectors.
@@ -927,7 +927,7 @@ uintv ijkVecBitOr3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitNor3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitNor3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecBitXor3*v
 //	Calculate component-wise bitwise 'exclusive or' of 3D vectors.
@@ -935,7 +935,7 @@ uintv ijkVecBitNor3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitXor3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitXor3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecBitXnor3*v
 //	Calculate component-wise bitwise 'not exclusive or' of 3D vectors.
@@ -943,7 +943,7 @@ uintv ijkVecBitXor3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitXnor3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitXnor3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecBitShiftLeft3*v
 //	Calculate component-wise bit shift left of 3D vectors.
@@ -951,7 +951,7 @@ uintv ijkVecBitXnor3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitShiftLeft3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitShiftLeft3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecBitShiftRight3*v
 //	Calculate component-wise bit shift right of 3D vectors.
@@ -959,7 +959,7 @@ uintv ijkVecBitShiftLeft3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitShiftRight3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitShiftRight3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecEqual3*v
 //	Equality comparison for 3D vectors.
@@ -967,7 +967,7 @@ uintv ijkVecBitShiftRight3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecEqual3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecInequal3*v
 //	Inequality comparison for 3D vectors.
@@ -975,7 +975,7 @@ boolv ijkVecEqual3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecInequal3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecLessEqual3*v
 //	Less-than or equal comparison for 3D vectors.
@@ -983,7 +983,7 @@ boolv ijkVecInequal3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecLessEqual3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecGreaterEqual3*v
 //	Greater-than or equal comparison for 3D vectors.
@@ -991,7 +991,7 @@ boolv ijkVecLessEqual3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecLess3*v
 //	Less-than comparison for 3D vectors.
@@ -999,7 +999,7 @@ boolv ijkVecGreaterEqual3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecLess3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecGreater3*v
 //	Greater-than comparison for 3D vectors.
@@ -1007,7 +1007,7 @@ boolv ijkVecLess3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecGreater3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecAnd3*v
 //	Component-wise logical 'and' of 3D vectors.
@@ -1015,7 +1015,7 @@ boolv ijkVecGreater3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecAnd3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecNand3*v
 //	Component-wise logical 'nand' of 3D vectors.
@@ -1023,7 +1023,7 @@ boolv ijkVecAnd3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecNand3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecOr3*v
 //	Component-wise logical 'or' of 3D vectors.
@@ -1031,7 +1031,7 @@ boolv ijkVecNand3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecOr3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecNor3*v
 //	Component-wise logical 'nor' of 3D vectors.
@@ -1039,7 +1039,7 @@ boolv ijkVecOr3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecNor3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecCopy3*vz
 //	Copy 3D vector from 2D vector and one scalar.
@@ -1047,35 +1047,35 @@ boolv ijkVecNor3uv(bool3 bv_out, uint3 const v_lh, uint3 const v_rh);
 //		param v_xy: input 2D vector holding first two components
 //		param z: third element
 //		return: v_out
-uintv ijkVecCopy3uvz(uint3 v_out, uint2 const v_xy, ui32 const z);
+ijk_inl uintv ijkVecCopy3uvz(uint3 v_out, uint2 const v_xy, ui32 const z);
 
 // ijkVecCopy3*vs
 //	Copy 3D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-uintv ijkVecCopy3uvs(uint3 v_out, ui32 const s_in);
+ijk_inl uintv ijkVecCopy3uvs(uint3 v_out, ui32 const s_in);
 
 // ijkVecNegate3*vs
 //	Negate scalar to 3D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-intv ijkVecNegate3uvs(int3 v_out, ui32 const s_in);
+ijk_inl intv ijkVecNegate3uvs(int3 v_out, ui32 const s_in);
 
 // ijkVecBitNot3*vs
 //	Calculate bitwise 'not' of 3D vector.
 //		param v_out: output vector to hold bitwise 'not'
 //		param s_in: input scalar
 //		return: v_out
-uintv ijkVecBitNot3uvs(uint3 v_out, ui32 const s_in);
+ijk_inl uintv ijkVecBitNot3uvs(uint3 v_out, ui32 const s_in);
 
 // ijkVecNot3*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot3uvs(bool3 bv_out, ui32 const s_in);
+ijk_inl boolv ijkVecNot3uvs(bool3 bv_out, ui32 const s_in);
 
 // ijkVecAdd3*vs
 //	Calculate sum of 3D vector components and scalar.
@@ -1083,7 +1083,7 @@ boolv ijkVecNot3uvs(bool3 bv_out, ui32 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecAdd3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecAdd3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecSub3*vs
 //	Calculate difference of 3D vector components and scalar.
@@ -1091,7 +1091,7 @@ uintv ijkVecAdd3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecSub3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecSub3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecMul3*vs
 //	Calculate product of 3D vector components by scalar.
@@ -1099,7 +1099,7 @@ uintv ijkVecSub3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecMul3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecMul3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecDiv3*vs
 //	Calculate quotient of 3D vector components by scalar.
@@ -1107,7 +1107,7 @@ uintv ijkVecMul3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecDiv3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecDiv3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecDivSafe3*vs
 //	Calculate quotient of 3D vector components by scalar, division-by-zero safe.
@@ -1115,7 +1115,7 @@ uintv ijkVecDiv3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecDivSafe3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecDivSafe3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecMod3*vs
 //	Calculate remainder of 3D vector components by scalar.
@@ -1123,7 +1123,7 @@ uintv ijkVecDivSafe3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecMod3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecMod3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecModSafe3*vs
 //	Calculate remainder of 3D vector components by scalar, division-by-zero safe.
@@ -1131,7 +1131,7 @@ uintv ijkVecMod3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecModSafe3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecModSafe3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecBitAnd3*vs
 //	Calculate bitwise 'and' of 3D vector components and scalar.
@@ -1139,7 +1139,7 @@ uintv ijkVecModSafe3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitAnd3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitAnd3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecBitNand3*vs
 //	Calculate bitwise 'not and' of 3D vector components and scalar.
@@ -1147,7 +1147,7 @@ uintv ijkVecBitAnd3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitNand3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitNand3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecBitOr3*vs
 //	Calculate bitwise 'or' of 3D vector components and scalar.
@@ -1155,7 +1155,7 @@ uintv ijkVecBitNand3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitOr3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitOr3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecBitNor3*vs
 //	Calculate bitwise 'not or' of 3D vector components and scalar.
@@ -1163,7 +1163,7 @@ uintv ijkVecBitOr3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitNor3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitNor3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecBitXor3*vs
 //	Calculate bitwise 'exclusive or' of 3D vector components and scalar.
@@ -1171,7 +1171,7 @@ uintv ijkVecBitNor3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitXor3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitXor3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecBitXnor3*vs
 //	Calculate bitwise 'not exclusive or' of 3D vector components and scalar.
@@ -1179,7 +1179,7 @@ uintv ijkVecBitXor3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitXnor3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitXnor3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecBitShiftLeft3*vs
 //	Calculate bit shift left of 3D vector components and scalar.
@@ -1187,7 +1187,7 @@ uintv ijkVecBitXnor3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitShiftLeft3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitShiftLeft3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecBitShiftRight3*vs
 //	Calculate bit shift right of 3D vector components and scalar.
@@ -1195,7 +1195,7 @@ uintv ijkVecBitShiftLeft3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitShiftRight3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitShiftRight3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecEqual3*vs
 //	Equality comparison of 3D vector components and scalar.
@@ -1203,7 +1203,7 @@ uintv ijkVecBitShiftRight3uvs(uint3 v_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecEqual3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecInequal3*vs
 //	Inequality comparison of 3D vector components and scalar.
@@ -1211,7 +1211,7 @@ boolv ijkVecEqual3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecInequal3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecLessEqual3*vs
 //	Less-than or equal comparison of 3D vector components and scalar.
@@ -1219,7 +1219,7 @@ boolv ijkVecInequal3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecLessEqual3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecGreaterEqual3*vs
 //	Greater-than or equal comparison of 3D vector components and scalar.
@@ -1227,7 +1227,7 @@ boolv ijkVecLessEqual3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecLess3*vs
 //	Less-than comparison of 3D vector components and scalar.
@@ -1235,7 +1235,7 @@ boolv ijkVecGreaterEqual3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecLess3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecGreater3*vs
 //	Greater-than comparison of 3D vector components and scalar.
@@ -1243,7 +1243,7 @@ boolv ijkVecLess3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecGreater3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecAnd3*vs
 //	Component-wise logical 'and' of 3D vector and scalar.
@@ -1251,7 +1251,7 @@ boolv ijkVecGreater3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecAnd3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecNand3*vs
 //	Component-wise logical 'nand' of 3D vector and scalar.
@@ -1259,7 +1259,7 @@ boolv ijkVecAnd3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecNand3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecOr3*vs
 //	Component-wise logical 'or' of 3D vector and scalar.
@@ -1267,7 +1267,7 @@ boolv ijkVecNand3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecOr3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecNor3*vs
 //	Component-wise logical 'nor' of 3D vector and scalar.
@@ -1275,7 +1275,7 @@ boolv ijkVecOr3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecNor3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 
 // ijkVecCopy3*xv
 //	Copy 3D vector from 2D vector and one scalar.
@@ -1283,7 +1283,7 @@ boolv ijkVecNor3uvs(bool3 bv_out, uint3 const v_lh, ui32 const s_rh);
 //		param x: first element
 //		param v_yz: input 2D vector holding last two components
 //		return: v_out
-uintv ijkVecCopy3uxv(uint3 v_out, ui32 const x, uint2 const v_yz);
+ijk_inl uintv ijkVecCopy3uxv(uint3 v_out, ui32 const x, uint2 const v_yz);
 
 // ijkVecAdd3*sv
 //	Calculate sum of scalar and 3D vector components.
@@ -1291,7 +1291,7 @@ uintv ijkVecCopy3uxv(uint3 v_out, ui32 const x, uint2 const v_yz);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecAdd3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecAdd3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecSub3*sv
 //	Calculate difference of scalar and 3D vector components.
@@ -1299,7 +1299,7 @@ uintv ijkVecAdd3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecSub3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecSub3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecMul3*sv
 //	Calculate product of scalar by 3D vector components.
@@ -1307,7 +1307,7 @@ uintv ijkVecSub3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecMul3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecMul3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecDiv3*sv
 //	Calculate quotient of scalar by 3D vector components.
@@ -1315,7 +1315,7 @@ uintv ijkVecMul3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecDiv3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecDiv3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecDivSafe3*sv
 //	Calculate quotient of scalar by 3D vector components, division-by-zero safe.
@@ -1323,7 +1323,7 @@ uintv ijkVecDiv3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecDivSafe3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecDivSafe3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecMod3*sv
 //	Calculate remainder of scalar by 3D vector components.
@@ -1331,7 +1331,7 @@ uintv ijkVecDivSafe3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecMod3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecMod3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecModSafe3*sv
 //	Calculate remainder of scalar by 3D vector components, division-by-zero safe.
@@ -1339,7 +1339,7 @@ uintv ijkVecMod3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecModSafe3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecModSafe3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecBitAnd3*sv
 //	Calculate bitwise 'and' of scalar and 3D vector components.
@@ -1347,7 +1347,7 @@ uintv ijkVecModSafe3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitAnd3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitAnd3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecBitNand3*sv
 //	Calculate bitwise 'not and' of scalar and 3D vector components.
@@ -1355,7 +1355,7 @@ uintv ijkVecBitAnd3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitNand3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitNand3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecBitOr3*sv
 //	Calculate bitwise 'or' of scalar and 3D vector components.
@@ -1363,7 +1363,7 @@ uintv ijkVecBitNand3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitOr3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitOr3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecBitNor3*sv
 //	Calculate bitwise 'not or' of scalar and 3D vector components.
@@ -1371,7 +1371,7 @@ uintv ijkVecBitOr3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitNor3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitNor3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecBitXor3*sv
 //	Calculate bitwise 'exclusive or' of scalar and 3D vector components.
@@ -1379,7 +1379,7 @@ uintv ijkVecBitNor3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitXor3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitXor3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecBitXnor3*sv
 //	Calculate bitwise 'not exclusive or' of scalar and 3D vector components.
@@ -1387,7 +1387,7 @@ uintv ijkVecBitXor3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitXnor3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitXnor3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecBitShiftLeft3*sv
 //	Calculate bit shift left of scalar by 3D vector components.
@@ -1395,7 +1395,7 @@ uintv ijkVecBitXnor3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitShiftLeft3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitShiftLeft3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecBitShiftRight3*sv
 //	Calculate bit shift right of scalar by 3D vector components.
@@ -1403,7 +1403,7 @@ uintv ijkVecBitShiftLeft3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitShiftRight3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecBitShiftRight3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecEqual3*sv
 //	Equality comparison of scalar and 3D vector components.
@@ -1411,7 +1411,7 @@ uintv ijkVecBitShiftRight3usv(uint3 v_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecEqual3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecInequal3*sv
 //	Inequality comparison of scalar and 3D vector components.
@@ -1419,7 +1419,7 @@ boolv ijkVecEqual3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecInequal3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecLessEqual3*sv
 //	Less-than or equal comparison of scalar and 3D vector components.
@@ -1427,7 +1427,7 @@ boolv ijkVecInequal3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecLessEqual3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecGreaterEqual3*sv
 //	Greater-than or equal comparison of scalar and 3D vector components.
@@ -1435,7 +1435,7 @@ boolv ijkVecLessEqual3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecLess3*sv
 //	Less-than comparison of scalar and 3D vector components.
@@ -1443,7 +1443,7 @@ boolv ijkVecGreaterEqual3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecLess3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecGreater3*sv
 //	Greater-than comparison of scalar and 3D vector components.
@@ -1451,7 +1451,7 @@ boolv ijkVecLess3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecGreater3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecAnd3*sv
 //	Component-wise logical 'and' of 3D vector and scalar.
@@ -1459,7 +1459,7 @@ boolv ijkVecGreater3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecAnd3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecNand3*sv
 //	Component-wise logical 'nand' of 3D vector and scalar.
@@ -1467,7 +1467,7 @@ boolv ijkVecAnd3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecNand3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecOr3*sv
 //	Component-wise logical 'or' of 3D vector and scalar.
@@ -1475,7 +1475,7 @@ boolv ijkVecNand3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecOr3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecNor3*sv
 //	Component-wise logical 'nor' of 3D vector and scalar.
@@ -1483,14 +1483,14 @@ boolv ijkVecOr3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
+ijk_inl boolv ijkVecNor3usv(bool3 bv_out, ui32 const s_lh, uint3 const v_rh);
 
 // ijkVecDot3*v
 //	Dot product of 3D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-ui32 ijkVecDot3uv(uint3 const v_lh, uint3 const v_rh);
+ijk_inl ui32 ijkVecDot3uv(uint3 const v_lh, uint3 const v_rh);
 
 // ijkVecCross3*v
 //	Cross product of 3D array-based vectors.
@@ -1498,7 +1498,7 @@ ui32 ijkVecDot3uv(uint3 const v_lh, uint3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecCross3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
+ijk_inl uintv ijkVecCross3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -1507,7 +1507,7 @@ uintv ijkVecCross3uv(uint3 v_out, uint3 const v_lh, uint3 const v_rh);
 //	Initialize 4D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-uintv ijkVecInit4uv(uint4 v_out);
+ijk_inl uintv ijkVecInit4uv(uint4 v_out);
 
 // ijkVecInitElems4*v
 //	Initialize 4D vector to specified individual elements.
@@ -1517,7 +1517,7 @@ uintv ijkVecInit4uv(uint4 v_out);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: v_out
-uintv ijkVecInitElems4uv(uint4 v_out, ui32 const x, ui32 const y, ui32 const z, ui32 const w);
+ijk_inl uintv ijkVecInitElems4uv(uint4 v_out, ui32 const x, ui32 const y, ui32 const z, ui32 const w);
 
 // ijkVecCopy4*xvw
 //	Copy 4D vector from scalar, 2D vector and another scalar.
@@ -1526,7 +1526,7 @@ uintv ijkVecInitElems4uv(uint4 v_out, ui32 const x, ui32 const y, ui32 const z,
 //		param v_yz: input 2D vector holding middle two components
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: v_out
-uintv ijkVecCopy4uxvw(uint4 v_out, ui32 const x, uint2 const v_yz, ui32 const w);
+ijk_inl uintv ijkVecCopy4uxvw(uint4 v_out, ui32 const x, uint2 const v_yz, ui32 const w);
 
 // ijkVecCopy4*v2
 //	Copy 4D vector from two 2D vectors.
@@ -1534,35 +1534,35 @@ uintv ijkVecCopy4uxvw(uint4 v_out, ui32 const x, uint2 const v_yz, ui32 const w)
 //		param v_xy: input 2D vector holding first two components
 //		param v_zw: input 2D vector holding last two components
 //		return: v_out
-uintv ijkVecCopy4uv2(uint4 v_out, uint2 const v_xy, uint2 const v_zw);
+ijk_inl uintv ijkVecCopy4uv2(uint4 v_out, uint2 const v_xy, uint2 const v_zw);
 
 // ijkVecCopy4*v
 //	Copy 4D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-uintv ijkVecCopy4uv(uint4 v_out, uint4 const v_in);
+ijk_inl uintv ijkVecCopy4uv(uint4 v_out, uint4 const v_in);
 
 // ijkVecNegate4*v
 //	Negate 4D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-intv ijkVecNegate4uv(int4 v_out, uint4 const v_in);
+ijk_inl intv ijkVecNegate4uv(int4 v_out, uint4 const v_in);
 
 // ijkVecBitNot4*v
 //	Calculate component-wise bitwise 'not' of 4D vector.
 //		param v_out: output vector to hold component-wise bitwise 'not'
 //		param v_in: input vector
 //		return: v_out
-uintv ijkVecBitNot4uv(uint4 v_out, uint4 const v_in);
+ijk_inl uintv ijkVecBitNot4uv(uint4 v_out, uint4 const v_in);
 
 // ijkVecNot4*v
 //	Calculate component-wise logical 'not' of 4D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot4uv(bool4 bv_out, uint4 const v_in);
+ijk_inl boolv ijkVecNot4uv(bool4 bv_out, uint4 const v_in);
 
 // ijkVecAdd4*v
 //	Calculate sum of 4D vectors.
@@ -1570,7 +1570,7 @@ boolv ijkVecNot4uv(bool4 bv_out, uint4 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecAdd4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecAdd4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecSub4*v
 //	Calculate difference of 4D vectors.
@@ -1578,7 +1578,7 @@ uintv ijkVecAdd4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecSub4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecSub4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecMul4*v
 //	Calculate component-wise product of 4D vectors.
@@ -1586,7 +1586,7 @@ uintv ijkVecSub4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecMul4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecMul4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecDiv4*v
 //	Calculate component-wise quotient of 4D vectors.
@@ -1594,7 +1594,7 @@ uintv ijkVecMul4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecDiv4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecDiv4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecDivSafe4*v
 //	Calculate component-wise quotient of 4D vectors, division-by-zero safe.
@@ -1602,7 +1602,7 @@ uintv ijkVecDiv4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecDivSafe4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecDivSafe4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecMod4*v
 //	Calculate component-wise remainder of 4D vectors.
@@ -1610,7 +1610,7 @@ uintv ijkVecDivSafe4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecMod4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecMod4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecModSafe4*v
 //	Calculate component-wise remainder of 4D vectors, division-by-zero safe.
@@ -1618,7 +1618,7 @@ uintv ijkVecMod4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecModSafe4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecModSafe4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecBitAnd4*v
 //	Calculate component-wise bitwise 'and' of 4D vectors.
@@ -1626,7 +1626,7 @@ uintv ijkVecModSafe4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitAnd4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitAnd4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecBitNand4*v
 //	Calculate component-wise bitwise 'not and' of 4D vectors.
@@ -1634,7 +1634,7 @@ uintv ijkVecBitAnd4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitNand4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitNand4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecBitOr4*v
 //	Calculate component-wise bitwise 'or' of 4D vectors.
@@ -1642,7 +1642,7 @@ uintv ijkVecBitNand4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitOr4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitOr4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecBitNor4*v
 //	Calculate component-wise bitwise 'not or' of 4D vectors.
@@ -1650,7 +1650,7 @@ uintv ijkVecBitOr4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitNor4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitNor4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecBitXor4*v
 //	Calculate component-wise bitwise 'exclusive or' of 4D vectors.
@@ -1658,7 +1658,7 @@ uintv ijkVecBitNor4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitXor4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitXor4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecBitXnor4*v
 //	Calculate component-wise bitwise 'not exclusive or' of 4D vectors.
@@ -1666,7 +1666,7 @@ uintv ijkVecBitXor4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitXnor4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitXnor4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecBitShiftLeft4*v
 //	Calculate component-wise bit shift left of 4D vectors.
@@ -1674,7 +1674,7 @@ uintv ijkVecBitXnor4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitShiftLeft4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitShiftLeft4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecBitShiftRight4*v
 //	Calculate component-wise bit shift right of 4D vectors.
@@ -1682,7 +1682,7 @@ uintv ijkVecBitShiftLeft4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitShiftRight4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitShiftRight4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecEqual4*v
 //	Equality comparison for 4D vectors.
@@ -1690,7 +1690,7 @@ uintv ijkVecBitShiftRight4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecEqual4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecInequal4*v
 //	Inequality comparison for 4D vectors.
@@ -1698,7 +1698,7 @@ boolv ijkVecEqual4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecInequal4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecLessEqual4*v
 //	Less-than or equal comparison for 4D vectors.
@@ -1706,7 +1706,7 @@ boolv ijkVecInequal4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecLessEqual4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecGreaterEqual4*v
 //	Greater-than or equal comparison for 4D vectors.
@@ -1714,7 +1714,7 @@ boolv ijkVecLessEqual4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecLess4*v
 //	Less-than comparison for 4D vectors.
@@ -1722,7 +1722,7 @@ boolv ijkVecGreaterEqual4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecLess4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecGreater4*v
 //	Greater-than comparison for 4D vectors.
@@ -1730,7 +1730,7 @@ boolv ijkVecLess4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecGreater4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecAnd4*v
 //	Component-wise logical 'and' of 4D vectors.
@@ -1738,7 +1738,7 @@ boolv ijkVecGreater4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecAnd4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecNand4*v
 //	Component-wise logical 'nand' of 4D vectors.
@@ -1746,7 +1746,7 @@ boolv ijkVecAnd4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecNand4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecOr4*v
 //	Component-wise logical 'or' of 4D vectors.
@@ -1754,7 +1754,7 @@ boolv ijkVecNand4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecOr4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecNor4*v
 //	Component-wise logical 'nor' of 4D vectors.
@@ -1762,7 +1762,7 @@ boolv ijkVecOr4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecNor4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecCopy4*vzw
 //	Copy 4D vector from 2D vector and two scalars.
@@ -1771,7 +1771,7 @@ boolv ijkVecNor4uv(bool4 bv_out, uint4 const v_lh, uint4 const v_rh);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: v_out
-uintv ijkVecCopy4uvzw(uint4 v_out, uint2 const v_xy, ui32 const z, ui32 const w);
+ijk_inl uintv ijkVecCopy4uvzw(uint4 v_out, uint2 const v_xy, ui32 const z, ui32 const w);
 
 // ijkVecCopy4*vw
 //	Copy 4D vector from 3D vector and one scalar.
@@ -1779,35 +1779,35 @@ uintv ijkVecCopy4uvzw(uint4 v_out, uint2 const v_xy, ui32 const z, ui32 const w)
 //		param v_xyz: input 3D vector holding first three components
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: v_out
-uintv ijkVecCopy4uvw(uint4 v_out, uint3 const v_xyz, ui32 const w);
+ijk_inl uintv ijkVecCopy4uvw(uint4 v_out, uint3 const v_xyz, ui32 const w);
 
 // ijkVecCopy4*vs
 //	Copy 4D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-uintv ijkVecCopy4uvs(uint4 v_out, ui32 const s_in);
+ijk_inl uintv ijkVecCopy4uvs(uint4 v_out, ui32 const s_in);
 
 // ijkVecNegate4*vs
 //	Negate scalar to 4D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-intv ijkVecNegate4uvs(int4 v_out, ui32 const s_in);
+ijk_inl intv ijkVecNegate4uvs(int4 v_out, ui32 const s_in);
 
 // ijkVecBitNot4*vs
 //	Calculate bitwise 'not' of 4D vector.
 //		param v_out: output vector to hold bitwise 'not'
 //		param s_in: input scalar
 //		return: v_out
-uintv ijkVecBitNot4uvs(uint4 v_out, ui32 const s_in);
+ijk_inl uintv ijkVecBitNot4uvs(uint4 v_out, ui32 const s_in);
 
 // ijkVecNot4*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot4uvs(bool4 bv_out, ui32 const s_in);
+ijk_inl boolv ijkVecNot4uvs(bool4 bv_out, ui32 const s_in);
 
 // ijkVecAdd4*vs
 //	Calculate sum of 4D vector components and scalar.
@@ -1815,7 +1815,7 @@ boolv ijkVecNot4uvs(bool4 bv_out, ui32 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecAdd4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecAdd4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecSub4*vs
 //	Calculate difference of 4D vector components and scalar.
@@ -1823,7 +1823,7 @@ uintv ijkVecAdd4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecSub4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecSub4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecMul4*vs
 //	Calculate product of 4D vector components by scalar.
@@ -1831,7 +1831,7 @@ uintv ijkVecSub4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecMul4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecMul4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecDiv4*vs
 //	Calculate quotient of 4D vector components by scalar.
@@ -1839,7 +1839,7 @@ uintv ijkVecMul4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecDiv4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecDiv4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecDivSafe4*vs
 //	Calculate quotient of 4D vector components by scalar, division-by-zero safe.
@@ -1847,7 +1847,7 @@ uintv ijkVecDiv4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecDivSafe4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecDivSafe4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecMod4*vs
 //	Calculate remainder of 4D vector components by scalar.
@@ -1855,7 +1855,7 @@ uintv ijkVecDivSafe4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecMod4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecMod4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecModSafe4*vs
 //	Calculate remainder of 4D vector components by scalar, division-by-zero safe.
@@ -1863,7 +1863,7 @@ uintv ijkVecMod4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecModSafe4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecModSafe4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecBitAnd4*vs
 //	Calculate bitwise 'and' of 4D vector components and scalar.
@@ -1871,7 +1871,7 @@ uintv ijkVecModSafe4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitAnd4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitAnd4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecBitNand4*vs
 //	Calculate bitwise 'not and' of 4D vector components and scalar.
@@ -1879,7 +1879,7 @@ uintv ijkVecBitAnd4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitNand4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitNand4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecBitOr4*vs
 //	Calculate bitwise 'or' of 4D vector components and scalar.
@@ -1887,7 +1887,7 @@ uintv ijkVecBitNand4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitOr4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitOr4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecBitNor4*vs
 //	Calculate bitwise 'not or' of 4D vector components and scalar.
@@ -1895,7 +1895,7 @@ uintv ijkVecBitOr4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitNor4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitNor4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecBitXor4*vs
 //	Calculate bitwise 'exclusive or' of 4D vector components and scalar.
@@ -1903,7 +1903,7 @@ uintv ijkVecBitNor4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitXor4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitXor4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecBitXnor4*vs
 //	Calculate bitwise 'not exclusive or' of 4D vector components and scalar.
@@ -1911,7 +1911,7 @@ uintv ijkVecBitXor4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitXnor4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitXnor4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecBitShiftLeft4*vs
 //	Calculate bit shift left of 4D vector components and scalar.
@@ -1919,7 +1919,7 @@ uintv ijkVecBitXnor4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitShiftLeft4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitShiftLeft4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecBitShiftRight4*vs
 //	Calculate bit shift right of 4D vector components and scalar.
@@ -1927,7 +1927,7 @@ uintv ijkVecBitShiftLeft4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintv ijkVecBitShiftRight4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl uintv ijkVecBitShiftRight4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecEqual4*vs
 //	Equality comparison of 4D vector components and scalar.
@@ -1935,7 +1935,7 @@ uintv ijkVecBitShiftRight4uvs(uint4 v_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecEqual4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecInequal4*vs
 //	Inequality comparison of 4D vector components and scalar.
@@ -1943,7 +1943,7 @@ boolv ijkVecEqual4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecInequal4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecLessEqual4*vs
 //	Less-than or equal comparison of 4D vector components and scalar.
@@ -1951,7 +1951,7 @@ boolv ijkVecInequal4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecLessEqual4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecGreaterEqual4*vs
 //	Greater-than or equal comparison of 4D vector components and scalar.
@@ -1959,7 +1959,7 @@ boolv ijkVecLessEqual4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecLess4*vs
 //	Less-than comparison of 4D vector components and scalar.
@@ -1967,7 +1967,7 @@ boolv ijkVecGreaterEqual4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecLess4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecGreater4*vs
 //	Greater-than comparison of 4D vector components and scalar.
@@ -1975,7 +1975,7 @@ boolv ijkVecLess4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecGreater4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecAnd4*vs
 //	Component-wise logical 'and' of 4D vector and scalar.
@@ -1983,7 +1983,7 @@ boolv ijkVecGreater4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecAnd4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecNand4*vs
 //	Component-wise logical 'nand' of 4D vector and scalar.
@@ -1991,7 +1991,7 @@ boolv ijkVecAnd4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecNand4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecOr4*vs
 //	Component-wise logical 'or' of 4D vector and scalar.
@@ -1999,7 +1999,7 @@ boolv ijkVecNand4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecOr4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecNor4*vs
 //	Component-wise logical 'nor' of 4D vector and scalar.
@@ -2007,7 +2007,7 @@ boolv ijkVecOr4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
+ijk_inl boolv ijkVecNor4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 
 // ijkVecCopy4*xyv
 //	Copy 4D vector from two scalars and 2D vector.
@@ -2016,7 +2016,7 @@ boolv ijkVecNor4uvs(bool4 bv_out, uint4 const v_lh, ui32 const s_rh);
 //		param y: second element
 //		param v_zw: input 2D vector holding last two components
 //		return: v_out
-uintv ijkVecCopy4uxyv(uint4 v_out, ui32 const x, ui32 const y, uint2 const v_zw);
+ijk_inl uintv ijkVecCopy4uxyv(uint4 v_out, ui32 const x, ui32 const y, uint2 const v_zw);
 
 // ijkVecCopy4*xv
 //	Copy 4D vector from one scalar and 3D vector.
@@ -2024,7 +2024,7 @@ uintv ijkVecCopy4uxyv(uint4 v_out, ui32 const x, ui32 const y, uint2 const v_zw)
 //		param x: first element
 //		param v_yzw: input 3D vector holding last three components
 //		return: v_out
-uintv ijkVecCopy4uxv(uint4 v_out, ui32 const x, uint3 const v_yzw);
+ijk_inl uintv ijkVecCopy4uxv(uint4 v_out, ui32 const x, uint3 const v_yzw);
 
 // ijkVecAdd4*sv
 //	Calculate sum of scalar and 4D vector components.
@@ -2032,7 +2032,7 @@ uintv ijkVecCopy4uxv(uint4 v_out, ui32 const x, uint3 const v_yzw);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecAdd4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecAdd4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecSub4*sv
 //	Calculate difference of scalar and 4D vector components.
@@ -2040,7 +2040,7 @@ uintv ijkVecAdd4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecSub4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecSub4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecMul4*sv
 //	Calculate product of scalar by 4D vector components.
@@ -2048,7 +2048,7 @@ uintv ijkVecSub4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecMul4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecMul4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecDiv4*sv
 //	Calculate quotient of scalar by 4D vector components.
@@ -2056,7 +2056,7 @@ uintv ijkVecMul4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecDiv4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecDiv4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecDivSafe4*sv
 //	Calculate quotient of scalar by 4D vector components, division-by-zero safe.
@@ -2064,7 +2064,7 @@ uintv ijkVecDiv4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecDivSafe4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecDivSafe4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecMod4*sv
 //	Calculate remainder of scalar by 4D vector components.
@@ -2072,7 +2072,7 @@ uintv ijkVecDivSafe4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecMod4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecMod4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecModSafe4*sv
 //	Calculate remainder of scalar by 4D vector components, division-by-zero safe.
@@ -2080,7 +2080,7 @@ uintv ijkVecMod4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecModSafe4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecModSafe4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecBitAnd4*sv
 //	Calculate bitwise 'and' of scalar and 4D vector components.
@@ -2088,7 +2088,7 @@ uintv ijkVecModSafe4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitAnd4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitAnd4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecBitNand4*sv
 //	Calculate bitwise 'not and' of scalar and 4D vector components.
@@ -2096,7 +2096,7 @@ uintv ijkVecBitAnd4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitNand4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitNand4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecBitOr4*sv
 //	Calculate bitwise 'or' of scalar and 4D vector components.
@@ -2104,7 +2104,7 @@ uintv ijkVecBitNand4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitOr4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitOr4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecBitNor4*sv
 //	Calculate bitwise 'not or' of scalar and 4D vector components.
@@ -2112,7 +2112,7 @@ uintv ijkVecBitOr4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitNor4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitNor4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecBitXor4*sv
 //	Calculate bitwise 'exclusive or' of scalar and 4D vector components.
@@ -2120,7 +2120,7 @@ uintv ijkVecBitNor4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitXor4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitXor4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecBitXnor4*sv
 //	Calculate bitwise 'not exclusive or' of scalar and 4D vector components.
@@ -2128,7 +2128,7 @@ uintv ijkVecBitXor4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitXnor4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitXnor4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecBitShiftLeft4*sv
 //	Calculate bit shift left of scalar by 4D vector components.
@@ -2136,7 +2136,7 @@ uintv ijkVecBitXnor4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitShiftLeft4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitShiftLeft4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecBitShiftRight4*sv
 //	Calculate bit shift right of scalar by 4D vector components.
@@ -2144,7 +2144,7 @@ uintv ijkVecBitShiftLeft4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintv ijkVecBitShiftRight4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecBitShiftRight4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecEqual4*sv
 //	Equality comparison of scalar and 4D vector components.
@@ -2152,7 +2152,7 @@ uintv ijkVecBitShiftRight4usv(uint4 v_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecEqual4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecInequal4*sv
 //	Inequality comparison of scalar and 4D vector components.
@@ -2160,7 +2160,7 @@ boolv ijkVecEqual4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecInequal4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecLessEqual4*sv
 //	Less-than or equal comparison of scalar and 4D vector components.
@@ -2168,7 +2168,7 @@ boolv ijkVecInequal4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecLessEqual4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecGreaterEqual4*sv
 //	Greater-than or equal comparison of scalar and 4D vector components.
@@ -2176,7 +2176,7 @@ boolv ijkVecLessEqual4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecLess4*sv
 //	Less-than comparison of scalar and 4D vector components.
@@ -2184,7 +2184,7 @@ boolv ijkVecGreaterEqual4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecLess4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecGreater4*sv
 //	Greater-than comparison of scalar and 4D vector components.
@@ -2192,7 +2192,7 @@ boolv ijkVecLess4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecGreater4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecAnd4*sv
 //	Component-wise logical 'and' of 4D vector and scalar.
@@ -2200,7 +2200,7 @@ boolv ijkVecGreater4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecAnd4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecNand4*sv
 //	Component-wise logical 'nand' of 4D vector and scalar.
@@ -2208,7 +2208,7 @@ boolv ijkVecAnd4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecNand4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecOr4*sv
 //	Component-wise logical 'or' of 4D vector and scalar.
@@ -2216,7 +2216,7 @@ boolv ijkVecNand4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecOr4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecNor4*sv
 //	Component-wise logical 'nor' of 4D vector and scalar.
@@ -2224,14 +2224,14 @@ boolv ijkVecOr4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
+ijk_inl boolv ijkVecNor4usv(bool4 bv_out, ui32 const s_lh, uint4 const v_rh);
 
 // ijkVecDot4*v
 //	Dot product of 4D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-ui32 ijkVecDot4uv(uint4 const v_lh, uint4 const v_rh);
+ijk_inl ui32 ijkVecDot4uv(uint4 const v_lh, uint4 const v_rh);
 
 // ijkVecCross4*v
 //	Cross product of 4D array-based vectors.
@@ -2239,7 +2239,7 @@ ui32 ijkVecDot4uv(uint4 const v_lh, uint4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out (fourth element is zero)
-uintv ijkVecCross4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
+ijk_inl uintv ijkVecCross4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -2256,50 +2256,50 @@ uintv ijkVecCross4uv(uint4 v_out, uint4 const v_lh, uint4 const v_rh);
 //	Absolute value of scalar: (s >= 0 ? +s : -s).
 //		param s: scalar
 //		return: absolute value
-uint ijkVecAbs1u(uint const s);
+ijk_inl uint ijkVecAbs1u(uint const s);
 
 // ijkVecSgn1*
 //	Sign of scalar: (s != 0 ? s > 0 ? +1 : -1).
 //		param s: scalar
 //		return: sign
-uint ijkVecSgn1u(uint const s);
+ijk_inl uint ijkVecSgn1u(uint const s);
 
 // ijkVecDot1*
 //	Dot product of scalars, which is just their product.
 //		param s_lh: left-hand scalar
 //		param s_rh: right-hand scalar
 //		return: product
-uint ijkVecDot1u(uint const s_lh, uint const s_rh);
+ijk_inl uint ijkVecDot1u(uint const s_lh, uint const s_rh);
 
 // ijkVecLengthSq1*
 //	Squared length of scalar.
 //		param s: scalar
 //		return: squared length
-uint ijkVecLengthSq1u(uint const s);
+ijk_inl uint ijkVecLengthSq1u(uint const s);
 
 // ijkVecLength1*
 //	Length of scalar.
 //		param s: scalar
 //		return: length
-uint ijkVecLength1u(uint const s);
+ijk_inl uint ijkVecLength1u(uint const s);
 
 // ijkVecLengthSqInv1*
 //	Inverse squared length of scalar.
 //		param s: scalar
 //		return: inverse squared length
-float ijkVecLengthSqInv1u(uint const s);
+ijk_inl float ijkVecLengthSqInv1u(uint const s);
 
 // ijkVecLengthSqInv1*
 //	Inverse length of scalar.
 //		param s: scalar
 //		return: inverse length
-float ijkVecLengthInv1u(uint const s);
+ijk_inl float ijkVecLengthInv1u(uint const s);
 
 // ijkVecNormalize1*
 //	Calculate unit scalar in same direction as input (sign).
 //		param s: scalar
 //		return: unit scalar (sign)
-uint ijkVecNormalize1u(uint const s);
+ijk_inl uint ijkVecNormalize1u(uint const s);
 
 // ijkVecNormalizeGetLength1*
 //	Calculate unit scalar in same direction as input (sign).
@@ -2307,7 +2307,7 @@ uint ijkVecNormalize1u(uint const s);
 //		param s: scalar
 //		param length_out: pointer to length storage
 //		return: unit scalar (sign)
-uint ijkVecNormalizeGetLength1u(uint const s, uint* const length_out);
+ijk_inl uint ijkVecNormalizeGetLength1u(uint const s, uint* const length_out);
 
 // ijkVecNormalizeGetLengthInv1*
 //	Calculate unit scalar in same direction as input (sign).
@@ -2315,7 +2315,7 @@ uint ijkVecNormalizeGetLength1u(uint const s, uint* const length_out);
 //		param s: scalar
 //		param lengthInv_out: pointer to length storage
 //		return: unit scalar (sign)
-uint ijkVecNormalizeGetLengthInv1u(uint const s, float* const lengthInv_out);
+ijk_inl uint ijkVecNormalizeGetLengthInv1u(uint const s, float* const lengthInv_out);
 
 
 //-----------------------------------------------------------------------------
@@ -2323,601 +2323,601 @@ uint ijkVecNormalizeGetLengthInv1u(uint const s, float* const lengthInv_out);
 // ijkVecInit2*
 //	Initialize 2D vector to default value (zero vector).
 //		return: default vector
-uvec2 ijkVecInit2u();
+ijk_inl uvec2 ijkVecInit2u();
 
 // ijkVecInitElems2*
 //	Initialize 2D vector to specified individual elements.
 //		param x: first element
 //		param y: second element
 //		return: result vector
-uvec2 ijkVecInitElems2u(uint const x, uint const y);
+ijk_inl uvec2 ijkVecInitElems2u(uint const x, uint const y);
 
 // ijkVecCopy2*
 //	Copy 2D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-uvec2 ijkVecCopy2u(uvec2 const v_in);
+ijk_inl uvec2 ijkVecCopy2u(uvec2 const v_in);
 
 // ijkVecNegate2*
 //	Negate 2D vector.
 //		param v_in: input vector
 //		return: result vector
-ivec2 ijkVecNegate2u(uvec2 const v_in);
+ijk_inl ivec2 ijkVecNegate2u(uvec2 const v_in);
 
 // ijkVecBitNot2*
 //	Calculate component-wise bitwise 'not' of 2D vector.
 //		param v_in: input vector
 //		return: result vector
-uvec2 ijkVecBitNot2u(uvec2 const v_in);
+ijk_inl uvec2 ijkVecBitNot2u(uvec2 const v_in);
 
 // ijkVecNot2*
 //	Calculate component-wise logical 'not' of 2D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec2 ijkVecNot2u(uvec2 const v_in);
+ijk_inl bvec2 ijkVecNot2u(uvec2 const v_in);
 
 // ijkVecAdd2*
 //	Calculate sum of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecAdd2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecAdd2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecSub2*
 //	Calculate difference of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecSub2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecSub2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecMul2*
 //	Calculate component-wise product of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecMul2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecMul2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecDiv2*
 //	Calculate component-wise quotient of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecDiv2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecDiv2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecDivSafe2*
 //	Calculate component-wise quotient of 2D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecDivSafe2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecDivSafe2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecMod2*
 //	Calculate component-wise remainder of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecMod2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecMod2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecModSafe2*
 //	Calculate component-wise remainder of 2D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecModSafe2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecModSafe2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecBitAnd2*
 //	Calculate component-wise bitwise 'and' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitAnd2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitAnd2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecBitNand2*
 //	Calculate component-wise bitwise 'not and' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitNand2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitNand2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecBitOr2*
 //	Calculate component-wise bitwise 'or' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitOr2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitOr2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecBitNor2*
 //	Calculate component-wise bitwise 'not or' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitNor2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitNor2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecBitXor2*
 //	Calculate component-wise bitwise 'exclusive or' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitXor2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitXor2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecBitXnor2*
 //	Calculate component-wise bitwise 'not exclusive or' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitXnor2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitXnor2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecBitShiftLeft2*
 //	Calculate component-wise bit shift left of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitShiftLeft2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitShiftLeft2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecBitShiftRight2*
 //	Calculate component-wise bit shift right of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitShiftRight2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitShiftRight2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecEqual2*
 //	Equality comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecEqual2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecEqual2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecInequal2*
 //	Inequality comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecInequal2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecInequal2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecLessEqual2*
 //	Less-than or equal comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLessEqual2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecLessEqual2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecGreaterEqual2*
 //	Greater-than or equal comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecLess2*
 //	Less-than comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLess2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecLess2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecGreater2*
 //	Greater-than comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreater2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreater2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecAnd2*
 //	Component-wise logical 'and' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecAnd2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecAnd2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecNand2*
 //	Component-wise logical 'nand' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNand2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecNand2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecOr2*
 //	Component-wise logical 'or' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecOr2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecOr2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecNor2*
 //	Component-wise logical 'nor' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNor2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecNor2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecCopy2*s
 //	Copy 2D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-uvec2 ijkVecCopy2us(uint const s_in);
+ijk_inl uvec2 ijkVecCopy2us(uint const s_in);
 
 // ijkVecNegate2*s
 //	Negate scalar to 2D vector.
 //		param s_in: input scalar
 //		return: result vector
-ivec2 ijkVecNegate2us(uint const s_in);
+ijk_inl ivec2 ijkVecNegate2us(uint const s_in);
 
 // ijkVecBitNot2*s
 //	Calculate bitwise 'not' of 2D vector.
 //		param s_in: input scalar
 //		return: result vector
-uvec2 ijkVecBitNot2us(uint const s_in);
+ijk_inl uvec2 ijkVecBitNot2us(uint const s_in);
 
 // ijkVecNot2*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec2 ijkVecNot2us(uint const s_in);
+ijk_inl bvec2 ijkVecNot2us(uint const s_in);
 
 // ijkVecAdd2*s
 //	Calculate sum of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecAdd2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecAdd2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecSub2*s
 //	Calculate difference of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecSub2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecSub2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecMul2*s
 //	Calculate product of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecMul2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecMul2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecDiv2*s
 //	Calculate quotient of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecDiv2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecDiv2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecDivSafe2*s
 //	Calculate quotient of 2D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecDivSafe2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecDivSafe2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecMod2*s
 //	Calculate remainder of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecMod2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecMod2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecModSafe2*s
 //	Calculate remainder of 2D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecModSafe2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecModSafe2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecBitAnd2*s
 //	Calculate bitwise 'and' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecBitAnd2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecBitAnd2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecBitNand2*s
 //	Calculate bitwise 'not and' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecBitNand2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecBitNand2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecBitOr2*s
 //	Calculate bitwise 'or' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecBitOr2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecBitOr2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecBitNor2*s
 //	Calculate bitwise 'not or' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecBitNor2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecBitNor2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecBitXor2*s
 //	Calculate bitwise 'exclusive or' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecBitXor2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecBitXor2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecBitXnor2*s
 //	Calculate bitwise 'not exclusive or' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecBitXnor2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecBitXnor2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecBitShiftLeft2*s
 //	Calculate bit shift left of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecBitShiftLeft2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecBitShiftLeft2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecBitShiftRight2*s
 //	Calculate bit shift right of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec2 ijkVecBitShiftRight2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl uvec2 ijkVecBitShiftRight2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecEqual2*s
 //	Equality comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecEqual2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl bvec2 ijkVecEqual2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecInequal2*s
 //	Inequality comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecInequal2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl bvec2 ijkVecInequal2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecLessEqual2*s
 //	Less-than or equal comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecLessEqual2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl bvec2 ijkVecLessEqual2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecGreaterEqual2*s
 //	Greater-than or equal comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecLess2*s
 //	Less-than comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecLess2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl bvec2 ijkVecLess2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecGreater2*s
 //	Greater-than comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecGreater2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl bvec2 ijkVecGreater2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecAnd2*s
 //	Component-wise logical 'and' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecAnd2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl bvec2 ijkVecAnd2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecNand2*s
 //	Component-wise logical 'nand' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecNand2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl bvec2 ijkVecNand2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecOr2*s
 //	Component-wise logical 'or' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecOr2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl bvec2 ijkVecOr2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecNor2*s
 //	Component-wise logical 'nor' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecNor2us(uvec2 const v_lh, uint const s_rh);
+ijk_inl bvec2 ijkVecNor2us(uvec2 const v_lh, uint const s_rh);
 
 // ijkVecAdd2s*
 //	Calculate sum of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecAdd2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecAdd2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecSub2s*
 //	Calculate difference of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecSub2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecSub2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecMul2s*
 //	Calculate product of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecMul2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecMul2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecDiv2s*
 //	Calculate quotient of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecDiv2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecDiv2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecDivSafe2s*
 //	Calculate quotient of scalar by 2D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecDivSafe2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecDivSafe2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecMod2s*
 //	Calculate remainder of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecMod2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecMod2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecModSafe2s*
 //	Calculate remainder of scalar by 2D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecModSafe2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecModSafe2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecBitAnd2s*
 //	Calculate bitwise 'and' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitAnd2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitAnd2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecBitNand2s*
 //	Calculate bitwise 'not and' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitNand2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitNand2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecBitOr2s*
 //	Calculate bitwise 'or' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitOr2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitOr2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecBitNor2s*
 //	Calculate bitwise 'not or' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitNor2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitNor2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecBitXor2s*
 //	Calculate bitwise 'exclusive or' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitXor2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitXor2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecBitXnor2s*
 //	Calculate bitwise 'not exclusive or' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitXnor2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitXnor2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecBitShiftLeft2s*
 //	Calculate bit shift left of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitShiftLeft2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitShiftLeft2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecBitShiftRight2s*
 //	Calculate bit shift right of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec2 ijkVecBitShiftRight2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl uvec2 ijkVecBitShiftRight2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecEqual2s*
 //	Equality comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecEqual2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecEqual2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecInequal2s*
 //	Inequality comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecInequal2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecInequal2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecLessEqual2s*
 //	Less-than or equal comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLessEqual2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecLessEqual2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecGreaterEqual2s*
 //	Greater-than or equal comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecLess2s*
 //	Less-than comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLess2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecLess2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecGreater2s*
 //	Greater-than comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreater2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreater2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecAnd2s*
 //	Component-wise logical 'and' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecAnd2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecAnd2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecNand2s*
 //	Component-wise logical 'nand' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNand2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecNand2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecOr2s*
 //	Component-wise logical 'or' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecOr2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecOr2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecNor2s*
 //	Component-wise logical 'nor' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNor2su(uint const s_lh, uvec2 const v_rh);
+ijk_inl bvec2 ijkVecNor2su(uint const s_lh, uvec2 const v_rh);
 
 // ijkVecDot2*
 //	Dot product of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-uint ijkVecDot2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uint ijkVecDot2u(uvec2 const v_lh, uvec2 const v_rh);
 
 // ijkVecCross2*
 //	Cross product scalar of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar quantity of imaginary perpendicular axis
-uint ijkVecCross2u(uvec2 const v_lh, uvec2 const v_rh);
+ijk_inl uint ijkVecCross2u(uvec2 const v_lh, uvec2 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -2925,7 +2925,7 @@ uint ijkVecCross2u(uvec2 const v_lh, uvec2 const v_rh);
 // ijkVecInit3*
 //	Initialize 3D vector to default value (zero vector).
 //		return: default vector
-uvec3 ijkVecInit3u();
+ijk_inl uvec3 ijkVecInit3u();
 
 // ijkVecInitElems3*
 //	Initialize 3D vector to specified individual elements.
@@ -2933,608 +2933,608 @@ uvec3 ijkVecInit3u();
 //		param y: second element
 //		param z: third element
 //		return: result vector
-uvec3 ijkVecInitElems3u(uint const x, uint const y, uint const z);
+ijk_inl uvec3 ijkVecInitElems3u(uint const x, uint const y, uint const z);
 
 // ijkVecCopy3*
 //	Copy 3D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-uvec3 ijkVecCopy3u(uvec3 const v_in);
+ijk_inl uvec3 ijkVecCopy3u(uvec3 const v_in);
 
 // ijkVecNegate3*
 //	Negate 3D vector.
 //		param v_in: input vector
 //		return: result vector
-ivec3 ijkVecNegate3u(uvec3 const v_in);
+ijk_inl ivec3 ijkVecNegate3u(uvec3 const v_in);
 
 // ijkVecBitNot3*
 //	Calculate component-wise bitwise 'not' of 3D vector.
 //		param v_in: input vector
 //		return: result vector
-uvec3 ijkVecBitNot3u(uvec3 const v_in);
+ijk_inl uvec3 ijkVecBitNot3u(uvec3 const v_in);
 
 // ijkVecNot3*
 //	Calculate component-wise logical 'not' of 3D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec3 ijkVecNot3u(uvec3 const v_in);
+ijk_inl bvec3 ijkVecNot3u(uvec3 const v_in);
 
 // ijkVecAdd3*
 //	Calculate sum of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecAdd3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecAdd3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecSub3*
 //	Calculate difference of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecSub3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecSub3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecMul3*
 //	Calculate component-wise product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecMul3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecMul3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecDiv3*
 //	Calculate component-wise quotient of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecDiv3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecDiv3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecDivSafe3*
 //	Calculate component-wise quotient of 3D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecDivSafe3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecDivSafe3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecMod3*
 //	Calculate component-wise remainder of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecMod3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecMod3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecModSafe3*
 //	Calculate component-wise remainder of 3D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecModSafe3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecModSafe3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecBitAnd3*
 //	Calculate component-wise bitwise 'and' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitAnd3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitAnd3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecBitNand3*
 //	Calculate component-wise bitwise 'not and' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitNand3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitNand3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecBitOr3*
 //	Calculate component-wise bitwise 'or' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitOr3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitOr3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecBitNor3*
 //	Calculate component-wise bitwise 'not or' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitNor3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitNor3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecBitXor3*
 //	Calculate component-wise bitwise 'exclusive or' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitXor3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitXor3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecBitXnor3*
 //	Calculate component-wise bitwise 'not exclusive or' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitXnor3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitXnor3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecBitShiftLeft3*
 //	Calculate component-wise bit shift left of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitShiftLeft3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitShiftLeft3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecBitShiftRight3*
 //	Calculate component-wise bit shift right of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitShiftRight3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitShiftRight3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecEqual3*
 //	Equality comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecEqual3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecEqual3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecInequal3*
 //	Inequality comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecInequal3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecInequal3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecLessEqual3*
 //	Less-than or equal comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLessEqual3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecLessEqual3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecGreaterEqual3*
 //	Greater-than or equal comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecLess3*
 //	Less-than comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLess3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecLess3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecGreater3*
 //	Greater-than comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreater3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreater3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecAnd3*
 //	Component-wise logical 'and' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecAnd3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecAnd3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecNand3*
 //	Component-wise logical 'nand' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNand3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecNand3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecOr3*
 //	Component-wise logical 'or' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecOr3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecOr3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecNor3*
 //	Component-wise logical 'nor' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNor3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecNor3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecCopy3*z
 //	Copy 3D vector from 2D vector and one scalar.
 //		param v_xy: input 2D vector holding first two components
 //		param z: third element
 //		return: result vector
-uvec3 ijkVecCopy3uz(uvec2 const v_xy, uint const z);
+ijk_inl uvec3 ijkVecCopy3uz(uvec2 const v_xy, uint const z);
 
 // ijkVecCopy3*s
 //	Copy 3D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-uvec3 ijkVecCopy3us(uint const s_in);
+ijk_inl uvec3 ijkVecCopy3us(uint const s_in);
 
 // ijkVecNegate3*s
 //	Negate scalar to 3D vector.
 //		param s_in: input scalar
 //		return: result vector
-ivec3 ijkVecNegate3us(uint const s_in);
+ijk_inl ivec3 ijkVecNegate3us(uint const s_in);
 
 // ijkVecBitNot3*s
 //	Calculate bitwise 'not' of 3D vector.
 //		param s_in: input scalar
 //		return: result vector
-uvec3 ijkVecBitNot3us(uint const s_in);
+ijk_inl uvec3 ijkVecBitNot3us(uint const s_in);
 
 // ijkVecNot3*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec3 ijkVecNot3us(uint const s_in);
+ijk_inl bvec3 ijkVecNot3us(uint const s_in);
 
 // ijkVecAdd3*s
 //	Calculate sum of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecAdd3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecAdd3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecSub3*s
 //	Calculate difference of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecSub3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecSub3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecMul3*s
 //	Calculate product of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecMul3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecMul3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecDiv3*s
 //	Calculate quotient of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecDiv3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecDiv3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecDivSafe3*s
 //	Calculate quotient of 3D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecDivSafe3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecDivSafe3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecMod3*s
 //	Calculate remainder of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecMod3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecMod3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecModSafe3*s
 //	Calculate remainder of 3D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecModSafe3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecModSafe3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecBitAnd3*s
 //	Calculate bitwise 'and' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecBitAnd3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecBitAnd3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecBitNand3*s
 //	Calculate bitwise 'not and' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecBitNand3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecBitNand3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecBitOr3*s
 //	Calculate bitwise 'or' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecBitOr3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecBitOr3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecBitNor3*s
 //	Calculate bitwise 'not or' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecBitNor3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecBitNor3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecBitXor3*s
 //	Calculate bitwise 'exclusive or' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecBitXor3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecBitXor3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecBitXnor3*s
 //	Calculate bitwise 'not exclusive or' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecBitXnor3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecBitXnor3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecBitShiftLeft3*s
 //	Calculate bit shift left of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecBitShiftLeft3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecBitShiftLeft3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecBitShiftRight3*s
 //	Calculate bit shift right of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec3 ijkVecBitShiftRight3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl uvec3 ijkVecBitShiftRight3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecEqual3*s
 //	Equality comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecEqual3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl bvec3 ijkVecEqual3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecInequal3*s
 //	Inequality comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecInequal3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl bvec3 ijkVecInequal3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecLessEqual3*s
 //	Less-than or equal comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecLessEqual3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl bvec3 ijkVecLessEqual3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecGreaterEqual3*s
 //	Greater-than or equal comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecLess3*s
 //	Less-than comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecLess3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl bvec3 ijkVecLess3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecGreater3*s
 //	Greater-than comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecGreater3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl bvec3 ijkVecGreater3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecAnd3*s
 //	Component-wise logical 'and' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecAnd3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl bvec3 ijkVecAnd3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecNand3*s
 //	Component-wise logical 'nand' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecNand3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl bvec3 ijkVecNand3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecOr3*s
 //	Component-wise logical 'or' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecOr3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl bvec3 ijkVecOr3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecNor3*s
 //	Component-wise logical 'nor' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecNor3us(uvec3 const v_lh, uint const s_rh);
+ijk_inl bvec3 ijkVecNor3us(uvec3 const v_lh, uint const s_rh);
 
 // ijkVecCopy3x*
 //	Copy 3D vector from 2D vector and one scalar.
 //		param x: first element
 //		param v_yz: input 2D vector holding last two components
 //		return: result vector
-uvec3 ijkVecCopy3xu(uint const x, uvec2 const v_yz);
+ijk_inl uvec3 ijkVecCopy3xu(uint const x, uvec2 const v_yz);
 
 // ijkVecAdd3s*
 //	Calculate sum of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecAdd3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecAdd3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecSub3s*
 //	Calculate difference of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecSub3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecSub3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecMul3s*
 //	Calculate product of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecMul3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecMul3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecDiv3s*
 //	Calculate quotient of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecDiv3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecDiv3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecDivSafe3s*
 //	Calculate quotient of scalar by 3D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecDivSafe3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecDivSafe3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecMod3s*
 //	Calculate remainder of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecMod3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecMod3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecModSafe3s*
 //	Calculate remainder of scalar by 3D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecModSafe3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecModSafe3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecBitAnd3s*
 //	Calculate bitwise 'and' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitAnd3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitAnd3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecBitNand3s*
 //	Calculate bitwise 'not and' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitNand3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitNand3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecBitOr3s*
 //	Calculate bitwise 'or' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitOr3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitOr3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecBitNor3s*
 //	Calculate bitwise 'not or' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitNor3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitNor3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecBitXor3s*
 //	Calculate bitwise 'exclusive or' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitXor3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitXor3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecBitXnor3s*
 //	Calculate bitwise 'not exclusive or' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitXnor3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitXnor3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecBitShiftLeft3s*
 //	Calculate bit shift left of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitShiftLeft3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitShiftLeft3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecBitShiftRight3s*
 //	Calculate bit shift right of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec3 ijkVecBitShiftRight3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecBitShiftRight3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecEqual3s*
 //	Equality comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecEqual3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecEqual3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecInequal3s*
 //	Inequality comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecInequal3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecInequal3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecLessEqual3s*
 //	Less-than or equal comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLessEqual3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecLessEqual3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecGreaterEqual3s*
 //	Greater-than or equal comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecLess3s*
 //	Less-than comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLess3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecLess3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecGreater3s*
 //	Greater-than comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreater3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreater3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecAnd3s*
 //	Component-wise logical 'and' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecAnd3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecAnd3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecNand3s*
 //	Component-wise logical 'nand' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNand3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecNand3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecOr3s*
 //	Component-wise logical 'or' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecOr3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecOr3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecNor3s*
 //	Component-wise logical 'nor' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNor3su(uint const s_lh, uvec3 const v_rh);
+ijk_inl bvec3 ijkVecNor3su(uint const s_lh, uvec3 const v_rh);
 
 // ijkVecDot3*
 //	Dot product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-uint ijkVecDot3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uint ijkVecDot3u(uvec3 const v_lh, uvec3 const v_rh);
 
 // ijkVecCross3*
 //	Cross product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: cross product
-uvec3 ijkVecCross3u(uvec3 const v_lh, uvec3 const v_rh);
+ijk_inl uvec3 ijkVecCross3u(uvec3 const v_lh, uvec3 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -3542,7 +3542,7 @@ uvec3 ijkVecCross3u(uvec3 const v_lh, uvec3 const v_rh);
 // ijkVecInit4*
 //	Initialize 4D vector to default value (zero vector).
 //		return: default vector
-uvec4 ijkVecInit4u();
+ijk_inl uvec4 ijkVecInit4u();
 
 // ijkVecInitElems4*
 //	Initialize 4D vector to specified individual elements.
@@ -3551,7 +3551,7 @@ uvec4 ijkVecInit4u();
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: result vector
-uvec4 ijkVecInitElems4u(uint const x, uint const y, uint const z, uint const w);
+ijk_inl uvec4 ijkVecInitElems4u(uint const x, uint const y, uint const z, uint const w);
 
 // ijkVecCopy4x*w
 //	Copy 4D vector from scalar, 2D vector and another scalar.
@@ -3559,213 +3559,213 @@ uvec4 ijkVecInitElems4u(uint const x, uint const y, uint const z, uint const w);
 //		param v_yz: input 2D vector holding middle two components
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: result vector
-uvec4 ijkVecCopy4xuw(uint const x, uvec2 const v_yz, uint const w);
+ijk_inl uvec4 ijkVecCopy4xuw(uint const x, uvec2 const v_yz, uint const w);
 
 // ijkVecCopy4*2
 //	Copy 4D vector from two 2D vectors.
 //		param v_xy: input 2D vector holding first two components
 //		param v_zw: input 2D vector holding last two components
 //		return: result vector
-uvec4 ijkVecCopy4u2(uvec2 const v_xy, uvec2 const v_zw);
+ijk_inl uvec4 ijkVecCopy4u2(uvec2 const v_xy, uvec2 const v_zw);
 
 // ijkVecCopy4*
 //	Copy 4D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-uvec4 ijkVecCopy4u(uvec4 const v_in);
+ijk_inl uvec4 ijkVecCopy4u(uvec4 const v_in);
 
 // ijkVecNegate4*
 //	Negate 4D vector.
 //		param v_in: input vector
 //		return: result vector
-ivec4 ijkVecNegate4u(uvec4 const v_in);
+ijk_inl ivec4 ijkVecNegate4u(uvec4 const v_in);
 
 // ijkVecBitNot4*
 //	Calculate component-wise bitwise 'not' of 4D vector.
 //		param v_in: input vector
 //		return: result vector
-uvec4 ijkVecBitNot4u(uvec4 const v_in);
+ijk_inl uvec4 ijkVecBitNot4u(uvec4 const v_in);
 
 // ijkVecNot4*
 //	Calculate component-wise logical 'not' of 4D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec4 ijkVecNot4u(uvec4 const v_in);
+ijk_inl bvec4 ijkVecNot4u(uvec4 const v_in);
 
 // ijkVecAdd4*
 //	Calculate sum of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecAdd4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecAdd4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecSub4*
 //	Calculate difference of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecSub4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecSub4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecMul4*
 //	Calculate component-wise product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecMul4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecMul4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecDiv4*
 //	Calculate component-wise quotient of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecDiv4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecDiv4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecDivSafe4*
 //	Calculate component-wise quotient of 4D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecDivSafe4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecDivSafe4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecMod4*
 //	Calculate component-wise remainder of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecMod4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecMod4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecModSafe4*
 //	Calculate component-wise remainder of 4D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecModSafe4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecModSafe4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecBitAnd4*
 //	Calculate component-wise bitwise 'and' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitAnd4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitAnd4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecBitNand4*
 //	Calculate component-wise bitwise 'not and' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitNand4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitNand4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecBitOr4*
 //	Calculate component-wise bitwise 'or' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitOr4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitOr4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecBitNor4*
 //	Calculate component-wise bitwise 'not or' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitNor4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitNor4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecBitXor4*
 //	Calculate component-wise bitwise 'exclusive or' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitXor4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitXor4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecBitXnor4*
 //	Calculate component-wise bitwise 'not exclusive or' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitXnor4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitXnor4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecBitShiftLeft4*
 //	Calculate component-wise bit shift left of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitShiftLeft4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitShiftLeft4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecBitShiftRight4*
 //	Calculate component-wise bit shift right of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitShiftRight4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitShiftRight4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecEqual4*
 //	Equality comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecEqual4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecEqual4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecInequal4*
 //	Inequality comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecInequal4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecInequal4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecLessEqual4*
 //	Less-than or equal comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLessEqual4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecLessEqual4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecGreaterEqual4*
 //	Greater-than or equal comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecLess4*
 //	Less-than comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLess4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecLess4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecGreater4*
 //	Greater-than comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreater4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreater4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecAnd4*
 //	Component-wise logical 'and' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecAnd4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecAnd4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecNand4*
 //	Component-wise logical 'nand' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNand4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecNand4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecOr4*
 //	Component-wise logical 'or' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecOr4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecOr4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecNor4*
 //	Component-wise logical 'nor' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNor4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecNor4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecCopy4*zw
 //	Copy 4D vector from 2D vector and two scalars.
@@ -3773,213 +3773,213 @@ bvec4 ijkVecNor4u(uvec4 const v_lh, uvec4 const v_rh);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: result vector
-uvec4 ijkVecCopy4uzw(uvec2 const v_xy, uint const z, uint const w);
+ijk_inl uvec4 ijkVecCopy4uzw(uvec2 const v_xy, uint const z, uint const w);
 
 // ijkVecCopy4*w
 //	Copy 4D vector from 3D vector and one scalar.
 //		param v_xyz: input 3D vector holding first three components
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: result vector
-uvec4 ijkVecCopy4uw(uvec3 const v_xyz, uint const w);
+ijk_inl uvec4 ijkVecCopy4uw(uvec3 const v_xyz, uint const w);
 
 // ijkVecCopy4*s
 //	Copy 4D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-uvec4 ijkVecCopy4us(uint const s_in);
+ijk_inl uvec4 ijkVecCopy4us(uint const s_in);
 
 // ijkVecNegate4*s
 //	Negate scalar to 4D vector.
 //		param s_in: input scalar
 //		return: result vector
-ivec4 ijkVecNegate4us(uint const s_in);
+ijk_inl ivec4 ijkVecNegate4us(uint const s_in);
 
 // ijkVecBitNot4*s
 //	Calculate bitwise 'not' of 4D vector.
 //		param s_in: input scalar
 //		return: result vector
-uvec4 ijkVecBitNot4us(uint const s_in);
+ijk_inl uvec4 ijkVecBitNot4us(uint const s_in);
 
 // ijkVecNot4*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec4 ijkVecNot4us(uint const s_in);
+ijk_inl bvec4 ijkVecNot4us(uint const s_in);
 
 // ijkVecAdd4*s
 //	Calculate sum of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecAdd4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecAdd4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecSub4*s
 //	Calculate difference of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecSub4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecSub4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecMul4*s
 //	Calculate product of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecMul4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecMul4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecDiv4*s
 //	Calculate quotient of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecDiv4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecDiv4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecDivSafe4*s
 //	Calculate quotient of 4D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecDivSafe4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecDivSafe4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecMod4*s
 //	Calculate remainder of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecMod4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecMod4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecModSafe4*s
 //	Calculate remainder of 4D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecModSafe4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecModSafe4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecBitAnd4*s
 //	Calculate bitwise 'and' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecBitAnd4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecBitAnd4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecBitNand4*s
 //	Calculate bitwise 'not and' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecBitNand4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecBitNand4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecBitOr4*s
 //	Calculate bitwise 'or' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecBitOr4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecBitOr4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecBitNor4*s
 //	Calculate bitwise 'not or' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecBitNor4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecBitNor4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecBitXor4*s
 //	Calculate bitwise 'exclusive or' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecBitXor4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecBitXor4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecBitXnor4*s
 //	Calculate bitwise 'not exclusive or' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecBitXnor4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecBitXnor4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecBitShiftLeft4*s
 //	Calculate bit shift left of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecBitShiftLeft4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecBitShiftLeft4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecBitShiftRight4*s
 //	Calculate bit shift right of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-uvec4 ijkVecBitShiftRight4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl uvec4 ijkVecBitShiftRight4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecEqual4*s
 //	Equality comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecEqual4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl bvec4 ijkVecEqual4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecInequal4*s
 //	Inequality comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecInequal4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl bvec4 ijkVecInequal4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecLessEqual4*s
 //	Less-than or equal comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecLessEqual4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl bvec4 ijkVecLessEqual4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecGreaterEqual4*s
 //	Greater-than or equal comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecLess4*s
 //	Less-than comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecLess4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl bvec4 ijkVecLess4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecGreater4*s
 //	Greater-than comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecGreater4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl bvec4 ijkVecGreater4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecAnd4*s
 //	Component-wise logical 'and' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecAnd4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl bvec4 ijkVecAnd4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecNand4*s
 //	Component-wise logical 'nand' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecNand4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl bvec4 ijkVecNand4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecOr4*s
 //	Component-wise logical 'or' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecOr4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl bvec4 ijkVecOr4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecNor4*s
 //	Component-wise logical 'nor' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecNor4us(uvec4 const v_lh, uint const s_rh);
+ijk_inl bvec4 ijkVecNor4us(uvec4 const v_lh, uint const s_rh);
 
 // ijkVecCopy4xy*
 //	Copy 4D vector from two scalars and 2D vector.
@@ -3987,203 +3987,203 @@ bvec4 ijkVecNor4us(uvec4 const v_lh, uint const s_rh);
 //		param y: second element
 //		param v_zw: input 2D vector holding last two components
 //		return: result vector
-uvec4 ijkVecCopy4xyu(uint const x, uint const y, uvec2 const v_zw);
+ijk_inl uvec4 ijkVecCopy4xyu(uint const x, uint const y, uvec2 const v_zw);
 
 // ijkVecCopy4x*
 //	Copy 4D vector from one scalar and 3D vector.
 //		param x: first element
 //		param v_yzw: input 3D vector holding last three components
 //		return: result vector
-uvec4 ijkVecCopy4xu(uint const x, uvec3 const v_yzw);
+ijk_inl uvec4 ijkVecCopy4xu(uint const x, uvec3 const v_yzw);
 
 // ijkVecAdd4s*
 //	Calculate sum of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecAdd4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecAdd4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecSub4s*
 //	Calculate difference of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecSub4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecSub4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecMul4s*
 //	Calculate product of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecMul4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecMul4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecDiv4s*
 //	Calculate quotient of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecDiv4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecDiv4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecDivSafe4s*
 //	Calculate quotient of scalar by 4D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecDivSafe4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecDivSafe4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecMod4s*
 //	Calculate remainder of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecMod4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecMod4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecModSafe4s*
 //	Calculate remainder of scalar by 4D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecModSafe4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecModSafe4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecBitAnd4s*
 //	Calculate bitwise 'and' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitAnd4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitAnd4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecBitNand4s*
 //	Calculate bitwise 'not and' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitNand4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitNand4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecBitOr4s*
 //	Calculate bitwise 'or' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitOr4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitOr4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecBitNor4s*
 //	Calculate bitwise 'not or' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitNor4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitNor4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecBitXor4s*
 //	Calculate bitwise 'exclusive or' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitXor4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitXor4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecBitXnor4s*
 //	Calculate bitwise 'not exclusive or' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitXnor4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitXnor4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecBitShiftLeft4s*
 //	Calculate bit shift left of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitShiftLeft4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitShiftLeft4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecBitShiftRight4s*
 //	Calculate bit shift right of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-uvec4 ijkVecBitShiftRight4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecBitShiftRight4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecEqual4s*
 //	Equality comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecEqual4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecEqual4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecInequal4s*
 //	Inequality comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecInequal4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecInequal4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecLessEqual4s*
 //	Less-than or equal comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLessEqual4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecLessEqual4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecGreaterEqual4s*
 //	Greater-than or equal comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecLess4s*
 //	Less-than comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLess4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecLess4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecGreater4s*
 //	Greater-than comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreater4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreater4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecAnd4s*
 //	Component-wise logical 'and' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecAnd4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecAnd4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecNand4s*
 //	Component-wise logical 'nand' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNand4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecNand4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecOr4s*
 //	Component-wise logical 'or' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecOr4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecOr4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecNor4s*
 //	Component-wise logical 'nor' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNor4su(uint const s_lh, uvec4 const v_rh);
+ijk_inl bvec4 ijkVecNor4su(uint const s_lh, uvec4 const v_rh);
 
 // ijkVecDot4*
 //	Dot product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-uint ijkVecDot4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uint ijkVecDot4u(uvec4 const v_lh, uvec4 const v_rh);
 
 // ijkVecCross4*
 //	Cross product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: cross product (fourth component is zero)
-uvec4 ijkVecCross4u(uvec4 const v_lh, uvec4 const v_rh);
+ijk_inl uvec4 ijkVecCross4u(uvec4 const v_lh, uvec4 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -38,50 +38,50 @@ extern "C" {
 //	Absolute value of scalar: (s >= 0 ? +s : -s).
 //		param s: scalar
 //		return: absolute value
-ui64 ijkVecAbs1uls(ui64 const s);
+ijk_inl ui64 ijkVecAbs1uls(ui64 const s);
 
 // ijkVecSgn1*s
 //	Sign of scalar: (s != 0 ? s > 0 ? +1 : -1).
 //		param s: scalar
 //		return: sign
-ui64 ijkVecSgn1uls(ui64 const s);
+ijk_inl ui64 ijkVecSgn1uls(ui64 const s);
 
 // ijkVecDot1*s
 //	Dot product of scalars, which is just their product.
 //		param s_lh: left-hand scalar
 //		param s_rh: right-hand scalar
 //		return: product
-ui64 ijkVecDot1uls(ui64 const s_lh, ui64 const s_rh);
+ijk_inl ui64 ijkVecDot1uls(ui64 const s_lh, ui64 const s_rh);
 
 // ijkVecLengthSq1*s
 //	Squared length of scalar.
 //		param s: scalar
 //		return: squared length
-ui64 ijkVecLengthSq1uls(ui64 const s);
+ijk_inl ui64 ijkVecLengthSq1uls(ui64 const s);
 
 // ijkVecLength1*s
 //	Length of scalar.
 //		param s: scalar
 //		return: length
-ui64 ijkVecLength1uls(ui64 const s);
+ijk_inl ui64 ijkVecLength1uls(ui64 const s);
 
 // ijkVecLengthSqInv1*s
 //	Inverse squared length of scalar.
 //		param s: scalar
 //		return: inverse squared length
-f64 ijkVecLengthSqInv1uls(ui64 const s);
+ijk_inl f64 ijkVecLengthSqInv1uls(ui64 const s);
 
 // ijkVecLengthSqInv1*s
 //	Inverse length of scalar.
 //		param s: scalar
 //		return: inverse length
-f64 ijkVecLengthInv1uls(ui64 const s);
+ijk_inl f64 ijkVecLengthInv1uls(ui64 const s);
 
 // ijkVecNormalize1*s
 //	Calculate unit scalar in same direction as input (sign).
 //		param s: scalar
 //		return: unit scalar (sign)
-ui64 ijkVecNormalize1uls(ui64 const s);
+ijk_inl ui64 ijkVecNormalize1uls(ui64 const s);
 
 // ijkVecNormalizeGetLength1*s
 //	Calculate unit scalar in same direction as input (sign).
@@ -89,7 +89,7 @@ ui64 ijkVecNormalize1uls(ui64 const s);
 //		param s: scalar
 //		param length_out: pointer to length storage
 //		return: unit scalar (sign)
-ui64 ijkVecNormalizeGetLength1uls(ui64 const s, ui64* const length_out);
+ijk_inl ui64 ijkVecNormalizeGetLength1uls(ui64 const s, ui64* const length_out);
 
 // ijkVecNormalizeGetLengthInv1*s
 //	Calculate unit scalar in same direction as input (sign).
@@ -97,7 +97,7 @@ ui64 ijkVecNormalizeGetLength1uls(ui64 const s, ui64* const length_out);
 //		param s: scalar
 //		param lengthInv_out: pointer to length storage
 //		return: unit scalar (sign)
-ui64 ijkVecNormalizeGetLengthInv1uls(ui64 const s, f64* const lengthInv_out);
+ijk_inl ui64 ijkVecNormalizeGetLengthInv1uls(ui64 const s, f64* const lengthInv_out);
 
 
 //-----------------------------------------------------------------------------
@@ -106,7 +106,7 @@ ui64 ijkVecNormalizeGetLengthInv1uls(ui64 const s, f64* const lengthInv_out);
 //	Pass-thru array-based vector function (does nothing).
 //		param v_out: output vector
 //		return: v_out
-uintlv ijkVecPulv(uintlv v_out);
+ijk_inl uintlv ijkVecPulv(uintlv v_out);
 
 
 //-----------------------------------------------------------------------------
@@ -115,7 +115,7 @@ uintlv ijkVecPulv(uintlv v_out);
 //	Initialize 2D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-uintlv ijkVecInit2ulv(uintl2 v_out);
+ijk_inl uintlv ijkVecInit2ulv(uintl2 v_out);
 
 // ijkVecInitElems2*v
 //	Initialize 2D vector to specified individual elements.
@@ -123,35 +123,35 @@ uintlv ijkVecInit2ulv(uintl2 v_out);
 //		param x: first element
 //		param y: second element
 //		return: v_out
-uintlv ijkVecInitElems2ulv(uintl2 v_out, ui64 const x, ui64 const y);
+ijk_inl uintlv ijkVecInitElems2ulv(uintl2 v_out, ui64 const x, ui64 const y);
 
 // ijkVecCopy2*v
 //	Copy 2D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-uintlv ijkVecCopy2ulv(uintl2 v_out, uintl2 const v_in);
+ijk_inl uintlv ijkVecCopy2ulv(uintl2 v_out, uintl2 const v_in);
 
 // ijkVecNegate2*v
 //	Negate 2D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-intlv ijkVecNegate2ulv(intl2 v_out, uintl2 const v_in);
+ijk_inl intlv ijkVecNegate2ulv(intl2 v_out, uintl2 const v_in);
 
 // ijkVecBitNot2*v
 //	Calculate component-wise bitwise 'not' of 2D vector.
 //		param v_out: output vector to hold component-wise bitwise 'not'
 //		param v_in: input vector
 //		return: v_out
-uintlv ijkVecBitNot2ulv(uintl2 v_out, uintl2 const v_in);
+ijk_inl uintlv ijkVecBitNot2ulv(uintl2 v_out, uintl2 const v_in);
 
 // ijkVecNot2*v
 //	Calculate component-wise logical 'not' of 2D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot2ulv(bool2 bv_out, uintl2 const v_in);
+ijk_inl boolv ijkVecNot2ulv(bool2 bv_out, uintl2 const v_in);
 
 // ijkVecAdd2*v
 //	Calculate sum of 2D vectors.
@@ -159,7 +159,7 @@ boolv ijkVecNot2ulv(bool2 bv_out, uintl2 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecAdd2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecAdd2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecSub2*v
 //	Calculate difference of 2D vectors.
@@ -167,7 +167,7 @@ uintlv ijkVecAdd2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecSub2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecSub2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecMul2*v
 //	Calculate component-wise product of 2D vectors.
@@ -175,7 +175,7 @@ uintlv ijkVecSub2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecMul2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecMul2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecDiv2*v
 //	Calculate component-wise quotient of 2D vectors.
@@ -183,7 +183,7 @@ uintlv ijkVecMul2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecDiv2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecDiv2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecDivSafe2*v
 //	Calculate component-wise quotient of 2D vectors, division-by-zero safe.
@@ -191,7 +191,7 @@ uintlv ijkVecDiv2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecDivSafe2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecDivSafe2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecMod2*v
 //	Calculate component-wise remainder of 2D vectors.
@@ -199,7 +199,7 @@ uintlv ijkVecDivSafe2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecMod2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecMod2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecModSafe2*v
 //	Calculate component-wise remainder of 2D vectors, division-by-zero safe.
@@ -207,7 +207,7 @@ uintlv ijkVecMod2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecModSafe2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecModSafe2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecBitAnd2*v
 //	Calculate component-wise bitwise 'and' of 2D vectors.
@@ -215,7 +215,7 @@ uintlv ijkVecModSafe2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitAnd2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitAnd2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecBitNand2*v
 //	Calculate component-wise bitwise 'not and' of 2D vectors.
@@ -223,7 +223,7 @@ uintlv ijkVecBitAnd2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitNand2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitNand2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecBitOr2*v
 //	Calculate component-wise bitwise 'or' of 2D vectors.
@@ -231,7 +231,7 @@ uintlv ijkVecBitNand2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitOr2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitOr2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecBitNor2*v
 //	Calculate component-wise bitwise 'not or' of 2D vectors.
@@ -239,7 +239,7 @@ uintlv ijkVecBitOr2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitNor2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitNor2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecBitXor2*v
 //	Calculate component-wise bitwise 'exclusive or' of 2D vectors.
@@ -247,7 +247,7 @@ uintlv ijkVecBitNor2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitXor2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitXor2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecBitXnor2*v
 //	Calculate component-wise bitwise 'not exclusive or' of 2D vectors.
@@ -255,7 +255,7 @@ uintlv ijkVecBitXor2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitXnor2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitXnor2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecBitShiftLeft2*v
 //	Calculate component-wise bit shift left of 2D vectors.
@@ -263,7 +263,7 @@ uintlv ijkVecBitXnor2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitShiftLeft2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitShiftLeft2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecBitShiftRight2*v
 //	Calculate component-wise bit shift right of 2D vectors.
@@ -271,7 +271,7 @@ uintlv ijkVecBitShiftLeft2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitShiftRight2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitShiftRight2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecEqual2*v
 //	Equality comparison for 2D vectors.
@@ -279,7 +279,7 @@ uintlv ijkVecBitShiftRight2ulv(uintl2 v_out, uintl2 const v_lh, uintl2 const v_r
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecEqual2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecInequal2*v
 //	Inequality comparison for 2D vectors.
@@ -287,7 +287,7 @@ boolv ijkVecEqual2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecInequal2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecLessEqual2*v
 //	Less-than or equal comparison for 2D vectors.
@@ -295,7 +295,7 @@ boolv ijkVecInequal2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecLessEqual2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecGreaterEqual2*v
 //	Greater-than or equal comparison for 2D vectors.
@@ -303,7 +303,7 @@ boolv ijkVecLessEqual2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecLess2*v
 //	Less-than comparison for 2D vectors.
@@ -311,7 +311,7 @@ boolv ijkVecGreaterEqual2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh)
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecLess2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecGreater2*v
 //	Greater-than comparison for 2D vectors.
@@ -319,7 +319,7 @@ boolv ijkVecLess2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecGreater2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecAnd2*v
 //	Component-wise logical 'and' of 2D vectors.
@@ -327,7 +327,7 @@ boolv ijkVecGreater2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecAnd2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecNand2*v
 //	Component-wise logical 'nand' of 2D vectors.
@@ -335,7 +335,7 @@ boolv ijkVecAnd2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecNand2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecOr2*v
 //	Component-wise logical 'or' of 2D vectors.
@@ -343,7 +343,7 @@ boolv ijkVecNand2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecOr2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecNor2*v
 //	Component-wise logical 'nor' of 2D vectors.
@@ -351,35 +351,35 @@ boolv ijkVecOr2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecNor2ulv(bool2 bv_out, uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecCopy2*vs
 //	Copy 2D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-uintlv ijkVecCopy2ulvs(uintl2 v_out, ui64 const s_in);
+ijk_inl uintlv ijkVecCopy2ulvs(uintl2 v_out, ui64 const s_in);
 
 // ijkVecNegate2*vs
 //	Negate scalar to 2D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-intlv ijkVecNegate2ulvs(intl2 v_out, ui64 const s_in);
+ijk_inl intlv ijkVecNegate2ulvs(intl2 v_out, ui64 const s_in);
 
 // ijkVecBitNot2*vs
 //	Calculate bitwise 'not' of 2D vector.
 //		param v_out: output vector to hold bitwise 'not'
 //		param s_in: input scalar
 //		return: v_out
-uintlv ijkVecBitNot2ulvs(uintl2 v_out, ui64 const s_in);
+ijk_inl uintlv ijkVecBitNot2ulvs(uintl2 v_out, ui64 const s_in);
 
 // ijkVecNot2*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot2ulvs(bool2 bv_out, ui64 const s_in);
+ijk_inl boolv ijkVecNot2ulvs(bool2 bv_out, ui64 const s_in);
 
 // ijkVecAdd2*vs
 //	Calculate sum of 2D vector components and scalar.
@@ -387,7 +387,7 @@ boolv ijkVecNot2ulvs(bool2 bv_out, ui64 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecAdd2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecAdd2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecSub2*vs
 //	Calculate difference of 2D vector components and scalar.
@@ -395,7 +395,7 @@ uintlv ijkVecAdd2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecSub2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecSub2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecMul2*vs
 //	Calculate product of 2D vector components by scalar.
@@ -403,7 +403,7 @@ uintlv ijkVecSub2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecMul2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecMul2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecDiv2*vs
 //	Calculate quotient of 2D vector components by scalar.
@@ -411,7 +411,7 @@ uintlv ijkVecMul2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecDiv2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecDiv2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecDivSafe2*vs
 //	Calculate quotient of 2D vector components by scalar, division-by-zero safe.
@@ -419,7 +419,7 @@ uintlv ijkVecDiv2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecDivSafe2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecDivSafe2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecMod2*vs
 //	Calculate remainder of 2D vector components by scalar.
@@ -427,7 +427,7 @@ uintlv ijkVecDivSafe2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecMod2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecMod2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecModSafe2*vs
 //	Calculate remainder of 2D vector components by scalar, division-by-zero safe.
@@ -435,7 +435,7 @@ uintlv ijkVecMod2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecModSafe2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecModSafe2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecBitAnd2*vs
 //	Calculate bitwise 'and' of 2D vector components and scalar.
@@ -443,7 +443,7 @@ uintlv ijkVecModSafe2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitAnd2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitAnd2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecBitNand2*vs
 //	Calculate bitwise 'not and' of 2D vector components and scalar.
@@ -451,7 +451,7 @@ uintlv ijkVecBitAnd2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitNand2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitNand2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecBitOr2*vs
 //	Calculate bitwise 'or' of 2D vector components and scalar.
@@ -459,7 +459,7 @@ uintlv ijkVecBitNand2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitOr2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitOr2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecBitNor2*vs
 //	Calculate bitwise 'not or' of 2D vector components and scalar.
@@ -467,7 +467,7 @@ uintlv ijkVecBitOr2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitNor2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitNor2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecBitXor2*vs
 //	Calculate bitwise 'exclusive or' of 2D vector components and scalar.
@@ -475,7 +475,7 @@ uintlv ijkVecBitNor2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitXor2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitXor2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecBitXnor2*vs
 //	Calculate bitwise 'not exclusive or' of 2D vector components and scalar.
@@ -483,7 +483,7 @@ uintlv ijkVecBitXor2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitXnor2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitXnor2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecBitShiftLeft2*vs
 //	Calculate bit shift left of 2D vector components and scalar.
@@ -491,7 +491,7 @@ uintlv ijkVecBitXnor2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitShiftLeft2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitShiftLeft2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecBitShiftRight2*vs
 //	Calculate bit shift right of 2D vector components and scalar.
@@ -499,7 +499,7 @@ uintlv ijkVecBitShiftLeft2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh)
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitShiftRight2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitShiftRight2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecEqual2*vs
 //	Equality comparison of 2D vector components and scalar.
@@ -507,7 +507,7 @@ uintlv ijkVecBitShiftRight2ulvs(uintl2 v_out, uintl2 const v_lh, ui64 const s_rh
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecEqual2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecInequal2*vs
 //	Inequality comparison of 2D vector components and scalar.
@@ -515,7 +515,7 @@ boolv ijkVecEqual2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecInequal2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecLessEqual2*vs
 //	Less-than or equal comparison of 2D vector components and scalar.
@@ -523,7 +523,7 @@ boolv ijkVecInequal2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecLessEqual2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecGreaterEqual2*vs
 //	Greater-than or equal comparison of 2D vector components and scalar.
@@ -531,7 +531,7 @@ boolv ijkVecLessEqual2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecLess2*vs
 //	Less-than comparison of 2D vector components and scalar.
@@ -539,7 +539,7 @@ boolv ijkVecGreaterEqual2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecLess2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecGreater2*vs
 //	Greater-than comparison of 2D vector components and scalar.
@@ -547,7 +547,7 @@ boolv ijkVecLess2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecGreater2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecAnd2*vs
 //	Component-wise logical 'and' of 2D vector and scalar.
@@ -555,7 +555,7 @@ boolv ijkVecGreater2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecAnd2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecNand2*vs
 //	Component-wise logical 'nand' of 2D vector and scalar.
@@ -563,7 +563,7 @@ boolv ijkVecAnd2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecNand2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecOr2*vs
 //	Component-wise logical 'or' of 2D vector and scalar.
@@ -571,7 +571,7 @@ boolv ijkVecNand2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecOr2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecNor2*vs
 //	Component-wise logical 'nor' of 2D vector and scalar.
@@ -579,7 +579,7 @@ boolv ijkVecOr2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecNor2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 
 // ijkVecAdd2*sv
 //	Calculate sum of scalar and 2D vector components.
@@ -587,7 +587,7 @@ boolv ijkVecNor2ulvs(bool2 bv_out, uintl2 const v_lh, ui64 const s_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecAdd2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecAdd2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecSub2*sv
 //	Calculate difference of scalar and 2D vector components.
@@ -595,7 +595,7 @@ uintlv ijkVecAdd2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecSub2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecSub2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecMul2*sv
 //	Calculate product of scalar by 2D vector components.
@@ -603,7 +603,7 @@ uintlv ijkVecSub2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecMul2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecMul2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecDiv2*sv
 //	Calculate quotient of scalar by 2D vector components.
@@ -611,7 +611,7 @@ uintlv ijkVecMul2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecDiv2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecDiv2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecDivSafe2*sv
 //	Calculate quotient of scalar by 2D vector components, division-by-zero safe.
@@ -619,7 +619,7 @@ uintlv ijkVecDiv2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecDivSafe2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecDivSafe2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecMod2*sv
 //	Calculate remainder of scalar by 2D vector components.
@@ -627,7 +627,7 @@ uintlv ijkVecDivSafe2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecMod2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecMod2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecModSafe2*sv
 //	Calculate remainder of scalar by 2D vector components, division-by-zero safe.
@@ -635,7 +635,7 @@ uintlv ijkVecMod2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecModSafe2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecModSafe2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecBitAnd2*sv
 //	Calculate bitwise 'and' of scalar and 2D vector components.
@@ -643,7 +643,7 @@ uintlv ijkVecModSafe2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitAnd2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitAnd2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecBitNand2*sv
 //	Calculate bitwise 'not and' of scalar and 2D vector components.
@@ -651,7 +651,7 @@ uintlv ijkVecBitAnd2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitNand2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitNand2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecBitOr2*sv
 //	Calculate bitwise 'or' of scalar and 2D vector components.
@@ -659,7 +659,7 @@ uintlv ijkVecBitNand2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitOr2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitOr2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecBitNor2*sv
 //	Calculate bitwise 'not or' of scalar and 2D vector components.
@@ -667,7 +667,7 @@ uintlv ijkVecBitOr2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitNor2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitNor2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecBitXor2*sv
 //	Calculate bitwise 'exclusive or' of scalar and 2D vector components.
@@ -675,7 +675,7 @@ uintlv ijkVecBitNor2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitXor2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitXor2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecBitXnor2*sv
 //	Calculate bitwise 'not exclusive or' of scalar and 2D vector components.
@@ -683,7 +683,7 @@ uintlv ijkVecBitXor2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitXnor2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitXnor2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecBitShiftLeft2*sv
 //	Calculate bit shift left of scalar by 2D vector components.
@@ -691,7 +691,7 @@ uintlv ijkVecBitXnor2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitShiftLeft2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitShiftLeft2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecBitShiftRight2*sv
 //	Calculate bit shift right of scalar by 2D vector components.
@@ -699,7 +699,7 @@ uintlv ijkVecBitShiftLeft2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh)
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitShiftRight2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl uintlv ijkVecBitShiftRight2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecEqual2*sv
 //	Equality comparison of scalar and 2D vector components.
@@ -707,7 +707,7 @@ uintlv ijkVecBitShiftRight2ulsv(uintl2 v_out, ui64 const s_lh, uintl2 const v_rh
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecEqual2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecInequal2*sv
 //	Inequality comparison of scalar and 2D vector components.
@@ -715,7 +715,7 @@ boolv ijkVecEqual2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecInequal2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecLessEqual2*sv
 //	Less-than or equal comparison of scalar and 2D vector components.
@@ -723,7 +723,7 @@ boolv ijkVecInequal2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecLessEqual2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecGreaterEqual2*sv
 //	Greater-than or equal comparison of scalar and 2D vector components.
@@ -731,7 +731,7 @@ boolv ijkVecLessEqual2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecLess2*sv
 //	Less-than comparison of scalar and 2D vector components.
@@ -739,7 +739,7 @@ boolv ijkVecGreaterEqual2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecLess2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecGreater2*sv
 //	Greater-than comparison of scalar and 2D vector components.
@@ -747,7 +747,7 @@ boolv ijkVecLess2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecGreater2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecAnd2*sv
 //	Component-wise logical 'and' of 2D vector and scalar.
@@ -755,7 +755,7 @@ boolv ijkVecGreater2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecAnd2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecNand2*sv
 //	Component-wise logical 'nand' of 2D vector and scalar.
@@ -763,7 +763,7 @@ boolv ijkVecAnd2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecNand2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecOr2*sv
 //	Component-wise logical 'or' of 2D vector and scalar.
@@ -771,7 +771,7 @@ boolv ijkVecNand2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecOr2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecNor2*sv
 //	Component-wise logical 'nor' of 2D vector and scalar.
@@ -779,21 +779,21 @@ boolv ijkVecOr2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
+ijk_inl boolv ijkVecNor2ulsv(bool2 bv_out, ui64 const s_lh, uintl2 const v_rh);
 
 // ijkVecDot2*v
 //	Dot product of 2D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-ui64 ijkVecDot2ulv(uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl ui64 ijkVecDot2ulv(uintl2 const v_lh, uintl2 const v_rh);
 
 // ijkVecCross2*v
 //	Cross product scalar of 2D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar quantity of imaginary perpendicular axis
-ui64 ijkVecCross2ulv(uintl2 const v_lh, uintl2 const v_rh);
+ijk_inl ui64 ijkVecCross2ulv(uintl2 const v_lh, uintl2 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -802,7 +802,7 @@ ui64 ijkVecCross2ulv(uintl2 const v_lh, uintl2 const v_rh);
 //	Initialize 3D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-uintlv ijkVecInit3ulv(uintl3 v_out);
+ijk_inl uintlv ijkVecInit3ulv(uintl3 v_out);
 
 // ijkVecInitElems3*v
 //	Initialize 3D vector to specified individual elements.
@@ -811,35 +811,35 @@ uintlv ijkVecInit3ulv(uintl3 v_out);
 //		param y: second element
 //		param z: third element
 //		return: v_out
-uintlv ijkVecInitElems3ulv(uintl3 v_out, ui64 const x, ui64 const y, ui64 const z);
+ijk_inl uintlv ijkVecInitElems3ulv(uintl3 v_out, ui64 const x, ui64 const y, ui64 const z);
 
 // ijkVecCopy3*v
 //	Copy 3D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-uintlv ijkVecCopy3ulv(uintl3 v_out, uintl3 const v_in);
+ijk_inl uintlv ijkVecCopy3ulv(uintl3 v_out, uintl3 const v_in);
 
 // ijkVecNegate3*v
 //	Negate 3D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-intlv ijkVecNegate3ulv(intl3 v_out, uintl3 const v_in);
+ijk_inl intlv ijkVecNegate3ulv(intl3 v_out, uintl3 const v_in);
 
 // ijkVecBitNot3*v
 //	Calculate component-wise bitwise 'not' of 3D vector.
 //		param v_out: output vector to hold component-wise bitwise 'not'
 //		param v_in: input vector
 //		return: v_out
-uintlv ijkVecBitNot3ulv(uintl3 v_out, uintl3 const v_in);
+ijk_inl uintlv ijkVecBitNot3ulv(uintl3 v_out, uintl3 const v_in);
 
 // ijkVecNot3*v
 //	Calculate component-wise logical 'not' of 3D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot3ulv(bool3 bv_out, uintl3 const v_in);
+ijk_inl boolv ijkVecNot3ulv(bool3 bv_out, uintl3 const v_in);
 
 // ijkVecAdd3*v
 //	Calculate sum of 3D vectors.
@@ -847,7 +847,7 @@ boolv ijkVecNot3ulv(bool3 bv_out, uintl3 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecAdd3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecAdd3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecSub3*v
 //	Calculate difference of 3D vectors.
@@ -855,7 +855,7 @@ uintlv ijkVecAdd3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecSub3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecSub3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecMul3*v
 //	Calculate component-wise product of 3D vectors.
@@ -863,7 +863,7 @@ uintlv ijkVecSub3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecMul3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecMul3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecDiv3*v
 //	Calculate component-wise quotient of 3D vectors.
@@ -871,7 +871,7 @@ uintlv ijkVecMul3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecDiv3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecDiv3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecDivSafe3*v
 //	Calculate component-wise quotient of 3D vectors, division-by-zero safe.
@@ -879,7 +879,7 @@ uintlv ijkVecDiv3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecDivSafe3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecDivSafe3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecMod3*v
 //	Calculate component-wise remainder of 3D vectors.
@@ -887,7 +887,7 @@ uintlv ijkVecDivSafe3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecMod3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecMod3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecModSafe3*v
 //	Calculate component-wise remainder of 3D vectors, division-by-zero safe.
@@ -895,7 +895,7 @@ uintlv ijkVecMod3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecModSafe3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecModSafe3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecBitAnd3*v
 //	Calculate component-wise bitwise 'and' of 3D vectors.
@@ -903,7 +903,7 @@ uintlv ijkVecModSafe3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitAnd3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitAnd3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecBitNand3*v
 //	Calculate component-wise bitwise 'not and' of 3D vectors.
@@ -911,7 +911,7 @@ uintlv ijkVecBitAnd3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitNand3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitNand3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecBitOr3*v
 //	Calculate component-wise bitwise 'or' of 3D vectors.
@@ -919,7 +919,7 @@ uintlv ijkVecBitNand3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitOr3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitOr3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecBitNor3*v
 //	Calculate component-wise bitwise 'not or' of 3D vectors.
@@ -927,7 +927,7 @@ uintlv ijkVecBitOr3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitNor3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitNor3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecBitXor3*v
 //	Calculate component-wise bitwise 'exclusive or' of 3D vectors.
@@ -935,7 +935,7 @@ uintlv ijkVecBitNor3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitXor3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitXor3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecBitXnor3*v
 //	Calculate component-wise bitwise 'not exclusive or' of 3D vectors.
@@ -943,7 +943,7 @@ uintlv ijkVecBitXor3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitXnor3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitXnor3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecBitShiftLeft3*v
 //	Calculate component-wise bit shift left of 3D vectors.
@@ -951,7 +951,7 @@ uintlv ijkVecBitXnor3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitShiftLeft3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitShiftLeft3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecBitShiftRight3*v
 //	Calculate component-wise bit shift right of 3D vectors.
@@ -959,7 +959,7 @@ uintlv ijkVecBitShiftLeft3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitShiftRight3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitShiftRight3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecEqual3*v
 //	Equality comparison for 3D vectors.
@@ -967,7 +967,7 @@ uintlv ijkVecBitShiftRight3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_r
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecEqual3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecInequal3*v
 //	Inequality comparison for 3D vectors.
@@ -975,7 +975,7 @@ boolv ijkVecEqual3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecInequal3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecLessEqual3*v
 //	Less-than or equal comparison for 3D vectors.
@@ -983,7 +983,7 @@ boolv ijkVecInequal3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecLessEqual3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecGreaterEqual3*v
 //	Greater-than or equal comparison for 3D vectors.
@@ -991,7 +991,7 @@ boolv ijkVecLessEqual3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecLess3*v
 //	Less-than comparison for 3D vectors.
@@ -999,7 +999,7 @@ boolv ijkVecGreaterEqual3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh)
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecLess3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecGreater3*v
 //	Greater-than comparison for 3D vectors.
@@ -1007,7 +1007,7 @@ boolv ijkVecLess3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecGreater3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecAnd3*v
 //	Component-wise logical 'and' of 3D vectors.
@@ -1015,7 +1015,7 @@ boolv ijkVecGreater3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecAnd3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecNand3*v
 //	Component-wise logical 'nand' of 3D vectors.
@@ -1023,7 +1023,7 @@ boolv ijkVecAnd3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecNand3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecOr3*v
 //	Component-wise logical 'or' of 3D vectors.
@@ -1031,7 +1031,7 @@ boolv ijkVecNand3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecOr3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecNor3*v
 //	Component-wise logical 'nor' of 3D vectors.
@@ -1039,7 +1039,7 @@ boolv ijkVecOr3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecNor3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecCopy3*vz
 //	Copy 3D vector from 2D vector and one scalar.
@@ -1047,35 +1047,35 @@ boolv ijkVecNor3ulv(bool3 bv_out, uintl3 const v_lh, uintl3 const v_rh);
 //		param v_xy: input 2D vector holding first two components
 //		param z: third element
 //		return: v_out
-uintlv ijkVecCopy3ulvz(uintl3 v_out, uintl2 const v_xy, ui64 const z);
+ijk_inl uintlv ijkVecCopy3ulvz(uintl3 v_out, uintl2 const v_xy, ui64 const z);
 
 // ijkVecCopy3*vs
 //	Copy 3D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-uintlv ijkVecCopy3ulvs(uintl3 v_out, ui64 const s_in);
+ijk_inl uintlv ijkVecCopy3ulvs(uintl3 v_out, ui64 const s_in);
 
 // ijkVecNegate3*vs
 //	Negate scalar to 3D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-intlv ijkVecNegate3ulvs(intl3 v_out, ui64 const s_in);
+ijk_inl intlv ijkVecNegate3ulvs(intl3 v_out, ui64 const s_in);
 
 // ijkVecBitNot3*vs
 //	Calculate bitwise 'not' of 3D vector.
 //		param v_out: output vector to hold bitwise 'not'
 //		param s_in: input scalar
 //		return: v_out
-uintlv ijkVecBitNot3ulvs(uintl3 v_out, ui64 const s_in);
+ijk_inl uintlv ijkVecBitNot3ulvs(uintl3 v_out, ui64 const s_in);
 
 // ijkVecNot3*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot3ulvs(bool3 bv_out, ui64 const s_in);
+ijk_inl boolv ijkVecNot3ulvs(bool3 bv_out, ui64 const s_in);
 
 // ijkVecAdd3*vs
 //	Calculate sum of 3D vector components and scalar.
@@ -1083,7 +1083,7 @@ boolv ijkVecNot3ulvs(bool3 bv_out, ui64 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecAdd3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecAdd3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecSub3*vs
 //	Calculate difference of 3D vector components and scalar.
@@ -1091,7 +1091,7 @@ uintlv ijkVecAdd3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecSub3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecSub3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecMul3*vs
 //	Calculate product of 3D vector components by scalar.
@@ -1099,7 +1099,7 @@ uintlv ijkVecSub3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecMul3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecMul3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecDiv3*vs
 //	Calculate quotient of 3D vector components by scalar.
@@ -1107,7 +1107,7 @@ uintlv ijkVecMul3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecDiv3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecDiv3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecDivSafe3*vs
 //	Calculate quotient of 3D vector components by scalar, division-by-zero safe.
@@ -1115,7 +1115,7 @@ uintlv ijkVecDiv3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecDivSafe3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecDivSafe3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecMod3*vs
 //	Calculate remainder of 3D vector components by scalar.
@@ -1123,7 +1123,7 @@ uintlv ijkVecDivSafe3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecMod3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecMod3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecModSafe3*vs
 //	Calculate remainder of 3D vector components by scalar, division-by-zero safe.
@@ -1131,7 +1131,7 @@ uintlv ijkVecMod3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecModSafe3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecModSafe3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecBitAnd3*vs
 //	Calculate bitwise 'and' of 3D vector components and scalar.
@@ -1139,7 +1139,7 @@ uintlv ijkVecModSafe3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitAnd3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitAnd3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecBitNand3*vs
 //	Calculate bitwise 'not and' of 3D vector components and scalar.
@@ -1147,7 +1147,7 @@ uintlv ijkVecBitAnd3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitNand3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitNand3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecBitOr3*vs
 //	Calculate bitwise 'or' of 3D vector components and scalar.
@@ -1155,7 +1155,7 @@ uintlv ijkVecBitNand3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitOr3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitOr3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecBitNor3*vs
 //	Calculate bitwise 'not or' of 3D vector components and scalar.
@@ -1163,7 +1163,7 @@ uintlv ijkVecBitOr3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitNor3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitNor3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecBitXor3*vs
 //	Calculate bitwise 'exclusive or' of 3D vector components and scalar.
@@ -1171,7 +1171,7 @@ uintlv ijkVecBitNor3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitXor3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitXor3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecBitXnor3*vs
 //	Calculate bitwise 'not exclusive or' of 3D vector components and scalar.
@@ -1179,7 +1179,7 @@ uintlv ijkVecBitXor3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitXnor3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitXnor3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecBitShiftLeft3*vs
 //	Calculate bit shift left of 3D vector components and scalar.
@@ -1187,7 +1187,7 @@ uintlv ijkVecBitXnor3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitShiftLeft3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitShiftLeft3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecBitShiftRight3*vs
 //	Calculate bit shift right of 3D vector components and scalar.
@@ -1195,7 +1195,7 @@ uintlv ijkVecBitShiftLeft3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh)
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitShiftRight3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitShiftRight3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecEqual3*vs
 //	Equality comparison of 3D vector components and scalar.
@@ -1203,7 +1203,7 @@ uintlv ijkVecBitShiftRight3ulvs(uintl3 v_out, uintl3 const v_lh, ui64 const s_rh
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecEqual3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecInequal3*vs
 //	Inequality comparison of 3D vector components and scalar.
@@ -1211,7 +1211,7 @@ boolv ijkVecEqual3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecInequal3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecLessEqual3*vs
 //	Less-than or equal comparison of 3D vector components and scalar.
@@ -1219,7 +1219,7 @@ boolv ijkVecInequal3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecLessEqual3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecGreaterEqual3*vs
 //	Greater-than or equal comparison of 3D vector components and scalar.
@@ -1227,7 +1227,7 @@ boolv ijkVecLessEqual3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecLess3*vs
 //	Less-than comparison of 3D vector components and scalar.
@@ -1235,7 +1235,7 @@ boolv ijkVecGreaterEqual3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecLess3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecGreater3*vs
 //	Greater-than comparison of 3D vector components and scalar.
@@ -1243,7 +1243,7 @@ boolv ijkVecLess3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecGreater3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecAnd3*vs
 //	Component-wise logical 'and' of 3D vector and scalar.
@@ -1251,7 +1251,7 @@ boolv ijkVecGreater3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecAnd3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecNand3*vs
 //	Component-wise logical 'nand' of 3D vector and scalar.
@@ -1259,7 +1259,7 @@ boolv ijkVecAnd3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecNand3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecOr3*vs
 //	Component-wise logical 'or' of 3D vector and scalar.
@@ -1267,7 +1267,7 @@ boolv ijkVecNand3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecOr3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecNor3*vs
 //	Component-wise logical 'nor' of 3D vector and scalar.
@@ -1275,7 +1275,7 @@ boolv ijkVecOr3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecNor3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 
 // ijkVecCopy3*xv
 //	Copy 3D vector from 2D vector and one scalar.
@@ -1283,7 +1283,7 @@ boolv ijkVecNor3ulvs(bool3 bv_out, uintl3 const v_lh, ui64 const s_rh);
 //		param x: first element
 //		param v_yz: input 2D vector holding last two components
 //		return: v_out
-uintlv ijkVecCopy3ulxv(uintl3 v_out, ui64 const x, uintl2 const v_yz);
+ijk_inl uintlv ijkVecCopy3ulxv(uintl3 v_out, ui64 const x, uintl2 const v_yz);
 
 // ijkVecAdd3*sv
 //	Calculate sum of scalar and 3D vector components.
@@ -1291,7 +1291,7 @@ uintlv ijkVecCopy3ulxv(uintl3 v_out, ui64 const x, uintl2 const v_yz);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecAdd3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecAdd3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecSub3*sv
 //	Calculate difference of scalar and 3D vector components.
@@ -1299,7 +1299,7 @@ uintlv ijkVecAdd3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecSub3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecSub3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecMul3*sv
 //	Calculate product of scalar by 3D vector components.
@@ -1307,7 +1307,7 @@ uintlv ijkVecSub3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecMul3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecMul3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecDiv3*sv
 //	Calculate quotient of scalar by 3D vector components.
@@ -1315,7 +1315,7 @@ uintlv ijkVecMul3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecDiv3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecDiv3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecDivSafe3*sv
 //	Calculate quotient of scalar by 3D vector components, division-by-zero safe.
@@ -1323,7 +1323,7 @@ uintlv ijkVecDiv3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecDivSafe3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecDivSafe3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecMod3*sv
 //	Calculate remainder of scalar by 3D vector components.
@@ -1331,7 +1331,7 @@ uintlv ijkVecDivSafe3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecMod3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecMod3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecModSafe3*sv
 //	Calculate remainder of scalar by 3D vector components, division-by-zero safe.
@@ -1339,7 +1339,7 @@ uintlv ijkVecMod3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecModSafe3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecModSafe3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecBitAnd3*sv
 //	Calculate bitwise 'and' of scalar and 3D vector components.
@@ -1347,7 +1347,7 @@ uintlv ijkVecModSafe3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitAnd3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitAnd3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecBitNand3*sv
 //	Calculate bitwise 'not and' of scalar and 3D vector components.
@@ -1355,7 +1355,7 @@ uintlv ijkVecBitAnd3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitNand3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitNand3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecBitOr3*sv
 //	Calculate bitwise 'or' of scalar and 3D vector components.
@@ -1363,7 +1363,7 @@ uintlv ijkVecBitNand3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitOr3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitOr3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecBitNor3*sv
 //	Calculate bitwise 'not or' of scalar and 3D vector components.
@@ -1371,7 +1371,7 @@ uintlv ijkVecBitOr3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitNor3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitNor3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecBitXor3*sv
 //	Calculate bitwise 'exclusive or' of scalar and 3D vector components.
@@ -1379,7 +1379,7 @@ uintlv ijkVecBitNor3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitXor3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitXor3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecBitXnor3*sv
 //	Calculate bitwise 'not exclusive or' of scalar and 3D vector components.
@@ -1387,7 +1387,7 @@ uintlv ijkVecBitXor3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitXnor3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitXnor3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecBitShiftLeft3*sv
 //	Calculate bit shift left of scalar by 3D vector components.
@@ -1395,7 +1395,7 @@ uintlv ijkVecBitXnor3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitShiftLeft3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitShiftLeft3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecBitShiftRight3*sv
 //	Calculate bit shift right of scalar by 3D vector components.
@@ -1403,7 +1403,7 @@ uintlv ijkVecBitShiftLeft3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh)
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitShiftRight3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecBitShiftRight3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecEqual3*sv
 //	Equality comparison of scalar and 3D vector components.
@@ -1411,7 +1411,7 @@ uintlv ijkVecBitShiftRight3ulsv(uintl3 v_out, ui64 const s_lh, uintl3 const v_rh
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecEqual3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecInequal3*sv
 //	Inequality comparison of scalar and 3D vector components.
@@ -1419,7 +1419,7 @@ boolv ijkVecEqual3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecInequal3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecLessEqual3*sv
 //	Less-than or equal comparison of scalar and 3D vector components.
@@ -1427,7 +1427,7 @@ boolv ijkVecInequal3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecLessEqual3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecGreaterEqual3*sv
 //	Greater-than or equal comparison of scalar and 3D vector components.
@@ -1435,7 +1435,7 @@ boolv ijkVecLessEqual3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecLess3*sv
 //	Less-than comparison of scalar and 3D vector components.
@@ -1443,7 +1443,7 @@ boolv ijkVecGreaterEqual3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecLess3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecGreater3*sv
 //	Greater-than comparison of scalar and 3D vector components.
@@ -1451,7 +1451,7 @@ boolv ijkVecLess3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecGreater3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecAnd3*sv
 //	Component-wise logical 'and' of 3D vector and scalar.
@@ -1459,7 +1459,7 @@ boolv ijkVecGreater3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecAnd3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecNand3*sv
 //	Component-wise logical 'nand' of 3D vector and scalar.
@@ -1467,7 +1467,7 @@ boolv ijkVecAnd3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecNand3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecOr3*sv
 //	Component-wise logical 'or' of 3D vector and scalar.
@@ -1475,7 +1475,7 @@ boolv ijkVecNand3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecOr3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecNor3*sv
 //	Component-wise logical 'nor' of 3D vector and scalar.
@@ -1483,14 +1483,14 @@ boolv ijkVecOr3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
+ijk_inl boolv ijkVecNor3ulsv(bool3 bv_out, ui64 const s_lh, uintl3 const v_rh);
 
 // ijkVecDot3*v
 //	Dot product of 3D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-ui64 ijkVecDot3ulv(uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl ui64 ijkVecDot3ulv(uintl3 const v_lh, uintl3 const v_rh);
 
 // ijkVecCross3*v
 //	Cross product of 3D array-based vectors.
@@ -1498,7 +1498,7 @@ ui64 ijkVecDot3ulv(uintl3 const v_lh, uintl3 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecCross3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
+ijk_inl uintlv ijkVecCross3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -1507,7 +1507,7 @@ uintlv ijkVecCross3ulv(uintl3 v_out, uintl3 const v_lh, uintl3 const v_rh);
 //	Initialize 4D vector to default value (zero vector).
 //		param v_out: output vector
 //		return: v_out
-uintlv ijkVecInit4ulv(uintl4 v_out);
+ijk_inl uintlv ijkVecInit4ulv(uintl4 v_out);
 
 // ijkVecInitElems4*v
 //	Initialize 4D vector to specified individual elements.
@@ -1517,7 +1517,7 @@ uintlv ijkVecInit4ulv(uintl4 v_out);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: v_out
-uintlv ijkVecInitElems4ulv(uintl4 v_out, ui64 const x, ui64 const y, ui64 const z, ui64 const w);
+ijk_inl uintlv ijkVecInitElems4ulv(uintl4 v_out, ui64 const x, ui64 const y, ui64 const z, ui64 const w);
 
 // ijkVecCopy4*xvw
 //	Copy 4D vector from scalar, 2D vector and another scalar.
@@ -1526,7 +1526,7 @@ uintlv ijkVecInitElems4ulv(uintl4 v_out, ui64 const x, ui64 const y, ui64 const
 //		param v_yz: input 2D vector holding middle two components
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: v_out
-uintlv ijkVecCopy4ulxvw(uintl4 v_out, ui64 const x, uintl2 const v_yz, ui64 const w);
+ijk_inl uintlv ijkVecCopy4ulxvw(uintl4 v_out, ui64 const x, uintl2 const v_yz, ui64 const w);
 
 // ijkVecCopy4*v2
 //	Copy 4D vector from two 2D vectors.
@@ -1534,35 +1534,35 @@ uintlv ijkVecCopy4ulxvw(uintl4 v_out, ui64 const x, uintl2 const v_yz, ui64 cons
 //		param v_xy: input 2D vector holding first two components
 //		param v_zw: input 2D vector holding last two components
 //		return: v_out
-uintlv ijkVecCopy4ulv2(uintl4 v_out, uintl2 const v_xy, uintl2 const v_zw);
+ijk_inl uintlv ijkVecCopy4ulv2(uintl4 v_out, uintl2 const v_xy, uintl2 const v_zw);
 
 // ijkVecCopy4*v
 //	Copy 4D vector from first elements of another vector.
 //		param v_out: output vector to hold copy
 //		param v_in: input vector
 //		return: v_out
-uintlv ijkVecCopy4ulv(uintl4 v_out, uintl4 const v_in);
+ijk_inl uintlv ijkVecCopy4ulv(uintl4 v_out, uintl4 const v_in);
 
 // ijkVecNegate4*v
 //	Negate 4D vector.
 //		param v_out: output vector to hold negated
 //		param v_in: input vector
 //		return: v_out
-intlv ijkVecNegate4ulv(intl4 v_out, uintl4 const v_in);
+ijk_inl intlv ijkVecNegate4ulv(intl4 v_out, uintl4 const v_in);
 
 // ijkVecBitNot4*v
 //	Calculate component-wise bitwise 'not' of 4D vector.
 //		param v_out: output vector to hold component-wise bitwise 'not'
 //		param v_in: input vector
 //		return: v_out
-uintlv ijkVecBitNot4ulv(uintl4 v_out, uintl4 const v_in);
+ijk_inl uintlv ijkVecBitNot4ulv(uintl4 v_out, uintl4 const v_in);
 
 // ijkVecNot4*v
 //	Calculate component-wise logical 'not' of 4D vector.
 //		param bv_out: boolean vector to hold component-wise logical 'not'
 //		param v_in: input vector
 //		return: bv_out
-boolv ijkVecNot4ulv(bool4 bv_out, uintl4 const v_in);
+ijk_inl boolv ijkVecNot4ulv(bool4 bv_out, uintl4 const v_in);
 
 // ijkVecAdd4*v
 //	Calculate sum of 4D vectors.
@@ -1570,7 +1570,7 @@ boolv ijkVecNot4ulv(bool4 bv_out, uintl4 const v_in);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecAdd4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecAdd4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecSub4*v
 //	Calculate difference of 4D vectors.
@@ -1578,7 +1578,7 @@ uintlv ijkVecAdd4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecSub4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecSub4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecMul4*v
 //	Calculate component-wise product of 4D vectors.
@@ -1586,7 +1586,7 @@ uintlv ijkVecSub4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecMul4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecMul4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecDiv4*v
 //	Calculate component-wise quotient of 4D vectors.
@@ -1594,7 +1594,7 @@ uintlv ijkVecMul4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecDiv4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecDiv4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecDivSafe4*v
 //	Calculate component-wise quotient of 4D vectors, division-by-zero safe.
@@ -1602,7 +1602,7 @@ uintlv ijkVecDiv4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecDivSafe4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecDivSafe4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecMod4*v
 //	Calculate component-wise remainder of 4D vectors.
@@ -1610,7 +1610,7 @@ uintlv ijkVecDivSafe4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecMod4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecMod4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecModSafe4*v
 //	Calculate component-wise remainder of 4D vectors, division-by-zero safe.
@@ -1618,7 +1618,7 @@ uintlv ijkVecMod4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecModSafe4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecModSafe4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecBitAnd4*v
 //	Calculate component-wise bitwise 'and' of 4D vectors.
@@ -1626,7 +1626,7 @@ uintlv ijkVecModSafe4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitAnd4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitAnd4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecBitNand4*v
 //	Calculate component-wise bitwise 'not and' of 4D vectors.
@@ -1634,7 +1634,7 @@ uintlv ijkVecBitAnd4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitNand4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitNand4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecBitOr4*v
 //	Calculate component-wise bitwise 'or' of 4D vectors.
@@ -1642,7 +1642,7 @@ uintlv ijkVecBitNand4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitOr4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitOr4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecBitNor4*v
 //	Calculate component-wise bitwise 'not or' of 4D vectors.
@@ -1650,7 +1650,7 @@ uintlv ijkVecBitOr4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitNor4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitNor4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecBitXor4*v
 //	Calculate component-wise bitwise 'exclusive or' of 4D vectors.
@@ -1658,7 +1658,7 @@ uintlv ijkVecBitNor4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitXor4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitXor4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecBitXnor4*v
 //	Calculate component-wise bitwise 'not exclusive or' of 4D vectors.
@@ -1666,7 +1666,7 @@ uintlv ijkVecBitXor4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitXnor4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitXnor4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecBitShiftLeft4*v
 //	Calculate component-wise bit shift left of 4D vectors.
@@ -1674,7 +1674,7 @@ uintlv ijkVecBitXnor4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitShiftLeft4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitShiftLeft4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecBitShiftRight4*v
 //	Calculate component-wise bit shift right of 4D vectors.
@@ -1682,7 +1682,7 @@ uintlv ijkVecBitShiftLeft4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitShiftRight4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitShiftRight4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecEqual4*v
 //	Equality comparison for 4D vectors.
@@ -1690,7 +1690,7 @@ uintlv ijkVecBitShiftRight4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_r
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecEqual4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecInequal4*v
 //	Inequality comparison for 4D vectors.
@@ -1698,7 +1698,7 @@ boolv ijkVecEqual4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecInequal4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecLessEqual4*v
 //	Less-than or equal comparison for 4D vectors.
@@ -1706,7 +1706,7 @@ boolv ijkVecInequal4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecLessEqual4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecGreaterEqual4*v
 //	Greater-than or equal comparison for 4D vectors.
@@ -1714,7 +1714,7 @@ boolv ijkVecLessEqual4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecLess4*v
 //	Less-than comparison for 4D vectors.
@@ -1722,7 +1722,7 @@ boolv ijkVecGreaterEqual4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh)
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecLess4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecGreater4*v
 //	Greater-than comparison for 4D vectors.
@@ -1730,7 +1730,7 @@ boolv ijkVecLess4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecGreater4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecAnd4*v
 //	Component-wise logical 'and' of 4D vectors.
@@ -1738,7 +1738,7 @@ boolv ijkVecGreater4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecAnd4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecNand4*v
 //	Component-wise logical 'nand' of 4D vectors.
@@ -1746,7 +1746,7 @@ boolv ijkVecAnd4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecNand4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecOr4*v
 //	Component-wise logical 'or' of 4D vectors.
@@ -1754,7 +1754,7 @@ boolv ijkVecNand4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecOr4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecNor4*v
 //	Component-wise logical 'nor' of 4D vectors.
@@ -1762,7 +1762,7 @@ boolv ijkVecOr4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecNor4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecCopy4*vzw
 //	Copy 4D vector from 2D vector and two scalars.
@@ -1771,7 +1771,7 @@ boolv ijkVecNor4ulv(bool4 bv_out, uintl4 const v_lh, uintl4 const v_rh);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: v_out
-uintlv ijkVecCopy4ulvzw(uintl4 v_out, uintl2 const v_xy, ui64 const z, ui64 const w);
+ijk_inl uintlv ijkVecCopy4ulvzw(uintl4 v_out, uintl2 const v_xy, ui64 const z, ui64 const w);
 
 // ijkVecCopy4*vw
 //	Copy 4D vector from 3D vector and one scalar.
@@ -1779,35 +1779,35 @@ uintlv ijkVecCopy4ulvzw(uintl4 v_out, uintl2 const v_xy, ui64 const z, ui64 cons
 //		param v_xyz: input 3D vector holding first three components
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: v_out
-uintlv ijkVecCopy4ulvw(uintl4 v_out, uintl3 const v_xyz, ui64 const w);
+ijk_inl uintlv ijkVecCopy4ulvw(uintl4 v_out, uintl3 const v_xyz, ui64 const w);
 
 // ijkVecCopy4*vs
 //	Copy 4D vector from scalar.
 //		param v_out: output vector to hold copy
 //		param s_in: input scalar
 //		return: v_out
-uintlv ijkVecCopy4ulvs(uintl4 v_out, ui64 const s_in);
+ijk_inl uintlv ijkVecCopy4ulvs(uintl4 v_out, ui64 const s_in);
 
 // ijkVecNegate4*vs
 //	Negate scalar to 4D vector.
 //		param v_out: output vector to hold negated
 //		param s_in: input scalar
 //		return: v_out
-intlv ijkVecNegate4ulvs(intl4 v_out, ui64 const s_in);
+ijk_inl intlv ijkVecNegate4ulvs(intl4 v_out, ui64 const s_in);
 
 // ijkVecBitNot4*vs
 //	Calculate bitwise 'not' of 4D vector.
 //		param v_out: output vector to hold bitwise 'not'
 //		param s_in: input scalar
 //		return: v_out
-uintlv ijkVecBitNot4ulvs(uintl4 v_out, ui64 const s_in);
+ijk_inl uintlv ijkVecBitNot4ulvs(uintl4 v_out, ui64 const s_in);
 
 // ijkVecNot4*vs
 //	Calculate logical 'not' of scalar.
 //		param bv_out: boolean vector to hold logical 'not'
 //		param s_in: input scalar
 //		return: bv_out
-boolv ijkVecNot4ulvs(bool4 bv_out, ui64 const s_in);
+ijk_inl boolv ijkVecNot4ulvs(bool4 bv_out, ui64 const s_in);
 
 // ijkVecAdd4*vs
 //	Calculate sum of 4D vector components and scalar.
@@ -1815,7 +1815,7 @@ boolv ijkVecNot4ulvs(bool4 bv_out, ui64 const s_in);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecAdd4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecAdd4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecSub4*vs
 //	Calculate difference of 4D vector components and scalar.
@@ -1823,7 +1823,7 @@ uintlv ijkVecAdd4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecSub4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecSub4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecMul4*vs
 //	Calculate product of 4D vector components by scalar.
@@ -1831,7 +1831,7 @@ uintlv ijkVecSub4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecMul4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecMul4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecDiv4*vs
 //	Calculate quotient of 4D vector components by scalar.
@@ -1839,7 +1839,7 @@ uintlv ijkVecMul4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecDiv4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecDiv4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecDivSafe4*vs
 //	Calculate quotient of 4D vector components by scalar, division-by-zero safe.
@@ -1847,7 +1847,7 @@ uintlv ijkVecDiv4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecDivSafe4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecDivSafe4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecMod4*vs
 //	Calculate remainder of 4D vector components by scalar.
@@ -1855,7 +1855,7 @@ uintlv ijkVecDivSafe4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecMod4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecMod4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecModSafe4*vs
 //	Calculate remainder of 4D vector components by scalar, division-by-zero safe.
@@ -1863,7 +1863,7 @@ uintlv ijkVecMod4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecModSafe4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecModSafe4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecBitAnd4*vs
 //	Calculate bitwise 'and' of 4D vector components and scalar.
@@ -1871,7 +1871,7 @@ uintlv ijkVecModSafe4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitAnd4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitAnd4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecBitNand4*vs
 //	Calculate bitwise 'not and' of 4D vector components and scalar.
@@ -1879,7 +1879,7 @@ uintlv ijkVecBitAnd4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitNand4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitNand4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecBitOr4*vs
 //	Calculate bitwise 'or' of 4D vector components and scalar.
@@ -1887,7 +1887,7 @@ uintlv ijkVecBitNand4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitOr4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitOr4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecBitNor4*vs
 //	Calculate bitwise 'not or' of 4D vector components and scalar.
@@ -1895,7 +1895,7 @@ uintlv ijkVecBitOr4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitNor4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitNor4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecBitXor4*vs
 //	Calculate bitwise 'exclusive or' of 4D vector components and scalar.
@@ -1903,7 +1903,7 @@ uintlv ijkVecBitNor4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitXor4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitXor4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecBitXnor4*vs
 //	Calculate bitwise 'not exclusive or' of 4D vector components and scalar.
@@ -1911,7 +1911,7 @@ uintlv ijkVecBitXor4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitXnor4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitXnor4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecBitShiftLeft4*vs
 //	Calculate bit shift left of 4D vector components and scalar.
@@ -1919,7 +1919,7 @@ uintlv ijkVecBitXnor4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitShiftLeft4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitShiftLeft4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecBitShiftRight4*vs
 //	Calculate bit shift right of 4D vector components and scalar.
@@ -1927,7 +1927,7 @@ uintlv ijkVecBitShiftLeft4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh)
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: v_out
-uintlv ijkVecBitShiftRight4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl uintlv ijkVecBitShiftRight4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecEqual4*vs
 //	Equality comparison of 4D vector components and scalar.
@@ -1935,7 +1935,7 @@ uintlv ijkVecBitShiftRight4ulvs(uintl4 v_out, uintl4 const v_lh, ui64 const s_rh
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecEqual4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecEqual4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecInequal4*vs
 //	Inequality comparison of 4D vector components and scalar.
@@ -1943,7 +1943,7 @@ boolv ijkVecEqual4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecInequal4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecInequal4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecLessEqual4*vs
 //	Less-than or equal comparison of 4D vector components and scalar.
@@ -1951,7 +1951,7 @@ boolv ijkVecInequal4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLessEqual4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecLessEqual4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecGreaterEqual4*vs
 //	Greater-than or equal comparison of 4D vector components and scalar.
@@ -1959,7 +1959,7 @@ boolv ijkVecLessEqual4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreaterEqual4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecGreaterEqual4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecLess4*vs
 //	Less-than comparison of 4D vector components and scalar.
@@ -1967,7 +1967,7 @@ boolv ijkVecGreaterEqual4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecLess4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecLess4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecGreater4*vs
 //	Greater-than comparison of 4D vector components and scalar.
@@ -1975,7 +1975,7 @@ boolv ijkVecLess4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecGreater4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecGreater4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecAnd4*vs
 //	Component-wise logical 'and' of 4D vector and scalar.
@@ -1983,7 +1983,7 @@ boolv ijkVecGreater4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecAnd4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecAnd4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecNand4*vs
 //	Component-wise logical 'nand' of 4D vector and scalar.
@@ -1991,7 +1991,7 @@ boolv ijkVecAnd4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNand4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecNand4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecOr4*vs
 //	Component-wise logical 'or' of 4D vector and scalar.
@@ -1999,7 +1999,7 @@ boolv ijkVecNand4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecOr4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecOr4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecNor4*vs
 //	Component-wise logical 'nor' of 4D vector and scalar.
@@ -2007,7 +2007,7 @@ boolv ijkVecOr4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: bv_out
-boolv ijkVecNor4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
+ijk_inl boolv ijkVecNor4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 
 // ijkVecCopy4*xyv
 //	Copy 4D vector from two scalars and 2D vector.
@@ -2016,7 +2016,7 @@ boolv ijkVecNor4ulvs(bool4 bv_out, uintl4 const v_lh, ui64 const s_rh);
 //		param y: second element
 //		param v_zw: input 2D vector holding last two components
 //		return: v_out
-uintlv ijkVecCopy4ulxyv(uintl4 v_out, ui64 const x, ui64 const y, uintl2 const v_zw);
+ijk_inl uintlv ijkVecCopy4ulxyv(uintl4 v_out, ui64 const x, ui64 const y, uintl2 const v_zw);
 
 // ijkVecCopy4*xv
 //	Copy 4D vector from one scalar and 3D vector.
@@ -2024,7 +2024,7 @@ uintlv ijkVecCopy4ulxyv(uintl4 v_out, ui64 const x, ui64 const y, uintl2 const v
 //		param x: first element
 //		param v_yzw: input 3D vector holding last three components
 //		return: v_out
-uintlv ijkVecCopy4ulxv(uintl4 v_out, ui64 const x, uintl3 const v_yzw);
+ijk_inl uintlv ijkVecCopy4ulxv(uintl4 v_out, ui64 const x, uintl3 const v_yzw);
 
 // ijkVecAdd4*sv
 //	Calculate sum of scalar and 4D vector components.
@@ -2032,7 +2032,7 @@ uintlv ijkVecCopy4ulxv(uintl4 v_out, ui64 const x, uintl3 const v_yzw);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecAdd4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecAdd4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecSub4*sv
 //	Calculate difference of scalar and 4D vector components.
@@ -2040,7 +2040,7 @@ uintlv ijkVecAdd4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecSub4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecSub4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecMul4*sv
 //	Calculate product of scalar by 4D vector components.
@@ -2048,7 +2048,7 @@ uintlv ijkVecSub4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecMul4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecMul4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecDiv4*sv
 //	Calculate quotient of scalar by 4D vector components.
@@ -2056,7 +2056,7 @@ uintlv ijkVecMul4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecDiv4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecDiv4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecDivSafe4*sv
 //	Calculate quotient of scalar by 4D vector components, division-by-zero safe.
@@ -2064,7 +2064,7 @@ uintlv ijkVecDiv4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecDivSafe4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecDivSafe4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecMod4*sv
 //	Calculate remainder of scalar by 4D vector components.
@@ -2072,7 +2072,7 @@ uintlv ijkVecDivSafe4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecMod4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecMod4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecModSafe4*sv
 //	Calculate remainder of scalar by 4D vector components, division-by-zero safe.
@@ -2080,7 +2080,7 @@ uintlv ijkVecMod4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecModSafe4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecModSafe4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecBitAnd4*sv
 //	Calculate bitwise 'and' of scalar and 4D vector components.
@@ -2088,7 +2088,7 @@ uintlv ijkVecModSafe4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitAnd4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitAnd4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecBitNand4*sv
 //	Calculate bitwise 'not and' of scalar and 4D vector components.
@@ -2096,7 +2096,7 @@ uintlv ijkVecBitAnd4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitNand4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitNand4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecBitOr4*sv
 //	Calculate bitwise 'or' of scalar and 4D vector components.
@@ -2104,7 +2104,7 @@ uintlv ijkVecBitNand4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitOr4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitOr4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecBitNor4*sv
 //	Calculate bitwise 'not or' of scalar and 4D vector components.
@@ -2112,7 +2112,7 @@ uintlv ijkVecBitOr4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitNor4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitNor4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecBitXor4*sv
 //	Calculate bitwise 'exclusive or' of scalar and 4D vector components.
@@ -2120,7 +2120,7 @@ uintlv ijkVecBitNor4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitXor4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitXor4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecBitXnor4*sv
 //	Calculate bitwise 'not exclusive or' of scalar and 4D vector components.
@@ -2128,7 +2128,7 @@ uintlv ijkVecBitXor4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitXnor4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitXnor4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecBitShiftLeft4*sv
 //	Calculate bit shift left of scalar by 4D vector components.
@@ -2136,7 +2136,7 @@ uintlv ijkVecBitXnor4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitShiftLeft4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitShiftLeft4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecBitShiftRight4*sv
 //	Calculate bit shift right of scalar by 4D vector components.
@@ -2144,7 +2144,7 @@ uintlv ijkVecBitShiftLeft4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh)
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: v_out
-uintlv ijkVecBitShiftRight4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecBitShiftRight4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecEqual4*sv
 //	Equality comparison of scalar and 4D vector components.
@@ -2152,7 +2152,7 @@ uintlv ijkVecBitShiftRight4ulsv(uintl4 v_out, ui64 const s_lh, uintl4 const v_rh
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecEqual4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecEqual4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecInequal4*sv
 //	Inequality comparison of scalar and 4D vector components.
@@ -2160,7 +2160,7 @@ boolv ijkVecEqual4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecInequal4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecInequal4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecLessEqual4*sv
 //	Less-than or equal comparison of scalar and 4D vector components.
@@ -2168,7 +2168,7 @@ boolv ijkVecInequal4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLessEqual4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecLessEqual4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecGreaterEqual4*sv
 //	Greater-than or equal comparison of scalar and 4D vector components.
@@ -2176,7 +2176,7 @@ boolv ijkVecLessEqual4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreaterEqual4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecGreaterEqual4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecLess4*sv
 //	Less-than comparison of scalar and 4D vector components.
@@ -2184,7 +2184,7 @@ boolv ijkVecGreaterEqual4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecLess4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecLess4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecGreater4*sv
 //	Greater-than comparison of scalar and 4D vector components.
@@ -2192,7 +2192,7 @@ boolv ijkVecLess4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecGreater4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecGreater4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecAnd4*sv
 //	Component-wise logical 'and' of 4D vector and scalar.
@@ -2200,7 +2200,7 @@ boolv ijkVecGreater4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecAnd4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecAnd4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecNand4*sv
 //	Component-wise logical 'nand' of 4D vector and scalar.
@@ -2208,7 +2208,7 @@ boolv ijkVecAnd4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNand4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecNand4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecOr4*sv
 //	Component-wise logical 'or' of 4D vector and scalar.
@@ -2216,7 +2216,7 @@ boolv ijkVecNand4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecOr4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecOr4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecNor4*sv
 //	Component-wise logical 'nor' of 4D vector and scalar.
@@ -2224,14 +2224,14 @@ boolv ijkVecOr4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: bv_out
-boolv ijkVecNor4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
+ijk_inl boolv ijkVecNor4ulsv(bool4 bv_out, ui64 const s_lh, uintl4 const v_rh);
 
 // ijkVecDot4*v
 //	Dot product of 4D array-based vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-ui64 ijkVecDot4ulv(uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl ui64 ijkVecDot4ulv(uintl4 const v_lh, uintl4 const v_rh);
 
 // ijkVecCross4*v
 //	Cross product of 4D array-based vectors.
@@ -2239,7 +2239,7 @@ ui64 ijkVecDot4ulv(uintl4 const v_lh, uintl4 const v_rh);
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: v_out (fourth element is zero)
-uintlv ijkVecCross4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
+ijk_inl uintlv ijkVecCross4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -2256,50 +2256,50 @@ uintlv ijkVecCross4ulv(uintl4 v_out, uintl4 const v_lh, uintl4 const v_rh);
 //	Absolute value of scalar: (s >= 0 ? +s : -s).
 //		param s: scalar
 //		return: absolute value
-uintl ijkVecAbs1ul(uintl const s);
+ijk_inl uintl ijkVecAbs1ul(uintl const s);
 
 // ijkVecSgn1*
 //	Sign of scalar: (s != 0 ? s > 0 ? +1 : -1).
 //		param s: scalar
 //		return: sign
-uintl ijkVecSgn1ul(uintl const s);
+ijk_inl uintl ijkVecSgn1ul(uintl const s);
 
 // ijkVecDot1*
 //	Dot product of scalars, which is just their product.
 //		param s_lh: left-hand scalar
 //		param s_rh: right-hand scalar
 //		return: product
-uintl ijkVecDot1ul(uintl const s_lh, uintl const s_rh);
+ijk_inl uintl ijkVecDot1ul(uintl const s_lh, uintl const s_rh);
 
 // ijkVecLengthSq1*
 //	Squared length of scalar.
 //		param s: scalar
 //		return: squared length
-uintl ijkVecLengthSq1ul(uintl const s);
+ijk_inl uintl ijkVecLengthSq1ul(uintl const s);
 
 // ijkVecLength1*
 //	Length of scalar.
 //		param s: scalar
 //		return: length
-uintl ijkVecLength1ul(uintl const s);
+ijk_inl uintl ijkVecLength1ul(uintl const s);
 
 // ijkVecLengthSqInv1*
 //	Inverse squared length of scalar.
 //		param s: scalar
 //		return: inverse squared length
-double ijkVecLengthSqInv1ul(uintl const s);
+ijk_inl double ijkVecLengthSqInv1ul(uintl const s);
 
 // ijkVecLengthSqInv1*
 //	Inverse length of scalar.
 //		param s: scalar
 //		return: inverse length
-double ijkVecLengthInv1ul(uintl const s);
+ijk_inl double ijkVecLengthInv1ul(uintl const s);
 
 // ijkVecNormalize1*
 //	Calculate unit scalar in same direction as input (sign).
 //		param s: scalar
 //		return: unit scalar (sign)
-uintl ijkVecNormalize1ul(uintl const s);
+ijk_inl uintl ijkVecNormalize1ul(uintl const s);
 
 // ijkVecNormalizeGetLength1*
 //	Calculate unit scalar in same direction as input (sign).
@@ -2307,7 +2307,7 @@ uintl ijkVecNormalize1ul(uintl const s);
 //		param s: scalar
 //		param length_out: pointer to length storage
 //		return: unit scalar (sign)
-uintl ijkVecNormalizeGetLength1ul(uintl const s, uintl* const length_out);
+ijk_inl uintl ijkVecNormalizeGetLength1ul(uintl const s, uintl* const length_out);
 
 // ijkVecNormalizeGetLengthInv1*
 //	Calculate unit scalar in same direction as input (sign).
@@ -2315,7 +2315,7 @@ uintl ijkVecNormalizeGetLength1ul(uintl const s, uintl* const length_out);
 //		param s: scalar
 //		param lengthInv_out: pointer to length storage
 //		return: unit scalar (sign)
-uintl ijkVecNormalizeGetLengthInv1ul(uintl const s, double* const lengthInv_out);
+ijk_inl uintl ijkVecNormalizeGetLengthInv1ul(uintl const s, double* const lengthInv_out);
 
 
 //-----------------------------------------------------------------------------
@@ -2323,601 +2323,601 @@ uintl ijkVecNormalizeGetLengthInv1ul(uintl const s, double* const lengthInv_out)
 // ijkVecInit2*
 //	Initialize 2D vector to default value (zero vector).
 //		return: default vector
-ulvec2 ijkVecInit2ul();
+ijk_inl ulvec2 ijkVecInit2ul();
 
 // ijkVecInitElems2*
 //	Initialize 2D vector to specified individual elements.
 //		param x: first element
 //		param y: second element
 //		return: result vector
-ulvec2 ijkVecInitElems2ul(uintl const x, uintl const y);
+ijk_inl ulvec2 ijkVecInitElems2ul(uintl const x, uintl const y);
 
 // ijkVecCopy2*
 //	Copy 2D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-ulvec2 ijkVecCopy2ul(ulvec2 const v_in);
+ijk_inl ulvec2 ijkVecCopy2ul(ulvec2 const v_in);
 
 // ijkVecNegate2*
 //	Negate 2D vector.
 //		param v_in: input vector
 //		return: result vector
-ilvec2 ijkVecNegate2ul(ulvec2 const v_in);
+ijk_inl ilvec2 ijkVecNegate2ul(ulvec2 const v_in);
 
 // ijkVecBitNot2*
 //	Calculate component-wise bitwise 'not' of 2D vector.
 //		param v_in: input vector
 //		return: result vector
-ulvec2 ijkVecBitNot2ul(ulvec2 const v_in);
+ijk_inl ulvec2 ijkVecBitNot2ul(ulvec2 const v_in);
 
 // ijkVecNot2*
 //	Calculate component-wise logical 'not' of 2D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec2 ijkVecNot2ul(ulvec2 const v_in);
+ijk_inl bvec2 ijkVecNot2ul(ulvec2 const v_in);
 
 // ijkVecAdd2*
 //	Calculate sum of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecAdd2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecAdd2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecSub2*
 //	Calculate difference of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecSub2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecSub2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecMul2*
 //	Calculate component-wise product of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecMul2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecMul2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecDiv2*
 //	Calculate component-wise quotient of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecDiv2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecDiv2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecDivSafe2*
 //	Calculate component-wise quotient of 2D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecDivSafe2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecDivSafe2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecMod2*
 //	Calculate component-wise remainder of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecMod2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecMod2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecModSafe2*
 //	Calculate component-wise remainder of 2D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecModSafe2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecModSafe2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecBitAnd2*
 //	Calculate component-wise bitwise 'and' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitAnd2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitAnd2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecBitNand2*
 //	Calculate component-wise bitwise 'not and' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitNand2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitNand2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecBitOr2*
 //	Calculate component-wise bitwise 'or' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitOr2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitOr2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecBitNor2*
 //	Calculate component-wise bitwise 'not or' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitNor2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitNor2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecBitXor2*
 //	Calculate component-wise bitwise 'exclusive or' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitXor2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitXor2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecBitXnor2*
 //	Calculate component-wise bitwise 'not exclusive or' of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitXnor2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitXnor2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecBitShiftLeft2*
 //	Calculate component-wise bit shift left of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitShiftLeft2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitShiftLeft2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecBitShiftRight2*
 //	Calculate component-wise bit shift right of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitShiftRight2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitShiftRight2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecEqual2*
 //	Equality comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecEqual2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecEqual2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecInequal2*
 //	Inequality comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecInequal2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecInequal2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecLessEqual2*
 //	Less-than or equal comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLessEqual2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecLessEqual2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecGreaterEqual2*
 //	Greater-than or equal comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecLess2*
 //	Less-than comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLess2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecLess2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecGreater2*
 //	Greater-than comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreater2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreater2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecAnd2*
 //	Component-wise logical 'and' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecAnd2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecAnd2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecNand2*
 //	Component-wise logical 'nand' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNand2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecNand2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecOr2*
 //	Component-wise logical 'or' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecOr2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecOr2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecNor2*
 //	Component-wise logical 'nor' comparison for 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNor2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecNor2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecCopy2*s
 //	Copy 2D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-ulvec2 ijkVecCopy2uls(uintl const s_in);
+ijk_inl ulvec2 ijkVecCopy2uls(uintl const s_in);
 
 // ijkVecNegate2*s
 //	Negate scalar to 2D vector.
 //		param s_in: input scalar
 //		return: result vector
-ilvec2 ijkVecNegate2uls(uintl const s_in);
+ijk_inl ilvec2 ijkVecNegate2uls(uintl const s_in);
 
 // ijkVecBitNot2*s
 //	Calculate bitwise 'not' of 2D vector.
 //		param s_in: input scalar
 //		return: result vector
-ulvec2 ijkVecBitNot2uls(uintl const s_in);
+ijk_inl ulvec2 ijkVecBitNot2uls(uintl const s_in);
 
 // ijkVecNot2*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec2 ijkVecNot2uls(uintl const s_in);
+ijk_inl bvec2 ijkVecNot2uls(uintl const s_in);
 
 // ijkVecAdd2*s
 //	Calculate sum of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecAdd2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecAdd2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecSub2*s
 //	Calculate difference of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecSub2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecSub2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecMul2*s
 //	Calculate product of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecMul2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecMul2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecDiv2*s
 //	Calculate quotient of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecDiv2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecDiv2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecDivSafe2*s
 //	Calculate quotient of 2D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecDivSafe2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecDivSafe2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecMod2*s
 //	Calculate remainder of 2D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecMod2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecMod2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecModSafe2*s
 //	Calculate remainder of 2D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecModSafe2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecModSafe2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecBitAnd2*s
 //	Calculate bitwise 'and' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecBitAnd2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecBitAnd2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecBitNand2*s
 //	Calculate bitwise 'not and' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecBitNand2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecBitNand2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecBitOr2*s
 //	Calculate bitwise 'or' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecBitOr2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecBitOr2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecBitNor2*s
 //	Calculate bitwise 'not or' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecBitNor2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecBitNor2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecBitXor2*s
 //	Calculate bitwise 'exclusive or' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecBitXor2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecBitXor2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecBitXnor2*s
 //	Calculate bitwise 'not exclusive or' of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecBitXnor2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecBitXnor2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecBitShiftLeft2*s
 //	Calculate bit shift left of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecBitShiftLeft2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecBitShiftLeft2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecBitShiftRight2*s
 //	Calculate bit shift right of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec2 ijkVecBitShiftRight2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl ulvec2 ijkVecBitShiftRight2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecEqual2*s
 //	Equality comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecEqual2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl bvec2 ijkVecEqual2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecInequal2*s
 //	Inequality comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecInequal2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl bvec2 ijkVecInequal2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecLessEqual2*s
 //	Less-than or equal comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecLessEqual2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl bvec2 ijkVecLessEqual2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecGreaterEqual2*s
 //	Greater-than or equal comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecLess2*s
 //	Less-than comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecLess2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl bvec2 ijkVecLess2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecGreater2*s
 //	Greater-than comparison of 2D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecGreater2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl bvec2 ijkVecGreater2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecAnd2*s
 //	Component-wise logical 'and' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecAnd2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl bvec2 ijkVecAnd2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecNand2*s
 //	Component-wise logical 'nand' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecNand2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl bvec2 ijkVecNand2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecOr2*s
 //	Component-wise logical 'or' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecOr2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl bvec2 ijkVecOr2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecNor2*s
 //	Component-wise logical 'nor' comparison of 2D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec2 ijkVecNor2uls(ulvec2 const v_lh, uintl const s_rh);
+ijk_inl bvec2 ijkVecNor2uls(ulvec2 const v_lh, uintl const s_rh);
 
 // ijkVecAdd2s*
 //	Calculate sum of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecAdd2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecAdd2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecSub2s*
 //	Calculate difference of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecSub2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecSub2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecMul2s*
 //	Calculate product of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecMul2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecMul2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecDiv2s*
 //	Calculate quotient of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecDiv2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecDiv2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecDivSafe2s*
 //	Calculate quotient of scalar by 2D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecDivSafe2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecDivSafe2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecMod2s*
 //	Calculate remainder of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecMod2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecMod2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecModSafe2s*
 //	Calculate remainder of scalar by 2D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecModSafe2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecModSafe2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecBitAnd2s*
 //	Calculate bitwise 'and' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitAnd2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitAnd2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecBitNand2s*
 //	Calculate bitwise 'not and' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitNand2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitNand2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecBitOr2s*
 //	Calculate bitwise 'or' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitOr2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitOr2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecBitNor2s*
 //	Calculate bitwise 'not or' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitNor2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitNor2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecBitXor2s*
 //	Calculate bitwise 'exclusive or' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitXor2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitXor2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecBitXnor2s*
 //	Calculate bitwise 'not exclusive or' of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitXnor2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitXnor2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecBitShiftLeft2s*
 //	Calculate bit shift left of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitShiftLeft2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitShiftLeft2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecBitShiftRight2s*
 //	Calculate bit shift right of scalar by 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec2 ijkVecBitShiftRight2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl ulvec2 ijkVecBitShiftRight2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecEqual2s*
 //	Equality comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecEqual2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecEqual2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecInequal2s*
 //	Inequality comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecInequal2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecInequal2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecLessEqual2s*
 //	Less-than or equal comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLessEqual2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecLessEqual2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecGreaterEqual2s*
 //	Greater-than or equal comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreaterEqual2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreaterEqual2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecLess2s*
 //	Less-than comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecLess2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecLess2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecGreater2s*
 //	Greater-than comparison of scalar and 2D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecGreater2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecGreater2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecAnd2s*
 //	Component-wise logical 'and' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecAnd2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecAnd2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecNand2s*
 //	Component-wise logical 'nand' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNand2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecNand2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecOr2s*
 //	Component-wise logical 'or' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecOr2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecOr2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecNor2s*
 //	Component-wise logical 'nor' comparison of 2D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec2 ijkVecNor2sul(uintl const s_lh, ulvec2 const v_rh);
+ijk_inl bvec2 ijkVecNor2sul(uintl const s_lh, ulvec2 const v_rh);
 
 // ijkVecDot2*
 //	Dot product of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-uintl ijkVecDot2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl uintl ijkVecDot2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 // ijkVecCross2*
 //	Cross product scalar of 2D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: scalar quantity of imaginary perpendicular axis
-uintl ijkVecCross2ul(ulvec2 const v_lh, ulvec2 const v_rh);
+ijk_inl uintl ijkVecCross2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -2925,7 +2925,7 @@ uintl ijkVecCross2ul(ulvec2 const v_lh, ulvec2 const v_rh);
 // ijkVecInit3*
 //	Initialize 3D vector to default value (zero vector).
 //		return: default vector
-ulvec3 ijkVecInit3ul();
+ijk_inl ulvec3 ijkVecInit3ul();
 
 // ijkVecInitElems3*
 //	Initialize 3D vector to specified individual elements.
@@ -2933,608 +2933,608 @@ ulvec3 ijkVecInit3ul();
 //		param y: second element
 //		param z: third element
 //		return: result vector
-ulvec3 ijkVecInitElems3ul(uintl const x, uintl const y, uintl const z);
+ijk_inl ulvec3 ijkVecInitElems3ul(uintl const x, uintl const y, uintl const z);
 
 // ijkVecCopy3*
 //	Copy 3D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-ulvec3 ijkVecCopy3ul(ulvec3 const v_in);
+ijk_inl ulvec3 ijkVecCopy3ul(ulvec3 const v_in);
 
 // ijkVecNegate3*
 //	Negate 3D vector.
 //		param v_in: input vector
 //		return: result vector
-ilvec3 ijkVecNegate3ul(ulvec3 const v_in);
+ijk_inl ilvec3 ijkVecNegate3ul(ulvec3 const v_in);
 
 // ijkVecBitNot3*
 //	Calculate component-wise bitwise 'not' of 3D vector.
 //		param v_in: input vector
 //		return: result vector
-ulvec3 ijkVecBitNot3ul(ulvec3 const v_in);
+ijk_inl ulvec3 ijkVecBitNot3ul(ulvec3 const v_in);
 
 // ijkVecNot3*
 //	Calculate component-wise logical 'not' of 3D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec3 ijkVecNot3ul(ulvec3 const v_in);
+ijk_inl bvec3 ijkVecNot3ul(ulvec3 const v_in);
 
 // ijkVecAdd3*
 //	Calculate sum of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecAdd3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecAdd3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecSub3*
 //	Calculate difference of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecSub3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecSub3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecMul3*
 //	Calculate component-wise product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecMul3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecMul3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecDiv3*
 //	Calculate component-wise quotient of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecDiv3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecDiv3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecDivSafe3*
 //	Calculate component-wise quotient of 3D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecDivSafe3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecDivSafe3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecMod3*
 //	Calculate component-wise remainder of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecMod3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecMod3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecModSafe3*
 //	Calculate component-wise remainder of 3D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecModSafe3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecModSafe3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecBitAnd3*
 //	Calculate component-wise bitwise 'and' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitAnd3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitAnd3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecBitNand3*
 //	Calculate component-wise bitwise 'not and' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitNand3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitNand3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecBitOr3*
 //	Calculate component-wise bitwise 'or' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitOr3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitOr3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecBitNor3*
 //	Calculate component-wise bitwise 'not or' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitNor3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitNor3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecBitXor3*
 //	Calculate component-wise bitwise 'exclusive or' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitXor3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitXor3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecBitXnor3*
 //	Calculate component-wise bitwise 'not exclusive or' of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitXnor3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitXnor3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecBitShiftLeft3*
 //	Calculate component-wise bit shift left of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitShiftLeft3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitShiftLeft3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecBitShiftRight3*
 //	Calculate component-wise bit shift right of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitShiftRight3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitShiftRight3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecEqual3*
 //	Equality comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecEqual3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecEqual3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecInequal3*
 //	Inequality comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecInequal3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecInequal3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecLessEqual3*
 //	Less-than or equal comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLessEqual3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecLessEqual3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecGreaterEqual3*
 //	Greater-than or equal comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecLess3*
 //	Less-than comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLess3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecLess3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecGreater3*
 //	Greater-than comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreater3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreater3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecAnd3*
 //	Component-wise logical 'and' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecAnd3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecAnd3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecNand3*
 //	Component-wise logical 'nand' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNand3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecNand3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecOr3*
 //	Component-wise logical 'or' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecOr3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecOr3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecNor3*
 //	Component-wise logical 'nor' comparison for 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNor3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecNor3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecCopy3*z
 //	Copy 3D vector from 2D vector and one scalar.
 //		param v_xy: input 2D vector holding first two components
 //		param z: third element
 //		return: result vector
-ulvec3 ijkVecCopy3ulz(ulvec2 const v_xy, uintl const z);
+ijk_inl ulvec3 ijkVecCopy3ulz(ulvec2 const v_xy, uintl const z);
 
 // ijkVecCopy3*s
 //	Copy 3D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-ulvec3 ijkVecCopy3uls(uintl const s_in);
+ijk_inl ulvec3 ijkVecCopy3uls(uintl const s_in);
 
 // ijkVecNegate3*s
 //	Negate scalar to 3D vector.
 //		param s_in: input scalar
 //		return: result vector
-ilvec3 ijkVecNegate3uls(uintl const s_in);
+ijk_inl ilvec3 ijkVecNegate3uls(uintl const s_in);
 
 // ijkVecBitNot3*s
 //	Calculate bitwise 'not' of 3D vector.
 //		param s_in: input scalar
 //		return: result vector
-ulvec3 ijkVecBitNot3uls(uintl const s_in);
+ijk_inl ulvec3 ijkVecBitNot3uls(uintl const s_in);
 
 // ijkVecNot3*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec3 ijkVecNot3uls(uintl const s_in);
+ijk_inl bvec3 ijkVecNot3uls(uintl const s_in);
 
 // ijkVecAdd3*s
 //	Calculate sum of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecAdd3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecAdd3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecSub3*s
 //	Calculate difference of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecSub3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecSub3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecMul3*s
 //	Calculate product of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecMul3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecMul3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecDiv3*s
 //	Calculate quotient of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecDiv3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecDiv3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecDivSafe3*s
 //	Calculate quotient of 3D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecDivSafe3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecDivSafe3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecMod3*s
 //	Calculate remainder of 3D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecMod3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecMod3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecModSafe3*s
 //	Calculate remainder of 3D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecModSafe3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecModSafe3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecBitAnd3*s
 //	Calculate bitwise 'and' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecBitAnd3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecBitAnd3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecBitNand3*s
 //	Calculate bitwise 'not and' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecBitNand3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecBitNand3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecBitOr3*s
 //	Calculate bitwise 'or' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecBitOr3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecBitOr3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecBitNor3*s
 //	Calculate bitwise 'not or' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecBitNor3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecBitNor3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecBitXor3*s
 //	Calculate bitwise 'exclusive or' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecBitXor3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecBitXor3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecBitXnor3*s
 //	Calculate bitwise 'not exclusive or' of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecBitXnor3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecBitXnor3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecBitShiftLeft3*s
 //	Calculate bit shift left of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecBitShiftLeft3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecBitShiftLeft3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecBitShiftRight3*s
 //	Calculate bit shift right of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec3 ijkVecBitShiftRight3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl ulvec3 ijkVecBitShiftRight3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecEqual3*s
 //	Equality comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecEqual3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl bvec3 ijkVecEqual3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecInequal3*s
 //	Inequality comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecInequal3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl bvec3 ijkVecInequal3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecLessEqual3*s
 //	Less-than or equal comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecLessEqual3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl bvec3 ijkVecLessEqual3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecGreaterEqual3*s
 //	Greater-than or equal comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecLess3*s
 //	Less-than comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecLess3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl bvec3 ijkVecLess3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecGreater3*s
 //	Greater-than comparison of 3D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecGreater3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl bvec3 ijkVecGreater3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecAnd3*s
 //	Component-wise logical 'and' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecAnd3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl bvec3 ijkVecAnd3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecNand3*s
 //	Component-wise logical 'nand' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecNand3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl bvec3 ijkVecNand3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecOr3*s
 //	Component-wise logical 'or' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecOr3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl bvec3 ijkVecOr3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecNor3*s
 //	Component-wise logical 'nor' comparison of 3D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec3 ijkVecNor3uls(ulvec3 const v_lh, uintl const s_rh);
+ijk_inl bvec3 ijkVecNor3uls(ulvec3 const v_lh, uintl const s_rh);
 
 // ijkVecCopy3x*
 //	Copy 3D vector from 2D vector and one scalar.
 //		param x: first element
 //		param v_yz: input 2D vector holding last two components
 //		return: result vector
-ulvec3 ijkVecCopy3xul(uintl const x, ulvec2 const v_yz);
+ijk_inl ulvec3 ijkVecCopy3xul(uintl const x, ulvec2 const v_yz);
 
 // ijkVecAdd3s*
 //	Calculate sum of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecAdd3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecAdd3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecSub3s*
 //	Calculate difference of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecSub3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecSub3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecMul3s*
 //	Calculate product of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecMul3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecMul3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecDiv3s*
 //	Calculate quotient of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecDiv3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecDiv3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecDivSafe3s*
 //	Calculate quotient of scalar by 3D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecDivSafe3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecDivSafe3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecMod3s*
 //	Calculate remainder of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecMod3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecMod3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecModSafe3s*
 //	Calculate remainder of scalar by 3D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecModSafe3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecModSafe3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecBitAnd3s*
 //	Calculate bitwise 'and' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitAnd3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitAnd3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecBitNand3s*
 //	Calculate bitwise 'not and' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitNand3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitNand3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecBitOr3s*
 //	Calculate bitwise 'or' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitOr3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitOr3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecBitNor3s*
 //	Calculate bitwise 'not or' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitNor3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitNor3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecBitXor3s*
 //	Calculate bitwise 'exclusive or' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitXor3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitXor3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecBitXnor3s*
 //	Calculate bitwise 'not exclusive or' of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitXnor3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitXnor3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecBitShiftLeft3s*
 //	Calculate bit shift left of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitShiftLeft3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitShiftLeft3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecBitShiftRight3s*
 //	Calculate bit shift right of scalar by 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec3 ijkVecBitShiftRight3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecBitShiftRight3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecEqual3s*
 //	Equality comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecEqual3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecEqual3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecInequal3s*
 //	Inequality comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecInequal3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecInequal3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecLessEqual3s*
 //	Less-than or equal comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLessEqual3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecLessEqual3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecGreaterEqual3s*
 //	Greater-than or equal comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreaterEqual3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreaterEqual3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecLess3s*
 //	Less-than comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecLess3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecLess3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecGreater3s*
 //	Greater-than comparison of scalar and 3D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecGreater3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecGreater3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecAnd3s*
 //	Component-wise logical 'and' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecAnd3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecAnd3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecNand3s*
 //	Component-wise logical 'nand' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNand3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecNand3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecOr3s*
 //	Component-wise logical 'or' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecOr3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecOr3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecNor3s*
 //	Component-wise logical 'nor' comparison of 3D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec3 ijkVecNor3sul(uintl const s_lh, ulvec3 const v_rh);
+ijk_inl bvec3 ijkVecNor3sul(uintl const s_lh, ulvec3 const v_rh);
 
 // ijkVecDot3*
 //	Dot product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-uintl ijkVecDot3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl uintl ijkVecDot3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 // ijkVecCross3*
 //	Cross product of 3D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: cross product
-ulvec3 ijkVecCross3ul(ulvec3 const v_lh, ulvec3 const v_rh);
+ijk_inl ulvec3 ijkVecCross3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 
 
 //-----------------------------------------------------------------------------
@@ -3542,7 +3542,7 @@ ulvec3 ijkVecCross3ul(ulvec3 const v_lh, ulvec3 const v_rh);
 // ijkVecInit4*
 //	Initialize 4D vector to default value (zero vector).
 //		return: default vector
-ulvec4 ijkVecInit4ul();
+ijk_inl ulvec4 ijkVecInit4ul();
 
 // ijkVecInitElems4*
 //	Initialize 4D vector to specified individual elements.
@@ -3551,7 +3551,7 @@ ulvec4 ijkVecInit4ul();
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: result vector
-ulvec4 ijkVecInitElems4ul(uintl const x, uintl const y, uintl const z, uintl const w);
+ijk_inl ulvec4 ijkVecInitElems4ul(uintl const x, uintl const y, uintl const z, uintl const w);
 
 // ijkVecCopy4x*w
 //	Copy 4D vector from scalar, 2D vector and another scalar.
@@ -3559,213 +3559,213 @@ ulvec4 ijkVecInitElems4ul(uintl const x, uintl const y, uintl const z, uintl con
 //		param v_yz: input 2D vector holding middle two components
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: result vector
-ulvec4 ijkVecCopy4xulw(uintl const x, ulvec2 const v_yz, uintl const w);
+ijk_inl ulvec4 ijkVecCopy4xulw(uintl const x, ulvec2 const v_yz, uintl const w);
 
 // ijkVecCopy4*2
 //	Copy 4D vector from two 2D vectors.
 //		param v_xy: input 2D vector holding first two components
 //		param v_zw: input 2D vector holding last two components
 //		return: result vector
-ulvec4 ijkVecCopy4ul2(ulvec2 const v_xy, ulvec2 const v_zw);
+ijk_inl ulvec4 ijkVecCopy4ul2(ulvec2 const v_xy, ulvec2 const v_zw);
 
 // ijkVecCopy4*
 //	Copy 4D vector from first elements of another vector.
 //		param v_in: input vector
 //		return: result vector
-ulvec4 ijkVecCopy4ul(ulvec4 const v_in);
+ijk_inl ulvec4 ijkVecCopy4ul(ulvec4 const v_in);
 
 // ijkVecNegate4*
 //	Negate 4D vector.
 //		param v_in: input vector
 //		return: result vector
-ilvec4 ijkVecNegate4ul(ulvec4 const v_in);
+ijk_inl ilvec4 ijkVecNegate4ul(ulvec4 const v_in);
 
 // ijkVecBitNot4*
 //	Calculate component-wise bitwise 'not' of 4D vector.
 //		param v_in: input vector
 //		return: result vector
-ulvec4 ijkVecBitNot4ul(ulvec4 const v_in);
+ijk_inl ulvec4 ijkVecBitNot4ul(ulvec4 const v_in);
 
 // ijkVecNot4*
 //	Calculate component-wise logical 'not' of 4D vector.
 //		param v_in: input vector
 //		return: comparison vector
-bvec4 ijkVecNot4ul(ulvec4 const v_in);
+ijk_inl bvec4 ijkVecNot4ul(ulvec4 const v_in);
 
 // ijkVecAdd4*
 //	Calculate sum of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecAdd4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecAdd4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecSub4*
 //	Calculate difference of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecSub4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecSub4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecMul4*
 //	Calculate component-wise product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecMul4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecMul4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecDiv4*
 //	Calculate component-wise quotient of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecDiv4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecDiv4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecDivSafe4*
 //	Calculate component-wise quotient of 4D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecDivSafe4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecDivSafe4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecMod4*
 //	Calculate component-wise remainder of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecMod4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecMod4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecModSafe4*
 //	Calculate component-wise remainder of 4D vectors, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecModSafe4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecModSafe4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecBitAnd4*
 //	Calculate component-wise bitwise 'and' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitAnd4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitAnd4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecBitNand4*
 //	Calculate component-wise bitwise 'not and' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitNand4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitNand4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecBitOr4*
 //	Calculate component-wise bitwise 'or' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitOr4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitOr4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecBitNor4*
 //	Calculate component-wise bitwise 'not or' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitNor4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitNor4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecBitXor4*
 //	Calculate component-wise bitwise 'exclusive or' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitXor4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitXor4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecBitXnor4*
 //	Calculate component-wise bitwise 'not exclusive or' of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitXnor4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitXnor4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecBitShiftLeft4*
 //	Calculate component-wise bit shift left of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitShiftLeft4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitShiftLeft4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecBitShiftRight4*
 //	Calculate component-wise bit shift right of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitShiftRight4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitShiftRight4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecEqual4*
 //	Equality comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecEqual4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecEqual4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecInequal4*
 //	Inequality comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecInequal4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecInequal4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecLessEqual4*
 //	Less-than or equal comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLessEqual4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecLessEqual4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecGreaterEqual4*
 //	Greater-than or equal comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecLess4*
 //	Less-than comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLess4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecLess4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecGreater4*
 //	Greater-than comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreater4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreater4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecAnd4*
 //	Component-wise logical 'and' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecAnd4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecAnd4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecNand4*
 //	Component-wise logical 'nand' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNand4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecNand4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecOr4*
 //	Component-wise logical 'or' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecOr4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecOr4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecNor4*
 //	Component-wise logical 'nor' comparison for 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNor4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecNor4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecCopy4*zw
 //	Copy 4D vector from 2D vector and two scalars.
@@ -3773,213 +3773,213 @@ bvec4 ijkVecNor4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 //		param z: third element
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: result vector
-ulvec4 ijkVecCopy4ulzw(ulvec2 const v_xy, uintl const z, uintl const w);
+ijk_inl ulvec4 ijkVecCopy4ulzw(ulvec2 const v_xy, uintl const z, uintl const w);
 
 // ijkVecCopy4*w
 //	Copy 4D vector from 3D vector and one scalar.
 //		param v_xyz: input 3D vector holding first three components
 //		param w: fourth element (in space, set as 1 for pouint, 0 for vector)
 //		return: result vector
-ulvec4 ijkVecCopy4ulw(ulvec3 const v_xyz, uintl const w);
+ijk_inl ulvec4 ijkVecCopy4ulw(ulvec3 const v_xyz, uintl const w);
 
 // ijkVecCopy4*s
 //	Copy 4D vector from scalar.
 //		param s_in: input scalar
 //		return: result vector
-ulvec4 ijkVecCopy4uls(uintl const s_in);
+ijk_inl ulvec4 ijkVecCopy4uls(uintl const s_in);
 
 // ijkVecNegate4*s
 //	Negate scalar to 4D vector.
 //		param s_in: input scalar
 //		return: result vector
-ilvec4 ijkVecNegate4uls(uintl const s_in);
+ijk_inl ilvec4 ijkVecNegate4uls(uintl const s_in);
 
 // ijkVecBitNot4*s
 //	Calculate bitwise 'not' of 4D vector.
 //		param s_in: input scalar
 //		return: result vector
-ulvec4 ijkVecBitNot4uls(uintl const s_in);
+ijk_inl ulvec4 ijkVecBitNot4uls(uintl const s_in);
 
 // ijkVecNot4*s
 //	Calculate logical 'not' of scalar.
 //		param s_in: input scalar
 //		return: comparison vector
-bvec4 ijkVecNot4uls(uintl const s_in);
+ijk_inl bvec4 ijkVecNot4uls(uintl const s_in);
 
 // ijkVecAdd4*s
 //	Calculate sum of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecAdd4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecAdd4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecSub4*s
 //	Calculate difference of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecSub4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecSub4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecMul4*s
 //	Calculate product of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecMul4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecMul4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecDiv4*s
 //	Calculate quotient of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecDiv4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecDiv4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecDivSafe4*s
 //	Calculate quotient of 4D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecDivSafe4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecDivSafe4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecMod4*s
 //	Calculate remainder of 4D vector components by scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecMod4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecMod4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecModSafe4*s
 //	Calculate remainder of 4D vector components by scalar, division-by-zero safe.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecModSafe4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecModSafe4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecBitAnd4*s
 //	Calculate bitwise 'and' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecBitAnd4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecBitAnd4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecBitNand4*s
 //	Calculate bitwise 'not and' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecBitNand4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecBitNand4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecBitOr4*s
 //	Calculate bitwise 'or' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecBitOr4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecBitOr4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecBitNor4*s
 //	Calculate bitwise 'not or' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecBitNor4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecBitNor4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecBitXor4*s
 //	Calculate bitwise 'exclusive or' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecBitXor4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecBitXor4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecBitXnor4*s
 //	Calculate bitwise 'not exclusive or' of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecBitXnor4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecBitXnor4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecBitShiftLeft4*s
 //	Calculate bit shift left of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecBitShiftLeft4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecBitShiftLeft4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecBitShiftRight4*s
 //	Calculate bit shift right of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: result vector
-ulvec4 ijkVecBitShiftRight4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl ulvec4 ijkVecBitShiftRight4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecEqual4*s
 //	Equality comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecEqual4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl bvec4 ijkVecEqual4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecInequal4*s
 //	Inequality comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecInequal4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl bvec4 ijkVecInequal4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecLessEqual4*s
 //	Less-than or equal comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecLessEqual4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl bvec4 ijkVecLessEqual4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecGreaterEqual4*s
 //	Greater-than or equal comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecLess4*s
 //	Less-than comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecLess4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl bvec4 ijkVecLess4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecGreater4*s
 //	Greater-than comparison of 4D vector components and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecGreater4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl bvec4 ijkVecGreater4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecAnd4*s
 //	Component-wise logical 'and' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecAnd4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl bvec4 ijkVecAnd4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecNand4*s
 //	Component-wise logical 'nand' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecNand4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl bvec4 ijkVecNand4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecOr4*s
 //	Component-wise logical 'or' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecOr4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl bvec4 ijkVecOr4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecNor4*s
 //	Component-wise logical 'nor' comparison of 4D vector and scalar.
 //		param v_lh: left-hand vector
 //		param s_rh: right-hand scalar
 //		return: comparison vector
-bvec4 ijkVecNor4uls(ulvec4 const v_lh, uintl const s_rh);
+ijk_inl bvec4 ijkVecNor4uls(ulvec4 const v_lh, uintl const s_rh);
 
 // ijkVecCopy4xy*
 //	Copy 4D vector from two scalars and 2D vector.
@@ -3987,203 +3987,203 @@ bvec4 ijkVecNor4uls(ulvec4 const v_lh, uintl const s_rh);
 //		param y: second element
 //		param v_zw: input 2D vector holding last two components
 //		return: result vector
-ulvec4 ijkVecCopy4xyul(uintl const x, uintl const y, ulvec2 const v_zw);
+ijk_inl ulvec4 ijkVecCopy4xyul(uintl const x, uintl const y, ulvec2 const v_zw);
 
 // ijkVecCopy4x*
 //	Copy 4D vector from one scalar and 3D vector.
 //		param x: first element
 //		param v_yzw: input 3D vector holding last three components
 //		return: result vector
-ulvec4 ijkVecCopy4xul(uintl const x, ulvec3 const v_yzw);
+ijk_inl ulvec4 ijkVecCopy4xul(uintl const x, ulvec3 const v_yzw);
 
 // ijkVecAdd4s*
 //	Calculate sum of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecAdd4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecAdd4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecSub4s*
 //	Calculate difference of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecSub4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecSub4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecMul4s*
 //	Calculate product of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecMul4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecMul4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecDiv4s*
 //	Calculate quotient of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecDiv4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecDiv4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecDivSafe4s*
 //	Calculate quotient of scalar by 4D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecDivSafe4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecDivSafe4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecMod4s*
 //	Calculate remainder of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecMod4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecMod4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecModSafe4s*
 //	Calculate remainder of scalar by 4D vector components, division-by-zero safe.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecModSafe4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecModSafe4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecBitAnd4s*
 //	Calculate bitwise 'and' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitAnd4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitAnd4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecBitNand4s*
 //	Calculate bitwise 'not and' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitNand4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitNand4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecBitOr4s*
 //	Calculate bitwise 'or' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitOr4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitOr4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecBitNor4s*
 //	Calculate bitwise 'not or' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitNor4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitNor4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecBitXor4s*
 //	Calculate bitwise 'exclusive or' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitXor4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitXor4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecBitXnor4s*
 //	Calculate bitwise 'not exclusive or' of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitXnor4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitXnor4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecBitShiftLeft4s*
 //	Calculate bit shift left of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitShiftLeft4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitShiftLeft4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecBitShiftRight4s*
 //	Calculate bit shift right of scalar by 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: result vector
-ulvec4 ijkVecBitShiftRight4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecBitShiftRight4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecEqual4s*
 //	Equality comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecEqual4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecEqual4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecInequal4s*
 //	Inequality comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecInequal4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecInequal4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecLessEqual4s*
 //	Less-than or equal comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLessEqual4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecLessEqual4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecGreaterEqual4s*
 //	Greater-than or equal comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreaterEqual4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreaterEqual4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecLess4s*
 //	Less-than comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecLess4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecLess4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecGreater4s*
 //	Greater-than comparison of scalar and 4D vector components.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecGreater4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecGreater4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecAnd4s*
 //	Component-wise logical 'and' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecAnd4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecAnd4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecNand4s*
 //	Component-wise logical 'nand' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNand4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecNand4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecOr4s*
 //	Component-wise logical 'or' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecOr4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecOr4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecNor4s*
 //	Component-wise logical 'nor' comparison of 4D vector and scalar.
 //		param s_lh: left-hand scalar
 //		param v_rh: right-hand vector
 //		return: comparison vector
-bvec4 ijkVecNor4sul(uintl const s_lh, ulvec4 const v_rh);
+ijk_inl bvec4 ijkVecNor4sul(uintl const s_lh, ulvec4 const v_rh);
 
 // ijkVecDot4*
 //	Dot product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: dot product
-uintl ijkVecDot4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl uintl ijkVecDot4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 // ijkVecCross4*
 //	Cross product of 4D vectors.
 //		param v_lh: left-hand vector
 //		param v_rh: right-hand vector
 //		return: cross product (fourth component is zero)
-ulvec4 ijkVecCross4ul(ulvec4 const v_lh, ulvec4 const v_rh);
+ijk_inl ulvec4 ijkVecCross4ul(ulvec4 const v_lh, ulvec4 const v_rh);
 
 
 //-----------------------------------------------------------------------------
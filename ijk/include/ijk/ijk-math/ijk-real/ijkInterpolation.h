@@ -43,7 +43,7 @@ extern "C" {
 //		param v1: terminal reference value/end point, result when t>=0.5
 //		param t: interpolation parameter
 //		return: nearest-neighbor interpolated value, exactly v0 or v1
-flt ijkInterpNearest_flt(flt const v0, flt const v1, flt const t);
+ijk_inl flt ijkInterpNearest_flt(flt const v0, flt const v1, flt const t);
 
 // ijkInterpBinearest_flt
 //	Nearest-neighbor interpolation of nearest-neighbor interpolated values.
@@ -59,7 +59,7 @@ flt ijkInterpNearest_flt(flt const v0, flt const v1, flt const t);
 //		param t1: interpolation parameter for second pair
 //		param t: interpolation parameter for results
 //		return: bi-nearest-neighbor interpolated value
-flt ijkInterpBinearest_flt(flt const v00, flt const v01, flt const v10, flt const v11, flt const t0, flt const t1, flt const t);
+ijk_inl flt ijkInterpBinearest_flt(flt const v00, flt const v01, flt const v10, flt const v11, flt const t0, flt const t1, flt const t);
 
 // ijkInterpLinear_flt
 //	Linear interpolation ("LERP") between two reference values.
@@ -68,7 +68,7 @@ flt ijkInterpBinearest_flt(flt const v00, flt const v01, flt const v10, flt cons
 //		param t: interpolation parameter; inputs in [0,1] interpolate in 
 //			[v0,v1], others yield extrapolation beyond reference values
 //		return: interpolated value between v0 and v1
-flt ijkInterpLinear_flt(flt const v0, flt const v1, flt const t);
+ijk_inl flt ijkInterpLinear_flt(flt const v0, flt const v1, flt const t);
 
 // ijkInterpBilinear_flt
 //	Bi-linear interpolation between two pairs of reference values.
@@ -84,7 +84,7 @@ flt ijkInterpLinear_flt(flt const v0, flt const v1, flt const t);
 //		param t1: interpolation parameter for second pair
 //		param t: interpolation parameter for results
 //		return: interpolated value
-flt ijkInterpBilinear_flt(flt const v00, flt const v01, flt const v10, flt const v11, flt const t0, flt const t1, flt const t);
+ijk_inl flt ijkInterpBilinear_flt(flt const v00, flt const v01, flt const v10, flt const v11, flt const t0, flt const t1, flt const t);
 
 // ijkInterpLinearInv_flt
 //	Inverse linear interpolation between two reference values to get parameter.
@@ -94,7 +94,7 @@ flt ijkInterpBilinear_flt(flt const v00, flt const v01, flt const v10, flt const
 //			in [0,1] used for interpolation, others yield parameters beyond 
 //			unit range used for extrapolation
 //		return: interpolation parameter used to interpolate between v0 and v1
-flt ijkInterpLinearInv_flt(flt const v0, flt const v1, flt const v);
+ijk_inl flt ijkInterpLinearInv_flt(flt const v0, flt const v1, flt const v);
 
 // ijkInterpLinearInvSafe_flt
 //	Inverse linear interpolation between two reference values to get parameter 
@@ -105,7 +105,7 @@ flt ijkInterpLinearInv_flt(flt const v0, flt const v1, flt const v);
 //			in [0,1] used for interpolation, others yield parameters beyond 
 //			unit range used for extrapolation
 //		return: interpolation parameter used to interpolate between v0 and v1
-flt ijkInterpLinearInvSafe_flt(flt const v0, flt const v1, flt const v);
+ijk_inl flt ijkInterpLinearInvSafe_flt(flt const v0, flt const v1, flt const v);
 
 // ijkInterpRemap_flt
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -119,7 +119,7 @@ flt ijkInterpLinearInvSafe_flt(flt const v0, flt const v1, flt const v);
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: value in original range remapped to target range
-flt ijkInterpRemap_flt(flt const v0_dst, flt const v1_dst, flt const v0_src, flt const v1_src, flt const v_src);
+ijk_inl flt ijkInterpRemap_flt(flt const v0_dst, flt const v1_dst, flt const v0_src, flt const v1_src, flt const v_src);
 
 // ijkInterpRemapSafe_flt
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -133,7 +133,7 @@ flt ijkInterpRemap_flt(flt const v0_dst, flt const v1_dst, flt const v0_src, flt
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: value in original range remapped to target range
-flt ijkInterpRemapSafe_flt(flt const v0_dst, flt const v1_dst, flt const v0_src, flt const v1_src, flt const v_src);
+ijk_inl flt ijkInterpRemapSafe_flt(flt const v0_dst, flt const v1_dst, flt const v0_src, flt const v1_src, flt const v_src);
 
 // ijkInterpLinearRev0_flt
 //	Reverse linear interpolation to get first control value.
@@ -144,7 +144,7 @@ flt ijkInterpRemapSafe_flt(flt const v0_dst, flt const v1_dst, flt const v0_src,
 //		param t: interpolation parameter; inputs in [0,1] interpolate in 
 //			[v0,v1], others yield extrapolation beyond reference values
 //		return: first control value, v0
-flt ijkInterpLinearRev0_flt(flt const v, flt const v1, flt const t);
+ijk_inl flt ijkInterpLinearRev0_flt(flt const v, flt const v1, flt const t);
 
 // ijkInterpLinearRevSafe0_flt
 //	Reverse linear interpolation to get first control value; division-by-zero
@@ -156,7 +156,7 @@ flt ijkInterpLinearRev0_flt(flt const v, flt const v1, flt const t);
 //		param t: interpolation parameter; inputs in [0,1] interpolate in 
 //			[v0,v1], others yield extrapolation beyond reference values
 //		return: first control value, v0
-flt ijkInterpLinearRevSafe0_flt(flt const v, flt const v1, flt const t);
+ijk_inl flt ijkInterpLinearRevSafe0_flt(flt const v, flt const v1, flt const t);
 
 // ijkInterpLinearRev1_flt
 //	Reverse linear interpolation to get second control value.
@@ -167,7 +167,7 @@ flt ijkInterpLinearRevSafe0_flt(flt const v, flt const v1, flt const t);
 //		param t: interpolation parameter; inputs in [0,1] interpolate in 
 //			[v0,v1], others yield extrapolation beyond reference values
 //		return: second control value, v1
-flt ijkInterpLinearRev1_flt(flt const v0, flt const v, flt const t);
+ijk_inl flt ijkInterpLinearRev1_flt(flt const v0, flt const v, flt const t);
 
 // ijkInterpLinearRevSafe1_flt
 //	Reverse linear interpolation to get second control value; division-by-zero
@@ -179,28 +179,28 @@ flt ijkInterpLinearRev1_flt(flt const v0, flt const v, flt const t);
 //		param t: interpolation parameter; inputs in [0,1] interpolate in 
 //			[v0,v1], others yield extrapolation beyond reference values
 //		return: second control value, v1
-flt ijkInterpLinearRevSafe1_flt(flt const v0, flt const v, flt const t);
+ijk_inl flt ijkInterpLinearRevSafe1_flt(flt const v0, flt const v, flt const t);
 
 // ijkInterpSmoothstep_flt
 //	Smoothstep for parameter.
 //		param t: interpolation parameter; inputs in [0,1] interpolate in 
 //			[0,1], others yield extrapolation beyond reference values
 //		return: interpolated value between 0 and 1
-flt ijkInterpSmoothstep_flt(flt const t);
+ijk_inl flt ijkInterpSmoothstep_flt(flt const t);
 
 // ijkInterpSmootherstep_flt
 //	Smootherstep for parameter.
 //		param t: interpolation parameter; inputs in [0,1] interpolate in 
 //			[0,1], others yield extrapolation beyond reference values
 //		return: interpolated value between 0 and 1
-flt ijkInterpSmootherstep_flt(flt const t);
+ijk_inl flt ijkInterpSmootherstep_flt(flt const t);
 
 // ijkInterpBezier0_flt
 //	Perform order-0 (point) Bezier interpolation given one reference value.
 //		param v0: reference value, always returned
 //		param t: interpolation parameter; not used for order 0 interpolation
 //		return: v0
-flt ijkInterpBezier0_flt(flt const v0, flt const t);
+ijk_inl flt ijkInterpBezier0_flt(flt const v0, flt const t);
 
 // ijkInterpBezier1_flt
 //	Perform order-1 (linear) Bezier interpolation given two reference values.
@@ -209,7 +209,7 @@ flt ijkInterpBezier0_flt(flt const v0, flt const t);
 //		param t: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: linear interpolation between v0 and v1
-flt ijkInterpBezier1_flt(flt const v0, flt const v1, flt const t);
+ijk_inl flt ijkInterpBezier1_flt(flt const v0, flt const v1, flt const t);
 
 // ijkInterpBezier2_flt
 //	Perform order-2 (quadratic) Bezier interpolation given three reference 
@@ -220,7 +220,7 @@ flt ijkInterpBezier1_flt(flt const v0, flt const v1, flt const t);
 //		param t: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v2
 //		return: quadratic Bezier interpolation between v0 and v2
-flt ijkInterpBezier2_flt(flt const v0, flt const v1, flt const v2, flt const t);
+ijk_inl flt ijkInterpBezier2_flt(flt const v0, flt const v1, flt const v2, flt const t);
 
 // ijkInterpBezier3_flt
 //	Perform order-3 (cubic) Bezier interpolation given four reference values.
@@ -231,7 +231,7 @@ flt ijkInterpBezier2_flt(flt const v0, flt const v1, flt const v2, flt const t);
 //		param t: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v3
 //		return: cubic Bezier interpolation between v0 and v3
-flt ijkInterpBezier3_flt(flt const v0, flt const v1, flt const v2, flt const v3, flt const t);
+ijk_inl flt ijkInterpBezier3_flt(flt const v0, flt const v1, flt const v2, flt const v3, flt const t);
 
 // ijkInterpBezierN_flt
 //	Perform order-N (recursive) Bezier interpolation given an array of 
@@ -244,7 +244,7 @@ flt ijkInterpBezier3_flt(flt const v0, flt const v1, flt const v2, flt const v3,
 //		param t: interpolation parameter; inputs in [0,1] interpolate between 
 //			v[0] and v[order]
 //		return: recursive Bezier interpolation between v[0] and v[order]
-flt ijkInterpBezierN_flt(flt const v[], size const order, flt const t);
+ijk_inl flt ijkInterpBezierN_flt(flt const v[], size const order, flt const t);
 
 // ijkInterpCubicHermite_flt
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -256,7 +256,7 @@ flt ijkInterpBezierN_flt(flt const v[], size const order, flt const t);
 //		param t: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated value on spline/curve segment
-flt ijkInterpCubicHermite_flt(flt const v0, flt const dv0, flt const v1, flt const dv1, flt const t);
+ijk_inl flt ijkInterpCubicHermite_flt(flt const v0, flt const dv0, flt const v1, flt const dv1, flt const t);
 
 // ijkInterpCubicHermiteHandles_flt
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -270,7 +270,7 @@ flt ijkInterpCubicHermite_flt(flt const v0, flt const dv0, flt const v1, flt con
 //		param t: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated value on spline/curve segment
-flt ijkInterpCubicHermiteHandles_flt(flt const v0, flt const cv0, flt const v1, flt const cv1, flt const t);
+ijk_inl flt ijkInterpCubicHermiteHandles_flt(flt const v0, flt const cv0, flt const v1, flt const cv1, flt const t);
 
 // ijkInterpCubicCatmullRom_flt
 //	Catmull-Rom spline/curve interpolation between two reference values with 
@@ -282,7 +282,7 @@ flt ijkInterpCubicHermiteHandles_flt(flt const v0, flt const cv0, flt const v1,
 //		param t: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated value on spline/curve segment
-flt ijkInterpCubicCatmullRom_flt(flt const vp, flt const v0, flt const v1, flt const v2, flt const t);
+ijk_inl flt ijkInterpCubicCatmullRom_flt(flt const vp, flt const v0, flt const v1, flt const v2, flt const t);
 
 // ijkInterpBicubicCatmullRom_flt
 //	Bi-cubic interpolation using Catmull-Rom interpolation for segments.
@@ -316,7 +316,7 @@ flt ijkInterpCubicCatmullRom_flt(flt const vp, flt const v0, flt const v1, flt c
 //		param t2: interpolation parameter for terminal control curve
 //		param t: interpolation parameter for result
 //		return: interpolated value
-flt ijkInterpBicubicCatmullRom_flt(flt const vpp, flt const vp0, flt const vp1, flt const vp2, flt const v0p, flt const v00, flt const v01, flt const v02, flt const v1p, flt const v10, flt const v11, flt const v12, flt const v2p, flt const v20, flt const v21, flt const v22, flt const tp, flt const t0, flt const t1, flt const t2, flt const t);
+ijk_inl flt ijkInterpBicubicCatmullRom_flt(flt const vpp, flt const vp0, flt const vp1, flt const vp2, flt const v0p, flt const v00, flt const v01, flt const v02, flt const v1p, flt const v10, flt const v11, flt const v12, flt const v2p, flt const v20, flt const v21, flt const v22, flt const tp, flt const t0, flt const t1, flt const t2, flt const t);
 
 // ijkInterpReparamCubicHermite_flt
 //	Reparameterize a cubic Hermite segment into sample table.
@@ -336,7 +336,7 @@ flt ijkInterpBicubicCatmullRom_flt(flt const vpp, flt const vp0, flt const vp1,
 //		param v1: terminal reference value/end point, result when t=1
 //		param dv1: terminal tangent/rate of change
 //		return: total arc length
-flt ijkInterpReparamCubicHermite_flt(flt tTable_out[], flt lTable_out[], flt vTable_out[], size const numDivisions, ibool const lNormalize, flt const v0, flt const dv0, flt const v1, flt const dv1);
+ijk_inl flt ijkInterpReparamCubicHermite_flt(flt tTable_out[], flt lTable_out[], flt vTable_out[], size const numDivisions, ibool const lNormalize, flt const v0, flt const dv0, flt const v1, flt const dv1);
 
 // ijkInterpReparamCubicHermiteHandles_flt
 //	Reparameterize a cubic Hermite segment with handles into sample table.
@@ -358,7 +358,7 @@ flt ijkInterpReparamCubicHermite_flt(flt tTable_out[], flt lTable_out[], flt vTa
 //		param cv1: terminal control handle value, should be greater than v1 
 //			for a positive rate of change
 //		return: total arc length
-flt ijkInterpReparamCubicHermiteHandles_flt(flt tTable_out[], flt lTable_out[], flt vTable_out[], size const numDivisions, ibool const lNormalize, flt const v0, flt const cv0, flt const v1, flt const cv1);
+ijk_inl flt ijkInterpReparamCubicHermiteHandles_flt(flt tTable_out[], flt lTable_out[], flt vTable_out[], size const numDivisions, ibool const lNormalize, flt const v0, flt const cv0, flt const v1, flt const cv1);
 
 // ijkInterpReparamCubicCatmullRom_flt
 //	Reparameterize a cubic Catmull-Rom segment into sample table.
@@ -378,7 +378,7 @@ flt ijkInterpReparamCubicHermiteHandles_flt(flt tTable_out[], flt lTable_out[],
 //		param v1: terminal reference value/end point, result when t=1
 //		param v2: terminal control value
 //		return: total arc length
-flt ijkInterpReparamCubicCatmullRom_flt(flt tTable_out[], flt lTable_out[], flt vTable_out[], size const numDivisions, ibool const lNormalize, flt const vp, flt const v0, flt const v1, flt const v2);
+ijk_inl flt ijkInterpReparamCubicCatmullRom_flt(flt tTable_out[], flt lTable_out[], flt vTable_out[], size const numDivisions, ibool const lNormalize, flt const vp, flt const v0, flt const v1, flt const v2);
 
 // ijkInterpReparamBicubicCatmullRom_flt
 //	Reparameterize a bi-cubic Catmull-Rom segment into sample table.
@@ -422,7 +422,7 @@ flt ijkInterpReparamCubicCatmullRom_flt(flt tTable_out[], flt lTable_out[], flt
 //		param t1: interpolation parameter for terminal value curve
 //		param t2: interpolation parameter for terminal control curve
 //		return: total arc length
-flt ijkInterpReparamBicubicCatmullRom_flt(flt tTable_out[], flt lTable_out[], flt vTable_out[], size const numDivisions, ibool const lNormalize, flt const vpp, flt const vp0, flt const vp1, flt const vp2, flt const v0p, flt const v00, flt const v01, flt const v02, flt const v1p, flt const v10, flt const v11, flt const v12, flt const v2p, flt const v20, flt const v21, flt const v22, flt const tp, flt const t0, flt const t1, flt const t2);
+ijk_inl flt ijkInterpReparamBicubicCatmullRom_flt(flt tTable_out[], flt lTable_out[], flt vTable_out[], size const numDivisions, ibool const lNormalize, flt const vpp, flt const vp0, flt const vp1, flt const vp2, flt const v0p, flt const v00, flt const v01, flt const v02, flt const v1p, flt const v10, flt const v11, flt const v12, flt const v2p, flt const v20, flt const v21, flt const v22, flt const tp, flt const t0, flt const t1, flt const t2);
 
 // ijkInterpSampleTableInc_flt
 //	Find index of parameter in table and approximate value by interpolating 
@@ -439,7 +439,7 @@ flt ijkInterpReparamBicubicCatmullRom_flt(flt tTable_out[], flt lTable_out[], fl
 //			note: defaults to 1 if passed 0
 //		param t: input parameter to find in search table
 //		return: interpolated value in table that approximates input parameter
-flt ijkInterpSampleTableInc_flt(flt const tTable[], flt const vTable[], index i, index di, flt const t);
+ijk_inl flt ijkInterpSampleTableInc_flt(flt const tTable[], flt const vTable[], index i, index di, flt const t);
 
 // ijkInterpSampleTableDec_flt
 //	Find index of parameter in table and approximate value by interpolating 
@@ -456,7 +456,7 @@ flt ijkInterpSampleTableInc_flt(flt const tTable[], flt const vTable[], index i,
 //			note: defaults to 1 if passed 0
 //		param t: input parameter to find in search table
 //		return: interpolated value in table that approximates input parameter
-flt ijkInterpSampleTableDec_flt(flt const tTable[], flt const vTable[], index i, index di, flt const t);
+ijk_inl flt ijkInterpSampleTableDec_flt(flt const tTable[], flt const vTable[], index i, index di, flt const t);
 
 // ijkInterpSampleTableIncIndex_flt
 //	Find index of parameter in table and retrieve interpolation parameter for 
@@ -475,7 +475,7 @@ flt ijkInterpSampleTableDec_flt(flt const tTable[], flt const vTable[], index i,
 //			note: defaults to 1 if passed 0
 //		param t: input parameter to find in search table
 //		return: index of interpolation parameter discovered
-index ijkInterpSampleTableIncIndex_flt(flt* const tReparam_out, flt const tTable[], index i, index di, flt const t);
+ijk_inl index ijkInterpSampleTableIncIndex_flt(flt* const tReparam_out, flt const tTable[], index i, index di, flt const t);
 
 // ijkInterpSampleTableDecIndex_flt
 //	Find index of parameter in table and approximate value by interpolating 
@@ -494,7 +494,7 @@ index ijkInterpSampleTableIncIndex_flt(flt* const tReparam_out, flt const tTable
 //			note: defaults to 1 if passed 0
 //		param t: input parameter to find in search table
 //		return: index of interpolation parameter discovered
-index ijkInterpSampleTableDecIndex_flt(flt* const tReparam_out, flt const tTable[], index i, index di, flt const t);
+ijk_inl index ijkInterpSampleTableDecIndex_flt(flt* const tReparam_out, flt const tTable[], index i, index di, flt const t);
 
 
 //-----------------------------------------------------------------------------
@@ -505,7 +505,7 @@ index ijkInterpSampleTableDecIndex_flt(flt* const tReparam_out, flt const tTable
 //		param v1: terminal reference value/end point, result when t>=0.5
 //		param t: interpolation parameter
 //		return: nearest-neighbor interpolated value, exactly v0 or v1
-dbl ijkInterpNearest_dbl(dbl const v0, dbl const v1, dbl const t);
+ijk_inl dbl ijkInterpNearest_dbl(dbl const v0, dbl const v1, dbl const t);
 
 // ijkInterpBinearest_dbl
 //	Nearest-neighbor interpolation of nearest-neighbor interpolated values.
@@ -521,7 +521,7 @@ dbl ijkInterpNearest_dbl(dbl const v0, dbl const v1, dbl const t);
 //		param t1: interpolation parameter for second pair
 //		param t: interpolation parameter for results
 //		return: bi-nearest-neighbor interpolated value
-dbl ijkInterpBinearest_dbl(dbl const v00, dbl const v01, dbl const v10, dbl const v11, dbl const t0, dbl const t1, dbl const t);
+ijk_inl dbl ijkInterpBinearest_dbl(dbl const v00, dbl const v01, dbl const v10, dbl const v11, dbl const t0, dbl const t1, dbl const t);
 
 // ijkInterpLinear_dbl
 //	Linear interpolation ("LERP") between two reference values.
@@ -530,7 +530,7 @@ dbl ijkInterpBinearest_dbl(dbl const v00, dbl const v01, dbl const v10, dbl cons
 //		param t: interpolation parameter; inputs in [0,1] interpolate in 
 //			[v0,v1], others yield extrapolation beyond reference values
 //		return: interpolated value between v0 and v1
-dbl ijkInterpLinear_dbl(dbl const v0, dbl const v1, dbl const t);
+ijk_inl dbl ijkInterpLinear_dbl(dbl const v0, dbl const v1, dbl const t);
 
 // ijkInterpBilinear_dbl
 //	Bi-linear interpolation between two pairs of reference values.
@@ -546,7 +546,7 @@ dbl ijkInterpLinear_dbl(dbl const v0, dbl const v1, dbl const t);
 //		param t1: interpolation parameter for second pair
 //		param t: interpolation parameter for results
 //		return: interpolated value
-dbl ijkInterpBilinear_dbl(dbl const v00, dbl const v01, dbl const v10, dbl const v11, dbl const t0, dbl const t1, dbl const t);
+ijk_inl dbl ijkInterpBilinear_dbl(dbl const v00, dbl const v01, dbl const v10, dbl const v11, dbl const t0, dbl const t1, dbl const t);
 
 // ijkInterpLinearInv_dbl
 //	Inverse linear interpolation between two reference values to get parameter.
@@ -556,7 +556,7 @@ dbl ijkInterpBilinear_dbl(dbl const v00, dbl const v01, dbl const v10, dbl const
 //			in [0,1] used for interpolation, others yield parameters beyond 
 //			unit range used for extrapolation
 //		return: interpolation parameter used to interpolate between v0 and v1
-dbl ijkInterpLinearInv_dbl(dbl const v0, dbl const v1, dbl const v);
+ijk_inl dbl ijkInterpLinearInv_dbl(dbl const v0, dbl const v1, dbl const v);
 
 // ijkInterpLinearInvSafe_dbl
 //	Inverse linear interpolation between two reference values to get parameter 
@@ -567,7 +567,7 @@ dbl ijkInterpLinearInv_dbl(dbl const v0, dbl const v1, dbl const v);
 //			in [0,1] used for interpolation, others yield parameters beyond 
 //			unit range used for extrapolation
 //		return: interpolation parameter used to interpolate between v0 and v1
-dbl ijkInterpLinearInvSafe_dbl(dbl const v0, dbl const v1, dbl const v);
+ijk_inl dbl ijkInterpLinearInvSafe_dbl(dbl const v0, dbl const v1, dbl const v);
 
 // ijkInterpRemap_dbl
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -581,7 +581,7 @@ dbl ijkInterpLinearInvSafe_dbl(dbl const v0, dbl const v1, dbl const v);
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: value in original range remapped to target range
-dbl ijkInterpRemap_dbl(dbl const v0_dst, dbl const v1_dst, dbl const v0_src, dbl const v1_src, dbl const v_src);
+ijk_inl dbl ijkInterpRemap_dbl(dbl const v0_dst, dbl const v1_dst, dbl const v0_src, dbl const v1_src, dbl const v_src);
 
 // ijkInterpRemapSafe_dbl
 //	Linear remap between two ranges by first inverse interpolating between 
@@ -595,7 +595,7 @@ dbl ijkInterpRemap_dbl(dbl const v0_dst, dbl const v1_dst, dbl const v0_src, dbl
 //		param v1_src: terminal reference value in source/original range
 //		param v_src: value to be remapped from original to target range
 //		return: value in original range remapped to target range
-dbl ijkInterpRemapSafe_dbl(dbl const v0_dst, dbl const v1_dst, dbl const v0_src, dbl const v1_src, dbl const v_src);
+ijk_inl dbl ijkInterpRemapSafe_dbl(dbl const v0_dst, dbl const v1_dst, dbl const v0_src, dbl const v1_src, dbl const v_src);
 
 // ijkInterpLinearRev0_dbl
 //	Reverse linear interpolation to get first control value.
@@ -606,7 +606,7 @@ dbl ijkInterpRemapSafe_dbl(dbl const v0_dst, dbl const v1_dst, dbl const v0_src,
 //		param t: interpolation parameter; inputs in [0,1] interpolate in 
 //			[v0,v1], others yield extrapolation beyond reference values
 //		return: first control value, v0
-dbl ijkInterpLinearRev0_dbl(dbl const v, dbl const v1, dbl const t);
+ijk_inl dbl ijkInterpLinearRev0_dbl(dbl const v, dbl const v1, dbl const t);
 
 // ijkInterpLinearRevSafe0_dbl
 //	Reverse linear interpolation to get first control value; division-by-zero
@@ -618,7 +618,7 @@ dbl ijkInterpLinearRev0_dbl(dbl const v, dbl const v1, dbl const t);
 //		param t: interpolation parameter; inputs in [0,1] interpolate in 
 //			[v0,v1], others yield extrapolation beyond reference values
 //		return: first control value, v0
-dbl ijkInterpLinearRevSafe0_dbl(dbl const v, dbl const v1, dbl const t);
+ijk_inl dbl ijkInterpLinearRevSafe0_dbl(dbl const v, dbl const v1, dbl const t);
 
 // ijkInterpLinearRev1_dbl
 //	Reverse linear interpolation to get second control value.
@@ -629,7 +629,7 @@ dbl ijkInterpLinearRevSafe0_dbl(dbl const v, dbl const v1, dbl const t);
 //		param t: interpolation parameter; inputs in [0,1] interpolate in 
 //			[v0,v1], others yield extrapolation beyond reference values
 //		return: second control value, v1
-dbl ijkInterpLinearRev1_dbl(dbl const v0, dbl const v, dbl const t);
+ijk_inl dbl ijkInterpLinearRev1_dbl(dbl const v0, dbl const v, dbl const t);
 
 // ijkInterpLinearRevSafe1_dbl
 //	Reverse linear interpolation to get second control value; division-by-zero
@@ -641,28 +641,28 @@ dbl ijkInterpLinearRev1_dbl(dbl const v0, dbl const v, dbl const t);
 //		param t: interpolation parameter; inputs in [0,1] interpolate in 
 //			[v0,v1], others yield extrapolation beyond reference values
 //		return: second control value, v1
-dbl ijkInterpLinearRevSafe1_dbl(dbl const v0, dbl const v, dbl const t);
+ijk_inl dbl ijkInterpLinearRevSafe1_dbl(dbl const v0, dbl const v, dbl const t);
 
 // ijkInterpSmoothstep_dbl
 //	Smoothstep for parameter.
 //		param t: interpolation parameter; inputs in [0,1] interpolate in 
 //			[0,1], others yield extrapolation beyond reference values
 //		return: interpolated value between 0 and 1
-dbl ijkInterpSmoothstep_dbl(dbl const t);
+ijk_inl dbl ijkInterpSmoothstep_dbl(dbl const t);
 
 // ijkInterpSmootherstep_dbl
 //	Smootherstep for parameter.
 //		param t: interpolation parameter; inputs in [0,1] interpolate in 
 //			[0,1], others yield extrapolation beyond reference values
 //		return: interpolated value between 0 and 1
-dbl ijkInterpSmootherstep_dbl(dbl const t);
+ijk_inl dbl ijkInterpSmootherstep_dbl(dbl const t);
 
 // ijkInterpBezier0_dbl
 //	Perform order-0 (point) Bezier interpolation given one reference value.
 //		param v0: reference value, always returned
 //		param t: interpolation parameter; not used for order 0 interpolation
 //		return: v0
-dbl ijkInterpBezier0_dbl(dbl const v0, dbl const t);
+ijk_inl dbl ijkInterpBezier0_dbl(dbl const v0, dbl const t);
 
 // ijkInterpBezier1_dbl
 //	Perform order-1 (linear) Bezier interpolation given two reference values.
@@ -671,7 +671,7 @@ dbl ijkInterpBezier0_dbl(dbl const v0, dbl const t);
 //		param t: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: linear interpolation between v0 and v1
-dbl ijkInterpBezier1_dbl(dbl const v0, dbl const v1, dbl const t);
+ijk_inl dbl ijkInterpBezier1_dbl(dbl const v0, dbl const v1, dbl const t);
 
 // ijkInterpBezier2_dbl
 //	Perform order-2 (quadratic) Bezier interpolation given three reference 
@@ -682,7 +682,7 @@ dbl ijkInterpBezier1_dbl(dbl const v0, dbl const v1, dbl const t);
 //		param t: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v2
 //		return: quadratic Bezier interpolation between v0 and v2
-dbl ijkInterpBezier2_dbl(dbl const v0, dbl const v1, dbl const v2, dbl const t);
+ijk_inl dbl ijkInterpBezier2_dbl(dbl const v0, dbl const v1, dbl const v2, dbl const t);
 
 // ijkInterpBezier3_dbl
 //	Perform order-3 (cubic) Bezier interpolation given four reference values.
@@ -693,7 +693,7 @@ dbl ijkInterpBezier2_dbl(dbl const v0, dbl const v1, dbl const v2, dbl const t);
 //		param t: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v3
 //		return: cubic Bezier interpolation between v0 and v3
-dbl ijkInterpBezier3_dbl(dbl const v0, dbl const v1, dbl const v2, dbl const v3, dbl const t);
+ijk_inl dbl ijkInterpBezier3_dbl(dbl const v0, dbl const v1, dbl const v2, dbl const v3, dbl const t);
 
 // ijkInterpBezierN_dbl
 //	Perform order-N (recursive) Bezier interpolation given an array of 
@@ -706,7 +706,7 @@ dbl ijkInterpBezier3_dbl(dbl const v0, dbl const v1, dbl const v2, dbl const v3,
 //		param t: interpolation parameter; inputs in [0,1] interpolate between 
 //			v[0] and v[order]
 //		return: recursive Bezier interpolation between v[0] and v[order]
-dbl ijkInterpBezierN_dbl(dbl const v[], size const order, dbl const t);
+ijk_inl dbl ijkInterpBezierN_dbl(dbl const v[], size const order, dbl const t);
 
 // ijkInterpCubicHermite_dbl
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -718,7 +718,7 @@ dbl ijkInterpBezierN_dbl(dbl const v[], size const order, dbl const t);
 //		param t: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated value on spline/curve segment
-dbl ijkInterpCubicHermite_dbl(dbl const v0, dbl const dv0, dbl const v1, dbl const dv1, dbl const t);
+ijk_inl dbl ijkInterpCubicHermite_dbl(dbl const v0, dbl const dv0, dbl const v1, dbl const dv1, dbl const t);
 
 // ijkInterpCubicHermiteHandles_dbl
 //	Cubic Hermite spline/curve interpolation between two reference values with 
@@ -732,7 +732,7 @@ dbl ijkInterpCubicHermite_dbl(dbl const v0, dbl const dv0, dbl const v1, dbl con
 //		param t: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated value on spline/curve segment
-dbl ijkInterpCubicHermiteHandles_dbl(dbl const v0, dbl const cv0, dbl const v1, dbl const cv1, dbl const t);
+ijk_inl dbl ijkInterpCubicHermiteHandles_dbl(dbl const v0, dbl const cv0, dbl const v1, dbl const cv1, dbl const t);
 
 // ijkInterpCubicCatmullRom_dbl
 //	Catmull-Rom spline/curve interpolation between two reference values with 
@@ -744,7 +744,7 @@ dbl ijkInterpCubicHermiteHandles_dbl(dbl const v0, dbl const cv0, dbl const v1,
 //		param t: interpolation parameter; inputs in [0,1] interpolate between 
 //			v0 and v1
 //		return: interpolated value on spline/curve segment
-dbl ijkInterpCubicCatmullRom_dbl(dbl const vp, dbl const v0, dbl const v1, dbl const v2, dbl const t);
+ijk_inl dbl ijkInterpCubicCatmullRom_dbl(dbl const vp, dbl const v0, dbl const v1, dbl const v2, dbl const t);
 
 // ijkInterpBicubicCatmullRom_dbl
 //	Bi-cubic interpolation using Catmull-Rom interpolation for segments.
@@ -778,7 +778,7 @@ dbl ijkInterpCubicCatmullRom_dbl(dbl const vp, dbl const v0, dbl const v1, dbl c
 //		param t2: interpolation parameter for terminal control curve
 //		param t: interpolation parameter for result
 //		return: interpolated value
-dbl ijkInterpBicubicCatmullRom_dbl(dbl const vpp, dbl const vp0, dbl const vp1, dbl const vp2, dbl const v0p, dbl const v00, dbl const v01, dbl const v02, dbl const v1p, dbl const v10, dbl const v11, dbl const v12, dbl const v2p, dbl const v20, dbl const v21, dbl const v22, dbl const tp, dbl const t0, dbl const t1, dbl const t2, dbl const t);
+ijk_inl dbl ijkInterpBicubicCatmullRom_dbl(dbl const vpp, dbl const vp0, dbl const vp1, dbl const vp2, dbl const v0p, dbl const v00, dbl const v01, dbl const v02, dbl const v1p, dbl const v10, dbl const v11, dbl const v12, dbl const v2p, dbl const v20, dbl const v21, dbl const v22, dbl const tp, dbl const t0, dbl const t1, dbl const t2, dbl const t);
 
 // ijkInterpReparamCubicHermite_dbl
 //	Reparameterize a cubic Hermite segment into sample table.
@@ -798,7 +798,7 @@ dbl ijkInterpBicubicCatmullRom_dbl(dbl const vpp, dbl const vp0, dbl const vp1,
 //		param v1: terminal reference value/end point, result when t=1
 //		param dv1: terminal tangent/rate of change
 //		return: total arc length
-dbl ijkInterpReparamCubicHermite_dbl(dbl tTable_out[], dbl lTable_out[], dbl vTable_out[], size const numDivisions, ibool const lNormalize, dbl const v0, dbl const dv0, dbl const v1, dbl const dv1);
+ijk_inl dbl ijkInterpReparamCubicHermite_dbl(dbl tTable_out[], dbl lTable_out[], dbl vTable_out[], size const numDivisions, ibool const lNormalize, dbl const v0, dbl const dv0, dbl const v1, dbl const dv1);
 
 // ijkInterpReparamCubicHermiteHandles_dbl
 //	Reparameterize a cubic Hermite segment with handles into sample table.
@@ -820,7 +820,7 @@ dbl ijkInterpReparamCubicHermite_dbl(dbl tTable_out[], dbl lTable_out[], dbl vTa
 //		param cv1: terminal control handle value, should be greater than v1 
 //			for a positive rate of change
 //		return: total arc length
-dbl ijkInterpReparamCubicHermiteHandles_dbl(dbl tTable_out[], dbl lTable_out[], dbl vTable_out[], size const numDivisions, ibool const lNormalize, dbl const v0, dbl const cv0, dbl const v1, dbl const cv1);
+ijk_inl dbl ijkInterpReparamCubicHermiteHandles_dbl(dbl tTable_out[], dbl lTable_out[], dbl vTable_out[], size const numDivisions, ibool const lNormalize, dbl const v0, dbl const cv0, dbl const v1, dbl const cv1);
 
 // ijkInterpReparamCubicCatmullRom_dbl
 //	Reparameterize a cubic Catmull-Rom segment into sample table.
@@ -840,7 +840,7 @@ dbl ijkInterpReparamCubicHermiteHandles_dbl(dbl tTable_out[], dbl lTable_out[],
 //		param v1: terminal reference value/end point, result when t=1
 //		param v2: terminal control value
 //		return: total arc length
-dbl ijkInterpReparamCubicCatmullRom_dbl(dbl tTable_out[], dbl lTable_out[], dbl vTable_out[], size const numDivisions, ibool const lNormalize, dbl const vp, dbl const v0, dbl const v1, dbl const v2);
+ijk_inl dbl ijkInterpReparamCubicCatmullRom_dbl(dbl tTable_out[], dbl lTable_out[], dbl vTable_out[], size const numDivisions, ibool const lNormalize, dbl const vp, dbl const v0, dbl const v1, dbl const v2);
 
 // ijkInterpReparamBicubicCatmullRom_dbl
 //	Reparameterize a bi-cubic Catmull-Rom segment into sample table.
@@ -884,7 +884,7 @@ dbl ijkInterpReparamCubicCatmullRom_dbl(dbl tTable_out[], dbl lTable_out[], dbl
 //		param t1: interpolation parameter for terminal value curve
 //		param t2: interpolation parameter for terminal control curve
 //		return: total arc length
-dbl ijkInterpReparamBicubicCatmullRom_dbl(dbl tTable_out[], dbl lTable_out[], dbl vTable_out[], size const numDivisions, ibool const lNormalize, dbl const vpp, dbl const vp0, dbl const vp1, dbl const vp2, dbl const v0p, dbl const v00, dbl const v01, dbl const v02, dbl const v1p, dbl const v10, dbl const v11, dbl const v12, dbl const v2p, dbl const v20, dbl const v21, dbl const v22, dbl const tp, dbl const t0, dbl const t1, dbl const t2);
+ijk_inl dbl ijkInterpReparamBicubicCatmullRom_dbl(dbl tTable_out[], dbl lTable_out[], dbl vTable_out[], size const numDivisions, ibool const lNormalize, dbl const vpp, dbl const vp0, dbl const vp1, dbl const vp2, dbl const v0p, dbl const v00, dbl const v01, dbl const v02, dbl const v1p, dbl const v10, dbl const v11, dbl const v12, dbl const v2p, dbl const v20, dbl const v21, dbl const v22, dbl const tp, dbl const t0, dbl const t1, dbl const t2);
 
 // ijkInterpSampleTableInc_dbl
 //	Find index of parameter in table and approximate value by interpolating 
@@ -901,7 +901,7 @@ dbl ijkInterpReparamBicubicCatmullRom_dbl(dbl tTable_out[], dbl lTable_out[], db
 //			note: defaults to 1 if passed 0
 //		param t: input parameter to find in search table
 //		return: interpolated value in table that approximates input parameter
-dbl ijkInterpSampleTableInc_dbl(dbl const tTable[], dbl const vTable[], uindex i, uindex di, dbl const t);
+ijk_inl dbl ijkInterpSampleTableInc_dbl(dbl const tTable[], dbl const vTable[], uindex i, uindex di, dbl const t);
 
 // ijkInterpSampleTableDec_dbl
 //	Find index of parameter in table and approximate value by interpolating 
@@ -918,7 +918,7 @@ dbl ijkInterpSampleTableInc_dbl(dbl const tTable[], dbl const vTable[], uindex i
 //			note: defaults to 1 if passed 0
 //		param t: input parameter to find in search table
 //		return: interpolated value in table that approximates input parameter
-dbl ijkInterpSampleTableDec_dbl(dbl const tTable[], dbl const vTable[], uindex i, uindex di, dbl const t);
+ijk_inl dbl ijkInterpSampleTableDec_dbl(dbl const tTable[], dbl const vTable[], uindex i, uindex di, dbl const t);
 
 // ijkInterpSampleTableIncIndex_dbl
 //	Find index of parameter in table and retrieve interpolation parameter for 
@@ -937,7 +937,7 @@ dbl ijkInterpSampleTableDec_dbl(dbl const tTable[], dbl const vTable[], uindex i
 //			note: defaults to 1 if passed 0
 //		param t: input parameter to find in search table
 //		return: index of interpolation parameter discovered
-index ijkInterpSampleTableIncIndex_dbl(dbl* const tReparam_out, dbl const tTable[], uindex i, uindex di, dbl const t);
+ijk_inl index ijkInterpSampleTableIncIndex_dbl(dbl* const tReparam_out, dbl const tTable[], uindex i, uindex di, dbl const t);
 
 // ijkInterpSampleTableDecIndex_dbl
 //	Find index of parameter in table and approximate value by interpolating 
@@ -956,7 +956,7 @@ index ijkInterpSampleTableIncIndex_dbl(dbl* const tReparam_out, dbl const tTable
 //			note: defaults to 1 if passed 0
 //		param t: input parameter to find in search table
 //		return: index of interpolation parameter discovered
-index ijkInterpSampleTableDecIndex_dbl(dbl* const tReparam_out, dbl const tTable[], uindex i, uindex di, dbl const t);
+ijk_inl index ijkInterpSampleTableDecIndex_dbl(dbl* const tReparam_out, dbl const tTable[], uindex i, uindex di, dbl const t);
 
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,138 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkParallel.h
+	Batch math kernels run in parallel on a job system.
+*/
+
+#ifndef _IJK_PARALLEL_H_
+#define _IJK_PARALLEL_H_
+
+
+#include "ijkMatrix.h"
+#include "ijkStats.h"
+#include "ijk/ijk-base/ijk-utility/ijkJob.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif	// __cplusplus
+
+
+//-----------------------------------------------------------------------------
+
+// ijk_parallel_grain
+//	Number of elements per job in batch kernels; enough work per job to 
+//	hide scheduling cost, few enough to balance over many cores.
+#define ijk_parallel_grain		4096
+
+
+//-----------------------------------------------------------------------------
+
+// ijkParallelMatMulVecTransform4*mv3
+//	Multiply array of 3D vectors by transformation matrix (see 
+//	ijkMatMulVecTransform4*mv3).
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//		param v_out: output array of vectors, transformed inputs
+//			note: may be the same as v_rh
+//		param m_lh: left-hand input matrix
+//		param v_rh: right-hand input array of vectors
+//		param count: number of vectors
+//		return SUCCESS: ijk_success if all vectors transformed
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkParallelMatMulVecTransform4fmv3(ptr const jobs, float3 v_out[], float4x4 const m_lh, float3 const v_rh[], size const count);
+iret ijkParallelMatMulVecTransform4dmv3(ptr const jobs, double3 v_out[], double4x4 const m_lh, double3 const v_rh[], size const count);
+
+// ijkParallelVecNormalize3*v
+//	Normalize array of 3D vectors (see ijkVecNormalize3*v).
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//		param v_out: output array of vectors, normalized inputs
+//			note: may be the same as v_in
+//		param v_in: input array of vectors
+//		param count: number of vectors
+//		return SUCCESS: ijk_success if all vectors normalized
+//		return FAILURE: ijk_fail_invalidparams if invalid parameters
+iret ijkParallelVecNormalize3fv(ptr const jobs, float3 v_out[], float3 const v_in[], size const count);
+iret ijkParallelVecNormalize3dv(ptr const jobs, double3 v_out[], double3 const v_in[], size const count);
+
+
+//-----------------------------------------------------------------------------
+
+// ijkParallelStatsGetMean_*
+//	Calculate the mean (average) of a data set (see ijkStatsGetMean_*); 
+//	partial sums are combined pairwise in a fixed order, so the result is 
+//	the same on every run.
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//		param v: array of values
+//		param n: number of values in set
+//		return: mean
+flt ijkParallelStatsGetMean_flt(ptr const jobs, flt const v[], size const n);
+dbl ijkParallelStatsGetMean_dbl(ptr const jobs, dbl const v[], size const n);
+
+// ijkParallelStatsGetVariance_*
+//	Calculate the variance (squared mean deviation) of a data set (see 
+//	ijkStatsGetVariance_*) in one pass; each range computes its own mean 
+//	and squared deviation, which are merged pairwise in a fixed order.
+//		param jobs: base pointer to job system
+//			valid: non-null, initialized
+//		param v: array of values
+//		param n: number of values in set
+//		param mean_opt: optional pointer to capture mean in calculation
+//		return: variance
+flt ijkParallelStatsGetVariance_flt(ptr const jobs, flt const v[], size const n, flt mean_opt[1]);
+dbl ijkParallelStatsGetVariance_dbl(ptr const jobs, dbl const v[], size const n, dbl mean_opt[1]);
+
+
+//-----------------------------------------------------------------------------
+
+// ijkParallelMatMulVecTransform4rmv3
+//	Real-typed parallel transform (see ijkParallelMatMulVecTransform4*mv3).
+//iret ijkParallelMatMulVecTransform4rmv3(ptr const jobs, real3 v_out[], real4x4 const m_lh, real3 const v_rh[], size const count);
+#define ijkParallelMatMulVecTransform4rmv3	ijk_declrealfs(ijkParallelMatMulVecTransform4,mv3)
+
+// ijkParallelVecNormalize3rv
+//	Real-typed parallel normalize (see ijkParallelVecNormalize3*v).
+//iret ijkParallelVecNormalize3rv(ptr const jobs, real3 v_out[], real3 const v_in[], size const count);
+#define ijkParallelVecNormalize3rv			ijk_declrealfs(ijkParallelVecNormalize3,v)
+
+// ijkParallelStatsGetMean
+//	Real-typed parallel mean (see ijkParallelStatsGetMean_*).
+// real ijkParallelStatsGetMean(ptr const jobs, real const v[], size const n);
+#define ijkParallelStatsGetMean				ijk_declrealf(ijkParallelStatsGetMean)
+
+// ijkParallelStatsGetVariance
+//	Real-typed parallel variance (see ijkParallelStatsGetVariance_*).
+// real ijkParallelStatsGetVariance(ptr const jobs, real const v[], size const n, real mean_opt[1]);
+#define ijkParallelStatsGetVariance			ijk_declrealf(ijkParallelStatsGetVariance)
+
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef __cplusplus
+}
+#endif	// __cplusplus
+
+
+#endif	// !_IJK_PARALLEL_H_
\ No newline at end of file
@@ -40,41 +40,41 @@ extern "C" {
 // ijkRandomGetMod
 //	Get modulus that yields maximum number that can be generated.
 //		return: random maximum modulus
-i32 ijkRandomGetMod();
+ijk_inl i32 ijkRandomGetMod();
 
 // ijkRandomGetMax
 //	Get maximum number that can be generated.
 //		return: random maximum
-i32 ijkRandomGetMax();
+ijk_inl i32 ijkRandomGetMax();
 
 // ijkRandomGetSeed
 //	Get random number generation seed.
 //		return: random seed
-i32 ijkRandomGetSeed();
+ijk_inl i32 ijkRandomGetSeed();
 
 // ijkRandomSetSeed
 //	Set random number generation seed.
 //		param seed: new seed
 //		return: old random seed (before change)
-i32 ijkRandomSetSeed(i32 const seed);
+ijk_inl i32 ijkRandomSetSeed(i32 const seed);
 
 // ijkRandomNum_int
 //	Generate random integer in [0, max).
 //		return: random number
-i32 ijkRandomNum_int();
+ijk_inl i32 ijkRandomNum_int();
 
 // ijkRandomNumMax_int
 //	Generate a random integer with specified maximum in [0, usermax).
 //		param usermax: user-specified maximum
 //		return: random number
-i32 ijkRandomNumMax_int(i32 const usermax);
+ijk_inl i32 ijkRandomNumMax_int(i32 const usermax);
 
 // ijkRandomNumRange_int
 //	Generate a random integer with specified range in [usermin, usermax).
 //		param usermin: user-specified minimum
 //		param usermax: user-specified maximum
 //		return: random number
-i32 ijkRandomNumRange_int(i32 const usermin, i32 const usermax);
+ijk_inl i32 ijkRandomNumRange_int(i32 const usermin, i32 const usermax);
 
 
 //-----------------------------------------------------------------------------
@@ -82,30 +82,30 @@ i32 ijkRandomNumRange_int(i32 const usermin, i32 const usermax);
 // ijkRandomNum_flt
 //	Generate random float in [0, max).
 //		return: random number
-flt ijkRandomNum_flt();
+ijk_inl flt ijkRandomNum_flt();
 
 // ijkRandomNumMax_flt
 //	Generate a random float with specified maximum in [0, usermax).
 //		param usermax: user-specified maximum
 //		return: random number
-flt ijkRandomNumMax_flt(flt const usermax);
+ijk_inl flt ijkRandomNumMax_flt(flt const usermax);
 
 // ijkRandomNumRange_flt
 //	Generate a random float with specified range in [usermin, usermax).
 //		param usermin: user-specified minimum
 //		param usermax: user-specified maximum
 //		return: random number
-flt ijkRandomNumRange_flt(flt const usermin, flt const usermax);
+ijk_inl flt ijkRandomNumRange_flt(flt const usermin, flt const usermax);
 
 // ijkRandomNumUnitNrm_flt
 //	Generate a random float in normal unit range [0, 1).
 //		return random number
-flt ijkRandomNumUnitNrm_flt();
+ijk_inl flt ijkRandomNumUnitNrm_flt();
 
 // ijkRandomNumUnitSym_flt
 //	Generate a random float in symmetric unit range [-1, +1).
 //		return random number
-flt ijkRandomNumUnitSym_flt();
+ijk_inl flt ijkRandomNumUnitSym_flt();
 
 
 //-----------------------------------------------------------------------------
@@ -113,30 +113,30 @@ flt ijkRandomNumUnitSym_flt();
 // ijkRandomNum_dbl
 //	Generate random double in [0, max).
 //		return: random number
-dbl ijkRandomNum_dbl();
+ijk_inl dbl ijkRandomNum_dbl();
 
 // ijkRandomNumMax_dbl
 //	Generate a random double with specified maximum in [0, usermax).
 //		param usermax: user-specified maximum
 //		return: random number
-dbl ijkRandomNumMax_dbl(dbl const usermax);
+ijk_inl dbl ijkRandomNumMax_dbl(dbl const usermax);
 
 // ijkRandomNumRange_dbl
 //	Generate a random double with specified range in [usermin, usermax).
 //		param usermin: user-specified minimum
 //		param usermax: user-specified maximum
 //		return: random number
-dbl ijkRandomNumRange_dbl(dbl const usermin, dbl const usermax);
+ijk_inl dbl ijkRandomNumRange_dbl(dbl const usermin, dbl const usermax);
 
 // ijkRandomNumUnitNrm_dbl
 //	Generate a random double in normal unit range [0, 1).
 //		return random number
-dbl ijkRandomNumUnitNrm_dbl();
+ijk_inl dbl ijkRandomNumUnitNrm_dbl();
 
 // ijkRandomNumUnitSym_dbl
 //	Generate a random double in symmetric unit range [-1, +1).
 //		return random number
-dbl ijkRandomNumUnitSym_dbl();
+ijk_inl dbl ijkRandomNumUnitSym_dbl();
 
 
 //-----------------------------------------------------------------------------
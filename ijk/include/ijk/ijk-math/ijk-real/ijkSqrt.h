@@ -42,14 +42,14 @@ extern "C" {
 //	Newton's approximation method.
 //		param x: number to square root and invert
 //		return: approximate inverse (reciprocal) square root of x
-flt ijkSqrtInv0x_flt(flt const x);
+ijk_inl flt ijkSqrtInv0x_flt(flt const x);
 
 // ijkSqrt0x_flt
 //	Compute fast square root using Quake's method ("0x5f3759df") using 
 //	Newton's approximation method.
 //		param x: number to square root
 //		return: approximate square root of x
-flt ijkSqrt0x_flt(flt const x);
+ijk_inl flt ijkSqrt0x_flt(flt const x);
 
 // ijkSqrt_flt
 //	Compute fast square root.
@@ -77,14 +77,14 @@ flt ijkSqrtInv_flt(flt const x);
 //	Newton's approximation method.
 //		param x: number to square root and invert
 //		return: approximate inverse (reciprocal) square root of x
-dbl ijkSqrtInv0x_dbl(dbl const x);
+ijk_inl dbl ijkSqrtInv0x_dbl(dbl const x);
 
 // ijkSqrt0x_dbl
 //	Compute fast square root using Quake's method ("0x5f3759df") using 
 //	Newton's approximation method.
 //		param x: number to square root
 //		return: approximate square root of x
-dbl ijkSqrt0x_dbl(dbl const x);
+ijk_inl dbl ijkSqrt0x_dbl(dbl const x);
 
 // ijkSqrt_dbl
 //	Compute fast square root.
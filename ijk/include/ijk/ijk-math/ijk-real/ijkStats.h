@@ -41,7 +41,7 @@ extern "C" {
 //	Calculate the factorial of a number.
 //		param n: number
 //		return: factorial of 'n' (n!)
-size ijkStatsGetFactorial(size const n);
+ijk_inl size ijkStatsGetFactorial(size const n);
 
 // ijkStatsGetPermutations
 //	Calculate the permutations of (number of ways to order) k elements in a 
@@ -49,7 +49,7 @@ size ijkStatsGetFactorial(size const n);
 //		param n: set size
 //		param k: number of elements to permute (order)
 //		return: permutations of k elements in a set of n items (nPk)
-size ijkStatsGetPermutations(size const n, size const k);
+ijk_inl size ijkStatsGetPermutations(size const n, size const k);
 
 // ijkStatsGetCombinations
 //	Calculate the combinations of (number of ways to choose) k elements in a 
@@ -57,14 +57,14 @@ size ijkStatsGetPermutations(size const n, size const k);
 //		param n: set size
 //		param k: number of elements to combine (choose)
 //		return: combinations of k elements in a set of n items (nCk)
-size ijkStatsGetCombinations(size const n, size const k);
+ijk_inl size ijkStatsGetCombinations(size const n, size const k);
 
 // ijkStatsPascal
 //	Evaluate Pascal's triangle at row n, element k.
 //		param n: row index
 //		param k: element index
 //		return: Pascal's triangle, row n, element k
-size ijkStatsPascal(size const n, size const k);
+ijk_inl size ijkStatsPascal(size const n, size const k);
 
 
 //-----------------------------------------------------------------------------
@@ -75,14 +75,14 @@ size ijkStatsPascal(size const n, size const k);
 //		param v: array of values
 //		param n: number of values in set
 //		return: median as float
-flt ijkStatsGetMedianInt_flt(schomp const v[], size const n);
+ijk_inl flt ijkStatsGetMedianInt_flt(schomp const v[], size const n);
 
 // ijkStatsGetMeanInt_flt
 //	Calculate the mean (average) of an integer data set.
 //		param v: array of values
 //		param n: number of values in set
 //		return: mean as float
-flt ijkStatsGetMeanInt_flt(schomp const v[], size const n);
+ijk_inl flt ijkStatsGetMeanInt_flt(schomp const v[], size const n);
 
 // ijkStatsGetVarianceInt_flt
 //	Calculate the variance (squared mean deviation) of an integer data set.
@@ -90,7 +90,7 @@ flt ijkStatsGetMeanInt_flt(schomp const v[], size const n);
 //		param n: number of values in set
 //		param mean_opt: optional pointer to capture mean in calculation
 //		return: variance as float
-flt ijkStatsGetVarianceInt_flt(schomp const v[], size const n, flt mean_opt[1]);
+ijk_inl flt ijkStatsGetVarianceInt_flt(schomp const v[], size const n, flt mean_opt[1]);
 
 // ijkStatsGetStdDevInt_flt
 //	Calculate the standard deviation (from mean) of an integer data set.
@@ -98,7 +98,7 @@ flt ijkStatsGetVarianceInt_flt(schomp const v[], size const n, flt mean_opt[1]);
 //		param n: number of values in set
 //		param mean_opt: optional pointer to capture mean in calculation
 //		return: standard deviation as float
-flt ijkStatsGetStdDevInt_flt(schomp const v[], size const n, flt mean_opt[1]);
+ijk_inl flt ijkStatsGetStdDevInt_flt(schomp const v[], size const n, flt mean_opt[1]);
 
 // ijkStatsGetMedian_flt
 //	Calculate the median of a sorted data set. Half of the data are 
@@ -106,14 +106,14 @@ flt ijkStatsGetStdDevInt_flt(schomp const v[], size const n, flt mean_opt[1]);
 //		param v: array of values
 //		param n: number of values in set
 //		return: median
-flt ijkStatsGetMedian_flt(flt const v[], size const n);
+ijk_inl flt ijkStatsGetMedian_flt(flt const v[], size const n);
 
 // ijkStatsGetMean_flt
 //	Calculate the mean (average) of a data set.
 //		param v: array of values
 //		param n: number of values in set
 //		return: mean
-flt ijkStatsGetMean_flt(flt const v[], size const n);
+ijk_inl flt ijkStatsGetMean_flt(flt const v[], size const n);
 
 // ijkStatsGetVariance_flt
 //	Calculate the variance (squared mean deviation) of a data set.
@@ -121,7 +121,7 @@ flt ijkStatsGetMean_flt(flt const v[], size const n);
 //		param n: number of values in set
 //		param mean_opt: optional pointer to capture mean in calculation
 //		return: variance
-flt ijkStatsGetVariance_flt(flt const v[], size const n, flt mean_opt[1]);
+ijk_inl flt ijkStatsGetVariance_flt(flt const v[], size const n, flt mean_opt[1]);
 
 // ijkStatsGetStdDev_flt
 //	Calculate the standard deviation (from mean) of a data set.
@@ -129,7 +129,7 @@ flt ijkStatsGetVariance_flt(flt const v[], size const n, flt mean_opt[1]);
 //		param n: number of values in set
 //		param mean_opt: optional pointer to capture mean in calculation
 //		return: standard deviation
-flt ijkStatsGetStdDev_flt(flt const v[], size const n, flt mean_opt[1]);
+ijk_inl flt ijkStatsGetStdDev_flt(flt const v[], size const n, flt mean_opt[1]);
 
 
 //-----------------------------------------------------------------------------
@@ -140,14 +140,14 @@ flt ijkStatsGetStdDev_flt(flt const v[], size const n, flt mean_opt[1]);
 //		param v: array of values
 //		param n: number of values in set
 //		return: median as double
-dbl ijkStatsGetMedianInt_dbl(schomp const v[], size const n);
+ijk_inl dbl ijkStatsGetMedianInt_dbl(schomp const v[], size const n);
 
 // ijkStatsGetMeanInt_dbl
 //	Calculate the mean (average) of an integer data set.
 //		param v: array of values
 //		param n: number of values in set
 //		return: mean as double
-dbl ijkStatsGetMeanInt_dbl(schomp const v[], size const n);
+ijk_inl dbl ijkStatsGetMeanInt_dbl(schomp const v[], size const n);
 
 // ijkStatsGetVarianceInt_dbl
 //	Calculate the variance (squared mean deviation) of an integer data set.
@@ -155,7 +155,7 @@ dbl ijkStatsGetMeanInt_dbl(schomp const v[], size const n);
 //		param n: number of values in set
 //		param mean_opt: optional pointer to capture mean in calculation
 //		return: variance as double
-dbl ijkStatsGetVarianceInt_dbl(schomp const v[], size const n, dbl mean_opt[1]);
+ijk_inl dbl ijkStatsGetVarianceInt_dbl(schomp const v[], size const n, dbl mean_opt[1]);
 
 // ijkStatsGetStdDevInt_dbl
 //	Calculate the standard deviation (from mean) of an integer data set.
@@ -163,7 +163,7 @@ dbl ijkStatsGetVarianceInt_dbl(schomp const v[], size const n, dbl mean_opt[1]);
 //		param n: number of values in set
 //		param mean_opt: optional pointer to capture mean in calculation
 //		return: standard deviation as double
-dbl ijkStatsGetStdDevInt_dbl(schomp const v[], size const n, dbl mean_opt[1]);
+ijk_inl dbl ijkStatsGetStdDevInt_dbl(schomp const v[], size const n, dbl mean_opt[1]);
 
 // ijkStatsGetMedian_dbl
 //	Calculate the median of a sorted data set. Half of the data are 
@@ -171,14 +171,14 @@ dbl ijkStatsGetStdDevInt_dbl(schomp const v[], size const n, dbl mean_opt[1]);
 //		param v: array of values
 //		param n: number of values in set
 //		return: median
-dbl ijkStatsGetMedian_dbl(dbl const v[], size const n);
+ijk_inl dbl ijkStatsGetMedian_dbl(dbl const v[], size const n);
 
 // ijkStatsGetMean_dbl
 //	Calculate the mean (average) of a data set.
 //		param v: array of values
 //		param n: number of values in set
 //		return: mean
-dbl ijkStatsGetMean_dbl(dbl const v[], size const n);
+ijk_inl dbl ijkStatsGetMean_dbl(dbl const v[], size const n);
 
 // ijkStatsGetVariance_dbl
 //	Calculate the variance (squared mean deviation) of a data set.
@@ -186,7 +186,7 @@ dbl ijkStatsGetMean_dbl(dbl const v[], size const n);
 //		param n: number of values in set
 //		param mean_opt: optional pointer to capture mean in calculation
 //		return: variance
-dbl ijkStatsGetVariance_dbl(dbl const v[], size const n, dbl mean_opt[1]);
+ijk_inl dbl ijkStatsGetVariance_dbl(dbl const v[], size const n, dbl mean_opt[1]);
 
 // ijkStatsGetStdDev_dbl
 //	Calculate the standard deviation (from mean) of a data set.
@@ -194,7 +194,7 @@ dbl ijkStatsGetVariance_dbl(dbl const v[], size const n, dbl mean_opt[1]);
 //		param n: number of values in set
 //		param mean_opt: optional pointer to capture mean in calculation
 //		return: standard deviation
-dbl ijkStatsGetStdDev_dbl(dbl const v[], size const n, dbl mean_opt[1]);
+ijk_inl dbl ijkStatsGetStdDev_dbl(dbl const v[], size const n, dbl mean_opt[1]);
 
 
 //-----------------------------------------------------------------------------
@@ -43,18 +43,47 @@
 #endif	// 32-/64-bit
 
 
+// platform and compiler identifiers, so that platform tests such as 
+//	(__ijk_cfg_platform == WINDOWS) compare distinct values
+///
+#define WINDOWS							1
+#define LINUX							2
+#define MSVC							1
+#define GCC								2
+
+
 // set development platform
 ///
 #if (defined _WIN32)	// Windows, MSVC
 #define __ijk_cfg_platform				WINDOWS
 #define __ijk_cfg_compiler				MSVC
 
+#elif (defined __linux__)	// Linux, GCC or Clang
+#define __ijk_cfg_platform				LINUX
+#define __ijk_cfg_compiler				GCC
+
 #else
 #error "ERROR: UNKNOWN/INVALID PLATFORM AND COMPILER"
 
 #endif	// platform
 
 
+// set profiling instrumentation; define as zero beforehand (e.g. in 
+//	project settings) to compile profile scopes out entirely
+///
+#ifndef __ijk_cfg_profile
+#define __ijk_cfg_profile				1
+#endif	// !__ijk_cfg_profile
+
+
+// set zstd compression codec; define as one beforehand (e.g. in project 
+//	settings) where zstd is available to include and link
+///
+#ifndef __ijk_cfg_zstd
+#define __ijk_cfg_zstd					0
+#endif	// !__ijk_cfg_zstd
+
+
 // global config macros
 ///
 #define __ijk_cfg_tokenstr(x)			#x
@@ -35,6 +35,7 @@
 #define ijk_inl_ext						extern inline	// Tag external and inline; useful for compilation with local inlining.
 #define ijk_inl							static inline	// Tag inline and static.
 #define ijk_ext							extern			// Tag external.
+#define ijk_unused(x)					((void)(x))		// Mark parameter or variable as deliberately unused.
 
 
 // General integer constants.
@@ -34,11 +34,19 @@
 ///
 typedef	  signed	char					i8, sbyte, asciicode;		// Alias for signed single byte.
 typedef	  signed	short					i16;						// Alias for signed short integer/word (two bytes).
+#if (__ijk_cfg_compiler == MSVC)
 typedef	  signed	long					i32, iret, ibool, istate;	// Alias for signed long integer/double-word (four bytes).
+#else	// !MSVC
+typedef	  signed	int						i32, iret, ibool, istate;	// Alias for signed integer/double-word (four bytes; long is eight on LP64).
+#endif	// MSVC
 typedef	  signed	long long				i64, intl;					// Alias for signed long-long integer/quad-word (eight bytes).
 typedef	unsigned	char					ui8, byte, ubyte, keycode;	// Alias for unsigned single byte.
 typedef	unsigned	short					ui16, word;					// Alias for unsigned short integer/word (two bytes).
+#if (__ijk_cfg_compiler == MSVC)
 typedef	unsigned	long					ui32, dword, uint;			// Alias for unsigned long integer/double-word (four bytes).
+#else	// !MSVC
+typedef	unsigned	int						ui32, dword, uint;			// Alias for unsigned integer/double-word (four bytes; long is eight on LP64).
+#endif	// MSVC
 typedef	unsigned	long long				ui64, qword, uintl;			// Alias for unsigned long-long integer/quad-word (eight bytes).
 typedef				float					f32, flt, single;			// Alias for signed single-precision floating point number (four bytes).
 typedef				double					f64, dbl;					// Alias for signed double-precision floating point number (eight bytes).
@@ -23,4 +23,1739 @@
 	Default source for base library.
 */
 
-//#include "ijk/ijk-base/ijk-base.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ijk/ijk-base/ijk-base.h"
+
+
+// include platform APIs
+#if (__ijk_cfg_platform == WINDOWS)
+#include <Windows.h>
+typedef SRWLOCK ijkBaseTestSystemMutex;
+#define ijkBaseTestSystemMutexCreate(m)		InitializeSRWLock(m)
+#define ijkBaseTestSystemMutexRelease(m)
+#define ijkBaseTestSystemMutexLock(m)		AcquireSRWLockExclusive(m)
+#define ijkBaseTestSystemMutexUnlock(m)		ReleaseSRWLockExclusive(m)
+#else	// !WINDOWS
+#include <pthread.h>
+typedef pthread_mutex_t ijkBaseTestSystemMutex;
+#define ijkBaseTestSystemMutexCreate(m)		pthread_mutex_init(m, 0)
+#define ijkBaseTestSystemMutexRelease(m)	pthread_mutex_destroy(m)
+#define ijkBaseTestSystemMutexLock(m)		pthread_mutex_lock(m)
+#define ijkBaseTestSystemMutexUnlock(m)		pthread_mutex_unlock(m)
+#endif	// WINDOWS
+
+
+//-----------------------------------------------------------------------------
+
+// check a tested value against the one expected of it; ijkBaseTest returns 
+//	the number of checks that failed
+size ijkBaseTestFailCount;
+#define ijkBaseTestCheck(value, expected)	(ijkBaseTestFailCount += ((value) != (expected)))
+
+
+void ijkBaseTestTimer()
+{
+	// raw ticks never go backwards and cost far less than a system call; a 
+	//	fixed-rate timer counts whole ticks against them
+	size const readCount = 1 << 20, tickCount = 10;
+	ijkTimer timer[1] = { 0 };
+	qword t0 = 0, t1 = 0;
+	dbl time[2] = { 0.0 };	// [nanoseconds per read, seconds for ticks]
+	size i, reversals = 0;
+
+	ijkBaseTestCheck(ijkTimerNowRate() != 0, ijk_true);
+	t0 = ijkTimerNow();
+	ijkTimerSet(timer, 0.0);
+	ijkTimerStart(timer);
+	for (i = 0; i < readCount; ++i)
+	{
+		t1 = ijkTimerNow();
+		reversals += (t1 < t0);
+		t0 = t1;
+	}
+	ijkTimerStop(timer);
+	time[0] = timer->tickMeasure / (dbl)readCount * 1.0e9;			// tens of nanoseconds at most with a time stamp counter
+	ijkBaseTestCheck(reversals, 0);
+
+	ijkBaseTestCheck(ijkTimerSet(timer, 1000.0), ijk_success);
+	ijkBaseTestCheck(ijkTimerStart(timer), ijk_success);
+	while (timer->tickCount < tickCount)
+		ijkBaseTestCheck(ijkTimerCheckTick(timer) >= ijk_success, ijk_true);	// ijk_true once per millisecond
+	time[1] = timer->totalTime;										// 0.01
+	ijkBaseTestCheck(time[1] >= 0.01, ijk_true);
+	ijkBaseTestCheck(ijkTimerStop(timer), ijk_success);
+}
+
+
+iret ijkBaseTestSchedulerTask(ptr const taskArg, dbl const dt)
+{
+	// simulate: accumulate time stepped
+	*(dbl*)taskArg += dt;
+	return ijk_success;
+}
+
+
+void ijkBaseTestScheduler()
+{
+	// physics at 120 Hz, AI at 20 Hz and render once per update, waiting 
+	//	between updates for a quarter second; then a stall past the budget
+	dbl const duration = 0.25, budget = 0.1, stall = 0.5;
+	ijkScheduler scheduler[1] = { 0 }, sleeper[1] = { 0 };
+	dbl time[3] = { 0.0 };	// simulated: [physics, ai, render]
+	size ticks = 0, index = 0;
+
+	ijkBaseTestCheck(ijkSchedulerCreate(scheduler, 0.0), ijk_fail_invalidparams);
+	ijkBaseTestCheck(ijkSchedulerCreate(scheduler, budget), ijk_success);
+	ijkBaseTestCheck(ijkSchedulerAddTask(scheduler, ijkBaseTestSchedulerTask, time + 0, 120.0, 0, &index), ijk_success);	// (0)
+	ijkBaseTestCheck(ijkSchedulerAddTask(scheduler, ijkBaseTestSchedulerTask, time + 1, 20.0, 0, &index), ijk_success);	// (1)
+	ijkBaseTestCheck(ijkSchedulerAddTask(scheduler, ijkBaseTestSchedulerTask, time + 2, 0.0, 0, &index), ijk_success);	// (2)
+
+	// updates only when a tick is due: about one per physics tick, where 
+	//	polling would spin through thousands
+	while (scheduler->totalTime < duration)
+	{
+		ijkSchedulerWait(scheduler, 0.0);
+		ijkSchedulerUpdate(scheduler, &ticks);
+	}
+	ticks = (size)scheduler->updateCount;							// 30
+	ijkBaseTestCheck(scheduler->task[0].tickCount >= 30, ijk_true);	// 30
+	ijkBaseTestCheck(scheduler->task[1].tickCount >= 5, ijk_true);	// 5
+	ijkBaseTestCheck(scheduler->task[0].alpha < 1.0, ijk_true);		// small: woken just after tick was due
+
+	// stall: a scheduler with no fixed-rate tasks just sleeps; only the 
+	//	budget is caught up, [12, 2, 1] ticks
+	ijkBaseTestCheck(ijkSchedulerCreate(sleeper, budget), ijk_success);
+	ijkBaseTestCheck(ijkSchedulerWait(sleeper, stall), ijk_success);
+	ijkBaseTestCheck(ijkSchedulerUpdate(scheduler, &ticks), ijk_warn_scheduler_dropped);	// (15)
+	ijkBaseTestCheck(scheduler->droppedTime >= 0.39, ijk_true);		// 0.4
+	ijkBaseTestCheck(ijkSchedulerRelease(sleeper), ijk_success);
+	ijkBaseTestCheck(ijkSchedulerRelease(scheduler), ijk_success);
+	ijkBaseTestCheck(ijkSchedulerUpdate(scheduler, &ticks), ijk_fail_invalidparams);	// (released)
+}
+
+
+void ijkBaseTestMemory()
+{
+	// simulated frame: many small reservations of mixed size, released in 
+	//	interleaved order so that open blocks are split and coalesced
+	size const poolSize = 16 << 20, frameCount = 64, blockCount = 4096;
+	tag const name = "ijkBaseTestMemory", name_found = "ijkBaseTestMemory:found";
+	ptr* const blocks = (ptr*)malloc(blockCount * szaddr);
+	ptr const pool = malloc(poolSize);
+	kptr block = 0, block_found = 0;
+	ptr pool_image = 0;
+	ijkStream stream[1] = { 0 };
+	ijkMemoryTypeUsage usage[4] = { 0 };
+	ijkMemoryHandle handle = 0, handle_reused = 0;
+	ijkTimer timer[1] = { 0 };
+	dbl time_pool = 0.0, time_arena = 0.0, time_malloc = 0.0;
+	size frame, i, reserved = 0, fragmented = 0, fragmented_step = 0, marker = 0, count = 0;
+
+	if (!blocks || !pool)
+	{
+		free(blocks);
+		free(pool);
+		return;
+	}
+
+	// pool
+	ijkBaseTestCheck(ijkMemoryPoolCreate(pool, poolSize, poolSize / 2, name, 0), ijk_success);
+	ijkTimerSet(timer, 0.0);
+	ijkTimerStart(timer);
+	for (frame = 0; frame < frameCount; ++frame)
+	{
+		for (i = 0; i < blockCount; ++i)
+		{
+			blocks[i] = 0;
+			ijkMemoryBlockCreate(blocks + i, 16 + ((i * 37) & 0xF0), pool, name, i & 0xF, 0);
+		}
+		for (i = 1; i < blockCount; i += 2)
+			ijkMemoryBlockRelease(blocks[i], pool, 0);
+		for (i = 0; i < blockCount; i += 2)
+			ijkMemoryBlockRelease(blocks[i], pool, 0);
+	}
+	ijkTimerStop(timer);
+	time_pool = timer->tickMeasure;
+	ijkMemoryPoolGetReserved(pool, &reserved);		// 0
+	ijkMemoryPoolGetFragmented(pool, &fragmented);	// > 0 (descriptors of recycled quick blocks)
+
+	// defragment: leave holes between blocks too large for quick lists, 
+	//	then compact in bounded steps
+	for (i = 0; i < blockCount; ++i)
+	{
+		blocks[i] = 0;
+		ijkMemoryBlockCreate(blocks + i, 512, pool, name, 0, 0);
+	}
+	for (i = 0; i < blockCount; i += 2)
+		ijkMemoryBlockRelease(blocks[i], pool, 0);
+	ijkBaseTestCheck(ijkMemoryPoolDefragmentStep(pool, 4096, 0, 0, &fragmented, &fragmented_step), ijk_warn_memory_incomplete);	// , fragmented > fragmented_step
+	ijkBaseTestCheck(ijkMemoryPoolDefragment(pool, 0), ijk_success);
+	ijkMemoryPoolGetFragmented(pool, &fragmented);		// (blockCount / 2) * szc(ijkMemoryBlock)
+
+	// name index: renamed block is found by hash instead of by search
+	ijkBaseTestCheck(ijkMemoryPoolCreateIndex(pool, blockCount), ijk_success);
+	ijkBaseTestCheck(ijkMemoryPoolGetBlock(pool, &block, name), ijk_success);
+	ijkBaseTestCheck(ijkMemoryBlockSetName((ptr)block, name_found), ijk_success);
+	ijkBaseTestCheck(ijkMemoryPoolGetBlock(pool, &block_found, name_found), ijk_success);	// , block_found == block
+
+	// save and load: pool image is relocatable as-is, index included
+	ijkBaseTestCheck(ijkStreamCreateBuffer(stream, poolSize + 4096, 0), ijk_success);
+	ijkBaseTestCheck(ijkMemoryPoolSave(pool, poolSize, stream, 0), ijk_success);
+	ijkBaseTestCheck(ijkMemoryPoolRelease(pool, 0), ijk_success);
+	ijkBaseTestCheck(ijkStreamBufferReset(stream, ijk_true), ijk_success);
+	ijkBaseTestCheck(ijkMemoryPoolLoad(pool, poolSize, stream, 0), ijk_success);
+	block_found = 0;
+	ijkBaseTestCheck(ijkMemoryPoolGetBlock(pool, &block_found, name_found), ijk_success);	// , block_found == block
+	ijkBaseTestCheck(ijkMemoryPoolLoadInPlace(&pool_image, stream->base, poolSize + 4096), ijk_success);
+	block_found = 0;
+	ijkBaseTestCheck(ijkMemoryPoolGetBlock(pool_image, &block_found, name_found), ijk_success);	// , block_found in image
+	ijkBaseTestCheck(ijkMemoryPoolRelease(pool_image, 0), ijk_success);
+	ijkBaseTestCheck(ijkStreamRelease(stream), ijk_success);
+	ijkBaseTestCheck(ijkMemoryPoolReleaseIndex(pool), ijk_success);
+	ijkBaseTestCheck(ijkMemoryPoolRelease(pool, 0), ijk_success);
+
+	// instrumentation: usage by type, leaked block reported with its site;
+	//	without IJK_MEMORY_INSTRUMENT no trace is created, so there is no
+	//	usage to get
+	ijkBaseTestCheck(ijkMemoryPoolCreate(pool, poolSize, poolSize / 2, name, 0), ijk_success);
+	ijkBaseTestCheck(ijkStreamCreateBuffer(stream, 4096, 0), ijk_success);
+#ifdef IJK_MEMORY_INSTRUMENT
+	ijkBaseTestCheck(ijkMemoryPoolCreateTrace(pool, 256, 4, stream), ijk_success);
+#else	// !IJK_MEMORY_INSTRUMENT
+	ijkBaseTestCheck(ijkMemoryPoolCreateTrace(pool, 256, 4, stream), ijk_fail_operationfail);
+#endif	// IJK_MEMORY_INSTRUMENT
+	blocks[0] = blocks[1] = 0;
+	ijkBaseTestCheck(ijkMemoryBlockCreateAt(blocks + 0, 64, pool, name, 1, 0, ijk_memory_site), ijk_success);
+	ijkBaseTestCheck(ijkMemoryBlockCreateAt(blocks + 1, 64, pool, name, 2, 0, ijk_memory_site), ijk_success);
+	ijkBaseTestCheck(ijkMemoryBlockReleaseAt(blocks[0], pool, 0, ijk_memory_site), ijk_success);
+#ifdef IJK_MEMORY_INSTRUMENT
+	ijkBaseTestCheck(ijkMemoryPoolGetTypeUsage(pool, usage, 4, &count), ijk_success);	// usage[].countPeak == 1
+	ijkBaseTestCheck(count, 2);
+#else	// !IJK_MEMORY_INSTRUMENT
+	ijkBaseTestCheck(ijkMemoryPoolGetTypeUsage(pool, usage, 4, &count), ijk_fail_invalidparams);
+#endif	// IJK_MEMORY_INSTRUMENT
+	ijkBaseTestCheck(ijkMemoryPoolRelease(pool, 0), ijk_success);	// , report of blocks[1] in stream
+	ijkBaseTestCheck(ijkStreamRelease(stream), ijk_success);
+
+	// double-buffered arena: same frames, released wholesale on reset
+	ijkBaseTestCheck(ijkMemoryArenaCreate(pool, poolSize, 2, name), ijk_success);
+	ijkTimerStart(timer);
+	for (frame = 0; frame < frameCount; ++frame)
+	{
+		ijkMemoryArenaReset(pool);
+		for (i = 0; i < blockCount; ++i)
+		{
+			blocks[i] = 0;
+			ijkMemoryArenaReserve(pool, blocks + i, 16 + ((i * 37) & 0xF0));
+		}
+	}
+	ijkTimerStop(timer);
+	time_arena = timer->tickMeasure;
+
+	// scratch from the top end, rolled back to marker
+	ijkMemoryArenaGetMarkerTop(pool, &marker);
+	blocks[0] = 0;
+	ijkBaseTestCheck(ijkMemoryArenaReserveTop(pool, blocks, 4096), ijk_success);
+	ijkBaseTestCheck(ijkMemoryArenaRollbackTop(pool, marker), ijk_success);
+	ijkMemoryArenaReset(pool);
+	ijkBaseTestCheck(ijkMemoryArenaRollbackTop(pool, marker), ijk_fail_operationfail);	// (marker from other buffer)
+	ijkBaseTestCheck(ijkMemoryArenaRelease(pool), ijk_success);
+
+	// object pool: released slot is reused, old handle is detected as stale
+	ijkBaseTestCheck(ijkMemoryObjectPoolCreate(pool, poolSize, 48, name), ijk_success);
+	ijkBaseTestCheck(ijkMemoryObjectCreate(&handle, blocks, pool, 0), ijk_success);
+	ijkBaseTestCheck(ijkMemoryObjectRelease(handle, pool, 0), ijk_success);
+	ijkBaseTestCheck(ijkMemoryObjectCreate(&handle_reused, blocks + 1, pool, 0), ijk_success);	// , blocks[1] == blocks[0]
+	ijkBaseTestCheck(ijkMemoryObjectGet(blocks, handle, pool), ijk_fail_operationfail);
+	ijkBaseTestCheck(ijkMemoryObjectGet(blocks, handle_reused, pool), ijk_success);
+	ijkBaseTestCheck(ijkMemoryObjectRelease(handle, pool, 0), ijk_fail_operationfail);
+	ijkBaseTestCheck(ijkMemoryObjectRelease(handle_reused, pool, 0), ijk_success);
+	ijkBaseTestCheck(ijkMemoryObjectPoolRelease(pool), ijk_success);
+
+	// malloc
+	ijkTimerStart(timer);
+	for (frame = 0; frame < frameCount; ++frame)
+	{
+		for (i = 0; i < blockCount; ++i)
+			blocks[i] = malloc(16 + ((i * 37) & 0xF0));
+		for (i = 1; i < blockCount; i += 2)
+			free(blocks[i]);
+		for (i = 0; i < blockCount; i += 2)
+			free(blocks[i]);
+	}
+	ijkTimerStop(timer);
+	time_malloc = timer->tickMeasure;
+
+	// compare
+	time_pool /= time_malloc;	// < 1 (pool faster than malloc)
+	time_arena /= time_malloc;	// < time_pool
+
+	free(blocks);
+	free(pool);
+}
+
+
+iret ijkBaseTestMemoryThreadsEntry(ptr entryArg)
+{
+	// random mix of reservations and releases through own cache
+	size const iterationCount = 1 << 20, blockCount = 256;
+	ptr blocks[256] = { 0 };
+	ptr cache = 0;
+	size i, k, r = (size)blocks;
+
+	if (ijkMemoryCacheCreate(&cache, entryArg) != ijk_success)
+		return ijk_failure;
+	for (i = 0; i < iterationCount; ++i)
+	{
+		r = r * 1103515245 + 12345;
+		k = (r >> 8) & (blockCount - 1);
+		if (blocks[k])
+		{
+			ijkMemoryCacheBlockRelease(blocks[k], cache);
+			blocks[k] = 0;
+		}
+		else
+			ijkMemoryCacheBlockCreate(blocks + k, 16 + (r & 0xF0), cache);
+	}
+	for (k = 0; k < blockCount; ++k)
+		if (blocks[k])
+			ijkMemoryCacheBlockRelease(blocks[k], cache);
+	return ijkMemoryCacheRelease(cache);
+}
+
+
+void ijkBaseTestMemoryThreads()
+{
+	// stress: every thread reserves and releases through its own cache
+	size const poolSize = 16 << 20, iterationCount = 1 << 20;
+	tag const name = "ijkBaseTestMemoryThreads";
+	ptr const pool = malloc(poolSize);
+	ijkThread thread[8] = { 0 };
+	ijkTimer timer[1] = { 0 };
+	dbl throughput[4] = { 0.0 };	// operations per second with 1, 2, 4, 8 threads
+	size n, t, threadCount, reserved = 0;
+
+	if (!pool)
+		return;
+
+	ijkBaseTestCheck(ijkMemoryPoolCreate(pool, poolSize, poolSize / 2, name, 0), ijk_success);
+	ijkTimerSet(timer, 0.0);
+	for (n = 0; n < 4; ++n)
+	{
+		threadCount = (size)1 << n;
+		ijkTimerStart(timer);
+		for (t = 0; t < threadCount; ++t)
+			ijkThreadCreate(thread + t, ijkBaseTestMemoryThreadsEntry, pool, name);
+		for (t = 0; t < threadCount; ++t)
+			ijkThreadRelease(thread + t);
+		ijkTimerStop(timer);
+		throughput[n] = (dbl)(threadCount * iterationCount) / timer->tickMeasure;
+	}
+	ijkMemoryPoolGetReserved(pool, &reserved);	// 0 (caches return everything)
+	ijkBaseTestCheck(ijkMemoryPoolRelease(pool, 0), ijk_success);
+
+	// compare
+	throughput[3] /= throughput[0];	// near 8 given 8 cores (no contention)
+	throughput[2] /= throughput[0];	// near 4 given 4 cores
+	throughput[1] /= throughput[0];	// near 2 given 2 cores
+
+	free(pool);
+}
+
+
+void ijkBaseTestMemoryVector()
+{
+	// set, copy and compare at each instruction set against the C library, 
+	//	for every power of two from 8 B to 64 MB; each run streams the same 
+	//	number of bytes
+	size const sizeMax = 64 << 20, sizeCount = 24, streamBytes = 64 << 20;
+	pbyte const src = (pbyte)malloc(sizeMax), dst = (pbyte)malloc(sizeMax);
+	ijkTimer timer[1] = { 0 };
+	dbl rate[4][3][24] = { { { 0.0 } } };	// bytes per second: [scalar, sse2, avx2, libc][set, copy, compare][size]
+	ijkMemoryVector supported = ijkMemoryVector_scalar, vector;
+	ptrdiff check = 0;
+	size n, i, sz, count;
+
+	// called through pointers so that the compiler cannot drop or hoist them
+	ptr(*volatile const libcSet)(ptr, int, size_t) = memset;
+	ptr(*volatile const libcCopy)(ptr, kptr, size_t) = memcpy;
+	int(*volatile const libcCompare)(kptr, kptr, size_t) = memcmp;
+
+	if (!src || !dst)
+	{
+		free(src);
+		free(dst);
+		return;
+	}
+
+	ijkBaseTestCheck(ijkMemoryGetVector(&supported, 0), ijk_success);
+	memset(src, 0x5A, sizeMax);
+	ijkTimerSet(timer, 0.0);
+	for (n = 0, sz = 8; n < sizeCount; ++n, sz <<= 1)
+	{
+		count = (streamBytes / sz);
+		for (vector = ijkMemoryVector_scalar; vector <= supported; ++vector)
+		{
+			ijkBaseTestCheck(ijkMemorySelectVector(vector), ijk_success);
+			ijkTimerStart(timer);
+			for (i = 0; i < count; ++i)
+				ijkMemorySet(dst, sz, 0x5A);
+			ijkTimerStop(timer);
+			rate[vector][0][n] = (dbl)streamBytes / timer->tickMeasure;
+			ijkTimerStart(timer);
+			for (i = 0; i < count; ++i)
+				ijkMemoryCopy(dst, src, sz);
+			ijkTimerStop(timer);
+			rate[vector][1][n] = (dbl)streamBytes / timer->tickMeasure;
+			ijkTimerStart(timer);
+			for (i = 0; i < count; ++i)
+				check += ijkMemoryCompare(dst, src, sz);
+			ijkTimerStop(timer);
+			rate[vector][2][n] = (dbl)streamBytes / timer->tickMeasure;
+		}
+
+		// libc
+		ijkTimerStart(timer);
+		for (i = 0; i < count; ++i)
+			libcSet(dst, 0x5A, sz);
+		ijkTimerStop(timer);
+		rate[3][0][n] = (dbl)streamBytes / timer->tickMeasure;
+		ijkTimerStart(timer);
+		for (i = 0; i < count; ++i)
+			libcCopy(dst, src, sz);
+		ijkTimerStop(timer);
+		rate[3][1][n] = (dbl)streamBytes / timer->tickMeasure;
+		ijkTimerStart(timer);
+		for (i = 0; i < count; ++i)
+			check += libcCompare(dst, src, sz);
+		ijkTimerStop(timer);
+		rate[3][2][n] = (dbl)streamBytes / timer->tickMeasure;
+	}
+	ijkBaseTestCheck(ijkMemorySelectVector(supported), ijk_success);
+
+	// compare
+	for (n = 0; n < sizeCount; ++n)
+		for (i = 0; i < 3; ++i)
+		{
+			rate[0][i][n] /= rate[3][i][n];	// < 1 past a few hundred bytes
+			rate[1][i][n] /= rate[3][i][n];	// near 1 past a few hundred bytes
+			rate[2][i][n] /= rate[3][i][n];	// near 1, > rate[1] while in cache
+		}
+
+	free(src);
+	free(dst);
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkBaseTestThreadEntry(ptr entryArg)
+{
+	// count until asked to finish
+	size volatile* const count = (size volatile*)entryArg;
+	while (!ijkThreadCheckCancel())
+		ijkAtomicAdd(count, 1);
+	return ijk_success;
+}
+
+
+void ijkBaseTestThread()
+{
+	tag const name = "ijkBaseTestThread";
+	ijkThread thread[2] = { 0 };
+	size volatile count[2] = { 0 };
+	size coreCount = 0;
+
+	ijkBaseTestCheck(ijkThreadGetCoreCount(&coreCount), ijk_success);
+	ijkBaseTestCheck(ijkThreadCheckCancel(), ijk_false);	// (not created by ijk)
+
+	// lifecycle: ID is valid and thread active as soon as create returns
+	ijkBaseTestCheck(ijkThreadCreate(thread, ijkBaseTestThreadEntry, (ptr)count, name), ijk_success);	// (sysID non-zero)
+	ijkBaseTestCheck(ijkThreadCheckActive(thread), ijk_true);
+	ijkBaseTestCheck(ijkThreadSetPriority(thread, ijkThreadPriority_low), ijk_success);
+	ijkBaseTestCheck(ijkThreadSetAffinity(thread, 1), ijk_success);	// (core 0 only)
+	ijkBaseTestCheck(ijkThreadSetAffinity(thread, 0), ijk_success);	// (any core)
+	ijkBaseTestCheck(ijkThreadCancel(thread), ijk_success);
+	ijkBaseTestCheck(ijkThreadRelease(thread), ijk_success);	// (result ijk_success)
+	ijkBaseTestCheck(ijkThreadCheckActive(thread), ijk_fail_invalidparams);	// (released)
+
+	// configured before entry: small stack, last core, lowest priority
+	ijkBaseTestCheck(ijkThreadCreateExt(thread + 1, ijkBaseTestThreadEntry, (ptr)(count + 1), name,
+		1 << 16, (size)1 << ((coreCount - 1) % (szchomp * 8)), ijkThreadPriority_lowest), ijk_success);
+	ijkBaseTestCheck(ijkThreadCancel(thread + 1), ijk_success);
+	ijkBaseTestCheck(ijkThreadRelease(thread + 1), ijk_success);
+
+	// unsafe release takes the thread at its next cancellation point and 
+	//	leaves the process running
+	ijkBaseTestCheck(ijkThreadCreate(thread, ijkBaseTestThreadEntry, (ptr)count, name), ijk_success);
+	ijkBaseTestCheck(ijkThreadReleaseUnsafe(thread), ijk_success);
+}
+
+
+//-----------------------------------------------------------------------------
+
+typedef struct ijkBaseTestMutexShared
+{
+	ijkMutex mutex[1];
+	ijkBaseTestSystemMutex sysMutex[1];
+	size counter, iterationCount;
+} ijkBaseTestMutexShared;
+
+
+iret ijkBaseTestMutexEntry(ptr entryArg)
+{
+	// short critical section so that hand-off cost dominates
+	ijkBaseTestMutexShared* const shared = (ijkBaseTestMutexShared*)entryArg;
+	size i;
+	for (i = 0; i < shared->iterationCount; ++i)
+	{
+		ijkMutexLockWait(shared->mutex);
+		++shared->counter;
+		ijkMutexUnlock(shared->mutex);
+	}
+	return ijk_success;
+}
+
+
+iret ijkBaseTestMutexSystemEntry(ptr entryArg)
+{
+	ijkBaseTestMutexShared* const shared = (ijkBaseTestMutexShared*)entryArg;
+	size i;
+	for (i = 0; i < shared->iterationCount; ++i)
+	{
+		ijkBaseTestSystemMutexLock(shared->sysMutex);
+		++shared->counter;
+		ijkBaseTestSystemMutexUnlock(shared->sysMutex);
+	}
+	return ijk_success;
+}
+
+
+void ijkBaseTestMutex()
+{
+	// contention: 1 to 64 threads share one counter behind each mutex; the 
+	//	total number of operations is the same for every thread count
+	size const operationCount = 1 << 22, threadCountMax = 64, runCount = 7;
+	tag const name = "ijkBaseTestMutex";
+	ijkThread* const thread = (ijkThread*)malloc(threadCountMax * sizeof(ijkThread));
+	ijkBaseTestMutexShared shared[1] = { 0 };
+	ijkTimer timer[1] = { 0 };
+	dbl throughput[2][7] = { { 0.0 } };	// operations per second: [ijk, system][1, 2, 4 ... 64 threads]
+	size n, t, threadCount;
+
+	if (!thread)
+		return;
+
+	// recursion and ownership
+	ijkBaseTestCheck(ijkMutexLock(shared->mutex), ijk_success);
+	ijkBaseTestCheck(ijkMutexLockWait(shared->mutex), ijk_warn_mutex_current);
+	ijkBaseTestCheck(ijkMutexIsLockedByCaller(shared->mutex), ijk_true);
+	ijkBaseTestCheck(ijkMutexUnlock(shared->mutex), ijk_success);
+	ijkBaseTestCheck(ijkMutexUnlock(shared->mutex), ijk_fail_operationfail);
+	ijkBaseTestCheck(ijkMutexIsUnlocked(shared->mutex), ijk_true);
+
+	ijkBaseTestSystemMutexCreate(shared->sysMutex);
+	ijkTimerSet(timer, 0.0);
+	for (n = 0; n < runCount; ++n)
+	{
+		threadCount = (size)1 << n;
+		shared->iterationCount = operationCount / threadCount;
+
+		memset(thread, 0, threadCount * sizeof(ijkThread));
+		shared->counter = 0;
+		ijkTimerStart(timer);
+		for (t = 0; t < threadCount; ++t)
+			ijkThreadCreate(thread + t, ijkBaseTestMutexEntry, shared, name);
+		for (t = 0; t < threadCount; ++t)
+			ijkThreadRelease(thread + t);
+		ijkTimerStop(timer);
+		throughput[0][n] = (dbl)operationCount / timer->tickMeasure;
+		ijkBaseTestCheck(shared->counter, operationCount);
+
+		memset(thread, 0, threadCount * sizeof(ijkThread));
+		shared->counter = 0;
+		ijkTimerStart(timer);
+		for (t = 0; t < threadCount; ++t)
+			ijkThreadCreate(thread + t, ijkBaseTestMutexSystemEntry, shared, name);
+		for (t = 0; t < threadCount; ++t)
+			ijkThreadRelease(thread + t);
+		ijkTimerStop(timer);
+		throughput[1][n] = (dbl)operationCount / timer->tickMeasure;
+		ijkBaseTestCheck(shared->counter, operationCount);
+	}
+	ijkBaseTestSystemMutexRelease(shared->sysMutex);
+
+	// compare
+	for (n = 0; n < runCount; ++n)
+		throughput[0][n] /= throughput[1][n];	// near 1 uncontended, >= 1 under contention
+
+	free(thread);
+}
+
+
+//-----------------------------------------------------------------------------
+
+typedef struct ijkBaseTestSyncShared
+{
+	ijkEvent ping[1], pong[1];
+	ijkSemaphore empty[1], full[1];
+	ijkRWLock lock[1];
+	ijkBarrier barrier[1];
+	size ring[16], a, b;
+	size phase[4];
+	size volatile mismatch, last;
+	size iterationCount;
+} ijkBaseTestSyncShared;
+
+
+iret ijkBaseTestSyncEventEntry(ptr entryArg)
+{
+	// answer every ping with a pong
+	ijkBaseTestSyncShared* const shared = (ijkBaseTestSyncShared*)entryArg;
+	size i;
+	for (i = 0; i < shared->iterationCount; ++i)
+	{
+		ijkEventWait(shared->ping);
+		ijkEventSignal(shared->pong);
+	}
+	return ijk_success;
+}
+
+
+iret ijkBaseTestSyncProducerEntry(ptr entryArg)
+{
+	// bounded buffer: take an empty slot, fill it, post it as full
+	ijkBaseTestSyncShared* const shared = (ijkBaseTestSyncShared*)entryArg;
+	size i;
+	for (i = 0; i < shared->iterationCount; ++i)
+	{
+		ijkSemaphoreAcquireWait(shared->empty);
+		shared->ring[i % 16] = i + 1;
+		ijkSemaphorePost(shared->full, 1);
+	}
+	return ijk_success;
+}
+
+
+iret ijkBaseTestSyncRWLockEntry(ptr entryArg)
+{
+	// mostly readers; a reader must never see a write half done
+	ijkBaseTestSyncShared* const shared = (ijkBaseTestSyncShared*)entryArg;
+	size i;
+	for (i = 0; i < shared->iterationCount; ++i)
+	{
+		if (i % 8)
+		{
+			ijkRWLockReadWait(shared->lock);
+			if (shared->a != shared->b)
+				ijkAtomicAdd(&shared->mismatch, 1);
+			ijkRWLockReadUnlock(shared->lock);
+		}
+		else
+		{
+			ijkRWLockWriteWait(shared->lock);
+			++shared->a;
+			ijkAtomicPause();
+			++shared->b;
+			ijkRWLockWriteUnlock(shared->lock);
+		}
+	}
+	return ijk_success;
+}
+
+
+iret ijkBaseTestSyncBarrierEntry(ptr entryArg)
+{
+	// every thread publishes its phase, then checks that all others have 
+	//	reached it before anyone moves on
+	ijkBaseTestSyncShared* const shared = (ijkBaseTestSyncShared*)entryArg;
+	size const index = ijkAtomicAdd(&shared->last, 1);
+	size i, t;
+	for (i = 0; i < shared->iterationCount; ++i)
+	{
+		shared->phase[index] = i;
+		ijkBarrierWait(shared->barrier);
+		for (t = 0; t < 4; ++t)
+			if (shared->phase[t] != i)
+				ijkAtomicAdd(&shared->mismatch, 1);
+		ijkBarrierWait(shared->barrier);
+	}
+	return ijk_success;
+}
+
+
+void ijkBaseTestSync()
+{
+	size const iterationCount = 1 << 12, threadCount = 4;
+	tag const name = "ijkBaseTestSync";
+	ijkThread thread[4] = { 0 };
+	ijkBaseTestSyncShared shared[1] = { 0 };
+	size i, t, sum = 0;
+
+	shared->iterationCount = iterationCount;
+
+	// event: auto-reset passes one check per signal, manual stays signaled
+	ijkBaseTestCheck(ijkEventCreate(shared->ping, ijk_false, ijk_true), ijk_success);
+	ijkBaseTestCheck(ijkEventCheck(shared->ping), ijk_true);
+	ijkBaseTestCheck(ijkEventCheck(shared->ping), ijk_false);
+	ijkBaseTestCheck(ijkEventCreate(shared->pong, ijk_true, ijk_false), ijk_success);
+	ijkBaseTestCheck(ijkEventSignal(shared->pong), ijk_success);
+	ijkBaseTestCheck(ijkEventCheck(shared->pong), ijk_true);
+	ijkBaseTestCheck(ijkEventCheck(shared->pong), ijk_true);
+	ijkBaseTestCheck(ijkEventReset(shared->pong), ijk_success);
+	ijkBaseTestCheck(ijkEventCheck(shared->pong), ijk_false);
+
+	// event: ping-pong hand-off between two threads
+	ijkBaseTestCheck(ijkEventCreate(shared->pong, ijk_false, ijk_false), ijk_success);
+	ijkBaseTestCheck(ijkThreadCreate(thread, ijkBaseTestSyncEventEntry, shared, name), ijk_success);
+	for (i = 0; i < iterationCount; ++i)
+	{
+		ijkEventSignal(shared->ping);
+		ijkEventWait(shared->pong);
+	}
+	ijkBaseTestCheck(ijkThreadRelease(thread), ijk_success);
+
+	// semaphore: counts and bounded buffer
+	ijkBaseTestCheck(ijkSemaphoreCreate(shared->full, 1), ijk_success);
+	ijkBaseTestCheck(ijkSemaphoreAcquire(shared->full), ijk_success);
+	ijkBaseTestCheck(ijkSemaphoreAcquire(shared->full), ijk_fail_operationfail);
+	ijkBaseTestCheck(ijkSemaphoreCreate(shared->empty, 16), ijk_success);
+	ijkBaseTestCheck(ijkThreadCreate(thread, ijkBaseTestSyncProducerEntry, shared, name), ijk_success);
+	for (i = 0; i < iterationCount; ++i)
+	{
+		ijkSemaphoreAcquireWait(shared->full);
+		sum += shared->ring[i % 16];
+		ijkSemaphorePost(shared->empty, 1);
+	}
+	ijkBaseTestCheck(ijkThreadRelease(thread), ijk_success);
+	ijkBaseTestCheck(sum, iterationCount * (iterationCount + 1) / 2);
+
+	// reader-writer lock: readers share, writers exclude and hold back 
+	//	new readers
+	ijkBaseTestCheck(ijkRWLockRead(shared->lock), ijk_success);
+	ijkBaseTestCheck(ijkRWLockRead(shared->lock), ijk_success);
+	ijkBaseTestCheck(ijkRWLockWrite(shared->lock), ijk_fail_operationfail);
+	ijkBaseTestCheck(ijkRWLockReadUnlock(shared->lock), ijk_success);
+	ijkBaseTestCheck(ijkRWLockReadUnlock(shared->lock), ijk_success);
+	ijkBaseTestCheck(ijkRWLockReadUnlock(shared->lock), ijk_fail_operationfail);
+	ijkBaseTestCheck(ijkRWLockWrite(shared->lock), ijk_success);
+	ijkBaseTestCheck(ijkRWLockRead(shared->lock), ijk_fail_operationfail);
+	ijkBaseTestCheck(ijkRWLockWriteUnlock(shared->lock), ijk_success);
+	for (t = 0; t < threadCount; ++t)
+		ijkThreadCreate(thread + t, ijkBaseTestSyncRWLockEntry, shared, name);
+	for (t = 0; t < threadCount; ++t)
+		ijkThreadRelease(thread + t);
+	ijkBaseTestCheck(shared->mismatch, 0);
+	ijkBaseTestCheck(shared->a, threadCount * iterationCount / 8);
+
+	// barrier: no thread leaves a phase before all have entered it
+	shared->mismatch = 0;
+	ijkBaseTestCheck(ijkBarrierCreate(shared->barrier, (dword)threadCount), ijk_success);
+	for (t = 0; t < threadCount; ++t)
+		ijkThreadCreate(thread + t, ijkBaseTestSyncBarrierEntry, shared, name);
+	for (t = 0; t < threadCount; ++t)
+		ijkThreadRelease(thread + t);
+	ijkBaseTestCheck(shared->mismatch, 0);
+	ijkBaseTestCheck(shared->barrier->phase, 2 * iterationCount);
+}
+
+
+//-----------------------------------------------------------------------------
+
+typedef struct ijkBaseTestFiberShared
+{
+	ijkFiber thread[1], fiber[1];
+	ijkEvent ping[1], pong[1];
+	size value, count;
+} ijkBaseTestFiberShared;
+
+
+iret ijkBaseTestFiberEntry(ptr entryArg)
+{
+	// generator: hand each number back to the caller in turn
+	ijkBaseTestFiberShared* const shared = (ijkBaseTestFiberShared*)entryArg;
+	size i;
+	for (i = 1; i <= shared->count; ++i)
+	{
+		shared->value = i;
+		ijkFiberSwitch(shared->fiber, shared->fiber->caller);
+	}
+	return (iret)shared->count;
+}
+
+
+iret ijkBaseTestFiberThreadEntry(ptr entryArg)
+{
+	// same hand-off between threads
+	ijkBaseTestFiberShared* const shared = (ijkBaseTestFiberShared*)entryArg;
+	size i;
+	for (i = 1; i <= shared->count; ++i)
+	{
+		shared->value = i;
+		ijkEventSignal(shared->pong);
+		ijkEventWait(shared->ping);
+	}
+	return ijk_success;
+}
+
+
+void ijkBaseTestFiber()
+{
+	size const count = 1 << 16;
+	tag const name = "ijkBaseTestFiber";
+	ijkThread thread[1] = { 0 };
+	ijkBaseTestFiberShared shared[1] = { 0 };
+	ijkTimer timer[1] = { 0 };
+	dbl time[2] = { 0.0 };	// [fibers, threads]
+	size i, sum[2] = { 0 };
+
+	shared->count = count;
+	ijkTimerSet(timer, 0.0);
+
+	// fibers: switch to generator until it returns
+	ijkBaseTestCheck(ijkFiberSwitch(shared->thread, shared->fiber), ijk_fail_invalidparams);	// (not converted)
+	ijkBaseTestCheck(ijkFiberConvertThread(shared->thread), ijk_success);
+	ijkBaseTestCheck(ijkFiberCreate(shared->fiber, ijkBaseTestFiberEntry, shared, 0), ijk_success);
+	ijkTimerStart(timer);
+	for (;;)
+	{
+		ijkFiberSwitch(shared->thread, shared->fiber);
+		if (!shared->fiber->active)
+			break;
+		sum[0] += shared->value;
+	}
+	ijkTimerStop(timer);
+	time[0] = timer->tickMeasure;
+	ijkBaseTestCheck(shared->fiber->result, count);
+	ijkBaseTestCheck(ijkFiberSwitch(shared->thread, shared->fiber), ijk_fail_invalidparams);	// (returned)
+	ijkBaseTestCheck(ijkFiberRelease(shared->fiber), ijk_success);
+	ijkBaseTestCheck(ijkFiberRevertThread(shared->thread), ijk_success);
+
+	// threads: event ping-pong
+	ijkBaseTestCheck(ijkEventCreate(shared->ping, ijk_false, ijk_false), ijk_success);
+	ijkBaseTestCheck(ijkEventCreate(shared->pong, ijk_false, ijk_false), ijk_success);
+	ijkTimerStart(timer);
+	ijkBaseTestCheck(ijkThreadCreate(thread, ijkBaseTestFiberThreadEntry, shared, name), ijk_success);
+	for (i = 0; i < count; ++i)
+	{
+		ijkEventWait(shared->pong);
+		sum[1] += shared->value;
+		ijkEventSignal(shared->ping);
+	}
+	ijkBaseTestCheck(ijkThreadRelease(thread), ijk_success);
+	ijkTimerStop(timer);
+	time[1] = timer->tickMeasure;
+
+	// compare
+	ijkBaseTestCheck(sum[0], count * (count + 1) / 2);
+	ijkBaseTestCheck(sum[1], count * (count + 1) / 2);
+	time[1] /= time[0];	// well above 1: each hand-off goes through the kernel
+}
+
+
+//-----------------------------------------------------------------------------
+
+typedef struct ijkBaseTestJobChunk
+{
+	ptr jobs;
+	struct ijkBaseTestJobChunk* tree;
+	ijkJobCounter* counter;
+	dbl const* values;
+	size count;
+	dbl sum;
+} ijkBaseTestJobChunk;
+
+
+iret ijkBaseTestJobSum(ptr jobArg)
+{
+	ijkBaseTestJobChunk* const chunk = (ijkBaseTestJobChunk*)jobArg;
+	size i;
+	for (i = 0, chunk->sum = 0.0; i < chunk->count; ++i)
+		chunk->sum += chunk->values[i];
+	return ijk_success;
+}
+
+
+iret ijkBaseTestJobCombine(ptr jobArg)
+{
+	// sum of the chunks preceding this one
+	ijkBaseTestJobChunk* const chunk = (ijkBaseTestJobChunk*)jobArg;
+	size i;
+	for (i = 0, chunk->sum = 0.0; i < chunk->count; ++i)
+		chunk->sum += chunk->tree[i].sum;
+	return ijk_success;
+}
+
+
+iret ijkBaseTestJobSplit(ptr jobArg)
+{
+	// nested submission: halve the range until small, as a hierarchy would; 
+	//	children of node k are nodes 2k+1 and 2k+2
+	ijkBaseTestJobChunk* const chunk = (ijkBaseTestJobChunk*)jobArg;
+	ijkBaseTestJobChunk* const child = chunk->tree + (chunk - chunk->tree) * 2 + 1;
+	if (chunk->count > 4096)
+	{
+		child[0] = child[1] = *chunk;
+		child[0].count = chunk->count / 2;
+		child[1].values += child[0].count;
+		child[1].count -= child[0].count;
+		chunk->sum = 0.0;
+		ijkJobSubmit(chunk->jobs, ijkBaseTestJobSplit, child + 0, chunk->counter, 0);
+		ijkJobSubmit(chunk->jobs, ijkBaseTestJobSplit, child + 1, chunk->counter, 0);
+		return ijk_success;
+	}
+	return ijkBaseTestJobSum(chunk);
+}
+
+
+iret ijkBaseTestJobThreadSum(ptr entryArg)
+{
+	return ijkBaseTestJobSum(entryArg);
+}
+
+
+typedef struct ijkBaseTestJobFork
+{
+	ptr jobs;
+	size n, result;
+} ijkBaseTestJobFork;
+
+
+iret ijkBaseTestJobFib(ptr jobArg)
+{
+	// fork-join: every job waits on its two children
+	ijkBaseTestJobFork* const fork = (ijkBaseTestJobFork*)jobArg;
+	if (fork->n > 1)
+	{
+		ijkBaseTestJobFork child[2] = { { fork->jobs, fork->n - 1, 0 }, { fork->jobs, fork->n - 2, 0 } };
+		ijkJobCounter counter[1] = { 0 };
+		ijkJobSubmit(fork->jobs, ijkBaseTestJobFib, child + 0, counter, 0);
+		ijkJobSubmit(fork->jobs, ijkBaseTestJobFib, child + 1, counter, 0);
+		ijkJobWait(fork->jobs, counter);
+		fork->result = child[0].result + child[1].result;
+	}
+	else
+		fork->result = fork->n;
+	return ijk_success;
+}
+
+
+typedef struct ijkBaseTestJobIO
+{
+	ptr jobs;
+	ijkThread thread[1];
+	ijkJobCounter counter[1];
+	size volatile data;
+	size result, polled;
+} ijkBaseTestJobIO;
+
+
+iret ijkBaseTestJobIOThread(ptr entryArg)
+{
+	// stands in for a blocking read on an I/O thread
+	ijkBaseTestJobIO* const io = (ijkBaseTestJobIO*)entryArg;
+	ijkAtomicStore(&io->data, 42);
+	ijkJobSignal(io->jobs, io->counter);
+	return ijk_success;
+}
+
+
+iret ijkBaseTestJobIORequest(ptr jobArg)
+{
+	// hand read off and wait for it without holding up a worker
+	ijkBaseTestJobIO* const io = (ijkBaseTestJobIO*)jobArg;
+	tag const name = "ijkBaseTestJobIO";
+	io->counter->count = 1;
+	ijkThreadCreate(io->thread, ijkBaseTestJobIOThread, io, name);
+	ijkJobWait(io->jobs, io->counter);
+	io->result = io->data;
+	return ijk_success;
+}
+
+
+iret ijkBaseTestJobIOPoll(ptr jobArg)
+{
+	// let other jobs run while data is not ready
+	ijkBaseTestJobIO* const io = (ijkBaseTestJobIO*)jobArg;
+	while (!ijkAtomicLoad(&io->data))
+		ijkJobYield(io->jobs);
+	io->polled = io->data;
+	return ijk_success;
+}
+
+
+void ijkBaseTestJob()
+{
+	// sum a large array in chunks: single thread, thread per chunk (the old 
+	//	way), jobs combined by a job that depends on them, and nested jobs
+	size const valueCount = 1 << 22, chunkCount = 64, chunkSize = valueCount / chunkCount, frameCount = 16;
+	size const baseSize = 1 << 20, nodeCount = valueCount / 4096 * 2;
+	tag const name = "ijkBaseTestJob";
+	ptr const jobs = malloc(baseSize);
+	dbl* const values = (dbl*)malloc(valueCount * sizeof(dbl));
+	ijkBaseTestJobChunk* const chunk = (ijkBaseTestJobChunk*)malloc(nodeCount * sizeof(ijkBaseTestJobChunk));
+	ijkThread thread[64] = { 0 };
+	ijkJobCounter counter[1] = { 0 }, combined[1] = { 0 };
+	ijkBaseTestJobFork fork[1] = { 0 };
+	ijkBaseTestJobIO io[1] = { 0 };
+	ijkTimer timer[1] = { 0 };
+	dbl sum[4] = { 0.0 }, time[6] = { 0.0 };	// [single, threads, jobs, nested, fork-join, fork-join without fibers]
+	size n, i, workerCount = 0, capacity = 0, index = 0;
+
+	if (!jobs || !values || !chunk)
+	{
+		free(jobs);
+		free(values);
+		free(chunk);
+		return;
+	}
+	for (i = 0; i < valueCount; ++i)
+		values[i] = (dbl)(i & 0xFF);
+	for (i = 0; i <= chunkCount; ++i)
+	{
+		chunk[i].jobs = jobs;
+		chunk[i].tree = chunk;
+		chunk[i].counter = counter;
+		chunk[i].values = values + i * chunkSize;
+		chunk[i].count = chunkSize;
+	}
+	chunk[chunkCount].count = chunkCount;
+
+	ijkBaseTestCheck(ijkJobSystemCreate(jobs, 64, 0, ijk_false, name), ijk_fail_operationfail);	// (too small)
+	ijkBaseTestCheck(ijkJobSystemCreate(jobs, baseSize, 0, ijk_false, name), ijk_success);
+	ijkBaseTestCheck(ijkJobSystemGetWorkerCount(jobs, &workerCount), ijk_success);	// (cores)
+	ijkBaseTestCheck(ijkJobSystemGetCapacity(jobs, &capacity), ijk_success);
+	ijkBaseTestCheck(ijkJobSystemGetWorkerIndex(jobs, &index), ijk_success);	// (0)
+	ijkTimerSet(timer, 0.0);
+
+	// single thread
+	ijkTimerStart(timer);
+	for (n = 0; n < frameCount; ++n)
+	{
+		for (i = 0; i < chunkCount; ++i)
+			ijkBaseTestJobSum(chunk + i);
+		ijkBaseTestJobCombine(chunk + chunkCount);
+		sum[0] = chunk[chunkCount].sum;
+	}
+	ijkTimerStop(timer);
+	time[0] = timer->tickMeasure;
+
+	// thread per chunk per frame
+	ijkTimerStart(timer);
+	for (n = 0; n < frameCount; ++n)
+	{
+		for (i = 0; i < chunkCount; ++i)
+			ijkThreadCreate(thread + i, ijkBaseTestJobThreadSum, chunk + i, name);
+		for (i = 0; i < chunkCount; ++i)
+			ijkThreadRelease(thread + i);
+		ijkBaseTestJobCombine(chunk + chunkCount);
+		sum[1] = chunk[chunkCount].sum;
+	}
+	ijkTimerStop(timer);
+	time[1] = timer->tickMeasure;
+	ijkBaseTestCheck(sum[1], sum[0]);
+
+	// job per chunk, combined by a job held until they finish
+	ijkTimerStart(timer);
+	for (n = 0; n < frameCount; ++n)
+	{
+		for (i = 0; i < chunkCount; ++i)
+			ijkBaseTestCheck(ijkJobSubmit(jobs, ijkBaseTestJobSum, chunk + i, counter, 0), ijk_success);
+		ijkBaseTestCheck(ijkJobSubmit(jobs, ijkBaseTestJobCombine, chunk + chunkCount, combined, counter), ijk_success);
+		ijkBaseTestCheck(ijkJobWait(jobs, combined), ijk_success);
+		sum[2] = chunk[chunkCount].sum;
+	}
+	ijkTimerStop(timer);
+	time[2] = timer->tickMeasure;
+	ijkBaseTestCheck(sum[2], sum[0]);
+
+	// nested: one job splits the whole array recursively
+	ijkTimerStart(timer);
+	for (n = 0; n < frameCount; ++n)
+	{
+		chunk->values = values;
+		chunk->count = valueCount;
+		ijkBaseTestCheck(ijkJobSubmit(jobs, ijkBaseTestJobSplit, chunk, counter, 0), ijk_success);
+		ijkBaseTestCheck(ijkJobWait(jobs, counter), ijk_success);
+		for (i = 0, sum[3] = 0.0; i < nodeCount - 1; ++i)
+			sum[3] += chunk[i].sum;
+	}
+	ijkTimerStop(timer);
+	time[3] = timer->tickMeasure;
+	ijkBaseTestCheck(sum[3], sum[0]);
+
+	// fork-join: waiting jobs are set aside on their fibers
+	fork->jobs = jobs;
+	fork->n = 20;
+	ijkTimerStart(timer);
+	ijkBaseTestCheck(ijkJobSubmit(jobs, ijkBaseTestJobFib, fork, counter, 0), ijk_success);
+	ijkBaseTestCheck(ijkJobWait(jobs, counter), ijk_success);
+	ijkTimerStop(timer);
+	time[4] = timer->tickMeasure;
+	ijkBaseTestCheck(fork->result, 6765);
+
+	// work outside the system: one job waits for a signal, another polls
+	io->jobs = jobs;
+	ijkBaseTestCheck(ijkJobYield(jobs), ijk_fail_operationfail);	// (not a job)
+	ijkBaseTestCheck(ijkJobSubmit(jobs, ijkBaseTestJobIORequest, io, counter, 0), ijk_success);
+	ijkBaseTestCheck(ijkJobSubmit(jobs, ijkBaseTestJobIOPoll, io, counter, 0), ijk_success);
+	ijkBaseTestCheck(ijkJobWait(jobs, counter), ijk_success);
+	ijkBaseTestCheck(ijkThreadRelease(io->thread), ijk_success);
+	ijkBaseTestCheck(io->result + io->polled, 84);
+	ijkBaseTestCheck(ijkJobSignal(jobs, io->counter), ijk_fail_operationfail);	// (zero)
+
+	ijkBaseTestCheck(ijkJobSystemRelease(jobs), ijk_success);
+	ijkBaseTestCheck(ijkJobSystemGetWorkerIndex(jobs, &index), ijk_fail_invalidparams);	// (released)
+
+	// fork-join without fibers: waiting jobs run others on their own stack
+	ijkBaseTestCheck(ijkJobSystemCreateExt(jobs, baseSize, 0, ijk_false, name, 0, 0), ijk_success);
+	fork->result = 0;
+	ijkTimerStart(timer);
+	ijkBaseTestCheck(ijkJobSubmit(jobs, ijkBaseTestJobFib, fork, counter, 0), ijk_success);
+	ijkBaseTestCheck(ijkJobWait(jobs, counter), ijk_success);
+	ijkTimerStop(timer);
+	time[5] = timer->tickMeasure;
+	ijkBaseTestCheck(fork->result, 6765);
+	ijkBaseTestCheck(ijkJobSystemRelease(jobs), ijk_success);
+
+	// compare
+	time[3] /= time[0];	// near 1 / cores
+	time[2] /= time[0];	// near 1 / cores
+	time[1] /= time[0];	// well above time[2]: thread launch dominates
+	time[5] /= time[4];	// below 1 on few cores: a switch per job costs more than nesting
+
+	free(chunk);
+	free(values);
+	free(jobs);
+}
+
+
+//-----------------------------------------------------------------------------
+
+typedef struct ijkBaseTestQueueElem
+{
+	size producer, sequence;
+} ijkBaseTestQueueElem;
+
+
+typedef struct ijkBaseTestQueueShared
+{
+	ptr queue;
+	size itemCount, batchCount, total, ordered;
+	size volatile producerCount, popped, sum, misordered;
+} ijkBaseTestQueueShared;
+
+
+iret ijkBaseTestQueueProducer(ptr entryArg)
+{
+	// push sequence numbers 1 to itemCount in batches, retrying when full
+	ijkBaseTestQueueShared* const shared = (ijkBaseTestQueueShared*)entryArg;
+	size const producer = ijkAtomicAdd(&shared->producerCount, 1);
+	ijkBaseTestQueueElem elem[64];
+	size i, n, first = 0, count = 0, pushed = 0;
+	while (pushed < shared->itemCount)
+	{
+		if (count == 0)
+		{
+			count = shared->itemCount - pushed;
+			if (count > shared->batchCount)
+				count = shared->batchCount;
+			for (i = 0, first = 0; i < count; ++i)
+			{
+				elem[i].producer = producer;
+				elem[i].sequence = pushed + i + 1;
+			}
+		}
+		ijkQueuePushBatch(shared->queue, elem + first, count, &n);
+		pushed += n;
+		first += n;
+		count -= n;
+		if (count)
+			ijkAtomicPause();
+	}
+	return ijk_success;
+}
+
+
+iret ijkBaseTestQueueConsumer(ptr entryArg)
+{
+	// pop until all items are accounted for; a single consumer also checks 
+	//	that each producer's items arrive in order
+	ijkBaseTestQueueShared* const shared = (ijkBaseTestQueueShared*)entryArg;
+	ijkBaseTestQueueElem elem[64];
+	size last[64] = { 0 };
+	size i, n, sum = 0;
+	while (ijkAtomicLoad(&shared->popped) < shared->total)
+	{
+		ijkQueuePopBatch(shared->queue, elem, shared->batchCount, &n);
+		for (i = 0; i < n; ++i)
+		{
+			sum += elem[i].sequence;
+			if (shared->ordered && elem[i].sequence != ++last[elem[i].producer])
+				ijkAtomicAdd(&shared->misordered, 1);
+		}
+		if (n)
+			ijkAtomicAdd(&shared->popped, n);
+		else
+			ijkAtomicPause();
+	}
+	ijkAtomicAdd(&shared->sum, sum);
+	return ijk_success;
+}
+
+
+void ijkBaseTestQueue()
+{
+	// each mode moves the same number of items: [spsc, mpsc, mpmc] with 
+	//	[1, 4, 4] producers and [1, 1, 4] consumers, one at a time then batched
+	size const itemTotal = 1 << 18, baseSize = 1 << 16;
+	size const producerCount[3] = { 1, 4, 4 }, consumerCount[3] = { 1, 1, 4 };
+	tag const name = "ijkBaseTestQueue";
+	ptr const queue = malloc(baseSize);
+	ijkThread thread[8] = { 0 };
+	ijkBaseTestQueueShared shared[1] = { 0 };
+	ijkBaseTestQueueElem elem[4] = { { 0 } };
+	ijkTimer timer[1] = { 0 };
+	dbl throughput[3][2] = { { 0.0 } };	// items per second: [spsc, mpsc, mpmc][single, batch]
+	size mode, b, t, threadCount, count = 0, capacity = 0;
+
+	if (!queue)
+		return;
+
+	// single thread
+	ijkBaseTestCheck(ijkQueueCreate(queue, 64, sizeof(ijkBaseTestQueueElem), ijkQueueMode_mpmc), ijk_fail_operationfail);	// (too small)
+	ijkBaseTestCheck(ijkQueueCreate(queue, 640, sizeof(ijkBaseTestQueueElem), ijkQueueMode_mpmc), ijk_success);
+	ijkBaseTestCheck(ijkQueueGetCapacity(queue, &capacity), ijk_success);	// (4)
+	ijkBaseTestCheck(ijkQueuePop(queue, elem), ijk_warn_queue_empty);
+	ijkBaseTestCheck(ijkQueuePushBatch(queue, elem, 3, &count), ijk_success);	// (3)
+	ijkBaseTestCheck(ijkQueuePushBatch(queue, elem, 3, &count), ijk_warn_queue_full);	// (1)
+	ijkBaseTestCheck(ijkQueuePush(queue, elem), ijk_warn_queue_full);
+	ijkBaseTestCheck(ijkQueueGetCount(queue, &count), ijk_success);	// (4)
+	ijkBaseTestCheck(ijkQueuePopBatch(queue, elem, 3, &count), ijk_success);	// (3)
+	ijkBaseTestCheck(ijkQueuePopBatch(queue, elem, 3, &count), ijk_warn_queue_empty);	// (1)
+	ijkBaseTestCheck(ijkQueueRelease(queue), ijk_success);
+	ijkBaseTestCheck(ijkQueuePush(queue, elem), ijk_fail_invalidparams);	// (released)
+
+	// threads
+	ijkTimerSet(timer, 0.0);
+	for (mode = ijkQueueMode_spsc; mode <= ijkQueueMode_mpmc; ++mode)
+	{
+		for (b = 0; b < 2; ++b)
+		{
+			ijkQueueCreate(queue, baseSize, sizeof(ijkBaseTestQueueElem), (ijkQueueMode)mode);
+			shared->queue = queue;
+			shared->itemCount = itemTotal / producerCount[mode];
+			shared->batchCount = b ? 64 : 1;
+			shared->total = itemTotal;
+			shared->ordered = (consumerCount[mode] == 1);
+			shared->producerCount = shared->popped = shared->sum = shared->misordered = 0;
+
+			threadCount = consumerCount[mode] + producerCount[mode];
+			memset(thread, 0, sizeof(thread));
+			ijkTimerStart(timer);
+			for (t = 0; t < consumerCount[mode]; ++t)
+				ijkThreadCreate(thread + t, ijkBaseTestQueueConsumer, shared, name);
+			for (; t < threadCount; ++t)
+				ijkThreadCreate(thread + t, ijkBaseTestQueueProducer, shared, name);
+			for (t = 0; t < threadCount; ++t)
+				ijkThreadRelease(thread + t);
+			ijkTimerStop(timer);
+
+			throughput[mode][b] = (dbl)itemTotal / timer->tickMeasure;
+			ijkBaseTestCheck(shared->sum, itemTotal * (shared->itemCount + 1) / 2);
+			ijkBaseTestCheck(shared->misordered, 0);
+			ijkQueueRelease(queue);
+		}
+	}
+
+	// compare
+	for (mode = ijkQueueMode_spsc; mode <= ijkQueueMode_mpmc; ++mode)
+		throughput[mode][1] /= throughput[mode][0];		// above 1 on multiple cores: one claim per batch
+
+	free(queue);
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkBaseTestProfilerJob(ptr jobArg)
+{
+	dbl* const value = (dbl*)jobArg;
+	size i;
+	ijk_profile_scope("ijkBaseTestProfilerJob")
+	{
+		for (i = 0; i < 4096; ++i)
+			*value += (dbl)(i & 0xF);
+	}
+	return ijk_success;
+}
+
+
+iret ijkBaseTestProfilerThreadEntry(ptr entryArg)
+{
+	// more scopes than one buffer holds
+	size i;
+	ijk_unused(entryArg);
+	for (i = 0; i < 1024; ++i)
+		ijk_profile_scope("ijkBaseTestProfilerThreadEntry");
+	return ijk_success;
+}
+
+
+void ijkBaseTestProfiler()
+{
+	// frames of jobs recorded across workers and flushed in both formats, 
+	//	then a small profiler to see drops
+	size const baseSize = 1 << 23, jobsSize = 1 << 16, scopeCount = 1 << 12, frameCount = 8, jobCount = 16;
+	tag const name = "ijkBaseTestProfiler", mainName = "main";
+	ptr const profiler = malloc(baseSize);
+	ptr const jobs = malloc(jobsSize);
+	ijkThread thread[2] = { 0 };
+	ijkJobCounter counter[1] = { 0 };
+	ijkStream stream[1] = { 0 };
+	ijkTimer timer[1] = { 0 };
+	dbl value[16] = { 0.0 }, time[2] = { 0.0 };	// [empty, scoped]
+	size n, i, bytes[2] = { 0 };	// [json, binary]
+
+	if (!profiler || !jobs || !ijk_issuccess(ijkStreamCreateBuffer(stream, baseSize, 0)))
+	{
+		free(profiler);
+		free(jobs);
+		return;
+	}
+
+	ijkBaseTestCheck(ijkProfilerBegin((kcstr)"ijkBaseTestProfiler"), ijk_fail_operationfail);	// (no profiler)
+	ijkBaseTestCheck(ijkProfilerCreate(profiler, 64, 16), ijk_fail_operationfail);	// (too small)
+	ijkBaseTestCheck(ijkProfilerCreate(profiler, baseSize, 16), ijk_success);
+	ijkBaseTestCheck(ijkProfilerCreate(jobs, jobsSize, 16), ijk_fail_operationfail);	// (already active)
+	ijkBaseTestCheck(ijkProfilerSetThreadName(mainName), ijk_success);
+	ijkBaseTestCheck(ijkProfilerBegin((kcstr)"ijkBaseTestProfiler"), ijk_success);
+	ijkBaseTestCheck(ijkProfilerEnd(), ijk_success);
+
+	// overhead: timer resolution is fine over many scopes
+	ijkTimerSet(timer, 0.0);
+	ijkTimerStart(timer);
+	for (i = 0; i < scopeCount; ++i)
+		*value += (dbl)i;
+	ijkTimerStop(timer);
+	time[0] = timer->tickMeasure;
+	ijkTimerStart(timer);
+	for (i = 0; i < scopeCount; ++i)
+		ijk_profile_scope("ijkBaseTestProfilerScope")
+			*value += (dbl)i;
+	ijkTimerStop(timer);
+	time[1] = timer->tickMeasure;
+	time[1] = (time[1] - time[0]) / (dbl)scopeCount * 1.0e9;			// nanoseconds per scope, below 50 (two clock reads dominate)
+	ijkBaseTestCheck(ijkProfilerFlush(profiler, stream, ijkProfilerFormat_json), ijk_success);
+
+	// frames of jobs
+	ijkJobSystemCreate(jobs, jobsSize, 0, ijk_false, name);
+	for (n = 0; n < frameCount; ++n)
+	{
+		ijk_profile_scope("ijkBaseTestProfilerFrame")
+		{
+			for (i = 0; i < jobCount; ++i)
+				ijkJobSubmit(jobs, ijkBaseTestProfilerJob, value + i, counter, 0);
+			ijkJobWait(jobs, counter);
+		}
+		ijkBaseTestCheck(ijkProfilerFlush(profiler, stream, ijkProfilerFormat_json), ijk_success);
+	}
+	ijkJobSystemRelease(jobs);
+	ijkBaseTestCheck(ijkStreamGetOffset(stream, bytes + 0), ijk_success);
+	ijkBaseTestCheck(ijkProfilerRelease(profiler), ijk_success);
+	ijkBaseTestCheck(ijkProfilerBegin((kcstr)"ijkBaseTestProfiler"), ijk_fail_operationfail);	// (released)
+
+	// binary, small enough to drop: the main thread takes the only buffer
+	ijkStreamBufferReset(stream, ijk_false);
+	ijkBaseTestCheck(ijkProfilerCreate(profiler, 1 << 14, 1), ijk_success);
+	ijkBaseTestCheck(ijkProfilerSetThreadName(mainName), ijk_success);
+	ijkThreadCreate(thread, ijkBaseTestProfilerThreadEntry, 0, name);
+	ijkThreadRelease(thread);
+	ijkBaseTestCheck(ijkProfilerFlush(profiler, stream, ijkProfilerFormat_binary), ijk_warn_profiler_dropped);	// (no buffer)
+	for (i = 0; i < 1024; ++i)
+		ijk_profile_scope("ijkBaseTestProfilerScope");
+	ijkBaseTestCheck(ijkProfilerBegin((kcstr)"ijkBaseTestProfiler"), ijk_warn_profiler_dropped);	// (full)
+	ijkBaseTestCheck(ijkProfilerEnd(), ijk_warn_profiler_dropped);		// (begin dropped)
+	ijkBaseTestCheck(ijkProfilerFlush(profiler, stream, ijkProfilerFormat_binary), ijk_warn_profiler_dropped);
+	ijkBaseTestCheck(ijkProfilerFlush(profiler, stream, ijkProfilerFormat_binary), ijk_success);
+	ijkBaseTestCheck(ijkStreamGetOffset(stream, bytes + 1), ijk_success);
+	ijkBaseTestCheck(ijkProfilerRelease(profiler), ijk_success);
+
+	ijkStreamRelease(stream);
+	free(profiler);
+	free(jobs);
+}
+
+
+//-----------------------------------------------------------------------------
+
+void ijkBaseTestBenchmarkKernel(ptr const benchArg, size const iterations)
+{
+	// dependent chain, one add per iteration
+	dbl* const value = (dbl*)benchArg;
+	size i;
+	for (i = 0; i < iterations; ++i)
+		*value += 1.0;
+}
+
+
+void ijkBaseTestBenchmark()
+{
+	// one kernel measured into a block with room for two results, written 
+	//	in both formats
+	size const sampleCount = 100, baseSize = sampleCount * sizeof(dbl) + 2 * sizeof(ijkBenchmarkResult);
+	ptr const base = malloc(baseSize);
+	ijkBenchmark bench[1] = { 0 };
+	ijkBenchmarkResult const* benchResult = 0;
+	ijkStream stream[1] = { 0 };
+	dbl value = 0.0;
+	size bytes[2] = { 0 };	// [json, csv]
+
+	if (!base || !ijk_issuccess(ijkStreamCreateBuffer(stream, 1 << 12, 0)))
+	{
+		free(base);
+		return;
+	}
+
+	ijkBaseTestCheck(ijkBenchmarkCreate(bench, base, baseSize, sampleCount, 0.01, 0.0), ijk_fail_invalidparams);
+	ijkBaseTestCheck(ijkBenchmarkCreate(bench, base, sampleCount * sizeof(dbl), sampleCount, 0.01, 0.001), ijk_fail_operationfail);	// (no room for results)
+	ijkBaseTestCheck(ijkBenchmarkCreate(bench, base, baseSize, sampleCount, 0.01, 0.001), ijk_success);
+	ijkBaseTestCheck(ijkBenchmarkRun(bench, (kcstr)"ijkBaseTestBenchmarkKernel", ijkBaseTestBenchmarkKernel, &value, &benchResult), ijk_success);
+	ijkBaseTestCheck(benchResult->median > 0.0, ijk_true);				// about one add's latency (1 or 2 ns)
+	ijkBaseTestCheck(benchResult->p99 >= benchResult->p10, ijk_true);	// samples sorted
+	ijkBaseTestCheck(ijkBenchmarkRun(bench, (kcstr)"ijkBaseTestBenchmarkKernel, again", ijkBaseTestBenchmarkKernel, &value, 0), ijk_success);
+	ijkBaseTestCheck(ijkBenchmarkRun(bench, (kcstr)"ijkBaseTestBenchmarkKernel", ijkBaseTestBenchmarkKernel, &value, 0), ijk_fail_operationfail);	// (full)
+	ijkBaseTestCheck(ijkBenchmarkWrite(bench, stream, ijkBenchmarkFormat_json), ijk_success);
+	ijkBaseTestCheck(ijkStreamGetOffset(stream, bytes + 0), ijk_success);
+	ijkStreamBufferReset(stream, ijk_false);
+	ijkBaseTestCheck(ijkBenchmarkWrite(bench, stream, ijkBenchmarkFormat_csv), ijk_success);	// (name with comma quoted)
+	ijkBaseTestCheck(ijkStreamGetOffset(stream, bytes + 1), ijk_success);
+	ijkBaseTestCheck(ijkBenchmarkRelease(bench), ijk_success);
+	ijkBaseTestCheck(ijkBenchmarkRun(bench, (kcstr)"ijkBaseTestBenchmarkKernel", ijkBaseTestBenchmarkKernel, &value, 0), ijk_fail_invalidparams);	// (released)
+
+	ijkStreamRelease(stream);
+	free(base);
+}
+
+
+//-----------------------------------------------------------------------------
+
+void ijkBaseTestStream()
+{
+	// file saved from a buffer, then mapped and read back without a copy
+	size const count = 1 << 16;
+	kcstr const filePath = (kcstr)"ijkBaseTestStream.bin";
+	ijkStream stream[1] = { 0 }, mapped[1] = { 0 };
+	kptr data = 0;
+	qword value = 0;
+	size i, bytes = 0;
+
+	ijkBaseTestCheck(ijkStreamCreateBuffer(stream, count * sizeof(qword), 0), ijk_success);
+	for (value = 0; value < count; ++value)
+		ijkBaseTestCheck(ijkStreamWriteElement(stream, &value, sizeof(qword), 1, 0), ijk_success);
+	ijkBaseTestCheck(ijkStreamSaveBuffer(stream, filePath), ijk_success);
+	ijkBaseTestCheck(ijkStreamRelease(stream), ijk_success);
+
+	ijkBaseTestCheck(ijkStreamCreateMapped(mapped, (kcstr)"", ijk_true), ijk_fail_invalidparams);
+	ijkBaseTestCheck(ijkStreamCreateMapped(mapped, (kcstr)"ijkBaseTestStream.none", ijk_true), ijk_fail_operationfail);	// (missing)
+	ijkBaseTestCheck(ijkStreamCreateMapped(mapped, filePath, ijk_true), ijk_success);
+	ijkBaseTestCheck(ijkStreamReadElement(mapped, &value, sizeof(qword), 1, 0), ijk_success);	// (0)
+	ijkBaseTestCheck(ijkStreamPeek(mapped, &data, sizeof(qword), ijk_false, 0), ijk_success);	// (points to 1)
+	ijkBaseTestCheck(ijkStreamPeek(mapped, &data, sizeof(qword) * count, ijk_true, &bytes), ijk_warn_stream_incomplete);	// (rest: count - 1 values)
+	for (i = 1; i < count; ++i)
+		ijkBaseTestCheck(((qword const*)data)[i - 1] == (qword)i, ijk_true);
+	ijkBaseTestCheck(ijkStreamReadElement(mapped, &value, sizeof(qword), 1, 0), ijk_fail_operationfail);	// (end)
+	ijkBaseTestCheck(ijkStreamBufferReset(mapped, ijk_false), ijk_fail_invalidparams);	// (read-only)
+	ijkBaseTestCheck(ijkStreamBufferReset(mapped, ijk_true), ijk_success);
+	ijkBaseTestCheck(ijkStreamGetOffset(mapped, &bytes), ijk_success);	// (0)
+	ijkBaseTestCheck(ijkStreamRelease(mapped), ijk_success);
+
+	remove((char const*)filePath);
+}
+
+
+void ijkBaseTestStreamBuffered()
+{
+	// save file one field at a time through a small buffer, then patch its 
+	//	header and read it back
+	size const count = 1 << 12;
+	kcstr const filePath = (kcstr)"ijkBaseTestStreamBuffered.bin";
+	ijkStream stream[1] = { 0 };
+	qword value = 0, header = 0, block[64] = { 0 };
+	size offset = 0, bytes = 0;
+
+	ijkBaseTestCheck(ijkStreamCreateFileBuffered(stream, filePath, ijk_false, 0), ijk_fail_invalidparams);
+	ijkBaseTestCheck(ijkStreamCreateFileBuffered(stream, (kcstr)"ijkBaseTestStream.none/x", ijk_false, 256), ijk_fail_operationfail);	// (no directory)
+	ijkBaseTestCheck(ijkStreamCreateFileBuffered(stream, filePath, ijk_false, 256), ijk_success);
+	ijkBaseTestCheck(ijkStreamWriteElement(stream, &header, sizeof(qword), 1, 0), ijk_success);	// (placeholder)
+	for (value = 0; value < count; ++value)
+		ijkBaseTestCheck(ijkStreamWriteElement(stream, &value, sizeof(qword), 1, 0), ijk_success);
+	ijkBaseTestCheck(ijkStreamWriteElement(stream, block, sizeof(block), 1, &bytes), ijk_success);	// (bypasses buffer: 512)
+	ijkBaseTestCheck(ijkStreamGetOffset(stream, &offset), ijk_success);	// ((count + 65) * 8)
+	header = count;
+	ijkBaseTestCheck(ijkStreamSeek(stream, 0), ijk_success);			// (flushed)
+	ijkBaseTestCheck(ijkStreamWriteElement(stream, &header, sizeof(qword), 1, 0), ijk_success);
+	ijkBaseTestCheck(ijkStreamGetOffset(stream, &offset), ijk_success);	// (8)
+	ijkBaseTestCheck(ijkStreamBufferReset(stream, ijk_true), ijk_fail_invalidparams);	// (file)
+	ijkBaseTestCheck(ijkStreamRelease(stream), ijk_success);			// (flushed)
+
+	ijkBaseTestCheck(ijkStreamCreateFileBuffered(stream, filePath, ijk_true, 256), ijk_success);
+	ijkBaseTestCheck(ijkStreamReadElement(stream, &header, sizeof(qword), 1, 0), ijk_success);	// (count)
+	for (offset = 0; offset < count; ++offset)
+	{
+		ijkBaseTestCheck(ijkStreamReadElement(stream, &value, sizeof(qword), 1, 0), ijk_success);
+		ijkBaseTestCheck(value == (qword)offset, ijk_true);
+	}
+	ijkBaseTestCheck(ijkStreamReadElement(stream, block, sizeof(block), 2, &bytes), ijk_warn_stream_incomplete);	// (512)
+	ijkBaseTestCheck(ijkStreamReadElement(stream, &value, sizeof(qword), 1, 0), ijk_fail_operationfail);	// (end)
+	ijkBaseTestCheck(ijkStreamSeek(stream, 9 * sizeof(qword)), ijk_success);	// (reloads)
+	ijkBaseTestCheck(ijkStreamReadElement(stream, &value, sizeof(qword), 1, 0), ijk_success);	// (8)
+	ijkBaseTestCheck(ijkStreamSeek(stream, 12 * sizeof(qword)), ijk_success);	// (in buffer)
+	ijkBaseTestCheck(ijkStreamReadElement(stream, &value, sizeof(qword), 1, 0), ijk_success);	// (11)
+	ijkBaseTestCheck(ijkStreamGetOffset(stream, &offset), ijk_success);	// (13 * 8)
+	ijkBaseTestCheck(ijkStreamFlush(stream), ijk_fail_invalidparams);	// (read)
+	ijkBaseTestCheck(ijkStreamRelease(stream), ijk_success);
+
+	remove((char const*)filePath);
+}
+
+
+typedef struct ijkBaseTestStreamAsyncJob
+{
+	ptr jobs;
+	ijkStreamAsync* async;
+	ijkStream const* reader;
+	ijkStreamRequest request[1];
+	qword* readValue;
+	size byteCount;
+	iret result;
+} ijkBaseTestStreamAsyncJob;
+
+
+iret ijkBaseTestStreamAsyncJobRead(ptr jobArg)
+{
+	// read without holding up a worker while the request is in flight
+	ijkBaseTestStreamAsyncJob* const read = (ijkBaseTestStreamAsyncJob*)jobArg;
+	read->result = ijkStreamReadAsync(read->async, read->reader, read->readValue, read->byteCount, 0, read->request);
+	if (read->result == ijk_success)
+		read->result = ijkJobWaitStream(read->jobs, read->async, read->request);
+	return ijk_success;
+}
+
+
+void ijkBaseTestStreamGrowable()
+{
+	// serialize without knowing the size up front, then take the bytes
+	size const count = 1000;
+	ijkStream stream[1] = { 0 }, fixed[1] = { 0 };
+	ptr data = 0;
+	qword value = 0, pair[2] = { 0 };
+	size offset = 0, length = 0;
+
+	ijkBaseTestCheck(ijkStreamCreateBuffer(fixed, 12, 0), ijk_success);
+	ijkBaseTestCheck(ijkStreamWriteElement(fixed, pair, sizeof(qword), 2, 0), ijk_warn_stream_incomplete);	// (fixed: 12 bytes)
+	ijkBaseTestCheck(ijkStreamRelease(fixed), ijk_success);
+
+	ijkBaseTestCheck(ijkStreamCreateBufferGrowable(stream, 0), ijk_fail_invalidparams);
+	ijkBaseTestCheck(ijkStreamCreateBufferGrowable(stream, 16), ijk_success);
+	for (value = 0; value < count; ++value)
+		ijkBaseTestCheck(ijkStreamWriteElement(stream, &value, sizeof(qword), 1, 0), ijk_success);
+	ijkBaseTestCheck(ijkStreamGetOffset(stream, &offset), ijk_success);	// (8000)
+	ijkBaseTestCheck(ijkStreamSeek(stream, sizeof(qword)), ijk_success);
+	value = count;
+	ijkBaseTestCheck(ijkStreamWriteElement(stream, &value, sizeof(qword), 1, 0), ijk_success);	// (overwrites 1)
+	ijkBaseTestCheck(ijkStreamBufferReset(stream, ijk_true), ijk_success);
+	for (offset = 0; offset < count; ++offset)
+	{
+		ijkBaseTestCheck(ijkStreamReadElement(stream, &value, sizeof(qword), 1, 0), ijk_success);
+		ijkBaseTestCheck(value == (offset == 1 ? count : offset), ijk_true);
+	}
+	ijkBaseTestCheck(ijkStreamReadElement(stream, &value, sizeof(qword), 1, 0), ijk_fail_operationfail);	// (end)
+	ijkBaseTestCheck(ijkStreamDetach(stream, &data, &length), ijk_success);	// (8000 bytes)
+	ijkBaseTestCheck(ijkStreamRelease(stream), ijk_fail_invalidparams);	// (detached)
+	ijkBaseTestCheck(((qword const*)data)[count - 1] == count - 1, ijk_true);
+	free(data);
+}
+
+
+void ijkBaseTestStreamAsync()
+{
+	// many small reads in flight at once, on the kernel ring (where there is 
+	//	one) and on worker threads, polled as a frame loop would
+	size const count = 256, baseSize = 1 << 20;
+	kcstr const filePath = (kcstr)"ijkBaseTestStreamAsync.bin";
+	tag const name = "ijkBaseTestStreamAsync";
+	ptr const jobs = malloc(baseSize);
+	ijkStream stream[1] = { 0 }, reader[1] = { 0 };
+	ijkStreamAsync async[1] = { 0 };
+	ijkStreamRequest request[256];
+	ijkJobCounter counter[1] = { 0 };
+	ijkBaseTestStreamAsyncJob read[1] = { 0 };
+	qword value[256] = { 0 }, readValue[256] = { 0 };
+	size i, mode, inFlight = 0, polls = 0;
+
+	if (!jobs)
+		return;
+	ijkBaseTestCheck(ijkJobSystemCreate(jobs, baseSize, 0, ijk_false, name), ijk_success);
+	ijkBaseTestCheck(ijkStreamAsyncCreate(async, 0, 4, ijk_true), ijk_fail_invalidparams);
+	for (mode = 0; mode < 2; ++mode)
+	{
+		// write values out of order, then read them back out of order
+		ijkBaseTestCheck(ijkStreamAsyncCreate(async, count, 4, mode == 0), ijk_success);	// (workerCount zero if ring)
+		ijkBaseTestCheck(ijkStreamCreateFileBuffered(stream, filePath, ijk_false, 4096), ijk_success);
+		for (i = 0; i < count; ++i)
+		{
+			value[i] = (qword)i * 0x9E3779B97F4A7C15ull;
+			ijkBaseTestCheck(ijkStreamWriteAsync(async, stream, value + i, sizeof(qword), ((i * 37) % count) * sizeof(qword), request + i), ijk_success);
+		}
+		ijkBaseTestCheck(ijkStreamReadAsync(async, stream, readValue, sizeof(qword), 0, request), ijk_fail_invalidparams);	// (write stream)
+		ijkBaseTestCheck(ijkStreamAsyncWait(async, 0), ijk_success);
+		ijkBaseTestCheck(ijkStreamRelease(stream), ijk_success);
+
+		ijkBaseTestCheck(ijkStreamCreateFileBuffered(reader, filePath, ijk_true, 4096), ijk_success);
+		ijkBaseTestCheck(ijkStreamReadAsync(async, reader, readValue, 0, 0, request), ijk_fail_invalidparams);
+		for (i = 0; i < count; ++i)
+			ijkBaseTestCheck(ijkStreamReadAsync(async, reader, readValue + i, sizeof(qword), ((i * 37) % count) * sizeof(qword), request + i), ijk_success);
+		ijkBaseTestCheck(ijkStreamAsyncSubmit(async), ijk_success);
+		do
+		{
+			ijkBaseTestCheck(ijkStreamAsyncPoll(async, &inFlight), ijk_success);
+			++polls;
+		} while (inFlight);
+		for (i = 0; i < count; ++i)
+			ijkBaseTestCheck(ijkStreamRequestIsDone(request + i) == ijk_true && request[i].result == ijk_success && readValue[i] == value[i], ijk_true);
+		ijkBaseTestCheck(ijkStreamReadAsync(async, reader, readValue, sizeof(qword) * 2, (count - 1) * sizeof(qword), request), ijk_success);
+		ijkBaseTestCheck(ijkStreamAsyncWait(async, request), ijk_success);	// (incomplete: 8 of 16 bytes)
+		ijkBaseTestCheck(request->result, ijk_warn_stream_incomplete);
+
+		// the whole file at once, by a job that lets others run meanwhile
+		read->jobs = jobs;
+		read->async = async;
+		read->reader = reader;
+		read->readValue = readValue;
+		read->byteCount = count * sizeof(qword);
+		memset(readValue, 0, sizeof(readValue));
+		ijkBaseTestCheck(ijkJobWaitStream(jobs, async, 0), ijk_fail_invalidparams);
+		ijkBaseTestCheck(ijkJobSubmit(jobs, ijkBaseTestStreamAsyncJobRead, read, counter, 0), ijk_success);
+		ijkBaseTestCheck(ijkJobWait(jobs, counter), ijk_success);
+		ijkBaseTestCheck(read->result, ijk_success);
+		for (i = 0; i < count; ++i)
+			ijkBaseTestCheck(readValue[(i * 37) % count] == value[i], ijk_true);
+		ijkBaseTestCheck(ijkStreamRelease(reader), ijk_success);
+		ijkBaseTestCheck(ijkStreamAsyncRelease(async), ijk_success);
+	}
+
+	ijkBaseTestCheck(ijkJobSystemRelease(jobs), ijk_success);
+	free(jobs);
+	remove((char const*)filePath);
+}
+
+
+void ijkBaseTestCompress()
+{
+	// a table of fields compressed in small blocks, read back in order and 
+	//	from the middle; noise is stored as it is
+	size const count = 4096, blockSize = 4096;
+	ijkStream stream[1] = { 0 };
+	ijkCompressStream cstream[1] = { 0 };
+	dword value[4096], readValue[64], packedSize = 0;
+	qword length = 0;
+	byte noise[256], packed[512], unpacked[256];
+	size i, offset = 0, bytes = 0;
+
+	for (i = 0; i < count; ++i)
+		value[i] = (dword)(i / 16);
+	for (i = 0; i < sizeof(noise); ++i)
+		noise[i] = (byte)((i * 0x9E3779B1u) >> 13);
+
+	ijkBaseTestCheck(ijkCompressBlockEncode(ijkCompressCodec_lz, packed, sizeof(packed), value, sizeof(noise), &bytes), ijk_success);
+	ijkBaseTestCheck(ijkCompressBlockDecode(ijkCompressCodec_lz, unpacked, sizeof(unpacked), packed, bytes, &bytes), ijk_success);	// (256 bytes)
+	ijkBaseTestCheck(memcmp(unpacked, value, sizeof(unpacked)) == 0, ijk_true);
+	ijkBaseTestCheck(ijkCompressBlockEncode(ijkCompressCodec_lz, packed, sizeof(noise) - 1, noise, sizeof(noise), &bytes), ijk_fail_operationfail);	// (does not shrink)
+	packed[0] = 0xF0;
+	packed[1] = 0xFF;
+	ijkBaseTestCheck(ijkCompressBlockDecode(ijkCompressCodec_lz, unpacked, sizeof(unpacked), packed, 2, &bytes), ijk_fail_operationfail);	// (corrupt)
+
+	ijkBaseTestCheck(ijkStreamCreateBufferGrowable(stream, 1024), ijk_success);
+	ijkBaseTestCheck(ijkCompressStreamCreateWriter(cstream, stream, ijkCompressCodec_lz, 0), ijk_fail_invalidparams);
+	ijkBaseTestCheck(ijkCompressStreamCreateWriter(cstream, stream, ijkCompressCodec_lz, blockSize), ijk_success);
+	ijkBaseTestCheck(ijkCompressStreamWrite(cstream, value, sizeof(value), &bytes), ijk_success);	// (16 KiB)
+	ijkBaseTestCheck(ijkCompressStreamWrite(cstream, noise, sizeof(noise), &bytes), ijk_success);
+	ijkBaseTestCheck(ijkCompressStreamRelease(cstream), ijk_success);	// (5 blocks, last stored)
+	ijkBaseTestCheck(ijkStreamGetOffset(stream, &offset), ijk_success);	// (2397: 16 KiB table in under 3 KiB)
+
+	ijkBaseTestCheck(ijkStreamBufferReset(stream, ijk_true), ijk_success);
+	ijkBaseTestCheck(ijkCompressStreamCreateReader(cstream, stream), ijk_success);
+	for (i = 0; i < count; i += 64)
+	{
+		ijkBaseTestCheck(ijkCompressStreamRead(cstream, readValue, sizeof(readValue), 0), ijk_success);
+		ijkBaseTestCheck(memcmp(readValue, value + i, sizeof(readValue)) == 0, ijk_true);
+	}
+	ijkBaseTestCheck(ijkCompressStreamRead(cstream, unpacked, sizeof(unpacked), &bytes), ijk_success);
+	ijkBaseTestCheck(memcmp(unpacked, noise, sizeof(noise)) == 0, ijk_true);
+	ijkBaseTestCheck(ijkCompressStreamRead(cstream, unpacked, 1, &bytes), ijk_fail_operationfail);	// (end)
+	ijkBaseTestCheck(ijkCompressStreamSeek(cstream, sizeof(value) + 1), ijk_success);
+	ijkBaseTestCheck(ijkCompressStreamRead(cstream, unpacked, sizeof(unpacked), &bytes), ijk_warn_stream_incomplete);	// (255 bytes)
+	ijkBaseTestCheck(ijkCompressStreamSeek(cstream, 2500 * sizeof(dword)), ijk_success);	// (third block)
+	ijkBaseTestCheck(ijkCompressStreamRead(cstream, readValue, sizeof(readValue), 0), ijk_success);
+	ijkBaseTestCheck(memcmp(readValue, value + 2500, sizeof(readValue)) == 0, ijk_true);
+	ijkBaseTestCheck(ijkCompressStreamSeek(cstream, sizeof(value) + sizeof(noise) + 1), ijk_fail_invalidparams);
+	ijkBaseTestCheck(ijkCompressStreamRelease(cstream), ijk_success);
+	ijkBaseTestCheck(ijkStreamRelease(stream), ijk_success);
+
+	// noise stored in two whole blocks; the index ends the stream with a 
+	//	size and codec per block, and a packed size larger than a block is 
+	//	rejected even where the sizes still add up
+	ijkBaseTestCheck(ijkStreamCreateBufferGrowable(stream, 1024), ijk_success);
+	ijkBaseTestCheck(ijkCompressStreamCreateWriter(cstream, stream, ijkCompressCodec_lz, sizeof(noise) / 2), ijk_success);
+	ijkBaseTestCheck(ijkCompressStreamWrite(cstream, noise, sizeof(noise), &bytes), ijk_success);
+	ijkBaseTestCheck(ijkCompressStreamRelease(cstream), ijk_success);	// (2 blocks, stored)
+	ijkBaseTestCheck(ijkStreamGetOffset(stream, &offset), ijk_success);
+	packedSize = sizeof(noise) / 2 + 1;
+	memcpy(stream->base + offset - 4 * sizeof(dword), &packedSize, sizeof(dword));
+	packedSize = sizeof(noise) / 2 - 1;
+	memcpy(stream->base + offset - 2 * sizeof(dword), &packedSize, sizeof(dword));
+	ijkBaseTestCheck(ijkStreamBufferReset(stream, ijk_true), ijk_success);
+	ijkBaseTestCheck(ijkCompressStreamCreateReader(cstream, stream), ijk_fail_operationfail);	// (corrupt index)
+
+	// a header claiming more blocks than the stream has room to index is 
+	//	rejected before anything is allocated for them
+	length = (qword)1 << 40;
+	memcpy(stream->base + 4 * sizeof(dword), &length, sizeof(qword));
+	ijkBaseTestCheck(ijkStreamBufferReset(stream, ijk_true), ijk_success);
+	ijkBaseTestCheck(ijkCompressStreamCreateReader(cstream, stream), ijk_fail_operationfail);	// (index beyond stream)
+	ijkBaseTestCheck(ijkStreamRelease(stream), ijk_success);
+}
+
+
+//-----------------------------------------------------------------------------
+
+size ijkBaseTest()
+{
+	ijkBaseTestFailCount = 0;
+	ijkBaseTestTimer();
+	ijkBaseTestScheduler();
+	ijkBaseTestMemory();
+	ijkBaseTestMemoryThreads();
+	ijkBaseTestMemoryVector();
+	ijkBaseTestThread();
+	ijkBaseTestMutex();
+	ijkBaseTestSync();
+	ijkBaseTestFiber();
+	ijkBaseTestJob();
+	ijkBaseTestQueue();
+	ijkBaseTestProfiler();
+	ijkBaseTestBenchmark();
+	ijkBaseTestStream();
+	ijkBaseTestStreamBuffered();
+	ijkBaseTestStreamGrowable();
+	ijkBaseTestStreamAsync();
+	ijkBaseTestCompress();
+	return ijkBaseTestFailCount;
+}
+
+
+//-----------------------------------------------------------------------------
\ No newline at end of file
@@ -111,6 +111,31 @@ iret ijkGamepadUpdate(ijkGamepadState* const gamepad)
 
 //-----------------------------------------------------------------------------
 
+// no gamepad interface on other platforms yet; gamepads read disconnected
+
+iret ijkGamepadSetRumble(ijkGamepadState const* const gamepad, word const rumble_left, word const rumble_right)
+{
+	if (gamepad)
+	{
+		ijk_unused(rumble_left);
+		ijk_unused(rumble_right);
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkGamepadUpdate(ijkGamepadState* const gamepad)
+{
+	if (gamepad)
+	{
+		gamepad->state_prev = gamepad->state;
+		gamepad->state.connected = ijk_false;
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
 
 #endif	// WINDOWS
 
@@ -50,7 +50,7 @@ iret ijkInputGetSystemCursor(i32 x_out[1], i32 y_out[1])
 			return ijk_success;
 		}
 #else	// !WINDOWS
-
+		ijk_unused(result);
 #endif	// WINDOWS
 		return ijk_fail_operationfail;
 	}
@@ -66,7 +66,9 @@ iret ijkInputSetSystemCursor(i32 const x, i32 const y)
 	if (result)
 		return ijk_success;
 #else	// !WINDOWS
-
+	ijk_unused(result);
+	ijk_unused(x);
+	ijk_unused(y);
 #endif	// WINDOWS
 	return ijk_fail_operationfail;
 }
@@ -82,7 +84,7 @@ iret ijkInputGetSystemKeyboardState(sbyte keys_out[256])
 		if (result)
 			return ijk_success;
 #else	// !WINDOWS
-
+		ijk_unused(result);
 #endif	// WINDOWS
 		return ijk_fail_operationfail;
 	}
@@ -102,7 +104,7 @@ iret ijkInputGetSystemKeyState(sbyte key_out[1], ijkKeyVirt const keyVirt)
 			return ijk_success;
 		}
 #else	// !WINDOWS
-
+		ijk_unused(keyVirt);
 #endif	// WINDOWS
 		return ijk_fail_operationfail;
 	}
@@ -0,0 +1,378 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkBenchmark.c
+	Statistical benchmark implementation.
+*/
+
+#include "ijk/ijk-base/ijk-utility/ijkBenchmark.h"
+#include "ijk/ijk-base/ijk-utility/ijkMemory.h"
+#include "ijk/ijk-base/ijk-utility/ijkTimer.h"
+
+#include <stdlib.h>
+
+
+//-----------------------------------------------------------------------------
+
+// most iterations per sample, in case a kernel does nothing measurable
+#define ijk_benchmark_iterations	0x10000000000ull
+
+// size of output staging
+#define ijk_benchmark_chunk			1024
+
+
+// internal output staging
+typedef struct ijkBenchmarkWriter
+{
+	ijkStream* stream;
+	size length;
+	iret result;
+	byte data[ijk_benchmark_chunk];
+} ijkBenchmarkWriter;
+
+
+// internal call of kernel, measured in ticks
+ijk_inl qword ijkBenchmarkInternalTime(ijkBenchmarkFunc const func, ptr const arg, qword const iterations)
+{
+	qword const t0 = ijkTimerNow();
+	func(arg, (size)iterations);
+	return (ijkTimerNow() - t0);
+}
+
+
+// internal square root by Newton's method, which only decreases from a
+//	start above the root until it stops; base has no math library
+dbl ijkBenchmarkInternalSqrt(dbl const x)
+{
+	dbl y = x > 1.0 ? x : 1.0, y1;
+	if (x <= 0.0)
+		return 0.0;
+	for (y1 = 0.5 * (y + x / y); y1 < y; y1 = 0.5 * (y + x / y))
+		y = y1;
+	return y;
+}
+
+
+// internal sample comparison for sorting
+int ijkBenchmarkInternalCompare(void const* const lh, void const* const rh)
+{
+	dbl const a = *(dbl const*)lh, b = *(dbl const*)rh;
+	return (a > b) - (a < b);
+}
+
+
+// internal percentile of sorted samples, interpolated between ranks
+ijk_inl dbl ijkBenchmarkInternalPercentile(dbl const sample[], size const count, dbl const p)
+{
+	dbl const rank = p * (dbl)(count - 1);
+	size const i = (size)rank;
+	return (i + 1 < count ? sample[i] + (sample[i + 1] - sample[i]) * (rank - (dbl)i) : sample[i]);
+}
+
+
+//-----------------------------------------------------------------------------
+
+// internal staging
+void ijkBenchmarkInternalPut(ijkBenchmarkWriter* const w, kptr const data, size count)
+{
+	kpbyte src = (kpbyte)data;
+	size part;
+	while (count)
+	{
+		part = ijk_benchmark_chunk - w->length;
+		part = count < part ? count : part;
+		ijkMemoryCopy(w->data + w->length, src, part);
+		w->length += part;
+		src += part;
+		count -= part;
+		if (w->length == ijk_benchmark_chunk)
+		{
+			if (!ijk_issuccess(ijkStreamWriteElement(w->stream, w->data, 1, w->length, 0)))
+				w->result = ijk_fail_operationfail;
+			w->length = 0;
+		}
+	}
+}
+
+
+// internal staging of remaining output
+void ijkBenchmarkInternalDrain(ijkBenchmarkWriter* const w)
+{
+	if (w->length)
+	{
+		if (!ijk_issuccess(ijkStreamWriteElement(w->stream, w->data, 1, w->length, 0)))
+			w->result = ijk_fail_operationfail;
+		w->length = 0;
+	}
+}
+
+
+// internal staging of c-string
+void ijkBenchmarkInternalPutString(ijkBenchmarkWriter* const w, kcstr const str)
+{
+	size count = 0;
+	while (str[count])
+		++count;
+	ijkBenchmarkInternalPut(w, str, count);
+}
+
+
+// internal staging of name in quotes, quotes doubled (csv) or escaped (json)
+void ijkBenchmarkInternalPutName(ijkBenchmarkWriter* const w, kcstr str, ibool const json)
+{
+	byte const quote = '"', escape = json ? '\\' : '"';
+	ijkBenchmarkInternalPut(w, &quote, 1);
+	for (; *str; ++str)
+	{
+		if (*str == '"' || (json && *str == '\\'))
+			ijkBenchmarkInternalPut(w, &escape, 1);
+		if ((byte)*str >= 0x20)
+			ijkBenchmarkInternalPut(w, str, 1);
+	}
+	ijkBenchmarkInternalPut(w, &quote, 1);
+}
+
+
+// internal staging of decimal integer
+void ijkBenchmarkInternalPutDecimal(ijkBenchmarkWriter* const w, qword value, size digits)
+{
+	byte text[24];
+	size i = sizeof(text);
+	do
+	{
+		text[--i] = (byte)('0' + value % 10);
+		value /= 10;
+	} while (value || sizeof(text) - i < digits);
+	ijkBenchmarkInternalPut(w, text + i, sizeof(text) - i);
+}
+
+
+// internal staging of non-negative value with three decimals
+void ijkBenchmarkInternalPutFixed(ijkBenchmarkWriter* const w, dbl const value)
+{
+	byte const point = '.';
+	qword const thousandths = (value > 0.0 && value < 1.0e15) ? (qword)(value * 1000.0 + 0.5) : 0;
+	ijkBenchmarkInternalPutDecimal(w, thousandths / 1000, 1);
+	ijkBenchmarkInternalPut(w, &point, 1);
+	ijkBenchmarkInternalPutDecimal(w, thousandths % 1000, 3);
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkBenchmarkCreate(ijkBenchmark* const bench_out, ptr const bench_base, size const baseSize, size const sampleCount, dbl const warmupTime, dbl const sampleTime)
+{
+	if (bench_out && bench_base && baseSize && sampleCount && warmupTime >= 0.0 && sampleTime > 0.0)
+	{
+		// samples first, then results on their alignment
+		size const sampleSize = (sampleCount * sizeof(dbl) + sizeof(ptr) - 1) / sizeof(ptr) * sizeof(ptr);
+		if (sampleSize + sizeof(ijkBenchmarkResult) <= baseSize && sampleCount <= baseSize / sizeof(dbl))
+		{
+			bench_out->sample = (dbl*)bench_base;
+			bench_out->sampleCount = sampleCount;
+			bench_out->result = (ijkBenchmarkResult*)((pbyte)bench_base + sampleSize);
+			bench_out->resultCount = 0;
+			bench_out->resultMax = (baseSize - sampleSize) / sizeof(ijkBenchmarkResult);
+			bench_out->warmupTime = warmupTime;
+			bench_out->sampleTime = sampleTime;
+			*bench_out->rate = ijkTimerNowRate();
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkBenchmarkRelease(ijkBenchmark* const bench)
+{
+	if (bench && *bench->rate)
+	{
+		bench->sample = 0;
+		bench->result = 0;
+		bench->resultCount = bench->resultMax = 0;
+		*bench->rate = 0;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkBenchmarkRun(ijkBenchmark* const bench, kcstr const name, ijkBenchmarkFunc const func, ptr const arg, ijkBenchmarkResult const** const result_out_opt)
+{
+	if (bench && *bench->rate && name && func)
+	{
+		if (bench->resultCount < bench->resultMax)
+		{
+			ijkBenchmarkResult* const result = bench->result + bench->resultCount;
+			dbl* const sample = bench->sample;
+			size const count = bench->sampleCount;
+			dbl const rate = (dbl)*bench->rate;
+			dbl elapsed, scale, sum, sumSq;
+			qword iterations = 1, end;
+			size i;
+
+			// calibrate: grow iterations until one call takes the sample
+			//	time, aiming a little past it; at most tenfold at a time,
+			//	since the shortest calls measure worst
+			for (;;)
+			{
+				elapsed = (dbl)ijkBenchmarkInternalTime(func, arg, iterations) / rate;
+				if (elapsed >= bench->sampleTime || iterations >= ijk_benchmark_iterations)
+					break;
+				scale = elapsed > 0.0 ? bench->sampleTime * 1.25 / elapsed : 10.0;
+				iterations = (qword)((dbl)iterations * (scale < 10.0 ? scale : 10.0)) + 1;
+			}
+
+			// warm up, unmeasured
+			end = ijkTimerNow() + (qword)(bench->warmupTime * rate);
+			while ((i64)(end - ijkTimerNow()) > 0)
+				func(arg, (size)iterations);
+
+			// sample, converted to nanoseconds per iteration
+			scale = 1.0e9 / rate / (dbl)iterations;
+			for (i = 0, sum = 0.0; i < count; ++i)
+			{
+				sample[i] = (dbl)ijkBenchmarkInternalTime(func, arg, iterations) * scale;
+				sum += sample[i];
+			}
+			result->mean = sum / (dbl)count;
+			for (i = 0, sumSq = 0.0; i < count; ++i)
+				sumSq += (sample[i] - result->mean) * (sample[i] - result->mean);
+			result->stddev = ijkBenchmarkInternalSqrt(count > 1 ? sumSq / (dbl)(count - 1) : 0.0);
+
+			// order statistics
+			qsort(sample, count, sizeof(dbl), ijkBenchmarkInternalCompare);
+			result->min = sample[0];
+			result->max = sample[count - 1];
+			result->p10 = ijkBenchmarkInternalPercentile(sample, count, 0.10);
+			result->median = ijkBenchmarkInternalPercentile(sample, count, 0.50);
+			result->p90 = ijkBenchmarkInternalPercentile(sample, count, 0.90);
+			result->p99 = ijkBenchmarkInternalPercentile(sample, count, 0.99);
+
+			for (i = 0; i < sizeof(result->name) - 1 && name[i]; ++i)
+				result->name[i] = name[i];
+			result->name[i] = 0;
+			result->iterations = iterations;
+			result->sampleCount = count;
+			++bench->resultCount;
+			if (result_out_opt)
+				*result_out_opt = result;
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkBenchmarkWrite(ijkBenchmark const* const bench, ijkStream* const stream, ijkBenchmarkFormat const format)
+{
+	if (bench && *bench->rate && stream && !stream->isRead && (format >= ijkBenchmarkFormat_json && format <= ijkBenchmarkFormat_csv))
+	{
+		ijkBenchmarkWriter w[1];
+		ijkBenchmarkResult const* result = bench->result;
+		ijkBenchmarkResult const* const end = result + bench->resultCount;
+		ibool const json = (format == ijkBenchmarkFormat_json);
+		w->stream = stream;
+		w->length = 0;
+		w->result = ijk_success;
+
+		if (json)
+		{
+			ijkBenchmarkInternalPutString(w, (kcstr)"{\n\"context\":{\"ticks_per_second\":");
+			ijkBenchmarkInternalPutDecimal(w, *bench->rate, 1);
+			ijkBenchmarkInternalPutString(w, (kcstr)",\"samples\":");
+			ijkBenchmarkInternalPutDecimal(w, bench->sampleCount, 1);
+			ijkBenchmarkInternalPutString(w, (kcstr)",\"warmup_s\":");
+			ijkBenchmarkInternalPutFixed(w, bench->warmupTime);
+			ijkBenchmarkInternalPutString(w, (kcstr)",\"sample_ms\":");
+			ijkBenchmarkInternalPutFixed(w, bench->sampleTime * 1000.0);
+			ijkBenchmarkInternalPutString(w, (kcstr)",\"time_unit\":\"ns\"},\n\"benchmarks\":[");
+		}
+		else
+			ijkBenchmarkInternalPutString(w, (kcstr)"name,iterations,samples,min_ns,p10_ns,median_ns,p90_ns,p99_ns,max_ns,mean_ns,stddev_ns\n");
+
+		for (; result < end; ++result)
+		{
+			if (json)
+			{
+				ijkBenchmarkInternalPutString(w, (kcstr)(result > bench->result ? ",\n{\"name\":" : "\n{\"name\":"));
+				ijkBenchmarkInternalPutName(w, (kcstr)result->name, json);
+				ijkBenchmarkInternalPutString(w, (kcstr)",\"iterations\":");
+				ijkBenchmarkInternalPutDecimal(w, result->iterations, 1);
+				ijkBenchmarkInternalPutString(w, (kcstr)",\"samples\":");
+				ijkBenchmarkInternalPutDecimal(w, result->sampleCount, 1);
+				ijkBenchmarkInternalPutString(w, (kcstr)",\"min_ns\":");
+				ijkBenchmarkInternalPutFixed(w, result->min);
+				ijkBenchmarkInternalPutString(w, (kcstr)",\"p10_ns\":");
+				ijkBenchmarkInternalPutFixed(w, result->p10);
+				ijkBenchmarkInternalPutString(w, (kcstr)",\"median_ns\":");
+				ijkBenchmarkInternalPutFixed(w, result->median);
+				ijkBenchmarkInternalPutString(w, (kcstr)",\"p90_ns\":");
+				ijkBenchmarkInternalPutFixed(w, result->p90);
+				ijkBenchmarkInternalPutString(w, (kcstr)",\"p99_ns\":");
+				ijkBenchmarkInternalPutFixed(w, result->p99);
+				ijkBenchmarkInternalPutString(w, (kcstr)",\"max_ns\":");
+				ijkBenchmarkInternalPutFixed(w, result->max);
+				ijkBenchmarkInternalPutString(w, (kcstr)",\"mean_ns\":");
+				ijkBenchmarkInternalPutFixed(w, result->mean);
+				ijkBenchmarkInternalPutString(w, (kcstr)",\"stddev_ns\":");
+				ijkBenchmarkInternalPutFixed(w, result->stddev);
+				ijkBenchmarkInternalPutString(w, (kcstr)"}");
+			}
+			else
+			{
+				ijkBenchmarkInternalPutName(w, (kcstr)result->name, json);
+				ijkBenchmarkInternalPutString(w, (kcstr)",");
+				ijkBenchmarkInternalPutDecimal(w, result->iterations, 1);
+				ijkBenchmarkInternalPutString(w, (kcstr)",");
+				ijkBenchmarkInternalPutDecimal(w, result->sampleCount, 1);
+				ijkBenchmarkInternalPutString(w, (kcstr)",");
+				ijkBenchmarkInternalPutFixed(w, result->min);
+				ijkBenchmarkInternalPutString(w, (kcstr)",");
+				ijkBenchmarkInternalPutFixed(w, result->p10);
+				ijkBenchmarkInternalPutString(w, (kcstr)",");
+				ijkBenchmarkInternalPutFixed(w, result->median);
+				ijkBenchmarkInternalPutString(w, (kcstr)",");
+				ijkBenchmarkInternalPutFixed(w, result->p90);
+				ijkBenchmarkInternalPutString(w, (kcstr)",");
+				ijkBenchmarkInternalPutFixed(w, result->p99);
+				ijkBenchmarkInternalPutString(w, (kcstr)",");
+				ijkBenchmarkInternalPutFixed(w, result->max);
+				ijkBenchmarkInternalPutString(w, (kcstr)",");
+				ijkBenchmarkInternalPutFixed(w, result->mean);
+				ijkBenchmarkInternalPutString(w, (kcstr)",");
+				ijkBenchmarkInternalPutFixed(w, result->stddev);
+				ijkBenchmarkInternalPutString(w, (kcstr)"\n");
+			}
+		}
+
+		if (json)
+			ijkBenchmarkInternalPutString(w, (kcstr)"\n]\n}\n");
+		ijkBenchmarkInternalDrain(w);
+		return w->result;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
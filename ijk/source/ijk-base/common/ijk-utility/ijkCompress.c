@@ -0,0 +1,661 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkCompress.c
+	Compressed block stream implementation.
+*/
+
+#include "ijk/ijk-base/ijk-utility/ijkCompress.h"
+
+#include <memory.h>
+#include <stdlib.h>
+
+#if (__ijk_cfg_zstd)
+#include <zstd.h>
+#endif	// __ijk_cfg_zstd
+
+
+//-----------------------------------------------------------------------------
+
+// compressed stream magic word ("ijkZ") and format version
+#define ijk_compress_magic		0x5A6B6A69u
+#define ijk_compress_version	1
+
+// largest block size
+#define ijk_compress_blockmax	0x01000000
+
+// LZ format: shortest match, farthest match, literals that must end a 
+//	block, and distance from end of block within which no match may start
+#define ijk_compress_minmatch	4
+#define ijk_compress_window		0xFFFF
+#define ijk_compress_lastlit	5
+#define ijk_compress_mflimit	12
+
+// LZ hash table size (log2); 4096 positions fit in first-level cache
+#define ijk_compress_hashlog	12
+
+
+typedef struct ijkCompressHeader	ijkCompressHeader;
+typedef struct ijkCompressEntry		ijkCompressEntry;
+typedef struct ijkCompressBlock		ijkCompressBlock;
+
+
+// stored header, at start of compressed stream
+struct ijkCompressHeader
+{
+	dword magic;						// validation word
+	dword version;						// format version
+	dword codec;						// codec of stream
+	dword blockSize;					// uncompressed block size
+	qword length;						// uncompressed length
+	qword indexOffset;					// offset of index from header
+};
+
+
+// stored index entry, one per block, after last block
+struct ijkCompressEntry
+{
+	dword packedSize;					// compressed size
+	dword codec;						// codec of block
+};
+
+
+// block index entry in memory
+struct ijkCompressBlock
+{
+	size offset;						// offset of block from header
+	size packedSize;					// compressed size
+	ijkCompressCodec codec;				// codec of block
+};
+
+
+//-----------------------------------------------------------------------------
+
+// internal unaligned four-byte read
+ijk_inl dword ijkCompressInternalRead4(kpbyte const p)
+{
+	dword value;
+	memcpy(&value, p, 4);
+	return value;
+}
+
+
+// internal hash of four bytes (Knuth multiplicative)
+ijk_inl dword ijkCompressInternalHash(dword const value)
+{
+	return ((value * 2654435761u) >> (32 - ijk_compress_hashlog)) & ((1u << ijk_compress_hashlog) - 1);
+}
+
+
+// internal length extension: 255 per byte until the remainder
+ijk_inl pbyte ijkCompressInternalLength(pbyte op, size length)
+{
+	for (; length >= 255; length -= 255)
+		*(op++) = 255;
+	*(op++) = (byte)length;
+	return op;
+}
+
+
+// internal LZ encode in LZ4 block format: greedy, one hash probe per 
+//	position, skipping faster through data that does not match; returns 
+//	zero if output does not fit
+ijk_inl size ijkCompressInternalEncodeLZ(pbyte const dst, size const dstCapacity, kpbyte const src, size const srcSize)
+{
+	dword table[1 << ijk_compress_hashlog];
+	kpbyte ip = src, anchor = src, ref;
+	kpbyte const end = src + srcSize;
+	kpbyte const matchLimit = end - ijk_compress_lastlit;
+	kpbyte const startLimit = end - ijk_compress_mflimit;
+	pbyte op = dst, token;
+	pbyte const oend = dst + dstCapacity;
+	size literals, match;
+	dword seq, h;
+	memset(table, 0, sizeof(table));
+
+	// table holds offsets from source, so position zero never matches 
+	//	itself and a stale entry fails the compare
+	if (srcSize > ijk_compress_mflimit)
+	{
+		while (ip < startLimit)
+		{
+			seq = ijkCompressInternalRead4(ip);
+			h = ijkCompressInternalHash(seq);
+			ref = src + table[h];
+			table[h] = (dword)(ip - src);
+			if (ref >= ip || ip - ref > ijk_compress_window || ijkCompressInternalRead4(ref) != seq)
+			{
+				ip += 1 + ((ip - anchor) >> 6);
+				continue;
+			}
+
+			// extend forward, stopping short of the last literals
+			for (match = ijk_compress_minmatch; ip + match < matchLimit && ref[match] == ip[match]; ++match);
+
+			// token, literals, offset, match length
+			literals = ip - anchor;
+			if ((size)(oend - op) < 1 + literals + literals / 255 + 1 + 2 + match / 255 + 1)
+				return 0;
+			token = op++;
+			*token = (byte)(ijk_minimum(literals, 15) << 4);
+			if (literals >= 15)
+				op = ijkCompressInternalLength(op, literals - 15);
+			memcpy(op, anchor, literals);
+			op += literals;
+			*(op++) = (byte)(ip - ref);
+			*(op++) = (byte)((ip - ref) >> 8);
+			match -= ijk_compress_minmatch;
+			*token |= (byte)ijk_minimum(match, 15);
+			if (match >= 15)
+				op = ijkCompressInternalLength(op, match - 15);
+			ip += match + ijk_compress_minmatch;
+			anchor = ip;
+		}
+	}
+
+	// last literals
+	literals = end - anchor;
+	if ((size)(oend - op) < 1 + literals + literals / 255 + 1)
+		return 0;
+	token = op++;
+	*token = (byte)(ijk_minimum(literals, 15) << 4);
+	if (literals >= 15)
+		op = ijkCompressInternalLength(op, literals - 15);
+	memcpy(op, anchor, literals);
+	op += literals;
+	return (op - dst);
+}
+
+
+// internal LZ decode; every length and offset is checked against both 
+//	buffers; returns -1 if corrupt
+ijk_inl size ijkCompressInternalDecodeLZ(pbyte const dst, size const dstCapacity, kpbyte const src, size const srcSize)
+{
+	kpbyte ip = src, ref;
+	kpbyte const iend = src + srcSize;
+	pbyte op = dst;
+	pbyte const oend = dst + dstCapacity;
+	size length, offset;
+	byte token, extra;
+	while (ip < iend)
+	{
+		// literals
+		token = *(ip++);
+		length = token >> 4;
+		if (length == 15)
+		{
+			do
+			{
+				if (ip >= iend)
+					return (size)(-1);
+				extra = *(ip++);
+				length += extra;
+			} while (extra == 255);
+		}
+		if (length > (size)(iend - ip) || length > (size)(oend - op))
+			return (size)(-1);
+		memcpy(op, ip, length);
+		op += length;
+		ip += length;
+
+		// last sequence has no match
+		if (ip == iend)
+			break;
+
+		// match
+		if (iend - ip < 2)
+			return (size)(-1);
+		offset = (size)ip[0] | ((size)ip[1] << 8);
+		ip += 2;
+		if (!offset || offset > (size)(op - dst))
+			return (size)(-1);
+		length = token & 15;
+		if (length == 15)
+		{
+			do
+			{
+				if (ip >= iend)
+					return (size)(-1);
+				extra = *(ip++);
+				length += extra;
+			} while (extra == 255);
+		}
+		length += ijk_compress_minmatch;
+		if (length > (size)(oend - op))
+			return (size)(-1);
+
+		// overlapping matches repeat the bytes just written
+		ref = op - offset;
+		if (offset >= length)
+		{
+			memcpy(op, ref, length);
+			op += length;
+		}
+		else for (; length; --length)
+			*(op++) = *(ref++);
+	}
+	return (op - dst);
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkCompressBlockEncode(ijkCompressCodec const codec, ptr const dst, size const dstCapacity, kptr const src, size const srcSize, size* const dstSize_out)
+{
+	if (dst && src && srcSize && dstSize_out)
+	{
+		size result = 0;
+		switch (codec)
+		{
+		case ijkCompressCodec_store:
+			if (srcSize > dstCapacity)
+				return ijk_fail_operationfail;
+			memcpy(dst, src, srcSize);
+			result = srcSize;
+			break;
+		case ijkCompressCodec_lz:
+			result = ijkCompressInternalEncodeLZ((pbyte)dst, dstCapacity, (kpbyte)src, srcSize);
+			break;
+#if (__ijk_cfg_zstd)
+		case ijkCompressCodec_zstd:
+			result = ZSTD_compress(dst, dstCapacity, src, srcSize, ZSTD_CLEVEL_DEFAULT);
+			if (ZSTD_isError(result))
+				result = 0;
+			break;
+#endif	// __ijk_cfg_zstd
+		default:
+			return ijk_fail_invalidparams;
+		}
+		if (result)
+		{
+			*dstSize_out = result;
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkCompressBlockDecode(ijkCompressCodec const codec, ptr const dst, size const dstCapacity, kptr const src, size const srcSize, size* const dstSize_out)
+{
+	if (dst && dstCapacity && src && srcSize && dstSize_out)
+	{
+		size result = (size)(-1);
+		switch (codec)
+		{
+		case ijkCompressCodec_store:
+			if (srcSize <= dstCapacity)
+			{
+				memcpy(dst, src, srcSize);
+				result = srcSize;
+			}
+			break;
+		case ijkCompressCodec_lz:
+			result = ijkCompressInternalDecodeLZ((pbyte)dst, dstCapacity, (kpbyte)src, srcSize);
+			break;
+#if (__ijk_cfg_zstd)
+		case ijkCompressCodec_zstd:
+			result = ZSTD_decompress(dst, dstCapacity, src, srcSize);
+			if (ZSTD_isError(result))
+				result = (size)(-1);
+			break;
+#endif	// __ijk_cfg_zstd
+		default:
+			return ijk_fail_invalidparams;
+		}
+		if (result != (size)(-1))
+		{
+			*dstSize_out = result;
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// internal write of all bytes to underlying stream
+ijk_inl ibool ijkCompressInternalWrite(ijkStream* const stream, kptr const data, size const byteCount)
+{
+	size bytes = 0;
+	return (ijkStreamWriteElement(stream, data, byteCount, 1, &bytes) == ijk_success && bytes == byteCount);
+}
+
+
+// internal read of all bytes from underlying stream
+ijk_inl ibool ijkCompressInternalRead(ijkStream* const stream, ptr const data, size const byteCount)
+{
+	size bytes = 0;
+	return (ijkStreamReadElement(stream, data, byteCount, 1, &bytes) == ijk_success && bytes == byteCount);
+}
+
+
+// internal compression and write of block held (writing)
+ijk_inl ibool ijkCompressInternalFlush(ijkCompressStream* const cstream)
+{
+	ijkCompressBlock* block;
+	ijkCompressCodec codec = cstream->codec;
+	kpbyte data = cstream->packed;
+	size packedSize = 0, offset = 0;
+
+	// keep block only if it shrinks
+	if (codec == ijkCompressCodec_store ||
+		ijkCompressBlockEncode(codec, cstream->packed, cstream->fill - 1, cstream->block, cstream->fill, &packedSize) != ijk_success)
+	{
+		codec = ijkCompressCodec_store;
+		data = cstream->block;
+		packedSize = cstream->fill;
+	}
+
+	// grow index
+	if (cstream->blockCount == cstream->blockMax)
+	{
+		size const blockMax = cstream->blockMax * 2;
+		ptr const index = realloc(cstream->index, blockMax * sizeof(ijkCompressBlock));
+		if (!index)
+			return ijk_false;
+		cstream->index = index;
+		cstream->blockMax = blockMax;
+	}
+	if (ijkStreamGetOffset(cstream->stream, &offset) != ijk_success ||
+		!ijkCompressInternalWrite(cstream->stream, data, packedSize))
+		return ijk_false;
+	block = (ijkCompressBlock*)cstream->index + cstream->blockCount++;
+	block->offset = offset - cstream->base;
+	block->packedSize = packedSize;
+	block->codec = codec;
+	cstream->fill = 0;
+	return ijk_true;
+}
+
+
+// internal read and decompression of block (reading)
+ijk_inl ibool ijkCompressInternalLoad(ijkCompressStream* const cstream, size const blockIndex)
+{
+	ijkCompressBlock const* const block = (ijkCompressBlock*)cstream->index + blockIndex;
+	size const expected = ijk_minimum(cstream->blockSize, cstream->length - blockIndex * cstream->blockSize);
+	kptr data = cstream->packed;
+	size bytes = 0;
+
+	// buffers and mappings are decompressed in place
+	cstream->current = (size)(-1);
+	if (ijkStreamSeek(cstream->stream, cstream->base + block->offset) != ijk_success)
+		return ijk_false;
+	if (ijk_isfalse(cstream->stream->isFile))
+	{
+		if (ijkStreamPeek(cstream->stream, &data, block->packedSize, ijk_true, &bytes) != ijk_success)
+			return ijk_false;
+	}
+	else if (!ijkCompressInternalRead(cstream->stream, cstream->packed, block->packedSize))
+		return ijk_false;
+	if (ijkCompressBlockDecode(block->codec, cstream->block, cstream->blockSize, data, block->packedSize, &bytes) != ijk_success || bytes != expected)
+		return ijk_false;
+	cstream->current = blockIndex;
+	cstream->fill = bytes;
+	return ijk_true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkCompressStreamCreateWriter(ijkCompressStream* const cstream_out, ijkStream* const stream, ijkCompressCodec const codec, size const blockSize)
+{
+	if (cstream_out && stream && blockSize && blockSize <= ijk_compress_blockmax &&
+		!cstream_out->stream && stream->base && !stream->isRead &&
+		(codec == ijkCompressCodec_store || codec == ijkCompressCodec_lz || (codec == ijkCompressCodec_zstd && __ijk_cfg_zstd)))
+	{
+		// header is written again on release
+		ijkCompressHeader header = { 0 };
+		size const blockMax = 16;
+		pbyte const block = (pbyte)malloc(blockSize * 2);
+		ptr const index = malloc(blockMax * sizeof(ijkCompressBlock));
+		if (block && index &&
+			ijkStreamGetOffset(stream, &cstream_out->base) == ijk_success &&
+			ijkCompressInternalWrite(stream, &header, sizeof(header)))
+		{
+			cstream_out->stream = stream;
+			cstream_out->block = block;
+			cstream_out->packed = block + blockSize;
+			cstream_out->index = index;
+			cstream_out->blockSize = blockSize;
+			cstream_out->blockCount = 0;
+			cstream_out->blockMax = blockMax;
+			cstream_out->current = (size)(-1);
+			cstream_out->fill = 0;
+			cstream_out->length = 0;
+			cstream_out->position = 0;
+			cstream_out->codec = codec;
+			cstream_out->isRead = ijk_false;
+			return ijk_success;
+		}
+
+		// failed
+		free(index);
+		free(block);
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkCompressStreamCreateReader(ijkCompressStream* const cstream_out, ijkStream* const stream)
+{
+	if (cstream_out && stream &&
+		!cstream_out->stream && stream->base && stream->isRead)
+	{
+		ijkCompressHeader header = { 0 };
+		ijkCompressEntry entry = { 0 };
+		ijkCompressBlock* block;
+		pbyte buffer = 0;
+		ijkCompressBlock* index = 0;
+		size base = 0, length = 0, offset = sizeof(header), blockCount = 0, i;
+
+		// header
+		if (ijkStreamGetOffset(stream, &base) == ijk_success &&
+			ijkStreamGetLength(stream, &length) == ijk_success &&
+			ijkCompressInternalRead(stream, &header, sizeof(header)) &&
+			header.magic == ijk_compress_magic && header.version == ijk_compress_version &&
+			header.blockSize && header.blockSize <= ijk_compress_blockmax &&
+			header.length <= (qword)(size)(-1) && header.indexOffset <= (qword)(length - base))
+		{
+			// header is not trusted with an allocation: the index it describes 
+			//	must be in the stream, and fit in memory
+			blockCount = (size)(header.length / header.blockSize + (header.length % header.blockSize != 0));
+			if (blockCount <= (length - base - (size)header.indexOffset) / sizeof(ijkCompressEntry) &&
+				blockCount <= (size)(-1) / sizeof(ijkCompressBlock))
+			{
+				buffer = (pbyte)malloc(header.blockSize * 2);
+				index = (ijkCompressBlock*)malloc((blockCount ? blockCount : 1) * sizeof(ijkCompressBlock));
+			}
+		}
+
+		// index; block offsets follow from sizes, and no packed block may be 
+		//	larger than the buffer it is loaded into
+		if (buffer && index &&
+			ijkStreamSeek(stream, base + (size)header.indexOffset) == ijk_success)
+		{
+			for (i = 0, block = index; i < blockCount; ++i, ++block)
+			{
+				if (!ijkCompressInternalRead(stream, &entry, sizeof(entry)) ||
+					entry.codec > ijkCompressCodec_zstd || !entry.packedSize || entry.packedSize > header.blockSize)
+					break;
+				block->offset = offset;
+				block->packedSize = entry.packedSize;
+				block->codec = (ijkCompressCodec)entry.codec;
+				offset += entry.packedSize;
+			}
+			if (i == blockCount && offset <= header.indexOffset)
+			{
+				cstream_out->stream = stream;
+				cstream_out->block = buffer;
+				cstream_out->packed = buffer + header.blockSize;
+				cstream_out->index = index;
+				cstream_out->blockSize = header.blockSize;
+				cstream_out->blockCount = blockCount;
+				cstream_out->blockMax = blockCount;
+				cstream_out->current = (size)(-1);
+				cstream_out->fill = 0;
+				cstream_out->length = (size)header.length;
+				cstream_out->position = 0;
+				cstream_out->base = base;
+				cstream_out->codec = (ijkCompressCodec)header.codec;
+				cstream_out->isRead = ijk_true;
+				return ijk_success;
+			}
+		}
+
+		// failed
+		free(index);
+		free(buffer);
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkCompressStreamRelease(ijkCompressStream* const cstream)
+{
+	if (cstream &&
+		cstream->stream)
+	{
+		ibool written = ijk_true;
+		if (!cstream->isRead)
+		{
+			// last block, index, then header with index location
+			ijkCompressHeader header = { 0 };
+			ijkCompressEntry entry = { 0 };
+			ijkCompressBlock const* block;
+			size indexOffset = 0, end = 0, i;
+			written = ((!cstream->fill || ijkCompressInternalFlush(cstream)) &&
+				ijkStreamGetOffset(cstream->stream, &indexOffset) == ijk_success);
+			for (i = 0, block = (ijkCompressBlock*)cstream->index; written && i < cstream->blockCount; ++i, ++block)
+			{
+				entry.packedSize = (dword)block->packedSize;
+				entry.codec = (dword)block->codec;
+				written = ijkCompressInternalWrite(cstream->stream, &entry, sizeof(entry));
+			}
+			if (written)
+			{
+				header.magic = ijk_compress_magic;
+				header.version = ijk_compress_version;
+				header.codec = (dword)cstream->codec;
+				header.blockSize = (dword)cstream->blockSize;
+				header.length = (qword)cstream->length;
+				header.indexOffset = (qword)(indexOffset - cstream->base);
+				written = (ijkStreamGetOffset(cstream->stream, &end) == ijk_success &&
+					ijkStreamSeek(cstream->stream, cstream->base) == ijk_success &&
+					ijkCompressInternalWrite(cstream->stream, &header, sizeof(header)) &&
+					ijkStreamSeek(cstream->stream, end) == ijk_success);
+			}
+		}
+		free(cstream->index);
+		free(cstream->block);
+		cstream->stream = 0;
+		cstream->block = cstream->packed = 0;
+		cstream->index = 0;
+		return (written ? ijk_success : ijk_fail_operationfail);
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkCompressStreamRead(ijkCompressStream* const cstream, ptr const data, size const byteCount, size* const bytes_opt)
+{
+	if (cstream && data && byteCount &&
+		cstream->stream && cstream->isRead)
+	{
+		pbyte dst = (pbyte)data;
+		size result = 0, blockIndex, offset, part;
+		while (result < byteCount && cstream->position < cstream->length)
+		{
+			blockIndex = cstream->position / cstream->blockSize;
+			if (blockIndex != cstream->current && !ijkCompressInternalLoad(cstream, blockIndex))
+				break;
+			offset = cstream->position - blockIndex * cstream->blockSize;
+			part = ijk_minimum(byteCount - result, cstream->fill - offset);
+			memcpy(dst, cstream->block + offset, part);
+			dst += part;
+			result += part;
+			cstream->position += part;
+		}
+		if (bytes_opt)
+			*bytes_opt = result;
+
+		// success
+		if (result)
+			return (result == byteCount ? ijk_success : ijk_warn_stream_incomplete);
+
+		// failed
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkCompressStreamWrite(ijkCompressStream* const cstream, kptr const data, size const byteCount, size* const bytes_opt)
+{
+	if (cstream && data && byteCount &&
+		cstream->stream && !cstream->isRead)
+	{
+		kpbyte src = (kpbyte)data;
+		size result = 0, part;
+		while (result < byteCount)
+		{
+			if (cstream->fill == cstream->blockSize && !ijkCompressInternalFlush(cstream))
+				break;
+			part = ijk_minimum(byteCount - result, cstream->blockSize - cstream->fill);
+			memcpy(cstream->block + cstream->fill, src, part);
+			cstream->fill += part;
+			src += part;
+			result += part;
+		}
+		cstream->length += result;
+		cstream->position = cstream->length;
+		if (bytes_opt)
+			*bytes_opt = result;
+
+		// success
+		if (result)
+			return (result == byteCount ? ijk_success : ijk_warn_stream_incomplete);
+
+		// failed
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkCompressStreamSeek(ijkCompressStream* const cstream, size const offset)
+{
+	if (cstream &&
+		cstream->stream && cstream->isRead && offset <= cstream->length)
+	{
+		cstream->position = offset;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,306 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkFiber.c
+	Fiber (user-mode context) implementation.
+*/
+
+#include "ijk/ijk-base/ijk-utility/ijkFiber.h"
+
+
+// include platform APIs
+#if (__ijk_cfg_platform == WINDOWS)
+#include <Windows.h>
+#else	// !WINDOWS
+#define _DEFAULT_SOURCE	// anonymous mappings
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#if (!defined __x86_64__)
+#include <ucontext.h>
+#endif	// !__x86_64__
+#endif	// WINDOWS
+
+
+//-----------------------------------------------------------------------------
+
+// default stack size
+#define ijk_fiber_stack		0x10000
+
+
+void ijkFiberInternalEntry(ijkFiber* const fiber);
+
+
+#if (__ijk_cfg_platform == WINDOWS)
+// internal entry adapter; returning would end the thread, so switch back
+VOID CALLBACK ijkFiberInternalStart(PVOID param)
+{
+	ijkFiberInternalEntry((ijkFiber*)param);
+}
+
+#elif (defined __x86_64__)
+// internal context switch: push the registers a call preserves (System V)
+//	and the floating point control words, store stack pointer to the first 
+//	argument, load the second and pop in reverse; a new fiber's stack is 
+//	prepared so that the return lands in the trampoline, which passes the 
+//	fiber (in rbx) to the entry function
+void ijkFiberInternalSwap(ptr* const sp_out, ptr const sp);
+void ijkFiberInternalTrampoline();
+__asm__(
+	".text\n"
+	".globl ijkFiberInternalSwap\n"
+	".hidden ijkFiberInternalSwap\n"
+	".type ijkFiberInternalSwap, @function\n"
+	"ijkFiberInternalSwap:\n"
+	"	pushq %rbp\n"
+	"	pushq %rbx\n"
+	"	pushq %r12\n"
+	"	pushq %r13\n"
+	"	pushq %r14\n"
+	"	pushq %r15\n"
+	"	subq $8, %rsp\n"
+	"	stmxcsr (%rsp)\n"
+	"	fnstcw 4(%rsp)\n"
+	"	movq %rsp, (%rdi)\n"
+	"	movq %rsi, %rsp\n"
+	"	ldmxcsr (%rsp)\n"
+	"	fldcw 4(%rsp)\n"
+	"	addq $8, %rsp\n"
+	"	popq %r15\n"
+	"	popq %r14\n"
+	"	popq %r13\n"
+	"	popq %r12\n"
+	"	popq %rbx\n"
+	"	popq %rbp\n"
+	"	ret\n"
+	".size ijkFiberInternalSwap, .-ijkFiberInternalSwap\n"
+	".globl ijkFiberInternalTrampoline\n"
+	".hidden ijkFiberInternalTrampoline\n"
+	".type ijkFiberInternalTrampoline, @function\n"
+	"ijkFiberInternalTrampoline:\n"
+	"	movq %rbx, %rdi\n"
+	"	call ijkFiberInternalEntry@PLT\n"
+	"	ud2\n"
+	".size ijkFiberInternalTrampoline, .-ijkFiberInternalTrampoline\n"
+);
+
+#else	// !x86_64
+// internal entry adapter; context arguments are integers, so the fiber
+//	pointer is passed in halves
+void ijkFiberInternalStart(unsigned int const lo, unsigned int const hi)
+{
+	ijkFiberInternalEntry((ijkFiber*)(size)(((qword)hi << 32) | (qword)lo));
+}
+
+#endif	// WINDOWS
+
+
+// internal switch from one fiber to another on calling thread
+ijk_inl void ijkFiberInternalSwitch(ijkFiber* const current, ijkFiber* const fiber)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	SwitchToFiber(fiber->handle[0]);
+#elif (defined __x86_64__)
+	ijkFiberInternalSwap(current->handle, fiber->handle[0]);
+#else	// !x86_64
+	swapcontext((ucontext_t*)current->handle[0], (ucontext_t*)fiber->handle[0]);
+#endif	// WINDOWS
+}
+
+
+// internal entry: run entry function, then return to caller for good
+void ijkFiberInternalEntry(ijkFiber* const fiber)
+{
+	fiber->result = fiber->entryFunc(fiber->entryArg);
+	fiber->active = ijk_false;
+	ijkFiberInternalSwitch(fiber, fiber->caller);
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkFiberConvertThread(ijkFiber* const fiber_out)
+{
+	if (fiber_out && !fiber_out->active)
+	{
+#if (__ijk_cfg_platform == WINDOWS)
+		// already a fiber (e.g. converted by someone else): use it as is,
+		//	and leave it to them to revert
+		if (IsThreadAFiber())
+		{
+			fiber_out->handle[0] = GetCurrentFiber();
+			fiber_out->handle[1] = 0;
+		}
+		else
+		{
+			fiber_out->handle[0] = ConvertThreadToFiber(fiber_out);
+			fiber_out->handle[1] = fiber_out->handle[0];
+		}
+		if (!fiber_out->handle[0])
+			return ijk_fail_operationfail;
+#elif (defined __x86_64__)
+		// context is saved on own stack when switching away
+		fiber_out->handle[0] = fiber_out->handle[1] = 0;
+#else	// !x86_64
+		fiber_out->handle[0] = malloc(sizeof(ucontext_t));
+		fiber_out->handle[1] = 0;
+		if (!fiber_out->handle[0])
+			return ijk_fail_operationfail;
+#endif	// WINDOWS
+
+		fiber_out->stack = 0;
+		fiber_out->stackSize = 0;
+		fiber_out->entryFunc = 0;
+		fiber_out->entryArg = 0;
+		fiber_out->caller = 0;
+		fiber_out->result = ijk_success;
+		fiber_out->active = ijk_true;
+		fiber_out->thread = ijk_true;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkFiberRevertThread(ijkFiber* const fiber)
+{
+	if (fiber && fiber->active && fiber->thread)
+	{
+#if (__ijk_cfg_platform == WINDOWS)
+		if (fiber->handle[1])
+			ConvertFiberToThread();
+#elif (defined __x86_64__)
+#else	// !x86_64
+		free(fiber->handle[0]);
+#endif	// WINDOWS
+		fiber->handle[0] = fiber->handle[1] = 0;
+		fiber->active = ijk_false;
+		fiber->thread = ijk_false;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkFiberCreate(ijkFiber* const fiber_out, ijkFiberEntryFunc const entryFunc, ptr const entryArg, size const stackSize)
+{
+	if (fiber_out && !fiber_out->active && entryFunc)
+	{
+#if (__ijk_cfg_platform == WINDOWS)
+		fiber_out->handle[0] = CreateFiber(stackSize ? stackSize : ijk_fiber_stack, ijkFiberInternalStart, fiber_out);
+		fiber_out->handle[1] = 0;
+		if (!fiber_out->handle[0])
+			return ijk_fail_operationfail;
+		fiber_out->stack = 0;
+		fiber_out->stackSize = stackSize ? stackSize : ijk_fiber_stack;
+#else	// !WINDOWS
+		// map stack plus guard page, so overflow faults instead of
+		//	corrupting a neighbour
+		size const page = (size)sysconf(_SC_PAGESIZE);
+		size const mapSize = ((stackSize ? stackSize : ijk_fiber_stack) + page - 1) / page * page + page;
+		pbyte const stack = (pbyte)mmap(0, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (stack == (pbyte)MAP_FAILED)
+			return ijk_fail_operationfail;
+		mprotect(stack, page, PROT_NONE);
+
+#if (defined __x86_64__)
+		{
+			// initial frame, popped by the first switch: control words,
+			//	r15 to r12, rbx (fiber), rbp, return to trampoline; placed so
+			//	the trampoline's call sees an aligned stack
+			size* const frame = (size*)(((size)(stack + mapSize) & ~(size)15) - 80);
+			frame[0] = 0x037F00001F80ull;	// x87 control word high, mxcsr low
+			frame[1] = frame[2] = frame[3] = frame[4] = 0;
+			frame[5] = (size)fiber_out;
+			frame[6] = 0;
+			frame[7] = (size)ijkFiberInternalTrampoline;
+			fiber_out->handle[0] = frame;
+			fiber_out->handle[1] = 0;
+		}
+#else	// !x86_64
+		{
+			ucontext_t* const context = (ucontext_t*)malloc(sizeof(ucontext_t));
+			if (!context || getcontext(context))
+			{
+				free(context);
+				munmap(stack, mapSize);
+				return ijk_fail_operationfail;
+			}
+			context->uc_stack.ss_sp = stack + page;
+			context->uc_stack.ss_size = mapSize - page;
+			context->uc_link = 0;
+			makecontext(context, (void(*)())ijkFiberInternalStart, 2,
+				(unsigned int)(qword)(size)fiber_out, (unsigned int)((qword)(size)fiber_out >> 32));
+			fiber_out->handle[0] = context;
+			fiber_out->handle[1] = 0;
+		}
+#endif	// __x86_64__
+		fiber_out->stack = stack;
+		fiber_out->stackSize = mapSize;
+#endif	// WINDOWS
+
+		fiber_out->entryFunc = entryFunc;
+		fiber_out->entryArg = entryArg;
+		fiber_out->caller = 0;
+		fiber_out->result = ijk_success;
+		fiber_out->active = ijk_true;
+		fiber_out->thread = ijk_false;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkFiberRelease(ijkFiber* const fiber)
+{
+	if (fiber && fiber->handle[0] && !fiber->thread)
+	{
+#if (__ijk_cfg_platform == WINDOWS)
+		DeleteFiber(fiber->handle[0]);
+#else	// !WINDOWS
+#if (!defined __x86_64__)
+		free(fiber->handle[0]);
+#endif	// !__x86_64__
+		munmap(fiber->stack, fiber->stackSize);
+#endif	// WINDOWS
+		fiber->handle[0] = fiber->handle[1] = 0;
+		fiber->stack = 0;
+		fiber->stackSize = 0;
+		fiber->active = ijk_false;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkFiberSwitch(ijkFiber* const current, ijkFiber* const fiber)
+{
+	if (current && fiber && current != fiber && current->active && fiber->active)
+	{
+		fiber->caller = current;
+		ijkFiberInternalSwitch(current, fiber);
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
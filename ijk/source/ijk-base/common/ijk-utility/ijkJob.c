@@ -0,0 +1,981 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkJob.c
+	Job system implementation.
+*/
+
+#include "ijk/ijk-base/ijk-utility/ijkJob.h"
+#include "ijk/ijk-base/ijk-utility/ijkMemory.h"
+
+
+// thread-local storage
+#if (__ijk_cfg_platform == WINDOWS)
+#define ijk_job_local		__declspec(thread)
+#define ijk_job_noinline	__declspec(noinline)
+#else	// !WINDOWS
+#define ijk_job_local		__thread
+#define ijk_job_noinline	__attribute__((noinline))
+#endif	// WINDOWS
+
+
+//-----------------------------------------------------------------------------
+
+// job system magic word ("ijkJobs")
+#define ijk_job_magic		0x0073626F4A6B6A69ull
+
+// cache line size for padding shared indices
+#define ijk_job_line		64
+
+// minimum number of jobs per thread
+#define ijk_job_min			16
+
+// number of failed searches before an idle worker sleeps
+#define ijk_job_spin		256
+
+// default number of fibers per thread
+#define ijk_job_fibers		32
+
+// reasons a job fiber switches back to its caller
+#define ijk_job_leave_done	1
+#define ijk_job_leave_wait	2
+#define ijk_job_leave_yield	3
+
+
+typedef struct ijkJob			ijkJob;
+typedef struct ijkJobFiber		ijkJobFiber;
+typedef struct ijkJobWorker		ijkJobWorker;
+typedef struct ijkJobSystem		ijkJobSystem;
+
+
+// job slot
+struct ijkJob
+{
+	ijkJobFunc func;				// function to call
+	ptr arg;						// argument to pass
+	ijkJobCounter* counter;			// counter to decrement when finished
+	ijkJobCounter* dependency;		// counter to wait for while held
+	ijkJob* next;					// next held job
+	ijkJobFiber* fiber;				// fiber to resume instead of calling
+	size volatile state;			// non-zero while slot is in use
+};
+
+
+// pooled fiber that jobs run on; a job that waits is set aside on its 
+//	fiber and resumed later by a job that switches back to it
+struct ijkJobFiber
+{
+	ijkFiber fiber[1];				// fiber descriptor
+	ijkJob resume[1];				// job that resumes fiber
+	ijkJob* job;					// job running on fiber
+	ijkJobFiber* next;				// next idle fiber
+};
+
+
+// per-thread deque and job slots 
+//	owner pushes and pops at bottom, thieves take from top (Chase-Lev)
+struct ijkJobWorker
+{
+	ijkThread thread[1];			// thread descriptor (unused for caller)
+	ijkJobSystem* jobs;				// owning job system
+	size index;						// index in system
+	size volatile bottom;			// next free deque entry (owner)
+	ijkJob* volatile* deque;		// deque ring
+	ijkJob* job;					// job slot ring
+	size jobNext;					// next job slot to use
+	size random;					// victim selection state
+	ijkFiber context[1];			// thread converted to fiber
+	ijkJobFiber* running;			// job fiber running on thread, if any
+	ijkJobFiber* idle;				// idle fibers
+	ijkJobFiber* leaving;			// fiber that just switched out
+	size leave;						// why it switched out
+	byte pad_owner[ijk_job_line];	// keep owner data off thieves' line
+	size volatile top;				// oldest deque entry (thieves)
+	byte pad_top[ijk_job_line];		// keep top off next worker's line
+};
+
+
+// job system header
+struct ijkJobSystem
+{
+	qword magic;					// validation word
+	tag name;						// name of job system
+	size workerCount;				// number of threads, including caller
+	size capacity;					// deque and job slots per thread
+	size mask;						// capacity - 1
+	size pinned;					// whether workers are bound to cores
+	size volatile stop;				// raised to terminate workers
+	size volatile release;			// raised to have held jobs checked
+	size volatile sleeping;			// number of workers asleep or going
+	dword volatile signal;			// bumped to wake sleeping workers
+	size volatile waiting;			// number of callers asleep in a wait
+	dword volatile finished;		// bumped to wake sleeping waiters
+	ijkJobWorker* worker;			// workers, caller first
+	ijkMutex heldLock[1];			// guards held jobs
+	size volatile heldCount;		// number of held jobs
+	ijkJob* held;					// jobs waiting for dependencies
+	ijkJobFiber* fiber;				// all pooled fibers
+	size fiberCount;				// number of pooled fibers
+};
+
+
+// worker of calling thread
+static ijk_job_local ijkJobWorker* ijkJobInternalCurrent;
+
+
+//-----------------------------------------------------------------------------
+
+// internal validation
+ijk_inl ijkJobSystem* ijkJobInternalSystem(kptr const jobs)
+{
+	ijkJobSystem* const system = (ijkJobSystem*)jobs;
+	return (system && system->magic == ijk_job_magic) ? system : 0;
+}
+
+
+// internal worker of caller; never inlined, as a job that waits may resume 
+//	on another thread, where the thread-local address must be looked up anew
+ijk_job_noinline ijkJobWorker* ijkJobInternalGetCurrent()
+{
+	return ijkJobInternalCurrent;
+}
+
+
+// internal worker of caller in given system
+ijk_inl ijkJobWorker* ijkJobInternalWorker(ijkJobSystem const* const system)
+{
+	ijkJobWorker* const worker = ijkJobInternalGetCurrent();
+	return (worker && worker->jobs == system) ? worker : 0;
+}
+
+
+// internal number of cores
+ijk_inl size ijkJobInternalCoreCount()
+{
+	size count = 1;
+	ijkThreadGetCoreCount(&count);
+	return count;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// internal deque push at bottom (owner only)
+ijk_inl ibool ijkJobInternalPush(ijkJobWorker* const worker, ijkJob* const job)
+{
+	size const b = worker->bottom, t = ijkAtomicLoad(&worker->top);
+	if ((b - t) <= worker->jobs->mask)
+	{
+		worker->deque[b & worker->jobs->mask] = job;
+
+		// entry must be visible before bottom
+		ijkAtomicStore(&worker->bottom, b + 1);
+		return ijk_true;
+	}
+	return ijk_false;
+}
+
+
+// internal deque pop at bottom (owner only)
+ijk_inl ijkJob* ijkJobInternalPop(ijkJobWorker* const worker)
+{
+	size const b = worker->bottom - 1;
+	size t;
+	ijkJob* job = 0;
+
+	// top only grows, so an empty deque stays empty to its owner
+	if ((ptrdiff)(b - ijkAtomicLoad(&worker->top)) < 0)
+		return 0;
+
+	// claim bottom entry; full barrier so thieves see the claim before top 
+	//	is read, or the owner sees their steal
+	ijkAtomicExchange(&worker->bottom, b);
+	t = ijkAtomicLoad(&worker->top);
+	if ((ptrdiff)(b - t) >= 0)
+	{
+		job = worker->deque[b & worker->jobs->mask];
+		if (b == t)
+		{
+			// last entry: race thieves for it
+			if (ijkAtomicCompareExchange(&worker->top, t + 1, t) != t)
+				job = 0;
+			ijkAtomicStore(&worker->bottom, b + 1);
+		}
+	}
+	else
+	{
+		// empty
+		ijkAtomicStore(&worker->bottom, b + 1);
+	}
+	return job;
+}
+
+
+// internal deque steal at top (any thread)
+ijk_inl ijkJob* ijkJobInternalSteal(ijkJobWorker* const victim)
+{
+	// top is read first; acquire keeps bottom from being read before it
+	size const t = ijkAtomicLoad(&victim->top), b = ijkAtomicLoad(&victim->bottom);
+	ijkJob* job;
+	if ((ptrdiff)(b - t) > 0)
+	{
+		// read entry before claiming it; owner cannot reuse it until top moves
+		job = victim->deque[t & victim->jobs->mask];
+		if (ijkAtomicCompareExchange(&victim->top, t + 1, t) == t)
+			return job;
+	}
+	return 0;
+}
+
+
+// internal find a job: own deque first, then steal from others
+ijk_inl ijkJob* ijkJobInternalFind(ijkJobWorker* const worker)
+{
+	ijkJobSystem* const system = worker->jobs;
+	ijkJob* job = ijkJobInternalPop(worker);
+	size i, victim;
+	if (!job && system->workerCount > 1)
+	{
+		// start at random victim so thieves spread out
+		worker->random ^= worker->random << 13;
+		worker->random ^= worker->random >> 7;
+		worker->random ^= worker->random << 17;
+		victim = worker->random % system->workerCount;
+		for (i = 0; i < system->workerCount && !job; ++i, ++victim)
+		{
+			if (victim == system->workerCount)
+				victim = 0;
+			if (victim != worker->index)
+				job = ijkJobInternalSteal(system->worker + victim);
+		}
+	}
+	return job;
+}
+
+
+// internal check if any deque has entries
+ijk_inl ibool ijkJobInternalAvailable(ijkJobSystem const* const system)
+{
+	size i;
+	for (i = 0; i < system->workerCount; ++i)
+		if ((ptrdiff)(ijkAtomicLoad(&system->worker[i].bottom) - ijkAtomicLoad(&system->worker[i].top)) > 0)
+			return ijk_true;
+	return ijk_false;
+}
+
+
+// internal wake a sleeping worker after making a job visible
+ijk_inl void ijkJobInternalNotify(ijkJobSystem* const system)
+{
+	// full barrier: either the sleeper sees the job or this sees the sleeper
+	if (ijkAtomicAdd(&system->sleeping, 0))
+	{
+		ijkAtomicAddD(&system->signal, 1);
+		ijkAtomicWakeD(&system->signal, 1);
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+
+void ijkJobInternalExecute(ijkJobWorker* const worker, ijkJob* const job);
+
+
+// internal queue a runnable job on the calling worker, or run it if full
+void ijkJobInternalSchedule(ijkJobWorker* const worker, ijkJob* const job)
+{
+	if (ijkJobInternalPush(worker, job))
+		ijkJobInternalNotify(worker->jobs);
+	else
+		ijkJobInternalExecute(worker, job);
+}
+
+
+// internal hold job until its dependency finishes; count is checked again 
+//	after raising held count in case its last job finished without seeing 
+//	this one, in which case it is taken back
+void ijkJobInternalHold(ijkJobWorker* const worker, ijkJob* const job)
+{
+	ijkJobSystem* const system = worker->jobs;
+	ijkMutexLockWait(system->heldLock);
+	job->next = system->held;
+	system->held = job;
+	ijkAtomicAdd(&system->heldCount, 1);
+	if (ijkAtomicLoad(&job->dependency->count) == 0)
+	{
+		system->held = job->next;
+		job->next = 0;
+		ijkAtomicAdd(&system->heldCount, (size)-1);
+		ijkMutexUnlock(system->heldLock);
+		ijkJobInternalSchedule(worker, job);
+	}
+	else
+		ijkMutexUnlock(system->heldLock);
+}
+
+
+// internal release held jobs whose dependencies finished
+void ijkJobInternalRelease(ijkJobSystem* const system)
+{
+	ijkJob* ready = 0, * job, ** link;
+
+	// unlink under lock, schedule after so inline execution cannot deadlock
+	ijkMutexLockWait(system->heldLock);
+	for (link = &system->held, job = *link; job; job = *link)
+	{
+		if (ijkAtomicLoad(&job->dependency->count) == 0)
+		{
+			*link = job->next;
+			job->next = ready;
+			ready = job;
+			ijkAtomicAdd(&system->heldCount, (size)-1);
+		}
+		else
+			link = &job->next;
+	}
+	ijkMutexUnlock(system->heldLock);
+
+	// a job run inline may wait and resume on another worker
+	while (ready)
+	{
+		job = ready;
+		ready = job->next;
+		job->next = 0;
+		ijkJobInternalSchedule(ijkJobInternalGetCurrent(), job);
+	}
+}
+
+
+// internal wake callers asleep in a wait once a counter reaches zero; the 
+//	counter itself is not touched, so it may already be gone
+ijk_inl void ijkJobInternalWakeWaiting(ijkJobSystem* const system)
+{
+	if (ijkAtomicLoad(&system->waiting))
+	{
+		ijkAtomicAddD(&system->finished, 1);
+		ijkAtomicWakeD(&system->finished, 0);
+	}
+}
+
+
+// internal mark job finished
+void ijkJobInternalFinish(ijkJobSystem* const system, ijkJob* const job)
+{
+	ijkJobCounter* const counter = job->counter;
+
+	// slot may be reused by its owner as soon as it is marked free
+	ijkAtomicStore(&job->state, 0);
+
+	// decrement is the last access to counter; full barrier so either this 
+	//	sees a job held or a waiter asleep meanwhile, or they see the count 
+	//	at zero
+	if (counter && ijkAtomicAdd(&counter->count, (size)-1) == 1)
+	{
+		if (ijkAtomicLoad(&system->heldCount))
+			ijkJobInternalRelease(system);
+		ijkJobInternalWakeWaiting(system);
+	}
+}
+
+
+// internal run fiber until it finishes, waits or yields, then act for it 
+//	here, once its context is saved; whatever switched to it is resumed 
+//	only by it switching back, on this thread, so worker stays valid
+void ijkJobInternalSwitch(ijkJobWorker* const worker, ijkJobFiber* const fiber)
+{
+	ijkJobFiber* const prev = worker->running;
+	ijkJobFiber* leaving;
+	ijkJob* job;
+
+	worker->running = fiber;
+	ijkFiberSwitch(prev ? prev->fiber : worker->context, fiber->fiber);
+	worker->running = prev;
+	leaving = worker->leaving;
+	worker->leaving = 0;
+
+	switch (worker->leave)
+	{
+	case ijk_job_leave_done:
+		// back to idle
+		leaving->next = worker->idle;
+		worker->idle = leaving;
+		break;
+	case ijk_job_leave_wait:
+		// resume once counter finishes
+		ijkJobInternalHold(worker, leaving->resume);
+		break;
+	case ijk_job_leave_yield:
+		// let one other job go first
+		job = ijkJobInternalFind(worker);
+		ijkJobInternalSchedule(worker, leaving->resume);
+		if (job)
+			ijkJobInternalExecute(worker, job);
+		break;
+	}
+}
+
+
+// internal execute job: resume its fiber, or start it on an idle one, or 
+//	if none is idle, call it on this stack
+void ijkJobInternalExecute(ijkJobWorker* const worker, ijkJob* const job)
+{
+	ijkJobFiber* fiber = job->fiber;
+	if (!fiber && worker->idle)
+	{
+		fiber = worker->idle;
+		worker->idle = fiber->next;
+		fiber->job = job;
+	}
+	if (fiber)
+		ijkJobInternalSwitch(worker, fiber);
+	else
+	{
+		job->func(job->arg);
+		ijkJobInternalFinish(worker->jobs, job);
+	}
+}
+
+
+// internal job fiber: run each job handed to it, then switch back
+iret ijkJobInternalFiberEntry(ptr entryArg)
+{
+	ijkJobFiber* const fiber = (ijkJobFiber*)entryArg;
+	ijkJobWorker* worker;
+	ijkJob* job;
+	for (;;)
+	{
+		job = fiber->job;
+		job->func(job->arg);
+		ijkJobInternalFinish(ijkJobInternalGetCurrent()->jobs, job);
+
+		// may be on another thread by now
+		worker = ijkJobInternalGetCurrent();
+		fiber->job = 0;
+		worker->leaving = fiber;
+		worker->leave = ijk_job_leave_done;
+		ijkFiberSwitch(fiber->fiber, fiber->fiber->caller);
+	}
+	return ijk_success;
+}
+
+
+// internal worker thread
+iret ijkJobInternalEntry(ptr entryArg)
+{
+	ijkJobWorker* const worker = (ijkJobWorker*)entryArg;
+	ijkJobSystem* const system = worker->jobs;
+	ijkJob* job;
+	dword signal;
+	size spin = 0;
+
+	ijkJobInternalCurrent = worker;
+	if (system->fiberCount)
+		ijkFiberConvertThread(worker->context);
+
+	while (!ijkAtomicLoad(&system->stop))
+	{
+		// counters finished outside the system leave held jobs to workers
+		if (ijkAtomicLoad(&system->release) && ijkAtomicExchange(&system->release, ijk_false))
+			ijkJobInternalRelease(system);
+
+		job = ijkJobInternalFind(worker);
+		if (job)
+		{
+			ijkJobInternalExecute(worker, job);
+			spin = 0;
+		}
+		else if (++spin < ijk_job_spin)
+		{
+			ijkAtomicPause();
+		}
+		else
+		{
+			// announce sleep, then check once more before sleeping; 
+			//	submitters bump signal after seeing a sleeper, so a job 
+			//	submitted after this check makes the wait return at once
+			signal = ijkAtomicLoadD(&system->signal);
+			ijkAtomicAdd(&system->sleeping, 1);
+			if (!ijkJobInternalAvailable(system) && !ijkAtomicLoad(&system->release) && !ijkAtomicLoad(&system->stop))
+				ijkAtomicWaitD(&system->signal, signal);
+			ijkAtomicAdd(&system->sleeping, (size)-1);
+			spin = 0;
+		}
+	}
+
+	if (system->fiberCount)
+		ijkFiberRevertThread(worker->context);
+	ijkJobInternalCurrent = 0;
+	return ijk_success;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkJobSystemCreate(ptr const jobs_base, size const baseSize, size const workerCount, ibool const pinned, tag const name)
+{
+	return ijkJobSystemCreateExt(jobs_base, baseSize, workerCount, pinned, name, ijk_job_fibers, 0);
+}
+
+
+iret ijkJobSystemCreateExt(ptr const jobs_base, size const baseSize, size const workerCount, ibool const pinned, tag const name, size const fiberCount, size const fiberStackSize)
+{
+	if (jobs_base && baseSize && name && *name)
+	{
+		ijkJobSystem* const system = (ijkJobSystem*)jobs_base;
+		size const coreCount = ijkJobInternalCoreCount();
+		size const threadCount = 1 + (workerCount ? workerCount : coreCount > 1 ? coreCount - 1 : 1);
+		size const workerStart = ((size)(system + 1) + ijk_job_line - 1) & ~(size)(ijk_job_line - 1);
+		size const fiberStart = workerStart + threadCount * sizeof(ijkJobWorker);
+		size const workerEnd = fiberStart + threadCount * fiberCount * sizeof(ijkJobFiber);
+		size const slotSize = szchomp + sizeof(ijkJob);
+		size capacity, i, n;
+		pbyte slots;
+		ijkJobWorker* worker;
+		ijkJobFiber* fiber;
+
+		// space per thread after workers and fibers, rounded down to power 
+		//	of two
+		if (workerEnd > (size)jobs_base + baseSize)
+			return ijk_fail_operationfail;
+		capacity = ((size)jobs_base + baseSize - workerEnd) / threadCount / slotSize;
+		if (capacity < ijk_job_min)
+			return ijk_fail_operationfail;
+		while (capacity & (capacity - 1))
+			capacity &= capacity - 1;
+
+		// header
+		ijkMemorySetZero(system, workerEnd - (size)system);
+		ijk_copytag(system->name, name);
+		system->workerCount = threadCount;
+		system->capacity = capacity;
+		system->mask = capacity - 1;
+		system->pinned = (pinned != ijk_false);
+		system->worker = (ijkJobWorker*)workerStart;
+		system->fiber = (ijkJobFiber*)fiberStart;
+
+		// workers: deque then job slots
+		slots = (pbyte)workerEnd;
+		for (i = 0, worker = system->worker; i < threadCount; ++i, ++worker)
+		{
+			worker->jobs = system;
+			worker->index = i;
+			worker->random = (i + 1) * 0x9E3779B9u;
+			worker->deque = (ijkJob* volatile*)slots;
+			slots += capacity * szchomp;
+			worker->job = (ijkJob*)slots;
+			slots += capacity * sizeof(ijkJob);
+			ijkMemorySetZero(worker->job, capacity * sizeof(ijkJob));
+		}
+
+		// fibers: each thread starts with its share idle; a fiber that waits 
+		//	may finish on another thread and join that one's idle fibers
+		for (i = 0, fiber = system->fiber; i < threadCount; ++i)
+			for (n = 0, worker = system->worker + i; n < fiberCount; ++n, ++fiber)
+			{
+				if (ijkFiberCreate(fiber->fiber, ijkJobInternalFiberEntry, fiber, fiberStackSize) != ijk_success)
+					break;
+				fiber->resume->fiber = fiber;
+				fiber->next = worker->idle;
+				worker->idle = fiber;
+				system->fiberCount = fiber - system->fiber + 1;
+			}
+
+		// caller is first worker; valid before threads see the system
+		system->magic = ijk_job_magic;
+		ijkJobInternalCurrent = system->worker;
+		if (system->fiberCount)
+			ijkFiberConvertThread(system->worker->context);
+		for (i = 1, worker = system->worker + 1; i < threadCount; ++i, ++worker)
+		{
+			if (ijkThreadCreateExt(worker->thread, ijkJobInternalEntry, worker, system->name, 0,
+				system->pinned ? (size)1 << (i % coreCount % (szchomp * 8)) : 0, ijkThreadPriority_normal) != ijk_success)
+			{
+				// run with those that launched
+				system->workerCount = i;
+				break;
+			}
+		}
+
+		// done
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkJobSystemRelease(ptr const jobs)
+{
+	ijkJobSystem* const system = ijkJobInternalSystem(jobs);
+	if (system)
+	{
+		iret result = ijk_success;
+		size i;
+
+		// stop and wake everyone
+		ijkAtomicStore(&system->stop, ijk_true);
+		ijkAtomicAddD(&system->signal, 1);
+		ijkAtomicWakeD(&system->signal, 0);
+		for (i = 1; i < system->workerCount; ++i)
+			if (ijkThreadRelease(system->worker[i].thread) != ijk_success)
+				result = ijk_fail_operationfail;
+
+		// fibers last, once no thread can be running one
+		for (i = 0; i < system->fiberCount; ++i)
+			ijkFiberRelease(system->fiber[i].fiber);
+		if (system->fiberCount)
+			ijkFiberRevertThread(system->worker->context);
+
+		if (ijkJobInternalCurrent && ijkJobInternalCurrent->jobs == system)
+			ijkJobInternalCurrent = 0;
+		system->magic = 0;
+		return result;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkJobSystemGetWorkerCount(kptr const jobs, size* const count_out)
+{
+	ijkJobSystem const* const system = ijkJobInternalSystem(jobs);
+	if (system && count_out)
+	{
+		*count_out = system->workerCount;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkJobSystemGetWorkerIndex(kptr const jobs, size* const index_out)
+{
+	ijkJobSystem const* const system = ijkJobInternalSystem(jobs);
+	if (system && index_out)
+	{
+		ijkJobWorker const* const worker = ijkJobInternalWorker(system);
+		if (worker)
+		{
+			*index_out = worker->index;
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkJobSystemGetCapacity(kptr const jobs, size* const count_out)
+{
+	ijkJobSystem const* const system = ijkJobInternalSystem(jobs);
+	if (system && count_out)
+	{
+		*count_out = system->capacity;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkJobSubmit(ptr const jobs, ijkJobFunc const jobFunc, ptr const jobArg, ijkJobCounter* const counter_opt, ijkJobCounter* const dependency_opt)
+{
+	ijkJobSystem* const system = ijkJobInternalSystem(jobs);
+	if (system && jobFunc)
+	{
+		ijkJobWorker* const worker = ijkJobInternalWorker(system);
+		ijkJob* const job = worker ? worker->job + (worker->jobNext & system->mask) : 0;
+
+		// no slot: run now
+		if (!job || ijkAtomicLoad(&job->state))
+		{
+			if (dependency_opt)
+				ijkJobWait(jobs, dependency_opt);
+			jobFunc(jobArg);
+			return ijk_warn_job_inline;
+		}
+
+		// fill slot; counter raised before job can be seen
+		++worker->jobNext;
+		job->func = jobFunc;
+		job->arg = jobArg;
+		job->counter = counter_opt;
+		job->dependency = dependency_opt;
+		job->next = 0;
+		job->fiber = 0;
+		job->state = ijk_true;
+		if (counter_opt)
+			ijkAtomicAdd(&counter_opt->count, 1);
+
+		if (dependency_opt && ijkAtomicLoad(&dependency_opt->count))
+			ijkJobInternalHold(worker, job);
+		else
+			ijkJobInternalSchedule(worker, job);
+
+		// done
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkJobWait(ptr const jobs, ijkJobCounter* const counter)
+{
+	ijkJobSystem* const system = ijkJobInternalSystem(jobs);
+	if (system && counter)
+	{
+		ijkJobWorker* worker = ijkJobInternalWorker(system);
+		ijkJobFiber* fiber;
+		ijkJob* job;
+		dword finished;
+		size spin = 0;
+		while (ijkAtomicLoad(&counter->count))
+		{
+			fiber = worker ? worker->running : 0;
+			if (fiber)
+			{
+				// set this job's fiber aside; whatever it switches back to 
+				//	holds it until counter finishes, and any worker may 
+				//	resume it
+				fiber->resume->dependency = counter;
+				worker->leaving = fiber;
+				worker->leave = ijk_job_leave_wait;
+				ijkFiberSwitch(fiber->fiber, fiber->fiber->caller);
+				worker = ijkJobInternalGetCurrent();
+			}
+			else
+			{
+				// not on a fiber: help instead of blocking
+				if (worker && ijkAtomicLoad(&system->release) && ijkAtomicExchange(&system->release, ijk_false))
+					ijkJobInternalRelease(system);
+				job = worker ? ijkJobInternalFind(worker) : 0;
+				if (job)
+				{
+					ijkJobInternalExecute(worker, job);
+					spin = 0;
+				}
+				else if (++spin < ijk_job_spin)
+				{
+					ijkAtomicPause();
+				}
+				else
+				{
+					// nothing to help with: sleep until some counter 
+					//	finishes, announced first as workers do, so that 
+					//	either this sees the count at zero or it is woken
+					finished = ijkAtomicLoadD(&system->finished);
+					ijkAtomicAdd(&system->waiting, 1);
+					if (ijkAtomicLoad(&counter->count) && !(worker && ijkAtomicLoad(&system->release)))
+						ijkAtomicWaitD(&system->finished, finished);
+					ijkAtomicAdd(&system->waiting, (size)-1);
+					spin = 0;
+				}
+			}
+		}
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkJobYield(ptr const jobs)
+{
+	ijkJobSystem* const system = ijkJobInternalSystem(jobs);
+	if (system)
+	{
+		ijkJobWorker* const worker = ijkJobInternalWorker(system);
+		ijkJobFiber* const fiber = worker ? worker->running : 0;
+		if (fiber)
+		{
+			// requeued behind one other job by whatever it switches back to
+			worker->leaving = fiber;
+			worker->leave = ijk_job_leave_yield;
+			ijkFiberSwitch(fiber->fiber, fiber->fiber->caller);
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkJobSignal(ptr const jobs, ijkJobCounter* const counter)
+{
+	ijkJobSystem* const system = ijkJobInternalSystem(jobs);
+	if (system && counter)
+	{
+		if (ijkAtomicLoad(&counter->count))
+		{
+			// same as a job finishing, except that a caller outside the 
+			//	system cannot schedule held jobs and wakes a worker to do it
+			if (ijkAtomicAdd(&counter->count, (size)-1) == 1)
+			{
+				if (ijkAtomicLoad(&system->heldCount))
+				{
+					if (ijkJobInternalWorker(system))
+						ijkJobInternalRelease(system);
+					else
+					{
+						ijkAtomicStore(&system->release, ijk_true);
+						ijkAtomicAddD(&system->signal, 1);
+						ijkAtomicWakeD(&system->signal, 1);
+					}
+				}
+				ijkJobInternalWakeWaiting(system);
+			}
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkJobWaitStream(ptr const jobs, ijkStreamAsync* const async, ijkStreamRequest const* const request)
+{
+	ijkJobSystem* const system = ijkJobInternalSystem(jobs);
+	if (system && async && request)
+	{
+		// poll, letting other jobs run in between; a caller that cannot 
+		//	yield sleeps in the stream system instead
+		while (ijkStreamRequestIsDone(request) == ijk_false)
+		{
+			ijkStreamAsyncPoll(async, 0);
+			if (ijkStreamRequestIsDone(request) == ijk_true)
+				break;
+			if (ijkJobYield(jobs) != ijk_success)
+				return ijkStreamAsyncWait(async, request);
+		}
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// parallel range descriptor
+typedef struct ijkParallelRange
+{
+	ptr jobs;						// job system
+	ijkParallelFunc func;			// range function
+	ijkParallelCombineFunc combine;	// result combine function
+	ptr arg;						// shared argument
+	ptr result;						// result storage (reduce)
+	size first;						// first element
+	size count;						// number of elements
+	size grain;						// maximum elements per call
+} ijkParallelRange;
+
+
+// internal split range in half until small enough; right halves are jobs, 
+//	left halves recurse, and each level waits for its right half, so the 
+//	right half's descriptor and result can live on this level's stack
+iret ijkParallelInternalRange(ptr rangeArg)
+{
+	ijkParallelRange* const range = (ijkParallelRange*)rangeArg;
+	if (range->count > range->grain)
+	{
+		ijkParallelRange right[1];
+		chomp result[ijk_parallel_result_max / szchomp];
+		ijkJobCounter counter[1] = { 0 };
+
+		// split on grain boundary so ranges only depend on count and grain
+		size const split = ((range->count + range->grain - 1) / range->grain / 2) * range->grain;
+		*right = *range;
+		right->first += split;
+		right->count -= split;
+		right->result = range->result ? result : 0;
+		range->count = split;
+
+		ijkJobSubmit(range->jobs, ijkParallelInternalRange, right, counter, 0);
+		ijkParallelInternalRange(range);
+		ijkJobWait(range->jobs, counter);
+		if (range->combine)
+			range->combine(range->arg, range->result, result);
+	}
+	else
+		range->func(range->arg, range->first, range->count, range->result);
+	return ijk_success;
+}
+
+
+// internal default grain: about four ranges per thread
+ijk_inl size ijkParallelInternalGrain(ijkJobSystem const* const system, size const count, size const grain)
+{
+	size const ranges = system->workerCount * 4;
+	return grain ? grain : count > ranges ? (count + ranges - 1) / ranges : 1;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkParallelFor(ptr const jobs, size const count, size const grain, ijkParallelFunc const func, ptr const arg)
+{
+	ijkJobSystem const* const system = ijkJobInternalSystem(jobs);
+	if (system && func)
+	{
+		ijkParallelRange range[1] = { 0 };
+
+		// outside the system every range would be run inline, one by one
+		if (!ijkJobInternalWorker(system))
+			return ijk_fail_operationfail;
+		if (count)
+		{
+			range->jobs = jobs;
+			range->func = func;
+			range->arg = arg;
+			range->count = count;
+			range->grain = ijkParallelInternalGrain(system, count, grain);
+			ijkParallelInternalRange(range);
+		}
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkParallelReduce(ptr const jobs, size const count, size const grain, ijkParallelFunc const func, ijkParallelCombineFunc const combineFunc, ptr const arg, ptr const result_out, size const resultSize)
+{
+	ijkJobSystem const* const system = ijkJobInternalSystem(jobs);
+	if (system && func && combineFunc && result_out &&
+		resultSize && resultSize <= ijk_parallel_result_max)
+	{
+		ijkParallelRange range[1] = { 0 };
+		if (!ijkJobInternalWorker(system))
+			return ijk_fail_operationfail;
+		if (count)
+		{
+			range->jobs = jobs;
+			range->func = func;
+			range->combine = combineFunc;
+			range->arg = arg;
+			range->result = result_out;
+			range->count = count;
+			range->grain = ijkParallelInternalGrain(system, count, grain);
+			ijkParallelInternalRange(range);
+		}
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
@@ -24,6 +24,24 @@
 */
 
 #include "ijk/ijk-base/ijk-utility/ijkMemory.h"
+#include "ijk/ijk-base/ijk-utility/ijkThread.h"
+#include "ijk/ijk-base/ijk-utility/ijkTimer.h"
+
+#include <stdio.h>
+
+
+// include platform APIs
+#if (__ijk_cfg_platform == WINDOWS)
+#include <intrin.h>
+#include <immintrin.h>
+#define ijk_memory_target_sse2
+#define ijk_memory_target_avx2
+#else	// !WINDOWS
+#include <cpuid.h>
+#include <immintrin.h>
+#define ijk_memory_target_sse2			__attribute__((target("sse2")))
+#define ijk_memory_target_avx2			__attribute__((target("avx,avx2")))
+#endif	// WINDOWS
 
 
 //-----------------------------------------------------------------------------
@@ -31,9 +49,43 @@
 #ifndef __cplusplus
 typedef struct ijkMemoryPool	ijkMemoryPool;
 typedef struct ijkMemoryBlock	ijkMemoryBlock;
+typedef struct ijkMemoryIndexSlot	ijkMemoryIndexSlot;
+typedef struct ijkMemoryArena	ijkMemoryArena;
+typedef struct ijkMemoryObjectPool	ijkMemoryObjectPool;
+typedef struct ijkMemoryMagazine	ijkMemoryMagazine;
+typedef struct ijkMemoryCache	ijkMemoryCache;
+typedef struct ijkMemoryImage	ijkMemoryImage;
+typedef struct ijkMemoryTrace	ijkMemoryTrace;
 #endif	// !__cplusplus
 
 
+// ijk_memory_quick_count
+//	Number of exact-size quick lists; released blocks of up to this many 
+//	chomps are recycled as-is and only coalesced when open space runs out.
+#define ijk_memory_quick_count			32
+
+// ijk_memory_cache_count
+//	Number of size classes held in thread caches: powers of two from one 
+//	chomp; larger blocks bypass caches.
+#define ijk_memory_cache_count			6
+
+// ijk_memory_magazine_count
+//	Number of blocks held by a magazine (the unit of transfer between thread 
+//	caches and the shared depot).
+#define ijk_memory_magazine_count		32
+
+// ijk_memory_depot_limit
+//	Number of full magazines kept in the depot per size class; beyond this, 
+//	magazines are drained back into open space.
+#define ijk_memory_depot_limit			8
+
+// ijk_memory_depot_mask
+//	Bits of a depot head holding offset to the first magazine; the remaining 
+//	bits count updates so that a stale head is never mistaken for current.
+#define ijk_memory_depot_mask			0x0000FFFFFFFFFFFFull
+#define ijk_memory_depot_count			0x0001000000000000ull
+
+
 // ijkMemoryPool
 //	Managed memory pool descriptor.
 //		member name: name of pool used for identification
@@ -41,10 +93,23 @@ typedef struct ijkMemoryBlock	ijkMemoryBlock;
 //		member chompsAvailable: number of chomps free/open/available
 //		member chompsFragmented: number of chomps lost to fragmentation
 //		member chompSize: total size of pool in chomps
-//		member chompOffsetPrev: offset to previous reservation block descriptor
-//		member chompOffsetNext: offset to next reservation block descriptor
+//		member chompOffsetPrev: offset to last block descriptor
+//		member chompOffsetNext: offset to first block descriptor
 //		member chompOffsetLastRelease: offset to last-released block descriptor
+//		member chompOffsetDefrag: offset to block where defragmentation resumes
+//		member chompOffsetIndex: offset to name index block descriptor, if any
+//		member chompOffsetTrace: offset to trace block descriptor, if any
 //		member reserveCount: number of reservations
+//		member lock: held while a thread works on the pool directly
+//		member cacheCount: number of thread caches attached
+//		member depotEmpty: tagged offset to first empty magazine
+//		member depotFull: tagged offsets to first full magazine per size class
+//		member depotCount: number of full magazines per size class
+//		member indexCount: number of blocks in name index
+//		member indexMask: number of name index slots minus one
+//		member openMask: flags indicating which size classes have open blocks
+//		member chompOffsetOpen: offsets to first open block in each size class
+//		member chompOffsetQuick: offsets to first quick block of each small size
 struct ijkMemoryPool
 {
 	dtag name;							// identifier
@@ -52,10 +117,23 @@ struct ijkMemoryPool
 	size chompsAvailable;				// space available
 	size chompsFragmented;				// space fragmented
 	size chompSize;						// total space
-	size chompOffsetPrev;				// offset to previous reservation
-	size chompOffsetNext;				// offset to next reservation
+	size chompOffsetPrev;				// offset to last block
+	size chompOffsetNext;				// offset to first block
 	size chompOffsetLastRelease;		// offset to last release
+	size chompOffsetDefrag;				// offset to defragment cursor
+	size chompOffsetIndex;				// offset to name index
+	size chompOffsetTrace;				// offset to trace
 	size reserveCount;					// number of reservations
+	ijkMutex lock;						// shared access lock
+	size cacheCount;					// attached caches
+	qword depotEmpty;					// empty magazines
+	qword depotFull[ijk_memory_cache_count];	// full magazines by size class
+	size depotCount[ijk_memory_cache_count];	// full magazine count
+	size indexCount;					// number of indexed blocks
+	size indexMask;						// name index slots minus one
+	size openMask;						// open size classes
+	size chompOffsetOpen[__ijk_cfg_archbits];	// open blocks by size class
+	size chompOffsetQuick[ijk_memory_quick_count];	// quick blocks by size
 };
 
 // szmempool
@@ -71,13 +149,14 @@ struct ijkMemoryPool
 //	Managed memory reservation descriptor.
 //		member name: name of block used for identification
 //		member type: user-defined data type identifier of block
+//			note: negative if block is open or quick (not reserved)
 //		member chompSize: size of block in chomps
 //		member chompOffsetPrev: offset from previous block
 //		member chompOffsetNext: offset towards next block
 //		member chompOffsetHead: offset from pool head
 //		member chompOffsetTail: offset towards pool tail
-//		member chompOpenHead: open/available chomps from pool head
-//		member chompOpenTail: open/available chomps towards pool tail
+//		member chompOpenHead: if open, offset to previous open block in class
+//		member chompOpenTail: if open or quick, offset to next block in list
 struct ijkMemoryBlock
 {
 	dtag name;							// identifier
@@ -87,8 +166,8 @@ struct ijkMemoryBlock
 	size chompOffsetNext;				// offset towards next block
 	size chompOffsetHead;				// offset from pool head
 	size chompOffsetTail;				// offset towards pool tail
-	size chompOpenHead;					// available from head
-	size chompOpenTail;					// available towards tail
+	size chompOpenHead;					// previous open in class
+	size chompOpenTail;					// next open in list
 };
 
 // szmemblock
@@ -97,323 +176,2918 @@ struct ijkMemoryBlock
 
 // szcmemblock
 //	Size of reservation block in chomps.
-#define szcmempool						szc(ijkMemoryPool)
+#define szcmemblock						szc(ijkMemoryBlock)
+
+
+// ijkMemoryIndexSlot
+//	Name index entry; slots are probed linearly from the name's hash.
+//		member hash: hash of indexed block name
+//		member chompOffset: offset to indexed block descriptor, zero if empty
+struct ijkMemoryIndexSlot
+{
+	size hash;							// hash of name
+	size chompOffset;					// offset to block
+};
+
+// szcmemslot
+//	Size of name index slot in chomps.
+#define szcmemslot						szc(ijkMemoryIndexSlot)
+
+
+// ijkMemoryArena
+//	Linear arena descriptor; offsets are measured in chomps from arena head.
+//		member name: name of arena used for identification
+//		member chompSize: size of each buffer in chomps
+//		member chompOffsetBuffer: offset to current buffer
+//		member chompOffsetBottom: offset to bottom of open space in buffer
+//		member chompOffsetTop: offset to top of open space in buffer
+//		member bufferCount: number of buffers
+//		member bufferIndex: index of current buffer
+struct ijkMemoryArena
+{
+	dtag name;							// identifier
+	size chompSize;						// size of buffer
+	size chompOffsetBuffer;				// offset to buffer
+	size chompOffsetBottom;				// offset to bottom of open space
+	size chompOffsetTop;				// offset to top of open space
+	size bufferCount;					// number of buffers
+	size bufferIndex;					// current buffer
+};
+
+// szmemarena
+//	Convenient macro for size of arena.
+#define szmemarena						szb(ijkMemoryArena)
+
+// szcmemarena
+//	Size of arena in chomps.
+#define szcmemarena						szc(ijkMemoryArena)
+
+
+// ijkMemoryObjectPool
+//	Object pool descriptor, followed by the generation of each slot, then by 
+//	the slots themselves; a free slot holds the next free slot number.
+//		member name: name of object pool used for identification
+//		member chompStride: size of each slot in chomps
+//		member chompOffsetSlots: offset from object pool head to first slot
+//		member capacity: number of slots
+//		member count: number of objects reserved
+//		member slotsUsed: number of slots that have ever held an object
+//		member slotFree: number of first free slot (index plus one), if any
+struct ijkMemoryObjectPool
+{
+	dtag name;							// identifier
+	size chompStride;					// size of slot
+	size chompOffsetSlots;				// offset to slots
+	size capacity;						// number of slots
+	size count;							// number of objects
+	size slotsUsed;						// slots touched
+	size slotFree;						// first free slot
+};
+
+// szmemobjpool
+//	Convenient macro for size of object pool.
+#define szmemobjpool					szb(ijkMemoryObjectPool)
+
+// szcmemobjpool
+//	Size of object pool in chomps.
+#define szcmemobjpool					szc(ijkMemoryObjectPool)
+
+// ijk_memory_handle_bits
+//	Number of handle bits holding slot index; the rest hold generation.
+#define ijk_memory_handle_bits			(__ijk_cfg_archbits / 2)
+
+// ijk_memory_handle_mask
+//	Mask of handle bits holding slot index.
+#define ijk_memory_handle_mask			(((size)1 << ijk_memory_handle_bits) - 1)
+
+
+// ijkMemoryMagazine
+//	Stack of cached blocks of one size class.
+//		member chompOffsetNext: offset to next magazine in depot
+//		member count: number of blocks held
+//		member chompOffsetBlock: offsets to held block descriptors
+struct ijkMemoryMagazine
+{
+	size chompOffsetNext;				// next in depot
+	size count;							// number of blocks
+	size chompOffsetBlock[ijk_memory_magazine_count];	// blocks
+};
+
+// ijkMemoryCache
+//	Thread cache descriptor; holds two magazines per size class so that a 
+//	thread alternating reserve and release never touches the depot.
+//		member pool: pool that cache serves
+//		member loaded: magazine that blocks are taken from and returned to
+//		member previous: spare magazine, either full or empty
+struct ijkMemoryCache
+{
+	ijkMemoryPool* pool;				// shared pool
+	ijkMemoryMagazine* loaded[ijk_memory_cache_count];		// current
+	ijkMemoryMagazine* previous[ijk_memory_cache_count];	// spare
+};
+
+
+// ijkMemoryImage
+//	Header preceding saved pool or block contents; contents follow directly 
+//	and are chomp-aligned if the header is.
+//		member magic: identifies pool or block image
+//		member version: image format version
+//		member chompBytes: size of chomp where saved; offsets are in chomps, 
+//			so images only load where chomps are the same size
+//		member chompSize: size of contents in chomps
+//		member checksum: hash of contents
+//		member type: type of saved block, zero for pool
+//		member name: name of saved pool or block
+struct ijkMemoryImage
+{
+	qword magic;						// kind of image
+	dword version;						// format version
+	dword chompBytes;					// chomp size
+	qword chompSize;					// size of contents
+	qword checksum;						// hash of contents
+	i64 type;							// block type
+	tag name;							// identifier
+};
+
+// ijkMemoryTrace
+//	Instrumentation of pool, followed by type usage table and record ring.
+//		member timer: started when trace is created; records are stamped 
+//			with time since
+//		member report: stream to write leak report to on pool release
+//		member recordMask: number of records minus one
+//		member recordNext: number of records ever started
+//		member typeMask: number of type usage entries minus one
+//		member typeOverflow: number of events whose type did not fit
+struct ijkMemoryTrace
+{
+	ijkTimer timer[1];					// time base
+	ijkStream* report;					// leak report destination
+	size recordMask;					// records minus one
+	size recordNext;					// next record number
+	size typeMask;						// type entries minus one
+	size typeOverflow;					// untracked events
+};
+
+// szcmemtrace
+//	Size of trace header in chomps.
+#define szcmemtrace						szc(ijkMemoryTrace)
+
+
+// ijk_memory_image_pool
+//	Magic number of pool image ("ijkPool" in memory).
+#define ijk_memory_image_pool			0x006C6F6F506B6A69ull
+
+// ijk_memory_image_block
+//	Magic number of block image ("ijkBlck" in memory).
+#define ijk_memory_image_block			0x006B636C426B6A69ull
+
+// ijk_memory_image_version
+//	Current image format version; raise when any saved layout changes.
+#define ijk_memory_image_version		2
+
+
+// ijk_memory_type_open
+//	Type identifier of open (released or never reserved) blocks.
+#define ijk_memory_type_open			ijk_one_n
+
+// ijk_memory_type_quick
+//	Type identifier of released blocks held in quick lists.
+#define ijk_memory_type_quick			ijk_neg(2)
+
+// ijk_memory_type_index
+//	Type identifier of the block holding a pool's name index.
+#define ijk_memory_type_index			ijk_neg(3)
+
+// ijk_memory_type_cache
+//	Type identifier of blocks owned by thread caches: cache descriptors, 
+//	magazines and all blocks handed out by caches.
+#define ijk_memory_type_cache			ijk_neg(4)
+
+// ijk_memory_type_trace
+//	Type identifier of the block holding a pool's trace.
+#define ijk_memory_type_trace			ijk_neg(5)
+
+// ijk_memory_block
+//	Get block descriptor at chomp offset from pool head.
+#define ijk_memory_block(pool, offset)	((ijkMemoryBlock*)((pchomp)(pool) + (offset)))
+
+// ijk_memory_index
+//	Get first name index slot of pool.
+#define ijk_memory_index(pool)			((ijkMemoryIndexSlot*)(ijk_memory_block(pool, (pool)->chompOffsetIndex) + 1))
+
+// ijk_memory_trace
+//	Get trace of pool.
+#define ijk_memory_trace(pool)			((ijkMemoryTrace*)(ijk_memory_block(pool, (pool)->chompOffsetTrace) + 1))
+
+// ijk_memory_trace_usage
+//	Get first type usage entry of trace.
+#define ijk_memory_trace_usage(trace)	((ijkMemoryTypeUsage*)((trace) + 1))
+
+// ijk_memory_trace_record
+//	Get first record of trace.
+#define ijk_memory_trace_record(trace)	((ijkMemoryTraceRecord*)(ijk_memory_trace_usage(trace) + (trace)->typeMask + 1))
+
+// ijk_memory_trace_reserve, ijk_memory_trace_release, ijk_memory_trace_retype
+//	Record events in traced pools; nothing in builds without instrumentation.
+#ifdef IJK_MEMORY_INSTRUMENT
+#define ijk_memory_trace_reserve(pool, block, site)	if ((pool)->chompOffsetTrace) ijkMemoryInternalTraceEvent(pool, block, ijk_true, site)
+#define ijk_memory_trace_release(pool, block, site)	if ((pool)->chompOffsetTrace) ijkMemoryInternalTraceEvent(pool, block, ijk_false, site)
+#define ijk_memory_trace_retype(pool, block, type)	if ((pool)->chompOffsetTrace) ijkMemoryInternalTraceRetype(pool, block, type)
+#else	// !IJK_MEMORY_INSTRUMENT
+#define ijk_memory_trace_reserve(pool, block, site)	ijk_unused(site)
+#define ijk_memory_trace_release(pool, block, site)	ijk_unused(site)
+#define ijk_memory_trace_retype(pool, block, type)	ijk_unused(pool)
+#endif	// IJK_MEMORY_INSTRUMENT
 
 
 //-----------------------------------------------------------------------------
 
-iret ijkMemoryPoolCreate(ptr const pool_base, size const baseSize, size const poolSize, tag const name, ijkMemoryInitCallback const initCallback_opt)
+// bit scan tables: multiplying an isolated bit by the de Bruijn constant 
+//	leaves a unique pattern in the high bits, used to look up the bit index
+#if (__ijk_cfg_archbits == 64)
+#define ijk_memory_debruijn				0x03F79D71B4CB0A89ull
+#define ijk_memory_debruijn_shift		58
+static byte const ijk_memory_debruijn_index[64] = {
+	0, 1, 48, 2, 57, 49, 28, 3, 61, 58, 50, 42, 38, 29, 17, 4,
+	62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+	63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+	46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6,
+};
+#else	// !64
+#define ijk_memory_debruijn				0x077CB531ul
+#define ijk_memory_debruijn_shift		27
+static byte const ijk_memory_debruijn_index[32] = {
+	0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+	31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9,
+};
+#endif	// 64
+
+
+// index of lowest raised bit; value must be non-zero
+ijk_inl size ijkMemoryInternalBitLow(size const value)
 {
-	if (pool_base && baseSize && poolSize && name && *name)
-	{
-		size const spaceRequired = szmempool + szmemblock;
-		if (baseSize > spaceRequired)
-		{
-			size const spaceAvailable = baseSize - spaceRequired;
-			if (poolSize <= spaceAvailable)
-			{
-				ijkMemoryPool* const desc = (ijkMemoryPool*)pool_base;
+	return ijk_memory_debruijn_index[((value & (~value + 1)) * ijk_memory_debruijn) >> ijk_memory_debruijn_shift];
+}
 
-				// initialize pool
-				ijk_copytag(desc->name, name);
-				desc->name[sztag - 1] = 0;
-				desc->chompsReserved = 0;
-				desc->chompsAvailable = ijk_b2c(poolSize);
-				desc->chompsFragmented = 0;
-				desc->chompSize = desc->chompsAvailable;
-				desc->chompOffsetPrev = 0;
-				desc->chompOffsetNext = szcmempool;
-				desc->chompOffsetLastRelease = 0;
-				desc->reserveCount = 0;
 
-				// callback
-				if (initCallback_opt)
-					initCallback_opt(desc, desc->chompSize);
+// index of highest raised bit; value must be non-zero
+ijk_inl size ijkMemoryInternalBitHigh(size value)
+{
+	// smear highest bit downward, then isolate it
+	value |= value >> 1;
+	value |= value >> 2;
+	value |= value >> 4;
+	value |= value >> 8;
+	value |= value >> 16;
+#if (__ijk_cfg_archbits == 64)
+	value |= value >> 32;
+#endif	// 64
+	return ijk_memory_debruijn_index[((value ^ (value >> 1)) * ijk_memory_debruijn) >> ijk_memory_debruijn_shift];
+}
 
-				// done
-				return ijk_success;
-			}
-		}
-		return ijk_fail_operationfail;
-	}
-	return ijk_fail_invalidparams;
+
+// link open block into the head of its size class list
+ijk_inl void ijkMemoryInternalOpenInsert(ijkMemoryPool* const pool, ijkMemoryBlock* const block)
+{
+	size const sizeClass = ijkMemoryInternalBitHigh(block->chompSize);
+	size const offset = pool->chompOffsetOpen[sizeClass];
+	block->chompOpenHead = 0;
+	block->chompOpenTail = offset;
+	if (offset)
+		ijk_memory_block(pool, offset)->chompOpenHead = block->chompOffsetHead;
+	pool->chompOffsetOpen[sizeClass] = block->chompOffsetHead;
+	pool->openMask |= ((size)1 << sizeClass);
 }
 
 
-iret ijkMemoryPoolRelease(ptr const pool, ijkMemoryInitCallback const termCallback_opt)
+// unlink open block from its size class list
+ijk_inl void ijkMemoryInternalOpenRemove(ijkMemoryPool* const pool, ijkMemoryBlock* const block)
 {
-	if (pool)
+	size const sizeClass = ijkMemoryInternalBitHigh(block->chompSize);
+	if (block->chompOpenHead)
+		ijk_memory_block(pool, block->chompOpenHead)->chompOpenTail = block->chompOpenTail;
+	else
 	{
-		ijkMemoryPool* const desc = (ijkMemoryPool*)pool;
-		if (desc->reserveCount)
-		{
-			if (termCallback_opt)
-				termCallback_opt(desc, desc->chompSize);
-		}
-		return ijk_success;
+		pool->chompOffsetOpen[sizeClass] = block->chompOpenTail;
+		if (!block->chompOpenTail)
+			pool->openMask &= ~((size)1 << sizeClass);
 	}
-	return ijk_fail_invalidparams;
+	if (block->chompOpenTail)
+		ijk_memory_block(pool, block->chompOpenTail)->chompOpenHead = block->chompOpenHead;
+	block->chompOpenHead = block->chompOpenTail = 0;
 }
 
 
-iret ijkMemoryPoolLoad(ptr const pool_base, size const baseSize, ijkStream* const stream, ijkStreamReadFunc const loadCallback_opt)
+// locate open block that fits the requested number of chomps
+ijk_inl ijkMemoryBlock* ijkMemoryInternalOpenFind(ijkMemoryPool const* const pool, size const chompSize)
 {
-	if (pool_base && baseSize && stream &&
-		stream->base && stream->isRead)
+	// the first block in the requested size class may fit (first-fit)
+	size const sizeClass = ijkMemoryInternalBitHigh(chompSize);
+	size offset = pool->chompOffsetOpen[sizeClass];
+	size mask;
+	if (offset && ijk_memory_block(pool, offset)->chompSize >= chompSize)
+		return ijk_memory_block(pool, offset);
+
+	// otherwise any block in a larger class is guaranteed to fit
+	mask = pool->openMask & ~(((size)2 << sizeClass) - 1);
+	if (mask)
 	{
-	//	ijkMemoryPool* const desc = (ijkMemoryPool*)pool_base;
-
+		offset = pool->chompOffsetOpen[ijkMemoryInternalBitLow(mask)];
+		return ijk_memory_block(pool, offset);
 	}
-	return ijk_fail_invalidparams;
+	return 0;
 }
 
 
-iret ijkMemoryPoolSave(kptr const pool, size const baseSize, ijkStream* const stream, ijkStreamWriteFunc const saveCallback_opt)
+// absorb the next adjacent block into a block
+ijk_inl void ijkMemoryInternalBlockMerge(ijkMemoryPool* const pool, ijkMemoryBlock* const block)
 {
-	if (pool && baseSize && stream &&
-		stream->base && !stream->isRead)
+	ijkMemoryBlock* const next = (ijkMemoryBlock*)((pchomp)block + block->chompOffsetNext);
+	if (pool->chompOffsetDefrag == next->chompOffsetHead)
+		pool->chompOffsetDefrag = block->chompOffsetHead;
+	if (pool->chompOffsetLastRelease == next->chompOffsetHead)
+		pool->chompOffsetLastRelease = block->chompOffsetHead;
+	block->chompSize += szcmemblock + next->chompSize;
+	if (next->chompOffsetNext)
 	{
-	//	ijkMemoryPool const* const desc = (ijkMemoryPool*)pool;
-
+		block->chompOffsetNext += next->chompOffsetNext;
+		((ijkMemoryBlock*)((pchomp)block + block->chompOffsetNext))->chompOffsetPrev = block->chompOffsetNext;
+	}
+	else
+	{
+		block->chompOffsetNext = 0;
+		pool->chompOffsetPrev = block->chompOffsetHead;
 	}
-	return ijk_fail_invalidparams;
 }
 
 
-iret ijkMemoryPoolDefragment(ptr const pool, ijkMemoryCopyCallback const copyCallback_opt)
+// split the end of a block into a new open block
+ijk_inl ijkMemoryBlock* ijkMemoryInternalBlockSplit(ijkMemoryPool* const pool, ijkMemoryBlock* const block, size const chompSize)
 {
-	if (pool)
-	{
-	//	ijkMemoryPool* const desc = (ijkMemoryPool*)pool;
-
-	}
-	return ijk_fail_invalidparams;
+	ijkMemoryBlock* const split = (ijkMemoryBlock*)((pchomp)(block + 1) + chompSize);
+	size const chompOffset = szcmemblock + chompSize;
+	*split->name = 0;
+	split->type = ijk_memory_type_open;
+	split->chompSize = block->chompSize - chompOffset;
+	split->chompOffsetPrev = chompOffset;
+	split->chompOffsetNext = (block->chompOffsetNext ? block->chompOffsetNext - chompOffset : 0);
+	split->chompOffsetHead = block->chompOffsetHead + chompOffset;
+	split->chompOffsetTail = block->chompOffsetTail - chompOffset;
+	split->chompOpenHead = split->chompOpenTail = 0;
+	if (split->chompOffsetNext)
+		((ijkMemoryBlock*)((pchomp)split + split->chompOffsetNext))->chompOffsetPrev = split->chompOffsetNext;
+	else
+		pool->chompOffsetPrev = split->chompOffsetHead;
+	block->chompSize = chompSize;
+	block->chompOffsetNext = chompOffset;
+	return split;
 }
 
 
-iret ijkMemoryPoolGetBlock(kptr const pool, kptr* const block_out, tag const name)
+// coalesce unaccounted block with open neighbors and return it to open space
+ijk_inl ijkMemoryBlock* ijkMemoryInternalBlockOpen(ijkMemoryPool* const pool, ijkMemoryBlock* block)
 {
-	if (pool && block_out && name && *name &&
-		!*block_out)
+	block->type = ijk_memory_type_open;
+	*block->name = 0;
+	if (block->chompOffsetNext)
 	{
-		ijkMemoryPool const* const desc = (ijkMemoryPool*)pool;
-		ijkMemoryBlock const* block_next = (ijkMemoryBlock*)(desc + 1);
-		size const n = desc->reserveCount;
-		uitr i = 0;
-		while (i < n)
+		ijkMemoryBlock* const next = (ijkMemoryBlock*)((pchomp)block + block->chompOffsetNext);
+		if (next->type == ijk_memory_type_open)
 		{
-			// compare names; if found, return block pointer
-			if (ijkMemoryCompare(block_next->name, name, sztag) == sztag)
-			{
-				*block_out = (block_next + 1);
-				return ijk_success;
-			}
-
-			// if not found, jump to next
-			block_next = (ijkMemoryBlock*)((kpchomp)block_next + block_next->chompOffsetNext);
-			++i;
+			ijkMemoryInternalOpenRemove(pool, next);
+			pool->chompsAvailable -= next->chompSize;
+			ijkMemoryInternalBlockMerge(pool, block);
 		}
-		return ijk_fail_operationfail;
 	}
-	return ijk_fail_invalidparams;
+	if (block->chompOffsetPrev)
+	{
+		ijkMemoryBlock* const prev = (ijkMemoryBlock*)((pchomp)block - block->chompOffsetPrev);
+		if (prev->type == ijk_memory_type_open)
+		{
+			ijkMemoryInternalOpenRemove(pool, prev);
+			pool->chompsAvailable -= prev->chompSize;
+			ijkMemoryInternalBlockMerge(pool, prev);
+			block = prev;
+		}
+	}
+	ijkMemoryInternalOpenInsert(pool, block);
+	pool->chompsAvailable += block->chompSize;
+	return block;
 }
 
 
-iret ijkMemoryPoolGetName(kptr const pool, tag name_out)
+// move all quick blocks to open space; returns whether any were moved
+ijk_inl ibool ijkMemoryInternalQuickFlush(ijkMemoryPool* const pool)
 {
-	if (pool && name_out)
+	ibool result = ijk_false;
+	uitr i;
+	for (i = 0; i < ijk_memory_quick_count; ++i)
 	{
-		ijkMemoryPool const* const desc = (ijkMemoryPool*)pool;
-		ijk_copytag(name_out, desc->name);
-		name_out[sztag - 1] = 0;
-		return ijk_success;
+		while (pool->chompOffsetQuick[i])
+		{
+			ijkMemoryBlock* const block = ijk_memory_block(pool, pool->chompOffsetQuick[i]);
+			pool->chompOffsetQuick[i] = block->chompOpenTail;
+			pool->chompsAvailable -= block->chompSize;
+			block->chompOpenTail = 0;
+			ijkMemoryInternalBlockOpen(pool, block);
+			result = ijk_true;
+		}
 	}
-	return ijk_fail_invalidparams;
+	return result;
 }
 
 
-iret ijkMemoryPoolSetName(ptr const pool, tag const name)
+// take a block of at least the requested size out of quick or open space 
+//	and account for it as reserved
+ijk_inl ijkMemoryBlock* ijkMemoryInternalBlockReserve(ijkMemoryPool* const pool, size const chompSize)
 {
-	if (pool && name && *name)
+	ijkMemoryBlock* block = 0;
+
+	// small blocks: recycle a released block of the same size
+	if (chompSize <= ijk_memory_quick_count && pool->chompOffsetQuick[chompSize - 1])
 	{
-		ijkMemoryPool* const desc = (ijkMemoryPool*)pool;
-		ijk_copytag(desc->name, name);
-		desc->name[sztag - 1] = 0;
-		return ijk_success;
+		block = ijk_memory_block(pool, pool->chompOffsetQuick[chompSize - 1]);
+		pool->chompOffsetQuick[chompSize - 1] = block->chompOpenTail;
+		pool->chompsAvailable -= block->chompSize;
+		block->chompOpenTail = 0;
 	}
-	return ijk_fail_invalidparams;
-}
 
+	// otherwise search open space, coalescing quick blocks if it is full
+	else
+	{
+		block = ijkMemoryInternalOpenFind(pool, chompSize);
+		if (!block && ijkMemoryInternalQuickFlush(pool))
+			block = ijkMemoryInternalOpenFind(pool, chompSize);
+		if (block)
+		{
+			// take block out of open space
+			ijkMemoryInternalOpenRemove(pool, block);
+			pool->chompsAvailable -= block->chompSize;
 
-iret ijkMemoryPoolGetReserved(kptr const pool, size* const size_out)
-{
-	if (pool && size_out)
+			// return remainder to open space if it can hold a descriptor and data
+			if (block->chompSize > chompSize + szcmemblock)
+			{
+				ijkMemoryBlock* const split = ijkMemoryInternalBlockSplit(pool, block, chompSize);
+				ijkMemoryInternalOpenInsert(pool, split);
+				pool->chompsAvailable += split->chompSize;
+			}
+		}
+	}
+
+	// update pool
+	if (block)
 	{
-		ijkMemoryPool const* const desc = (ijkMemoryPool*)pool;
-		*size_out = desc->chompsReserved;
-		return ijk_success;
+		pool->chompsReserved += block->chompSize;
+		pool->chompsFragmented = pool->chompSize - pool->chompsReserved - pool->chompsAvailable;
 	}
-	return ijk_fail_invalidparams;
+	return block;
 }
 
 
-iret ijkMemoryPoolGetAvailable(kptr const pool, size* const size_out)
+// return reserved block to quick or open space; returns the block that holds 
+//	its space afterwards
+ijk_inl ijkMemoryBlock* ijkMemoryInternalBlockRestore(ijkMemoryPool* const pool, ijkMemoryBlock* block)
 {
-	if (pool && size_out)
+	pool->chompsReserved -= block->chompSize;
+
+	// small blocks go to quick list, others are coalesced
+	if (block->chompSize <= ijk_memory_quick_count)
 	{
-		ijkMemoryPool const* const desc = (ijkMemoryPool*)pool;
-		*size_out = desc->chompsAvailable;
-		return ijk_success;
+		block->type = ijk_memory_type_quick;
+		block->chompOpenTail = pool->chompOffsetQuick[block->chompSize - 1];
+		pool->chompOffsetQuick[block->chompSize - 1] = block->chompOffsetHead;
+		pool->chompsAvailable += block->chompSize;
 	}
-	return ijk_fail_invalidparams;
+	else
+		block = ijkMemoryInternalBlockOpen(pool, block);
+	pool->chompsFragmented = pool->chompSize - pool->chompsReserved - pool->chompsAvailable;
+	return block;
 }
 
 
-iret ijkMemoryPoolGetFragmented(kptr const pool, size* const size_out)
+// hash of name up to its terminator (FNV-1a)
+ijk_inl size ijkMemoryInternalNameHash(kpbyte name)
 {
-	if (pool && size_out)
-	{
-		ijkMemoryPool const* const desc = (ijkMemoryPool*)pool;
-		*size_out = desc->chompsFragmented;
-		return ijk_success;
-	}
-	return ijk_fail_invalidparams;
+#if (__ijk_cfg_archbits == 64)
+	size hash = 0xCBF29CE484222325ull;
+	size const prime = 0x00000100000001B3ull;
+#else	// !64
+	size hash = 0x811C9DC5ul;
+	size const prime = 0x01000193ul;
+#endif	// 64
+	kpbyte const end = name + sztag - 1;
+	while (name < end && *name)
+		hash = (hash ^ *(name++)) * prime;
+	return hash;
 }
 
 
-iret ijkMemoryPoolGetSize(kptr const pool, size* const size_out)
+// place block offset in first free slot from its hash
+ijk_inl void ijkMemoryInternalIndexPlace(ijkMemoryIndexSlot* const slots, size const mask, size const hash, size const chompOffset)
 {
-	if (pool && size_out)
-	{
-		ijkMemoryPool const* const desc = (ijkMemoryPool*)pool;
-		*size_out = desc->chompSize;
-		return ijk_success;
-	}
-	return ijk_fail_invalidparams;
+	size i = hash & mask;
+	while (slots[i].chompOffset)
+		i = (i + 1) & mask;
+	slots[i].hash = hash;
+	slots[i].chompOffset = chompOffset;
 }
 
 
-//-----------------------------------------------------------------------------
-
-iret ijkMemoryBlockCreate(ptr* const block_out, size const blockSize, ptr const pool, tag const name, flag const type, ijkMemoryInitCallback const initCallback_opt)
+// locate slot holding block offset
+ijk_inl ijkMemoryIndexSlot* ijkMemoryInternalIndexFind(ijkMemoryPool const* const pool, size const hash, size const chompOffset)
 {
-	if (block_out && blockSize && pool && name && *name && type >= 0 &&
-		!*block_out)
-	{
-	//	ijkMemoryBlock* const desc = (ijkMemoryBlock*)block_out - 1;
+	ijkMemoryIndexSlot* const slots = ijk_memory_index(pool);
+	size i = hash & pool->indexMask;
+	while (slots[i].chompOffset != chompOffset)
+		i = (i + 1) & pool->indexMask;
+	return (slots + i);
+}
 
-	}
-	return ijk_fail_invalidparams;
+
+// release name index; lookups fall back to searching blocks
+ijk_inl void ijkMemoryInternalIndexRelease(ijkMemoryPool* const pool)
+{
+	ijkMemoryInternalBlockRestore(pool, ijk_memory_block(pool, pool->chompOffsetIndex));
+	pool->chompOffsetIndex = 0;
+	pool->indexCount = 0;
+	pool->indexMask = 0;
 }
 
 
-iret ijkMemoryBlockRelease(ptr const block, ptr const pool, ijkMemoryInitCallback const termCallback_opt)
+// move name index to a new block with the given number of slots (power of 
+//	two); returns whether space was available
+ijk_inl ibool ijkMemoryInternalIndexResize(ijkMemoryPool* const pool, size const capacity)
 {
+	size const chompSize = capacity * szcmemslot;
+	ijkMemoryBlock* const block = ijkMemoryInternalBlockReserve(pool, chompSize);
 	if (block)
 	{
-	//	ijkMemoryBlock* const desc = (ijkMemoryBlock*)block - 1;
-
+		ijkMemoryIndexSlot* const slots = (ijkMemoryIndexSlot*)(block + 1);
+		ijkMemoryIndexSlot const* slot;
+		ijkMemoryIndexSlot const* end;
+		*block->name = 0;
+		block->type = ijk_memory_type_index;
+		ijkMemorySetZeroC(slots, chompSize);
+
+		// rehash existing entries and give up old slots
+		if (pool->chompOffsetIndex)
+		{
+			for (slot = ijk_memory_index(pool), end = slot + pool->indexMask + 1; slot < end; ++slot)
+				if (slot->chompOffset)
+					ijkMemoryInternalIndexPlace(slots, capacity - 1, slot->hash, slot->chompOffset);
+			ijkMemoryInternalBlockRestore(pool, ijk_memory_block(pool, pool->chompOffsetIndex));
+		}
+		pool->chompOffsetIndex = block->chompOffsetHead;
+		pool->indexMask = capacity - 1;
+		return ijk_true;
 	}
-	return ijk_fail_invalidparams;
+	return ijk_false;
 }
 
 
-iret ijkMemoryBlockLoad(ptr const block, ijkStream* const stream, ijkStreamReadFunc const loadCallback_opt)
+// add reserved block to name index, growing it past three-quarters full
+ijk_inl void ijkMemoryInternalIndexInsert(ijkMemoryPool* const pool, ijkMemoryBlock const* const block)
 {
-	if (block && stream &&
-		stream->base && stream->isRead)
+	if ((pool->indexCount + 1) * 4 > (pool->indexMask + 1) * 3 &&
+		!ijkMemoryInternalIndexResize(pool, (pool->indexMask + 1) * 2))
 	{
-	//	ijkMemoryBlock* const desc = (ijkMemoryBlock*)block - 1;
-
+		// no room to grow; drop index rather than let it go stale
+		ijkMemoryInternalIndexRelease(pool);
+		return;
 	}
-	return ijk_fail_invalidparams;
+	ijkMemoryInternalIndexPlace(ijk_memory_index(pool), pool->indexMask, ijkMemoryInternalNameHash(block->name), block->chompOffsetHead);
+	++pool->indexCount;
 }
 
 
-iret ijkMemoryBlockSave(kptr const block, ijkStream* const stream, ijkStreamWriteFunc const saveCallback_opt)
+// remove reserved block from name index, shifting back any slots that 
+//	probed past it so that no probe sequence is broken
+ijk_inl void ijkMemoryInternalIndexRemove(ijkMemoryPool* const pool, ijkMemoryBlock const* const block)
 {
-	if (block && stream &&
-		stream->base && !stream->isRead)
+	ijkMemoryIndexSlot* const slots = ijk_memory_index(pool);
+	size const mask = pool->indexMask;
+	size i = ijkMemoryInternalIndexFind(pool, ijkMemoryInternalNameHash(block->name), block->chompOffsetHead) - slots;
+	size j = i, k;
+	for (;;)
 	{
-	//	ijkMemoryBlock const* const desc = (ijkMemoryBlock*)block - 1;
+		j = (j + 1) & mask;
+		if (!slots[j].chompOffset)
+			break;
 
+		// slot j may fill the hole at i if i lies cyclically in [k, j)
+		k = slots[j].hash & mask;
+		if (((j - k) & mask) >= ((j - i) & mask))
+		{
+			slots[i] = slots[j];
+			i = j;
+		}
 	}
-	return ijk_fail_invalidparams;
+	slots[i].chompOffset = 0;
+	--pool->indexCount;
 }
 
 
-iret ijkMemoryBlockIsInPool(kptr const block, kptr const pool, ibool* const status_out)
+// raise value to at least given value
+ijk_inl void ijkMemoryInternalTracePeak(size volatile* const peak, size const value)
 {
-	if (block && pool && status_out)
+	size current = ijkAtomicLoad(peak), previous;
+	while (value > current)
 	{
-		ijkMemoryBlock const* const desc = (ijkMemoryBlock*)block - 1;
-		*status_out = (desc == (ijkMemoryBlock*)((kpchomp)pool + desc->chompOffsetHead));
-		return ijk_success;
+		previous = ijkAtomicCompareExchange(peak, value, current);
+		current = (previous == current ? value : previous);
 	}
-	return ijk_fail_invalidparams;
 }
 
 
-iret ijkMemoryBlockGetName(kptr const block, tag name_out)
+// find or claim usage entry for type; null if table is full
+ijk_inl ijkMemoryTypeUsage* ijkMemoryInternalTraceUsage(ijkMemoryTrace* const trace, flag const type)
 {
-	if (block && name_out)
+	ijkMemoryTypeUsage* const usage = ijk_memory_trace_usage(trace);
+	size i = (size)type & trace->typeMask, n;
+	flag previous;
+	for (n = 0; n <= trace->typeMask; ++n, i = (i + 1) & trace->typeMask)
 	{
-		ijkMemoryBlock const* const desc = (ijkMemoryBlock*)block - 1;
-		ijk_copytag(name_out, desc->name);
-		name_out[sztag - 1] = 0;
-		return ijk_success;
+		// open type is never traced and marks unclaimed entries
+		previous = usage[i].type;
+		if (previous == ijk_memory_type_open)
+			previous = (flag)ijkAtomicCompareExchange((size volatile*)&usage[i].type, (size)type, (size)ijk_memory_type_open);
+		if (previous == type || previous == ijk_memory_type_open)
+			return (usage + i);
 	}
-	return ijk_fail_invalidparams;
+	++trace->typeOverflow;
+	return 0;
 }
 
 
-iret ijkMemoryBlockSetName(ptr const block, tag const name)
+// add block to or remove block from usage of its type
+ijk_inl void ijkMemoryInternalTraceUsageUpdate(ijkMemoryTrace* const trace, flag const type, size const chompSize, ibool const reserve)
 {
-	if (block && name && *name)
+	ijkMemoryTypeUsage* const usage = ijkMemoryInternalTraceUsage(trace, type);
+	size const chomps = szcmemblock + chompSize;
+	if (usage)
 	{
-		ijkMemoryBlock* const desc = (ijkMemoryBlock*)block - 1;
-		ijk_copytag(desc->name, name);
-		desc->name[sztag - 1] = 0;
-		return ijk_success;
+		if (reserve)
+		{
+			ijkMemoryInternalTracePeak(&usage->countPeak, ijkAtomicAdd(&usage->count, 1) + 1);
+			ijkMemoryInternalTracePeak(&usage->chompsPeak, ijkAtomicAdd(&usage->chomps, chomps) + chomps);
+		}
+		else
+		{
+			ijkAtomicAdd(&usage->count, ijk_neg(1));
+			ijkAtomicAdd(&usage->chomps, ijk_neg(chomps));
+		}
 	}
-	return ijk_fail_invalidparams;
 }
 
 
-iret ijkMemoryBlockGetType(kptr const block, flag* const type_out)
+// record reservation or release of user block
+ijk_inl void ijkMemoryInternalTraceEvent(ijkMemoryPool* const pool, ijkMemoryBlock const* const block, ibool const reserve, kcstr const site)
 {
-	if (block && type_out)
+	ijkMemoryTrace* const trace = ijk_memory_trace(pool);
+	size const number = ijkAtomicAdd(&trace->recordNext, 1);
+	ijkMemoryTraceRecord* const record = ijk_memory_trace_record(trace) + (number & trace->recordMask);
+	ijkTimer timer = *trace->timer;
+
+	// lower sequence while writing so readers can skip partial records
+	ijkAtomicStore(&record->sequence, 0);
+	ijkTimerStop(&timer);
+	record->time = timer.tickMeasure;
+	record->site = site;
+	record->chompOffset = block->chompOffsetHead;
+	record->chompSize = block->chompSize;
+	record->chompsFragmented = pool->chompsFragmented;
+	record->type = block->type;
+	record->reserve = reserve;
+	ijk_copytag(record->name, block->name);
+	ijkAtomicStore(&record->sequence, number + 1);
+
+	ijkMemoryInternalTraceUsageUpdate(trace, block->type, block->chompSize, reserve);
+}
+
+
+// move block from usage of its type to another
+ijk_inl void ijkMemoryInternalTraceRetype(ijkMemoryPool* const pool, ijkMemoryBlock const* const block, flag const type)
+{
+	ijkMemoryTrace* const trace = ijk_memory_trace(pool);
+	ijkMemoryInternalTraceUsageUpdate(trace, block->type, block->chompSize, ijk_false);
+	ijkMemoryInternalTraceUsageUpdate(trace, type, block->chompSize, ijk_true);
+}
+
+
+// copy record if it is complete and still has the given number
+ijk_inl ibool ijkMemoryInternalTraceRead(ijkMemoryTrace const* const trace, size const number, ijkMemoryTraceRecord* const record_out)
+{
+	ijkMemoryTraceRecord* const record = ijk_memory_trace_record(trace) + (number & trace->recordMask);
+	if (ijkAtomicLoad(&record->sequence) == number + 1)
 	{
-		ijkMemoryBlock const* const desc = (ijkMemoryBlock*)block - 1;
-		*type_out = desc->type;
-		return ijk_success;
+		*record_out = *record;
+		return (ijkAtomicLoad(&record->sequence) == number + 1);
 	}
-	return ijk_fail_invalidparams;
+	return ijk_false;
 }
 
 
-iret ijkMemoryBlockSetType(ptr const block, flag const type)
+// write formatted line of report, truncated to buffer
+ijk_inl ibool ijkMemoryInternalReportLine(ijkStream* const stream, kpbyte const line, size const lineSize, i32 const length)
+{
+	return (length >= 0 &&
+		ijkStreamWriteElement(stream, line, 1, ijk_minimum((size)length, lineSize - 1), 0) == ijk_success);
+}
+
+
+// slide reserved block down into the preceding open block; returns the open 
+//	block that now follows it
+ijk_inl ijkMemoryBlock* ijkMemoryInternalBlockSlide(ijkMemoryPool* const pool, ijkMemoryBlock* const open, ijkMemoryCopyCallback const copyCallback, ijkMemoryRelocateCallback const relocateCallback_opt)
+{
+	ijkMemoryBlock* const src = (ijkMemoryBlock*)((pchomp)open + open->chompOffsetNext);
+	ijkMemoryBlock const block = *src, space = *open;
+	ijkMemoryBlock* const dst = open;
+	ijkMemoryBlock* moved;
+
+	// take open block out of open space
+	ijkMemoryInternalOpenRemove(pool, open);
+	pool->chompsAvailable -= space.chompSize;
+
+	// move descriptor and contents; destination is always below source
+	*dst = block;
+	dst->chompOffsetPrev = space.chompOffsetPrev;
+	dst->chompOffsetNext = szcmemblock + block.chompSize;
+	dst->chompOffsetHead = space.chompOffsetHead;
+	dst->chompOffsetTail = space.chompOffsetTail;
+	copyCallback(dst + 1, src + 1, block.chompSize);
+
+	// open space now follows moved block
+	moved = (ijkMemoryBlock*)((pchomp)dst + dst->chompOffsetNext);
+	moved->type = ijk_memory_type_open;
+	moved->chompSize = space.chompSize;
+	moved->chompOffsetPrev = dst->chompOffsetNext;
+	moved->chompOffsetNext = (block.chompOffsetNext ? block.chompOffsetNext + space.chompSize - block.chompSize : 0);
+	moved->chompOffsetHead = dst->chompOffsetHead + dst->chompOffsetNext;
+	moved->chompOffsetTail = dst->chompOffsetTail - dst->chompOffsetNext;
+	moved->chompOpenHead = moved->chompOpenTail = 0;
+	if (moved->chompOffsetNext)
+		((ijkMemoryBlock*)((pchomp)moved + moved->chompOffsetNext))->chompOffsetPrev = moved->chompOffsetNext;
+	else
+		pool->chompOffsetPrev = moved->chompOffsetHead;
+	if (pool->chompOffsetLastRelease == space.chompOffsetHead)
+		pool->chompOffsetLastRelease = moved->chompOffsetHead;
+
+	// update name index, or notify owner of new location
+	if (block.type == ijk_memory_type_index)
+		pool->chompOffsetIndex = dst->chompOffsetHead;
+	else
+	{
+		if (pool->chompOffsetIndex)
+			ijkMemoryInternalIndexFind(pool, ijkMemoryInternalNameHash(dst->name), block.chompOffsetHead)->chompOffset = dst->chompOffsetHead;
+		if (relocateCallback_opt)
+			relocateCallback_opt(dst + 1, src + 1, block.type);
+	}
+
+	// coalesce with following open space
+	return ijkMemoryInternalBlockOpen(pool, moved);
+}
+
+
+// hash of chomps for image validation; four interleaved lanes (FNV-1a on 
+//	whole chomps) so that hashing keeps up with reading
+ijk_inl qword ijkMemoryInternalChecksum(kpchomp data, size const chompCount)
+{
+	qword const prime = 0x00000100000001B3ull;
+	qword lane[4] = { 0xCBF29CE484222325ull, 0x84222325CBF29CE4ull, 0xCBF29CE484222325ull ^ 1, 0x84222325CBF29CE4ull ^ 1 };
+	kpchomp const end = data + chompCount, end4 = data + (chompCount & ~(size)3);
+	while (data < end4)
+	{
+		lane[0] = (lane[0] ^ data[0]) * prime;
+		lane[1] = (lane[1] ^ data[1]) * prime;
+		lane[2] = (lane[2] ^ data[2]) * prime;
+		lane[3] = (lane[3] ^ data[3]) * prime;
+		data += 4;
+	}
+	while (data < end)
+		lane[0] = (lane[0] ^ *(data++)) * prime;
+	return (((lane[0] * prime ^ lane[1]) * prime ^ lane[2]) * prime ^ lane[3]);
+}
+
+
+// number of chomps spanned by pool descriptor and all blocks
+ijk_inl size ijkMemoryInternalPoolExtent(ijkMemoryPool const* const pool)
+{
+	return (szcmempool + szcmemblock + pool->chompSize);
+}
+
+
+// validate image header and contents in place
+ijk_inl ibool ijkMemoryInternalImageValid(ijkMemoryImage const* const image, qword const magic, kptr const contents)
+{
+	return (image->magic == magic &&
+		image->version == ijk_memory_image_version &&
+		image->chompBytes == szchomp &&
+		image->checksum == ijkMemoryInternalChecksum((kpchomp)contents, (size)image->chompSize));
+}
+
+
+// reset state that only has meaning while pool is in use
+ijk_inl void ijkMemoryInternalPoolLoaded(ijkMemoryPool* const pool)
+{
+	ijkMemorySetZero(&pool->lock, szb(pool->lock));
+	pool->cacheCount = 0;
+	pool->depotEmpty = 0;
+	ijkMemorySetZero(pool->depotFull, szb(pool->depotFull));
+	ijkMemorySetZero(pool->depotCount, szb(pool->depotCount));
+
+	// trace continues with time and report relative to this process
+	if (pool->chompOffsetTrace)
+	{
+		ijk_memory_trace(pool)->report = 0;
+		ijkTimerStart(ijk_memory_trace(pool)->timer);
+	}
+}
+
+
+// wait for exclusive access to pool; the mutex spins briefly, then sleeps, 
+//	so a thread waiting behind a long refill or drain does not burn its core
+ijk_inl void ijkMemoryInternalPoolLock(ijkMemoryPool* const pool)
+{
+	ijkMutexLockWait(&pool->lock);
+}
+
+
+// give up exclusive access to pool
+ijk_inl void ijkMemoryInternalPoolUnlock(ijkMemoryPool* const pool)
+{
+	ijkMutexUnlock(&pool->lock);
+}
+
+
+// lock pool only if caches share it between threads; returns whether locked
+ijk_inl ibool ijkMemoryInternalPoolLockShared(ijkMemoryPool* const pool)
+{
+	if (ijkAtomicLoad(&pool->cacheCount))
+	{
+		ijkMemoryInternalPoolLock(pool);
+		return ijk_true;
+	}
+	return ijk_false;
+}
+
+
+// push magazine onto depot stack without locking
+ijk_inl void ijkMemoryInternalDepotPush(ijkMemoryPool* const pool, qword volatile* const depot, ijkMemoryMagazine* const magazine)
+{
+	qword const offset = (qword)((pchomp)magazine - (pchomp)pool);
+	qword head = ijkAtomicLoadQ(depot), prev;
+	for (;;)
+	{
+		magazine->chompOffsetNext = (size)(head & ijk_memory_depot_mask);
+		prev = ijkAtomicCompareExchangeQ(depot, ((head & ~ijk_memory_depot_mask) + ijk_memory_depot_count) | offset, head);
+		if (prev == head)
+			break;
+		head = prev;
+	}
+}
+
+
+// pop magazine from depot stack without locking; null if empty
+//	note: magazines are never returned to open space while caches exist, so 
+//	reading the next offset of a magazine taken by another thread is safe; 
+//	the update count in the head then rejects the exchange
+ijk_inl ijkMemoryMagazine* ijkMemoryInternalDepotPop(ijkMemoryPool* const pool, qword volatile* const depot)
+{
+	qword head = ijkAtomicLoadQ(depot), prev;
+	ijkMemoryMagazine* magazine;
+	for (;;)
+	{
+		if (!(head & ijk_memory_depot_mask))
+			return 0;
+		magazine = (ijkMemoryMagazine*)((pchomp)pool + (size)(head & ijk_memory_depot_mask));
+		prev = ijkAtomicCompareExchangeQ(depot, ((head & ~ijk_memory_depot_mask) + ijk_memory_depot_count) | magazine->chompOffsetNext, head);
+		if (prev == head)
+			return magazine;
+		head = prev;
+	}
+}
+
+
+// get empty magazine from depot, otherwise reserve one; null if pool is full
+ijk_inl ijkMemoryMagazine* ijkMemoryInternalMagazineCreate(ijkMemoryPool* const pool)
+{
+	ijkMemoryMagazine* magazine = ijkMemoryInternalDepotPop(pool, &pool->depotEmpty);
+	ijkMemoryBlock* block;
+	if (!magazine)
+	{
+		ijkMemoryInternalPoolLock(pool);
+		block = ijkMemoryInternalBlockReserve(pool, szc(ijkMemoryMagazine));
+		if (block)
+		{
+			*block->name = 0;
+			block->type = ijk_memory_type_cache;
+		}
+		ijkMemoryInternalPoolUnlock(pool);
+		if (block)
+		{
+			magazine = (ijkMemoryMagazine*)(block + 1);
+			magazine->chompOffsetNext = 0;
+			magazine->count = 0;
+		}
+	}
+	return magazine;
+}
+
+
+// reserve blocks of size class into magazine until full; pool must be locked
+ijk_inl void ijkMemoryInternalMagazineFill(ijkMemoryPool* const pool, ijkMemoryMagazine* const magazine, size const sizeClass)
+{
+	size const chompSize = (size)1 << sizeClass;
+	ijkMemoryBlock* block;
+	while (magazine->count < ijk_memory_magazine_count &&
+		(block = ijkMemoryInternalBlockReserve(pool, chompSize)))
+	{
+		*block->name = 0;
+		block->type = ijk_memory_type_cache;
+		magazine->chompOffsetBlock[magazine->count++] = block->chompOffsetHead;
+	}
+}
+
+
+// return all blocks in magazine to pool; pool must be locked
+ijk_inl void ijkMemoryInternalMagazineDrain(ijkMemoryPool* const pool, ijkMemoryMagazine* const magazine)
+{
+	while (magazine->count)
+		ijkMemoryInternalBlockRestore(pool, ijk_memory_block(pool, magazine->chompOffsetBlock[--magazine->count]));
+}
+
+
+// make loaded magazine of size class non-empty; returns whether possible
+ijk_inl ibool ijkMemoryInternalCacheRefill(ijkMemoryCache* const cache, size const sizeClass)
+{
+	ijkMemoryPool* const pool = cache->pool;
+	ijkMemoryMagazine* const loaded = cache->loaded[sizeClass];
+	ijkMemoryMagazine* const previous = cache->previous[sizeClass];
+	ijkMemoryMagazine* full;
+
+	// spare is full: swap
+	if (previous->count)
+	{
+		cache->loaded[sizeClass] = previous;
+		cache->previous[sizeClass] = loaded;
+		return ijk_true;
+	}
+
+	// both empty: exchange spare for a full magazine from the depot
+	full = ijkMemoryInternalDepotPop(pool, pool->depotFull + sizeClass);
+	if (full)
+	{
+		ijkAtomicAdd(pool->depotCount + sizeClass, ~(size)0);
+		ijkMemoryInternalDepotPush(pool, &pool->depotEmpty, previous);
+		cache->previous[sizeClass] = loaded;
+		cache->loaded[sizeClass] = full;
+		return ijk_true;
+	}
+
+	// depot is out: fill from pool in one batch
+	ijkMemoryInternalPoolLock(pool);
+	ijkMemoryInternalMagazineFill(pool, loaded, sizeClass);
+	ijkMemoryInternalPoolUnlock(pool);
+	return (loaded->count != 0);
+}
+
+
+// make loaded magazine of size class non-full; returns whether possible
+ijk_inl ibool ijkMemoryInternalCacheDrain(ijkMemoryCache* const cache, size const sizeClass)
+{
+	ijkMemoryPool* const pool = cache->pool;
+	ijkMemoryMagazine* const loaded = cache->loaded[sizeClass];
+	ijkMemoryMagazine* const previous = cache->previous[sizeClass];
+	ijkMemoryMagazine* empty;
+
+	// spare is empty: swap
+	if (!previous->count)
+	{
+		cache->loaded[sizeClass] = previous;
+		cache->previous[sizeClass] = loaded;
+		return ijk_true;
+	}
+
+	// both full: hand spare to the depot and load an empty magazine
+	empty = ijkMemoryInternalMagazineCreate(pool);
+	if (empty)
+	{
+		if (ijkAtomicAdd(pool->depotCount + sizeClass, 1) < ijk_memory_depot_limit)
+			ijkMemoryInternalDepotPush(pool, pool->depotFull + sizeClass, previous);
+		else
+		{
+			// depot has plenty; give blocks back to pool instead
+			ijkAtomicAdd(pool->depotCount + sizeClass, ~(size)0);
+			ijkMemoryInternalPoolLock(pool);
+			ijkMemoryInternalMagazineDrain(pool, previous);
+			ijkMemoryInternalPoolUnlock(pool);
+			ijkMemoryInternalDepotPush(pool, &pool->depotEmpty, previous);
+		}
+		cache->previous[sizeClass] = loaded;
+		cache->loaded[sizeClass] = empty;
+		return ijk_true;
+	}
+	return ijk_false;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkMemoryPoolCreate(ptr const pool_base, size const baseSize, size const poolSize, tag const name, ijkMemoryInitCallback const initCallback_opt)
+{
+	if (pool_base && baseSize && poolSize && name && *name)
+	{
+		size const spaceRequired = szmempool + szmemblock;
+		if (baseSize > spaceRequired)
+		{
+			size const spaceAvailable = baseSize - spaceRequired;
+			if (poolSize <= spaceAvailable && poolSize >= szchomp)
+			{
+				ijkMemoryPool* const desc = (ijkMemoryPool*)pool_base;
+				ijkMemoryBlock* const block = (ijkMemoryBlock*)(desc + 1);
+
+				// initialize pool
+				ijk_copytag(desc->name, name);
+				desc->name[sztag - 1] = 0;
+				desc->chompsReserved = 0;
+				desc->chompsAvailable = poolSize / szchomp;
+				desc->chompsFragmented = 0;
+				desc->chompSize = desc->chompsAvailable;
+				desc->chompOffsetPrev = szcmempool;
+				desc->chompOffsetNext = szcmempool;
+				desc->chompOffsetLastRelease = 0;
+				desc->chompOffsetDefrag = szcmempool;
+				desc->chompOffsetIndex = 0;
+				desc->chompOffsetTrace = 0;
+				desc->reserveCount = 0;
+				ijkMemorySetZero(&desc->lock, szb(desc->lock));
+				desc->cacheCount = 0;
+				desc->depotEmpty = 0;
+				ijkMemorySetZero(desc->depotFull, szb(desc->depotFull));
+				ijkMemorySetZero(desc->depotCount, szb(desc->depotCount));
+				desc->indexCount = 0;
+				desc->indexMask = 0;
+				desc->openMask = 0;
+				ijkMemorySetZeroC(desc->chompOffsetOpen, szc(desc->chompOffsetOpen));
+				ijkMemorySetZeroC(desc->chompOffsetQuick, szc(desc->chompOffsetQuick));
+
+				// callback on managed space
+				if (initCallback_opt)
+					initCallback_opt(block + 1, desc->chompSize);
+
+				// entire pool starts as one open block
+				*block->name = 0;
+				block->type = ijk_memory_type_open;
+				block->chompSize = desc->chompSize;
+				block->chompOffsetPrev = 0;
+				block->chompOffsetNext = 0;
+				block->chompOffsetHead = szcmempool;
+				block->chompOffsetTail = szcmemblock + desc->chompSize;
+				ijkMemoryInternalOpenInsert(desc, block);
+
+				// done
+				return ijk_success;
+			}
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolRelease(ptr const pool, ijkMemoryInitCallback const termCallback_opt)
+{
+	if (pool)
+	{
+		ijkMemoryPool* const desc = (ijkMemoryPool*)pool;
+		if (desc->reserveCount)
+		{
+			// anything still reserved is a leak
+			if (desc->chompOffsetTrace && ijk_memory_trace(desc)->report)
+				ijkMemoryPoolReport(desc, ijk_memory_trace(desc)->report);
+			if (termCallback_opt)
+				termCallback_opt(desc, desc->chompSize);
+		}
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolLoad(ptr const pool_base, size const baseSize, ijkStream* const stream, ijkStreamReadFunc const loadCallback_opt)
+{
+	if (pool_base && baseSize && stream &&
+		stream->base && stream->isRead)
+	{
+		ijkMemoryImage image;
+		ijkMemoryPool* const desc = (ijkMemoryPool*)pool_base;
+
+		// read header, then contents directly into place in one read
+		if (ijkStreamReadElement(stream, &image, 1, szb(image), 0) == ijk_success &&
+			image.magic == ijk_memory_image_pool && image.chompBytes == szchomp &&
+			image.chompSize >= szcmempool && image.chompSize <= baseSize / szchomp &&
+			ijkStreamReadElement(stream, pool_base, 1, (size)image.chompSize * szchomp, 0) == ijk_success &&
+			ijkMemoryInternalImageValid(&image, ijk_memory_image_pool, pool_base))
+		{
+			// offsets are relative; nothing to fix up
+			ijkMemoryInternalPoolLoaded(desc);
+
+			// user data following image
+			if (loadCallback_opt)
+				loadCallback_opt(stream, pool_base);
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolLoadInPlace(ptr* const pool_out, ptr const image_base, size const imageSize)
+{
+	if (pool_out && image_base && imageSize &&
+		!*pool_out)
+	{
+		ijkMemoryImage* const image = (ijkMemoryImage*)image_base;
+		ijkMemoryPool* const desc = (ijkMemoryPool*)(image + 1);
+		if (imageSize >= szb(ijkMemoryImage) &&
+			image->chompBytes == szchomp && image->chompSize >= szcmempool &&
+			image->chompSize <= (imageSize - szb(ijkMemoryImage)) / szchomp &&
+			ijkMemoryInternalImageValid(image, ijk_memory_image_pool, desc))
+		{
+			ijkMemoryInternalPoolLoaded(desc);
+			*pool_out = desc;
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolSave(kptr const pool, size const baseSize, ijkStream* const stream, ijkStreamWriteFunc const saveCallback_opt)
+{
+	if (pool && baseSize && stream &&
+		stream->base && !stream->isRead)
+	{
+		ijkMemoryPool const* const desc = (ijkMemoryPool*)pool;
+		ijkMemoryImage image = { 0 };
+
+		// caches hold addresses, which do not survive relocation
+		if (!desc->cacheCount && ijkMemoryInternalPoolExtent(desc) <= baseSize / szchomp)
+		{
+			image.magic = ijk_memory_image_pool;
+			image.version = ijk_memory_image_version;
+			image.chompBytes = szchomp;
+			image.chompSize = ijkMemoryInternalPoolExtent(desc);
+			image.checksum = ijkMemoryInternalChecksum((kpchomp)pool, (size)image.chompSize);
+			ijk_copytag(image.name, desc->name);
+			image.name[sztag - 1] = 0;
+			if (ijkStreamWriteElement(stream, &image, 1, szb(image), 0) == ijk_success &&
+				ijkStreamWriteElement(stream, pool, 1, (size)image.chompSize * szchomp, 0) == ijk_success)
+			{
+				// user data following image
+				if (saveCallback_opt)
+					saveCallback_opt(stream, pool);
+				return ijk_success;
+			}
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolDefragment(ptr const pool, ijkMemoryCopyCallback const copyCallback_opt)
+{
+	if (pool)
+	{
+		ijkMemoryPool* const desc = (ijkMemoryPool*)pool;
+		ibool const shared = ijkMemoryInternalPoolLockShared(desc);
+		desc->chompOffsetDefrag = desc->chompOffsetNext;
+		if (shared)
+			ijkMemoryInternalPoolUnlock(desc);
+		return ijkMemoryPoolDefragmentStep(pool, ~(size)0, copyCallback_opt, 0, 0, 0);
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolDefragmentStep(ptr const pool, size const chompBudget, ijkMemoryCopyCallback const copyCallback_opt, ijkMemoryRelocateCallback const relocateCallback_opt, size* const fragmentedBefore_opt, size* const fragmentedAfter_opt)
+{
+	if (pool && chompBudget)
+	{
+		ijkMemoryPool* const desc = (ijkMemoryPool*)pool;
+		ijkMemoryCopyCallback const copyCallback = (copyCallback_opt ? copyCallback_opt : ijkMemoryCopyC);
+		ibool const shared = ijkMemoryInternalPoolLockShared(desc);
+		ijkMemoryBlock* block = ijk_memory_block(pool, desc->chompOffsetDefrag);
+		size chompsMoved = 0, chompsMove;
+		iret result = ijk_success;
+
+		// quick blocks take part in compaction as open space
+		if (fragmentedBefore_opt)
+			*fragmentedBefore_opt = desc->chompsFragmented;
+		ijkMemoryInternalQuickFlush(desc);
+
+		// slide reserved blocks down into open space until budget is spent
+		while (block->chompOffsetNext)
+		{
+			ijkMemoryBlock* const next = (ijkMemoryBlock*)((pchomp)block + block->chompOffsetNext);
+			if (block->type == ijk_memory_type_open && (next->type >= 0 || next->type == ijk_memory_type_index))
+			{
+				chompsMove = szcmemblock + next->chompSize;
+				if (chompsMove <= chompBudget)
+				{
+					// stop here and resume on next step
+					if (chompsMoved + chompsMove > chompBudget)
+					{
+						result = ijk_warn_memory_incomplete;
+						break;
+					}
+					block = ijkMemoryInternalBlockSlide(desc, block, copyCallback, relocateCallback_opt);
+					chompsMoved += chompsMove;
+					continue;
+				}
+				// blocks larger than the budget can never move; step over
+			}
+			block = next;
+		}
+
+		// resume at stopping point, or start over if the end was reached
+		desc->chompOffsetDefrag = (result == ijk_success ? desc->chompOffsetNext : block->chompOffsetHead);
+		desc->chompsFragmented = desc->chompSize - desc->chompsReserved - desc->chompsAvailable;
+		if (fragmentedAfter_opt)
+			*fragmentedAfter_opt = desc->chompsFragmented;
+		if (shared)
+			ijkMemoryInternalPoolUnlock(desc);
+		return result;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolGetBlock(kptr const pool, kptr* const block_out, tag const name)
+{
+	if (pool && block_out && name && *name &&
+		!*block_out)
+	{
+		ijkMemoryPool* const desc = (ijkMemoryPool*)pool;
+		ibool const shared = ijkMemoryInternalPoolLockShared(desc);
+		ijkMemoryBlock const* block_next;
+		ijkMemoryBlock const* block = 0;
+
+		// probe name index from hash until an empty slot is reached
+		if (desc->chompOffsetIndex)
+		{
+			ijkMemoryIndexSlot const* const slots = ijk_memory_index(desc);
+			size const hash = ijkMemoryInternalNameHash(name);
+			size i;
+			for (i = hash & desc->indexMask; slots[i].chompOffset; i = (i + 1) & desc->indexMask)
+			{
+				block_next = ijk_memory_block(pool, slots[i].chompOffset);
+				if (slots[i].hash == hash &&
+					ijkMemoryCompare(block_next->name, name, sztag) == sztag)
+				{
+					block = block_next;
+					break;
+				}
+			}
+		}
+
+		// otherwise search all blocks
+		else
+		{
+			block_next = ijk_memory_block(pool, desc->chompOffsetNext);
+			for (;;)
+			{
+				// compare names of reserved blocks
+				if (block_next->type >= 0 &&
+					ijkMemoryCompare(block_next->name, name, sztag) == sztag)
+				{
+					block = block_next;
+					break;
+				}
+
+				// if not found, jump to next
+				if (!block_next->chompOffsetNext)
+					break;
+				block_next = (ijkMemoryBlock*)((kpchomp)block_next + block_next->chompOffsetNext);
+			}
+		}
+		if (shared)
+			ijkMemoryInternalPoolUnlock(desc);
+
+		// if found, return block pointer
+		if (block)
+		{
+			*block_out = (block + 1);
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolCreateIndex(ptr const pool, size const capacity)
+{
+	if (pool && capacity &&
+		!((ijkMemoryPool*)pool)->chompOffsetIndex)
+	{
+		ijkMemoryPool* const desc = (ijkMemoryPool*)pool;
+		ibool const shared = ijkMemoryInternalPoolLockShared(desc);
+		ijkMemoryBlock* block_next;
+		size slots = 1;
+		iret result = ijk_fail_operationfail;
+
+		// power of two with room for current reservations below three-quarters
+		while (slots < capacity || slots * 3 < (desc->reserveCount + 1) * 4)
+			slots <<= 1;
+		if (ijkMemoryInternalIndexResize(desc, slots))
+		{
+			// index all reserved blocks
+			block_next = ijk_memory_block(pool, desc->chompOffsetNext);
+			for (;;)
+			{
+				if (block_next->type >= 0)
+					ijkMemoryInternalIndexPlace(ijk_memory_index(desc), desc->indexMask, ijkMemoryInternalNameHash(block_next->name), block_next->chompOffsetHead);
+				if (!block_next->chompOffsetNext)
+					break;
+				block_next = (ijkMemoryBlock*)((pchomp)block_next + block_next->chompOffsetNext);
+			}
+			desc->indexCount = desc->reserveCount;
+			result = ijk_success;
+		}
+		if (shared)
+			ijkMemoryInternalPoolUnlock(desc);
+		return result;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolReleaseIndex(ptr const pool)
+{
+	if (pool &&
+		((ijkMemoryPool*)pool)->chompOffsetIndex)
+	{
+		ijkMemoryPool* const desc = (ijkMemoryPool*)pool;
+		ibool const shared = ijkMemoryInternalPoolLockShared(desc);
+		ijkMemoryInternalIndexRelease(desc);
+		if (shared)
+			ijkMemoryInternalPoolUnlock(desc);
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolCreateTrace(ptr const pool, size const recordCount, size const typeCount, ijkStream* const report_opt)
+{
+	if (pool && recordCount && typeCount &&
+		!((ijkMemoryPool*)pool)->chompOffsetTrace)
+	{
+#ifdef IJK_MEMORY_INSTRUMENT
+		ijkMemoryPool* const desc = (ijkMemoryPool*)pool;
+		ibool const shared = ijkMemoryInternalPoolLockShared(desc);
+		ijkMemoryBlock* block;
+		ijkMemoryTrace* trace;
+		ijkMemoryTypeUsage* usage;
+		size records = 1, types = 1, i;
+		iret result = ijk_fail_operationfail;
+		while (records < recordCount)
+			records <<= 1;
+		while (types < typeCount)
+			types <<= 1;
+
+		block = ijkMemoryInternalBlockReserve(desc, szcmemtrace + types * szc(ijkMemoryTypeUsage) + records * szc(ijkMemoryTraceRecord));
+		if (block)
+		{
+			*block->name = 0;
+			block->type = ijk_memory_type_trace;
+			trace = (ijkMemoryTrace*)(block + 1);
+			ijkTimerSet(trace->timer, 0.0);
+			ijkTimerStart(trace->timer);
+			trace->report = report_opt;
+			trace->recordMask = records - 1;
+			trace->recordNext = 0;
+			trace->typeMask = types - 1;
+			trace->typeOverflow = 0;
+			usage = ijk_memory_trace_usage(trace);
+			for (i = 0; i < types; ++i)
+				usage[i].type = ijk_memory_type_open;
+			ijkMemorySetZero(ijk_memory_trace_record(trace), records * szb(ijkMemoryTraceRecord));
+
+			// count blocks already reserved
+			block = ijk_memory_block(desc, desc->chompOffsetNext);
+			for (;;)
+			{
+				if (block->type >= 0)
+					ijkMemoryInternalTraceUsageUpdate(trace, block->type, block->chompSize, ijk_true);
+				if (!block->chompOffsetNext)
+					break;
+				block = (ijkMemoryBlock*)((pchomp)block + block->chompOffsetNext);
+			}
+			desc->chompOffsetTrace = (pchomp)trace - (pchomp)desc - szcmemblock;
+			result = ijk_success;
+		}
+		if (shared)
+			ijkMemoryInternalPoolUnlock(desc);
+		return result;
+#else	// !IJK_MEMORY_INSTRUMENT
+		ijk_unused(report_opt);
+		return ijk_fail_operationfail;
+#endif	// IJK_MEMORY_INSTRUMENT
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolReleaseTrace(ptr const pool)
+{
+	if (pool &&
+		((ijkMemoryPool*)pool)->chompOffsetTrace)
+	{
+		ijkMemoryPool* const desc = (ijkMemoryPool*)pool;
+		ibool const shared = ijkMemoryInternalPoolLockShared(desc);
+		ijkMemoryBlock* const block = ijk_memory_block(desc, desc->chompOffsetTrace);
+		desc->chompOffsetTrace = 0;
+		ijkMemoryInternalBlockRestore(desc, block);
+		if (shared)
+			ijkMemoryInternalPoolUnlock(desc);
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolGetTrace(kptr const pool, ijkMemoryTraceRecord* const records_out, size const recordCount, size* const count_out)
+{
+	if (pool && records_out && recordCount && count_out &&
+		((ijkMemoryPool*)pool)->chompOffsetTrace)
+	{
+		ijkMemoryTrace const* const trace = ijk_memory_trace((ijkMemoryPool*)pool);
+		size const next = ijkAtomicLoad(&trace->recordNext);
+		size number = next - ijk_minimum(next, ijk_minimum(trace->recordMask + 1, recordCount));
+		size count = 0;
+		for (; number < next; ++number)
+			if (ijkMemoryInternalTraceRead(trace, number, records_out + count))
+				++count;
+		*count_out = count;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolGetTypeUsage(kptr const pool, ijkMemoryTypeUsage* const usage_out, size const usageCount, size* const count_out)
+{
+	if (pool && usage_out && usageCount && count_out &&
+		((ijkMemoryPool*)pool)->chompOffsetTrace)
+	{
+		ijkMemoryTrace const* const trace = ijk_memory_trace((ijkMemoryPool*)pool);
+		ijkMemoryTypeUsage const* usage = ijk_memory_trace_usage(trace);
+		ijkMemoryTypeUsage const* const end = usage + trace->typeMask + 1;
+		size count = 0;
+		for (; usage < end && count < usageCount; ++usage)
+			if (usage->type != ijk_memory_type_open)
+				usage_out[count++] = *usage;
+		*count_out = count;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolReport(kptr const pool, ijkStream* const stream)
+{
+	if (pool && stream &&
+		stream->base && !stream->isRead)
+	{
+		ijkMemoryPool const* const desc = (ijkMemoryPool*)pool;
+		ijkMemoryTrace const* const trace = (desc->chompOffsetTrace ? ijk_memory_trace(desc) : 0);
+		ijkMemoryTypeUsage const* usage;
+		ijkMemoryBlock const* block;
+		ijkMemoryTraceRecord record;
+		kcstr site;
+		size number, first;
+		byte line[256];
+		i32 length;
+		iret result = ijk_success;
+
+		// totals
+		length = snprintf((char*)line, szb(line), "pool \"%s\": %llu reserved, %llu chomps reserved, %llu available, %llu fragmented (%u bytes per chomp)\n",
+			(char const*)desc->name, (unsigned long long)desc->reserveCount, (unsigned long long)desc->chompsReserved,
+			(unsigned long long)desc->chompsAvailable, (unsigned long long)desc->chompsFragmented, (unsigned)szchomp);
+		if (!ijkMemoryInternalReportLine(stream, line, szb(line), length))
+			result = ijk_fail_operationfail;
+
+		// usage by type
+		if (trace)
+			for (usage = ijk_memory_trace_usage(trace), number = 0; number <= trace->typeMask; ++number, ++usage)
+				if (usage->type != ijk_memory_type_open)
+				{
+					length = snprintf((char*)line, szb(line), "type %lld: %llu reserved (peak %llu), %llu chomps (peak %llu)\n",
+						(long long)usage->type, (unsigned long long)usage->count, (unsigned long long)usage->countPeak,
+						(unsigned long long)usage->chomps, (unsigned long long)usage->chompsPeak);
+					if (!ijkMemoryInternalReportLine(stream, line, szb(line), length))
+						result = ijk_fail_operationfail;
+				}
+
+		// reserved blocks; latest record of block tells where it came from
+		for (block = ijk_memory_block(desc, desc->chompOffsetNext); ; block = (ijkMemoryBlock*)((pchomp)block + block->chompOffsetNext))
+		{
+			if (block->type >= 0)
+			{
+				site = 0;
+				if (trace)
+				{
+					number = ijkAtomicLoad(&trace->recordNext);
+					first = number - ijk_minimum(number, trace->recordMask + 1);
+					while (number-- > first)
+						if (ijkMemoryInternalTraceRead(trace, number, &record) && record.chompOffset == block->chompOffsetHead)
+						{
+							if (record.reserve)
+								site = record.site;
+							break;
+						}
+				}
+				length = snprintf((char*)line, szb(line), "reserved \"%s\": type %lld, %llu chomps at %llu, site %s\n",
+					(char const*)block->name, (long long)block->type, (unsigned long long)block->chompSize,
+					(unsigned long long)block->chompOffsetHead, (site ? (char const*)site : "unknown"));
+				if (!ijkMemoryInternalReportLine(stream, line, szb(line), length))
+					result = ijk_fail_operationfail;
+			}
+			if (!block->chompOffsetNext)
+				break;
+		}
+		return result;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolGetName(kptr const pool, tag name_out)
+{
+	if (pool && name_out)
+	{
+		ijkMemoryPool const* const desc = (ijkMemoryPool*)pool;
+		ijk_copytag(name_out, desc->name);
+		name_out[sztag - 1] = 0;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolSetName(ptr const pool, tag const name)
+{
+	if (pool && name && *name)
+	{
+		ijkMemoryPool* const desc = (ijkMemoryPool*)pool;
+		ijk_copytag(desc->name, name);
+		desc->name[sztag - 1] = 0;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolGetReserved(kptr const pool, size* const size_out)
+{
+	if (pool && size_out)
+	{
+		ijkMemoryPool const* const desc = (ijkMemoryPool*)pool;
+		*size_out = desc->chompsReserved;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolGetAvailable(kptr const pool, size* const size_out)
+{
+	if (pool && size_out)
+	{
+		ijkMemoryPool const* const desc = (ijkMemoryPool*)pool;
+		*size_out = desc->chompsAvailable;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolGetFragmented(kptr const pool, size* const size_out)
+{
+	if (pool && size_out)
+	{
+		ijkMemoryPool const* const desc = (ijkMemoryPool*)pool;
+		*size_out = desc->chompsFragmented;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryPoolGetSize(kptr const pool, size* const size_out)
+{
+	if (pool && size_out)
+	{
+		ijkMemoryPool const* const desc = (ijkMemoryPool*)pool;
+		*size_out = desc->chompSize;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkMemoryBlockCreate(ptr* const block_out, size const blockSize, ptr const pool, tag const name, flag const type, ijkMemoryInitCallback const initCallback_opt)
+{
+	return ijkMemoryBlockCreateAt(block_out, blockSize, pool, name, type, initCallback_opt, 0);
+}
+
+
+iret ijkMemoryBlockCreateAt(ptr* const block_out, size const blockSize, ptr const pool, tag const name, flag const type, ijkMemoryInitCallback const initCallback_opt, kcstr const site)
+{
+	if (block_out && blockSize && pool && name && *name && type >= 0 &&
+		!*block_out)
+	{
+		ijkMemoryPool* const desc_pool = (ijkMemoryPool*)pool;
+		ibool const shared = ijkMemoryInternalPoolLockShared(desc_pool);
+		ijkMemoryBlock* const desc = ijkMemoryInternalBlockReserve(desc_pool, ijk_b2c(blockSize));
+
+		// reserve block
+		if (desc)
+		{
+			ijk_copytag(desc->name, name);
+			desc->name[sztag - 1] = 0;
+			desc->type = type;
+
+			// update pool
+			++desc_pool->reserveCount;
+			if (desc_pool->chompOffsetIndex)
+				ijkMemoryInternalIndexInsert(desc_pool, desc);
+			ijk_memory_trace_reserve(desc_pool, desc, site);
+		}
+		if (shared)
+			ijkMemoryInternalPoolUnlock(desc_pool);
+
+		if (desc)
+		{
+			// callback
+			if (initCallback_opt)
+				initCallback_opt(desc + 1, desc->chompSize);
+
+			// done
+			*block_out = (desc + 1);
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryBlockRelease(ptr const block, ptr const pool, ijkMemoryInitCallback const termCallback_opt)
+{
+	return ijkMemoryBlockReleaseAt(block, pool, termCallback_opt, 0);
+}
+
+
+iret ijkMemoryBlockReleaseAt(ptr const block, ptr const pool, ijkMemoryInitCallback const termCallback_opt, kcstr const site)
+{
+	if (block && pool)
+	{
+		ijkMemoryPool* const desc_pool = (ijkMemoryPool*)pool;
+		ijkMemoryBlock* desc = (ijkMemoryBlock*)block - 1;
+		ibool shared;
+		if (desc == ijk_memory_block(pool, desc->chompOffsetHead) && desc->type >= 0)
+		{
+			// callback
+			if (termCallback_opt)
+				termCallback_opt(block, desc->chompSize);
+
+			// update pool
+			shared = ijkMemoryInternalPoolLockShared(desc_pool);
+			--desc_pool->reserveCount;
+			if (desc_pool->chompOffsetIndex)
+				ijkMemoryInternalIndexRemove(desc_pool, desc);
+			ijk_memory_trace_release(desc_pool, desc, site);
+			desc = ijkMemoryInternalBlockRestore(desc_pool, desc);
+			desc_pool->chompOffsetLastRelease = desc->chompOffsetHead;
+			if (shared)
+				ijkMemoryInternalPoolUnlock(desc_pool);
+
+			// done
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryBlockLoad(ptr const block, ijkStream* const stream, ijkStreamReadFunc const loadCallback_opt)
+{
+	if (block && stream &&
+		stream->base && stream->isRead)
+	{
+		ijkMemoryBlock* const desc = (ijkMemoryBlock*)block - 1;
+		ijkMemoryImage image;
+
+		// contents must fit in block as reserved
+		if (desc->type >= 0 &&
+			ijkStreamReadElement(stream, &image, 1, szb(image), 0) == ijk_success &&
+			image.magic == ijk_memory_image_block && image.chompBytes == szchomp &&
+			image.chompSize && image.chompSize <= desc->chompSize && image.type >= 0 &&
+			ijkStreamReadElement(stream, block, 1, (size)image.chompSize * szchomp, 0) == ijk_success &&
+			ijkMemoryInternalImageValid(&image, ijk_memory_image_block, block))
+		{
+			// take on identity of saved block
+			ijk_memory_trace_retype(((ijkMemoryPool*)((pchomp)desc - desc->chompOffsetHead)), desc, (flag)image.type);
+			desc->type = (flag)image.type;
+			ijkMemoryBlockSetName(block, image.name);
+
+			// user data following image
+			if (loadCallback_opt)
+				loadCallback_opt(stream, block);
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryBlockSave(kptr const block, ijkStream* const stream, ijkStreamWriteFunc const saveCallback_opt)
+{
+	if (block && stream &&
+		stream->base && !stream->isRead)
+	{
+		ijkMemoryBlock const* const desc = (ijkMemoryBlock*)block - 1;
+		ijkMemoryImage image = { 0 };
+		if (desc->type >= 0)
+		{
+			image.magic = ijk_memory_image_block;
+			image.version = ijk_memory_image_version;
+			image.chompBytes = szchomp;
+			image.chompSize = desc->chompSize;
+			image.checksum = ijkMemoryInternalChecksum((kpchomp)block, desc->chompSize);
+			image.type = desc->type;
+			ijk_copytag(image.name, desc->name);
+			image.name[sztag - 1] = 0;
+			if (ijkStreamWriteElement(stream, &image, 1, szb(image), 0) == ijk_success &&
+				ijkStreamWriteElement(stream, block, 1, desc->chompSize * szchomp, 0) == ijk_success)
+			{
+				// user data following image
+				if (saveCallback_opt)
+					saveCallback_opt(stream, block);
+				return ijk_success;
+			}
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryBlockIsInPool(kptr const block, kptr const pool, ibool* const status_out)
+{
+	if (block && pool && status_out)
+	{
+		ijkMemoryBlock const* const desc = (ijkMemoryBlock*)block - 1;
+		*status_out = (desc == (ijkMemoryBlock*)((kpchomp)pool + desc->chompOffsetHead));
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryBlockGetName(kptr const block, tag name_out)
+{
+	if (block && name_out)
+	{
+		ijkMemoryBlock const* const desc = (ijkMemoryBlock*)block - 1;
+		ijk_copytag(name_out, desc->name);
+		name_out[sztag - 1] = 0;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryBlockSetName(ptr const block, tag const name)
+{
+	if (block && name && *name)
+	{
+		ijkMemoryBlock* const desc = (ijkMemoryBlock*)block - 1;
+		ijkMemoryPool* const desc_pool = (ijkMemoryPool*)((pchomp)desc - desc->chompOffsetHead);
+
+		// name index slot depends on name; re-file reserved block
+		if (desc->type >= 0 && desc_pool->chompOffsetIndex)
+		{
+			ibool const shared = ijkMemoryInternalPoolLockShared(desc_pool);
+			ijkMemoryInternalIndexRemove(desc_pool, desc);
+			ijk_copytag(desc->name, name);
+			desc->name[sztag - 1] = 0;
+			ijkMemoryInternalIndexInsert(desc_pool, desc);
+			if (shared)
+				ijkMemoryInternalPoolUnlock(desc_pool);
+		}
+		else
+		{
+			ijk_copytag(desc->name, name);
+			desc->name[sztag - 1] = 0;
+		}
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryBlockGetType(kptr const block, flag* const type_out)
+{
+	if (block && type_out)
+	{
+		ijkMemoryBlock const* const desc = (ijkMemoryBlock*)block - 1;
+		*type_out = desc->type;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryBlockSetType(ptr const block, flag const type)
 {
 	if (block && type >= 0)
 	{
-		ijkMemoryBlock* const desc = (ijkMemoryBlock*)block - 1;
-		desc->type = type;
+		ijkMemoryBlock* const desc = (ijkMemoryBlock*)block - 1;
+		ijkMemoryPool* const desc_pool = (ijkMemoryPool*)((pchomp)desc - desc->chompOffsetHead);
+		ijk_memory_trace_retype(desc_pool, desc, type);
+		desc->type = type;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryBlockGetSize(kptr const block, size* const size_out)
+{
+	if (block && size_out)
+	{
+		ijkMemoryBlock const* const desc = (ijkMemoryBlock*)block - 1;
+		*size_out = desc->chompSize;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkMemoryArenaCreate(ptr const arena_base, size const baseSize, size const bufferCount, tag const name)
+{
+	if (arena_base && baseSize && bufferCount && name && *name)
+	{
+		if (baseSize > szmemarena)
+		{
+			size const chompSize = (baseSize - szmemarena) / szchomp / bufferCount;
+			if (chompSize)
+			{
+				ijkMemoryArena* const desc = (ijkMemoryArena*)arena_base;
+				ijk_copytag(desc->name, name);
+				desc->name[sztag - 1] = 0;
+				desc->chompSize = chompSize;
+				desc->chompOffsetBuffer = szcmemarena;
+				desc->chompOffsetBottom = desc->chompOffsetBuffer;
+				desc->chompOffsetTop = desc->chompOffsetBuffer + chompSize;
+				desc->bufferCount = bufferCount;
+				desc->bufferIndex = 0;
+				return ijk_success;
+			}
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryArenaRelease(ptr const arena)
+{
+	if (arena)
+	{
+		ijkMemoryArena* const desc = (ijkMemoryArena*)arena;
+		desc->chompOffsetTop = desc->chompOffsetBottom = desc->chompOffsetBuffer;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryArenaReset(ptr const arena)
+{
+	if (arena)
+	{
+		ijkMemoryArena* const desc = (ijkMemoryArena*)arena;
+		if (++desc->bufferIndex == desc->bufferCount)
+			desc->bufferIndex = 0;
+		desc->chompOffsetBuffer = szcmemarena + desc->bufferIndex * desc->chompSize;
+		desc->chompOffsetBottom = desc->chompOffsetBuffer;
+		desc->chompOffsetTop = desc->chompOffsetBuffer + desc->chompSize;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryArenaReserve(ptr const arena, ptr* const block_out, size const blockSize)
+{
+	if (arena && block_out && blockSize &&
+		!*block_out)
+	{
+		ijkMemoryArena* const desc = (ijkMemoryArena*)arena;
+		size const chompSize = ijk_b2c(blockSize);
+		if (chompSize <= desc->chompOffsetTop - desc->chompOffsetBottom)
+		{
+			*block_out = (pchomp)arena + desc->chompOffsetBottom;
+			desc->chompOffsetBottom += chompSize;
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryArenaReserveTop(ptr const arena, ptr* const block_out, size const blockSize)
+{
+	if (arena && block_out && blockSize &&
+		!*block_out)
+	{
+		ijkMemoryArena* const desc = (ijkMemoryArena*)arena;
+		size const chompSize = ijk_b2c(blockSize);
+		if (chompSize <= desc->chompOffsetTop - desc->chompOffsetBottom)
+		{
+			desc->chompOffsetTop -= chompSize;
+			*block_out = (pchomp)arena + desc->chompOffsetTop;
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryArenaGetMarker(kptr const arena, size* const marker_out)
+{
+	if (arena && marker_out)
+	{
+		ijkMemoryArena const* const desc = (ijkMemoryArena*)arena;
+		*marker_out = desc->chompOffsetBottom;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryArenaGetMarkerTop(kptr const arena, size* const marker_out)
+{
+	if (arena && marker_out)
+	{
+		ijkMemoryArena const* const desc = (ijkMemoryArena*)arena;
+		*marker_out = desc->chompOffsetTop;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryArenaRollback(ptr const arena, size const marker)
+{
+	if (arena)
+	{
+		ijkMemoryArena* const desc = (ijkMemoryArena*)arena;
+		if (marker >= desc->chompOffsetBuffer && marker <= desc->chompOffsetBottom)
+		{
+			desc->chompOffsetBottom = marker;
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryArenaRollbackTop(ptr const arena, size const marker)
+{
+	if (arena)
+	{
+		ijkMemoryArena* const desc = (ijkMemoryArena*)arena;
+		if (marker >= desc->chompOffsetTop && marker <= desc->chompOffsetBuffer + desc->chompSize)
+		{
+			desc->chompOffsetTop = marker;
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryArenaGetReserved(kptr const arena, size* const size_out)
+{
+	if (arena && size_out)
+	{
+		ijkMemoryArena const* const desc = (ijkMemoryArena*)arena;
+		*size_out = desc->chompSize - (desc->chompOffsetTop - desc->chompOffsetBottom);
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryArenaGetAvailable(kptr const arena, size* const size_out)
+{
+	if (arena && size_out)
+	{
+		ijkMemoryArena const* const desc = (ijkMemoryArena*)arena;
+		*size_out = desc->chompOffsetTop - desc->chompOffsetBottom;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkMemoryObjectPoolCreate(ptr const objpool_base, size const baseSize, size const objectSize, tag const name)
+{
+	if (objpool_base && baseSize && objectSize && name && *name)
+	{
+		if (baseSize > szmemobjpool)
+		{
+			// each slot costs its own size plus one chomp for its generation
+			size const chompStride = ijk_b2c(objectSize);
+			size capacity = (baseSize - szmemobjpool) / szchomp / (chompStride + 1);
+			if (capacity > ijk_memory_handle_mask)
+				capacity = ijk_memory_handle_mask;
+			if (capacity)
+			{
+				ijkMemoryObjectPool* const desc = (ijkMemoryObjectPool*)objpool_base;
+				ijk_copytag(desc->name, name);
+				desc->name[sztag - 1] = 0;
+				desc->chompStride = chompStride;
+				desc->chompOffsetSlots = szcmemobjpool + capacity;
+				desc->capacity = capacity;
+				desc->count = 0;
+				desc->slotsUsed = 0;
+				desc->slotFree = 0;
+
+				// slots are formatted when first used
+				ijkMemorySetZeroC(desc + 1, capacity);
+				return ijk_success;
+			}
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryObjectPoolRelease(ptr const objpool)
+{
+	if (objpool)
+	{
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryObjectPoolGetCount(kptr const objpool, size* const count_out)
+{
+	if (objpool && count_out)
+	{
+		ijkMemoryObjectPool const* const desc = (ijkMemoryObjectPool*)objpool;
+		*count_out = desc->count;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryObjectPoolGetCapacity(kptr const objpool, size* const count_out)
+{
+	if (objpool && count_out)
+	{
+		ijkMemoryObjectPool const* const desc = (ijkMemoryObjectPool*)objpool;
+		*count_out = desc->capacity;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkMemoryObjectCreate(ijkMemoryHandle* const handle_out, ptr* const object_out_opt, ptr const objpool, ijkMemoryInitCallback const initCallback_opt)
+{
+	if (handle_out && objpool)
+	{
+		ijkMemoryObjectPool* const desc = (ijkMemoryObjectPool*)objpool;
+		size* const generation = (size*)(desc + 1);
+		size index;
+		pchomp object;
+
+		// take most recently released slot, otherwise a fresh one
+		if (desc->slotFree)
+		{
+			index = desc->slotFree - 1;
+			object = (pchomp)objpool + desc->chompOffsetSlots + index * desc->chompStride;
+			desc->slotFree = *object;
+		}
+		else if (desc->slotsUsed < desc->capacity)
+		{
+			index = desc->slotsUsed++;
+			object = (pchomp)objpool + desc->chompOffsetSlots + index * desc->chompStride;
+		}
+		else
+			return ijk_fail_operationfail;
+
+		// odd generation marks slot as reserved
+		++generation[index];
+		++desc->count;
+		if (initCallback_opt)
+			initCallback_opt(object, desc->chompStride);
+
+		// done
+		*handle_out = (generation[index] << ijk_memory_handle_bits) | index;
+		if (object_out_opt)
+			*object_out_opt = object;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryObjectRelease(ijkMemoryHandle const handle, ptr const objpool, ijkMemoryInitCallback const termCallback_opt)
+{
+	if (handle && objpool)
+	{
+		ijkMemoryObjectPool* const desc = (ijkMemoryObjectPool*)objpool;
+		size* const generation = (size*)(desc + 1);
+		size const index = handle & ijk_memory_handle_mask;
+		if (index < desc->slotsUsed &&
+			(generation[index] << ijk_memory_handle_bits) == (handle & ~ijk_memory_handle_mask) &&
+			(generation[index] & 1))
+		{
+			pchomp const object = (pchomp)objpool + desc->chompOffsetSlots + index * desc->chompStride;
+			if (termCallback_opt)
+				termCallback_opt(object, desc->chompStride);
+
+			// even generation marks slot as free; link into free list
+			++generation[index];
+			--desc->count;
+			*object = desc->slotFree;
+			desc->slotFree = index + 1;
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryObjectGet(ptr* const object_out, ijkMemoryHandle const handle, ptr const objpool)
+{
+	if (object_out && handle && objpool)
+	{
+		ijkMemoryObjectPool const* const desc = (ijkMemoryObjectPool*)objpool;
+		size const* const generation = (size*)(desc + 1);
+		size const index = handle & ijk_memory_handle_mask;
+		if (index < desc->slotsUsed &&
+			(generation[index] << ijk_memory_handle_bits) == (handle & ~ijk_memory_handle_mask) &&
+			(generation[index] & 1))
+		{
+			*object_out = (pchomp)objpool + desc->chompOffsetSlots + index * desc->chompStride;
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkMemoryCacheCreate(ptr* const cache_out, ptr const pool)
+{
+	if (cache_out && pool &&
+		!*cache_out)
+	{
+		ijkMemoryPool* const desc_pool = (ijkMemoryPool*)pool;
+		ijkMemoryBlock* block;
+		ijkMemoryCache* desc;
+		uitr i;
+
+		// pool is shared from here on; reserve cache descriptor
+		ijkMemoryInternalPoolLock(desc_pool);
+		ijkAtomicAdd(&desc_pool->cacheCount, 1);
+		block = ijkMemoryInternalBlockReserve(desc_pool, szc(ijkMemoryCache));
+		if (block)
+		{
+			*block->name = 0;
+			block->type = ijk_memory_type_cache;
+		}
+		ijkMemoryInternalPoolUnlock(desc_pool);
+		if (block)
+		{
+			desc = (ijkMemoryCache*)(block + 1);
+			desc->pool = desc_pool;
+			ijkMemorySetZero(desc->loaded, szb(desc->loaded));
+			ijkMemorySetZero(desc->previous, szb(desc->previous));
+
+			// start with empty magazines
+			for (i = 0; i < ijk_memory_cache_count; ++i)
+			{
+				desc->loaded[i] = ijkMemoryInternalMagazineCreate(desc_pool);
+				desc->previous[i] = ijkMemoryInternalMagazineCreate(desc_pool);
+				if (!desc->loaded[i] || !desc->previous[i])
+					break;
+			}
+			if (i == ijk_memory_cache_count)
+			{
+				*cache_out = desc;
+				return ijk_success;
+			}
+
+			// out of space: undo
+			ijkMemoryCacheRelease(desc);
+			return ijk_fail_operationfail;
+		}
+		ijkMemoryInternalPoolLock(desc_pool);
+		ijkAtomicAdd(&desc_pool->cacheCount, ~(size)0);
+		ijkMemoryInternalPoolUnlock(desc_pool);
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryCacheRelease(ptr const cache)
+{
+	if (cache)
+	{
+		ijkMemoryCache* const desc = (ijkMemoryCache*)cache;
+		ijkMemoryPool* const desc_pool = desc->pool;
+		ijkMemoryMagazine* magazine;
+		uitr i;
+
+		// return cached blocks to pool and magazines to depot
+		ijkMemoryInternalPoolLock(desc_pool);
+		for (i = 0; i < ijk_memory_cache_count; ++i)
+		{
+			if (desc->loaded[i])
+			{
+				ijkMemoryInternalMagazineDrain(desc_pool, desc->loaded[i]);
+				ijkMemoryInternalDepotPush(desc_pool, &desc_pool->depotEmpty, desc->loaded[i]);
+			}
+			if (desc->previous[i])
+			{
+				ijkMemoryInternalMagazineDrain(desc_pool, desc->previous[i]);
+				ijkMemoryInternalDepotPush(desc_pool, &desc_pool->depotEmpty, desc->previous[i]);
+			}
+		}
+		ijkMemoryInternalBlockRestore(desc_pool, (ijkMemoryBlock*)desc - 1);
+
+		// last cache: no thread can reach the depot, so empty it
+		if (ijkAtomicAdd(&desc_pool->cacheCount, ~(size)0) == 1)
+		{
+			for (i = 0; i < ijk_memory_cache_count; ++i)
+			{
+				while ((magazine = ijkMemoryInternalDepotPop(desc_pool, desc_pool->depotFull + i)))
+				{
+					ijkMemoryInternalMagazineDrain(desc_pool, magazine);
+					ijkMemoryInternalBlockRestore(desc_pool, (ijkMemoryBlock*)magazine - 1);
+				}
+				desc_pool->depotCount[i] = 0;
+			}
+			while ((magazine = ijkMemoryInternalDepotPop(desc_pool, &desc_pool->depotEmpty)))
+				ijkMemoryInternalBlockRestore(desc_pool, (ijkMemoryBlock*)magazine - 1);
+		}
+		ijkMemoryInternalPoolUnlock(desc_pool);
 		return ijk_success;
 	}
 	return ijk_fail_invalidparams;
 }
 
 
-iret ijkMemoryBlockGetSize(kptr const block, size* const size_out)
+iret ijkMemoryCacheBlockCreate(ptr* const block_out, size const blockSize, ptr const cache)
 {
-	if (block && size_out)
+	if (block_out && blockSize && cache &&
+		!*block_out)
 	{
-		ijkMemoryBlock const* const desc = (ijkMemoryBlock*)block - 1;
-		*size_out = desc->chompSize;
+		ijkMemoryCache* const desc = (ijkMemoryCache*)cache;
+		ijkMemoryPool* const desc_pool = desc->pool;
+		size const chompSize = ijk_b2c(blockSize);
+		size const sizeClass = (chompSize > 1 ? ijkMemoryInternalBitHigh(chompSize - 1) + 1 : 0);
+		ijkMemoryMagazine* magazine;
+		ijkMemoryBlock* block;
+
+		// small blocks: take from loaded magazine
+		if (sizeClass < ijk_memory_cache_count)
+		{
+			magazine = desc->loaded[sizeClass];
+			if (!magazine->count)
+			{
+				if (!ijkMemoryInternalCacheRefill(desc, sizeClass))
+					return ijk_fail_operationfail;
+				magazine = desc->loaded[sizeClass];
+			}
+			*block_out = ijk_memory_block(desc_pool, magazine->chompOffsetBlock[--magazine->count]) + 1;
+			return ijk_success;
+		}
+
+		// large blocks: reserve directly
+		ijkMemoryInternalPoolLock(desc_pool);
+		block = ijkMemoryInternalBlockReserve(desc_pool, chompSize);
+		if (block)
+		{
+			*block->name = 0;
+			block->type = ijk_memory_type_cache;
+		}
+		ijkMemoryInternalPoolUnlock(desc_pool);
+		if (block)
+		{
+			*block_out = (block + 1);
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryCacheBlockRelease(ptr const block, ptr const cache)
+{
+	if (block && cache)
+	{
+		ijkMemoryCache* const desc = (ijkMemoryCache*)cache;
+		ijkMemoryPool* const desc_pool = desc->pool;
+		ijkMemoryBlock* const desc_block = (ijkMemoryBlock*)block - 1;
+		ijkMemoryMagazine* magazine;
+		size sizeClass;
+		if (desc_block == ijk_memory_block(desc_pool, desc_block->chompOffsetHead) && desc_block->type == ijk_memory_type_cache)
+		{
+			// small blocks: return to loaded magazine
+			//	note: any block fits the class of its size rounded down
+			sizeClass = ijkMemoryInternalBitHigh(desc_block->chompSize);
+			if (sizeClass < ijk_memory_cache_count)
+			{
+				magazine = desc->loaded[sizeClass];
+				if (magazine->count == ijk_memory_magazine_count)
+				{
+					if (ijkMemoryInternalCacheDrain(desc, sizeClass))
+						magazine = desc->loaded[sizeClass];
+					else
+						magazine = 0;
+				}
+				if (magazine)
+				{
+					magazine->chompOffsetBlock[magazine->count++] = desc_block->chompOffsetHead;
+					return ijk_success;
+				}
+			}
+
+			// large blocks, or no magazine to hold block: release directly
+			ijkMemoryInternalPoolLock(desc_pool);
+			ijkMemoryInternalBlockRestore(desc_pool, desc_block);
+			ijkMemoryInternalPoolUnlock(desc_pool);
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// ijk_memory_stream
+//	Size in bytes at which stores bypass the cache; blocks this large would 
+//	only evict everything else on their way through.
+#define ijk_memory_stream				(1 << 22)
+
+
+// vector implementation functions
+typedef ptr(*ijkMemorySetFunc)(ptr const dst, size const sz_bytes, chomp pattern);
+typedef ptr(*ijkMemoryCopyFunc)(ptr const dst, kptr const src, size const sz_bytes);
+typedef ptrdiff(*ijkMemoryCompareFunc)(kptr const dst, kptr const src, size const sz_bytes);
+
+
+// rotate pattern so that it begins a number of bytes later
+ijk_inl chomp ijkMemoryInternalPatternAdvance(chomp const pattern, size const sz_bytes)
+{
+	size const shift = (sz_bytes % szchomp) * 8;
+	return (shift ? ((pattern >> shift) | (pattern << (__ijk_cfg_archbits - shift))) : pattern);
+}
+
+
+// set bytes one at a time from pattern
+ijk_inl chomp ijkMemoryInternalSetBytes(pbyte dst, kpbyte const end, chomp pattern)
+{
+	while (dst < end)
+	{
+		*(dst++) = (byte)pattern;
+		pattern = ijkMemoryInternalPatternAdvance(pattern, 1);
+	}
+	return pattern;
+}
+
+
+// scalar: same as inline versions
+ijk_inl ptr ijkMemoryInternalSetScalar(ptr const dst, size const sz_bytes, chomp const pattern)
+{
+	pchomp dst_chomp = (pchomp)dst;
+	kpchomp const end_chomp = dst_chomp + sz_bytes / szchomp;
+	ijk_memory_set(dst_chomp, end_chomp, pattern);
+	ijkMemoryInternalSetBytes((pbyte)dst_chomp, (pbyte)dst + sz_bytes, pattern);
+	return dst;
+}
+
+
+ijk_inl ptr ijkMemoryInternalCopyScalar(ptr const dst, kptr const src, size const sz_bytes)
+{
+	pchomp dst_chomp = (pchomp)dst;
+	kpchomp src_chomp = (pchomp)src;
+	pbyte dst_byte;
+	kpbyte src_byte;
+	kpchomp const end_chomp = dst_chomp + sz_bytes / szchomp;
+	kpbyte const end_byte = (pbyte)dst + sz_bytes;
+	ijk_memory_copy(dst_chomp, src_chomp, end_chomp);
+	dst_byte = (pbyte)dst_chomp;
+	src_byte = (pbyte)src_chomp;
+	ijk_memory_copy(dst_byte, src_byte, end_byte);
+	return dst;
+}
+
+
+ijk_inl ptrdiff ijkMemoryInternalCompareScalar(kptr const dst, kptr const src, size const sz_bytes)
+{
+	kpchomp dst_chomp = (pchomp)dst;
+	kpchomp src_chomp = (pchomp)src;
+	kpbyte dst_byte;
+	kpbyte src_byte;
+	kpchomp const end_chomp = dst_chomp + sz_bytes / szchomp;
+	kpbyte const end_byte = (pbyte)dst + sz_bytes;
+	ijk_memory_compare(dst_chomp, src_chomp, end_chomp);
+	dst_byte = (pbyte)dst_chomp;
+	src_byte = (pbyte)src_chomp;
+	ijk_memory_compare(dst_byte, src_byte, end_byte);
+	return (dst_byte - (pbyte)dst);
+}
+
+
+// fill vectors with chomp pattern
+#if (__ijk_cfg_archbits == 64)
+#define ijk_memory_pattern_sse2(pattern)	_mm_set1_epi64x((i64)(pattern))
+#define ijk_memory_pattern_avx2(pattern)	_mm256_set1_epi64x((i64)(pattern))
+#else	// !64
+#define ijk_memory_pattern_sse2(pattern)	_mm_set1_epi32((i32)(pattern))
+#define ijk_memory_pattern_avx2(pattern)	_mm256_set1_epi32((i32)(pattern))
+#endif	// 64
+
+
+// SSE2: one unaligned vector at each end, aligned vectors in between; copy 
+//	loads both ends first and stores them last, and the middle is done in 
+//	ascending order, so moving to a preceding overlapping block is safe
+ijk_memory_target_sse2 ijk_inl ptr ijkMemoryInternalSetSSE2(ptr const dst, size const sz_bytes, chomp const pattern)
+{
+	pbyte dst_byte = (pbyte)dst, end_vec;
+	kpbyte const end_byte = dst_byte + sz_bytes;
+	size const head = (0 - (size)dst_byte) & 15;
+	__m128i value;
+
+	if (sz_bytes < 16)
+		return ijkMemoryInternalSetScalar(dst, sz_bytes, pattern);
+
+	// ends, with pattern rotated to where they land
+	_mm_storeu_si128((__m128i*)dst_byte, ijk_memory_pattern_sse2(pattern));
+	_mm_storeu_si128((__m128i*)(end_byte - 16), ijk_memory_pattern_sse2(ijkMemoryInternalPatternAdvance(pattern, sz_bytes - 16)));
+
+	// body four vectors at a time, streamed if large
+	dst_byte += head;
+	value = ijk_memory_pattern_sse2(ijkMemoryInternalPatternAdvance(pattern, head));
+	end_vec = dst_byte + ((end_byte - dst_byte) & ~(ptrdiff)63);
+	if (sz_bytes >= ijk_memory_stream)
+	{
+		for (; dst_byte < end_vec; dst_byte += 64)
+		{
+			_mm_stream_si128((__m128i*)dst_byte + 0, value);
+			_mm_stream_si128((__m128i*)dst_byte + 1, value);
+			_mm_stream_si128((__m128i*)dst_byte + 2, value);
+			_mm_stream_si128((__m128i*)dst_byte + 3, value);
+		}
+		_mm_sfence();
+	}
+	else for (; dst_byte < end_vec; dst_byte += 64)
+	{
+		_mm_store_si128((__m128i*)dst_byte + 0, value);
+		_mm_store_si128((__m128i*)dst_byte + 1, value);
+		_mm_store_si128((__m128i*)dst_byte + 2, value);
+		_mm_store_si128((__m128i*)dst_byte + 3, value);
+	}
+	end_vec = dst_byte + ((end_byte - dst_byte) & ~(ptrdiff)15);
+	for (; dst_byte < end_vec; dst_byte += 16)
+		_mm_store_si128((__m128i*)dst_byte, value);
+	return dst;
+}
+
+
+ijk_memory_target_sse2 ijk_inl ptr ijkMemoryInternalCopySSE2(ptr const dst, kptr const src, size const sz_bytes)
+{
+	pbyte dst_byte = (pbyte)dst, end_vec;
+	kpbyte src_byte = (pbyte)src;
+	kpbyte const end_byte = dst_byte + sz_bytes;
+	size const head = (0 - (size)dst_byte) & 15;
+	__m128i v0, v1, v2, v3, first, last;
+
+	if (sz_bytes < 16)
+		return ijkMemoryInternalCopyScalar(dst, src, sz_bytes);
+
+	// ends
+	first = _mm_loadu_si128((__m128i const*)src_byte);
+	last = _mm_loadu_si128((__m128i const*)(src_byte + sz_bytes - 16));
+
+	// body four vectors at a time, streamed if large
+	dst_byte += head;
+	src_byte += head;
+	end_vec = dst_byte + ((end_byte - dst_byte) & ~(ptrdiff)63);
+	if (sz_bytes >= ijk_memory_stream)
+	{
+		for (; dst_byte < end_vec; dst_byte += 64, src_byte += 64)
+		{
+			v0 = _mm_loadu_si128((__m128i const*)src_byte + 0);
+			v1 = _mm_loadu_si128((__m128i const*)src_byte + 1);
+			v2 = _mm_loadu_si128((__m128i const*)src_byte + 2);
+			v3 = _mm_loadu_si128((__m128i const*)src_byte + 3);
+			_mm_stream_si128((__m128i*)dst_byte + 0, v0);
+			_mm_stream_si128((__m128i*)dst_byte + 1, v1);
+			_mm_stream_si128((__m128i*)dst_byte + 2, v2);
+			_mm_stream_si128((__m128i*)dst_byte + 3, v3);
+		}
+		_mm_sfence();
+	}
+	else for (; dst_byte < end_vec; dst_byte += 64, src_byte += 64)
+	{
+		v0 = _mm_loadu_si128((__m128i const*)src_byte + 0);
+		v1 = _mm_loadu_si128((__m128i const*)src_byte + 1);
+		v2 = _mm_loadu_si128((__m128i const*)src_byte + 2);
+		v3 = _mm_loadu_si128((__m128i const*)src_byte + 3);
+		_mm_store_si128((__m128i*)dst_byte + 0, v0);
+		_mm_store_si128((__m128i*)dst_byte + 1, v1);
+		_mm_store_si128((__m128i*)dst_byte + 2, v2);
+		_mm_store_si128((__m128i*)dst_byte + 3, v3);
+	}
+	end_vec = dst_byte + ((end_byte - dst_byte) & ~(ptrdiff)15);
+	for (; dst_byte < end_vec; dst_byte += 16, src_byte += 16)
+		_mm_store_si128((__m128i*)dst_byte, _mm_loadu_si128((__m128i const*)src_byte));
+
+	_mm_storeu_si128((__m128i*)dst, first);
+	_mm_storeu_si128((__m128i*)(end_byte - 16), last);
+	return dst;
+}
+
+
+ijk_memory_target_sse2 ijk_inl ptrdiff ijkMemoryInternalCompareSSE2(kptr const dst, kptr const src, size const sz_bytes)
+{
+	kpbyte dst_byte = (pbyte)dst, src_byte = (pbyte)src;
+	kpbyte const end_byte = dst_byte + sz_bytes;
+	kpbyte const end_vec = dst_byte + (sz_bytes & ~(size)15);
+	kpbyte const end_vec4 = dst_byte + (sz_bytes & ~(size)63);
+	__m128i eq01, eq23;
+	size mask;
+
+	// four vectors at a time until any difference
+	for (; dst_byte < end_vec4; dst_byte += 64, src_byte += 64)
+	{
+		eq01 = _mm_and_si128(
+			_mm_cmpeq_epi8(_mm_loadu_si128((__m128i const*)dst_byte + 0), _mm_loadu_si128((__m128i const*)src_byte + 0)),
+			_mm_cmpeq_epi8(_mm_loadu_si128((__m128i const*)dst_byte + 1), _mm_loadu_si128((__m128i const*)src_byte + 1)));
+		eq23 = _mm_and_si128(
+			_mm_cmpeq_epi8(_mm_loadu_si128((__m128i const*)dst_byte + 2), _mm_loadu_si128((__m128i const*)src_byte + 2)),
+			_mm_cmpeq_epi8(_mm_loadu_si128((__m128i const*)dst_byte + 3), _mm_loadu_si128((__m128i const*)src_byte + 3)));
+		if (_mm_movemask_epi8(_mm_and_si128(eq01, eq23)) != 0xFFFF)
+			break;
+	}
+
+	// byte mask of equality; first cleared bit is first difference
+	for (; dst_byte < end_vec; dst_byte += 16, src_byte += 16)
+	{
+		mask = (size)_mm_movemask_epi8(_mm_cmpeq_epi8(
+			_mm_loadu_si128((__m128i const*)dst_byte), _mm_loadu_si128((__m128i const*)src_byte)));
+		if (mask != 0xFFFF)
+			return (dst_byte - (pbyte)dst + ijkMemoryInternalBitLow(~mask & 0xFFFF));
+	}
+	ijk_memory_compare(dst_byte, src_byte, end_byte);
+	return (dst_byte - (pbyte)dst);
+}
+
+
+// AVX2: same as SSE2 with twice the width
+ijk_memory_target_avx2 ijk_inl ptr ijkMemoryInternalSetAVX2(ptr const dst, size const sz_bytes, chomp const pattern)
+{
+	pbyte dst_byte = (pbyte)dst, end_vec;
+	kpbyte const end_byte = dst_byte + sz_bytes;
+	size const head = (0 - (size)dst_byte) & 31;
+	__m256i value;
+
+	if (sz_bytes < 32)
+		return ijkMemoryInternalSetScalar(dst, sz_bytes, pattern);
+
+	_mm256_storeu_si256((__m256i*)dst_byte, ijk_memory_pattern_avx2(pattern));
+	_mm256_storeu_si256((__m256i*)(end_byte - 32), ijk_memory_pattern_avx2(ijkMemoryInternalPatternAdvance(pattern, sz_bytes - 32)));
+
+	dst_byte += head;
+	value = ijk_memory_pattern_avx2(ijkMemoryInternalPatternAdvance(pattern, head));
+	end_vec = dst_byte + ((end_byte - dst_byte) & ~(ptrdiff)127);
+	if (sz_bytes >= ijk_memory_stream)
+	{
+		for (; dst_byte < end_vec; dst_byte += 128)
+		{
+			_mm256_stream_si256((__m256i*)dst_byte + 0, value);
+			_mm256_stream_si256((__m256i*)dst_byte + 1, value);
+			_mm256_stream_si256((__m256i*)dst_byte + 2, value);
+			_mm256_stream_si256((__m256i*)dst_byte + 3, value);
+		}
+		_mm_sfence();
+	}
+	else for (; dst_byte < end_vec; dst_byte += 128)
+	{
+		_mm256_store_si256((__m256i*)dst_byte + 0, value);
+		_mm256_store_si256((__m256i*)dst_byte + 1, value);
+		_mm256_store_si256((__m256i*)dst_byte + 2, value);
+		_mm256_store_si256((__m256i*)dst_byte + 3, value);
+	}
+	end_vec = dst_byte + ((end_byte - dst_byte) & ~(ptrdiff)31);
+	for (; dst_byte < end_vec; dst_byte += 32)
+		_mm256_store_si256((__m256i*)dst_byte, value);
+	_mm256_zeroupper();
+	return dst;
+}
+
+
+ijk_memory_target_avx2 ijk_inl ptr ijkMemoryInternalCopyAVX2(ptr const dst, kptr const src, size const sz_bytes)
+{
+	pbyte dst_byte = (pbyte)dst, end_vec;
+	kpbyte src_byte = (pbyte)src;
+	kpbyte const end_byte = dst_byte + sz_bytes;
+	size const head = (0 - (size)dst_byte) & 31;
+	__m256i v0, v1, v2, v3, first, last;
+
+	if (sz_bytes < 32)
+		return ijkMemoryInternalCopyScalar(dst, src, sz_bytes);
+
+	first = _mm256_loadu_si256((__m256i const*)src_byte);
+	last = _mm256_loadu_si256((__m256i const*)(src_byte + sz_bytes - 32));
+
+	dst_byte += head;
+	src_byte += head;
+	end_vec = dst_byte + ((end_byte - dst_byte) & ~(ptrdiff)127);
+	if (sz_bytes >= ijk_memory_stream)
+	{
+		for (; dst_byte < end_vec; dst_byte += 128, src_byte += 128)
+		{
+			v0 = _mm256_loadu_si256((__m256i const*)src_byte + 0);
+			v1 = _mm256_loadu_si256((__m256i const*)src_byte + 1);
+			v2 = _mm256_loadu_si256((__m256i const*)src_byte + 2);
+			v3 = _mm256_loadu_si256((__m256i const*)src_byte + 3);
+			_mm256_stream_si256((__m256i*)dst_byte + 0, v0);
+			_mm256_stream_si256((__m256i*)dst_byte + 1, v1);
+			_mm256_stream_si256((__m256i*)dst_byte + 2, v2);
+			_mm256_stream_si256((__m256i*)dst_byte + 3, v3);
+		}
+		_mm_sfence();
+	}
+	else for (; dst_byte < end_vec; dst_byte += 128, src_byte += 128)
+	{
+		v0 = _mm256_loadu_si256((__m256i const*)src_byte + 0);
+		v1 = _mm256_loadu_si256((__m256i const*)src_byte + 1);
+		v2 = _mm256_loadu_si256((__m256i const*)src_byte + 2);
+		v3 = _mm256_loadu_si256((__m256i const*)src_byte + 3);
+		_mm256_store_si256((__m256i*)dst_byte + 0, v0);
+		_mm256_store_si256((__m256i*)dst_byte + 1, v1);
+		_mm256_store_si256((__m256i*)dst_byte + 2, v2);
+		_mm256_store_si256((__m256i*)dst_byte + 3, v3);
+	}
+	end_vec = dst_byte + ((end_byte - dst_byte) & ~(ptrdiff)31);
+	for (; dst_byte < end_vec; dst_byte += 32, src_byte += 32)
+		_mm256_store_si256((__m256i*)dst_byte, _mm256_loadu_si256((__m256i const*)src_byte));
+
+	_mm256_storeu_si256((__m256i*)dst, first);
+	_mm256_storeu_si256((__m256i*)(end_byte - 32), last);
+	_mm256_zeroupper();
+	return dst;
+}
+
+
+ijk_memory_target_avx2 ijk_inl ptrdiff ijkMemoryInternalCompareAVX2(kptr const dst, kptr const src, size const sz_bytes)
+{
+	kpbyte dst_byte = (pbyte)dst, src_byte = (pbyte)src;
+	kpbyte const end_byte = dst_byte + sz_bytes;
+	kpbyte const end_vec = dst_byte + (sz_bytes & ~(size)31);
+	kpbyte const end_vec4 = dst_byte + (sz_bytes & ~(size)127);
+	__m256i eq01, eq23;
+	size mask;
+
+	for (; dst_byte < end_vec4; dst_byte += 128, src_byte += 128)
+	{
+		eq01 = _mm256_and_si256(
+			_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i const*)dst_byte + 0), _mm256_loadu_si256((__m256i const*)src_byte + 0)),
+			_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i const*)dst_byte + 1), _mm256_loadu_si256((__m256i const*)src_byte + 1)));
+		eq23 = _mm256_and_si256(
+			_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i const*)dst_byte + 2), _mm256_loadu_si256((__m256i const*)src_byte + 2)),
+			_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i const*)dst_byte + 3), _mm256_loadu_si256((__m256i const*)src_byte + 3)));
+		if (_mm256_movemask_epi8(_mm256_and_si256(eq01, eq23)) != -1)
+			break;
+	}
+
+	for (; dst_byte < end_vec; dst_byte += 32, src_byte += 32)
+	{
+		mask = (size)(dword)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+			_mm256_loadu_si256((__m256i const*)dst_byte), _mm256_loadu_si256((__m256i const*)src_byte)));
+		if (mask != 0xFFFFFFFF)
+		{
+			_mm256_zeroupper();
+			return (dst_byte - (pbyte)dst + ijkMemoryInternalBitLow(~mask & 0xFFFFFFFF));
+		}
+	}
+	_mm256_zeroupper();
+	ijk_memory_compare(dst_byte, src_byte, end_byte);
+	return (dst_byte - (pbyte)dst);
+}
+
+
+// query processor: function leaf, extended state enabled by system
+ijk_inl void ijkMemoryInternalCPUID(i32 info[4], i32 const leaf)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	__cpuidex(info, leaf, 0);
+#else	// !WINDOWS
+	__cpuid_count(leaf, 0, info[0], info[1], info[2], info[3]);
+#endif	// WINDOWS
+}
+
+
+ijk_inl qword ijkMemoryInternalXGETBV()
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	return _xgetbv(0);
+#else	// !WINDOWS
+	dword lo, hi;
+	__asm__ volatile ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+	return (((qword)hi << 32) | lo);
+#endif	// WINDOWS
+}
+
+
+// best instruction set supported by processor and system
+ijk_inl ijkMemoryVector ijkMemoryInternalVectorSupported()
+{
+	ijkMemoryVector vector = ijkMemoryVector_scalar;
+	i32 info[4] = { 0 }, leafCount;
+	ijkMemoryInternalCPUID(info, 0);
+	leafCount = info[0];
+	if (leafCount >= 1)
+	{
+		ijkMemoryInternalCPUID(info, 1);
+		if (info[3] & (1 << 26))
+			vector = ijkMemoryVector_sse2;
+
+		// AVX registers must also be saved by system (OSXSAVE, XCR0 bits 1-2)
+		if ((info[2] & (1 << 27)) && (info[2] & (1 << 28)) &&
+			(ijkMemoryInternalXGETBV() & 0x6) == 0x6 && leafCount >= 7)
+		{
+			ijkMemoryInternalCPUID(info, 7);
+			if (info[1] & (1 << 5))
+				vector = ijkMemoryVector_avx2;
+		}
+	}
+	return vector;
+}
+
+
+// dispatch: starts at resolvers, which replace themselves on first call
+static ptr ijkMemoryInternalSetResolve(ptr const dst, size const sz_bytes, chomp const pattern);
+static ptr ijkMemoryInternalCopyResolve(ptr const dst, kptr const src, size const sz_bytes);
+static ptrdiff ijkMemoryInternalCompareResolve(kptr const dst, kptr const src, size const sz_bytes);
+static ijkMemoryVector ijk_memory_vector_supported = ijkMemoryVector_scalar, ijk_memory_vector_selected = ijkMemoryVector_scalar;
+static ijkMemorySetFunc ijk_memory_set_func = ijkMemoryInternalSetResolve;
+static ijkMemoryCopyFunc ijk_memory_copy_func = ijkMemoryInternalCopyResolve;
+static ijkMemoryCompareFunc ijk_memory_compare_func = ijkMemoryInternalCompareResolve;
+
+
+// install functions for instruction set
+ijk_inl void ijkMemoryInternalVectorSelect(ijkMemoryVector const vector)
+{
+	ijkMemorySetFunc const setFunc[] = { ijkMemoryInternalSetScalar, ijkMemoryInternalSetSSE2, ijkMemoryInternalSetAVX2 };
+	ijkMemoryCopyFunc const copyFunc[] = { ijkMemoryInternalCopyScalar, ijkMemoryInternalCopySSE2, ijkMemoryInternalCopyAVX2 };
+	ijkMemoryCompareFunc const compareFunc[] = { ijkMemoryInternalCompareScalar, ijkMemoryInternalCompareSSE2, ijkMemoryInternalCompareAVX2 };
+	ijk_memory_vector_selected = vector;
+	ijk_memory_set_func = setFunc[vector];
+	ijk_memory_copy_func = copyFunc[vector];
+	ijk_memory_compare_func = compareFunc[vector];
+}
+
+
+// detect once; racing threads all arrive at the same result
+ijk_inl void ijkMemoryInternalVectorResolve()
+{
+	ijk_memory_vector_supported = ijkMemoryInternalVectorSupported();
+	ijkMemoryInternalVectorSelect(ijk_memory_vector_supported);
+}
+
+
+static ptr ijkMemoryInternalSetResolve(ptr const dst, size const sz_bytes, chomp const pattern)
+{
+	ijkMemoryInternalVectorResolve();
+	return ijk_memory_set_func(dst, sz_bytes, pattern);
+}
+
+
+static ptr ijkMemoryInternalCopyResolve(ptr const dst, kptr const src, size const sz_bytes)
+{
+	ijkMemoryInternalVectorResolve();
+	return ijk_memory_copy_func(dst, src, sz_bytes);
+}
+
+
+static ptrdiff ijkMemoryInternalCompareResolve(kptr const dst, kptr const src, size const sz_bytes)
+{
+	ijkMemoryInternalVectorResolve();
+	return ijk_memory_compare_func(dst, src, sz_bytes);
+}
+
+
+//-----------------------------------------------------------------------------
+
+ptr ijkMemorySetWide(ptr const dst, size const sz_bytes, chomp const pattern)
+{
+	if (dst && sz_bytes)
+		return ijk_memory_set_func(dst, sz_bytes, pattern);
+	return 0;
+}
+
+
+ptr ijkMemoryCopyWide(ptr const dst, kptr const src, size const sz_bytes)
+{
+	if (dst && src && sz_bytes)
+		return ijk_memory_copy_func(dst, src, sz_bytes);
+	return 0;
+}
+
+
+ptrdiff ijkMemoryCompareWide(kptr const dst, kptr const src, size const sz_bytes)
+{
+	if (dst && src && sz_bytes)
+		return ijk_memory_compare_func(dst, src, sz_bytes);
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMemoryGetVector(ijkMemoryVector* const supported_out_opt, ijkMemoryVector* const selected_out_opt)
+{
+	if (supported_out_opt || selected_out_opt)
+	{
+		if (ijk_memory_set_func == ijkMemoryInternalSetResolve)
+			ijkMemoryInternalVectorResolve();
+		if (supported_out_opt)
+			*supported_out_opt = ijk_memory_vector_supported;
+		if (selected_out_opt)
+			*selected_out_opt = ijk_memory_vector_selected;
 		return ijk_success;
 	}
 	return ijk_fail_invalidparams;
 }
 
 
+iret ijkMemorySelectVector(ijkMemoryVector const vector)
+{
+	if (vector >= ijkMemoryVector_scalar && vector <= ijkMemoryVector_avx2)
+	{
+		if (ijk_memory_set_func == ijkMemoryInternalSetResolve)
+			ijkMemoryInternalVectorResolve();
+		if (vector <= ijk_memory_vector_supported)
+		{
+			ijkMemoryInternalVectorSelect(vector);
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
 //-----------------------------------------------------------------------------
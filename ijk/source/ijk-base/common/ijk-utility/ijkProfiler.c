@@ -0,0 +1,623 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkProfiler.c
+	Instrumentation profiler implementation.
+*/
+
+#include "ijk/ijk-base/ijk-utility/ijkProfiler.h"
+#include "ijk/ijk-base/ijk-utility/ijkThread.h"
+#include "ijk/ijk-base/ijk-utility/ijkMemory.h"
+#include "ijk/ijk-base/ijk-utility/ijkTimer.h"
+
+
+// thread-local storage
+#if (__ijk_cfg_platform == WINDOWS)
+#define ijk_profiler_local	__declspec(thread)
+#else	// !WINDOWS
+#define ijk_profiler_local	__thread
+#endif	// WINDOWS
+
+
+//-----------------------------------------------------------------------------
+
+// profiler magic word ("ijkProfr")
+#define ijk_profiler_magic		0x72666F72506B6A69ull
+
+// cache line size for padding shared indices
+#define ijk_profiler_line		64
+
+// minimum number of events per thread buffer
+#define ijk_profiler_min		16
+
+// binary name table slots; index of a name is its slot
+#define ijk_profiler_names		1024
+
+// binary name index redefined for each name once table is full
+#define ijk_profiler_overflow	0xFFFFFFFF
+
+// flush staging size in bytes
+#define ijk_profiler_chunk		4096
+
+
+typedef struct ijkProfilerEvent		ijkProfilerEvent;
+typedef struct ijkProfilerBuffer	ijkProfilerBuffer;
+typedef struct ijkProfiler			ijkProfiler;
+typedef struct ijkProfilerWriter	ijkProfilerWriter;
+
+
+// event: begin if named, end if not
+struct ijkProfilerEvent
+{
+	qword time;						// ticks
+	kcstr name;						// scope name or null
+};
+
+
+// thread buffer; a ring with the owning thread as its only producer and
+//	flush as its only consumer, like an spsc queue
+struct ijkProfilerBuffer
+{
+	ijkProfilerEvent* event;		// ring
+	size mask;						// capacity - 1
+	dword id;						// system ID of owning thread
+	dword volatile ready;			// claimed and identified
+	size reported;					// drops reported (flush)
+	tag name;						// owning thread name
+	ibool named;					// name written (flush)
+	byte pad_meta[ijk_profiler_line];
+	size volatile write;			// next position to record (owner)
+	size readCache;					// last read seen by owner
+	size skip;						// depth of dropped scopes (owner)
+	size volatile dropped;			// events dropped (owner)
+	byte pad_write[ijk_profiler_line];
+	size volatile read;				// next position to flush (flush)
+	byte pad_read[ijk_profiler_line];
+};
+
+
+// profiler header
+struct ijkProfiler
+{
+	qword magic;					// validation word
+	qword t0;						// ticks at creation
+	qword freq;						// ticks per second
+	size threadCount;				// number of buffers
+	ijkProfilerBuffer* buffer;		// first buffer, line-aligned
+	kcstr* name;					// binary name table
+	size nameCount;					// binary names defined
+	size eventCount;				// json events written
+	size claimReported;				// claims past threadCount reported
+	ibool started;					// header written
+	ijkMutex flush[1];				// serializes flushes
+	byte pad_header[ijk_profiler_line];
+	size volatile claimed;			// buffers claimed, or attempted
+	byte pad_claimed[ijk_profiler_line];
+};
+
+
+// flush staging, written to stream when full
+struct ijkProfilerWriter
+{
+	ijkStream* stream;				// output
+	size length;					// staged bytes
+	iret result;					// first failure
+	byte data[ijk_profiler_chunk];	// staged output
+};
+
+
+//-----------------------------------------------------------------------------
+
+dword ijkThreadInternalGetSysID();
+
+
+// active profiler, and generation (changes with each create or release)
+//	against which threads check their buffer, so that they never touch a 
+//	stale one
+static size volatile ijkProfilerInternalInstance;
+static size volatile ijkProfilerInternalGeneration;
+
+// calling thread's buffer and generation it was claimed in
+static ijk_profiler_local ijkProfilerBuffer* ijkProfilerInternalBuffer;
+static ijk_profiler_local size ijkProfilerInternalBufferGeneration;
+
+
+// internal validation
+ijk_inl ijkProfiler* ijkProfilerInternalProfiler(kptr const profiler)
+{
+	ijkProfiler* const p = (ijkProfiler*)profiler;
+	return (p && p->magic == ijk_profiler_magic) ? p : 0;
+}
+
+
+// internal claim of calling thread's buffer from active profiler
+ijkProfilerBuffer* ijkProfilerInternalClaim()
+{
+	tag const name = "thread";
+	ijkThread const* thread;
+	ijkProfilerBuffer* buffer = 0;
+	ijkProfiler* p;
+	size generation, index;
+
+	// instance and generation must match
+	do
+	{
+		generation = ijkAtomicLoad(&ijkProfilerInternalGeneration);
+		p = (ijkProfiler*)ijkAtomicLoad(&ijkProfilerInternalInstance);
+	} while (generation != ijkAtomicLoad(&ijkProfilerInternalGeneration));
+
+	if (p)
+	{
+		index = ijkAtomicAdd(&p->claimed, 1);
+		if (index < p->threadCount)
+		{
+			buffer = p->buffer + index;
+			buffer->id = ijkThreadInternalGetSysID();
+			if (ijk_issuccess(ijkThreadGetCurrent(&thread)) && *thread->name)
+			{
+				ijk_copytag(buffer->name, thread->name);
+			}
+			else
+			{
+				ijk_copytag(buffer->name, name);
+			}
+			ijkAtomicStoreD(&buffer->ready, ijk_true);
+		}
+	}
+	ijkProfilerInternalBuffer = buffer;
+	ijkProfilerInternalBufferGeneration = generation;
+	return buffer;
+}
+
+
+// internal calling thread's buffer
+ijk_inl ijkProfilerBuffer* ijkProfilerInternalGetBuffer()
+{
+	if (ijkProfilerInternalBufferGeneration == ijkProfilerInternalGeneration)
+		return ijkProfilerInternalBuffer;
+	return ijkProfilerInternalClaim();
+}
+
+
+// internal record; only the owning thread writes
+ijk_inl iret ijkProfilerInternalRecord(ijkProfilerBuffer* const buffer, kcstr const name)
+{
+	size const w = buffer->write;
+
+	// refresh read only when cached copy says buffer is full
+	if (w - buffer->readCache > buffer->mask)
+		buffer->readCache = ijkAtomicLoad(&buffer->read);
+	if (w - buffer->readCache <= buffer->mask)
+	{
+		ijkProfilerEvent* const event = buffer->event + (w & buffer->mask);
+		event->time = ijkTimerNow();
+		event->name = name;
+
+		// event must be visible before write
+		ijkAtomicStore(&buffer->write, w + 1);
+		return ijk_success;
+	}
+	ijkAtomicStore(&buffer->dropped, buffer->dropped + 1);
+	return ijk_warn_profiler_dropped;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// internal staging
+void ijkProfilerInternalPut(ijkProfilerWriter* const w, kptr const data, size count)
+{
+	kpbyte src = (kpbyte)data;
+	size part;
+	while (count)
+	{
+		part = ijk_profiler_chunk - w->length;
+		part = count < part ? count : part;
+		ijkMemoryCopy(w->data + w->length, src, part);
+		w->length += part;
+		src += part;
+		count -= part;
+		if (w->length == ijk_profiler_chunk)
+		{
+			if (!ijk_issuccess(ijkStreamWriteElement(w->stream, w->data, 1, w->length, 0)))
+				w->result = ijk_fail_operationfail;
+			w->length = 0;
+		}
+	}
+}
+
+
+// internal staging of remaining output
+void ijkProfilerInternalDrain(ijkProfilerWriter* const w)
+{
+	if (w->length)
+	{
+		if (!ijk_issuccess(ijkStreamWriteElement(w->stream, w->data, 1, w->length, 0)))
+			w->result = ijk_fail_operationfail;
+		w->length = 0;
+	}
+}
+
+
+// internal staging of c-string
+void ijkProfilerInternalPutString(ijkProfilerWriter* const w, kcstr const str)
+{
+	size count = 0;
+	while (str[count])
+		++count;
+	ijkProfilerInternalPut(w, str, count);
+}
+
+
+// internal staging of c-string escaped for json
+void ijkProfilerInternalPutEscaped(ijkProfilerWriter* const w, kcstr str)
+{
+	byte const hex[] = "0123456789abcdef";
+	byte escape[6] = { '\\', 'u', '0', '0' };
+	byte c;
+	for (; *str; ++str)
+	{
+		c = (byte)*str;
+		if (c == '"' || c == '\\')
+		{
+			escape[1] = c;
+			ijkProfilerInternalPut(w, escape, 2);
+		}
+		else if (c < 0x20)
+		{
+			escape[1] = 'u';
+			escape[4] = hex[c >> 4];
+			escape[5] = hex[c & 0xf];
+			ijkProfilerInternalPut(w, escape, 6);
+		}
+		else
+			ijkProfilerInternalPut(w, &c, 1);
+	}
+}
+
+
+// internal staging of decimal integer
+void ijkProfilerInternalPutDecimal(ijkProfilerWriter* const w, qword value, size digits)
+{
+	byte text[24];
+	size i = sizeof(text);
+	do
+	{
+		text[--i] = (byte)('0' + value % 10);
+		value /= 10;
+	} while (value || sizeof(text) - i < digits);
+	ijkProfilerInternalPut(w, text + i, sizeof(text) - i);
+}
+
+
+// internal staging of little-endian integer
+void ijkProfilerInternalPutInteger(ijkProfilerWriter* const w, qword value, size const bytes)
+{
+	byte data[8];
+	size i;
+	for (i = 0; i < bytes; ++i, value >>= 8)
+		data[i] = (byte)value;
+	ijkProfilerInternalPut(w, data, bytes);
+}
+
+
+// internal staging of length-prefixed name, clamped to 255 bytes
+void ijkProfilerInternalPutName(ijkProfilerWriter* const w, kcstr const name)
+{
+	size count = 0;
+	while (name[count] && count < 255)
+		++count;
+	ijkProfilerInternalPutInteger(w, count, 1);
+	ijkProfilerInternalPut(w, name, count);
+}
+
+
+// internal conversion of ticks since creation to nanoseconds; split so
+//	that long captures do not overflow
+ijk_inl qword ijkProfilerInternalNanoseconds(ijkProfiler const* const p, qword const time)
+{
+	qword const ticks = time - p->t0;
+	return (ticks / p->freq * 1000000000ull + ticks % p->freq * 1000000000ull / p->freq);
+}
+
+
+// internal json thread and event
+void ijkProfilerInternalPutJson(ijkProfiler* const p, ijkProfilerWriter* const w, ijkProfilerBuffer const* const buffer, ijkProfilerEvent const* const event)
+{
+	qword ns;
+	if (p->eventCount++)
+		ijkProfilerInternalPutString(w, (kcstr)",\n");
+	if (!event)
+	{
+		ijkProfilerInternalPutString(w, (kcstr)"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":");
+		ijkProfilerInternalPutDecimal(w, buffer->id, 1);
+		ijkProfilerInternalPutString(w, (kcstr)",\"args\":{\"name\":\"");
+		ijkProfilerInternalPutEscaped(w, (kcstr)buffer->name);
+		ijkProfilerInternalPutString(w, (kcstr)"\"}}");
+		return;
+	}
+	if (event->name)
+	{
+		ijkProfilerInternalPutString(w, (kcstr)"{\"name\":\"");
+		ijkProfilerInternalPutEscaped(w, event->name);
+		ijkProfilerInternalPutString(w, (kcstr)"\",\"ph\":\"B\",\"pid\":1,\"tid\":");
+	}
+	else
+		ijkProfilerInternalPutString(w, (kcstr)"{\"ph\":\"E\",\"pid\":1,\"tid\":");
+	ijkProfilerInternalPutDecimal(w, buffer->id, 1);
+
+	// microseconds with three decimals
+	ns = ijkProfilerInternalNanoseconds(p, event->time);
+	ijkProfilerInternalPutString(w, (kcstr)",\"ts\":");
+	ijkProfilerInternalPutDecimal(w, ns / 1000, 1);
+	ijkProfilerInternalPutString(w, (kcstr)".");
+	ijkProfilerInternalPutDecimal(w, ns % 1000, 3);
+	ijkProfilerInternalPutString(w, (kcstr)"}");
+}
+
+
+// internal binary name index, defining it if new
+dword ijkProfilerInternalPutNameIndex(ijkProfiler* const p, ijkProfilerWriter* const w, kcstr const name)
+{
+	size const mask = ijk_profiler_names - 1;
+	size i = (size)(((qword)(size)name >> 3) * 0x9E3779B97F4A7C15ull >> 32) & mask;
+	dword index = ijk_profiler_overflow;
+
+	// table is kept under three quarters full, so probing stops
+	for (; p->name[i]; i = (i + 1) & mask)
+		if (p->name[i] == name)
+			return (dword)i;
+	if (p->nameCount < ijk_profiler_names / 4 * 3)
+	{
+		p->name[i] = name;
+		++p->nameCount;
+		index = (dword)i;
+	}
+	ijkProfilerInternalPutInteger(w, 'N', 1);
+	ijkProfilerInternalPutInteger(w, index, 4);
+	ijkProfilerInternalPutName(w, name);
+	return index;
+}
+
+
+// internal binary thread and event
+void ijkProfilerInternalPutBinary(ijkProfiler* const p, ijkProfilerWriter* const w, ijkProfilerBuffer const* const buffer, ijkProfilerEvent const* const event)
+{
+	dword index;
+	if (!event)
+	{
+		ijkProfilerInternalPutInteger(w, 'T', 1);
+		ijkProfilerInternalPutInteger(w, buffer->id, 4);
+		ijkProfilerInternalPutName(w, (kcstr)buffer->name);
+		return;
+	}
+	if (event->name)
+	{
+		index = ijkProfilerInternalPutNameIndex(p, w, event->name);
+		ijkProfilerInternalPutInteger(w, 'B', 1);
+		ijkProfilerInternalPutInteger(w, event->time - p->t0, 8);
+		ijkProfilerInternalPutInteger(w, index, 4);
+	}
+	else
+	{
+		ijkProfilerInternalPutInteger(w, 'E', 1);
+		ijkProfilerInternalPutInteger(w, event->time - p->t0, 8);
+	}
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkProfilerCreate(ptr const profiler_base, size const baseSize, size const threadCount)
+{
+	if (profiler_base && baseSize && threadCount)
+	{
+		ijkProfiler* const p = (ijkProfiler*)profiler_base;
+		size const bufferStart = ((size)(p + 1) + ijk_profiler_line - 1) & ~(size)(ijk_profiler_line - 1);
+		size const nameStart = bufferStart + threadCount * sizeof(ijkProfilerBuffer);
+		size const eventStart = nameStart + ijk_profiler_names * sizeof(kcstr);
+		size const end = (size)profiler_base + baseSize;
+		ijkProfilerBuffer* buffer;
+		size capacity, i;
+
+		// events after buffers and name table, split evenly and rounded
+		//	down to power of two
+		if (eventStart > end || nameStart < bufferStart)
+			return ijk_fail_operationfail;
+		capacity = (end - eventStart) / threadCount / sizeof(ijkProfilerEvent);
+		if (capacity < ijk_profiler_min)
+			return ijk_fail_operationfail;
+		while (capacity & (capacity - 1))
+			capacity &= capacity - 1;
+
+		// touch everything now, so that recording never faults a page in
+		ijkMemorySetZero(p, baseSize);
+		p->t0 = ijkTimerNow();
+		p->freq = ijkTimerNowRate();
+		p->threadCount = threadCount;
+		p->buffer = (ijkProfilerBuffer*)bufferStart;
+		p->name = (kcstr*)nameStart;
+		for (i = 0, buffer = p->buffer; i < threadCount; ++i, ++buffer)
+		{
+			buffer->event = (ijkProfilerEvent*)eventStart + i * capacity;
+			buffer->mask = capacity - 1;
+		}
+		p->magic = ijk_profiler_magic;
+
+		// become the active profiler, then invalidate threads' buffers
+		if (ijkAtomicCompareExchange(&ijkProfilerInternalInstance, (size)p, 0))
+		{
+			p->magic = 0;
+			return ijk_fail_operationfail;
+		}
+		ijkAtomicAdd(&ijkProfilerInternalGeneration, 1);
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkProfilerRelease(ptr const profiler)
+{
+	ijkProfiler* const p = ijkProfilerInternalProfiler(profiler);
+	if (p && ijkAtomicLoad(&ijkProfilerInternalInstance) == (size)p)
+	{
+		ijkAtomicStore(&ijkProfilerInternalInstance, 0);
+		ijkAtomicAdd(&ijkProfilerInternalGeneration, 1);
+		p->magic = 0;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkProfilerFlush(ptr const profiler, ijkStream* const stream, ijkProfilerFormat const format)
+{
+	ijkProfiler* const p = ijkProfilerInternalProfiler(profiler);
+	if (p && stream && !stream->isRead && format >= ijkProfilerFormat_json && format <= ijkProfilerFormat_binary)
+	{
+		void(*const put)(ijkProfiler* const, ijkProfilerWriter* const, ijkProfilerBuffer const* const, ijkProfilerEvent const* const)
+			= format == ijkProfilerFormat_json ? ijkProfilerInternalPutJson : ijkProfilerInternalPutBinary;
+		ijkProfilerWriter w[1];
+		ijkProfilerBuffer* buffer;
+		size claimed, count, dropped, r, wr, i;
+		ibool warn = ijk_false;
+
+		ijkMutexLockWait(p->flush);
+		w->stream = stream;
+		w->length = 0;
+		w->result = ijk_success;
+
+		// header
+		if (!p->started)
+		{
+			if (format == ijkProfilerFormat_json)
+				ijkProfilerInternalPutString(w, (kcstr)"[\n");
+			else
+			{
+				ijkProfilerInternalPutString(w, (kcstr)"ijkProf1");
+				ijkProfilerInternalPutInteger(w, p->freq, 8);
+			}
+			p->started = ijk_true;
+		}
+
+		// threads turned away since last flush
+		claimed = ijkAtomicLoad(&p->claimed);
+		count = claimed < p->threadCount ? claimed : p->threadCount;
+		if (claimed > p->threadCount && claimed != p->claimReported)
+		{
+			p->claimReported = claimed;
+			warn = ijk_true;
+		}
+
+		for (i = 0, buffer = p->buffer; i < count; ++i, ++buffer)
+		{
+			// claimed but not yet identified: next time
+			if (!ijkAtomicLoadD(&buffer->ready))
+				continue;
+			dropped = ijkAtomicLoad(&buffer->dropped);
+			if (dropped != buffer->reported)
+			{
+				buffer->reported = dropped;
+				warn = ijk_true;
+			}
+
+			// thread record precedes its events (json only needs it once)
+			r = buffer->read;
+			wr = ijkAtomicLoad(&buffer->write);
+			if (!buffer->named || (r != wr && format == ijkProfilerFormat_binary))
+				put(p, w, buffer, 0);
+			buffer->named = ijk_true;
+			for (; r != wr; ++r)
+				put(p, w, buffer, buffer->event + (r & buffer->mask));
+
+			// events must be read before space is returned
+			ijkAtomicStore(&buffer->read, wr);
+		}
+		ijkProfilerInternalDrain(w);
+		ijkMutexUnlock(p->flush);
+
+		if (ijk_isfailure(w->result))
+			return w->result;
+		return (warn ? ijk_warn_profiler_dropped : ijk_success);
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkProfilerSetThreadName(tag const name)
+{
+	if (name)
+	{
+		ijkProfilerBuffer* const buffer = ijkProfilerInternalGetBuffer();
+		if (buffer)
+		{
+			ijk_copytag(buffer->name, name);
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkProfilerBegin(kcstr const name)
+{
+	if (name)
+	{
+		ijkProfilerBuffer* const buffer = ijkProfilerInternalGetBuffer();
+		if (buffer)
+		{
+			// inside a dropped scope: drop nested ones too, keeping pairs
+			if (!buffer->skip)
+			{
+				iret const result = ijkProfilerInternalRecord(buffer, name);
+				buffer->skip += (result != ijk_success);
+				return result;
+			}
+			++buffer->skip;
+			ijkAtomicStore(&buffer->dropped, buffer->dropped + 1);
+			return ijk_warn_profiler_dropped;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkProfilerEnd()
+{
+	ijkProfilerBuffer* const buffer = ijkProfilerInternalGetBuffer();
+	if (buffer)
+	{
+		if (!buffer->skip)
+			return ijkProfilerInternalRecord(buffer, 0);
+		--buffer->skip;
+		ijkAtomicStore(&buffer->dropped, buffer->dropped + 1);
+		return ijk_warn_profiler_dropped;
+	}
+	return ijk_fail_operationfail;
+}
+
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,402 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkQueue.c
+	Lock-free queue implementation.
+*/
+
+#include "ijk/ijk-base/ijk-utility/ijkQueue.h"
+#include "ijk/ijk-base/ijk-utility/ijkThread.h"
+#include "ijk/ijk-base/ijk-utility/ijkMemory.h"
+
+
+//-----------------------------------------------------------------------------
+
+// queue magic word ("ijkQueue")
+#define ijk_queue_magic		0x65756575516B6A69ull
+
+// cache line size for padding slots and shared indices
+#define ijk_queue_line		64
+
+// minimum number of slots
+#define ijk_queue_min		2
+
+
+typedef struct ijkQueue			ijkQueue;
+
+
+// queue header; each slot is a sequence number followed by the element, 
+//	sequences are not used by spsc, which only compares head and tail 
+//	sequence == position: free for the producer of that position 
+//	sequence == position + 1: full for the consumer of that position
+struct ijkQueue
+{
+	qword magic;					// validation word
+	size mode;						// producers and consumers
+	size elemSize;					// element size in bytes
+	size stride;					// slot size in bytes, whole cache lines
+	size capacity;					// number of slots
+	size mask;						// capacity - 1
+	pbyte slot;						// first slot, line-aligned
+	byte pad_header[ijk_queue_line];// keep header off producers' line
+	size volatile head;				// next position to push (producers)
+	size tailCache;					// last tail seen by single producer
+	byte pad_head[ijk_queue_line];	// keep producers off consumers' line
+	size volatile tail;				// next position to pop (consumers)
+	size headCache;					// last head seen by single consumer
+	byte pad_tail[ijk_queue_line];	// keep consumers off next line
+};
+
+
+//-----------------------------------------------------------------------------
+
+// internal validation
+ijk_inl ijkQueue* ijkQueueInternalQueue(kptr const queue)
+{
+	ijkQueue* const q = (ijkQueue*)queue;
+	return (q && q->magic == ijk_queue_magic) ? q : 0;
+}
+
+
+// internal slot sequence at position
+ijk_inl size volatile* ijkQueueInternalSequence(ijkQueue const* const q, size const position)
+{
+	return (size volatile*)(q->slot + (position & q->mask) * q->stride);
+}
+
+
+// internal slot element at position
+ijk_inl pbyte ijkQueueInternalElem(ijkQueue const* const q, size const position)
+{
+	return (q->slot + (position & q->mask) * q->stride + szchomp);
+}
+
+
+// internal element copy; pointer-sized elements are the common case
+ijk_inl void ijkQueueInternalCopy(ptr const dst, kptr const src, size const elemSize)
+{
+	if (elemSize == szchomp)
+		*(chomp*)dst = *(chomp const*)src;
+	else
+		ijkMemoryCopy(dst, src, elemSize);
+}
+
+
+//-----------------------------------------------------------------------------
+
+// internal single producer push: own head, cached tail
+size ijkQueueInternalPushSingle(ijkQueue* const q, kpbyte const elems, size count)
+{
+	size const h = q->head;
+	size i;
+
+	// refresh tail only when cached copy says there is not enough room
+	if (q->capacity - (h - q->tailCache) < count)
+	{
+		q->tailCache = ijkAtomicLoad(&q->tail);
+		if (q->capacity - (h - q->tailCache) < count)
+			count = q->capacity - (h - q->tailCache);
+	}
+	for (i = 0; i < count; ++i)
+		ijkQueueInternalCopy(ijkQueueInternalElem(q, h + i), elems + i * q->elemSize, q->elemSize);
+
+	// elements must be visible before head
+	if (count)
+		ijkAtomicStore(&q->head, h + count);
+	return count;
+}
+
+
+// internal single consumer pop: own tail, cached head
+size ijkQueueInternalPopSingle(ijkQueue* const q, pbyte const elems_out, size count)
+{
+	size const t = q->tail;
+	size i;
+	if (q->headCache - t < count)
+	{
+		q->headCache = ijkAtomicLoad(&q->head);
+		if (q->headCache - t < count)
+			count = q->headCache - t;
+	}
+	for (i = 0; i < count; ++i)
+		ijkQueueInternalCopy(elems_out + i * q->elemSize, ijkQueueInternalElem(q, t + i), q->elemSize);
+
+	// elements must be read before slots are released
+	if (count)
+		ijkAtomicStore(&q->tail, t + count);
+	return count;
+}
+
+
+// internal multiple producer push: claim consecutive free slots, then fill
+size ijkQueueInternalPushMulti(ijkQueue* const q, kpbyte const elems, size const count)
+{
+	size h = ijkAtomicLoad(&q->head), prev, n, i;
+	ptrdiff diff = 0;
+	for (;;)
+	{
+		// count free slots from head; a free slot stays free until claimed
+		for (n = 0; n < count; ++n)
+		{
+			diff = (ptrdiff)(ijkAtomicLoad(ijkQueueInternalSequence(q, h + n)) - (h + n));
+			if (diff != 0)
+				break;
+		}
+		if (n)
+		{
+			prev = ijkAtomicCompareExchange(&q->head, h + n, h);
+			if (prev == h)
+				break;
+			h = prev;
+		}
+		else if (diff < 0)
+		{
+			// slot at head not yet popped: full
+			return 0;
+		}
+		else
+		{
+			// another producer claimed head
+			h = ijkAtomicLoad(&q->head);
+		}
+	}
+
+	// fill claimed slots and publish each
+	for (i = 0; i < n; ++i)
+	{
+		ijkQueueInternalCopy(ijkQueueInternalElem(q, h + i), elems + i * q->elemSize, q->elemSize);
+		ijkAtomicStore(ijkQueueInternalSequence(q, h + i), h + i + 1);
+	}
+	return n;
+}
+
+
+// internal multiple consumer pop: claim consecutive full slots, then empty
+size ijkQueueInternalPopMulti(ijkQueue* const q, pbyte const elems_out, size const count)
+{
+	size t = ijkAtomicLoad(&q->tail), prev, n, i;
+	ptrdiff diff = 0;
+	for (;;)
+	{
+		for (n = 0; n < count; ++n)
+		{
+			diff = (ptrdiff)(ijkAtomicLoad(ijkQueueInternalSequence(q, t + n)) - (t + n + 1));
+			if (diff != 0)
+				break;
+		}
+		if (n)
+		{
+			prev = ijkAtomicCompareExchange(&q->tail, t + n, t);
+			if (prev == t)
+				break;
+			t = prev;
+		}
+		else if (diff < 0)
+		{
+			// slot at tail not yet pushed: empty
+			return 0;
+		}
+		else
+		{
+			t = ijkAtomicLoad(&q->tail);
+		}
+	}
+
+	// empty claimed slots and free each for the next lap
+	for (i = 0; i < n; ++i)
+	{
+		ijkQueueInternalCopy(elems_out + i * q->elemSize, ijkQueueInternalElem(q, t + i), q->elemSize);
+		ijkAtomicStore(ijkQueueInternalSequence(q, t + i), t + i + q->capacity);
+	}
+	return n;
+}
+
+
+// internal single consumer pop from multiple producers: no claim needed
+size ijkQueueInternalPopMultiSingle(ijkQueue* const q, pbyte const elems_out, size const count)
+{
+	size const t = q->tail;
+	size n;
+
+	// slots are published in any order; stop at the first not yet filled
+	for (n = 0; n < count; ++n)
+	{
+		if (ijkAtomicLoad(ijkQueueInternalSequence(q, t + n)) != t + n + 1)
+			break;
+		ijkQueueInternalCopy(elems_out + n * q->elemSize, ijkQueueInternalElem(q, t + n), q->elemSize);
+		ijkAtomicStore(ijkQueueInternalSequence(q, t + n), t + n + q->capacity);
+	}
+	if (n)
+		ijkAtomicStore(&q->tail, t + n);
+	return n;
+}
+
+
+// internal push by mode
+ijk_inl size ijkQueueInternalPush(ijkQueue* const q, kpbyte const elems, size const count)
+{
+	return (q->mode == ijkQueueMode_spsc) ? ijkQueueInternalPushSingle(q, elems, count)
+		: ijkQueueInternalPushMulti(q, elems, count);
+}
+
+
+// internal pop by mode
+ijk_inl size ijkQueueInternalPop(ijkQueue* const q, pbyte const elems_out, size const count)
+{
+	return (q->mode == ijkQueueMode_spsc) ? ijkQueueInternalPopSingle(q, elems_out, count)
+		: (q->mode == ijkQueueMode_mpsc) ? ijkQueueInternalPopMultiSingle(q, elems_out, count)
+		: ijkQueueInternalPopMulti(q, elems_out, count);
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkQueueCreate(ptr const queue_base, size const baseSize, size const elemSize, ijkQueueMode const mode)
+{
+	if (queue_base && baseSize && elemSize && mode >= ijkQueueMode_spsc && mode <= ijkQueueMode_mpmc)
+	{
+		ijkQueue* const q = (ijkQueue*)queue_base;
+		size const slotStart = ((size)(q + 1) + ijk_queue_line - 1) & ~(size)(ijk_queue_line - 1);
+		size const stride = (szchomp + elemSize + ijk_queue_line - 1) & ~(size)(ijk_queue_line - 1);
+		size capacity, i;
+
+		// slots after header, rounded down to power of two
+		if (slotStart > (size)queue_base + baseSize)
+			return ijk_fail_operationfail;
+		capacity = ((size)queue_base + baseSize - slotStart) / stride;
+		if (capacity < ijk_queue_min)
+			return ijk_fail_operationfail;
+		while (capacity & (capacity - 1))
+			capacity &= capacity - 1;
+
+		// header
+		ijkMemorySetZero(q, sizeof(ijkQueue));
+		q->mode = mode;
+		q->elemSize = elemSize;
+		q->stride = stride;
+		q->capacity = capacity;
+		q->mask = capacity - 1;
+		q->slot = (pbyte)slotStart;
+
+		// every slot free for its first lap
+		for (i = 0; i < capacity; ++i)
+			*ijkQueueInternalSequence(q, i) = i;
+
+		// done
+		q->magic = ijk_queue_magic;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkQueueRelease(ptr const queue)
+{
+	ijkQueue* const q = ijkQueueInternalQueue(queue);
+	if (q)
+	{
+		q->magic = 0;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkQueueGetCapacity(kptr const queue, size* const count_out)
+{
+	ijkQueue const* const q = ijkQueueInternalQueue(queue);
+	if (q && count_out)
+	{
+		*count_out = q->capacity;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkQueueGetCount(kptr const queue, size* const count_out)
+{
+	ijkQueue* const q = ijkQueueInternalQueue(queue);
+	if (q && count_out)
+	{
+		// tail first so the difference cannot go negative from a pop between
+		size const t = ijkAtomicLoad(&q->tail), h = ijkAtomicLoad(&q->head);
+		size const count = h - t;
+		*count_out = (ptrdiff)count < 0 ? 0 : count > q->capacity ? q->capacity : count;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkQueuePush(ptr const queue, kptr const elem)
+{
+	ijkQueue* const q = ijkQueueInternalQueue(queue);
+	if (q && elem)
+	{
+		return ijkQueueInternalPush(q, (kpbyte)elem, 1) ? ijk_success : ijk_warn_queue_full;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkQueuePop(ptr const queue, ptr const elem_out)
+{
+	ijkQueue* const q = ijkQueueInternalQueue(queue);
+	if (q && elem_out)
+	{
+		return ijkQueueInternalPop(q, (pbyte)elem_out, 1) ? ijk_success : ijk_warn_queue_empty;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkQueuePushBatch(ptr const queue, kptr const elems, size const count, size* const count_out_opt)
+{
+	ijkQueue* const q = ijkQueueInternalQueue(queue);
+	if (q && elems && count)
+	{
+		size const n = ijkQueueInternalPush(q, (kpbyte)elems, count);
+		if (count_out_opt)
+			*count_out_opt = n;
+		return (n == count) ? ijk_success : ijk_warn_queue_full;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkQueuePopBatch(ptr const queue, ptr const elems_out, size const count, size* const count_out_opt)
+{
+	ijkQueue* const q = ijkQueueInternalQueue(queue);
+	if (q && elems_out && count)
+	{
+		size const n = ijkQueueInternalPop(q, (pbyte)elems_out, count);
+		if (count_out_opt)
+			*count_out_opt = n;
+		return (n == count) ? ijk_success : ijk_warn_queue_empty;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,246 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkScheduler.c
+	Fixed-rate scheduler implementation.
+*/
+
+#include "ijk/ijk-base/ijk-utility/ijkScheduler.h"
+
+
+// include platform APIs
+#if (__ijk_cfg_platform == WINDOWS)
+#include <Windows.h>
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION	0x00000002
+#endif	// !CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#else	// !WINDOWS
+#include <time.h>
+#include <sched.h>
+#endif	// WINDOWS
+
+
+//-----------------------------------------------------------------------------
+
+// time before a deadline at which sleeping stops and yielding starts, in
+//	seconds; covers timer slack and wake-up latency
+#define ijk_scheduler_slack		0.0002
+
+
+// internal sleep for about a duration in seconds
+ijk_inl void ijkSchedulerInternalSleep(ijkScheduler* const scheduler, dbl const duration)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	// relative due time is negative, in 100-nanosecond units
+	LARGE_INTEGER due;
+	due.QuadPart = -(LONGLONG)(duration * 1.0e7);
+	if (SetWaitableTimerEx(scheduler->handle[0], &due, 0, 0, 0, 0, 0))
+		WaitForSingleObject(scheduler->handle[0], INFINITE);
+#else	// !WINDOWS
+	// no timer object is needed to sleep here
+	struct timespec t;
+	ijk_unused(scheduler);
+	t.tv_sec = (time_t)duration;
+	t.tv_nsec = (long)((duration - (dbl)t.tv_sec) * 1.0e9);
+	nanosleep(&t, 0);
+#endif	// WINDOWS
+}
+
+
+// internal yield of the rest of calling thread's time slice
+ijk_inl void ijkSchedulerInternalYield()
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	SwitchToThread();
+#else	// !WINDOWS
+	sched_yield();
+#endif	// WINDOWS
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkSchedulerCreate(ijkScheduler* const scheduler_out, dbl const budget)
+{
+	if (scheduler_out && budget > 0.0)
+	{
+#if (__ijk_cfg_platform == WINDOWS)
+		// high-resolution timers need Windows 10 1803; older systems get a
+		//	regular one, which wakes at the system timer resolution
+		scheduler_out->handle[0] = CreateWaitableTimerExW(0, 0, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+		if (!scheduler_out->handle[0])
+			scheduler_out->handle[0] = CreateWaitableTimerExW(0, 0, 0, TIMER_ALL_ACCESS);
+		if (!scheduler_out->handle[0])
+			return ijk_fail_operationfail;
+#else	// !WINDOWS
+		scheduler_out->handle[0] = 0;
+#endif	// WINDOWS
+
+		scheduler_out->taskCount = 0;
+		scheduler_out->budget = budget;
+		scheduler_out->totalTime = 0.0;
+		scheduler_out->droppedTime = 0.0;
+		scheduler_out->updateCount = 0;
+		*scheduler_out->rate = ijkTimerNowRate();
+		*scheduler_out->t0 = ijkTimerNow();
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkSchedulerRelease(ijkScheduler* const scheduler)
+{
+	if (scheduler && *scheduler->rate)
+	{
+#if (__ijk_cfg_platform == WINDOWS)
+		CloseHandle(scheduler->handle[0]);
+#endif	// WINDOWS
+		scheduler->handle[0] = 0;
+		scheduler->taskCount = 0;
+		*scheduler->rate = 0;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkSchedulerAddTask(ijkScheduler* const scheduler, ijkSchedulerFunc const func, ptr const arg, dbl const ticksPerSecond, size const tickLimit, size* const index_out_opt)
+{
+	if (scheduler && *scheduler->rate && func)
+	{
+		if (scheduler->taskCount < ijk_scheduler_tasks)
+		{
+			ijkSchedulerTask* const task = scheduler->task + scheduler->taskCount;
+			task->func = func;
+			task->arg = arg;
+			task->interval = ticksPerSecond > 0.0 ? 1.0 / ticksPerSecond : 0.0;
+			task->owed = 0.0;
+			task->alpha = 0.0;
+			task->tickLimit = tickLimit;
+			task->tickCount = 0;
+			task->result = ijk_success;
+			if (index_out_opt)
+				*index_out_opt = scheduler->taskCount;
+			++scheduler->taskCount;
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkSchedulerUpdate(ijkScheduler* const scheduler, size* const ticks_out_opt)
+{
+	if (scheduler && *scheduler->rate)
+	{
+		qword const t1 = ijkTimerNow();
+		dbl elapsed = (dbl)(t1 - *scheduler->t0) / (dbl)(*scheduler->rate);
+		ijkSchedulerTask* task;
+		ijkSchedulerTask const* const end = scheduler->task + scheduler->taskCount;
+		size ticks = 0, count;
+		iret result = ijk_success;
+
+		// owe no more than the budget
+		*scheduler->t0 = t1;
+		if (elapsed > scheduler->budget)
+		{
+			scheduler->droppedTime += elapsed - scheduler->budget;
+			elapsed = scheduler->budget;
+			result = ijk_warn_scheduler_dropped;
+		}
+		scheduler->totalTime += elapsed;
+		++scheduler->updateCount;
+
+		// fixed rate: whole ticks owed, up to limit; anything still owed
+		//	beyond a partial tick is dropped
+		for (task = scheduler->task; task < end; ++task)
+		{
+			if (task->interval > 0.0)
+			{
+				task->owed += elapsed;
+				for (count = 0; task->owed >= task->interval && (!task->tickLimit || count < task->tickLimit); ++count)
+				{
+					task->result = task->func(task->arg, task->interval);
+					task->owed -= task->interval;
+				}
+				if (task->owed >= task->interval)
+				{
+					task->owed -= (dbl)(qword)(task->owed / task->interval) * task->interval;
+					result = ijk_warn_scheduler_dropped;
+				}
+				task->alpha = task->owed / task->interval;
+				task->tickCount += count;
+				ticks += count;
+			}
+		}
+
+		// variable rate: once
+		for (task = scheduler->task; task < end; ++task)
+		{
+			if (task->interval <= 0.0)
+			{
+				task->result = task->func(task->arg, elapsed);
+				++task->tickCount;
+				++ticks;
+			}
+		}
+
+		if (ticks_out_opt)
+			*ticks_out_opt = ticks;
+		return result;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkSchedulerWait(ijkScheduler* const scheduler, dbl const limit)
+{
+	if (scheduler && *scheduler->rate)
+	{
+		ijkSchedulerTask const* task;
+		ijkSchedulerTask const* const end = scheduler->task + scheduler->taskCount;
+		qword const rate = *scheduler->rate, now = ijkTimerNow();
+		dbl const since = (dbl)(now - *scheduler->t0) / (dbl)rate;
+		dbl remaining = limit > 0.0 ? limit : -1.0;
+		qword deadline;
+
+		// earliest tick due; the time owed was counted at the last update
+		for (task = scheduler->task; task < end; ++task)
+			if (task->interval > 0.0 && (remaining < 0.0 || task->interval - task->owed - since < remaining))
+				remaining = task->interval - task->owed - since;
+		if (remaining <= 0.0)
+			return ijk_success;
+
+		// sleep most of the way, then yield until the deadline passes
+		deadline = now + (qword)(remaining * (dbl)rate);
+		if (remaining > ijk_scheduler_slack)
+			ijkSchedulerInternalSleep(scheduler, remaining - ijk_scheduler_slack);
+		while ((i64)(deadline - ijkTimerNow()) > 0)
+			ijkSchedulerInternalYield();
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
@@ -23,13 +23,226 @@
 	Stream utility implementation.
 */
 
+#define _GNU_SOURCE		// syscall, before anything includes features.h
+
 #include "ijk/ijk-base/ijk-utility/ijkStream.h"
+#include "ijk/ijk-base/ijk-utility/ijkThread.h"
+#include "ijk/ijk-base/ijk-utility/ijkQueue.h"
 
+// the same features declare libc's index(), which would clash with the 
+//	index type; it is renamed while system headers are included
+#define index	ijkStreamInternalLibcIndex
 #include <stdio.h>
 #include <memory.h>
 #include <stdlib.h>
 
 
+// include platform APIs
+#if (__ijk_cfg_platform == WINDOWS)
+#include <Windows.h>
+#else	// !WINDOWS
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif	// WINDOWS
+#undef index
+
+
+//-----------------------------------------------------------------------------
+
+// internal raw read from file at offset; fewer bytes than requested only 
+//	at end of file or on error; the file pointer is not used, so any number 
+//	of reads may be in progress at once (Windows handles are overlapped, and 
+//	each caller waits on its own event: the stream's or its thread's)
+ijk_inl size ijkStreamInternalFileRead(ptr const handle, ptr const event, pbyte data, size count, size offset)
+{
+	size total = 0;
+#if (__ijk_cfg_platform == WINDOWS)
+	OVERLAPPED position = { 0 };
+	DWORD result;
+	position.hEvent = (HANDLE)event;
+	while (count && position.hEvent)
+	{
+		position.Offset = (DWORD)offset;
+		position.OffsetHigh = (DWORD)((qword)offset >> 32);
+		if (!ReadFile((HANDLE)handle, data, (DWORD)ijk_minimum(count, 0x40000000), 0, &position) && GetLastError() != ERROR_IO_PENDING)
+			break;
+		if (!GetOverlappedResult((HANDLE)handle, &position, &result, TRUE) || !result)
+			break;
+		data += result;
+		count -= result;
+		offset += result;
+		total += result;
+	}
+#else	// !WINDOWS
+	ssize_t result;
+	ijk_unused(event);
+	while (count)
+	{
+		result = pread((int)(size)handle, data, count, (off_t)offset);
+		if (result < 0 && errno == EINTR)
+			continue;
+		if (result <= 0)
+			break;
+		data += result;
+		count -= result;
+		offset += result;
+		total += result;
+	}
+#endif	// WINDOWS
+	return total;
+}
+
+
+// internal raw write to file at offset; fewer bytes than requested only on 
+//	error; waits on event as reads do
+ijk_inl size ijkStreamInternalFileWrite(ptr const handle, ptr const event, kpbyte data, size count, size offset)
+{
+	size total = 0;
+#if (__ijk_cfg_platform == WINDOWS)
+	OVERLAPPED position = { 0 };
+	DWORD result;
+	position.hEvent = (HANDLE)event;
+	while (count && position.hEvent)
+	{
+		position.Offset = (DWORD)offset;
+		position.OffsetHigh = (DWORD)((qword)offset >> 32);
+		if (!WriteFile((HANDLE)handle, data, (DWORD)ijk_minimum(count, 0x40000000), 0, &position) && GetLastError() != ERROR_IO_PENDING)
+			break;
+		if (!GetOverlappedResult((HANDLE)handle, &position, &result, TRUE) || !result)
+			break;
+		data += result;
+		count -= result;
+		offset += result;
+		total += result;
+	}
+#else	// !WINDOWS
+	ssize_t result;
+	ijk_unused(event);
+	while (count)
+	{
+		result = pwrite((int)(size)handle, data, count, (off_t)offset);
+		if (result < 0 && errno == EINTR)
+			continue;
+		if (result <= 0)
+			break;
+		data += result;
+		count -= result;
+		offset += result;
+		total += result;
+	}
+#endif	// WINDOWS
+	return total;
+}
+
+
+// internal raw close of file and its event
+ijk_inl void ijkStreamInternalFileClose(ptr const handle, ptr const event)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	CloseHandle((HANDLE)event);
+	CloseHandle((HANDLE)handle);
+#else	// !WINDOWS
+	ijk_unused(event);
+	close((int)(size)handle);
+#endif	// WINDOWS
+}
+
+
+// internal pass of buffered writes to file; bytes not written are dropped
+ijk_inl ibool ijkStreamInternalFlush(ijkStream* const stream)
+{
+	size const pending = stream->head - stream->base;
+	size const result = ijkStreamInternalFileWrite(stream->handle, stream->event, stream->base, pending, stream->position);
+	stream->position += result;
+	stream->head = stream->base;
+	return (result == pending);
+}
+
+
+// internal buffered read: copy from buffer, refilling it when empty; the 
+//	remainder goes straight to the element if it would fill the buffer
+ijk_inl size ijkStreamInternalBufferedRead(ijkStream* const stream, pbyte elem, size count)
+{
+	size result = 0, part;
+	while (count)
+	{
+		part = stream->length - (stream->head - stream->base);
+		part = ijk_minimum(part, count);
+		memcpy(elem, stream->head, part);
+		stream->head += part;
+		elem += part;
+		count -= part;
+		result += part;
+		if (!count)
+			break;
+
+		// buffer is empty
+		stream->position += stream->length;
+		stream->head = stream->base;
+		stream->length = 0;
+		if (count >= stream->capacity)
+		{
+			part = ijkStreamInternalFileRead(stream->handle, stream->event, elem, count, stream->position);
+			stream->position += part;
+			result += part;
+			break;
+		}
+		stream->length = ijkStreamInternalFileRead(stream->handle, stream->event, stream->base, stream->capacity, stream->position);
+		if (!stream->length)
+			break;
+	}
+	return result;
+}
+
+
+// internal buffered write: copy to buffer, passing it on when full; the 
+//	element goes straight to file if it would fill the buffer
+ijk_inl size ijkStreamInternalBufferedWrite(ijkStream* const stream, kpbyte elem, size const count)
+{
+	size const space = stream->capacity - (stream->head - stream->base);
+	size result;
+	if (count > space)
+	{
+		if (!ijkStreamInternalFlush(stream))
+			return 0;
+		if (count >= stream->capacity)
+		{
+			result = ijkStreamInternalFileWrite(stream->handle, stream->event, elem, count, stream->position);
+			stream->position += result;
+			return result;
+		}
+	}
+	memcpy(stream->head, elem, count);
+	stream->head += count;
+	return count;
+}
+
+
+// internal growth of growable buffer to hold at least a number of bytes
+ijk_inl ibool ijkStreamInternalGrow(ijkStream* const stream, size const required)
+{
+	size const offset = stream->head - stream->base;
+	size capacity = stream->capacity;
+	pbyte base;
+	while (capacity < required)
+		capacity = (capacity <= ((size)-1 >> 1) ? (capacity << 1) : required);
+	base = (pbyte)realloc(stream->base, capacity);
+	if (base)
+	{
+		stream->base = base;
+		stream->head = base + offset;
+		stream->capacity = capacity;
+		return ijk_true;
+	}
+	return ijk_false;
+}
+
+
 //-----------------------------------------------------------------------------
 
 iret ijkStreamCreateFile(ijkStream* const stream_out, kcstr const filePath, ibool const readMode)
@@ -37,14 +250,21 @@ iret ijkStreamCreateFile(ijkStream* const stream_out, kcstr const filePath, iboo
 	if (stream_out && filePath && *filePath &&
 		!stream_out->base)
 	{
-		FILE* const fp = fopen(filePath, (readMode ? "rb" : "wb"));
+		FILE* const fp = fopen((char const*)filePath, (readMode ? "rb" : "wb"));
 		if (fp)
 		{
 			stream_out->base = (pbyte)fp;
 			stream_out->head = 0;
 			stream_out->length = 0;
+			stream_out->capacity = 0;
+			stream_out->position = 0;
+			stream_out->handle = 0;
+			stream_out->event = 0;
 			stream_out->isRead = readMode;
 			stream_out->isFile = ijk_true;
+			stream_out->isMapped = ijk_false;
+			stream_out->isBuffered = ijk_false;
+			stream_out->isGrowable = ijk_false;
 
 			// opened file
 			return ijk_success;
@@ -57,6 +277,57 @@ iret ijkStreamCreateFile(ijkStream* const stream_out, kcstr const filePath, iboo
 }
 
 
+iret ijkStreamCreateFileBuffered(ijkStream* const stream_out, kcstr const filePath, ibool const readMode, size const buffSize)
+{
+	if (stream_out && filePath && *filePath && buffSize &&
+		!stream_out->base)
+	{
+		pbyte const buffer = (pbyte)malloc(buffSize);
+		ptr handle = 0, event = 0;
+		ibool opened = ijk_false;
+#if (__ijk_cfg_platform == WINDOWS)
+		HANDLE const file = (buffer ? CreateFileA((char const*)filePath, (readMode ? GENERIC_READ : GENERIC_WRITE), FILE_SHARE_READ, 0,
+			(readMode ? OPEN_EXISTING : CREATE_ALWAYS), FILE_FLAG_OVERLAPPED | (readMode ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_ATTRIBUTE_NORMAL), 0) : INVALID_HANDLE_VALUE);
+
+		// one event for the life of the stream, waited on by its own transfers
+		HANDLE const done = (file != INVALID_HANDLE_VALUE ? CreateEventA(0, TRUE, FALSE, 0) : 0);
+		if (file != INVALID_HANDLE_VALUE && !done)
+			CloseHandle(file);
+		opened = (done != 0);
+		handle = (ptr)file;
+		event = (ptr)done;
+#else	// !WINDOWS
+		int const fd = (buffer ? open((char const*)filePath, (readMode ? (O_RDONLY | O_CLOEXEC) : (O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC)), 0666) : -1);
+		opened = (fd >= 0);
+		handle = (ptr)(size)fd;
+#endif	// WINDOWS
+		if (opened)
+		{
+			stream_out->base = buffer;
+			stream_out->head = buffer;
+			stream_out->length = 0;
+			stream_out->capacity = buffSize;
+			stream_out->position = 0;
+			stream_out->handle = handle;
+			stream_out->event = event;
+			stream_out->isRead = readMode;
+			stream_out->isFile = ijk_true;
+			stream_out->isMapped = ijk_false;
+			stream_out->isBuffered = ijk_true;
+			stream_out->isGrowable = ijk_false;
+
+			// opened file
+			return ijk_success;
+		}
+
+		// failed
+		free(buffer);
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
 iret ijkStreamCreateBuffer(ijkStream* const stream_out, size const buffSize, kcstr const readSource)
 {
 	if (stream_out && buffSize &&
@@ -68,7 +339,14 @@ iret ijkStreamCreateBuffer(ijkStream* const stream_out, size const buffSize, kcs
 		{
 			stream_out->head = stream_out->base;
 			stream_out->length = buffSize;
+			stream_out->capacity = 0;
+			stream_out->position = 0;
+			stream_out->handle = 0;
+			stream_out->event = 0;
 			stream_out->isFile = ijk_false;
+			stream_out->isMapped = ijk_false;
+			stream_out->isBuffered = ijk_false;
+			stream_out->isGrowable = ijk_false;
 			if (readSource)
 			{
 				memcpy(stream_out->base, readSource, buffSize);
@@ -91,13 +369,45 @@ iret ijkStreamCreateBuffer(ijkStream* const stream_out, size const buffSize, kcs
 }
 
 
+iret ijkStreamCreateBufferGrowable(ijkStream* const stream_out, size const buffSize)
+{
+	if (stream_out && buffSize &&
+		!stream_out->base)
+	{
+		// allocate
+		stream_out->base = (pbyte)malloc(buffSize);
+		if (stream_out->base)
+		{
+			stream_out->head = stream_out->base;
+			stream_out->length = 0;
+			stream_out->capacity = buffSize;
+			stream_out->position = 0;
+			stream_out->handle = 0;
+			stream_out->event = 0;
+			stream_out->isRead = ijk_false;
+			stream_out->isFile = ijk_false;
+			stream_out->isMapped = ijk_false;
+			stream_out->isBuffered = ijk_false;
+			stream_out->isGrowable = ijk_true;
+
+			// success
+			return ijk_success;
+		}
+
+		// failed
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
 iret ijkStreamLoadBuffer(ijkStream* const stream_out, kcstr const filePath)
 {
 	if (stream_out && filePath && *filePath &&
 		!stream_out->base)
 	{
 		size result = 0;
-		FILE* const fp = fopen(filePath, "rb");
+		FILE* const fp = fopen((char const*)filePath, "rb");
 		if (fp)
 		{
 			fseek(fp, 0, SEEK_END);
@@ -106,12 +416,20 @@ iret ijkStreamLoadBuffer(ijkStream* const stream_out, kcstr const filePath)
 			{
 				// allocate and read from beginning
 				stream_out->base = (pbyte)malloc(result + 1);
+				fseek(fp, 0, SEEK_SET);
 				fread(stream_out->base, result, 1, fp);
 				stream_out->base[result] = 0;
 				stream_out->head = stream_out->base;
 				stream_out->length = result;
+				stream_out->capacity = 0;
+				stream_out->position = 0;
+				stream_out->handle = 0;
+				stream_out->event = 0;
 				stream_out->isRead = ijk_true;
 				stream_out->isFile = ijk_false;
+				stream_out->isMapped = ijk_false;
+				stream_out->isBuffered = ijk_false;
+				stream_out->isGrowable = ijk_false;
 			}
 
 			// done
@@ -129,12 +447,91 @@ iret ijkStreamLoadBuffer(ijkStream* const stream_out, kcstr const filePath)
 }
 
 
+iret ijkStreamCreateMapped(ijkStream* const stream_out, kcstr const filePath, ibool const sequential)
+{
+	if (stream_out && filePath && *filePath &&
+		!stream_out->base)
+	{
+		pbyte base = 0;
+		size length = 0;
+#if (__ijk_cfg_platform == WINDOWS)
+		HANDLE const file = CreateFileA((char const*)filePath, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+		if (file != INVALID_HANDLE_VALUE)
+		{
+			LARGE_INTEGER fileSize;
+			if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0 && (qword)fileSize.QuadPart <= (qword)(size)(-1))
+			{
+				// the view keeps the mapping and file open
+				HANDLE const mapping = CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+				if (mapping)
+				{
+					base = (pbyte)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+					length = (size)fileSize.QuadPart;
+					CloseHandle(mapping);
+				}
+			}
+			CloseHandle(file);
+		}
+		if (base && sequential)
+		{
+			// read ahead asynchronously
+			WIN32_MEMORY_RANGE_ENTRY range;
+			range.VirtualAddress = base;
+			range.NumberOfBytes = length;
+			PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+		}
+#else	// !WINDOWS
+		int const fd = open((char const*)filePath, O_RDONLY | O_CLOEXEC);
+		struct stat info;
+		if (fd >= 0)
+		{
+			if (fstat(fd, &info) == 0 && info.st_size > 0 && (qword)info.st_size <= (qword)(size)(-1))
+			{
+				// the mapping keeps the file open
+				length = (size)info.st_size;
+				base = (pbyte)mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
+				if (base == (pbyte)MAP_FAILED)
+					base = 0;
+			}
+			close(fd);
+		}
+		if (base && sequential)
+		{
+			// larger read-ahead window, and start reading ahead now
+			posix_madvise(base, length, POSIX_MADV_SEQUENTIAL);
+			posix_madvise(base, length, POSIX_MADV_WILLNEED);
+		}
+#endif	// WINDOWS
+		if (base)
+		{
+			stream_out->base = base;
+			stream_out->head = base;
+			stream_out->length = length;
+			stream_out->capacity = 0;
+			stream_out->position = 0;
+			stream_out->handle = 0;
+			stream_out->event = 0;
+			stream_out->isRead = ijk_true;
+			stream_out->isFile = ijk_false;
+			stream_out->isMapped = ijk_true;
+			stream_out->isBuffered = ijk_false;
+			stream_out->isGrowable = ijk_false;
+			return ijk_success;
+		}
+
+		// failed
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
 iret ijkStreamSaveBuffer(ijkStream const* const stream, kcstr const filePath)
 {
 	if (stream && filePath && *filePath &&
 		stream->base && ijk_isfalse(stream->isFile))
 	{
-		FILE* const fp = fopen(filePath, "wb");
+		FILE* const fp = fopen((char const*)filePath, "wb");
 		if (fp)
 		{
 			// write data
@@ -152,18 +549,61 @@ iret ijkStreamSaveBuffer(ijkStream const* const stream, kcstr const filePath)
 }
 
 
+iret ijkStreamDetach(ijkStream* const stream, ptr* const data_out, size* const length_out_opt)
+{
+	if (stream && data_out &&
+		stream->base && ijk_isfalse(stream->isFile) && ijk_isfalse(stream->isMapped))
+	{
+		*data_out = stream->base;
+		if (length_out_opt)
+			*length_out_opt = stream->length;
+		stream->base = 0;
+		stream->head = 0;
+		stream->length = 0;
+		stream->capacity = 0;
+		stream->isGrowable = ijk_false;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
 iret ijkStreamRelease(ijkStream* const stream)
 {
 	if (stream &&
 		stream->base)
 	{
-		if (stream->isFile)
+		if (stream->isBuffered)
+		{
+			ibool const flushed = (stream->isRead || ijkStreamInternalFlush(stream));
+			ijkStreamInternalFileClose(stream->handle, stream->event);
+			free(stream->base);
+			stream->base = 0;
+			stream->head = 0;
+			stream->handle = 0;
+			stream->event = 0;
+			stream->isBuffered = ijk_false;
+			return (flushed ? ijk_success : ijk_fail_operationfail);
+		}
+		else if (stream->isFile)
 		{
 			iret const result = fclose((FILE*)stream->base);
 			if (ijk_issuccess(result))
 				stream->base = 0;
 			return result;
 		}
+		else if (stream->isMapped)
+		{
+#if (__ijk_cfg_platform == WINDOWS)
+			UnmapViewOfFile(stream->base);
+#else	// !WINDOWS
+			munmap(stream->base, stream->length);
+#endif	// WINDOWS
+			stream->base = 0;
+			stream->head = 0;
+			stream->isMapped = ijk_false;
+			return ijk_success;
+		}
 		else
 		{
 			free(stream->base);
@@ -179,6 +619,114 @@ iret ijkStreamRelease(ijkStream* const stream)
 }
 
 
+iret ijkStreamGetLength(ijkStream const* const stream, size* const length_out)
+{
+	if (stream && length_out &&
+		stream->base)
+	{
+		if (stream->isBuffered)
+		{
+			// size of file behind handle
+#if (__ijk_cfg_platform == WINDOWS)
+			LARGE_INTEGER fileSize;
+			if (GetFileSizeEx((HANDLE)stream->handle, &fileSize) && (qword)fileSize.QuadPart <= (qword)(size)(-1))
+			{
+				*length_out = (size)fileSize.QuadPart;
+				return ijk_success;
+			}
+#else	// !WINDOWS
+			struct stat info;
+			if (fstat((int)(size)stream->handle, &info) == 0 && (qword)info.st_size <= (qword)(size)(-1))
+			{
+				*length_out = (size)info.st_size;
+				return ijk_success;
+			}
+#endif	// WINDOWS
+			return ijk_fail_operationfail;
+		}
+		else if (stream->isFile)
+		{
+			// seek to end and back to offset
+			FILE* const fp = (FILE*)stream->base;
+#if (__ijk_cfg_platform == WINDOWS)
+			i64 const end = (_fseeki64(fp, 0, SEEK_END) == 0 ? _ftelli64(fp) : -1);
+			if (_fseeki64(fp, (i64)stream->length, SEEK_SET) == 0 && end >= 0 && (qword)end <= (qword)(size)(-1))
+#else	// !WINDOWS
+			off_t const end = (fseeko(fp, 0, SEEK_END) == 0 ? ftello(fp) : -1);
+			if (fseeko(fp, (off_t)stream->length, SEEK_SET) == 0 && end >= 0 && (qword)end <= (qword)(size)(-1))
+#endif	// WINDOWS
+			{
+				*length_out = (size)end;
+				return ijk_success;
+			}
+			return ijk_fail_operationfail;
+		}
+		*length_out = stream->length;
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkStreamSeek(ijkStream* const stream, size const offset)
+{
+	if (stream &&
+		stream->base)
+	{
+		if (stream->isBuffered)
+		{
+			// reading, keep buffer if offset is in it; writing, pass it on
+			if (stream->isRead)
+			{
+				if (offset >= stream->position && offset - stream->position <= stream->length)
+				{
+					stream->head = stream->base + (offset - stream->position);
+					return ijk_success;
+				}
+			}
+			else if (!ijkStreamInternalFlush(stream))
+				return ijk_fail_operationfail;
+			stream->head = stream->base;
+			stream->length = 0;
+			stream->position = offset;
+			return ijk_success;
+		}
+		else if (stream->isFile)
+		{
+#if (__ijk_cfg_platform == WINDOWS)
+			if (_fseeki64((FILE*)stream->base, (i64)offset, SEEK_SET) == 0)
+#else	// !WINDOWS
+			if (fseeko((FILE*)stream->base, (off_t)offset, SEEK_SET) == 0)
+#endif	// WINDOWS
+			{
+				stream->length = offset;
+				return ijk_success;
+			}
+			return ijk_fail_operationfail;
+		}
+		else if (offset <= stream->length)
+		{
+			stream->head = stream->base + offset;
+			return ijk_success;
+		}
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkStreamFlush(ijkStream* const stream)
+{
+	if (stream &&
+		stream->base && !stream->isRead && stream->isFile)
+	{
+		if (stream->isBuffered)
+			return (ijkStreamInternalFlush(stream) ? ijk_success : ijk_fail_operationfail);
+		return (fflush((FILE*)stream->base) == 0 ? ijk_success : ijk_fail_operationfail);
+	}
+	return ijk_fail_invalidparams;
+}
+
+
 //-----------------------------------------------------------------------------
 
 iret ijkStreamReadElement(ijkStream* const stream, ptr const elem, size const elemSize, size const elemCount, size* const bytes_opt)
@@ -189,9 +737,15 @@ iret ijkStreamReadElement(ijkStream* const stream, ptr const elem, size const el
 	{
 		size result = 0;
 		size const expected = elemSize * elemCount;
-		if (stream->isFile)
+		if (stream->isBuffered)
 		{
-			result = fread(elem, elemSize, elemCount, (FILE*)stream->base);
+			result = ijkStreamInternalBufferedRead(stream, (pbyte)elem, expected);
+			if (bytes_opt)
+				*bytes_opt = result;
+		}
+		else if (stream->isFile)
+		{
+			result = fread(elem, 1, expected, (FILE*)stream->base);
 			stream->length += result;
 			if (bytes_opt)
 				*bytes_opt = result;
@@ -218,6 +772,31 @@ iret ijkStreamReadElement(ijkStream* const stream, ptr const elem, size const el
 }
 
 
+iret ijkStreamPeek(ijkStream* const stream, kptr* const data_out, size const byteCount, ibool const advance, size* const bytes_opt)
+{
+	if (stream && data_out && byteCount &&
+		stream->base && stream->isRead && ijk_isfalse(stream->isFile))
+	{
+		size const offset = stream->head - stream->base;
+		size const capacity = stream->length - offset;
+		size const result = ijk_minimum(byteCount, capacity);
+		*data_out = stream->head;
+		if (advance)
+			stream->head += result;
+		if (bytes_opt)
+			*bytes_opt = result;
+
+		// success
+		if (result)
+			return (result == byteCount ? ijk_success : ijk_warn_stream_incomplete);
+
+		// failed
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
 iret ijkStreamWriteElement(ijkStream* const stream, kptr const elem, size const elemSize, size const elemCount, size* const bytes_opt)
 {
 	if (stream && elem && elemSize && elemCount &&
@@ -225,13 +804,34 @@ iret ijkStreamWriteElement(ijkStream* const stream, kptr const elem, size const
 	{
 		size result = 0;
 		size const expected = elemSize * elemCount;
-		if (stream->isFile)
+		if (stream->isBuffered)
 		{
-			result = fwrite(elem, elemSize, elemCount, (FILE*)stream->base);
+			result = ijkStreamInternalBufferedWrite(stream, (kpbyte)elem, expected);
+			if (bytes_opt)
+				*bytes_opt = result;
+		}
+		else if (stream->isFile)
+		{
+			result = fwrite(elem, 1, expected, (FILE*)stream->base);
 			stream->length += result;
 			if (bytes_opt)
 				*bytes_opt = result;
 		}
+		else if (stream->isGrowable)
+		{
+			// grow to fit, or write what fits if growing failed
+			size const offset = stream->head - stream->base;
+			size capacity = stream->capacity - offset;
+			if (expected > capacity && ijkStreamInternalGrow(stream, offset + expected))
+				capacity = stream->capacity - offset;
+			result = ijk_minimum(expected, capacity);
+			memcpy(stream->head, elem, result);
+			stream->head += result;
+			if (stream->length < offset + result)
+				stream->length = offset + result;
+			if (bytes_opt)
+				*bytes_opt = result;
+		}
 		else
 		{
 			size const offset = stream->head - stream->base;
@@ -254,6 +854,460 @@ iret ijkStreamWriteElement(ijkStream* const stream, kptr const elem, size const
 }
 
 
+//-----------------------------------------------------------------------------
+
+// most requests in flight per asynchronous system
+#define ijk_stream_async_max	4096
+
+// most bytes per asynchronous request
+#define ijk_stream_async_bytes	0x40000000
+
+
+typedef struct ijkStreamAsyncState	ijkStreamAsyncState;
+
+
+// internal asynchronous system state; worker threads take requests from a 
+//	queue, each after acquiring the semaphore, which submit posts once per 
+//	request; the kernel ring is a submission ring of request slots and a 
+//	completion ring of results, shared with the kernel
+struct ijkStreamAsyncState
+{
+	size volatile active;				// submitted, not done
+	size pending;						// queued, not submitted
+	size volatile stop;					// stop flag (workers)
+	ijkSemaphore ready[1];				// submitted requests (workers)
+	dword volatile completed;			// completions (workers)
+	dword volatile waiting;				// sleepers on completions (workers)
+	ijkThread* worker;					// worker threads
+	ptr queue;							// queued requests (workers)
+#if (__ijk_cfg_platform != WINDOWS)
+	int ring;							// kernel ring descriptor, or -1
+	unsigned* sqHead, * sqTail, * sqArray;	// submission ring
+	unsigned* cqHead, * cqTail;			// completion ring
+	unsigned sqMask, cqMask;			// ring index masks
+	struct io_uring_sqe* sqe;			// submission slots
+	struct io_uring_cqe* cqe;			// completion slots
+	ptr sqMap, cqMap, sqeMap;			// ring mappings
+	size sqMapSize, cqMapSize, sqeMapSize;	// ring mapping sizes
+#endif	// !WINDOWS
+};
+
+
+// internal completion of request; not touched after done is raised
+ijk_inl void ijkStreamAsyncInternalComplete(ijkStreamRequest* const request, size const bytes)
+{
+	request->bytes = bytes;
+	request->result = (bytes == request->byteCount ? ijk_success : bytes ? ijk_warn_stream_incomplete : ijk_fail_operationfail);
+	ijkAtomicStore(&request->done, ijk_true);
+}
+
+
+// internal worker entry: perform one request per semaphore unit
+iret ijkStreamAsyncInternalWorker(ptr const arg)
+{
+	ijkStreamAsyncState* const state = (ijkStreamAsyncState*)arg;
+	ijkStreamRequest* request;
+	size bytes;
+
+	// requests on one stream run on several workers at once, so each waits 
+	//	on its own event rather than the stream's
+#if (__ijk_cfg_platform == WINDOWS)
+	ptr const event = (ptr)CreateEventA(0, TRUE, FALSE, 0);
+#else	// !WINDOWS
+	ptr const event = 0;
+#endif	// WINDOWS
+	while (ijkSemaphoreAcquireWait(state->ready) == ijk_success && !ijkAtomicLoad(&state->stop))
+	{
+		if (ijkQueuePop(state->queue, &request) == ijk_success)
+		{
+			bytes = (request->isRead
+				? ijkStreamInternalFileRead(request->handle, event, request->data, request->byteCount, request->offset)
+				: ijkStreamInternalFileWrite(request->handle, event, request->data, request->byteCount, request->offset));
+			ijkStreamAsyncInternalComplete(request, bytes);
+
+			// count before waking, so that a sleeper sees either
+			ijkAtomicAdd(&state->active, (size)-1);
+			ijkAtomicAddD(&state->completed, 1);
+			if (ijkAtomicLoadD(&state->waiting))
+				ijkAtomicWakeD(&state->completed, 0);
+		}
+	}
+#if (__ijk_cfg_platform == WINDOWS)
+	if (event)
+		CloseHandle((HANDLE)event);
+#endif	// WINDOWS
+	return ijk_success;
+}
+
+
+#if (__ijk_cfg_platform != WINDOWS)
+// internal kernel ring setup; plain reads and writes need Linux 5.6, 
+//	which is also when probing for them arrived
+ijk_inl ibool ijkStreamAsyncInternalRingCreate(ijkStreamAsyncState* const state, size const capacity)
+{
+	struct io_uring_params params;
+	qword probe[(sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op)) / szqword + 1];
+	struct io_uring_probe* const info = (struct io_uring_probe*)probe;
+	ibool supported;
+	memset(&params, 0, sizeof(params));
+	memset(probe, 0, sizeof(probe));
+	state->ring = (int)syscall(__NR_io_uring_setup, (unsigned)capacity, &params);
+	if (state->ring < 0)
+		return ijk_false;
+	supported = (syscall(__NR_io_uring_register, state->ring, IORING_REGISTER_PROBE, info, 256) == 0 &&
+		info->last_op >= IORING_OP_WRITE &&
+		(info->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) &&
+		(info->ops[IORING_OP_WRITE].flags & IO_URING_OP_SUPPORTED));
+
+	// map rings; newer kernels share one mapping for both
+	state->sqMapSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	state->cqMapSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	state->sqeMapSize = params.sq_entries * sizeof(struct io_uring_sqe);
+	if (params.features & IORING_FEAT_SINGLE_MMAP)
+		state->sqMapSize = state->cqMapSize = ijk_maximum(state->sqMapSize, state->cqMapSize);
+	state->sqMap = state->cqMap = state->sqeMap = MAP_FAILED;
+	if (supported)
+	{
+		state->sqMap = mmap(0, state->sqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED, state->ring, IORING_OFF_SQ_RING);
+		state->cqMap = (params.features & IORING_FEAT_SINGLE_MMAP) ? state->sqMap
+			: mmap(0, state->cqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED, state->ring, IORING_OFF_CQ_RING);
+		state->sqeMap = mmap(0, state->sqeMapSize, PROT_READ | PROT_WRITE, MAP_SHARED, state->ring, IORING_OFF_SQES);
+	}
+	if (state->sqMap == MAP_FAILED || state->cqMap == MAP_FAILED || state->sqeMap == MAP_FAILED)
+	{
+		if (state->sqeMap != MAP_FAILED)
+			munmap(state->sqeMap, state->sqeMapSize);
+		if (state->cqMap != MAP_FAILED && state->cqMap != state->sqMap)
+			munmap(state->cqMap, state->cqMapSize);
+		if (state->sqMap != MAP_FAILED)
+			munmap(state->sqMap, state->sqMapSize);
+		close(state->ring);
+		state->ring = -1;
+		return ijk_false;
+	}
+	state->sqHead = (unsigned*)((pbyte)state->sqMap + params.sq_off.head);
+	state->sqTail = (unsigned*)((pbyte)state->sqMap + params.sq_off.tail);
+	state->sqArray = (unsigned*)((pbyte)state->sqMap + params.sq_off.array);
+	state->sqMask = *(unsigned*)((pbyte)state->sqMap + params.sq_off.ring_mask);
+	state->cqHead = (unsigned*)((pbyte)state->cqMap + params.cq_off.head);
+	state->cqTail = (unsigned*)((pbyte)state->cqMap + params.cq_off.tail);
+	state->cqMask = *(unsigned*)((pbyte)state->cqMap + params.cq_off.ring_mask);
+	state->cqe = (struct io_uring_cqe*)((pbyte)state->cqMap + params.cq_off.cqes);
+	state->sqe = (struct io_uring_sqe*)state->sqeMap;
+	return ijk_true;
+}
+
+
+// internal kernel ring teardown; the kernel cancels anything in flight
+ijk_inl void ijkStreamAsyncInternalRingRelease(ijkStreamAsyncState* const state)
+{
+	munmap(state->sqeMap, state->sqeMapSize);
+	if (state->cqMap != state->sqMap)
+		munmap(state->cqMap, state->cqMapSize);
+	munmap(state->sqMap, state->sqMapSize);
+	close(state->ring);
+	state->ring = -1;
+}
+
+
+// internal kernel ring slot for the rest of a request, not yet submitted
+ijk_inl void ijkStreamAsyncInternalRingPrepare(ijkStreamAsyncState* const state, ijkStreamRequest const* const request)
+{
+	// slot is filled before tail moves past it
+	unsigned const tail = *state->sqTail;
+	unsigned const slot = tail & state->sqMask;
+	struct io_uring_sqe* const sqe = state->sqe + slot;
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = (request->isRead ? IORING_OP_READ : IORING_OP_WRITE);
+	sqe->fd = (int)(size)request->handle;
+	sqe->addr = (qword)(size)(request->data + request->bytes);
+	sqe->len = (unsigned)(request->byteCount - request->bytes);
+	sqe->off = (qword)(request->offset + request->bytes);
+	sqe->user_data = (qword)(size)request;
+	state->sqArray[slot] = slot;
+	__atomic_store_n(state->sqTail, tail + 1, __ATOMIC_RELEASE);
+}
+
+
+// internal kernel ring harvest: complete every result posted; like the 
+//	blocking calls, short transfers and interruptions go back for the rest
+ijk_inl void ijkStreamAsyncInternalRingHarvest(ijkStreamAsyncState* const state)
+{
+	unsigned head = *state->cqHead;
+	unsigned const tail = __atomic_load_n(state->cqTail, __ATOMIC_ACQUIRE);
+	struct io_uring_cqe const* cqe;
+	ijkStreamRequest* request;
+	for (; head != tail; ++head, --state->active)
+	{
+		cqe = state->cqe + (head & state->cqMask);
+		request = (ijkStreamRequest*)(size)cqe->user_data;
+		if (cqe->res > 0)
+			request->bytes += (size)cqe->res;
+		if ((cqe->res > 0 && request->bytes < request->byteCount) || cqe->res == -EINTR)
+		{
+			ijkStreamAsyncInternalRingPrepare(state, request);
+			++state->pending;
+		}
+		else
+			ijkStreamAsyncInternalComplete(request, request->bytes);
+	}
+	__atomic_store_n(state->cqHead, head, __ATOMIC_RELEASE);
+}
+#endif	// !WINDOWS
+
+
+// internal request queue; the request goes nowhere until submitted
+iret ijkStreamAsyncInternalIssue(ijkStreamAsync* const async, ijkStream const* const stream, pbyte const data, size const byteCount, size const offset, ijkStreamRequest* const request, ibool const isRead)
+{
+	ijkStreamAsyncState* const state = (ijkStreamAsyncState*)async->data;
+
+	// harvest to make room if full
+	if (state->pending + ijkAtomicLoad(&state->active) >= async->capacity)
+	{
+		ijkStreamAsyncPoll(async, 0);
+		if (state->pending + ijkAtomicLoad(&state->active) >= async->capacity)
+			return ijk_fail_operationfail;
+	}
+	request->data = data;
+	request->byteCount = byteCount;
+	request->offset = offset;
+	request->handle = stream->handle;
+	request->bytes = 0;
+	request->result = ijk_success;
+	request->done = ijk_false;
+	request->isRead = isRead;
+	if (async->workerCount)
+	{
+		// capacity of queue is above capacity of system
+		if (ijkQueuePush(state->queue, &request) != ijk_success)
+			return ijk_fail_operationfail;
+	}
+#if (__ijk_cfg_platform != WINDOWS)
+	else
+		ijkStreamAsyncInternalRingPrepare(state, request);
+#endif	// !WINDOWS
+	++state->pending;
+	return ijk_success;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkStreamAsyncCreate(ijkStreamAsync* const async_out, size const capacity, size const workerCount, ibool const kernelRing)
+{
+	if (async_out && capacity && capacity <= ijk_stream_async_max && workerCount &&
+		!async_out->data)
+	{
+		// queue of at least twice the capacity in cache lines leaves room for 
+		//	its header and for rounding down to a power of two
+		size const queueSize = (capacity * 2 + 8) * 64;
+		ijkStreamAsyncState* const state = (ijkStreamAsyncState*)malloc(sizeof(ijkStreamAsyncState) + workerCount * sizeof(ijkThread) + queueSize);
+		tag const name = "ijkStreamAsync";
+		size i;
+		if (state)
+		{
+			memset(state, 0, sizeof(ijkStreamAsyncState) + workerCount * sizeof(ijkThread));
+			state->worker = (ijkThread*)(state + 1);
+			state->queue = state->worker + workerCount;
+			async_out->data = state;
+			async_out->capacity = capacity;
+#if (__ijk_cfg_platform != WINDOWS)
+			state->ring = -1;
+			if (kernelRing && ijkStreamAsyncInternalRingCreate(state, capacity))
+			{
+				async_out->workerCount = 0;
+				return ijk_success;
+			}
+#endif	// !WINDOWS
+
+			// worker threads
+			if (ijkSemaphoreCreate(state->ready, 0) == ijk_success &&
+				ijkQueueCreate(state->queue, queueSize, sizeof(ijkStreamRequest*), ijkQueueMode_mpmc) == ijk_success)
+			{
+				for (i = 0; i < workerCount; ++i)
+					if (ijkThreadCreate(state->worker + i, ijkStreamAsyncInternalWorker, state, name) != ijk_success)
+						break;
+
+				// run with those that launched
+				if (i)
+				{
+					async_out->workerCount = i;
+					return ijk_success;
+				}
+				ijkQueueRelease(state->queue);
+			}
+			async_out->data = 0;
+			free(state);
+		}
+
+		// failed
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkStreamAsyncRelease(ijkStreamAsync* const async)
+{
+	if (async &&
+		async->data)
+	{
+		ijkStreamAsyncState* const state = (ijkStreamAsyncState*)async->data;
+		iret result = ijk_success;
+		size i;
+
+		// buffers belong to callers, so let everything finish
+		ijkStreamAsyncWait(async, 0);
+		if (async->workerCount)
+		{
+			// one unit per worker, each stops after taking it
+			ijkAtomicStore(&state->stop, ijk_true);
+			ijkSemaphorePost(state->ready, (dword)async->workerCount);
+			for (i = 0; i < async->workerCount; ++i)
+				if (ijkThreadRelease(state->worker + i) != ijk_success)
+					result = ijk_fail_operationfail;
+			ijkQueueRelease(state->queue);
+		}
+#if (__ijk_cfg_platform != WINDOWS)
+		else
+			ijkStreamAsyncInternalRingRelease(state);
+#endif	// !WINDOWS
+		free(state);
+		async->data = 0;
+		async->capacity = 0;
+		async->workerCount = 0;
+		return result;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkStreamReadAsync(ijkStreamAsync* const async, ijkStream const* const stream, ptr const data, size const byteCount, size const offset, ijkStreamRequest* const request_out)
+{
+	if (async && stream && data && byteCount && byteCount <= ijk_stream_async_bytes && request_out &&
+		async->data && stream->base && stream->isBuffered && stream->isRead)
+	{
+		return ijkStreamAsyncInternalIssue(async, stream, (pbyte)data, byteCount, offset, request_out, ijk_true);
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkStreamWriteAsync(ijkStreamAsync* const async, ijkStream const* const stream, kptr const data, size const byteCount, size const offset, ijkStreamRequest* const request_out)
+{
+	if (async && stream && data && byteCount && byteCount <= ijk_stream_async_bytes && request_out &&
+		async->data && stream->base && stream->isBuffered && !stream->isRead)
+	{
+		return ijkStreamAsyncInternalIssue(async, stream, (pbyte)data, byteCount, offset, request_out, ijk_false);
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkStreamAsyncSubmit(ijkStreamAsync* const async)
+{
+	if (async &&
+		async->data)
+	{
+		ijkStreamAsyncState* const state = (ijkStreamAsyncState*)async->data;
+		if (state->pending)
+		{
+			// active first: a worker may finish before the post returns
+			if (async->workerCount)
+			{
+				ijkAtomicAdd(&state->active, state->pending);
+				ijkSemaphorePost(state->ready, (dword)state->pending);
+				state->pending = 0;
+			}
+#if (__ijk_cfg_platform != WINDOWS)
+			else
+			{
+				// one system call for the whole batch
+				long const result = syscall(__NR_io_uring_enter, state->ring, (unsigned)state->pending, 0, 0, 0, 0);
+				if (result <= 0)
+					return ijk_fail_operationfail;
+				state->pending -= (size)result;
+				state->active += (size)result;
+			}
+#endif	// !WINDOWS
+		}
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkStreamAsyncPoll(ijkStreamAsync* const async, size* const count_out_opt)
+{
+	if (async &&
+		async->data)
+	{
+		ijkStreamAsyncState* const state = (ijkStreamAsyncState*)async->data;
+		ijkStreamAsyncSubmit(async);
+#if (__ijk_cfg_platform != WINDOWS)
+		if (!async->workerCount)
+		{
+			// send back what harvesting resubmitted
+			ijkStreamAsyncInternalRingHarvest(state);
+			ijkStreamAsyncSubmit(async);
+		}
+#endif	// !WINDOWS
+		if (count_out_opt)
+			*count_out_opt = state->pending + ijkAtomicLoad(&state->active);
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkStreamAsyncWait(ijkStreamAsync* const async, ijkStreamRequest const* const request_opt)
+{
+	if (async &&
+		async->data)
+	{
+		ijkStreamAsyncState* const state = (ijkStreamAsyncState*)async->data;
+		size count;
+		dword completed;
+		ijkStreamAsyncPoll(async, &count);
+		while (request_opt ? !ijkAtomicLoad(&request_opt->done) : count)
+		{
+			if (async->workerCount)
+			{
+				// sleep until a completion after the one counted
+				completed = ijkAtomicLoadD(&state->completed);
+				ijkAtomicAddD(&state->waiting, 1);
+				if (request_opt ? !ijkAtomicLoad(&request_opt->done) : ijkAtomicLoad(&state->active))
+					ijkAtomicWaitD(&state->completed, completed);
+				ijkAtomicAddD(&state->waiting, (dword)-1);
+			}
+#if (__ijk_cfg_platform != WINDOWS)
+			else
+			{
+				// nothing the kernel has can complete what is left
+				if (!state->active)
+					return ijk_fail_operationfail;
+				if (syscall(__NR_io_uring_enter, state->ring, 0, 1, IORING_ENTER_GETEVENTS, 0, 0) < 0 && errno != EINTR)
+					return ijk_fail_operationfail;
+			}
+#endif	// !WINDOWS
+			ijkStreamAsyncPoll(async, &count);
+		}
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkStreamRequestIsDone(ijkStreamRequest const* const request)
+{
+	if (request)
+	{
+		return (ijkAtomicLoad(&request->done) != 0);
+	}
+	return ijk_fail_invalidparams;
+}
+
+
 //-----------------------------------------------------------------------------
 
 #if (__ijk_cfg_platform == WINDOWS)
@@ -270,9 +1324,9 @@ iret ijkStreamMakeDirectory(kcstr const directory)
 	{
 		iret const result =
 #if (__ijk_cfg_platform == WINDOWS)
-			_mkdir(directory);
+			_mkdir((char const*)directory);
 #else	// !WINDOWS
-			mkdir(directory, 0700);
+			mkdir((char const*)directory, 0700);
 #endif	// WINDOWS
 		return (result * 2);
 	}
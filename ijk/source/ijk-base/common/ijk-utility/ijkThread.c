@@ -29,15 +29,48 @@
 // include platform APIs
 #if (__ijk_cfg_platform == WINDOWS)
 #include <Windows.h>
+#pragma comment(lib, "Synchronization.lib")
+#define ijk_thread_local	__declspec(thread)
 #else	// !WINDOWS
+#define _GNU_SOURCE		// thread names and affinity
 #include <pthread.h>
-#include <signal.h>
+#include <sched.h>
+#include <limits.h>
 #include <sys/types.h>
+#include <sys/syscall.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#define ijk_thread_local	__thread
 #endif	// WINDOWS
 
 
 //-----------------------------------------------------------------------------
 
+// descriptor of calling thread, if created by ijk
+static ijk_thread_local ijkThread* ijkThreadInternalCurrent;
+
+#if (__ijk_cfg_platform != WINDOWS)
+// gettid is a system call; cache per thread since mutexes query it always
+static ijk_thread_local dword ijkThreadInternalSysID;
+
+// pthread handle, held as the first internal handle of a descriptor
+#define ijk_thread_pthread(thread)	((pthread_t)*(thread)->handle)
+#endif	// !WINDOWS
+
+
+dword ijkThreadInternalGetSysID()
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	return GetCurrentThreadId();
+#else	// !WINDOWS
+	if (!ijkThreadInternalSysID)
+		ijkThreadInternalSysID = (dword)gettid();
+	return ijkThreadInternalSysID;
+#endif	// WINDOWS
+}
+
+
 // internal name set function
 // from "How to: Set a Thread Name in Native Code"
 // msdn.microsoft.com
@@ -82,8 +115,15 @@ iret ijkThreadInternalSetName(dword id, kptag name)
 #pragma warning(pop)
 		return ijk_success;
 #else	// !(defined _WINDOWS || defined _WIN32)
-		// do rename
-		return ijk_success;
+		// names are limited to 15 characters; only the calling thread is 
+		//	renamed, which is the only use here
+		char shortName[16] = { 0 };
+		size i;
+		for (i = 0; i < sizeof(shortName) - 1 && name[i]; ++i)
+			shortName[i] = name[i];
+		if (ijk_issuccess(pthread_setname_np(pthread_self(), shortName)))
+			return ijk_success;
+		return ijk_fail_operationfail;
 #endif	// (defined _WINDOWS || defined _WIN32)
 	}
 	return ijk_fail_invalidparams;
@@ -95,30 +135,36 @@ iret ijkThreadInternalSetName(dword id, kptag name)
 iret __stdcall ijkThreadInternalEntryFunc(ijkThread* const thread)
 {
 #else	// !WINDOWS
-ptr ijkThreadInternalEntryFunc(ijkThread* const thread)
+ptr ijkThreadInternalEntryFunc(ptr const arg)
 {
-	// push "not complete" flag
-	// set "not complete" parameter to not-complete
+	ijkThread* const thread = (ijkThread*)arg;
+
+	// priority is per thread only once the thread has a system ID
+	if (thread->priority != ijkThreadPriority_normal)
+		ijkThreadSetPriority(0, thread->priority);
 #endif	// WINDOWS
 
 	// change name of thread before execution so we can identify it
 	if (*thread->name)
 		ijkThreadInternalSetName(-1, thread->name);
+	ijkThreadInternalCurrent = thread;
 
-	// call thread entry function, raising active flag before and lower after
-	thread->active = ijk_true;
-	thread->result = thread->entryFunc(thread->entryArg);
-	thread->active = ijk_false;
+	// raise active flag, then publish ID to creator
+	ijkAtomicStoreD((dword volatile*)&thread->active, ijk_true);
+#if (__ijk_cfg_platform != WINDOWS)
+	ijkAtomicStoreD(&thread->sysID, ijkThreadInternalGetSysID());
+	ijkAtomicWakeD(&thread->sysID, 0);
+#endif	// !WINDOWS
 
-	// reset handle and ID
-	thread->sysID = 0;
-	*thread->handle = 0;
+	// call thread entry function; ID is kept until thread is released 
+	//	(joined), so it identifies the handle even after return
+	thread->result = thread->entryFunc(thread->entryArg);
+	ijkAtomicStoreD((dword volatile*)&thread->active, ijk_false);
 
 #if (__ijk_cfg_platform == WINDOWS)
 	return thread->result;
 }
 #else	// !WINDOWS
-	// pop "non complete" flag
 	return thread;
 }
 #endif	// WINDOWS
@@ -127,24 +173,77 @@ ptr ijkThreadInternalEntryFunc(ijkThread* const thread)
 //-----------------------------------------------------------------------------
 
 iret ijkThreadCreate(ijkThread* const thread_out, ijkThreadEntryFunc const entryFunc, ptr const entryArg, tag const name)
+{
+	return ijkThreadCreateExt(thread_out, entryFunc, entryArg, name, 0, 0, ijkThreadPriority_normal);
+}
+
+
+iret ijkThreadCreateExt(ijkThread* const thread_out, ijkThreadEntryFunc const entryFunc, ptr const entryArg, tag const name, size const stackSize, size const affinity, ijkThreadPriority const priority)
 {
 	// validate parameters
 	if (thread_out && entryFunc &&
-		!*thread_out->handle)
+		!*thread_out->handle &&
+		priority >= ijkThreadPriority_lowest && priority <= ijkThreadPriority_highest)
 	{
+#if (__ijk_cfg_platform == WINDOWS)
+		dword sysID = 0;
+#else	// !WINDOWS
+		pthread_attr_t attr;
+		pthread_t handle;
+		cpu_set_t set;
+		size i;
+		ibool launched;
+#endif	// WINDOWS
+
 		// default values
+		thread_out->sysID = 0;
 		thread_out->active = ijk_false;
+		thread_out->cancel = ijk_false;
 		thread_out->result = ijk_failure;
 		thread_out->entryFunc = entryFunc;
 		thread_out->entryArg = entryArg;
+		thread_out->priority = priority;
+		thread_out->affinity = affinity;
 		ijk_copytag(thread_out->name, name);
 
 		// launch
 #if (__ijk_cfg_platform == WINDOWS)
-		* thread_out->handle = CreateThread(0, 0, ijkThreadInternalEntryFunc, thread_out, 0, &thread_out->sysID);
+		// suspended, so that cores and priority apply before entry
+		* thread_out->handle = CreateThread(0, stackSize, ijkThreadInternalEntryFunc, thread_out,
+			CREATE_SUSPENDED | (stackSize ? STACK_SIZE_PARAM_IS_A_RESERVATION : 0), &sysID);
+		if (*thread_out->handle)
+		{
+			thread_out->sysID = sysID;
+			if (affinity)
+				SetThreadAffinityMask(*thread_out->handle, (DWORD_PTR)affinity);
+			if (priority != ijkThreadPriority_normal)
+				SetThreadPriority(*thread_out->handle, (int)priority);
+			ResumeThread(*thread_out->handle);
+		}
 #else	// !WINDOWS
-		thread_out->sysID = 1;
-		pthread_create((pthread_t*)thread_out->handle, 0, ijkThreadInternalEntryFunc, thread_out);
+		pthread_attr_init(&attr);
+		if (stackSize)
+			pthread_attr_setstacksize(&attr, (stackSize < (size)PTHREAD_STACK_MIN ? (size)PTHREAD_STACK_MIN : stackSize + 0xFFF) & ~(size)0xFFF);
+		if (affinity)
+		{
+			CPU_ZERO(&set);
+			for (i = 0; i < szchomp * 8 && i < CPU_SETSIZE; ++i)
+				if (affinity & ((size)1 << i))
+					CPU_SET(i, &set);
+			pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+		}
+		launched = ijk_issuccess(pthread_create(&handle, &attr, ijkThreadInternalEntryFunc, thread_out));
+		pthread_attr_destroy(&attr);
+
+		// wait for thread to publish its system ID
+		if (launched)
+		{
+			*thread_out->handle = (ptr)handle;
+			while (!ijkAtomicLoadD(&thread_out->sysID))
+				ijkAtomicWaitD(&thread_out->sysID, 0);
+		}
+		else
+			*thread_out->handle = 0;
 #endif	// WINDOWS
 
 		// success
@@ -165,9 +264,10 @@ iret ijkThreadRelease(ijkThread* const thread)
 	{
 		ibool result;
 #if (__ijk_cfg_platform == WINDOWS)
-		result = (WaitForSingleObject(*thread->handle, INFINITE) == WAIT_OBJECT_0);
+		result = (WaitForSingleObject(*thread->handle, INFINITE) == WAIT_OBJECT_0)
+			&& ijk_istrue(CloseHandle(*thread->handle));
 #else	// !WINDOWS
-		result = ijk_issuccess(pthread_join(*(pthread_t*)thread->handle, 0));
+		result = ijk_issuccess(pthread_join(ijk_thread_pthread(thread), 0));
 #endif	// WINDOWS
 
 		// success
@@ -192,18 +292,23 @@ iret ijkThreadReleaseUnsafe(ijkThread* const thread)
 		*thread->handle)
 	{
 		ibool result;
+		ijkAtomicStoreD((dword volatile*)&thread->cancel, ijk_true);
 #if (__ijk_cfg_platform == WINDOWS)
 		// unsafe because TerminateThread does not allow thread to clean up
 		// https://docs.microsoft.com/en-us/cpp/code-quality/c6258?view=vs-2019
 		result = ijk_istrue(TerminateThread(*thread->handle, ijk_failure))
 			&& ijk_istrue(CloseHandle(*thread->handle));
 #else	// !WINDOWS
-		result = ijk_issuccess(pthread_kill(*(pthread_t*)thread->handle, SIGKILL));
+		// signals would take down the whole process; cancel the thread at 
+		//	its next cancellation point instead and reclaim it
+		result = ijk_issuccess(pthread_cancel(ijk_thread_pthread(thread)))
+			&& ijk_issuccess(pthread_join(ijk_thread_pthread(thread), 0));
 #endif	// WINDOWS
 
 		// success
 		if (result)
 		{
+			thread->active = ijk_false;
 			thread->sysID = 0;
 			*thread->handle = 0;
 			return ijk_success;
@@ -227,7 +332,8 @@ iret ijkThreadCheckActive(ijkThread const* const thread)
 		if (result == STILL_ACTIVE)
 			return ijk_true;
 #else	// !WINDOWS
-		// check if "not complete" flag is set non-complete
+		if (ijkAtomicLoadD((dword volatile const*)&thread->active))
+			return ijk_true;
 #endif	// WINDOWS
 
 			// inactive
@@ -237,16 +343,758 @@ iret ijkThreadCheckActive(ijkThread const* const thread)
 }
 
 
+iret ijkThreadCancel(ijkThread* const thread)
+{
+	if (thread &&
+		*thread->handle)
+	{
+		ijkAtomicStoreD((dword volatile*)&thread->cancel, ijk_true);
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkThreadCheckCancel()
+{
+	ijkThread const* const thread = ijkThreadInternalCurrent;
+	return (thread && ijkAtomicLoadD((dword volatile const*)&thread->cancel));
+}
+
+
+iret ijkThreadGetCurrent(ijkThread const** const thread_out)
+{
+	if (thread_out)
+	{
+		*thread_out = ijkThreadInternalCurrent;
+		return (*thread_out ? ijk_success : ijk_fail_operationfail);
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkThreadSetAffinity(ijkThread* const thread_opt, size const affinity)
+{
+	if (!thread_opt || *thread_opt->handle)
+	{
+		ibool result;
+#if (__ijk_cfg_platform == WINDOWS)
+		HANDLE const handle = thread_opt ? *thread_opt->handle : GetCurrentThread();
+		DWORD_PTR mask = (DWORD_PTR)affinity, process, system;
+		if (!mask && GetProcessAffinityMask(GetCurrentProcess(), &process, &system))
+			mask = process;
+		result = (SetThreadAffinityMask(handle, mask) != 0);
+#else	// !WINDOWS
+		pthread_t const handle = thread_opt ? ijk_thread_pthread(thread_opt) : pthread_self();
+		cpu_set_t set;
+		size i;
+		CPU_ZERO(&set);
+		for (i = 0; i < CPU_SETSIZE; ++i)
+			if (affinity ? (i < szchomp * 8 && (affinity & ((size)1 << i))) : ijk_true)
+				CPU_SET(i, &set);
+		result = ijk_issuccess(pthread_setaffinity_np(handle, sizeof(set), &set));
+#endif	// WINDOWS
+
+		// success
+		if (result)
+		{
+			if (thread_opt)
+				thread_opt->affinity = affinity;
+			else if (ijkThreadInternalCurrent)
+				ijkThreadInternalCurrent->affinity = affinity;
+			return ijk_success;
+		}
+
+		// failure
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkThreadSetPriority(ijkThread* const thread_opt, ijkThreadPriority const priority)
+{
+	if ((!thread_opt || *thread_opt->handle) &&
+		priority >= ijkThreadPriority_lowest && priority <= ijkThreadPriority_highest)
+	{
+		ibool result;
+#if (__ijk_cfg_platform == WINDOWS)
+		HANDLE const handle = thread_opt ? *thread_opt->handle : GetCurrentThread();
+		result = ijk_istrue(SetThreadPriority(handle, (int)priority));
+#else	// !WINDOWS
+		// time-sharing threads have no priority of their own, but on Linux 
+		//	nice values apply per thread; five steps per level
+		dword const sysID = thread_opt ? ijkAtomicLoadD(&thread_opt->sysID) : ijkThreadInternalGetSysID();
+		result = ijk_issuccess(setpriority(PRIO_PROCESS, (id_t)sysID, -5 * (int)priority));
+#endif	// WINDOWS
+
+		// success
+		if (result)
+		{
+			if (thread_opt)
+				thread_opt->priority = priority;
+			else if (ijkThreadInternalCurrent)
+				ijkThreadInternalCurrent->priority = priority;
+			return ijk_success;
+		}
+
+		// failure
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkThreadGetCoreCount(size* const count_out)
+{
+	if (count_out)
+	{
+#if (__ijk_cfg_platform == WINDOWS)
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		*count_out = (size)info.dwNumberOfProcessors;
+#else	// !WINDOWS
+		long const count = sysconf(_SC_NPROCESSORS_ONLN);
+		*count_out = (count > 0) ? (size)count : 1;
+#endif	// WINDOWS
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
 //-----------------------------------------------------------------------------
 
-dword ijkThreadInternalGetSysID()
+size ijkAtomicLoad(size volatile const* const value)
 {
 #if (__ijk_cfg_platform == WINDOWS)
-	return GetCurrentThreadId();
+	// aligned loads are atomic with acquire ordering on x86/x64
+	size const result = *value;
+	_ReadWriteBarrier();
+	return result;
 #else	// !WINDOWS
-	return gettid();
+	return __atomic_load_n(value, __ATOMIC_ACQUIRE);
 #endif	// WINDOWS
 }
 
 
+size ijkAtomicStore(size volatile* const value, size const desired)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	// aligned stores are atomic with release ordering on x86/x64
+	_ReadWriteBarrier();
+	*value = desired;
+#else	// !WINDOWS
+	__atomic_store_n(value, desired, __ATOMIC_RELEASE);
+#endif	// WINDOWS
+	return desired;
+}
+
+
+size ijkAtomicExchange(size volatile* const value, size const desired)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	return (size)InterlockedExchangePointer((PVOID volatile*)value, (PVOID)desired);
+#else	// !WINDOWS
+	return __atomic_exchange_n(value, desired, __ATOMIC_SEQ_CST);
+#endif	// WINDOWS
+}
+
+
+size ijkAtomicCompareExchange(size volatile* const value, size const desired, size const expected)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	return (size)InterlockedCompareExchangePointer((PVOID volatile*)value, (PVOID)desired, (PVOID)expected);
+#else	// !WINDOWS
+	size result = expected;
+	__atomic_compare_exchange_n(value, &result, desired, ijk_false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+	return result;
+#endif	// WINDOWS
+}
+
+
+size ijkAtomicAdd(size volatile* const value, size const delta)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+#if (__ijk_cfg_archbits == 64)
+	return (size)InterlockedExchangeAdd64((LONG64 volatile*)value, (LONG64)delta);
+#else	// !64
+	return (size)InterlockedExchangeAdd((LONG volatile*)value, (LONG)delta);
+#endif	// 64
+#else	// !WINDOWS
+	return __atomic_fetch_add(value, delta, __ATOMIC_SEQ_CST);
+#endif	// WINDOWS
+}
+
+
+qword ijkAtomicLoadQ(qword volatile const* const value)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+#if (__ijk_cfg_archbits == 64)
+	qword const result = *value;
+	_ReadWriteBarrier();
+	return result;
+#else	// !64
+	// 32-bit loads may tear; exchanging zero for zero reads atomically
+	return (qword)InterlockedCompareExchange64((LONG64 volatile*)value, 0, 0);
+#endif	// 64
+#else	// !WINDOWS
+	return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+#endif	// WINDOWS
+}
+
+
+qword ijkAtomicCompareExchangeQ(qword volatile* const value, qword const desired, qword const expected)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	return (qword)InterlockedCompareExchange64((LONG64 volatile*)value, (LONG64)desired, (LONG64)expected);
+#else	// !WINDOWS
+	qword result = expected;
+	__atomic_compare_exchange_n(value, &result, desired, ijk_false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+	return result;
+#endif	// WINDOWS
+}
+
+
+void ijkAtomicPause()
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	YieldProcessor();
+#elif (defined __i386__ || defined __x86_64__)
+	__builtin_ia32_pause();
+#else	// !x86
+	__asm__ __volatile__("" ::: "memory");
+#endif	// WINDOWS
+}
+
+
+dword ijkAtomicLoadD(dword volatile const* const value)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	dword const result = *value;
+	_ReadWriteBarrier();
+	return result;
+#else	// !WINDOWS
+	return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+#endif	// WINDOWS
+}
+
+
+dword ijkAtomicStoreD(dword volatile* const value, dword const desired)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	_ReadWriteBarrier();
+	*value = desired;
+#else	// !WINDOWS
+	__atomic_store_n(value, desired, __ATOMIC_RELEASE);
+#endif	// WINDOWS
+	return desired;
+}
+
+
+dword ijkAtomicExchangeD(dword volatile* const value, dword const desired)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	return (dword)InterlockedExchange((LONG volatile*)value, (LONG)desired);
+#else	// !WINDOWS
+	return __atomic_exchange_n(value, desired, __ATOMIC_SEQ_CST);
+#endif	// WINDOWS
+}
+
+
+dword ijkAtomicCompareExchangeD(dword volatile* const value, dword const desired, dword const expected)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	return (dword)InterlockedCompareExchange((LONG volatile*)value, (LONG)desired, (LONG)expected);
+#else	// !WINDOWS
+	dword result = expected;
+	__atomic_compare_exchange_n(value, &result, desired, ijk_false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+	return result;
+#endif	// WINDOWS
+}
+
+
+dword ijkAtomicAddD(dword volatile* const value, dword const delta)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	return (dword)InterlockedExchangeAdd((LONG volatile*)value, (LONG)delta);
+#else	// !WINDOWS
+	return __atomic_fetch_add(value, delta, __ATOMIC_SEQ_CST);
+#endif	// WINDOWS
+}
+
+
+dword ijkAtomicWaitD(dword volatile* const value, dword const expected)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	WaitOnAddress(value, (PVOID)&expected, sizeof(expected), INFINITE);
+#else	// !WINDOWS
+	// returns immediately if value no longer holds expected
+	syscall(SYS_futex, value, FUTEX_WAIT_PRIVATE, expected, 0, 0, 0);
+#endif	// WINDOWS
+	return ijkAtomicLoadD(value);
+}
+
+
+dword ijkAtomicWakeD(dword volatile* const value, dword const count)
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	dword i;
+	if (count)
+		for (i = 0; i < count; ++i)
+			WakeByAddressSingle((PVOID)value);
+	else
+		WakeByAddressAll((PVOID)value);
+#else	// !WINDOWS
+	syscall(SYS_futex, value, FUTEX_WAKE_PRIVATE, (count && count < 0x7FFFFFFF) ? (int)count : 0x7FFFFFFF, 0, 0, 0);
+#endif	// WINDOWS
+	return count;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// mutex states: unlocked, locked, locked with possible sleepers
+#define ijk_mutex_unlocked	0
+#define ijk_mutex_locked	1
+#define ijk_mutex_contended	2
+
+// number of polls before a blocked wait goes to sleep (all primitives)
+#define ijk_sync_spin		64
+
+
+iret ijkMutexLock(ijkMutex* const mutex)
+{
+	if (mutex)
+	{
+		dword const caller = ijkThreadInternalGetSysID();
+		if (ijkAtomicLoadD(&mutex->sysID) != caller)
+		{
+			if (ijkAtomicCompareExchangeD(&mutex->state, ijk_mutex_locked, ijk_mutex_unlocked) == ijk_mutex_unlocked)
+			{
+				// set ID
+				ijkAtomicStoreD(&mutex->sysID, caller);
+
+				// success
+				return ijk_success;
+			}
+
+			// failure
+			return ijk_fail_operationfail;
+		}
+
+		// warning
+		return ijk_warn_mutex_current;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMutexLockWait(ijkMutex* const mutex)
+{
+	if (mutex)
+	{
+		dword const caller = ijkThreadInternalGetSysID();
+		if (ijkAtomicLoadD(&mutex->sysID) != caller)
+		{
+			dword state = ijkAtomicCompareExchangeD(&mutex->state, ijk_mutex_locked, ijk_mutex_unlocked);
+			uitr i;
+
+			// spin while holder is likely to release soon, polling with 
+			//	plain loads so the cache line is not stolen from the holder
+			for (i = 0; state != ijk_mutex_unlocked && i < ijk_sync_spin; ++i)
+			{
+				ijkAtomicPause();
+				if (ijkAtomicLoadD(&mutex->state) == ijk_mutex_unlocked)
+					state = ijkAtomicCompareExchangeD(&mutex->state, ijk_mutex_locked, ijk_mutex_unlocked);
+			}
+
+			// still held: mark contended and sleep until woken; whoever 
+			//	acquires here keeps the contended state so its unlock wakes 
+			//	the next sleeper
+			if (state != ijk_mutex_unlocked)
+			{
+				state = ijkAtomicExchangeD(&mutex->state, ijk_mutex_contended);
+				while (state != ijk_mutex_unlocked)
+				{
+					ijkAtomicWaitD(&mutex->state, ijk_mutex_contended);
+					state = ijkAtomicExchangeD(&mutex->state, ijk_mutex_contended);
+				}
+			}
+
+			// set ID
+			ijkAtomicStoreD(&mutex->sysID, caller);
+
+			// success
+			return ijk_success;
+		}
+
+		// warning
+		return ijk_warn_mutex_current;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkMutexUnlock(ijkMutex* const mutex)
+{
+	if (mutex)
+	{
+		dword const caller = ijkThreadInternalGetSysID();
+		if (ijkAtomicLoadD(&mutex->sysID) == caller)
+		{
+			// reset ID before release so the next holder's ID is not lost
+			ijkAtomicStoreD(&mutex->sysID, 0);
+
+			// release and wake one sleeper if there may be any
+			if (ijkAtomicExchangeD(&mutex->state, ijk_mutex_unlocked) == ijk_mutex_contended)
+				ijkAtomicWakeD(&mutex->state, 1);
+
+			// success
+			return ijk_success;
+		}
+
+		// failure
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkEventCreate(ijkEvent* const event_out, ibool const manual, ibool const signaled)
+{
+	if (event_out)
+	{
+		event_out->manual = (manual != ijk_false);
+		ijkAtomicStoreD(&event_out->waiting, 0);
+		ijkAtomicStoreD(&event_out->state, (signaled != ijk_false));
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkEventSignal(ijkEvent* const event)
+{
+	if (event)
+	{
+		// set before checking for sleepers; a waiter counts itself before 
+		//	checking state, so one of the two sees the other
+		ijkAtomicExchangeD(&event->state, 1);
+		if (ijkAtomicLoadD(&event->waiting))
+			ijkAtomicWakeD(&event->state, event->manual ? 0 : 1);
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkEventReset(ijkEvent* const event)
+{
+	if (event)
+	{
+		ijkAtomicStoreD(&event->state, 0);
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkEventCheck(ijkEvent* const event)
+{
+	if (event)
+	{
+		// manual: just look; auto: consume signal so only one passes
+		if (event->manual)
+			return (ijkAtomicLoadD(&event->state) != 0);
+		return (ijkAtomicLoadD(&event->state) && ijkAtomicCompareExchangeD(&event->state, 0, 1) == 1);
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkEventWait(ijkEvent* const event)
+{
+	if (event)
+	{
+		uitr i;
+		ibool done = ijkEventCheck(event);
+		for (i = 0; !done && i < ijk_sync_spin; ++i)
+		{
+			ijkAtomicPause();
+			done = ijkEventCheck(event);
+		}
+
+		// sleep while unsignaled; woken auto-reset waiters may lose the 
+		//	signal to another thread and go back to sleep
+		if (!done)
+		{
+			ijkAtomicAddD(&event->waiting, 1);
+			while (!ijkEventCheck(event))
+				ijkAtomicWaitD(&event->state, 0);
+			ijkAtomicAddD(&event->waiting, (dword)-1);
+		}
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkSemaphoreCreate(ijkSemaphore* const semaphore_out, dword const count)
+{
+	if (semaphore_out)
+	{
+		ijkAtomicStoreD(&semaphore_out->waiting, 0);
+		ijkAtomicStoreD(&semaphore_out->count, count);
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkSemaphoreAcquire(ijkSemaphore* const semaphore)
+{
+	if (semaphore)
+	{
+		dword count = ijkAtomicLoadD(&semaphore->count), prev;
+		while (count)
+		{
+			prev = ijkAtomicCompareExchangeD(&semaphore->count, count - 1, count);
+			if (prev == count)
+				return ijk_success;
+			count = prev;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkSemaphoreAcquireWait(ijkSemaphore* const semaphore)
+{
+	if (semaphore)
+	{
+		uitr i;
+		iret status = ijkSemaphoreAcquire(semaphore);
+		for (i = 0; status != ijk_success && i < ijk_sync_spin; ++i)
+		{
+			ijkAtomicPause();
+			status = ijkSemaphoreAcquire(semaphore);
+		}
+
+		// sleep while empty
+		if (status != ijk_success)
+		{
+			ijkAtomicAddD(&semaphore->waiting, 1);
+			while (ijkSemaphoreAcquire(semaphore) != ijk_success)
+				ijkAtomicWaitD(&semaphore->count, 0);
+			ijkAtomicAddD(&semaphore->waiting, (dword)-1);
+		}
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkSemaphorePost(ijkSemaphore* const semaphore, dword const count)
+{
+	if (semaphore && count)
+	{
+		// add before checking for sleepers, as with event
+		ijkAtomicAddD(&semaphore->count, count);
+		if (ijkAtomicLoadD(&semaphore->waiting))
+			ijkAtomicWakeD(&semaphore->count, count);
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+// reader-writer lock state: reader count, or writer bit
+#define ijk_rwlock_writer	0x80000000
+
+
+iret ijkRWLockRead(ijkRWLock* const lock)
+{
+	if (lock)
+	{
+		// readers stay out while any writer holds or waits
+		dword state;
+		if (!ijkAtomicLoadD(&lock->writers))
+		{
+			state = ijkAtomicLoadD(&lock->state);
+			if (!(state & ijk_rwlock_writer) && ijkAtomicCompareExchangeD(&lock->state, state + 1, state) == state)
+				return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkRWLockReadWait(ijkRWLock* const lock)
+{
+	if (lock)
+	{
+		uitr i;
+		dword writers;
+		iret status = ijkRWLockRead(lock);
+		for (i = 0; status != ijk_success && i < ijk_sync_spin; ++i)
+		{
+			ijkAtomicPause();
+			status = ijkRWLockRead(lock);
+		}
+
+		// sleep while writers hold or wait; the last writer out wakes all 
+		//	readers, otherwise only lost races with other readers remain
+		while (status != ijk_success)
+		{
+			writers = ijkAtomicLoadD(&lock->writers);
+			if (writers)
+				ijkAtomicWaitD(&lock->writers, writers);
+			else
+				ijkAtomicPause();
+			status = ijkRWLockRead(lock);
+		}
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkRWLockReadUnlock(ijkRWLock* const lock)
+{
+	if (lock)
+	{
+		dword const state = ijkAtomicLoadD(&lock->state);
+		if (state && !(state & ijk_rwlock_writer))
+		{
+			// last reader out wakes a writer if any wait
+			if (ijkAtomicAddD(&lock->state, (dword)-1) == 1 && ijkAtomicLoadD(&lock->writers))
+				ijkAtomicWakeD(&lock->state, 1);
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkRWLockWrite(ijkRWLock* const lock)
+{
+	if (lock)
+	{
+		// count self as writer first so readers back off, then take it
+		ijkAtomicAddD(&lock->writers, 1);
+		if (ijkAtomicCompareExchangeD(&lock->state, ijk_rwlock_writer, 0) == 0)
+			return ijk_success;
+
+		// failed: if readers were held back by this attempt alone, let 
+		//	them through
+		if (ijkAtomicAddD(&lock->writers, (dword)-1) == 1)
+			ijkAtomicWakeD(&lock->writers, 0);
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkRWLockWriteWait(ijkRWLock* const lock)
+{
+	if (lock)
+	{
+		uitr i;
+		dword state;
+		ijkAtomicAddD(&lock->writers, 1);
+		state = ijkAtomicCompareExchangeD(&lock->state, ijk_rwlock_writer, 0);
+		for (i = 0; state && i < ijk_sync_spin; ++i)
+		{
+			ijkAtomicPause();
+			if (!ijkAtomicLoadD(&lock->state))
+				state = ijkAtomicCompareExchangeD(&lock->state, ijk_rwlock_writer, 0);
+		}
+
+		// sleep until the last reader or previous writer wakes one writer
+		while (state)
+		{
+			ijkAtomicWaitD(&lock->state, state);
+			state = ijkAtomicCompareExchangeD(&lock->state, ijk_rwlock_writer, 0);
+		}
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkRWLockWriteUnlock(ijkRWLock* const lock)
+{
+	if (lock)
+	{
+		if (ijkAtomicLoadD(&lock->state) == ijk_rwlock_writer)
+		{
+			// release before leaving writer count so waiting readers stay 
+			//	out; hand off to the next writer if any, otherwise wake all 
+			//	readers
+			ijkAtomicExchangeD(&lock->state, 0);
+			if (ijkAtomicAddD(&lock->writers, (dword)-1) == 1)
+				ijkAtomicWakeD(&lock->writers, 0);
+			else
+				ijkAtomicWakeD(&lock->state, 1);
+			return ijk_success;
+		}
+		return ijk_fail_operationfail;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkBarrierCreate(ijkBarrier* const barrier_out, dword const count)
+{
+	if (barrier_out && count)
+	{
+		barrier_out->count = count;
+		ijkAtomicStoreD(&barrier_out->arrived, 0);
+		ijkAtomicStoreD(&barrier_out->phase, 0);
+		return ijk_success;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkBarrierWait(ijkBarrier* const barrier)
+{
+	if (barrier && barrier->count)
+	{
+		// read phase before arriving so its change cannot be missed
+		dword const phase = ijkAtomicLoadD(&barrier->phase);
+		uitr i;
+		if (ijkAtomicAddD(&barrier->arrived, 1) + 1 == barrier->count)
+		{
+			// last to arrive: reset for next phase before releasing others, 
+			//	since they may arrive again as soon as phase changes
+			ijkAtomicStoreD(&barrier->arrived, 0);
+			ijkAtomicAddD(&barrier->phase, 1);
+			ijkAtomicWakeD(&barrier->phase, 0);
+			return ijk_true;
+		}
+
+		// spin, then sleep until phase changes
+		for (i = 0; ijkAtomicLoadD(&barrier->phase) == phase && i < ijk_sync_spin; ++i)
+			ijkAtomicPause();
+		while (ijkAtomicLoadD(&barrier->phase) == phase)
+			ijkAtomicWaitD(&barrier->phase, phase);
+		return ijk_false;
+	}
+	return ijk_fail_invalidparams;
+}
+
+
 //-----------------------------------------------------------------------------
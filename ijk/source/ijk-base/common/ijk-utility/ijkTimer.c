@@ -30,11 +30,101 @@
 #include <Windows.h>
 #else	// !WINDOWS
 #include <time.h>
+#if (defined __x86_64__ || defined __i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define ijk_timer_tsc		// time stamp counter may be used
+#endif	// __x86_64__ || __i386__
 #define BILLION				1000000000
 typedef struct timespec		timespec;
 #endif	// WINDOWS
 
 
+//-----------------------------------------------------------------------------
+
+#if (__ijk_cfg_platform != WINDOWS)
+// calibration time for time stamp counter in nanoseconds
+#define ijk_timer_calibrate	5000000
+
+// raw tick source and rate, chosen once at startup
+static ibool ijkTimerInternalTSC;
+static qword ijkTimerInternalFreq = BILLION;
+
+
+// internal raw monotonic clock in nanoseconds; unlike the realtime clock, 
+//	it is not slewed or stepped by time adjustment
+ijk_inl qword ijkTimerInternalClock()
+{
+	timespec t;
+	clock_gettime(CLOCK_MONOTONIC_RAW, &t);
+	return ((qword)t.tv_sec * BILLION + (qword)t.tv_nsec);
+}
+
+
+// internal startup: use time stamp counter if it is invariant (constant 
+//	rate, runs in all power states), taking its rate from the processor if 
+//	reported, otherwise measuring it against the clock
+__attribute__((constructor)) void ijkTimerInternalCalibrate()
+{
+#ifdef ijk_timer_tsc
+	unsigned int a, b, c, d;
+	qword c0, c1, t0, t1;
+	if (__get_cpuid(0x80000000, &a, &b, &c, &d) && a >= 0x80000007
+		&& __get_cpuid(0x80000007, &a, &b, &c, &d) && (d & (1 << 8)))
+	{
+		// leaf 0x15: counter to crystal ratio, and crystal rate
+		if (__get_cpuid(0, &a, &b, &c, &d) && a >= 0x15
+			&& __get_cpuid_count(0x15, 0, &a, &b, &c, &d) && a && b && c)
+			ijkTimerInternalFreq = (qword)c * b / a;
+		else
+		{
+			// bracket each clock read with counter reads and take midpoints
+			t0 = __rdtsc();
+			c0 = ijkTimerInternalClock();
+			t0 = (t0 + __rdtsc()) / 2;
+			do
+			{
+				t1 = __rdtsc();
+				c1 = ijkTimerInternalClock();
+				t1 = (t1 + __rdtsc()) / 2;
+			} while (c1 - c0 < ijk_timer_calibrate);
+			ijkTimerInternalFreq = (t1 - t0) * BILLION / (c1 - c0);
+		}
+		ijkTimerInternalTSC = ijk_true;
+	}
+#endif	// ijk_timer_tsc
+}
+#endif	// !WINDOWS
+
+
+qword ijkTimerNow()
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	LARGE_INTEGER t;
+	QueryPerformanceCounter(&t);
+	return (qword)t.QuadPart;
+#else	// !WINDOWS
+#ifdef ijk_timer_tsc
+	if (ijkTimerInternalTSC)
+		return __rdtsc();
+#endif	// ijk_timer_tsc
+	return ijkTimerInternalClock();
+#endif	// WINDOWS
+}
+
+
+qword ijkTimerNowRate()
+{
+#if (__ijk_cfg_platform == WINDOWS)
+	LARGE_INTEGER f;
+	QueryPerformanceFrequency(&f);
+	return (qword)f.QuadPart;
+#else	// !WINDOWS
+	return ijkTimerInternalFreq;
+#endif	// WINDOWS
+}
+
+
 //-----------------------------------------------------------------------------
 
 iret ijkTimerReset(ijkTimer* const timer)
@@ -93,19 +183,9 @@ iret ijkTimerStart(ijkTimer* const timer)
 	{
 		// take measurement
 		ibool result;
-#if (__ijk_cfg_platform == WINDOWS)
-		result = QueryPerformanceFrequency((PLARGE_INTEGER)timer->tf)
-			&& QueryPerformanceCounter((PLARGE_INTEGER)timer->t0);
-#else	// !WINDOWS
-		result = ijk_issuccess(clock_gettime(CLOCK_REALTIME, (timespec*)timer->t0));
-		if (result)
-		{
-			// convert to seconds
-			// measurement in nanoseconds
-			*timer->t0 = BILLION * ((dword*)timer->t0)[0] + ((dword*)timer->t0)[1];
-			*timer->tf = BILLION;
-		}
-#endif	// WINDOWS
+		*timer->tf = ijkTimerNowRate();
+		*timer->t0 = ijkTimerNow();
+		result = (*timer->tf != 0);
 
 		// check result
 		if (result)
@@ -130,14 +210,9 @@ iret ijkTimerStop(ijkTimer* const timer)
 	{
 		// take measurement
 		ibool result;
-#if (__ijk_cfg_platform == WINDOWS)
-		result = QueryPerformanceFrequency((PLARGE_INTEGER)timer->tf)
-			&& QueryPerformanceCounter((PLARGE_INTEGER)timer->t1);
-#else	// !WINDOWS
-		result = ijk_issuccess(clock_gettime(CLOCK_REALTIME, (timespec*)timer->t1));
-		if (result)
-			*timer->t1 = BILLION * ((dword*)timer->t1)[0] + ((dword*)timer->t1)[1];
-#endif	// WINDOWS
+		*timer->tf = ijkTimerNowRate();
+		*timer->t1 = ijkTimerNow();
+		result = (*timer->tf != 0);
 
 		// check result
 		if (result)
@@ -165,14 +240,9 @@ iret ijkTimerCheckTick(ijkTimer* const timer)
 	{
 		// take measurement
 		ibool result;
-#if (__ijk_cfg_platform == WINDOWS)
-		result = QueryPerformanceFrequency((PLARGE_INTEGER)timer->tf)
-			&& QueryPerformanceCounter((PLARGE_INTEGER)timer->t1);
-#else	// !WINDOWS
-		result = ijk_issuccess(clock_gettime(CLOCK_REALTIME, (timespec*)timer->t1));
-		if (result)
-			*timer->t1 = BILLION * ((dword*)timer->t1)[0] + ((dword*)timer->t1)[1];
-#endif	// WINDOWS
+		*timer->tf = ijkTimerNowRate();
+		*timer->t1 = ijkTimerNow();
+		result = (*timer->tf != 0);
 
 		// check result
 		if (result)
@@ -0,0 +1,54 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijk-benchmark.c
+	Command line benchmark runner.
+*/
+
+#include <stdio.h>
+
+#include "ijk/ijk-base/ijk-base.h"
+#include "ijk/ijk-math/ijk-math.h"
+
+
+// time every hot math kernel (ijk-math.c)
+iret ijkMathBenchmark(kcstr const filePathJSON_opt, kcstr const filePathCSV_opt);
+
+
+//-----------------------------------------------------------------------------
+// command line entry point: ijk-benchmark [results.json [results.csv]]
+
+int main(int const argc, char* argv[])
+{
+	char const* const filePathJSON = argc > 1 ? argv[1] : "ijk-benchmark.json";
+	char const* const filePathCSV = argc > 2 ? argv[2] : "ijk-benchmark.csv";
+	iret const result = ijkMathBenchmark((kcstr)filePathJSON, (kcstr)filePathCSV);
+	if (ijk_issuccess(result))
+	{
+		printf("ijk-benchmark: results written to '%s' and '%s'\n", filePathJSON, filePathCSV);
+		return 0;
+	}
+	fprintf(stderr, "ijk-benchmark: failed (%d)\n", result);
+	return 1;
+}
+
+
+//-----------------------------------------------------------------------------
@@ -26,6 +26,7 @@
 #include <malloc.h>
 
 #include "ijk/ijk-math/ijk-math.h"
+#include "ijk/ijk-base/ijk-utility/ijkBenchmark.h"
 
 
 //-----------------------------------------------------------------------------
@@ -845,6 +846,108 @@ void ijkMathTestVector()
 }
 
 
+typedef struct ijkMathTestParallelOutside
+{
+	ptr jobs;
+	float3* v_out;
+	float3 const* v_in;
+	size count;
+	iret result;
+} ijkMathTestParallelOutside;
+
+
+iret ijkMathTestParallelOutsideEntry(ptr entryArg)
+{
+	// a thread that is not one of the system's has no deque to split into
+	ijkMathTestParallelOutside* const outside = (ijkMathTestParallelOutside*)entryArg;
+	outside->result = ijkParallelVecNormalize3fv(outside->jobs, outside->v_out, outside->v_in, outside->count);
+	return ijk_success;
+}
+
+
+void ijkMathTestParallel()
+{
+	// batch kernels over a large set compared against serial versions
+	size const count = 1 << 20, baseSize = 1 << 20;
+	tag const name = "ijkMathTestParallel";
+	ptr const jobs = malloc(baseSize);
+	float3* const v_flt = (float3*)malloc(count * sizeof(float3) * 3);
+	flt* const s_flt = (flt*)malloc(count * sizeof(flt));
+	float3* const v_serial = v_flt + count, * const v_parallel = v_serial + count;
+	float4x4 m;
+	flt test_flt = flt_zero, test2_flt[1] = { flt_zero }, error = flt_zero, d;
+	ijkThread thread[1] = { 0 };
+	ijkMathTestParallelOutside outside[1] = { 0 };
+	size i, j;
+	iret result = ijk_success;
+
+	if (!jobs || !v_flt || !s_flt)
+	{
+		free(jobs);
+		free(v_flt);
+		free(s_flt);
+		return;
+	}
+	for (i = 0; i < count; ++i)
+	{
+		v_flt[i][0] = (flt)(i & 0xFF);
+		v_flt[i][1] = (flt)((i >> 8) & 0xFF);
+		v_flt[i][2] = (flt)1;
+		s_flt[i] = (flt)(i & 0xFF);
+	}
+	ijkMatInitElems4fm(m,
+		+2.0f, +0.0f, +0.0f, +0.0f,
+		+0.0f, +0.0f, +2.0f, +0.0f,
+		+0.0f, -2.0f, +0.0f, +0.0f,
+		+1.0f, +2.0f, +3.0f, +1.0f);
+
+	result = ijkJobSystemCreate(jobs, baseSize, 0, ijk_false, name);					// ijk_success
+
+	for (i = 0; i < count; ++i)
+		ijkMatMulVecTransform4fmv3(v_serial[i], m, v_flt[i]);
+	result = ijkParallelMatMulVecTransform4fmv3(jobs, v_parallel, m, v_flt, count);	// ijk_success
+	for (i = 0; i < count; ++i)
+		for (j = 0; j < 3; ++j)
+		{
+			d = v_parallel[i][j] - v_serial[i][j];
+			if (ijk_abs_flt(d) > error)
+				error = ijk_abs_flt(d);												// 0.0 (same ops per element)
+		}
+
+	for (i = 0; i < count; ++i)
+		ijkVecNormalize3fv(v_serial[i], v_flt[i]);
+	result = ijkParallelVecNormalize3fv(jobs, v_parallel, v_flt, count);			// ijk_success
+	for (i = 0; i < count; ++i)
+		for (j = 0; j < 3; ++j)
+		{
+			d = v_parallel[i][j] - v_serial[i][j];
+			if (ijk_abs_flt(d) > error)
+				error = ijk_abs_flt(d);												// 0.0
+		}
+
+	test_flt = ijkStatsGetMean_flt(s_flt, count);									// 127.062759 (serial sum loses precision)
+	test_flt = ijkParallelStatsGetMean_flt(jobs, s_flt, count);						// 127.5 (ranges summed pairwise)
+	test_flt = ijkStatsGetVariance_flt(s_flt, count, test2_flt);					// 5461.474121 (exact 5461.255208)
+	test_flt = ijkParallelStatsGetVariance_flt(jobs, s_flt, count, test2_flt);		// 5461.052246 (mean 127.5)
+	test_flt = ijkParallelStatsGetVariance_flt(jobs, s_flt, 1, test2_flt);			// 0.0 (mean 0.0)
+
+	outside->jobs = jobs;
+	outside->v_out = v_parallel;
+	outside->v_in = v_flt;
+	outside->count = count;
+	result = ijkThreadCreate(thread, ijkMathTestParallelOutsideEntry, outside, name);	// ijk_success
+	result = ijkThreadRelease(thread);												// ijk_success
+	result = outside->result;														// ijk_fail_operationfail (not a worker)
+
+	result = ijkJobSystemRelease(jobs);												// ijk_success
+	ijk_unused(test_flt);
+	ijk_unused(result);
+	free(jobs);
+	free(v_flt);
+	free(s_flt);
+}
+
+
 //-----------------------------------------------------------------------------
 
 void ijkMathTest()
@@ -856,6 +959,652 @@ void ijkMathTest()
 	ijkMathTestInterpolation();
 	ijkMathTestTrigonometry();
 	ijkMathTestVector();
+	ijkMathTestParallel();
+}
+
+
+//-----------------------------------------------------------------------------
+
+// benchmark inputs: kernels cycle through a set small enough to stay in 
+//	cache, so they measure arithmetic rather than memory, and store every 
+//	result so that none is optimized away
+#define ijk_math_bench_count	1024
+#define ijk_math_bench_mask		(ijk_math_bench_count - 1)
+
+typedef struct ijkMathBenchData
+{
+	flt x_flt[ijk_math_bench_count], deg_flt[ijk_math_bench_count], rad_flt[ijk_math_bench_count], t_flt[ijk_math_bench_count];
+	dbl x_dbl[ijk_math_bench_count], deg_dbl[ijk_math_bench_count], rad_dbl[ijk_math_bench_count];
+	flt y_flt[ijk_math_bench_count], y2_flt[ijk_math_bench_count];
+	dbl y_dbl[ijk_math_bench_count], y2_dbl[ijk_math_bench_count];
+	float4 v[ijk_math_bench_count], v_out[ijk_math_bench_count];
+	float4 q[ijk_math_bench_count], q_out[ijk_math_bench_count];
+	float4x4 m[16], m_out[16];
+} ijkMathBenchData;
+
+
+// benchmark kernels: each runs one function over the inputs
+void ijkMathBenchSqrtInv0x_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkSqrtInv0x_flt(d->x_flt[j]);
+	}
+}
+
+
+void ijkMathBenchSqrtInv_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkSqrtInv_flt(d->x_flt[j]);
+	}
+}
+
+
+void ijkMathBenchSqrt0x_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkSqrt0x_flt(d->x_flt[j]);
+	}
+}
+
+
+void ijkMathBenchSqrt_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkSqrt_flt(d->x_flt[j]);
+	}
+}
+
+
+void ijkMathBenchSqrtInv0x_dbl(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_dbl[j] = ijkSqrtInv0x_dbl(d->x_dbl[j]);
+	}
+}
+
+
+void ijkMathBenchSqrtInv_dbl(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_dbl[j] = ijkSqrtInv_dbl(d->x_dbl[j]);
+	}
+}
+
+
+void ijkMathBenchSqrt0x_dbl(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_dbl[j] = ijkSqrt0x_dbl(d->x_dbl[j]);
+	}
+}
+
+
+void ijkMathBenchSqrt_dbl(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_dbl[j] = ijkSqrt_dbl(d->x_dbl[j]);
+	}
+}
+
+
+void ijkMathBenchTrigSin_deg_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkTrigSin_deg_flt(d->deg_flt[j]);
+	}
+}
+
+
+void ijkMathBenchTrigSinTaylor_deg_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkTrigSinTaylor_deg_flt(d->deg_flt[j]);
+	}
+}
+
+
+void ijkMathBenchTrigCos_deg_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkTrigCos_deg_flt(d->deg_flt[j]);
+	}
+}
+
+
+void ijkMathBenchTrigCosTaylor_deg_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkTrigCosTaylor_deg_flt(d->deg_flt[j]);
+	}
+}
+
+
+void ijkMathBenchTrigSin_rad_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkTrigSin_rad_flt(d->rad_flt[j]);
+	}
+}
+
+
+void ijkMathBenchTrigSinTaylor_rad_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkTrigSinTaylor_rad_flt(d->rad_flt[j]);
+	}
+}
+
+
+void ijkMathBenchTrigSinCos_deg_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkTrigSinCos_deg_flt(d->deg_flt[j], d->y_flt + j, d->y2_flt + j);
+	}
+}
+
+
+void ijkMathBenchTrigSinCosTaylor_deg_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkTrigSinCosTaylor_deg_flt(d->deg_flt[j], d->y_flt + j, d->y2_flt + j);
+	}
+}
+
+
+void ijkMathBenchTrigSin_deg_dbl(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_dbl[j] = ijkTrigSin_deg_dbl(d->deg_dbl[j]);
+	}
+}
+
+
+void ijkMathBenchTrigSinTaylor_deg_dbl(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_dbl[j] = ijkTrigSinTaylor_deg_dbl(d->deg_dbl[j]);
+	}
+}
+
+
+void ijkMathBenchTrigSin_rad_dbl(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_dbl[j] = ijkTrigSin_rad_dbl(d->rad_dbl[j]);
+	}
+}
+
+
+void ijkMathBenchTrigSinTaylor_rad_dbl(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_dbl[j] = ijkTrigSinTaylor_rad_dbl(d->rad_dbl[j]);
+	}
+}
+
+
+void ijkMathBenchTrigSinCos_deg_dbl(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkTrigSinCos_deg_dbl(d->deg_dbl[j], d->y_dbl + j, d->y2_dbl + j);
+	}
+}
+
+
+void ijkMathBenchTrigSinCosTaylor_deg_dbl(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkTrigSinCosTaylor_deg_dbl(d->deg_dbl[j], d->y_dbl + j, d->y2_dbl + j);
+	}
+}
+
+
+void ijkMathBenchInterpLinear_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkInterpLinear_flt(d->x_flt[j], d->deg_flt[j], d->t_flt[j]);
+	}
+}
+
+
+void ijkMathBenchInterpBilinear_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkInterpBilinear_flt(d->x_flt[j], d->deg_flt[j], d->rad_flt[j], d->y2_flt[j], d->t_flt[j], d->t_flt[j ^ 1], d->t_flt[j ^ 2]);
+	}
+}
+
+
+void ijkMathBenchInterpSmoothstep_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkInterpSmoothstep_flt(d->t_flt[j]);
+	}
+}
+
+
+void ijkMathBenchInterpCubicHermite_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkInterpCubicHermite_flt(d->x_flt[j], d->deg_flt[j], d->rad_flt[j], d->y2_flt[j], d->t_flt[j]);
+	}
+}
+
+
+void ijkMathBenchInterpCubicCatmullRom_flt(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkInterpCubicCatmullRom_flt(d->x_flt[j], d->deg_flt[j], d->rad_flt[j], d->y2_flt[j], d->t_flt[j]);
+	}
+}
+
+
+void ijkMathBenchVecNormalize3fv(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkVecNormalize3fv(d->v_out[j], d->v[j]);
+	}
+}
+
+
+void ijkMathBenchVecCross3fv(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkVecCross3fv(d->v_out[j], d->v[j], d->v[j ^ 1]);
+	}
+}
+
+
+void ijkMathBenchVecDot4fv(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		d->y_flt[j] = ijkVecDot4fv(d->v[j], d->v[j ^ 1]);
+	}
+}
+
+
+void ijkMathBenchMatMulVec4fmv(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkMatMulVec4fmv(d->v_out[j], d->m[j & 15], d->v[j]);
+	}
+}
+
+
+void ijkMathBenchMatMulVecTransform4fmv3(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkMatMulVecTransform4fmv3(d->v_out[j], d->m[j & 15], d->v[j]);
+	}
+}
+
+
+void ijkMathBenchMatMul4fm(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkMatMul4fm(d->m_out[j & 15], d->m[j & 15], d->m[(j + 1) & 15]);
+	}
+}
+
+
+void ijkMathBenchMatTranspose4fm(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkMatTranspose4fm(d->m_out[j & 15], d->m[j & 15]);
+	}
+}
+
+
+void ijkMathBenchMatInverse4fm(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkMatInverse4fm(d->m_out[j & 15], d->m[j & 15]);
+	}
+}
+
+
+void ijkMathBenchQuatMulQfv(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkQuatMulQfv(d->q_out[j], d->q[j], d->q[j ^ 1]);
+	}
+}
+
+
+void ijkMathBenchQuatNormalizeQfv(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkQuatNormalizeQfv(d->q_out[j], d->q[j]);
+	}
+}
+
+
+void ijkMathBenchQuatUnitRotateVecQfv3(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkQuatUnitRotateVecQfv3(d->v_out[j], d->q[j], d->v[j]);
+	}
+}
+
+
+void ijkMathBenchQuatUnitGetMatQfv4(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkQuatUnitGetMatQfv4(d->m_out[j & 15], d->q[j]);
+	}
+}
+
+
+void ijkMathBenchQuatNlerpQfv(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkQuatNlerpQfv(d->q_out[j], d->q[j], d->q[j ^ 1], d->t_flt[j]);
+	}
+}
+
+
+void ijkMathBenchQuatSlerpQfv(ptr const benchArg, size const iterations)
+{
+	ijkMathBenchData* const d = (ijkMathBenchData*)benchArg;
+	size i, j;
+	for (i = 0; i < iterations; ++i)
+	{
+		j = i & ijk_math_bench_mask;
+		ijkQuatSlerpQfv(d->q_out[j], d->q[j], d->q[j ^ 1], d->t_flt[j]);
+	}
+}
+
+
+// kernel list in run order
+typedef struct ijkMathBenchEntry
+{
+	kcstr name;
+	ijkBenchmarkFunc func;
+} ijkMathBenchEntry;
+
+ijkMathBenchEntry const ijkMathBenchList[] = {
+	{ (kcstr)"ijkSqrtInv0x_flt", ijkMathBenchSqrtInv0x_flt },
+	{ (kcstr)"ijkSqrtInv_flt", ijkMathBenchSqrtInv_flt },
+	{ (kcstr)"ijkSqrt0x_flt", ijkMathBenchSqrt0x_flt },
+	{ (kcstr)"ijkSqrt_flt", ijkMathBenchSqrt_flt },
+	{ (kcstr)"ijkSqrtInv0x_dbl", ijkMathBenchSqrtInv0x_dbl },
+	{ (kcstr)"ijkSqrtInv_dbl", ijkMathBenchSqrtInv_dbl },
+	{ (kcstr)"ijkSqrt0x_dbl", ijkMathBenchSqrt0x_dbl },
+	{ (kcstr)"ijkSqrt_dbl", ijkMathBenchSqrt_dbl },
+	{ (kcstr)"ijkTrigSin_deg_flt", ijkMathBenchTrigSin_deg_flt },
+	{ (kcstr)"ijkTrigSinTaylor_deg_flt", ijkMathBenchTrigSinTaylor_deg_flt },
+	{ (kcstr)"ijkTrigCos_deg_flt", ijkMathBenchTrigCos_deg_flt },
+	{ (kcstr)"ijkTrigCosTaylor_deg_flt", ijkMathBenchTrigCosTaylor_deg_flt },
+	{ (kcstr)"ijkTrigSin_rad_flt", ijkMathBenchTrigSin_rad_flt },
+	{ (kcstr)"ijkTrigSinTaylor_rad_flt", ijkMathBenchTrigSinTaylor_rad_flt },
+	{ (kcstr)"ijkTrigSinCos_deg_flt", ijkMathBenchTrigSinCos_deg_flt },
+	{ (kcstr)"ijkTrigSinCosTaylor_deg_flt", ijkMathBenchTrigSinCosTaylor_deg_flt },
+	{ (kcstr)"ijkTrigSin_deg_dbl", ijkMathBenchTrigSin_deg_dbl },
+	{ (kcstr)"ijkTrigSinTaylor_deg_dbl", ijkMathBenchTrigSinTaylor_deg_dbl },
+	{ (kcstr)"ijkTrigSin_rad_dbl", ijkMathBenchTrigSin_rad_dbl },
+	{ (kcstr)"ijkTrigSinTaylor_rad_dbl", ijkMathBenchTrigSinTaylor_rad_dbl },
+	{ (kcstr)"ijkTrigSinCos_deg_dbl", ijkMathBenchTrigSinCos_deg_dbl },
+	{ (kcstr)"ijkTrigSinCosTaylor_deg_dbl", ijkMathBenchTrigSinCosTaylor_deg_dbl },
+	{ (kcstr)"ijkInterpLinear_flt", ijkMathBenchInterpLinear_flt },
+	{ (kcstr)"ijkInterpBilinear_flt", ijkMathBenchInterpBilinear_flt },
+	{ (kcstr)"ijkInterpSmoothstep_flt", ijkMathBenchInterpSmoothstep_flt },
+	{ (kcstr)"ijkInterpCubicHermite_flt", ijkMathBenchInterpCubicHermite_flt },
+	{ (kcstr)"ijkInterpCubicCatmullRom_flt", ijkMathBenchInterpCubicCatmullRom_flt },
+	{ (kcstr)"ijkVecNormalize3fv", ijkMathBenchVecNormalize3fv },
+	{ (kcstr)"ijkVecCross3fv", ijkMathBenchVecCross3fv },
+	{ (kcstr)"ijkVecDot4fv", ijkMathBenchVecDot4fv },
+	{ (kcstr)"ijkMatMulVec4fmv", ijkMathBenchMatMulVec4fmv },
+	{ (kcstr)"ijkMatMulVecTransform4fmv3", ijkMathBenchMatMulVecTransform4fmv3 },
+	{ (kcstr)"ijkMatMul4fm", ijkMathBenchMatMul4fm },
+	{ (kcstr)"ijkMatTranspose4fm", ijkMathBenchMatTranspose4fm },
+	{ (kcstr)"ijkMatInverse4fm", ijkMathBenchMatInverse4fm },
+	{ (kcstr)"ijkQuatMulQfv", ijkMathBenchQuatMulQfv },
+	{ (kcstr)"ijkQuatNormalizeQfv", ijkMathBenchQuatNormalizeQfv },
+	{ (kcstr)"ijkQuatUnitRotateVecQfv3", ijkMathBenchQuatUnitRotateVecQfv3 },
+	{ (kcstr)"ijkQuatUnitGetMatQfv4", ijkMathBenchQuatUnitGetMatQfv4 },
+	{ (kcstr)"ijkQuatNlerpQfv", ijkMathBenchQuatNlerpQfv },
+	{ (kcstr)"ijkQuatSlerpQfv", ijkMathBenchQuatSlerpQfv },
+};
+
+
+// internal write of results to file
+iret ijkMathBenchmarkWrite(ijkBenchmark const* const bench, kcstr const filePath, ijkBenchmarkFormat const format)
+{
+	ijkStream stream[1] = { 0 };
+	iret result = ijkStreamCreateFile(stream, filePath, ijk_false);
+	if (ijk_issuccess(result))
+	{
+		result = ijkBenchmarkWrite(bench, stream, format);
+		ijkStreamRelease(stream);
+	}
+	return result;
+}
+
+
+// ijkMathBenchmark
+//	Time every hot math kernel and write results to JSON and/or CSV files; 
+//	the ijk-benchmark runner calls this to compare approximations (fast 
+//	inverse square root, table trigonometry) against the exact versions on 
+//	each platform. Returns failure if a result could not be written.
+iret ijkMathBenchmark(kcstr const filePathJSON_opt, kcstr const filePathCSV_opt)
+{
+	size const subdivisionsPerDegree = 4, sampleCount = 200;
+	size const tableSize_flt = ijkTrigGetTableSize_flt(subdivisionsPerDegree), tableSize_dbl = ijkTrigGetTableSize_dbl(subdivisionsPerDegree);
+	size const benchCount = sizeof(ijkMathBenchList) / sizeof(*ijkMathBenchList);
+	size const benchSize = sampleCount * sizeof(dbl) + benchCount * sizeof(ijkBenchmarkResult);
+	ijkMathBenchData* const d = (ijkMathBenchData*)malloc(sizeof(ijkMathBenchData));
+	flt* const table_flt = (flt*)malloc(tableSize_flt);
+	dbl* const table_dbl = (dbl*)malloc(tableSize_dbl);
+	ptr const bench_base = malloc(benchSize);
+	ijkBenchmark bench[1];
+	float3 axis;
+	size i;
+	iret result = ijk_fail_operationfail;
+
+	if (d && table_flt && table_dbl && bench_base)
+	{
+		// trigonometry kernels need tables set
+		ijkTrigInit_flt(table_flt, tableSize_flt, subdivisionsPerDegree);
+		ijkTrigInit_dbl(table_dbl, tableSize_dbl, subdivisionsPerDegree);
+
+		// inputs spread over each domain, deterministically
+		for (i = 0; i < ijk_math_bench_count; ++i)
+		{
+			d->x_flt[i] = (flt)(i + 1) * 0.5f;
+			d->x_dbl[i] = (dbl)(i + 1) * 0.5;
+			d->deg_flt[i] = (flt)(i * 701 % 1440) * 0.5f - 360.0f;
+			d->deg_dbl[i] = (dbl)(i * 701 % 1440) * 0.5 - 360.0;
+			d->rad_flt[i] = ijkTrigDeg2Rad_flt(d->deg_flt[i]);
+			d->rad_dbl[i] = ijkTrigDeg2Rad_dbl(d->deg_dbl[i]);
+			d->t_flt[i] = (flt)(i * 37 % 256) / 255.0f;
+			d->y2_flt[i] = (flt)(i * 13 % 100);
+			ijkVecInitElems4fv(d->v[i], (flt)(i % 7) - 3.0f, (flt)(i % 5) + 1.0f, (flt)(i % 3) - 1.5f, 1.0f);
+			ijkVecInitElems3fv(axis, (flt)(i % 5) + 1.0f, (flt)(i % 3) - 1.5f, (flt)(i % 7) - 3.0f);
+			ijkVecNormalize3fv(axis, axis);
+			ijkQuatAxisAngleQfv(d->q[i], axis, d->deg_flt[i]);
+		}
+		for (i = 0; i < 16; ++i)
+			ijkMatInitElems4fm(d->m[i],
+				+2.0f, (flt)i * 0.125f, +0.0f, +0.0f,
+				+0.0f, +0.0f, +2.0f, +0.0f,
+				+0.0f, -2.0f, +0.0f, +0.0f,
+				+1.0f, +2.0f, +3.0f, +1.0f);
+
+		result = ijkBenchmarkCreate(bench, bench_base, benchSize, sampleCount, 0.1, 0.001);
+		for (i = 0; i < benchCount && ijk_issuccess(result); ++i)
+			result = ijkBenchmarkRun(bench, ijkMathBenchList[i].name, ijkMathBenchList[i].func, d, 0);
+		if (ijk_issuccess(result) && filePathJSON_opt)
+			result = ijkMathBenchmarkWrite(bench, filePathJSON_opt, ijkBenchmarkFormat_json);
+		if (ijk_issuccess(result) && filePathCSV_opt)
+			result = ijkMathBenchmarkWrite(bench, filePathCSV_opt, ijkBenchmarkFormat_csv);
+		ijkBenchmarkRelease(bench);
+	}
+	free(d);
+	free(table_flt);
+	free(table_dbl);
+	free(bench_base);
+	return result;
 }
 
 
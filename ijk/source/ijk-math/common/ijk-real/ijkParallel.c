@@ -0,0 +1,319 @@
+/*
+   Copyright 2020-2021 Daniel S. Buckstein
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+	   http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+/*
+	ijk: an open-source, cross-platform, light-weight,
+		c-based rendering framework
+	By Daniel S. Buckstein
+
+	ijkParallel.c
+	Source definitions for parallel batch math kernels.
+*/
+
+#include "ijk/ijk-math/ijk-real/ijkParallel.h"
+
+
+//-----------------------------------------------------------------------------
+
+// kernel arguments
+typedef struct ijkParallelVec3_flt
+{
+	float3* v_out;
+	float3 const* v_in;
+	float4 const* m;
+} ijkParallelVec3_flt;
+
+typedef struct ijkParallelVec3_dbl
+{
+	double3* v_out;
+	double3 const* v_in;
+	double4 const* m;
+} ijkParallelVec3_dbl;
+
+
+// partial mean and squared deviation of a range
+typedef struct ijkParallelMoments_flt
+{
+	size n;
+	flt mean, m2;
+} ijkParallelMoments_flt;
+
+typedef struct ijkParallelMoments_dbl
+{
+	size n;
+	dbl mean, m2;
+} ijkParallelMoments_dbl;
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkParallelInternalTransform_flt(ptr arg, size first, size count, ptr result_out)
+{
+	ijkParallelVec3_flt const* const k = (ijkParallelVec3_flt const*)arg;
+	uitr i;
+	ijk_unused(result_out);
+	for (i = first, count += first; i < count; ++i)
+		ijkMatMulVecTransform4fmv3(k->v_out[i], k->m, k->v_in[i]);
+	return ijk_success;
+}
+
+
+iret ijkParallelInternalNormalize_flt(ptr arg, size first, size count, ptr result_out)
+{
+	ijkParallelVec3_flt const* const k = (ijkParallelVec3_flt const*)arg;
+	uitr i;
+	ijk_unused(result_out);
+	for (i = first, count += first; i < count; ++i)
+		ijkVecNormalize3fv(k->v_out[i], k->v_in[i]);
+	return ijk_success;
+}
+
+
+iret ijkParallelInternalSum_flt(ptr arg, size first, size count, ptr result_out)
+{
+	flt const* const v = (flt const*)arg + first;
+	flt sum;
+	uitr i;
+	for (i = 0, sum = flt_zero; i < count; ++i)
+		sum += v[i];
+	*(flt*)result_out = sum;
+	return ijk_success;
+}
+
+
+iret ijkParallelInternalSumCombine_flt(ptr arg, ptr result_inout, kptr result)
+{
+	ijk_unused(arg);
+	*(flt*)result_inout += *(flt const*)result;
+	return ijk_success;
+}
+
+
+iret ijkParallelInternalMoments_flt(ptr arg, size first, size count, ptr result_out)
+{
+	// two passes over the range, as in the serial version
+	flt const* const v = (flt const*)arg + first;
+	ijkParallelMoments_flt* const moments = (ijkParallelMoments_flt*)result_out;
+	flt mean = flt_zero, m2 = flt_zero, d;
+	uitr i;
+	for (i = 0; i < count; ++i)
+		mean += v[i];
+	for (mean /= (flt)count,
+		i = 0; i < count; ++i)
+	{
+		d = v[i] - mean;
+		m2 += d * d;
+	}
+	moments->n = count;
+	moments->mean = mean;
+	moments->m2 = m2;
+	return ijk_success;
+}
+
+
+iret ijkParallelInternalMomentsCombine_flt(ptr arg, ptr result_inout, kptr result)
+{
+	// merge squared deviations about each mean (Chan et al.)
+	ijkParallelMoments_flt* const a = (ijkParallelMoments_flt*)result_inout;
+	ijkParallelMoments_flt const* const b = (ijkParallelMoments_flt const*)result;
+	size const n = a->n + b->n;
+	flt const d = b->mean - a->mean, nb_n = (flt)b->n / (flt)n;
+	ijk_unused(arg);
+	a->m2 += b->m2 + d * d * (flt)a->n * nb_n;
+	a->mean += d * nb_n;
+	a->n = n;
+	return ijk_success;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkParallelInternalTransform_dbl(ptr arg, size first, size count, ptr result_out)
+{
+	ijkParallelVec3_dbl const* const k = (ijkParallelVec3_dbl const*)arg;
+	uitr i;
+	ijk_unused(result_out);
+	for (i = first, count += first; i < count; ++i)
+		ijkMatMulVecTransform4dmv3(k->v_out[i], k->m, k->v_in[i]);
+	return ijk_success;
+}
+
+
+iret ijkParallelInternalNormalize_dbl(ptr arg, size first, size count, ptr result_out)
+{
+	ijkParallelVec3_dbl const* const k = (ijkParallelVec3_dbl const*)arg;
+	uitr i;
+	ijk_unused(result_out);
+	for (i = first, count += first; i < count; ++i)
+		ijkVecNormalize3dv(k->v_out[i], k->v_in[i]);
+	return ijk_success;
+}
+
+
+iret ijkParallelInternalSum_dbl(ptr arg, size first, size count, ptr result_out)
+{
+	dbl const* const v = (dbl const*)arg + first;
+	dbl sum;
+	uitr i;
+	for (i = 0, sum = dbl_zero; i < count; ++i)
+		sum += v[i];
+	*(dbl*)result_out = sum;
+	return ijk_success;
+}
+
+
+iret ijkParallelInternalSumCombine_dbl(ptr arg, ptr result_inout, kptr result)
+{
+	ijk_unused(arg);
+	*(dbl*)result_inout += *(dbl const*)result;
+	return ijk_success;
+}
+
+
+iret ijkParallelInternalMoments_dbl(ptr arg, size first, size count, ptr result_out)
+{
+	dbl const* const v = (dbl const*)arg + first;
+	ijkParallelMoments_dbl* const moments = (ijkParallelMoments_dbl*)result_out;
+	dbl mean = dbl_zero, m2 = dbl_zero, d;
+	uitr i;
+	for (i = 0; i < count; ++i)
+		mean += v[i];
+	for (mean /= (dbl)count,
+		i = 0; i < count; ++i)
+	{
+		d = v[i] - mean;
+		m2 += d * d;
+	}
+	moments->n = count;
+	moments->mean = mean;
+	moments->m2 = m2;
+	return ijk_success;
+}
+
+
+iret ijkParallelInternalMomentsCombine_dbl(ptr arg, ptr result_inout, kptr result)
+{
+	ijkParallelMoments_dbl* const a = (ijkParallelMoments_dbl*)result_inout;
+	ijkParallelMoments_dbl const* const b = (ijkParallelMoments_dbl const*)result;
+	size const n = a->n + b->n;
+	dbl const d = b->mean - a->mean, nb_n = (dbl)b->n / (dbl)n;
+	ijk_unused(arg);
+	a->m2 += b->m2 + d * d * (dbl)a->n * nb_n;
+	a->mean += d * nb_n;
+	a->n = n;
+	return ijk_success;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkParallelMatMulVecTransform4fmv3(ptr const jobs, float3 v_out[], float4x4 const m_lh, float3 const v_rh[], size const count)
+{
+	if (v_out && m_lh && v_rh)
+	{
+		ijkParallelVec3_flt k = { v_out, v_rh, m_lh };
+		return ijkParallelFor(jobs, count, ijk_parallel_grain, ijkParallelInternalTransform_flt, &k);
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkParallelVecNormalize3fv(ptr const jobs, float3 v_out[], float3 const v_in[], size const count)
+{
+	if (v_out && v_in)
+	{
+		ijkParallelVec3_flt k = { v_out, v_in, 0 };
+		return ijkParallelFor(jobs, count, ijk_parallel_grain, ijkParallelInternalNormalize_flt, &k);
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+flt ijkParallelStatsGetMean_flt(ptr const jobs, flt const v[], size const n)
+{
+	flt sum = flt_zero;
+	if (n > 0 && ijk_issuccess(ijkParallelReduce(jobs, n, ijk_parallel_grain,
+		ijkParallelInternalSum_flt, ijkParallelInternalSumCombine_flt, (ptr)v, &sum, sizeof(sum))))
+		return (sum / (flt)n);
+	return flt_zero;
+}
+
+
+flt ijkParallelStatsGetVariance_flt(ptr const jobs, flt const v[], size const n, flt mean_opt[1])
+{
+	ijkParallelMoments_flt moments = { 0, flt_zero, flt_zero };
+	flt var = flt_zero;
+	if (n > 1 && ijk_issuccess(ijkParallelReduce(jobs, n, ijk_parallel_grain,
+		ijkParallelInternalMoments_flt, ijkParallelInternalMomentsCombine_flt, (ptr)v, &moments, sizeof(moments))))
+		var = moments.m2 / (flt)(n - 1);
+	else
+		moments.mean = flt_zero;
+	if (mean_opt)
+		*mean_opt = moments.mean;
+	return var;
+}
+
+
+//-----------------------------------------------------------------------------
+
+iret ijkParallelMatMulVecTransform4dmv3(ptr const jobs, double3 v_out[], double4x4 const m_lh, double3 const v_rh[], size const count)
+{
+	if (v_out && m_lh && v_rh)
+	{
+		ijkParallelVec3_dbl k = { v_out, v_rh, m_lh };
+		return ijkParallelFor(jobs, count, ijk_parallel_grain, ijkParallelInternalTransform_dbl, &k);
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+iret ijkParallelVecNormalize3dv(ptr const jobs, double3 v_out[], double3 const v_in[], size const count)
+{
+	if (v_out && v_in)
+	{
+		ijkParallelVec3_dbl k = { v_out, v_in, 0 };
+		return ijkParallelFor(jobs, count, ijk_parallel_grain, ijkParallelInternalNormalize_dbl, &k);
+	}
+	return ijk_fail_invalidparams;
+}
+
+
+dbl ijkParallelStatsGetMean_dbl(ptr const jobs, dbl const v[], size const n)
+{
+	dbl sum = dbl_zero;
+	if (n > 0 && ijk_issuccess(ijkParallelReduce(jobs, n, ijk_parallel_grain,
+		ijkParallelInternalSum_dbl, ijkParallelInternalSumCombine_dbl, (ptr)v, &sum, sizeof(sum))))
+		return (sum / (dbl)n);
+	return dbl_zero;
+}
+
+
+dbl ijkParallelStatsGetVariance_dbl(ptr const jobs, dbl const v[], size const n, dbl mean_opt[1])
+{
+	ijkParallelMoments_dbl moments = { 0, dbl_zero, dbl_zero };
+	dbl var = dbl_zero;
+	if (n > 1 && ijk_issuccess(ijkParallelReduce(jobs, n, ijk_parallel_grain,
+		ijkParallelInternalMoments_dbl, ijkParallelInternalMomentsCombine_dbl, (ptr)v, &moments, sizeof(moments))))
+		var = moments.m2 / (dbl)(n - 1);
+	else
+		moments.mean = dbl_zero;
+	if (mean_opt)
+		*mean_opt = moments.mean;
+	return var;
+}
+
+
+//-----------------------------------------------------------------------------
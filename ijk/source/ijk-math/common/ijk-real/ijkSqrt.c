@@ -28,6 +28,41 @@
 
 //-----------------------------------------------------------------------------
 
+// assembled from 'ijkSqrt_a.asm' with masm; other compilers get the same 
+//	scalar instructions from their built-ins
+#if (__ijk_cfg_compiler != MSVC)
+
+flt ijkSqrt_flt(flt const x)
+{
+	// sqrtss
+	return __builtin_sqrtf(x);
+}
+
+
+flt ijkSqrtInv_flt(flt const x)
+{
+	// reciprocal first, then sqrtss
+	return __builtin_sqrtf(1.0f / x);
+}
+
+
+//-----------------------------------------------------------------------------
+
+dbl ijkSqrt_dbl(dbl const x)
+{
+	// sqrtsd
+	return __builtin_sqrt(x);
+}
+
+
+dbl ijkSqrtInv_dbl(dbl const x)
+{
+	// reciprocal first, then sqrtsd
+	return __builtin_sqrt(1.0 / x);
+}
+
+#else	// MSVC
+
 flt ijkSqrt_flt(flt const x)
 {
 	// see 'ijkSqrt_a.asm'
@@ -57,5 +92,7 @@ dbl ijkSqrtInv_dbl(dbl const x)
 	return x;
 }
 
+#endif	// !MSVC
+
 
 //-----------------------------------------------------------------------------